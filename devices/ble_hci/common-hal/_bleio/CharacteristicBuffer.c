@@ -19,7 +19,7 @@
 
 // Push all the data onto the ring buffer. When the buffer is full, new bytes will be dropped.
 static void write_to_ringbuf(bleio_characteristic_buffer_obj_t *self, uint8_t *data, uint16_t len) {
-    ringbuf_put_n(&self->ringbuf, data, len);
+    self->overflow_count += len - ringbuf_put_n(&self->ringbuf, data, len);
 }
 
 void bleio_characteristic_buffer_update(bleio_characteristic_buffer_obj_t *self, mp_buffer_info_t *bufinfo) {
@@ -36,6 +36,7 @@ void common_hal_bleio_characteristic_buffer_construct(bleio_characteristic_buffe
     self->timeout_ms = timeout * 1000;
     // This is a macro.
     ringbuf_alloc(&self->ringbuf, buffer_size);
+    self->overflow_count = 0;
 
     bleio_characteristic_set_observer(characteristic, self);
 }
@@ -61,6 +62,10 @@ uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(bleio_ch
     return count;
 }
 
+uint32_t common_hal_bleio_characteristic_buffer_get_overflow_count(bleio_characteristic_buffer_obj_t *self) {
+    return self->overflow_count;
+}
+
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(bleio_characteristic_buffer_obj_t *self) {
     ringbuf_clear(&self->ringbuf);
 }
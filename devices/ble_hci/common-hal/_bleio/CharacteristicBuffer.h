@@ -15,6 +15,8 @@ typedef struct {
     uint32_t timeout_ms;
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
+    // Incoming bytes dropped because ringbuf was full.
+    uint32_t overflow_count;
 } bleio_characteristic_buffer_obj_t;
 
 void bleio_characteristic_buffer_update(bleio_characteristic_buffer_obj_t *self, mp_buffer_info_t *bufinfo);
@@ -367,6 +367,14 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     // check_nrf_error(status);
 }
 
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self) {
+    // A controller that doesn't support these (most don't have the 2M PHY before
+    // Bluetooth 5) rejects them, and the link keeps its current settings.
+    hci_le_set_phy(self->conn_handle, 0, BT_HCI_LE_PHY_PREFER_2M, BT_HCI_LE_PHY_PREFER_2M, 0);
+    // 2120us is the time to send 251 bytes on the 1M PHY.
+    hci_le_set_data_len(self->conn_handle, 251, 2120);
+}
+
 // service_uuid may be NULL, to discover all services.
 // static bool discover_next_services(bleio_connection_internal_t* connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
 //     m_discovery_successful = false;
@@ -763,6 +763,28 @@ hci_result_t hci_le_conn_update(uint16_t handle, uint16_t conn_interval_min, uin
     return send_command(BT_HCI_OP_LE_CONN_UPDATE, sizeof(params), &params);
 }
 
+hci_result_t hci_le_set_data_len(uint16_t handle, uint16_t tx_octets, uint16_t tx_time) {
+    struct bt_hci_cp_le_set_data_len params = {
+        .handle = handle,
+        .tx_octets = tx_octets,
+        .tx_time = tx_time,
+    };
+
+    return send_command(BT_HCI_OP_LE_SET_DATA_LEN, sizeof(params), &params);
+}
+
+hci_result_t hci_le_set_phy(uint16_t handle, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys, uint16_t phy_opts) {
+    struct bt_hci_cp_le_set_phy params = {
+        .handle = handle,
+        .all_phys = all_phys,
+        .tx_phys = tx_phys,
+        .rx_phys = rx_phys,
+        .phy_opts = phy_opts,
+    };
+
+    return send_command(BT_HCI_OP_LE_SET_PHY, sizeof(params), &params);
+}
+
 hci_result_t hci_disconnect(uint16_t handle) {
     struct bt_hci_cp_disconnect params = {
         .handle = handle,
@@ -53,6 +53,56 @@ static mp_obj_t bytes_fromhex_bytes(mp_obj_t data) {
     return mp_obj_bytes_fromhex(MP_OBJ_FROM_PTR(&mp_type_bytes), data);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(bytes_fromhex_obj, bytes_fromhex_bytes);
+
+// CIRCUITPY-CHANGE: hexlify_into and unhexlify_into write into a given buffer
+static mp_obj_t mod_binascii_hexlify_into(mp_obj_t data, mp_obj_t buffer) {
+    check_not_unicode(data);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buffer, &outinfo, MP_BUFFER_WRITE);
+    if (outinfo.len < bufinfo.len * 2) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    static const char hexdigits[] = "0123456789abcdef";
+    // Backwards, so the data can be at the start of the buffer.
+    const byte *in = bufinfo.buf;
+    byte *out = outinfo.buf;
+    for (size_t i = bufinfo.len; i--;) {
+        byte b = in[i];
+        out[i * 2 + 1] = hexdigits[b & 0xf];
+        out[i * 2] = hexdigits[b >> 4];
+    }
+    return MP_OBJ_NEW_SMALL_INT(bufinfo.len * 2);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_hexlify_into_obj, mod_binascii_hexlify_into);
+
+static mp_obj_t mod_binascii_unhexlify_into(mp_obj_t data, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buffer, &outinfo, MP_BUFFER_WRITE);
+    // The output never passes the input, so the buffer can be the data.
+    const byte *in = bufinfo.buf;
+    const byte *in_end = in + bufinfo.len;
+    byte *out = outinfo.buf;
+    byte *out_end = out + outinfo.len;
+    mp_uint_t ch1, ch2;
+    while (in < in_end) {
+        if (unichar_isspace(ch1 = *in++)) {
+            continue;
+        }
+        if (in == in_end || !unichar_isxdigit(ch1) || !unichar_isxdigit(ch2 = *in++)) {
+            mp_raise_ValueError(MP_ERROR_TEXT("non-hex digit"));
+        }
+        if (out == out_end) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+        }
+        *out++ = (byte)((unichar_xdigit_value(ch1) << 4) | unichar_xdigit_value(ch2));
+    }
+    return MP_OBJ_NEW_SMALL_INT(out - (byte *)outinfo.buf);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_unhexlify_into_obj, mod_binascii_unhexlify_into);
 #endif
 
 // If ch is a character in the base64 alphabet, and is not a pad character, then
@@ -74,19 +124,14 @@ static int mod_binascii_sextet(byte ch) {
     }
 }
 
-static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
-    byte *in = bufinfo.buf;
-
-    vstr_t vstr;
-    vstr_init(&vstr, (bufinfo.len * 3) / 4 + 1); // Potentially over-allocate
-    byte *out = (byte *)vstr.buf;
-
+// CIRCUITPY-CHANGE: decode into out, shared by a2b_base64 and a2b_base64_into. The output
+// never passes the input, so out can be the input.
+static size_t mod_binascii_decode_base64(const byte *in, size_t in_len, byte *out, size_t out_len) {
+    size_t len = 0;
     uint shift = 0;
     int nbits = 0; // Number of meaningful bits in shift
     bool hadpad = false; // Had a pad character since last valid character
-    for (size_t i = 0; i < bufinfo.len; i++) {
+    for (size_t i = 0; i < in_len; i++) {
         if (in[i] == '=') {
             if ((nbits == 2) || ((nbits == 4) && hadpad)) {
                 nbits = 0;
@@ -105,7 +150,10 @@ static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
 
         if (nbits >= 8) {
             nbits -= 8;
-            out[vstr.len++] = (shift >> nbits) & 0xFF;
+            if (len == out_len) {
+                mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+            }
+            out[len++] = (shift >> nbits) & 0xFF;
         }
     }
 
@@ -113,31 +161,42 @@ static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
         mp_raise_ValueError(MP_ERROR_TEXT("incorrect padding"));
     }
 
+    return len;
+}
+
+static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    vstr_t vstr;
+    vstr_init(&vstr, (bufinfo.len * 3) / 4 + 1); // Potentially over-allocate
+    vstr.len = mod_binascii_decode_base64(bufinfo.buf, bufinfo.len, (byte *)vstr.buf, vstr.alloc);
+
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_binascii_a2b_base64_obj, mod_binascii_a2b_base64);
 
-static mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_newline };
-    static const mp_arg_t allowed_args[] = {
-        { MP_QSTR_newline, MP_ARG_BOOL, {.u_bool = true} },
-    };
-
-    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
-    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
-    uint8_t newline = args[ARG_newline].u_bool;
-    // CIRCUITPY-CHANGE
-    check_not_unicode(pos_args[0]);
+// CIRCUITPY-CHANGE: added
+static mp_obj_t mod_binascii_a2b_base64_into(mp_obj_t data, mp_obj_t buffer) {
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buffer, &outinfo, MP_BUFFER_WRITE);
+    size_t len = mod_binascii_decode_base64(bufinfo.buf, bufinfo.len, outinfo.buf, outinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(mod_binascii_a2b_base64_into_obj, mod_binascii_a2b_base64_into);
 
-    vstr_t vstr;
-    vstr_init_len(&vstr, ((bufinfo.len != 0) ? (((bufinfo.len - 1) / 3) + 1) * 4 : 0) + newline);
+// CIRCUITPY-CHANGE: encode into out, shared by b2a_base64 and b2a_base64_into
+static size_t mod_binascii_base64_encoded_len(size_t len, bool newline) {
+    return ((len != 0) ? (((len - 1) / 3) + 1) * 4 : 0) + newline;
+}
 
+static void mod_binascii_encode_base64(const byte *in, size_t in_len, byte *out_start, bool newline) {
     // First pass, we convert input buffer to numeric base 64 values
-    byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
+    byte *out = out_start;
     mp_uint_t i;
-    for (i = bufinfo.len; i >= 3; i -= 3) {
+    for (i = in_len; i >= 3; i -= 3) {
         *out++ = (in[0] & 0xFC) >> 2;
         *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
         *out++ = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
@@ -157,8 +216,8 @@ static mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args,
     }
 
     // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = (byte *)vstr.buf;
-    for (mp_uint_t j = vstr.len - newline; j--;) {
+    out = out_start;
+    for (mp_uint_t j = mod_binascii_base64_encoded_len(in_len, false); j--;) {
         if (*out < 26) {
             *out += 'A';
         } else if (*out < 52) {
@@ -177,10 +236,62 @@ static mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args,
     if (newline) {
         *out = '\n';
     }
+}
+
+static mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_newline };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_newline, MP_ARG_BOOL, {.u_bool = true} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    uint8_t newline = args[ARG_newline].u_bool;
+    // CIRCUITPY-CHANGE
+    check_not_unicode(pos_args[0]);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
+
+    vstr_t vstr;
+    vstr_init_len(&vstr, mod_binascii_base64_encoded_len(bufinfo.len, newline));
+    mod_binascii_encode_base64(bufinfo.buf, bufinfo.len, (byte *)vstr.buf, newline);
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(mod_binascii_b2a_base64_obj, 1, mod_binascii_b2a_base64);
 
+// CIRCUITPY-CHANGE: added
+static mp_obj_t mod_binascii_b2a_base64_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_buffer, ARG_newline };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_newline, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    bool newline = args[ARG_newline].u_bool;
+    check_not_unicode(args[ARG_data].u_obj);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &outinfo, MP_BUFFER_WRITE);
+
+    size_t len = mod_binascii_base64_encoded_len(bufinfo.len, newline);
+    if (outinfo.len < len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+    }
+    // The output is written ahead of the input, so they mustn't share memory.
+    const byte *in = bufinfo.buf;
+    const byte *out = outinfo.buf;
+    if (in < out + len && out < in + bufinfo.len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer must not overlap data"));
+    }
+    mod_binascii_encode_base64(bufinfo.buf, bufinfo.len, outinfo.buf, newline);
+    return MP_OBJ_NEW_SMALL_INT(len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_binascii_b2a_base64_into_obj, 2, mod_binascii_b2a_base64_into);
+
 // CIRCUITPY-CHANGE: no deflate
 #if MICROPY_PY_BINASCII_CRC32
 #include "lib/uzlib/uzlib.h"
@@ -202,9 +313,15 @@ static const mp_rom_map_elem_t mp_module_binascii_globals_table[] = {
     #if MICROPY_PY_BUILTINS_BYTES_HEX
     { MP_ROM_QSTR(MP_QSTR_hexlify), MP_ROM_PTR(&bytes_hex_as_bytes_obj) },
     { MP_ROM_QSTR(MP_QSTR_unhexlify), MP_ROM_PTR(&bytes_fromhex_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_hexlify_into), MP_ROM_PTR(&mod_binascii_hexlify_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unhexlify_into), MP_ROM_PTR(&mod_binascii_unhexlify_into_obj) },
     #endif
     { MP_ROM_QSTR(MP_QSTR_a2b_base64), MP_ROM_PTR(&mod_binascii_a2b_base64_obj) },
     { MP_ROM_QSTR(MP_QSTR_b2a_base64), MP_ROM_PTR(&mod_binascii_b2a_base64_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_a2b_base64_into), MP_ROM_PTR(&mod_binascii_a2b_base64_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_b2a_base64_into), MP_ROM_PTR(&mod_binascii_b2a_base64_into_obj) },
     // CIRCUITPY-CHANGE: no deflate
     #if MICROPY_PY_BINASCII_CRC32
     { MP_ROM_QSTR(MP_QSTR_crc32), MP_ROM_PTR(&mod_binascii_crc32_obj) },
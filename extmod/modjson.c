@@ -25,6 +25,8 @@
  */
 
 #include <stdio.h>
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 // CIRCUITPY-CHANGE
 #include "py/binary.h"
@@ -37,6 +39,49 @@
 
 #if MICROPY_PY_JSON
 
+// CIRCUITPY-CHANGE
+
+// The printer hands over a separator or a few characters at a time, so dump
+// gathers them in a small buffer to write to the stream in chunks.
+
+#define CIRCUITPY_JSON_WRITE_CHUNK_SIZE 128
+
+typedef struct _json_dump_buffer_t {
+    mp_obj_t stream_obj;
+    size_t len;
+    char buf[CIRCUITPY_JSON_WRITE_CHUNK_SIZE];
+} json_dump_buffer_t;
+
+static void json_dump_flush(json_dump_buffer_t *b) {
+    mp_stream_write(b->stream_obj, b->buf, b->len, MP_STREAM_RW_WRITE);
+    b->len = 0;
+}
+
+static void json_dump_strn(void *data, const char *str, size_t len) {
+    json_dump_buffer_t *b = data;
+    if (b->len + len > sizeof(b->buf)) {
+        json_dump_flush(b);
+        if (len >= sizeof(b->buf)) {
+            // Long strings go straight to the stream.
+            mp_stream_write(b->stream_obj, str, len, MP_STREAM_RW_WRITE);
+            return;
+        }
+    }
+    memcpy(b->buf + b->len, str, len);
+    b->len += len;
+}
+
+static void json_dump_to_stream(mp_print_t *print, mp_obj_t obj, mp_obj_t stream_obj) {
+    mp_get_stream_raise(stream_obj, MP_STREAM_OP_WRITE);
+    json_dump_buffer_t b;
+    b.stream_obj = stream_obj;
+    b.len = 0;
+    print->data = &b;
+    print->print_strn = json_dump_strn;
+    mp_obj_print_helper(print, obj, PRINT_JSON);
+    json_dump_flush(&b);
+}
+
 #if MICROPY_PY_JSON_SEPARATORS
 
 enum {
@@ -73,10 +118,8 @@ static mp_obj_t mod_json_dump_helper(size_t n_args, const mp_obj_t *pos_args, mp
         return mp_obj_new_str_from_utf8_vstr(&vstr);
     } else {
         // dump(obj, stream)
-        print_ext.base.data = MP_OBJ_TO_PTR(pos_args[1]);
-        print_ext.base.print_strn = mp_stream_write_adaptor;
-        mp_get_stream_raise(pos_args[1], MP_STREAM_OP_WRITE);
-        mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
+        // CIRCUITPY-CHANGE
+        json_dump_to_stream(&print_ext.base, pos_args[0], pos_args[1]);
         return mp_const_none;
     }
 }
@@ -94,9 +137,9 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_dumps_obj, 1, mod_json_dumps);
 #else
 
 static mp_obj_t mod_json_dump(mp_obj_t obj, mp_obj_t stream) {
-    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
+    // CIRCUITPY-CHANGE
+    mp_print_t print;
+    json_dump_to_stream(&print, obj, stream);
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mod_json_dump_obj, mod_json_dump);
@@ -190,49 +233,51 @@ static mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, i
     return 1;
 }
 
-static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
+static void json_stream_init(json_stream_t *s, mp_obj_t stream_obj, uint8_t *character_buffer) {
     const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
-    json_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
     if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = json_python_readinto;
+        s->start = 0;
+        s->end = 0;
+        mp_load_method(stream_obj, MP_QSTR_readinto, s->python_readinto);
+        s->bytearray_obj.base.type = &mp_type_bytearray;
+        s->bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s->bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+        s->bytearray_obj.free = 0;
+        s->bytearray_obj.items = character_buffer;
+        s->python_readinto[2] = MP_OBJ_FROM_PTR(&s->bytearray_obj);
+        s->stream_obj = s;
+        s->read = json_python_readinto;
     } else {
         stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+        s->stream_obj = stream_obj;
+        s->read = stream_p->read;
+        s->errcode = 0;
+        s->cur = 0;
     }
+}
 
-    JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
+static NORETURN void json_syntax_error(void) {
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+// Parses one complete value starting at the current character, leaving the
+// character after it current.
+static mp_obj_t json_parse_value(json_stream_t *s, vstr_t *vstr) {
     mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
     stack.len = 0;
     stack.items = NULL;
     mp_obj_t stack_top = MP_OBJ_NULL;
     const mp_obj_type_t *stack_top_type = NULL;
     mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
     for (;;) {
     cont:
-        if (S_END(s)) {
+        if (S_END(*s)) {
             break;
         }
         mp_obj_t next = MP_OBJ_NULL;
         bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -242,35 +287,35 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\r':
                 goto cont;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
                     next = mp_const_none;
                 } else {
                     goto fail;
                 }
                 break;
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_false;
                 } else {
                     goto fail;
                 }
                 break;
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_true;
                 } else {
                     goto fail;
                 }
                 break;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
+                vstr_reset(vstr);
+                for (; !S_END(*s) && S_CUR(*s) != '"';) {
+                    byte c = S_CUR(*s);
                     if (c == '\\') {
-                        c = S_NEXT(s);
+                        c = S_NEXT(*s);
                         switch (c) {
                             case 'b':
                                 c = 0x08;
@@ -290,26 +335,26 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                             case 'u': {
                                 mp_uint_t num = 0;
                                 for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
+                                    c = (S_NEXT(*s) | 0x20) - '0';
                                     if (c > 9) {
                                         c -= ('a' - ('9' + 1));
                                     }
                                     num = (num << 4) | c;
                                 }
-                                vstr_add_char(&vstr, num);
+                                vstr_add_char(vstr, num);
                                 goto str_cont;
                             }
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
-                if (S_END(s)) {
+                if (S_END(*s)) {
                     goto fail;
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
+                S_NEXT(*s);
+                next = mp_obj_new_str(vstr->buf, vstr->len);
                 break;
             case '-':
             case '0':
@@ -323,10 +368,10 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
@@ -334,12 +379,12 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
+                    next = mp_parse_num_float(vstr->buf, vstr->len, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    next = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
                 break;
             }
@@ -404,6 +449,26 @@ static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
         }
     }
 success:
+    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
+        // not exactly 1 object
+        goto fail;
+    }
+    return stack_top;
+
+fail:
+    json_syntax_error();
+}
+
+static mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
+    json_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    json_stream_init(&s, stream_obj, character_buffer);
+
+    JSON_DEBUG("got JSON stream\n");
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    S_NEXT(s);
+    mp_obj_t obj = json_parse_value(&s, &vstr);
     // CIRCUITPY-CHANGE
 
     // It is legal for a stream to have contents after JSON.
@@ -416,18 +481,11 @@ success:
         }
         if (!S_END(s)) {
             // unexpected chars
-            goto fail;
+            json_syntax_error();
         }
     }
-    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
-        // not exactly 1 object
-        goto fail;
-    }
     vstr_clear(&vstr);
-    return stack_top;
-
-fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    return obj;
 }
 
 // CIRCUITPY-CHANGE
@@ -446,12 +504,233 @@ static mp_obj_t mod_json_loads(mp_obj_t obj) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_JSON_ITERPARSE
+
+// iterparse walks the document without building it. Only the values whose
+// path is asked for are built, with the parser above, so memory use depends
+// on the size of the wanted values rather than the whole document.
+
+typedef struct _mp_obj_json_iterparse_t {
+    mp_obj_base_t base;
+    json_stream_t s;
+    vstr_t vstr;
+    // Tuple of the wanted paths, or MP_OBJ_NULL for every scalar.
+    mp_obj_t paths;
+    // Key or index of the value being parsed in each open container.
+    mp_obj_list_t *path;
+    // '[' for each open list. '{' for each open dict expecting a key, ':' after it.
+    vstr_t kinds;
+    byte state;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+} mp_obj_json_iterparse_t;
+
+enum {
+    JSON_ITERPARSE_START,
+    JSON_ITERPARSE_RUNNING,
+    JSON_ITERPARSE_DONE,
+};
+
+enum {
+    JSON_ITERPARSE_SKIP,
+    JSON_ITERPARSE_WANT,
+    JSON_ITERPARSE_DESCEND,
+};
+
+static int json_iterparse_match(mp_obj_json_iterparse_t *self, bool container) {
+    if (self->paths == MP_OBJ_NULL) {
+        return container ? JSON_ITERPARSE_DESCEND : JSON_ITERPARSE_WANT;
+    }
+    size_t depth = self->path->len;
+    size_t n_paths;
+    mp_obj_t *paths;
+    mp_obj_tuple_get(self->paths, &n_paths, &paths);
+    int result = JSON_ITERPARSE_SKIP;
+    for (size_t i = 0; i < n_paths; i++) {
+        size_t len;
+        mp_obj_t *keys;
+        mp_obj_tuple_get(paths[i], &len, &keys);
+        if (len < depth) {
+            continue;
+        }
+        size_t j = 0;
+        while (j < depth && (keys[j] == mp_const_none || mp_obj_equal(keys[j], self->path->items[j]))) {
+            j++;
+        }
+        if (j < depth) {
+            continue;
+        }
+        if (len == depth) {
+            return JSON_ITERPARSE_WANT;
+        }
+        if (container) {
+            result = JSON_ITERPARSE_DESCEND;
+        }
+    }
+    return result;
+}
+
+// Steps over a value without allocating. Only the brackets and strings in it
+// are checked.
+static void json_skip_value(json_stream_t *s) {
+    byte c = S_CUR(*s);
+    if (c != '"' && c != '[' && c != '{') {
+        while (!S_END(*s) && !unichar_isspace(c) && c != ',' && c != ':' && c != ']' && c != '}') {
+            c = S_NEXT(*s);
+        }
+        return;
+    }
+    size_t depth = 0;
+    do {
+        c = S_CUR(*s);
+        if (S_END(*s)) {
+            json_syntax_error();
+        }
+        if (c == '"') {
+            while (S_NEXT(*s) != '"') {
+                if (S_END(*s)) {
+                    json_syntax_error();
+                }
+                if (S_CUR(*s) == '\\') {
+                    S_NEXT(*s);
+                }
+            }
+        } else if (c == '[' || c == '{') {
+            depth++;
+        } else if (c == ']' || c == '}') {
+            depth--;
+        }
+        S_NEXT(*s);
+    } while (depth > 0);
+}
+
+static mp_obj_t json_iterparse_iternext(mp_obj_t self_in) {
+    mp_obj_json_iterparse_t *self = MP_OBJ_TO_PTR(self_in);
+    json_stream_t *s = &self->s;
+    mp_obj_list_t *path = self->path;
+    if (self->state == JSON_ITERPARSE_DONE) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    if (self->state == JSON_ITERPARSE_START) {
+        S_NEXT(*s);
+        self->state = JSON_ITERPARSE_RUNNING;
+    }
+    for (;;) {
+        byte c = S_CUR(*s);
+        if (S_END(*s)) {
+            json_syntax_error();
+        }
+        if (c == ',' || c == ':' || unichar_isspace(c)) {
+            S_NEXT(*s);
+            continue;
+        }
+        size_t depth = path->len;
+        if (c == ']' || c == '}') {
+            if (depth == 0) {
+                json_syntax_error();
+            }
+            S_NEXT(*s);
+            path->len--;
+            self->kinds.len--;
+            if (depth == 1) {
+                self->state = JSON_ITERPARSE_DONE;
+                return MP_OBJ_STOP_ITERATION;
+            }
+            continue;
+        }
+        if (depth > 0) {
+            char *kind = &self->kinds.buf[depth - 1];
+            if (*kind == '{') {
+                if (c != '"') {
+                    json_syntax_error();
+                }
+                path->items[depth - 1] = json_parse_value(s, &self->vstr);
+                *kind = ':';
+                continue;
+            }
+            if (*kind == '[') {
+                path->items[depth - 1] = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(path->items[depth - 1]) + 1);
+            } else {
+                *kind = '{';
+            }
+        }
+        bool container = c == '[' || c == '{';
+        switch (json_iterparse_match(self, container)) {
+            case JSON_ITERPARSE_WANT: {
+                mp_obj_t items[2] = { mp_obj_new_tuple(depth, path->items), json_parse_value(s, &self->vstr) };
+                if (depth == 0) {
+                    self->state = JSON_ITERPARSE_DONE;
+                }
+                return mp_obj_new_tuple(2, items);
+            }
+            case JSON_ITERPARSE_DESCEND:
+                S_NEXT(*s);
+                mp_obj_list_append(MP_OBJ_FROM_PTR(path), c == '[' ? MP_OBJ_NEW_SMALL_INT(-1) : mp_const_none);
+                vstr_add_byte(&self->kinds, c);
+                break;
+            default:
+                json_skip_value(s);
+                if (depth == 0) {
+                    self->state = JSON_ITERPARSE_DONE;
+                    return MP_OBJ_STOP_ITERATION;
+                }
+                break;
+        }
+    }
+}
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_json_iterparse,
+    MP_QSTR_iterparse,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, json_iterparse_iternext
+    );
+
+static mp_obj_t mod_json_iterparse(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_stream, ARG_paths };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_paths, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_json_iterparse_t *self = mp_obj_malloc(mp_obj_json_iterparse_t, &mp_type_json_iterparse);
+    self->paths = MP_OBJ_NULL;
+    if (args[ARG_paths].u_obj != mp_const_none) {
+        size_t n_paths;
+        mp_obj_t *paths;
+        mp_obj_get_array(args[ARG_paths].u_obj, &n_paths, &paths);
+        mp_obj_tuple_t *wanted = MP_OBJ_TO_PTR(mp_obj_new_tuple(n_paths, NULL));
+        for (size_t i = 0; i < n_paths; i++) {
+            size_t len;
+            mp_obj_t *keys;
+            mp_obj_get_array(paths[i], &len, &keys);
+            wanted->items[i] = mp_obj_new_tuple(len, keys);
+        }
+        self->paths = MP_OBJ_FROM_PTR(wanted);
+    }
+    json_stream_init(&self->s, args[ARG_stream].u_obj, self->character_buffer);
+    vstr_init(&self->vstr, 8);
+    vstr_init(&self->kinds, 8);
+    self->path = MP_OBJ_TO_PTR(mp_obj_new_list(0, NULL));
+    self->state = JSON_ITERPARSE_START;
+    return MP_OBJ_FROM_PTR(self);
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_iterparse_obj, 1, mod_json_iterparse);
+
+#endif
+
 static const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_json_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_json_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_json_loads_obj) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_JSON_ITERPARSE
+    { MP_ROM_QSTR(MP_QSTR_iterparse), MP_ROM_PTR(&mod_json_iterparse_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_json_globals, mp_module_json_globals_table);
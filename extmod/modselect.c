@@ -408,6 +408,13 @@ static mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
         if (mp_hal_is_interrupted()) {
             return 0;
         }
+        // CIRCUITPY-CHANGE: with nothing to poll this is only a sleep, such as asyncio.sleep(), so
+        // let mp_hal_delay_ms() idle for all of it.
+        if (has_timeout && poll_set->map.used == 0) {
+            mp_event_handle_nowait();
+            mp_hal_delay_ms(timeout - elapsed);
+            continue;
+        }
         // CIRCUITPY-CHANGE: mp_event_wait_ms() and mp_event_wait_indefinite() will do RUN_BACKGROUND_TASKS
         if (has_timeout) {
             mp_event_wait_ms(timeout - elapsed);
@@ -134,6 +134,54 @@ static mp_obj_t mp_vfs_proxy_call(mp_vfs_mount_t *vfs, qstr meth_name, size_t n_
     return mp_call_method_n_kw(n_args, 0, meth);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_VFS_IMPORT_STAT_CACHE && MICROPY_VFS_FAT
+// A FAT filesystem only changes through disk_write, so the result of a lookup stays
+// valid until the generation changes. Paths too long to keep aren't cached.
+typedef struct {
+    uint32_t generation;
+    const void *vfs;
+    uint8_t len;
+    uint8_t stat;
+    char path[MICROPY_VFS_IMPORT_STAT_CACHE_PATH_LEN];
+} import_stat_cache_entry_t;
+
+static import_stat_cache_entry_t import_stat_cache[MICROPY_VFS_IMPORT_STAT_CACHE_SIZE];
+// Starts at 1 so that the zeroed entries aren't valid.
+static uint32_t import_stat_cache_generation = 1;
+
+void mp_vfs_import_stat_cache_invalidate(void) {
+    import_stat_cache_generation++;
+}
+
+static mp_import_stat_t import_stat_cached(mp_obj_t vfs_obj, const mp_vfs_proto_t *proto, const char *path) {
+    // FNV-1a over the filesystem object and the path within it picks the entry.
+    uint32_t hash = 2166136261u ^ (uint32_t)(uintptr_t)vfs_obj;
+    size_t len = 0;
+    for (; path[len] != '\0'; len++) {
+        hash = (hash ^ (byte)path[len]) * 16777619u;
+    }
+    if (len > MICROPY_VFS_IMPORT_STAT_CACHE_PATH_LEN) {
+        return proto->import_stat(MP_OBJ_TO_PTR(vfs_obj), path);
+    }
+    import_stat_cache_entry_t *entry = &import_stat_cache[hash % MICROPY_VFS_IMPORT_STAT_CACHE_SIZE];
+    if (entry->generation == import_stat_cache_generation && entry->vfs == MP_OBJ_TO_PTR(vfs_obj)
+        && entry->len == len && memcmp(entry->path, path, len) == 0) {
+        return entry->stat;
+    }
+    mp_import_stat_t stat = proto->import_stat(MP_OBJ_TO_PTR(vfs_obj), path);
+    entry->generation = import_stat_cache_generation;
+    entry->vfs = MP_OBJ_TO_PTR(vfs_obj);
+    entry->len = len;
+    entry->stat = stat;
+    memcpy(entry->path, path, len);
+    return stat;
+}
+#elif MICROPY_VFS_IMPORT_STAT_CACHE
+void mp_vfs_import_stat_cache_invalidate(void) {
+}
+#endif
+
 mp_import_stat_t mp_vfs_import_stat(const char *path) {
     const char *path_out;
     mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path, &path_out);
@@ -145,6 +193,12 @@ mp_import_stat_t mp_vfs_import_stat(const char *path) {
     const mp_obj_type_t *type = mp_obj_get_type(vfs->obj);
     if (MP_OBJ_TYPE_HAS_SLOT(type, protocol)) {
         const mp_vfs_proto_t *proto = MP_OBJ_TYPE_GET_SLOT(type, protocol);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_VFS_IMPORT_STAT_CACHE && MICROPY_VFS_FAT
+        if (type == &mp_fat_vfs_type) {
+            return import_stat_cached(vfs->obj, proto, path_out);
+        }
+        #endif
         return proto->import_stat(MP_OBJ_TO_PTR(vfs->obj), path_out);
     }
 
@@ -258,6 +312,11 @@ mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args
         }
     }
 
+    // CIRCUITPY-CHANGE: the object may reuse the memory of one unmounted before
+    #if MICROPY_VFS_IMPORT_STAT_CACHE
+    mp_vfs_import_stat_cache_invalidate();
+    #endif
+
     // insert the vfs into the mount table
     mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
     while (*vfsp != NULL) {
@@ -306,9 +365,10 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_umount_obj, mp_vfs_umount);
 
-// Note: buffering and encoding args are currently ignored
+// Note: encoding arg is currently ignored
+// CIRCUITPY-CHANGE: buffering > 1 sets up a write buffer on FAT files
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_file, ARG_mode, ARG_encoding };
+    enum { ARG_file, ARG_mode, ARG_buffering, ARG_encoding };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_rom_obj = MP_ROM_NONE} },
         { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_r)} },
@@ -329,11 +389,22 @@ mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     #endif
 
     mp_vfs_mount_t *vfs = lookup_path(args[ARG_file].u_obj, &args[ARG_file].u_obj);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+    mp_obj_t file = mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t *)&args);
+    #if MICROPY_VFS_FAT
+    mp_int_t buffering = args[ARG_buffering].u_int;
+    if (buffering > 1 && (mp_obj_is_type(file, &mp_type_vfs_fat_fileio) || mp_obj_is_type(file, &mp_type_vfs_fat_textio))) {
+        fat_vfs_file_set_buffering(file, buffering);
+    }
+    #endif
+    return file;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mp_vfs_open_obj, 0, mp_vfs_open);
 
 mp_obj_t mp_vfs_chdir(mp_obj_t path_in) {
+    // CIRCUITPY-CHANGE: relative paths change meaning
+    #if MICROPY_VFS_IMPORT_STAT_CACHE
+    mp_vfs_import_stat_cache_invalidate();
+    #endif
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path_in, &path_out);
     if (vfs == MP_VFS_ROOT) {
@@ -76,6 +76,30 @@ void mp_vfs_blockdev_init(mp_vfs_blockdev_t *self, mp_obj_t bdev) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+static void blockdev_call_done(void *ctx) {
+    (void)ctx;
+    MP_STATE_VM(tier_up_blocked)--;
+}
+#endif
+
+// CIRCUITPY-CHANGE: The filesystem calling the block device is in the middle of
+// an operation, so functions can't be compiled to native code meanwhile because
+// that reads their source file.
+static mp_obj_t blockdev_call(size_t n_args, const mp_obj_t *args) {
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    nlr_jump_callback_node_t node;
+    MP_STATE_VM(tier_up_blocked)++;
+    nlr_push_jump_callback(&node, blockdev_call_done);
+    #endif
+    mp_obj_t ret = mp_call_method_n_kw(n_args, 0, args);
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    nlr_pop_jump_callback(true);
+    #endif
+    return ret;
+}
+
 // Helper function to minimise code size of read/write functions
 // note the n_args argument is moved to the end for further code size reduction (args keep same position in caller and callee).
 static int mp_vfs_blockdev_call_rw(mp_obj_t *args, size_t block_num, size_t block_off, size_t len, void *buf, size_t n_args) {
@@ -83,7 +107,7 @@ static int mp_vfs_blockdev_call_rw(mp_obj_t *args, size_t block_num, size_t bloc
     args[2] = MP_OBJ_NEW_SMALL_INT(block_num);
     args[3] = MP_OBJ_FROM_PTR(&ar);
     args[4] = MP_OBJ_NEW_SMALL_INT(block_off); // ignored for n_args == 2
-    mp_obj_t ret = mp_call_method_n_kw(n_args, 0, args);
+    mp_obj_t ret = blockdev_call(n_args, args);
 
     if (ret == mp_const_none) {
         return 0;
@@ -158,18 +182,18 @@ mp_obj_t mp_vfs_blockdev_ioctl(mp_vfs_blockdev_t *self, uintptr_t cmd, uintptr_t
         // New protocol with ioctl
         self->u.ioctl[2] = MP_OBJ_NEW_SMALL_INT(cmd);
         self->u.ioctl[3] = MP_OBJ_NEW_SMALL_INT(arg);
-        return mp_call_method_n_kw(2, 0, self->u.ioctl);
+        return blockdev_call(2, self->u.ioctl);
     } else {
         // Old protocol with sync and count
         switch (cmd) {
             case MP_BLOCKDEV_IOCTL_SYNC:
                 if (self->u.old.sync[0] != MP_OBJ_NULL) {
-                    mp_call_method_n_kw(0, 0, self->u.old.sync);
+                    blockdev_call(0, self->u.old.sync);
                 }
                 break;
 
             case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
-                return mp_call_method_n_kw(0, 0, self->u.old.count);
+                return blockdev_call(0, self->u.old.count);
 
             case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
                 // Old protocol has fixed sector size of 512 bytes
@@ -51,6 +51,13 @@ MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    // Optional write buffer set up by open(..., buffering=n). Writes collect here until they
+    // reach a sector boundary so FatFs writes whole, aligned sectors. NULL when unbuffered.
+    uint8_t *write_buf;
+    size_t write_buf_size;
+    size_t write_buf_len;
 } pyb_file_obj_t;
 
+void fat_vfs_file_set_buffering(mp_obj_t self_in, mp_int_t size);
+
 #endif  // MICROPY_INCLUDED_EXTMOD_VFS_FAT_H
@@ -83,6 +83,11 @@ DRESULT disk_write(
         return RES_PARERR;
     }
 
+    // CIRCUITPY-CHANGE: Covers all changes, including those over USB.
+    #if MICROPY_VFS_IMPORT_STAT_CACHE
+    mp_vfs_import_stat_cache_invalidate();
+    #endif
+
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
     if (ret == -MP_EROFS) {
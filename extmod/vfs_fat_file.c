@@ -38,6 +38,11 @@
 #include "extmod/vfs_fat.h"
 #include "supervisor/filesystem.h"
 
+// CIRCUITPY-CHANGE: ports that don't use circuitpy_mpconfig.h, like unix, get the same default.
+#ifndef CIRCUITPY_FATFS_FASTSEEK_MIN_CLUSTERS
+#define CIRCUITPY_FATFS_FASTSEEK_MIN_CLUSTERS (2)
+#endif
+
 // this table converts from FRESULT to POSIX errno
 const byte fresult_to_errno_table[20] = {
     [FR_OK] = 0,
@@ -68,8 +73,77 @@ static void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
     mp_printf(print, "<io.%q %p>", mp_obj_get_type_qstr(self_in), MP_OBJ_TO_PTR(self_in));
 }
 
+// CIRCUITPY-CHANGE: optional sector aligned write buffer
+static UINT file_sector_size(pyb_file_obj_t *self) {
+    #if FF_MAX_SS != FF_MIN_SS
+    return self->fp.obj.fs->ssize;
+    #else
+    return FF_MAX_SS;
+    #endif
+}
+
+// Returns 0 or an errno.
+static int file_flush_write_buf(pyb_file_obj_t *self) {
+    if (self->write_buf_len == 0) {
+        return 0;
+    }
+    UINT len = self->write_buf_len;
+    UINT sz_out;
+    self->write_buf_len = 0;
+    FRESULT res = f_write(&self->fp, self->write_buf, len, &sz_out);
+    if (res != FR_OK) {
+        return fresult_to_errno_table[res];
+    }
+    if (sz_out != len) {
+        return MP_ENOSPC;
+    }
+    return 0;
+}
+
+static mp_uint_t file_obj_write_buffered(pyb_file_obj_t *self, const byte *buf, mp_uint_t size, int *errcode) {
+    // The buffer starts at f_tell() so it's flushed when it reaches a sector boundary. Only
+    // the first flush after opening or seeking can be less than the whole buffer.
+    size_t capacity = self->write_buf_size - f_tell(&self->fp) % file_sector_size(self);
+    mp_uint_t remaining = size;
+    while (remaining > 0) {
+        size_t chunk = MIN(remaining, capacity - self->write_buf_len);
+        memcpy(self->write_buf + self->write_buf_len, buf, chunk);
+        self->write_buf_len += chunk;
+        buf += chunk;
+        remaining -= chunk;
+        if (self->write_buf_len == capacity) {
+            int err = file_flush_write_buf(self);
+            if (err != 0) {
+                *errcode = err;
+                return MP_STREAM_ERROR;
+            }
+            capacity = self->write_buf_size;
+        }
+    }
+    return size;
+}
+
+void fat_vfs_file_set_buffering(mp_obj_t self_in, mp_int_t size) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if ((self->fp.flag & FA_WRITE) == 0 || self->write_buf != NULL) {
+        return;
+    }
+    // Round down to whole sectors, but keep at least one.
+    UINT sector_size = file_sector_size(self);
+    size_t buf_size = MAX((size_t)size / sector_size, 1) * sector_size;
+    self->write_buf = m_new(uint8_t, buf_size);
+    self->write_buf_size = buf_size;
+    self->write_buf_len = 0;
+}
+
 static mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE: read back what has been written
+    int err = file_flush_write_buf(self);
+    if (err != 0) {
+        *errcode = err;
+        return MP_STREAM_ERROR;
+    }
     UINT sz_out;
     FRESULT res = f_read(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -81,6 +155,10 @@ static mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 static mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE
+    if (self->write_buf != NULL) {
+        return file_obj_write_buffered(self, buf, size, errcode);
+    }
     UINT sz_out;
     FRESULT res = f_write(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -98,6 +176,23 @@ static mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t siz
 static mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(o_in);
 
+    // CIRCUITPY-CHANGE: everything but tell() and poll sees the buffered writes on the file.
+    int err = 0;
+    if (request == MP_STREAM_SEEK) {
+        struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
+        if (s->whence == 1 && s->offset == 0) {
+            s->offset = f_tell(&self->fp) + self->write_buf_len;
+            return 0;
+        }
+    }
+    if (request != MP_STREAM_POLL) {
+        err = file_flush_write_buf(self);
+    }
+    if (err != 0 && request != MP_STREAM_CLOSE) {
+        *errcode = err;
+        return MP_STREAM_ERROR;
+    }
+
     if (request == MP_STREAM_SEEK) {
         struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
 
@@ -135,8 +230,32 @@ static mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
                 return MP_STREAM_ERROR;
             }
         }
+        // CIRCUITPY-CHANGE: free the fast seek map
+        if (self->fp.cltbl != NULL) {
+            // The first entry is the table's length.
+            m_del(DWORD, self->fp.cltbl, self->fp.cltbl[0]);
+            self->fp.cltbl = NULL;
+        }
+        // CIRCUITPY-CHANGE: free the write buffer
+        if (self->write_buf != NULL) {
+            m_del(uint8_t, self->write_buf, self->write_buf_size);
+            self->write_buf = NULL;
+        }
+        if (err != 0) {
+            // The file is closed but the last buffered writes were lost.
+            *errcode = err;
+            return MP_STREAM_ERROR;
+        }
         return 0;
 
+    // CIRCUITPY-CHANGE: support polling so files can be used with select and asyncio
+    } else if (request == MP_STREAM_POLL) {
+        // Like a regular file on POSIX, a FAT file never blocks waiting for data.
+        if (self->fp.obj.fs == NULL) {
+            return MP_STREAM_POLL_NVAL;
+        }
+        return arg & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+
     } else {
         *errcode = MP_EINVAL;
         return MP_STREAM_ERROR;
@@ -252,6 +371,9 @@ static mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
 
 
     pyb_file_obj_t *o = mp_obj_malloc_with_finaliser(pyb_file_obj_t, type);
+    o->write_buf = NULL;
+    o->write_buf_size = 0;
+    o->write_buf_len = 0;
 
     const char *fname = mp_obj_str_get_str(path_in);
     FRESULT res = f_open(&self->fatfs, &o->fp, fname, mode);
@@ -260,22 +382,35 @@ static mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
         mp_raise_OSError_errno_str(fresult_to_errno_table[res], path_in);
     }
     // CIRCUITPY-CHANGE: does fast seek.
-    // If we're reading, turn on fast seek.
-    if (mode == FA_READ) {
-        // One call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
+    // If we're reading, turn on fast seek for files long enough to need it. Most files are in
+    // only a few fragments, so build the map on the stack first and only walk the FAT chain a
+    // second time if that's too small.
+    #if FF_MAX_SS != FF_MIN_SS
+    FSIZE_t cluster_size = (FSIZE_t)self->fatfs.csize * self->fatfs.ssize;
+    #else
+    FSIZE_t cluster_size = (FSIZE_t)self->fatfs.csize * FF_MAX_SS;
+    #endif
+    if (mode == FA_READ && f_size(&o->fp) > (CIRCUITPY_FATFS_FASTSEEK_MIN_CLUSTERS - 1) * cluster_size) {
+        DWORD temp_table[32];
+        temp_table[0] = MP_ARRAY_SIZE(temp_table);
         o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-
-        // Now allocate the size and construct the map.
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD));
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
+        res = f_lseek(&o->fp, CREATE_LINKMAP);
+        o->fp.cltbl = NULL;
+        // Either way, this is now the size needed.
+        DWORD size = temp_table[0];
+        DWORD *table = NULL;
+        if (res == FR_OK || res == FR_NOT_ENOUGH_CORE) {
+            table = m_malloc_maybe(size * sizeof(DWORD));
+        }
+        if (table != NULL && res == FR_OK) {
+            memcpy(table, temp_table, size * sizeof(DWORD));
+            o->fp.cltbl = table;
+        } else if (table != NULL) {
+            table[0] = size;
+            o->fp.cltbl = table;
+            if (f_lseek(&o->fp, CREATE_LINKMAP) != FR_OK) {
                 o->fp.cltbl = NULL;
+                m_del(DWORD, table, size);
             }
         }
     }
@@ -152,6 +152,15 @@ static mp_uint_t MP_VFS_LFSx(file_write)(mp_obj_t self_in, const void *buf, mp_u
 static mp_uint_t MP_VFS_LFSx(file_ioctl)(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
     MP_OBJ_VFS_LFSx_FILE *self = MP_OBJ_TO_PTR(self_in);
 
+    // CIRCUITPY-CHANGE: support polling so files can be used with select and asyncio
+    if (request == MP_STREAM_POLL) {
+        // Like a regular file on POSIX, a littlefs file never blocks waiting for data.
+        if (self->vfs == NULL) {
+            return MP_STREAM_POLL_NVAL;
+        }
+        return arg & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR);
+    }
+
     if (request != MP_STREAM_CLOSE) {
         MP_VFS_LFSx(check_open)(self);
     }
@@ -29,6 +29,7 @@
 #include <stdlib.h>
 
 #include "py/runtime.h"
+#include "py/gc.h"
 #include "py/stream.h"
 #include "py/reader.h"
 #include "extmod/vfs.h"
@@ -76,6 +77,18 @@ static void mp_reader_vfs_close(void *data) {
     m_del_obj(mp_reader_vfs_t, reader);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_ROM
+// Files with the buffer protocol need not be streams, so close them however they allow.
+static void mp_reader_vfs_close_file(mp_obj_t file) {
+    mp_obj_t dest[2];
+    mp_load_method_maybe(file, MP_QSTR_close, dest);
+    if (dest[0] != MP_OBJ_NULL) {
+        mp_call_method_n_kw(0, 0, dest);
+    }
+}
+#endif
+
 void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
     mp_obj_t args[2] = {
         MP_OBJ_NEW_QSTR(filename),
@@ -83,6 +96,34 @@ void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
     };
     mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+    // A filesystem storing files contiguously in memory-mapped, read-only flash
+    // gives its files the buffer protocol. Code loaded from them then runs in place.
+    // A buffer on the heap may change or be collected once the file is closed, so it is copied.
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(file, &bufinfo, MP_BUFFER_READ)) {
+        const byte *buf = bufinfo.buf;
+        size_t free_len = MP_READER_IS_ROM;
+        if (gc_ptr_on_heap(bufinfo.buf)) {
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                byte *copy = m_new(byte, bufinfo.len);
+                memcpy(copy, bufinfo.buf, bufinfo.len);
+                buf = copy;
+                free_len = bufinfo.len;
+                nlr_pop();
+            } else {
+                mp_reader_vfs_close_file(file);
+                nlr_jump(nlr.ret_val);
+            }
+        }
+        mp_reader_vfs_close_file(file);
+        mp_reader_new_mem(reader, buf, bufinfo.len, free_len);
+        return;
+    }
+    #endif
+
     const mp_stream_p_t *stream_p = mp_get_stream(file);
     int errcode = 0;
     mp_uint_t bufsize = stream_p->ioctl(file, MP_STREAM_GET_BUFFER_SIZE, 0, &errcode);
@@ -99,6 +140,8 @@ void mp_reader_new_file(mp_reader_t *reader, qstr filename) {
     rf->bufsize = bufsize;
     rf->buflen = mp_stream_rw(rf->file, rf->buf, rf->bufsize, &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
+        // CIRCUITPY-CHANGE: don't leave the file open.
+        mp_stream_close(file);
         mp_raise_OSError(errcode);
     }
     rf->bufpos = 0;
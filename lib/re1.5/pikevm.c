@@ -0,0 +1,199 @@
+// Copyright 2007-2009 Russ Cox.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+// CIRCUITPY-CHANGE: Pike VM over the byte code, for matching in time linear
+// in the length of the subject.
+
+#include "re1.5.h"
+
+#ifndef re1_5_alloc
+#define re1_5_alloc(n) malloc(n)
+#define re1_5_free(p, n) free(p)
+#endif
+
+typedef struct ThreadList ThreadList;
+typedef struct PikeVM PikeVM;
+
+struct ThreadList
+{
+	int n;
+	char **pc;
+	const char **caps;	// n sets of nsubp
+};
+
+struct PikeVM
+{
+	char *insts;
+	Subject *input;
+	int nsubp;
+	unsigned *mark;	// gen when each pc was last added to a list
+	unsigned gen;
+};
+
+// Follows the jumps, splits and saves from pc, adding the threads that wait
+// on a character (or a Match) to l in priority order.
+static void
+addthread(PikeVM *vm, ThreadList *l, char *pc, const char *sp, const char **caps)
+{
+	const char *old;
+	int off;
+
+	re1_5_stack_chk();
+
+	for(;;) {
+		if(vm->mark[pc - vm->insts] == vm->gen)
+			return;
+		vm->mark[pc - vm->insts] = vm->gen;
+		switch(*pc) {
+		case Jmp:
+			off = (signed char)pc[1];
+			pc = pc + 2 + off;
+			continue;
+		case Split:
+			off = (signed char)pc[1];
+			addthread(vm, l, pc + 2, sp, caps);
+			pc = pc + 2 + off;
+			continue;
+		case RSplit:
+			off = (signed char)pc[1];
+			addthread(vm, l, pc + 2 + off, sp, caps);
+			pc = pc + 2;
+			continue;
+		case Save:
+			off = (unsigned char)pc[1];
+			if(off >= vm->nsubp) {
+				pc = pc + 2;
+				continue;
+			}
+			old = caps[off];
+			caps[off] = sp;
+			addthread(vm, l, pc + 2, sp, caps);
+			caps[off] = old;
+			return;
+		case Bol:
+			if(sp != vm->input->begin_line)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if(sp != vm->input->end)
+				return;
+			pc++;
+			continue;
+		default:
+			l->pc[l->n] = pc;
+			memcpy((char *)&l->caps[l->n * vm->nsubp], (char *)caps, vm->nsubp * sizeof(*caps));
+			l->n++;
+			return;
+		}
+	}
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
+{
+	PikeVM vm;
+	ThreadList clist, nlist, tmp;
+	char *start, *pc, *lit;
+	const char *sp, *next;
+	const char **caps;
+	int i, matched;
+
+	// Each pc is in a list at most once.
+	int max = prog->len;
+	size_t size = prog->bytelen * sizeof(unsigned) + 2 * max * (1 + nsubp) * sizeof(char *);
+	char *mem = re1_5_alloc(size);
+	vm.insts = prog->insts;
+	vm.input = input;
+	vm.nsubp = nsubp;
+	vm.mark = (unsigned *)mem;
+	memset(vm.mark, 0, prog->bytelen * sizeof(unsigned));
+	clist.pc = (char **)(vm.mark + prog->bytelen);
+	clist.caps = (const char **)(clist.pc + max);
+	nlist.pc = (char **)(clist.caps + max * nsubp);
+	nlist.caps = (const char **)(nlist.pc + max);
+	clist.n = 0;
+	vm.gen = 1;
+
+	// The search loop at the start of the code isn't run: new threads are
+	// started at each position here instead, behind the ones already going.
+	start = prog->insts + NON_ANCHORED_PREFIX;
+
+	// When the code has to start with a character, only start threads
+	// where it is, and skip straight to the next one when none are going.
+	lit = nil;
+	for(pc = start; *pc == Save; pc += 2)
+		;
+	if(*pc == Char)
+		lit = pc + 1;
+
+	matched = 0;
+	sp = input->begin;
+	for(;;) {
+		if(!matched && (!is_anchored || sp == input->begin)) {
+			if(clist.n == 0 && lit != nil && !is_anchored) {
+				next = memchr(sp, *lit, input->end - sp);
+				if(next == nil)
+					break;
+				if(next != sp) {
+					sp = next;
+					vm.gen++;
+				}
+			}
+			// subp doesn't hold a match yet, so all its entries are nil.
+			if(lit == nil || (sp < input->end && *sp == *lit))
+				addthread(&vm, &clist, start, sp, subp);
+		}
+		if(clist.n == 0)
+			break;
+
+		vm.gen++;
+		nlist.n = 0;
+		for(i = 0; i < clist.n; i++) {
+			pc = clist.pc[i];
+			caps = &clist.caps[i * nsubp];
+			if(*pc == Match) {
+				// Threads after this one have lower priority.
+				memcpy((char *)subp, (char *)caps, nsubp * sizeof(*caps));
+				matched = 1;
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(*pc) {
+			case Char:
+				if(*sp != pc[1])
+					continue;
+				pc += 2;
+				break;
+			case Any:
+				pc++;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(pc + 1, sp))
+					continue;
+				pc += *(unsigned char*)(pc + 1) * 2 + 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(pc + 1, sp))
+					continue;
+				pc += 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+			}
+			addthread(&vm, &nlist, pc, sp + 1, caps);
+		}
+		tmp = clist;
+		clist = nlist;
+		nlist = tmp;
+		if(sp >= input->end)
+			break;
+		sp++;
+	}
+
+	re1_5_free(mem, size);
+	return matched;
+}
@@ -27,6 +27,7 @@
 #include "mpconfigboard.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/board.h"
+#include "supervisor/shared/boot_trace.h"
 #include "supervisor/cpu.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
@@ -79,6 +80,18 @@
 #include "shared-bindings/epaperdisplay/EPaperDisplay.h"
 #endif
 
+#if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_AUDIO
+#include "shared-module/usb_audio/__init__.h"
+#endif
+
+#if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_MIDI
+#include "shared-module/usb_midi/__init__.h"
+#endif
+
+#if CIRCUITPY_PYUSB
+#include "shared-module/usb/core/__init__.h"
+#endif
+
 #if CIRCUITPY_KEYPAD
 #include "shared-module/keypad/__init__.h"
 #endif
@@ -87,6 +100,10 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
 #if CIRCUITPY_SOCKETPOOL
 #include "shared-bindings/socketpool/__init__.h"
 #endif
@@ -205,6 +222,10 @@ static void start_mp(safe_mode_t safe_mode) {
 
     mp_obj_list_init((mp_obj_list_t *)mp_sys_argv, 0);
 
+    #if CIRCUITPY_SAVES_LITTLEFS
+    filesystem_mount_saves();
+    #endif
+
     // Always return to root
     common_hal_os_chdir("/");
 }
@@ -368,6 +389,10 @@ static void cleanup_after_vm(mp_obj_t exception) {
     memorymonitor_reset();
     #endif
 
+    #if CIRCUITPY_PROFILER
+    profiler_reset();
+    #endif
+
     // Disable user related BLE state that uses the micropython heap.
     #if CIRCUITPY_BLEIO
     bleio_user_reset();
@@ -381,14 +406,28 @@ static void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_AUDIO
+    usb_audio_user_reset();
+    #endif
+
+    #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_MIDI
+    usb_midi_user_reset();
+    #endif
+
+    #if CIRCUITPY_PYUSB
+    usb_core_user_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
     #endif
 
-    // Turn off user initiated WiFi connections.
+    // Turn off user initiated WiFi connections, unless asked to keep them for the next run.
     #if CIRCUITPY_WIFI
-    wifi_user_reset();
+    if (!reload_keep_wifi()) {
+        wifi_user_reset();
+    }
     #endif
 
     // reset_board_buses() first because it may release pins from the never_reset state, so that
@@ -461,6 +500,8 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
         usb_setup_with_vm();
         #endif
 
+        boot_trace_record(BOOT_TRACE_CODE_PY_START);
+
         // Check if a different run file has been allocated
         if (next_code_configuration != NULL) {
             next_code_configuration->options &= ~SUPERVISOR_NEXT_CODE_OPT_NEWLY_SET;
@@ -547,6 +588,12 @@ static bool __attribute__((noinline)) run_code_py(safe_mode_t safe_mode, bool *s
         }
     }
 
+    // code.py is staying awake, so start anything held off for a fast wake.
+    #if CIRCUITPY_ALARM
+    if (!(_exec_result.return_code & PYEXEC_DEEP_SLEEP))
+    #endif
+    supervisor_workflow_start_deferred();
+
     // Program has finished running.
     bool printed_press_any_key = false;
     #if CIRCUITPY_EPAPERDISPLAY
@@ -994,6 +1041,7 @@ int __attribute__((used)) main(void) {
 
     // initialise the cpu and peripherals
     set_safe_mode(port_init());
+    boot_trace_record(BOOT_TRACE_PORT_INIT);
 
     port_heap_init();
 
@@ -1015,6 +1063,7 @@ int __attribute__((used)) main(void) {
     if (get_safe_mode() == SAFE_MODE_NONE) {
         set_safe_mode(wait_for_safe_mode_reset());
     }
+    boot_trace_record(BOOT_TRACE_SAFE_MODE_WAIT);
 
     stack_init();
 
@@ -1038,6 +1087,7 @@ int __attribute__((used)) main(void) {
     if (!filesystem_init(get_safe_mode() == SAFE_MODE_NONE, false)) {
         set_safe_mode(SAFE_MODE_NO_CIRCUITPY);
     }
+    boot_trace_record(BOOT_TRACE_FILESYSTEM_INIT);
 
     #if CIRCUITPY_BLEIO
     // Early init so that a reset press can cause BLE public advertising. Need the filesystem to
@@ -1066,6 +1116,7 @@ int __attribute__((used)) main(void) {
     #if CIRCUITPY_DISPLAYIO
     common_hal_displayio_auto_primary_display();
     #endif
+    boot_trace_record(BOOT_TRACE_BOARD_INIT);
 
     mp_hal_stdout_tx_str(line_clear);
 
@@ -1090,10 +1141,16 @@ int __attribute__((used)) main(void) {
     #endif
 
     run_boot_py(get_safe_mode());
+    boot_trace_record(BOOT_TRACE_BOOT_PY);
 
     supervisor_workflow_start();
+    boot_trace_record(BOOT_TRACE_WORKFLOW_START);
 
     #if CIRCUITPY_STATUS_BAR
+    #if CIRCUITPY_FAST_WAKE && CIRCUITPY_ALARM
+    // Nothing may be watching after a deep sleep wake. The status bar updates with code.py anyway.
+    if (!common_hal_alarm_woken_from_sleep())
+    #endif
     supervisor_status_bar_request_update(true);
     #endif
 
@@ -1172,6 +1229,10 @@ void gc_collect(void) {
     usb_hid_gc_collect();
     #endif
 
+    #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_AUDIO
+    usb_audio_gc_collect();
+    #endif
+
     #if CIRCUITPY_WIFI
     common_hal_wifi_gc_collect();
     #endif
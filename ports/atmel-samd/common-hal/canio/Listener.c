@@ -331,37 +331,68 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return self->hw->RXFS.bit.F0FL;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
+
+// Copy the oldest message out of the FIFO and hand its slot back to the hardware.
+static void read_message(canio_listener_obj_t *self, canio_message_record_t *record) {
     int index = self->hw->RXFS.bit.F0GI;
     canio_can_rx_fifo_t *hw_message = &self->fifo[index];
     bool rtr = hw_message->rxf0.bit.RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = hw_message->rxf0.bit.XTD;
-    if (message->extended) {
-        message->id = hw_message->rxf0.bit.ID;
+    bool extended = hw_message->rxf0.bit.XTD;
+    if (extended) {
+        record->id = hw_message->rxf0.bit.ID;
     } else {
-        message->id = hw_message->rxf0.bit.ID >> 18; // short ids are left-justified
+        record->id = hw_message->rxf0.bit.ID >> 18; // short ids are left-justified
     }
-    message->size = hw_message->rxf1.bit.DLC;
+    // Classic CAN codes a length of 8 as any DLC from 8 to 15.
+    record->size = MIN(hw_message->rxf1.bit.DLC, sizeof(record->data));
+    record->flags = (extended ? CANIO_MESSAGE_RECORD_EXTENDED : 0) | (rtr ? CANIO_MESSAGE_RECORD_RTR : 0);
+    record->reserved = 0;
+    memset(record->data, 0, sizeof(record->data));
     if (!rtr) {
-        memcpy(message->data, hw_message->data, message->size);
+        memcpy(record->data, hw_message->data, record->size);
     }
+    record->timestamp = supervisor_ticks_ms32();
     self->hw->RXFA.bit.F0AI = index;
-    return message;
+}
+
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_message_record_t record;
+    read_message(self, &record);
+    return canio_message_new_from_record(&record);
+}
+
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, void *records, size_t count) {
+    if (count == 0 || !wait_for_message(self)) {
+        return 0;
+    }
+    // Drain everything the FIFO already holds so a burst costs one call.
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        canio_message_record_t record;
+        read_message(self, &record);
+        memcpy((uint8_t *)records + n * sizeof(record), &record, sizeof(record));
+        n++;
+    }
+    return n;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
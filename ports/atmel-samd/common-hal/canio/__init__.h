@@ -10,7 +10,9 @@
 #include "component/can.h"
 
 #define COMMON_HAL_CANIO_MAX_MESSAGE_LENGTH (8)
-#define COMMON_HAL_CANIO_RX_FIFO_SIZE (3)
+// Each FIFO can hold up to 64 elements. A deeper FIFO rides out back-to-back frames on a busy
+// bus while Python code is busy elsewhere.
+#define COMMON_HAL_CANIO_RX_FIFO_SIZE (16)
 #define COMMON_HAL_CANIO_RX_FILTER_SIZE (4)
 #define COMMON_HAL_CANIO_TX_FIFO_SIZE (1)
 
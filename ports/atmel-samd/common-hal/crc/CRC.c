@@ -0,0 +1,43 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/crc/CRC.h"
+
+#include "sam.h"
+
+#ifdef SAM_D5X_E5X
+
+// Below this, starting the DSU costs more than the table.
+#define DSU_CRC_MIN_LEN (64)
+
+// The DSU computes the CRC-32 of Ethernet over whole words, keeping the register reflected
+// in DATA just as the table does.
+size_t common_hal_crc_crc_port_update(crc_crc_obj_t *self, const uint8_t *data, size_t len) {
+    if (self->width != 32 || self->poly != 0x04c11db7 || !self->reflect_in ||
+        ((uintptr_t)data & 3) != 0 || len < DSU_CRC_MIN_LEN) {
+        return 0;
+    }
+    size_t words = len / 4;
+    PAC->WRCTRL.reg = PAC_WRCTRL_PERID(ID_DSU) | PAC_WRCTRL_KEY_CLR;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR;
+    DSU->ADDR.reg = (uint32_t)data;
+    DSU->LENGTH.reg = DSU_LENGTH_LENGTH(words);
+    DSU->DATA.reg = self->reg;
+    DSU->CTRL.reg = DSU_CTRL_CRC;
+    while (!DSU->STATUSA.bit.DONE) {
+    }
+    bool bus_error = DSU->STATUSA.bit.BERR;
+    uint32_t reg = DSU->DATA.reg;
+    DSU->STATUSA.reg = DSU_STATUSA_DONE | DSU_STATUSA_BERR;
+    if (bus_error) {
+        // The DSU can't read everywhere, such as QSPI flash.
+        return 0;
+    }
+    self->reg = reg;
+    return words * 4;
+}
+
+#endif
@@ -132,6 +132,10 @@
 #define CIRCUITPY_DEFAULT_STACK_SIZE                (24 * 1024)
 #endif
 
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS      (4)
+#endif
+
 #ifndef SAMD5x_E5x_BOD33_LEVEL
 // Set brownout detection to ~2.7V. Default from factory is 1.7V,
 // which is too low for proper operation of external SPI flash chips
@@ -9,10 +9,17 @@
 #include "supervisor/port.h"
 #include "supervisor/shared/stack.h"
 
+#if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+#include "common-hal/socketpool/Socket.h"
+#endif
+
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
 void port_background_tick(void) {
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    socketpool_socket_background_tick();
+    #endif
     // Zero delay in case FreeRTOS wants to switch to something else.
     vTaskDelay(0);
 }
@@ -29,6 +29,15 @@ static void espnow_check_for_deinit(espnow_obj_t *self) {
     }
 }
 
+// Return the mac address of peer, or NULL to send to all registered peers if it is None.
+static const uint8_t *espnow_get_peer_mac(mp_obj_t peer_in) {
+    if (peer_in == mp_const_none) {
+        return NULL;
+    }
+    const espnow_peer_obj_t *peer = MP_OBJ_FROM_PTR(mp_arg_validate_type_or_none(peer_in, &espnow_peer_type, MP_QSTR_peer));
+    return peer->peer_info.peer_addr;
+}
+
 // --- Initialisation and Config functions ---
 
 //| class ESPNow:
@@ -128,16 +137,43 @@ static mp_obj_t espnow_send(size_t n_args, const mp_obj_t *pos_args, mp_map_t *k
     mp_buffer_info_t message;
     mp_get_buffer_raise(args[ARG_message].u_obj, &message, MP_BUFFER_READ);
 
-    const uint8_t *mac = NULL;
-    if (args[ARG_peer].u_obj != mp_const_none) {
-        const espnow_peer_obj_t *peer = MP_OBJ_FROM_PTR(mp_arg_validate_type_or_none(args[ARG_peer].u_obj, &espnow_peer_type, MP_QSTR_peer));
-        mac = peer->peer_info.peer_addr;
-    }
-
-    return common_hal_espnow_send(self, &message, mac);
+    return common_hal_espnow_send(self, &message, espnow_get_peer_mac(args[ARG_peer].u_obj));
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(espnow_send_obj, 2, espnow_send);
 
+//|     def send_many(
+//|         self,
+//|         messages: Iterable[ReadableBuffer],
+//|         peer: Optional[Peer] = None,
+//|     ) -> None:
+//|         """Send each message in ``messages`` to the peer's mac address, in order.
+//|
+//|         This is equivalent to calling `send` for each message but avoids a Python call per
+//|         message. Each message blocks as described in `send`.
+//|
+//|         :param Iterable[ReadableBuffer] messages: The messages to send (each length <= 250 bytes).
+//|         :param Peer peer: Send messages to this peer. If `None`, send to all registered peers.
+//|         """
+//|         ...
+//|
+static mp_obj_t espnow_send_many(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_messages, ARG_peer };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_messages, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_peer,     MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    espnow_obj_t *self = pos_args[0];
+    espnow_check_for_deinit(self);
+
+    common_hal_espnow_send_many(self, args[ARG_messages].u_obj, espnow_get_peer_mac(args[ARG_peer].u_obj));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(espnow_send_many_obj, 2, espnow_send_many);
+
 //|     def read(self) -> Optional[ESPNowPacket]:
 //|         """Read a packet from the receive buffer.
 //|
@@ -154,6 +190,33 @@ static mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def read_into_many(self, buffer: WriteableBuffer) -> int:
+//|         """Copy as many packets from the receive buffer as fit into ``buffer``.
+//|
+//|         This is non-blocking and does not allocate. Each packet is stored as a fixed size
+//|         record of `RECORD_SIZE` bytes laid out as ``struct.Struct("<6sbBI250s")``: the peer mac,
+//|         the RSSI, the message length, the receive timestamp in milliseconds and the
+//|         message itself.
+//|
+//|         :param WriteableBuffer buffer: Buffer to fill, usually a multiple of `RECORD_SIZE` bytes.
+//|         :returns: The number of packets copied."""
+//|         ...
+//|
+static mp_obj_t espnow_read_into_many(mp_obj_t self_in, mp_obj_t buffer_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espnow_read_into_many(self, bufinfo.buf, bufinfo.len));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(espnow_read_into_many_obj, espnow_read_into_many);
+
+//|     RECORD_SIZE: int
+//|     """The size in bytes of each packet record written by `read_into_many`."""
+//|
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -253,6 +316,38 @@ MP_PROPERTY_GETSET(espnow_phy_rate_obj,
 
 // --- Peer Related Properties ---
 
+//|     def peer_stats(self, peer: Peer) -> Optional[Tuple[int, int, int, int, int]]:
+//|         """Traffic statistics kept for the peer's mac address.
+//|
+//|         Statistics are kept for the first 20 mac addresses seen since ESP-NOW was initialized.
+//|
+//|         :returns: ``(rssi, send_success, send_failure, read_success, read_failure)`` where
+//|             ``rssi`` is from the most recent packet received and ``read_failure`` counts packets
+//|             dropped because the receive buffer was full, or `None` if nothing has been
+//|             exchanged with the peer."""
+//|         ...
+//|
+static mp_obj_t espnow_peer_stats(mp_obj_t self_in, mp_obj_t peer_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+    const espnow_peer_obj_t *peer = MP_OBJ_FROM_PTR(mp_arg_validate_type(peer_in, &espnow_peer_type, MP_QSTR_peer));
+
+    const espnow_peer_stats_t *stats = common_hal_espnow_get_peer_stats(self, peer->peer_info.peer_addr);
+    if (stats == NULL) {
+        return mp_const_none;
+    }
+
+    mp_obj_t elems[5] = {
+        MP_OBJ_NEW_SMALL_INT(stats->rssi),
+        mp_obj_new_int_from_uint(stats->send_success),
+        mp_obj_new_int_from_uint(stats->send_failure),
+        mp_obj_new_int_from_uint(stats->read_success),
+        mp_obj_new_int_from_uint(stats->read_failure),
+    };
+    return mp_obj_new_tuple(5, elems);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(espnow_peer_stats_obj, espnow_peer_stats);
+
 //|     peers: Peers
 //|     """The peer info records for all registered `ESPNow` peers. (read-only)"""
 //|
@@ -275,11 +370,14 @@ static const mp_rom_map_elem_t espnow_locals_dict_table[] = {
 
     // Send messages
     { MP_ROM_QSTR(MP_QSTR_send),         MP_ROM_PTR(&espnow_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send_many),    MP_ROM_PTR(&espnow_send_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_send_success), MP_ROM_PTR(&espnow_send_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_send_failure), MP_ROM_PTR(&espnow_send_failure_obj)},
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_into_many), MP_ROM_PTR(&espnow_read_into_many_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RECORD_SIZE),  MP_ROM_INT(ESPNOW_RECORD_SIZE) },
     { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure), MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -290,6 +388,7 @@ static const mp_rom_map_elem_t espnow_locals_dict_table[] = {
 
     // Peer related properties
     { MP_ROM_QSTR(MP_QSTR_peers),        MP_ROM_PTR(&espnow_peers_obj) },
+    { MP_ROM_QSTR(MP_QSTR_peer_stats),   MP_ROM_PTR(&espnow_peer_stats_obj) },
 };
 static MP_DEFINE_CONST_DICT(espnow_locals_dict, espnow_locals_dict_table);
 
@@ -0,0 +1,151 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "bindings/espulp/SampleBuffer.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+//| class SampleBuffer:
+//|     def __init__(self, *, offset: int, capacity: int, watermark: Optional[int] = None) -> None:
+//|         """A ring of samples in ULP memory that a ULP program fills and Python drains in
+//|         batches.
+//|
+//|         The ring is ``6 + capacity`` 32-bit words starting at ``offset``. The header words are
+//|         ``magic``, ``capacity``, ``watermark``, ``head``, ``tail`` and ``dropped``, followed by
+//|         the sample slots. Only the low 16 bits of each header word are used so that FSM programs
+//|         can work with it.
+//|
+//|         To add a sample the ULP program stores it at slot ``head`` and then advances ``head``,
+//|         wrapping at ``capacity``. It must not advance ``head`` onto ``tail``. When the ring is
+//|         full it increments ``dropped`` instead. When ``(head - tail) % capacity`` reaches
+//|         ``watermark`` it wakes the main CPU, which `ULPAlarm` reports. One wakeup then covers
+//|         a whole batch of samples instead of just one.
+//|
+//|         An existing ring with the same capacity at ``offset`` is kept, so samples taken while
+//|         the main CPU was in deep sleep are not lost.
+//|
+//|         :param int offset: Byte offset of the ring from the start of ULP memory. It must come
+//|             after the program and be a multiple of 4.
+//|         :param int capacity: Number of sample slots. The ring holds up to ``capacity - 1``
+//|             samples.
+//|         :param int watermark: Number of pending samples at which the ULP should wake the main
+//|             CPU. Defaults to half of ``capacity``."""
+//|         ...
+//|
+static mp_obj_t espulp_samplebuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_offset, ARG_capacity, ARG_watermark };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_offset, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_capacity, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_watermark, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t offset = mp_arg_validate_int_min(args[ARG_offset].u_int, 0, MP_QSTR_offset);
+    mp_int_t capacity = mp_arg_validate_int_range(args[ARG_capacity].u_int, 2, 0xffff, MP_QSTR_capacity);
+    mp_int_t watermark = capacity / 2;
+    if (args[ARG_watermark].u_obj != mp_const_none) {
+        watermark = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_watermark].u_obj), 1, capacity - 1, MP_QSTR_watermark);
+    }
+
+    espulp_samplebuffer_obj_t *self = mp_obj_malloc(espulp_samplebuffer_obj_t, &espulp_samplebuffer_type);
+    common_hal_espulp_samplebuffer_construct(self, offset, capacity, watermark);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def drain(self) -> memoryview:
+//|         """Take every pending sample out of the ring.
+//|
+//|         Returns a memoryview of unsigned 32-bit samples, oldest first. FSM programs store
+//|         their data in the low 16 bits. The memoryview is reused, so its contents are only
+//|         valid until the next call to `drain()`."""
+//|         ...
+//|
+static mp_obj_t espulp_samplebuffer_drain(mp_obj_t self_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t count = common_hal_espulp_samplebuffer_drain(self);
+    return mp_obj_new_memoryview('I', count, self->batch);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(espulp_samplebuffer_drain_obj, espulp_samplebuffer_drain);
+
+//|     capacity: int
+//|     """Number of sample slots in the ring. (read-only)"""
+//|
+static mp_obj_t espulp_samplebuffer_get_capacity(mp_obj_t self_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_samplebuffer_get_capacity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_samplebuffer_get_capacity_obj, espulp_samplebuffer_get_capacity);
+
+MP_PROPERTY_GETTER(espulp_samplebuffer_capacity_obj,
+    (mp_obj_t)&espulp_samplebuffer_get_capacity_obj);
+
+//|     watermark: int
+//|     """Number of pending samples at which the ULP program should wake the main CPU."""
+//|
+static mp_obj_t espulp_samplebuffer_get_watermark(mp_obj_t self_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_samplebuffer_get_watermark(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_samplebuffer_get_watermark_obj, espulp_samplebuffer_get_watermark);
+
+static mp_obj_t espulp_samplebuffer_set_watermark(mp_obj_t self_in, mp_obj_t watermark_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t watermark = mp_arg_validate_int_range(mp_obj_get_int(watermark_in), 1, self->capacity - 1, MP_QSTR_watermark);
+    common_hal_espulp_samplebuffer_set_watermark(self, watermark);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(espulp_samplebuffer_set_watermark_obj, espulp_samplebuffer_set_watermark);
+
+MP_PROPERTY_GETSET(espulp_samplebuffer_watermark_obj,
+    (mp_obj_t)&espulp_samplebuffer_get_watermark_obj,
+    (mp_obj_t)&espulp_samplebuffer_set_watermark_obj);
+
+//|     count: int
+//|     """Number of samples waiting to be drained. (read-only)"""
+//|
+static mp_obj_t espulp_samplebuffer_get_count(mp_obj_t self_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_samplebuffer_get_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_samplebuffer_get_count_obj, espulp_samplebuffer_get_count);
+
+MP_PROPERTY_GETTER(espulp_samplebuffer_count_obj,
+    (mp_obj_t)&espulp_samplebuffer_get_count_obj);
+
+//|     dropped: int
+//|     """Number of samples the ULP program could not store because the ring was full, as
+//|     counted by the program itself. (read-only)"""
+//|
+//|
+static mp_obj_t espulp_samplebuffer_get_dropped(mp_obj_t self_in) {
+    espulp_samplebuffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espulp_samplebuffer_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(espulp_samplebuffer_get_dropped_obj, espulp_samplebuffer_get_dropped);
+
+MP_PROPERTY_GETTER(espulp_samplebuffer_dropped_obj,
+    (mp_obj_t)&espulp_samplebuffer_get_dropped_obj);
+
+static const mp_rom_map_elem_t espulp_samplebuffer_locals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_drain),               MP_ROM_PTR(&espulp_samplebuffer_drain_obj) },
+    { MP_ROM_QSTR(MP_QSTR_capacity),            MP_ROM_PTR(&espulp_samplebuffer_capacity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_watermark),           MP_ROM_PTR(&espulp_samplebuffer_watermark_obj) },
+    { MP_ROM_QSTR(MP_QSTR_count),               MP_ROM_PTR(&espulp_samplebuffer_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dropped),             MP_ROM_PTR(&espulp_samplebuffer_dropped_obj) },
+};
+static MP_DEFINE_CONST_DICT(espulp_samplebuffer_locals_dict, espulp_samplebuffer_locals_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    espulp_samplebuffer_type,
+    MP_QSTR_SampleBuffer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, espulp_samplebuffer_make_new,
+    locals_dict, &espulp_samplebuffer_locals_dict
+    );
@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/espulp/SampleBuffer.h"
+
+extern const mp_obj_type_t espulp_samplebuffer_type;
+
+void common_hal_espulp_samplebuffer_construct(espulp_samplebuffer_obj_t *self, size_t offset, uint16_t capacity, uint16_t watermark);
+uint16_t common_hal_espulp_samplebuffer_get_capacity(espulp_samplebuffer_obj_t *self);
+uint16_t common_hal_espulp_samplebuffer_get_watermark(espulp_samplebuffer_obj_t *self);
+void common_hal_espulp_samplebuffer_set_watermark(espulp_samplebuffer_obj_t *self, uint16_t watermark);
+uint16_t common_hal_espulp_samplebuffer_get_count(espulp_samplebuffer_obj_t *self);
+uint16_t common_hal_espulp_samplebuffer_get_dropped(espulp_samplebuffer_obj_t *self);
+// Copy the pending samples into self->batch, free their slots and return how many there were.
+size_t common_hal_espulp_samplebuffer_drain(espulp_samplebuffer_obj_t *self);
@@ -9,6 +9,7 @@
 #include "bindings/espulp/__init__.h"
 #include "bindings/espulp/ULP.h"
 #include "bindings/espulp/ULPAlarm.h"
+#include "bindings/espulp/SampleBuffer.h"
 #include "bindings/espulp/Architecture.h"
 
 #include "py/runtime.h"
@@ -65,6 +66,7 @@ static const mp_rom_map_elem_t espulp_module_globals_table[] = {
     // module classes
     { MP_ROM_QSTR(MP_QSTR_ULP), MP_OBJ_FROM_PTR(&espulp_ulp_type) },
     { MP_ROM_QSTR(MP_QSTR_ULPAlarm), MP_OBJ_FROM_PTR(&espulp_ulpalarm_type) },
+    { MP_ROM_QSTR(MP_QSTR_SampleBuffer), MP_OBJ_FROM_PTR(&espulp_samplebuffer_type) },
     { MP_ROM_QSTR(MP_QSTR_Architecture), MP_ROM_PTR(&espulp_architecture_type) },
 };
 static MP_DEFINE_CONST_DICT(espulp_module_globals, espulp_module_globals_table);
@@ -26,13 +26,15 @@ void bleio_characteristic_buffer_extend(bleio_characteristic_buffer_obj_t *self,
         for (uint16_t i = 0; i < len; i++) {
             if (data[i] == mp_interrupt_char) {
                 mp_sched_keyboard_interrupt();
-                ringbuf_clear(&self->ringbuf);
+                ringbuf_request_clear(&self->ringbuf);
             } else {
-                ringbuf_put(&self->ringbuf, data[i]);
+                if (ringbuf_put(&self->ringbuf, data[i]) < 0) {
+                    self->overflow_count++;
+                }
             }
         }
     } else {
-        ringbuf_put_n(&self->ringbuf, data, len);
+        self->overflow_count += len - ringbuf_put_n(&self->ringbuf, data, len);
     }
 }
 
@@ -46,6 +48,7 @@ void _common_hal_bleio_characteristic_buffer_construct(bleio_characteristic_buff
     self->timeout_ms = timeout * 1000;
     self->watch_for_interrupt_char = watch_for_interrupt_char;
     ringbuf_init(&self->ringbuf, buffer, buffer_size);
+    self->overflow_count = 0;
     bleio_characteristic_set_observer(characteristic, self);
 }
 
@@ -82,6 +85,10 @@ uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(bleio_ch
     return ringbuf_num_filled(&self->ringbuf);
 }
 
+uint32_t common_hal_bleio_characteristic_buffer_get_overflow_count(bleio_characteristic_buffer_obj_t *self) {
+    return self->overflow_count;
+}
+
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(bleio_characteristic_buffer_obj_t *self) {
     ringbuf_clear(&self->ringbuf);
 }
@@ -17,6 +17,8 @@ typedef struct {
     uint32_t timeout_ms;
     // Ring buffer storing consecutive incoming values.
     ringbuf_t ringbuf;
+    // Incoming bytes dropped because ringbuf was full.
+    uint32_t overflow_count;
     bool watch_for_interrupt_char;
 } bleio_characteristic_buffer_obj_t;
 
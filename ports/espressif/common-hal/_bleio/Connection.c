@@ -178,6 +178,14 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     CHECK_NIMBLE_ERROR(ble_gap_update_params(self->conn_handle, &updated));
 }
 
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self) {
+    // These fail when the controller doesn't support them (the original ESP32 has no 2M PHY).
+    // The link then keeps its current settings.
+    ble_gap_set_prefered_le_phy(self->conn_handle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_CODED_ANY);
+    // 2120us is the time to send 251 bytes on the 1M PHY.
+    ble_gap_set_data_len(self->conn_handle, 251, 2120);
+}
+
 // Zero when discovery is in process. BLE_HS_EDONE or a BLE_HS_ error code when done.
 static volatile int _last_discovery_status;
 
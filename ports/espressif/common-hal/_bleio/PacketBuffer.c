@@ -343,6 +343,58 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, c
     return num_bytes_written;
 }
 
+mp_int_t common_hal_bleio_packet_buffer_send_packet(bleio_packet_buffer_obj_t *self, const uint8_t *data, size_t len) {
+    // NimBLE buffers notifications and writes without response itself, so each can be handed
+    // over as soon as there is an mbuf for it.
+    bool queued_by_nimble = self->client ?
+        self->write_type == CHAR_PROP_WRITE_NO_RESPONSE :
+        self->write_type == CHAR_PROP_NOTIFY;
+    if (self->outgoing[0] == NULL || !queued_by_nimble) {
+        return common_hal_bleio_packet_buffer_write(self, data, len, NULL, 0);
+    }
+    if (self->conn_handle == BLEIO_HANDLE_INVALID) {
+        return -1;
+    }
+    mp_int_t outgoing_packet_length = common_hal_bleio_packet_buffer_get_outgoing_packet_length(self);
+    if (outgoing_packet_length < 0) {
+        return -1;
+    }
+    if (len > (size_t)outgoing_packet_length) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Total data to write is larger than %q"), MP_QSTR_outgoing_packet_length);
+    }
+    if (len > self->max_packet_size) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Total data to write is larger than %q"), MP_QSTR_max_packet_size);
+    }
+
+    // Data from write() that hasn't been queued yet goes first.
+    while (self->pending_size != 0 &&
+           self->conn_handle != BLEIO_HANDLE_INVALID &&
+           !mp_hal_is_interrupted()) {
+        queue_next_write(self);
+        RUN_BACKGROUND_TASKS;
+    }
+
+    while (self->conn_handle != BLEIO_HANDLE_INVALID && !mp_hal_is_interrupted()) {
+        int err_code;
+        if (self->client) {
+            err_code = ble_gattc_write_no_rsp_flat(self->conn_handle, self->characteristic->handle, data, len);
+        } else {
+            // ble_gatts_notify_custom() consumes the mbuf, even on failure.
+            struct os_mbuf *om = ble_hs_mbuf_from_flat(data, len);
+            err_code = om == NULL ? BLE_HS_ENOMEM : ble_gatts_notify_custom(self->conn_handle, self->characteristic->handle, om);
+        }
+        if (err_code == NIMBLE_OK) {
+            return len;
+        }
+        if (err_code != BLE_HS_ENOMEM) {
+            CHECK_NIMBLE_ERROR(err_code);
+        }
+        // Out of mbufs. They are freed as queued packets are sent.
+        RUN_BACKGROUND_TASKS;
+    }
+    return -1;
+}
+
 mp_int_t common_hal_bleio_packet_buffer_get_incoming_packet_length(bleio_packet_buffer_obj_t *self) {
     // If this PacketBuffer is coming from a remote service via NOTIFY or INDICATE
     // the maximum size is what can be sent in one
@@ -0,0 +1,52 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/aesio/__init__.h"
+
+#include "soc/soc_caps.h"
+
+#if SOC_AES_SUPPORTED
+
+#include "aes/esp_aes.h"
+
+// The AES peripheral is shared with mbedtls, which takes its lock in each call.
+static bool port_crypt(aesio_aes_obj_t *self, int direction, uint8_t *buffer, size_t length) {
+    esp_aes_context aes;
+    esp_aes_init(&aes);
+    if (esp_aes_setkey(&aes, self->key, self->key_length * 8) != 0) {
+        esp_aes_free(&aes);
+        return false;
+    }
+    int result = 0;
+    switch (self->mode) {
+        case AES_MODE_ECB:
+            result = esp_aes_crypt_ecb(&aes, direction, buffer, buffer);
+            break;
+        case AES_MODE_CBC:
+            // Leaves the last cipher block in Iv for the next call.
+            result = esp_aes_crypt_cbc(&aes, direction, length, self->ctx.Iv, buffer, buffer);
+            break;
+        case AES_MODE_CTR: {
+            // Like the software version, each call starts on a fresh block.
+            size_t offset = 0;
+            uint8_t stream_block[AES_BLOCKLEN];
+            result = esp_aes_crypt_ctr(&aes, length, &offset, self->ctx.Iv, stream_block, buffer, buffer);
+            break;
+        }
+    }
+    esp_aes_free(&aes);
+    return result == 0;
+}
+
+bool common_hal_aesio_aes_port_encrypt(aesio_aes_obj_t *self, uint8_t *buffer, size_t length) {
+    return port_crypt(self, ESP_AES_ENCRYPT, buffer, length);
+}
+
+bool common_hal_aesio_aes_port_decrypt(aesio_aes_obj_t *self, uint8_t *buffer, size_t length) {
+    return port_crypt(self, ESP_AES_DECRYPT, buffer, length);
+}
+
+#endif
@@ -19,6 +19,13 @@
 
 #if CIRCUITPY_AUDIOBUSIO_PDMIN
 
+// The driver keeps receiving into its DMA buffers whether or not anything reads them, and the
+// hardware does the PDM decimation, so background capture only has to count dropped buffers.
+static bool pdmin_event_recv_q_ovf(i2s_chan_handle_t handle, i2s_event_data_t *event, void *self_in) {
+    audiobusio_pdmin_obj_t *self = self_in;
+    self->overruns++;
+    return false;
+}
 
 
 /**
@@ -63,6 +70,16 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
     err = i2s_channel_init_pdm_rx_mode(self->rx_chan, &pdm_rx_cfg);
     CHECK_ESP_RESULT(err);
 
+    self->capturing = false;
+    self->overruns = 0;
+    i2s_event_callbacks_t callbacks = {
+        .on_recv = NULL,
+        .on_recv_q_ovf = pdmin_event_recv_q_ovf,
+        .on_sent = NULL,
+        .on_send_q_ovf = NULL,
+    };
+    i2s_channel_register_event_callback(self->rx_chan, &callbacks, self);
+
     err = i2s_channel_enable(self->rx_chan);
     CHECK_ESP_RESULT(err);
 
@@ -118,6 +135,41 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
     return result;
 }
 
+void common_hal_audiobusio_pdmin_start_capture(audiobusio_pdmin_obj_t *self, uint32_t buffer_size) {
+    // The driver's DMA buffers already hold the capture so buffer_size isn't used. Throw away what
+    // arrived before the capture started.
+    uint8_t discard[64];
+    size_t result;
+    while (i2s_channel_read(self->rx_chan, discard, sizeof(discard), &result, 0) == ESP_OK && result > 0) {
+    }
+    self->overruns = 0;
+    self->capturing = true;
+}
+
+void common_hal_audiobusio_pdmin_stop_capture(audiobusio_pdmin_obj_t *self) {
+    self->capturing = false;
+}
+
+bool common_hal_audiobusio_pdmin_get_capturing(audiobusio_pdmin_obj_t *self) {
+    return self->capturing;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return self->overruns;
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *buffer,
+    uint32_t length) {
+    size_t result = 0;
+    size_t elementSize = common_hal_audiobusio_pdmin_get_bit_depth(self) / 8;
+    esp_err_t err = i2s_channel_read(self->rx_chan, buffer, length * elementSize, &result, 0);
+    if (err != ESP_ERR_TIMEOUT) {
+        CHECK_ESP_RESULT(err);
+    }
+    return result / elementSize;
+}
+
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t *self) {
     return self->bit_depth;
 }
@@ -20,6 +20,8 @@ typedef struct {
     const mcu_pin_obj_t *data_pin;
     uint32_t sample_rate;
     uint8_t bit_depth;
+    bool capturing;
+    volatile uint32_t overruns;
 } audiobusio_pdmin_obj_t;
 
 #endif
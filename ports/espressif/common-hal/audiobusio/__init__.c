@@ -12,31 +12,27 @@
 #include "bindings/espidf/__init__.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "components/esp_timer/include/esp_timer.h"
 
 #include "shared-module/audiocore/__init__.h"
 
 // The maximum DMA buffer size (in bytes)
 #define I2S_DMA_BUFFER_MAX_SIZE     4092
-// The number of DMA buffers to allocate
-#define CIRCUITPY_BUFFER_COUNT (3)
+// The number of DMA buffers to allocate. The descriptors form a ring that the peripheral runs
+// through on its own, so a longer chain rides out longer stalls in the background task.
+#define CIRCUITPY_BUFFER_COUNT (CIRCUITPY_I2S_BUFFER_COUNT)
 // The maximum DMA buffer size in frames (at stereo 16-bit)
 #define CIRCUITPY_BUFFER_SIZE (I2S_DMA_BUFFER_MAX_SIZE / 4)
 // The number of output channels is fixed at 2
 #define CIRCUITPY_OUTPUT_SLOTS (2)
 
-static void i2s_fill_buffer(i2s_t *self) {
-    if (self->next_buffer_size == 0) {
-        // Error, no new buffer queued.
-        return;
-    }
-    int16_t *output_buffer = (int16_t *)self->next_buffer;
-    size_t output_buffer_size = self->next_buffer_size;
+static void i2s_fill_buffer(i2s_t *self, void *buffer, size_t buffer_size) {
+    int16_t *output_buffer = (int16_t *)buffer;
+    size_t output_buffer_size = buffer_size;
     const size_t bytes_per_output_frame = 4;
     size_t bytes_per_input_frame = self->channel_count * self->bytes_per_sample;
     if (!self->playing || self->paused || !self->sample || self->stopping) {
-        memset(output_buffer, 0, self->next_buffer_size);
-        self->next_buffer = NULL;
-        self->next_buffer_size = 0;
+        memset(output_buffer, 0, buffer_size);
         return;
     }
     while (!self->stopping && output_buffer_size > 0) {
@@ -96,21 +92,49 @@ static void i2s_fill_buffer(i2s_t *self) {
         output_buffer += framecount * CIRCUITPY_OUTPUT_SLOTS;
         output_buffer_size -= framecount * bytes_per_output_frame;
     }
-    self->next_buffer = NULL;
-    self->next_buffer_size = 0;
 }
 
+#if CIRCUITPY_AUDIOCORE_STATS
+uint32_t audiocore_stats_now_us(void) {
+    return esp_timer_get_time();
+}
+#endif
+
+// pending_read and pending_write count modulo twice the buffer count, so a full queue and an
+// empty one can be told apart.
+#define PENDING_WRAP (2 * CIRCUITPY_I2S_BUFFER_COUNT)
+
+// Refills every buffer the peripheral has finished with since the last callback.
 static void i2s_callback_fun(void *self_in) {
     i2s_t *self = self_in;
-    i2s_fill_buffer(self);
+    #if CIRCUITPY_AUDIOCORE_STATS
+    audiocore_stats_record_callback(self->interrupt_us);
+    #endif
+    while (self->pending_read != self->pending_write) {
+        uint8_t index = self->pending_read % CIRCUITPY_I2S_BUFFER_COUNT;
+        i2s_fill_buffer(self, self->pending[index], self->pending_size);
+        self->pending_read = (self->pending_read + 1) % PENDING_WRAP;
+    }
 }
 
 static bool i2s_event_interrupt(i2s_chan_handle_t handle, i2s_event_data_t *event, void *self_in) {
     i2s_t *self = self_in;
-    self->underrun = self->underrun || self->next_buffer != NULL;
-    self->next_buffer = *(int16_t **)event->data;
-    self->next_buffer_size = event->size;
-    background_callback_add(&self->callback, i2s_callback_fun, self_in);
+    if ((self->pending_write - self->pending_read + PENDING_WRAP) % PENDING_WRAP == CIRCUITPY_I2S_BUFFER_COUNT) {
+        // Every buffer is waiting, including this one, so it was played again unfilled. The
+        // driver clears sent buffers, so that was silence rather than stale audio.
+        audiocore_stats_record_underrun();
+        self->underrun = true;
+        return false;
+    }
+    #if CIRCUITPY_AUDIOCORE_STATS
+    if (self->pending_write == self->pending_read) {
+        self->interrupt_us = audiocore_stats_now_us();
+    }
+    #endif
+    self->pending[self->pending_write % CIRCUITPY_I2S_BUFFER_COUNT] = *(void **)event->data;
+    self->pending_size = event->size;
+    self->pending_write = (self->pending_write + 1) % PENDING_WRAP;
+    background_callback_add_with_priority(&self->callback, i2s_callback_fun, self_in, BACKGROUND_CALLBACK_PRIORITY_HIGH);
     return false;
 }
 
@@ -120,6 +144,8 @@ void port_i2s_allocate_init(i2s_t *self, bool left_justified) {
         .role = I2S_ROLE_MASTER,
         .dma_desc_num = CIRCUITPY_BUFFER_COUNT,
         .dma_frame_num = CIRCUITPY_BUFFER_SIZE, // in _frames_, so 1023 is 4092 bytes per dma buf which is the maximum
+        // Play silence from a buffer that comes around again before it is refilled.
+        .auto_clear = true,
     };
     esp_err_t err = i2s_new_channel(&chan_config, &self->handle, NULL);
     if (err == ESP_ERR_NOT_FOUND) {
@@ -159,6 +185,8 @@ void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
         &max_buffer_length, &spacing);
     self->samples_signed = samples_signed;
     self->sample_data = self->sample_end = NULL;
+    // The channel is disabled, so nothing is sent until the preload below refills the ring.
+    self->pending_read = self->pending_write = 0;
     // We always output stereo so output twice as many bits.
     // uint16_t bits_per_sample_output = bits_per_sample * 2;
 
@@ -180,9 +208,7 @@ void port_i2s_play(i2s_t *self, mp_obj_t sample, bool loop) {
     size_t bytes_loaded = 4;
     size_t preloaded = 0;
     while (bytes_loaded > 0 && preloaded < CIRCUITPY_BUFFER_SIZE * CIRCUITPY_BUFFER_COUNT) {
-        self->next_buffer = &starting_frame;
-        self->next_buffer_size = sizeof(starting_frame);
-        i2s_fill_buffer(self);
+        i2s_fill_buffer(self, &starting_frame, sizeof(starting_frame));
         i2s_channel_preload_data(self->handle, &starting_frame, sizeof(uint32_t), &bytes_loaded);
         preloaded += bytes_loaded;
     }
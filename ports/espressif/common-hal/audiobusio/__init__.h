@@ -12,6 +12,11 @@
 
 #include "driver/i2s_std.h"
 
+// The number of DMA buffers in the ring the peripheral plays from.
+#ifndef CIRCUITPY_I2S_BUFFER_COUNT
+#define CIRCUITPY_I2S_BUFFER_COUNT (6)
+#endif
+
 typedef struct {
     mp_obj_t *sample;
     bool left_justified;
@@ -24,10 +29,16 @@ typedef struct {
     int8_t channel_count;
     uint16_t buffer_length;
     uint8_t *sample_data, *sample_end;
-    void *next_buffer;
-    size_t next_buffer_size;
+    // Sent DMA buffers waiting to be refilled, queued by the ISR and drained in the background.
+    void *pending[CIRCUITPY_I2S_BUFFER_COUNT];
+    size_t pending_size;
+    volatile uint8_t pending_write;
+    volatile uint8_t pending_read;
     i2s_chan_handle_t handle;
     background_callback_t callback;
+    #if CIRCUITPY_AUDIOCORE_STATS
+    uint32_t interrupt_us;
+    #endif
     bool underrun;
 } i2s_t;
 
@@ -24,53 +24,56 @@
 #define TWAI TWAI0
 #endif
 
-// IDE = "extended ID" flag of packet header.  We always add this bit to the
-// mask because a match is always for just one kind of address length
-#define FILTER16_IDE (1 << 3)
-#define FILTER32_IDE (1 << 2)
-
-static void install_standard_filter(canio_listener_obj_t *self, canio_match_obj_t *match) {
-    twai_ll_set_acc_filter(&TWAI, match->id << 21, ~(match->mask << 21), true);
-    self->extended = false;
-    self->standard = true;
+// In single filter mode the acceptance code is compared against the start of the frame: a
+// standard id occupies bits 31..21 and an extended id bits 31..3. The IDE bit is not compared, so
+// the kind of id is always checked in software.
+static uint32_t filter_code(const canio_listener_match_t *match) {
+    return match->extended ? match->id << 3 : match->id << 21;
 }
 
-static void install_extended_filter(canio_listener_obj_t *self, canio_match_obj_t *match) {
-    twai_ll_set_acc_filter(&TWAI, match->id << 3, ~(match->mask << 3), true);
-    self->extended = true;
-    self->standard = false;
-}
-
-static void install_all_match_filter(canio_listener_obj_t *self) {
-    twai_ll_set_acc_filter(&TWAI, 0u, ~0u, true);
-    self->extended = true;
-    self->standard = true;
+static uint32_t filter_care(const canio_listener_match_t *match) {
+    return match->extended ? match->mask << 3 : match->mask << 21;
 }
 
+// Program the tightest single filter that passes every match: only bits that every match
+// compares, and that agree across all of them, are left for the hardware to check.
 __attribute__((noinline, optimize("O0")))
-static void set_filters(canio_listener_obj_t *self, size_t nmatch, canio_match_obj_t **matches) {
-    twai_ll_enter_reset_mode(&TWAI);
-
-    if (!nmatch) {
-        install_all_match_filter(self);
-    } else {
-        canio_match_obj_t *match = matches[0];
-        if (match->extended) {
-            install_extended_filter(self, match);
-        } else {
-            install_standard_filter(self, match);
+static void set_filters(canio_listener_obj_t *self) {
+    uint32_t code = 0;
+    uint32_t care = 0;
+    if (self->nmatch) {
+        code = filter_code(&self->matches[0]);
+        care = filter_care(&self->matches[0]);
+        for (size_t i = 1; i < self->nmatch; i++) {
+            care &= filter_care(&self->matches[i]) & ~(code ^ filter_code(&self->matches[i]));
         }
+        code &= care;
     }
 
+    twai_ll_enter_reset_mode(&TWAI);
+    // Set mask bits are "don't care".
+    twai_ll_set_acc_filter(&TWAI, code, ~care, true);
     twai_ll_exit_reset_mode(&TWAI);
 }
 
+static bool message_matches(canio_listener_obj_t *self, const twai_message_t *message) {
+    if (!self->nmatch) {
+        return true;
+    }
+    for (size_t i = 0; i < self->nmatch; i++) {
+        const canio_listener_match_t *match = &self->matches[i];
+        if (match->extended == (bool)message->extd && ((message->identifier ^ match->id) & match->mask) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout) {
     if (can->fifo_in_use) {
         mp_raise_ValueError(MP_ERROR_TEXT("All RX FIFOs in use"));
     }
-    if (nmatch > 1) {
+    if (nmatch > COMMON_HAL_CANIO_MAX_MATCHES) {
         mp_raise_ValueError(MP_ERROR_TEXT("Filters too complex"));
     }
 
@@ -79,8 +82,13 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
     self->can = can;
     self->pending = false;
 
-    set_filters(self, nmatch, matches);
-    self->extended = self->standard = true;
+    self->nmatch = nmatch;
+    for (size_t i = 0; i < nmatch; i++) {
+        self->matches[i].id = matches[i]->id;
+        self->matches[i].mask = matches[i]->mask;
+        self->matches[i].extended = matches[i]->extended;
+    }
+    set_filters(self);
 
     common_hal_canio_listener_set_timeout(self, timeout);
 }
@@ -104,48 +112,68 @@ void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self) {
 // and then we can say that we have 1 message pending
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     while (!self->pending && twai_receive(&self->message_in, 0) == ESP_OK) {
-        if (self->message_in.extd && self->extended) {
-            self->pending = true;
-        }
-        if (!self->message_in.extd && self->standard) {
-            self->pending = true;
-        }
+        self->pending = message_matches(self, &self->message_in);
     }
     return self->pending;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+static void read_message(canio_listener_obj_t *self, canio_message_record_t *record) {
     bool rtr = self->message_in.rtr;
-
-    int dlc = self->message_in.data_length_code;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = self->message_in.extd;
-    message->id = self->message_in.identifier;
-    message->size = dlc;
-
-    if (!rtr) {
-        MP_STATIC_ASSERT(sizeof(self->message_in.data) == sizeof(message->data));
-        memcpy(message->data, self->message_in.data, sizeof(message->data));
+    bool extended = self->message_in.extd;
+    record->id = self->message_in.identifier;
+    // Classic CAN codes a length of 8 as any DLC from 8 to 15.
+    record->size = MIN(self->message_in.data_length_code, sizeof(record->data));
+    record->flags = (extended ? CANIO_MESSAGE_RECORD_EXTENDED : 0) | (rtr ? CANIO_MESSAGE_RECORD_RTR : 0);
+    record->reserved = 0;
+    if (rtr) {
+        memset(record->data, 0, sizeof(record->data));
+    } else {
+        MP_STATIC_ASSERT(sizeof(self->message_in.data) == sizeof(record->data));
+        memcpy(record->data, self->message_in.data, sizeof(record->data));
     }
-
+    record->timestamp = supervisor_ticks_ms32();
     self->pending = false;
+}
 
-    return message;
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_message_record_t record;
+    read_message(self, &record);
+    return canio_message_new_from_record(&record);
+}
+
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, void *records, size_t count) {
+    if (count == 0 || !wait_for_message(self)) {
+        return 0;
+    }
+    // Drain the driver's queue without waiting again.
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        canio_message_record_t record;
+        read_message(self, &record);
+        memcpy((uint8_t *)records + n * sizeof(record), &record, sizeof(record));
+        n++;
+    }
+    return n;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -9,11 +9,17 @@
 #include "common-hal/canio/CAN.h"
 #include "shared-module/canio/Match.h"
 
+typedef struct {
+    uint32_t id;
+    uint32_t mask;
+    bool extended;
+} canio_listener_match_t;
+
 typedef struct canio_listener_obj {
     mp_obj_base_t base;
     canio_can_obj_t *can;
-    bool extended : 1;
-    bool standard : 1;
+    canio_listener_match_t matches[COMMON_HAL_CANIO_MAX_MATCHES];
+    uint8_t nmatch;
     bool pending : 1;
     twai_message_t message_in;
     uint32_t timeout_ms;
@@ -5,3 +5,11 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+// Messages buffered by the TWAI driver's receive interrupt. The driver default of 5 overflows
+// within a few hundred microseconds on a saturated 1Mbit/s bus.
+#define COMMON_HAL_CANIO_RX_QUEUE_LEN (64)
+
+// Matches a single listener accepts. The hardware has one acceptance filter, so matches beyond
+// what it can express exactly are checked again in software.
+#define COMMON_HAL_CANIO_MAX_MATCHES (8)
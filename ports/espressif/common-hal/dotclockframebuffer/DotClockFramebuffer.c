@@ -207,6 +207,13 @@ void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_fram
     Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf), self->bufinfo.len);
 }
 
+void common_hal_dotclockframebuffer_framebuffer_refresh_area(dotclockframebuffer_framebuffer_obj_t *self, int x1, int y1, int x2, int y2) {
+    // Write back the span of the buffer from the first to the last changed pixel.
+    uint32_t start = self->first_pixel_offset + y1 * self->row_stride + x1 * 2;
+    uint32_t end = self->first_pixel_offset + (y2 - 1) * self->row_stride + x2 * 2;
+    Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf) + start, end - start);
+}
+
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockframebuffer_framebuffer_obj_t *self) {
     return self->refresh_rate;
 }
@@ -0,0 +1,55 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-bindings/dualbank/Update.h"
+
+#include "esp_ota_ops.h"
+
+void common_hal_dualbank_update_construct(dualbank_update_obj_t *self, size_t image_size) {
+    // A known size lets the whole image be erased up front so every write only has to program.
+    // Otherwise each sector is erased when the image first reaches it.
+    self->image_size = image_size ? image_size : OTA_WITH_SEQUENTIAL_WRITES;
+    self->written = 0;
+    mbedtls_sha256_init(&self->sha256);
+    mbedtls_sha256_starts(&self->sha256, 0);
+}
+
+void common_hal_dualbank_update_write(dualbank_update_obj_t *self, const uint8_t *buf, size_t len) {
+    // The hardware SHA engine hashes each chunk before it goes to flash.
+    mbedtls_sha256_update(&self->sha256, buf, len);
+
+    if (self->written < DUALBANK_HEADER_LEN) {
+        size_t count = MIN(len, DUALBANK_HEADER_LEN - self->written);
+        memcpy(self->header + self->written, buf, count);
+        self->written += count;
+        buf += count;
+        len -= count;
+        if (self->written < DUALBANK_HEADER_LEN) {
+            return;
+        }
+        dualbank_start_update(self->header, DUALBANK_HEADER_LEN, self->image_size);
+        dualbank_write(self->header, DUALBANK_HEADER_LEN);
+    }
+    if (len > 0) {
+        dualbank_write(buf, len);
+        self->written += len;
+    }
+}
+
+size_t common_hal_dualbank_update_get_bytes_written(dualbank_update_obj_t *self) {
+    return self->written;
+}
+
+void common_hal_dualbank_update_get_sha256(dualbank_update_obj_t *self, uint8_t digest[32]) {
+    // Finish a copy so that more can still be written.
+    mbedtls_sha256_context copy;
+    mbedtls_sha256_init(&copy);
+    mbedtls_sha256_clone(&copy, &self->sha256);
+    mbedtls_sha256_finish(&copy, digest);
+    mbedtls_sha256_free(&copy);
+}
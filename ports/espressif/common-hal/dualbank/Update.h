@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "mbedtls/sha256.h"
+
+#include "common-hal/dualbank/__init__.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    mbedtls_sha256_context sha256;
+    size_t image_size;
+    size_t written;
+    // Holds the start of the image until the version in it can be checked.
+    uint8_t header[DUALBANK_HEADER_LEN];
+} dualbank_update_obj_t;
@@ -30,7 +30,7 @@ static void __attribute__((noreturn)) task_fatal_error(void) {
     mp_raise_RuntimeError(MP_ERROR_TEXT("Update failed"));
 }
 
-void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset) {
+void dualbank_start_update(const void *buf, const size_t len, const size_t image_size) {
     esp_err_t err;
 
     const esp_partition_t *running = esp_ota_get_running_partition();
@@ -48,7 +48,7 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
     }
 
     if (update_handle == 0) {
-        if (len > sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
+        if (len >= DUALBANK_HEADER_LEN) {
             esp_app_desc_t new_app_info;
             memcpy(&new_app_info, &((char *)buf)[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
             ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
@@ -77,7 +77,7 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
                 }
             }
 
-            err = esp_ota_begin(update_partition, OTA_SIZE_UNKNOWN, &update_handle);
+            err = esp_ota_begin(update_partition, image_size, &update_handle);
             if (err != ESP_OK) {
                 ESP_LOGE(TAG, "esp_ota_begin failed (%s)", esp_err_to_name(err));
                 task_fatal_error();
@@ -87,6 +87,20 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
             mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is too big"));
         }
     }
+}
+
+void dualbank_write(const void *buf, const size_t len) {
+    esp_err_t err = esp_ota_write(update_handle, buf, len);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_ota_write failed (%s)", esp_err_to_name(err));
+        task_fatal_error();
+    }
+}
+
+void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset) {
+    esp_err_t err;
+
+    dualbank_start_update(buf, len, OTA_SIZE_UNKNOWN);
 
     if (offset == 0) {
         err = esp_ota_write(update_handle, buf, len);
@@ -6,4 +6,17 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include "esp_app_format.h"
+
+// The start of an image that has to be seen before an update can begin.
+#define DUALBANK_HEADER_LEN (sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t))
+
 extern void dualbank_reset(void);
+
+// Checks the version in the image header and starts an update if one isn't in progress.
+// image_size may be OTA_SIZE_UNKNOWN or OTA_WITH_SEQUENTIAL_WRITES.
+extern void dualbank_start_update(const void *buf, const size_t len, const size_t image_size);
+// Appends to the update started by dualbank_start_update().
+extern void dualbank_write(const void *buf, const size_t len);
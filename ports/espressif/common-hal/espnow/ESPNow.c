@@ -7,6 +7,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -53,15 +55,42 @@ typedef struct {
 
 // --- The ESP-NOW send and recv callback routines ---
 
+// Find the statistics entry for mac, claiming a free one if it hasn't been seen before.
+// Returns NULL when the table is full. Only the ESP-NOW callbacks add entries and they
+// all run on the WiFi task, so no locking is needed.
+static espnow_peer_stats_t *find_peer_stats(espnow_obj_t *self, const uint8_t *mac, bool add) {
+    size_t len = self->peer_stats_len;
+    for (size_t i = 0; i < len; i++) {
+        if (memcmp(self->peer_stats[i].mac, mac, ESP_NOW_ETH_ALEN) == 0) {
+            return &self->peer_stats[i];
+        }
+    }
+    if (!add || len >= ESPNOW_PEER_STATS_LEN) {
+        return NULL;
+    }
+    espnow_peer_stats_t *stats = &self->peer_stats[len];
+    memset(stats, 0, sizeof(*stats));
+    memcpy(stats->mac, mac, ESP_NOW_ETH_ALEN);
+    self->peer_stats_len = len + 1;
+    return stats;
+}
+
 // Callback triggered when a sent packet is acknowledged by the peer (or not).
 // Just count the number of responses and number of failures.
 // These are used in the send() logic.
 static void send_cb(const uint8_t *mac, esp_now_send_status_t status) {
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
+    espnow_peer_stats_t *stats = find_peer_stats(self, mac, true);
     if (status == ESP_NOW_SEND_SUCCESS) {
         self->send_success++;
+        if (stats) {
+            stats->send_success++;
+        }
     } else {
         self->send_failure++;
+        if (stats) {
+            stats->send_failure++;
+        }
     }
 }
 
@@ -71,9 +100,16 @@ static void send_cb(const uint8_t *mac, esp_now_send_status_t status) {
 static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg, int msg_len) {
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
     ringbuf_t *buf = self->recv_buffer;
+    espnow_peer_stats_t *stats = find_peer_stats(self, esp_now_info->src_addr, true);
+    if (stats) {
+        stats->rssi = esp_now_info->rx_ctrl->rssi;
+    }
 
     if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
         self->read_failure++;
+        if (stats) {
+            stats->read_failure++;
+        }
         return;
     }
 
@@ -88,6 +124,9 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
     ringbuf_put_n(buf, msg, msg_len);
 
     self->read_success++;
+    if (stats) {
+        stats->read_success++;
+    }
 }
 
 bool common_hal_espnow_deinited(espnow_obj_t *self) {
@@ -122,6 +161,8 @@ void common_hal_espnow_init(espnow_obj_t *self) {
     CHECK_ESP_RESULT(esp_wifi_config_espnow_rate(ESP_IF_WIFI_STA, self->phy_rate));
     CHECK_ESP_RESULT(esp_wifi_config_espnow_rate(ESP_IF_WIFI_AP, self->phy_rate));
 
+    self->peer_stats_len = 0;
+
     CHECK_ESP_RESULT(esp_now_init());
     CHECK_ESP_RESULT(esp_now_register_send_cb(send_cb));
     CHECK_ESP_RESULT(esp_now_register_recv_cb(recv_cb));
@@ -172,36 +213,79 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
     return mp_const_none;
 }
 
-mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+void common_hal_espnow_send_many(espnow_obj_t *self, mp_obj_t messages, const uint8_t *mac) {
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(messages, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_buffer_info_t message;
+        mp_get_buffer_raise(item, &message, MP_BUFFER_READ);
+        common_hal_espnow_send(self, &message, mac);
+    }
+}
+
+// Pop the next packet from the recv_buffer. msg must have room for ESP_NOW_MAX_DATA_LEN bytes.
+static bool read_packet(espnow_obj_t *self, espnow_header_t *header, uint8_t *mac, uint8_t *msg) {
     if (!ringbuf_num_filled(self->recv_buffer)) {
-        return mp_const_none;
+        return false;
     }
 
     // Read the packet header from the incoming buffer
-    espnow_header_t header;
-    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)header, sizeof(*header)) != sizeof(*header)) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
 
-    uint8_t msg_len = header.msg_len;
-
-    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
-    uint8_t msg_buf[msg_len];
+    uint8_t msg_len = header->msg_len;
 
     // Check the message packet header format and read the message data
-    if (header.magic != ESPNOW_MAGIC ||
+    if (header->magic != ESPNOW_MAGIC ||
         msg_len > ESP_NOW_MAX_DATA_LEN ||
-        ringbuf_get_n(self->recv_buffer, mac_buf, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
-        ringbuf_get_n(self->recv_buffer, msg_buf, msg_len) != msg_len) {
+        ringbuf_get_n(self->recv_buffer, mac, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
+        ringbuf_get_n(self->recv_buffer, msg, msg_len) != msg_len) {
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
+    return true;
+}
+
+mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+    espnow_header_t header;
+    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
+    uint8_t msg_buf[ESP_NOW_MAX_DATA_LEN];
+
+    if (!read_packet(self, &header, mac_buf, msg_buf)) {
+        return mp_const_none;
+    }
 
     mp_obj_t elems[4] = {
         mp_obj_new_bytes(mac_buf, ESP_NOW_ETH_ALEN),
-        mp_obj_new_bytes(msg_buf, msg_len),
+        mp_obj_new_bytes(msg_buf, header.msg_len),
         MP_OBJ_NEW_SMALL_INT(header.rssi),
         mp_obj_new_int(header.time_ms),
     };
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+// Copy as many waiting packets as fit into buf as ESPNOW_RECORD_SIZE records.
+// Returns the number of packets copied.
+size_t common_hal_espnow_read_into_many(espnow_obj_t *self, uint8_t *buf, size_t len) {
+    size_t count = 0;
+    while (len >= ESPNOW_RECORD_SIZE) {
+        espnow_header_t header;
+        if (!read_packet(self, &header, buf + ESPNOW_RECORD_MAC_OFFSET, buf + ESPNOW_RECORD_MSG_OFFSET)) {
+            break;
+        }
+        buf[ESPNOW_RECORD_RSSI_OFFSET] = (uint8_t)header.rssi;
+        buf[ESPNOW_RECORD_LEN_OFFSET] = header.msg_len;
+        uint32_t time_ms = header.time_ms;
+        memcpy(buf + ESPNOW_RECORD_TIME_OFFSET, &time_ms, sizeof(time_ms));
+        buf += ESPNOW_RECORD_SIZE;
+        len -= ESPNOW_RECORD_SIZE;
+        count++;
+    }
+    return count;
+}
+
+const espnow_peer_stats_t *common_hal_espnow_get_peer_stats(espnow_obj_t *self, const uint8_t *mac) {
+    return find_peer_stats(self, mac, false);
+}
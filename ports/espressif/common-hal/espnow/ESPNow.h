@@ -11,8 +11,31 @@
 
 #include "bindings/espnow/Peers.h"
 
+#include "esp_now.h"
 #include "esp_wifi.h"
 
+// Size of one packet record written by read_into_many():
+// mac[6], rssi (int8), msg_len (uint8), time_ms (uint32 little-endian), msg[250].
+#define ESPNOW_RECORD_MAC_OFFSET (0)
+#define ESPNOW_RECORD_RSSI_OFFSET (6)
+#define ESPNOW_RECORD_LEN_OFFSET (7)
+#define ESPNOW_RECORD_TIME_OFFSET (8)
+#define ESPNOW_RECORD_MSG_OFFSET (12)
+#define ESPNOW_RECORD_SIZE (ESPNOW_RECORD_MSG_OFFSET + ESP_NOW_MAX_DATA_LEN)
+
+// The number of peer addresses that traffic statistics are kept for.
+#define ESPNOW_PEER_STATS_LEN (ESP_NOW_MAX_TOTAL_PEER_NUM)
+
+// Traffic statistics for a single peer address. Updated from the ESP-NOW callbacks.
+typedef struct {
+    uint8_t mac[ESP_NOW_ETH_ALEN];
+    volatile int8_t rssi;
+    volatile size_t send_success;
+    volatile size_t send_failure;
+    volatile size_t read_success;
+    volatile size_t read_failure;
+} espnow_peer_stats_t;
+
 typedef struct _espnow_obj_t {
     mp_obj_base_t base;
     ringbuf_t *recv_buffer;
@@ -23,6 +46,8 @@ typedef struct _espnow_obj_t {
     volatile size_t send_failure;
     volatile size_t read_success;
     volatile size_t read_failure;
+    espnow_peer_stats_t peer_stats[ESPNOW_PEER_STATS_LEN];
+    volatile size_t peer_stats_len;
 } espnow_obj_t;
 
 extern void espnow_reset(void);
@@ -36,4 +61,7 @@ extern void common_hal_espnow_set_phy_rate(espnow_obj_t *self, mp_int_t value);
 extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
+extern void common_hal_espnow_send_many(espnow_obj_t *self, mp_obj_t messages, const uint8_t *mac);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+extern size_t common_hal_espnow_read_into_many(espnow_obj_t *self, uint8_t *buf, size_t len);
+extern const espnow_peer_stats_t *common_hal_espnow_get_peer_stats(espnow_obj_t *self, const uint8_t *mac);
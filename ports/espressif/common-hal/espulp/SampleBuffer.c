@@ -0,0 +1,84 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "bindings/espulp/SampleBuffer.h"
+
+#include "py/runtime.h"
+#include "soc/soc.h"
+
+static uint32_t get_field(espulp_samplebuffer_obj_t *self, size_t field) {
+    // FSM stores put the program counter in the upper half of the word.
+    return self->ring[field] & 0xffff;
+}
+
+static uint32_t pending(espulp_samplebuffer_obj_t *self, uint32_t head, uint32_t tail) {
+    return (head + self->capacity - tail) % self->capacity;
+}
+
+void common_hal_espulp_samplebuffer_construct(espulp_samplebuffer_obj_t *self, size_t offset, uint16_t capacity, uint16_t watermark) {
+    size_t length = (ESPULP_SAMPLEBUFFER_HEADER_WORDS + capacity) * sizeof(uint32_t);
+    if (offset % sizeof(uint32_t) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_offset);
+    }
+    mp_arg_validate_int_range(offset, 0, CONFIG_ULP_COPROC_RESERVE_MEM - length, MP_QSTR_offset);
+
+    self->ring = (volatile uint32_t *)(SOC_RTC_DATA_LOW + offset);
+    self->capacity = capacity;
+    self->batch = m_new(uint32_t, capacity);
+
+    // After a deep sleep the ULP may have been filling this buffer all along, so only start it
+    // over when it doesn't match.
+    if (get_field(self, ESPULP_SAMPLEBUFFER_MAGIC) != ESPULP_SAMPLEBUFFER_MAGIC_VALUE ||
+        get_field(self, ESPULP_SAMPLEBUFFER_CAPACITY) != capacity ||
+        get_field(self, ESPULP_SAMPLEBUFFER_HEAD) >= capacity ||
+        get_field(self, ESPULP_SAMPLEBUFFER_TAIL) >= capacity) {
+        self->ring[ESPULP_SAMPLEBUFFER_MAGIC] = 0;
+        self->ring[ESPULP_SAMPLEBUFFER_CAPACITY] = capacity;
+        self->ring[ESPULP_SAMPLEBUFFER_HEAD] = 0;
+        self->ring[ESPULP_SAMPLEBUFFER_TAIL] = 0;
+        self->ring[ESPULP_SAMPLEBUFFER_DROPPED] = 0;
+        self->ring[ESPULP_SAMPLEBUFFER_MAGIC] = ESPULP_SAMPLEBUFFER_MAGIC_VALUE;
+    }
+    self->ring[ESPULP_SAMPLEBUFFER_WATERMARK] = watermark;
+}
+
+uint16_t common_hal_espulp_samplebuffer_get_capacity(espulp_samplebuffer_obj_t *self) {
+    return self->capacity;
+}
+
+uint16_t common_hal_espulp_samplebuffer_get_watermark(espulp_samplebuffer_obj_t *self) {
+    return get_field(self, ESPULP_SAMPLEBUFFER_WATERMARK);
+}
+
+void common_hal_espulp_samplebuffer_set_watermark(espulp_samplebuffer_obj_t *self, uint16_t watermark) {
+    self->ring[ESPULP_SAMPLEBUFFER_WATERMARK] = watermark;
+}
+
+uint16_t common_hal_espulp_samplebuffer_get_count(espulp_samplebuffer_obj_t *self) {
+    return pending(self, get_field(self, ESPULP_SAMPLEBUFFER_HEAD), get_field(self, ESPULP_SAMPLEBUFFER_TAIL));
+}
+
+uint16_t common_hal_espulp_samplebuffer_get_dropped(espulp_samplebuffer_obj_t *self) {
+    return get_field(self, ESPULP_SAMPLEBUFFER_DROPPED);
+}
+
+size_t common_hal_espulp_samplebuffer_drain(espulp_samplebuffer_obj_t *self) {
+    // Take one snapshot of head so that samples written while draining wait for the next batch.
+    uint32_t head = get_field(self, ESPULP_SAMPLEBUFFER_HEAD);
+    uint32_t tail = get_field(self, ESPULP_SAMPLEBUFFER_TAIL);
+    if (head >= self->capacity) {
+        return 0;
+    }
+    size_t count = pending(self, head, tail);
+    const volatile uint32_t *slots = self->ring + ESPULP_SAMPLEBUFFER_HEADER_WORDS;
+    for (size_t i = 0; i < count; i++) {
+        self->batch[i] = slots[tail];
+        tail = tail + 1 == self->capacity ? 0 : tail + 1;
+    }
+    // Only hand the slots back once they have been copied out.
+    self->ring[ESPULP_SAMPLEBUFFER_TAIL] = tail;
+    return count;
+}
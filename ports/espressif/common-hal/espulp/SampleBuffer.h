@@ -0,0 +1,37 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+// A SampleBuffer is a ring of 32-bit words in ULP memory. It starts with this header, followed by
+// `capacity` sample slots. Every header value fits in 16 bits so that FSM programs, which only
+// load and store the low half of a word, can use it too.
+//
+// The ULP only writes HEAD and DROPPED, and the main CPU only writes TAIL. To add a sample the ULP
+// checks that (head + 1) % capacity != tail, stores the sample at slot `head` and then advances
+// head. When the ring is full it bumps DROPPED instead. Once (head - tail) % capacity reaches
+// WATERMARK it wakes the main CPU.
+enum {
+    ESPULP_SAMPLEBUFFER_MAGIC,
+    ESPULP_SAMPLEBUFFER_CAPACITY,
+    ESPULP_SAMPLEBUFFER_WATERMARK,
+    ESPULP_SAMPLEBUFFER_HEAD,
+    ESPULP_SAMPLEBUFFER_TAIL,
+    ESPULP_SAMPLEBUFFER_DROPPED,
+    ESPULP_SAMPLEBUFFER_HEADER_WORDS,
+};
+
+#define ESPULP_SAMPLEBUFFER_MAGIC_VALUE (0x5342)
+
+typedef struct {
+    mp_obj_base_t base;
+    volatile uint32_t *ring;
+    // Samples copied out by the last drain().
+    uint32_t *batch;
+    uint16_t capacity;
+} espulp_samplebuffer_obj_t;
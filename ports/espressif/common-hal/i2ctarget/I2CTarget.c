@@ -14,7 +14,11 @@
 
 void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
     const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
-    uint8_t *addresses, unsigned int num_addresses, bool smbus) {
+    uint8_t *addresses, unsigned int num_addresses, bool smbus,
+    uint8_t *registers, size_t register_count) {
+    if (registers != NULL) {
+        mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_registers);
+    }
     // Pins 45 and 46 are "strapping" pins that impact start up behavior. They usually need to
     // be pulled-down so pulling them up for I2C is a bad idea. To make this hard, we don't
     // support I2C on these pins.
@@ -11,6 +11,8 @@
 #include "py/runtime.h"
 #include "soc/soc.h"
 
+#define NUM_MEMORY_RANGES (2)
+
 size_t allow_ranges[][2] = {
     // ULP accessible RAM
     {SOC_RTC_DATA_LOW, SOC_RTC_DATA_HIGH},
@@ -28,6 +30,8 @@ void common_hal_memorymap_addressrange_construct(memorymap_addressrange_obj_t *s
         if (allowed_start <= start_address &&
             (start_address + length) <= allowed_end) {
             allowed = true;
+            // The first NUM_MEMORY_RANGES ranges are RAM.
+            self->memory = i < NUM_MEMORY_RANGES;
             break;
         }
     }
@@ -81,3 +85,7 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
     }
     #pragma GCC diagnostic pop
 }
+
+uint8_t *common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self, bool writable) {
+    return self->memory ? self->start_address : NULL;
+}
@@ -12,4 +12,6 @@ typedef struct {
     mp_obj_base_t base;
     uint8_t *start_address;
     size_t len;
+    // True when the range is RAM that can be shared as a buffer.
+    bool memory;
 } memorymap_addressrange_obj_t;
@@ -22,14 +22,21 @@
 
 #include "shared-bindings/neopixel_write/__init__.h"
 
+#include <string.h>
+
 #include "esp_clk_tree.h"
 #include "py/mphal.h"
 #include "py/runtime.h"
 
 #include "bindings/espidf/__init__.h"
+#include "common-hal/microcontroller/Pin.h"
+#include "common-hal/neopixel_write/__init__.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 
 #include "driver/gpio.h"
+#include "driver/rmt_encoder.h"
 #include "driver/rmt_tx.h"
 
 // Use closer to WS2812-style timings instead of WS2812B, to accommodate more varieties.
@@ -37,40 +44,96 @@
 #define WS2812_T0L_NS (316 * 3)
 #define WS2812_T1H_NS (700)
 #define WS2812_T1L_NS (564)
+// Sent after every frame so that the next one can follow right away.
+#define WS2812_RESET_NS (300000)
 
-static uint64_t next_start_raw_ticks = 0;
+// Frames that can be queued at once. While one is sent, the next one waits in the RMT queue.
+#define NEOPIXEL_QUEUE_DEPTH (2)
+// Symbols in the DMA buffer, which the encoder refills half at a time while a frame is sent.
+#define NEOPIXEL_DMA_SYMBOLS (512)
 
-void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes) {
-    // Reserve channel
-    uint32_t clock_speed;
-    esp_clk_tree_src_get_freq_hz(RMT_CLK_SRC_DEFAULT,
-        ESP_CLK_TREE_SRC_FREQ_PRECISION_CACHED,
-        &clock_speed);
-    rmt_tx_channel_config_t config = {
-        .gpio_num = digitalinout->pin->number,
-        .clk_src = RMT_CLK_SRC_DEFAULT,
-        .resolution_hz = clock_speed,
-        .trans_queue_depth = 1,
-    };
+// Encodes the pixel bytes as they are sent, followed by the reset code, so memory use doesn't
+// depend on the length of the strip.
+typedef struct {
+    rmt_encoder_t base;
+    rmt_encoder_handle_t bytes_encoder;
+    rmt_encoder_handle_t copy_encoder;
+    rmt_symbol_word_t reset_code;
+    bool sending_reset;
+} neopixel_encoder_t;
 
-    // Greedily try and grab as much RMT memory as we can. The more we get, the
-    // smoother the output will be because we'll trigger fewer interrupts. We'll
-    // give it all back once we're done.
+// Only one strip is sent at a time because a channel takes as much RMT memory as it can get.
+static struct {
     rmt_channel_handle_t channel;
-    esp_err_t result = ESP_ERR_NOT_FOUND;
-    // If no other channels are in use, we can use all of the RMT RAM including the RX channels.
-    config.mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL * SOC_RMT_CHANNELS_PER_GROUP;
-    while (result == ESP_ERR_NOT_FOUND && config.mem_block_symbols > 0) {
-        result = rmt_new_tx_channel(&config, &channel);
-        config.mem_block_symbols -= SOC_RMT_MEM_WORDS_PER_CHANNEL;
+    neopixel_encoder_t encoder;
+    gpio_num_t pin;
+    // Copies of the frames given to non-blocking writes. Frame n uses frames[n % NEOPIXEL_QUEUE_DEPTH].
+    uint8_t *frames[NEOPIXEL_QUEUE_DEPTH];
+    size_t frame_sizes[NEOPIXEL_QUEUE_DEPTH];
+    uint32_t queued;
+    volatile uint32_t sent;
+    background_callback_t callback;
+} writer;
+
+static size_t neopixel_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+    const void *pixels, size_t len, rmt_encode_state_t *ret_state) {
+    neopixel_encoder_t *self = (neopixel_encoder_t *)encoder;
+    rmt_encode_state_t session_state = RMT_ENCODING_RESET;
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    size_t encoded = 0;
+    if (!self->sending_reset) {
+        encoded += self->bytes_encoder->encode(self->bytes_encoder, channel, pixels, len, &session_state);
+        if (session_state & RMT_ENCODING_COMPLETE) {
+            self->sending_reset = true;
+        }
+        if (session_state & RMT_ENCODING_MEM_FULL) {
+            // Called again once there is room.
+            *ret_state = RMT_ENCODING_MEM_FULL;
+            return encoded;
+        }
+    }
+    encoded += self->copy_encoder->encode(self->copy_encoder, channel,
+        &self->reset_code, sizeof(self->reset_code), &session_state);
+    if (session_state & RMT_ENCODING_COMPLETE) {
+        self->sending_reset = false;
+        state |= RMT_ENCODING_COMPLETE;
+    }
+    if (session_state & RMT_ENCODING_MEM_FULL) {
+        state |= RMT_ENCODING_MEM_FULL;
+    }
+    *ret_state = state;
+    return encoded;
+}
+
+static esp_err_t neopixel_encoder_reset(rmt_encoder_t *encoder) {
+    neopixel_encoder_t *self = (neopixel_encoder_t *)encoder;
+    rmt_encoder_reset(self->bytes_encoder);
+    rmt_encoder_reset(self->copy_encoder);
+    self->sending_reset = false;
+    return ESP_OK;
+}
+
+static esp_err_t neopixel_encoder_del(rmt_encoder_t *encoder) {
+    neopixel_encoder_t *self = (neopixel_encoder_t *)encoder;
+    if (self->bytes_encoder != NULL) {
+        rmt_del_encoder(self->bytes_encoder);
+        self->bytes_encoder = NULL;
+    }
+    if (self->copy_encoder != NULL) {
+        rmt_del_encoder(self->copy_encoder);
+        self->copy_encoder = NULL;
     }
-    CHECK_ESP_RESULT(result);
+    return ESP_OK;
+}
 
+static esp_err_t neopixel_encoder_init(neopixel_encoder_t *self, uint32_t clock_speed) {
     size_t ns_per_tick = 1e9 / clock_speed;
     uint16_t ws2812_t0h_ticks = WS2812_T0H_NS / ns_per_tick;
     uint16_t ws2812_t0l_ticks = WS2812_T0L_NS / ns_per_tick;
     uint16_t ws2812_t1h_ticks = WS2812_T1H_NS / ns_per_tick;
     uint16_t ws2812_t1l_ticks = WS2812_T1L_NS / ns_per_tick;
+    // Each half of a symbol holds at most 15 bits of duration.
+    uint16_t reset_ticks = MIN(WS2812_RESET_NS / ns_per_tick / 2, 0x7fff);
 
     rmt_symbol_word_t bit0 = {
         .duration0 = ws2812_t0h_ticks,
@@ -91,46 +154,212 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
             .msb_first = true
         }
     };
-    rmt_encoder_handle_t encoder;
-    result = rmt_new_bytes_encoder(&encoder_config, &encoder);
+    self->base.encode = neopixel_encode;
+    self->base.reset = neopixel_encoder_reset;
+    self->base.del = neopixel_encoder_del;
+    self->reset_code = (rmt_symbol_word_t) {
+        .duration0 = reset_ticks,
+        .level0 = 0,
+        .duration1 = reset_ticks,
+        .level1 = 0
+    };
+    self->sending_reset = false;
+    self->bytes_encoder = NULL;
+    self->copy_encoder = NULL;
+    esp_err_t result = rmt_new_bytes_encoder(&encoder_config, &self->bytes_encoder);
+    if (result == ESP_OK) {
+        rmt_copy_encoder_config_t copy_config = {};
+        result = rmt_new_copy_encoder(&copy_config, &self->copy_encoder);
+    }
     if (result != ESP_OK) {
-        rmt_del_channel(channel);
+        neopixel_encoder_del(&self->base);
+    }
+    return result;
+}
+
+static bool writer_done(void) {
+    return writer.sent == writer.queued;
+}
+
+// Waits until at least count frames have been sent.
+static void writer_wait(uint32_t count) {
+    while ((int32_t)(writer.sent - count) < 0) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+// Gives the RMT memory back and returns the pin to GPIO mode.
+static void writer_close(void) {
+    if (writer.channel == NULL) {
         return;
     }
+    rmt_disable(writer.channel);
+    rmt_del_encoder(&writer.encoder.base);
+    rmt_del_channel(writer.channel);
+    writer.channel = NULL;
+    writer.sent = writer.queued;
+    // The pin may have been released while the last frame was sent.
+    if (!pin_number_is_free(writer.pin)) {
+        gpio_set_direction(writer.pin, GPIO_MODE_OUTPUT);
+    }
+}
+
+static void writer_background(void *data) {
+    (void)data;
+    if (writer_done()) {
+        writer_close();
+    }
+}
+
+static bool writer_on_trans_done(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *event, void *user_ctx) {
+    writer.sent++;
+    background_callback_add(&writer.callback, writer_background, NULL);
+    return false;
+}
+
+static esp_err_t writer_open(gpio_num_t pin) {
+    // Reserve channel
+    uint32_t clock_speed;
+    esp_clk_tree_src_get_freq_hz(RMT_CLK_SRC_DEFAULT,
+        ESP_CLK_TREE_SRC_FREQ_PRECISION_CACHED,
+        &clock_speed);
+    rmt_tx_channel_config_t config = {
+        .gpio_num = pin,
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = clock_speed,
+        .trans_queue_depth = NEOPIXEL_QUEUE_DEPTH,
+    };
+
+    esp_err_t result = ESP_ERR_NOT_FOUND;
+    #if SOC_RMT_SUPPORT_DMA
+    // With DMA the size of the RMT memory doesn't matter, and other channels keep theirs.
+    config.mem_block_symbols = NEOPIXEL_DMA_SYMBOLS;
+    config.flags.with_dma = true;
+    result = rmt_new_tx_channel(&config, &writer.channel);
+    config.flags.with_dma = false;
+    if (result != ESP_OK) {
+        result = ESP_ERR_NOT_FOUND;
+    }
+    #endif
+
+    // Greedily try and grab as much RMT memory as we can. The more we get, the
+    // smoother the output will be because we'll trigger fewer interrupts. We'll
+    // give it all back once we're done.
+    // If no other channels are in use, we can use all of the RMT RAM including the RX channels.
+    if (result != ESP_OK) {
+        config.mem_block_symbols = SOC_RMT_MEM_WORDS_PER_CHANNEL * SOC_RMT_CHANNELS_PER_GROUP;
+    }
+    while (result == ESP_ERR_NOT_FOUND && config.mem_block_symbols > 0) {
+        result = rmt_new_tx_channel(&config, &writer.channel);
+        config.mem_block_symbols -= SOC_RMT_MEM_WORDS_PER_CHANNEL;
+    }
+    if (result != ESP_OK) {
+        writer.channel = NULL;
+        return result;
+    }
 
-    // Wait to make sure we don't append onto the last transmission. This should only be a tick or
-    // two.
-    while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
+    rmt_tx_event_callbacks_t callbacks = {
+        .on_trans_done = writer_on_trans_done,
+    };
+    result = rmt_tx_register_event_callbacks(writer.channel, &callbacks, NULL);
+    if (result == ESP_OK) {
+        result = neopixel_encoder_init(&writer.encoder, clock_speed);
+    }
+    if (result != ESP_OK) {
+        rmt_del_channel(writer.channel);
+        writer.channel = NULL;
+        return result;
     }
+    rmt_enable(writer.channel);
+    writer.pin = pin;
+    return ESP_OK;
+}
 
-    rmt_enable(channel);
+// Returns a copy of pixels for frame number writer.queued, or NULL if there isn't memory for one.
+static uint8_t *writer_copy_frame(const uint8_t *pixels, uint32_t numBytes) {
+    size_t slot = writer.queued % NEOPIXEL_QUEUE_DEPTH;
+    // The frame that used this copy before must be gone.
+    writer_wait(writer.queued - (NEOPIXEL_QUEUE_DEPTH - 1));
+    if (writer.frame_sizes[slot] < numBytes) {
+        port_free(writer.frames[slot]);
+        writer.frames[slot] = port_malloc(numBytes, false);
+        writer.frame_sizes[slot] = writer.frames[slot] == NULL ? 0 : numBytes;
+        if (writer.frames[slot] == NULL) {
+            return NULL;
+        }
+    }
+    memcpy(writer.frames[slot], pixels, numBytes);
+    return writer.frames[slot];
+}
+
+static void neopixel_write_start(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes, bool blocking) {
+    gpio_num_t pin = digitalinout->pin->number;
+    if (writer.channel != NULL && writer.pin != pin) {
+        // Finish with the previous strip before taking the RMT memory for this one.
+        writer_wait(writer.queued);
+        writer_close();
+    }
+
+    uint8_t *frame = pixels;
+    if (!blocking) {
+        frame = writer_copy_frame(pixels, numBytes);
+        if (frame == NULL) {
+            // Without a copy, the caller's buffer can only be used until the write returns.
+            frame = pixels;
+            blocking = true;
+        }
+    }
+    if (blocking) {
+        // Keep the RMT queue from blocking without running background tasks.
+        writer_wait(writer.queued - (NEOPIXEL_QUEUE_DEPTH - 1));
+    }
+
+    // Waiting may have closed an idle channel.
+    if (writer.channel == NULL) {
+        CHECK_ESP_RESULT(writer_open(pin));
+    }
 
-    // Write and wait to finish
     rmt_transmit_config_t transmit_config = {
         .loop_count = 0,
         .flags.eot_level = 0
     };
-    result = rmt_transmit(channel, encoder, pixels, (size_t)numBytes, &transmit_config);
+    // Counted first, because the frame may be done before rmt_transmit() returns.
+    writer.queued++;
+    esp_err_t result = rmt_transmit(writer.channel, &writer.encoder.base, frame, (size_t)numBytes, &transmit_config);
     if (result != ESP_OK) {
-        rmt_del_encoder(encoder);
-        rmt_disable(channel);
-        rmt_del_channel(channel);
+        writer.queued--;
+        writer_wait(writer.queued);
+        writer_close();
         raise_esp_error(result);
     }
-    result = ESP_ERR_TIMEOUT;
-    while (result == ESP_ERR_TIMEOUT) {
-        RUN_BACKGROUND_TASKS;
-        result = rmt_tx_wait_all_done(channel, 0);
+
+    if (blocking) {
+        // Write and wait to finish, then free the channel again.
+        writer_wait(writer.queued);
+        writer_close();
     }
+}
+
+void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes) {
+    neopixel_write_start(digitalinout, pixels, numBytes, true);
+}
+
+void common_hal_neopixel_write_nonblocking(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes) {
+    neopixel_write_start(digitalinout, pixels, numBytes, false);
+}
 
-    // Update the next start to +2 ticks. It ensures that we've gone 300+ us.
-    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+bool common_hal_neopixel_write_busy(const digitalio_digitalinout_obj_t *digitalinout) {
+    return writer.channel != NULL && writer.pin == digitalinout->pin->number && !writer_done();
+}
 
-    // Free channel again
-    rmt_del_encoder(encoder);
-    rmt_disable(channel);
-    rmt_del_channel(channel);
-    CHECK_ESP_RESULT(result);
-    // Swap pin back to GPIO mode
-    gpio_set_direction(digitalinout->pin->number, GPIO_MODE_OUTPUT);
+// Called during reset_port() to stop any frames still being sent and free the copies of them.
+void neopixel_write_reset(void) {
+    writer_close();
+    writer.queued = 0;
+    writer.sent = 0;
+    for (size_t i = 0; i < NEOPIXEL_QUEUE_DEPTH; i++) {
+        port_free(writer.frames[i]);
+        writer.frames[i] = NULL;
+        writer.frame_sizes[i] = 0;
+    }
 }
@@ -18,6 +18,7 @@
 #include "shared-module/ssl/SSLSocket.h"
 #endif
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/workflow.h"
 
@@ -62,6 +63,13 @@ static uint8_t socket_fd_state[CONFIG_LWIP_MAX_SOCKETS];
 #define SOCKET_CONNECT_POLL_INTERVAL_MS 100
 
 static socketpool_socket_obj_t *user_socket[CONFIG_LWIP_MAX_SOCKETS];
+
+// What the VM is waiting for on each user socket. The select task watches for it, wakes the VM
+// and clears it, so the VM can sleep instead of polling the socket.
+#define WAIT_NONE  0
+#define WAIT_READ  (1 << 0)
+#define WAIT_WRITE (1 << 1)
+static volatile uint8_t user_socket_wait[CONFIG_LWIP_MAX_SOCKETS];
 StaticTask_t socket_select_task_buffer;
 TaskHandle_t socket_select_task_handle;
 static int socket_change_fd = -1;
@@ -69,23 +77,37 @@ static int socket_change_fd = -1;
 static void socket_select_task(void *arg) {
     uint64_t signal;
     fd_set readfds;
+    fd_set writefds;
     fd_set excptfds;
 
     while (true) {
         FD_ZERO(&readfds);
+        FD_ZERO(&writefds);
         FD_ZERO(&excptfds);
         FD_SET(socket_change_fd, &readfds);
         int max_fd = socket_change_fd;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
-            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL)) {
-                int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (socket_fd_state[i] != FDSTATE_OPEN) {
+                continue;
+            }
+            int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (user_socket[i] == NULL) {
                 max_fd = MAX(max_fd, sockfd);
                 FD_SET(sockfd, &readfds);
                 FD_SET(sockfd, &excptfds);
+            } else if (user_socket_wait[i] != WAIT_NONE) {
+                max_fd = MAX(max_fd, sockfd);
+                if (user_socket_wait[i] & WAIT_READ) {
+                    FD_SET(sockfd, &readfds);
+                }
+                if (user_socket_wait[i] & WAIT_WRITE) {
+                    FD_SET(sockfd, &writefds);
+                }
+                FD_SET(sockfd, &excptfds);
             }
         }
 
-        int num_triggered = select(max_fd + 1, &readfds, NULL, &excptfds, NULL);
+        int num_triggered = select(max_fd + 1, &readfds, &writefds, &excptfds, NULL);
         // Hard error (or someone closed a socket on another thread)
         if (num_triggered == -1) {
             assert(errno == EBADF);
@@ -101,18 +123,28 @@ static void socket_select_task(void *arg) {
         }
 
         // Handle active FDs, close the dead ones
+        bool user_triggered = false;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             int sockfd = i + LWIP_SOCKET_OFFSET;
             if (socket_fd_state[i] != FDSTATE_CLOSED) {
-                if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &excptfds)) {
+                if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &writefds) || FD_ISSET(sockfd, &excptfds)) {
                     if (socket_fd_state[i] == FDSTATE_CLOSING) {
                         socket_fd_state[i] = FDSTATE_CLOSED;
                         num_triggered--;
+                    } else if (user_socket[i] != NULL) {
+                        // Stop watching until the VM waits again.
+                        user_socket_wait[i] = WAIT_NONE;
+                        user_triggered = true;
+                        num_triggered--;
                     }
                 }
             }
         }
 
+        if (user_triggered) {
+            port_wake_main_task();
+        }
+
         if (num_triggered > 0) {
             // Wake up CircuitPython by queuing request
             supervisor_workflow_request_background();
@@ -134,6 +166,7 @@ void socket_user_reset(void) {
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             socket_fd_state[i] = FDSTATE_CLOSED;
             user_socket[i] = NULL;
+            user_socket_wait[i] = WAIT_NONE;
         }
         socket_change_fd = eventfd(0, 0);
         // Run this at the same priority as CP so that the web workflow background task can be
@@ -182,9 +215,117 @@ static bool register_open_socket(int fd) {
 static void mark_user_socket(int fd, socketpool_socket_obj_t *obj) {
     socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_OPEN;
     user_socket[fd - LWIP_SOCKET_OFFSET] = obj;
+    user_socket_wait[fd - LWIP_SOCKET_OFFSET] = WAIT_NONE;
     // No need to wakeup select task
 }
 
+// Asks the select task to wake the VM once the user socket is ready for events.
+static void watch_user_socket(int fd, uint8_t events) {
+    if (fd < LWIP_SOCKET_OFFSET || user_socket[fd - LWIP_SOCKET_OFFSET] == NULL) {
+        return;
+    }
+    uint8_t old_events = user_socket_wait[fd - LWIP_SOCKET_OFFSET];
+    if ((old_events & events) == events) {
+        return;
+    }
+    user_socket_wait[fd - LWIP_SOCKET_OFFSET] = old_events | events;
+    uint64_t signal = 1;
+    write(socket_change_fd, &signal, sizeof(signal));
+}
+
+// Sleeps until the user socket may be ready for events. This is bounded by
+// port_wait_for_event() so timeouts and interrupts are still noticed promptly.
+static void wait_for_user_socket(int fd, uint8_t events) {
+    watch_user_socket(fd, events);
+    port_wait_for_event(-1);
+}
+
+#if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+// Try to send the held data. Whatever lwIP won't take now is kept for the next attempt.
+static int flush_send_buf(socketpool_socket_obj_t *self) {
+    if (self->send_len == 0) {
+        return 0;
+    }
+    int sent = lwip_send(self->num, self->send_buf, self->send_len, 0);
+    if (sent < 0) {
+        if (errno == EAGAIN) {
+            return 0;
+        }
+        if (errno == ECONNRESET || errno == ENOTCONN) {
+            self->connected = false;
+        }
+        // The data can't be delivered so drop it.
+        sent = -errno;
+        self->send_len = 0;
+    } else {
+        self->send_len -= sent;
+        memmove(self->send_buf, self->send_buf + sent, self->send_len);
+    }
+    if (self->send_len == 0) {
+        supervisor_disable_tick();
+    }
+    return sent < 0 ? sent : 0;
+}
+
+// Copy buf into the held data. Returns false if it doesn't fit.
+static bool hold_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
+    if (self->send_len + len > SOCKETPOOL_SEND_COALESCE_BUFFER_SIZE) {
+        return false;
+    }
+    if (self->send_len == 0) {
+        // The background tick flushes the data once the window passes.
+        self->send_deadline = supervisor_ticks_ms64() + self->send_coalesce_ms;
+        supervisor_enable_tick();
+    }
+    memcpy(self->send_buf + self->send_len, buf, len);
+    self->send_len += len;
+    return true;
+}
+
+static void free_send_buf(socketpool_socket_obj_t *self) {
+    if (self->send_buf == NULL) {
+        return;
+    }
+    flush_send_buf(self);
+    if (self->send_len > 0) {
+        self->send_len = 0;
+        supervisor_disable_tick();
+    }
+    port_free(self->send_buf);
+    self->send_buf = NULL;
+    self->send_coalesce_ms = 0;
+}
+
+void socketpool_socket_background_tick(void) {
+    uint64_t now = supervisor_ticks_ms64();
+    for (size_t i = 0; i < MP_ARRAY_SIZE(user_socket); i++) {
+        socketpool_socket_obj_t *sock = user_socket[i];
+        if (sock != NULL && sock->send_len > 0 && now >= sock->send_deadline) {
+            flush_send_buf(sock);
+        }
+    }
+}
+
+mp_int_t common_hal_socketpool_socket_get_send_coalesce_ms(socketpool_socket_obj_t *self) {
+    return self->send_coalesce_ms;
+}
+
+void common_hal_socketpool_socket_set_send_coalesce_ms(socketpool_socket_obj_t *self, mp_int_t send_coalesce_ms) {
+    if (send_coalesce_ms == 0 || self->type != SOCK_STREAM) {
+        free_send_buf(self);
+        return;
+    }
+    if (self->send_buf == NULL) {
+        self->send_buf = port_malloc(SOCKETPOOL_SEND_COALESCE_BUFFER_SIZE, false);
+        if (self->send_buf == NULL) {
+            m_malloc_fail(SOCKETPOOL_SEND_COALESCE_BUFFER_SIZE);
+        }
+        self->send_len = 0;
+    }
+    self->send_coalesce_ms = send_coalesce_ms;
+}
+#endif
+
 static bool _socketpool_socket(socketpool_socketpool_obj_t *self,
     socketpool_socketpool_addressfamily_t family, socketpool_socketpool_sock_t type,
     int proto,
@@ -287,6 +428,9 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, mp_obj_t *peer_out,
         if (newsoc == -1 && (self->timeout_ms == 0 || mp_hal_is_interrupted())) {
             return -MP_EAGAIN;
         }
+        if (newsoc == -1) {
+            wait_for_user_socket(self->num, WAIT_READ);
+        }
     }
 
     if (timed_out) {
@@ -394,6 +538,9 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
         return;
     }
     #endif
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    free_send_buf(self);
+    #endif
     self->connected = false;
     int fd = self->num;
     // Ignore bogus/closed sockets
@@ -407,6 +554,7 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
             lwip_close(fd);
             socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_CLOSED;
             user_socket[fd - LWIP_SOCKET_OFFSET] = NULL;
+            user_socket_wait[fd - LWIP_SOCKET_OFFSET] = WAIT_NONE;
         }
     }
     self->num = -1;
@@ -529,6 +677,9 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *se
         if (received == -1 && self->timeout_ms == 0) {
             mp_raise_OSError(MP_EAGAIN);
         }
+        if (received == -1) {
+            wait_for_user_socket(self->num, WAIT_READ);
+        }
     }
 
     if (timed_out) {
@@ -552,6 +703,11 @@ int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     int received = 0;
     bool timed_out = false;
 
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    // Anything held is likely what the peer needs before it replies.
+    flush_send_buf(self);
+    #endif
+
     if (self->num != -1) {
         // LWIP Socket
         uint64_t start_ticks = supervisor_ticks_ms64();
@@ -579,6 +735,9 @@ int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
                 }
                 break;
             }
+            if (received == -1) {
+                wait_for_user_socket(self->num, WAIT_READ);
+            }
         }
     } else {
         return -MP_EBADF;
@@ -600,6 +759,24 @@ mp_uint_t common_hal_socketpool_socket_recv_into(socketpool_socket_obj_t *self,
 
 int socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
     int sent = -1;
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    if (self->send_buf != NULL && self->num != -1) {
+        if (hold_send(self, buf, len)) {
+            if (self->send_len == SOCKETPOOL_SEND_COALESCE_BUFFER_SIZE) {
+                flush_send_buf(self);
+            }
+            return len;
+        }
+        // Keep the byte order by sending what is held first.
+        int err = flush_send_buf(self);
+        if (err < 0) {
+            return err;
+        }
+        if (self->send_len > 0) {
+            return -MP_EAGAIN;
+        }
+    }
+    #endif
     if (self->num != -1) {
         // LWIP Socket
         // TODO: deal with potential failure/add timeout?
@@ -666,6 +843,10 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, &fds, NULL, &fds, &immediate);
 
+    // Wake select.poll() when this changes.
+    if (num_triggered == 0) {
+        watch_user_socket(self->num, WAIT_READ);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -678,6 +859,9 @@ bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     FD_SET(self->num, &fds);
     int num_triggered = select(self->num + 1, NULL, &fds, &fds, &immediate);
 
+    if (num_triggered == 0) {
+        watch_user_socket(self->num, WAIT_WRITE);
+    }
     // including returning true in the error case
     return num_triggered != 0;
 }
@@ -25,8 +25,23 @@ typedef struct {
     socketpool_socketpool_obj_t *pool;
     ssl_sslsocket_obj_t *ssl_socket;
     mp_uint_t timeout_ms;
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    // Small TCP sends are held here for up to send_coalesce_ms and then sent together.
+    uint8_t *send_buf;
+    uint16_t send_len;
+    uint16_t send_coalesce_ms;
+    uint64_t send_deadline;
+    #endif
 } socketpool_socket_obj_t;
 
 void socket_user_reset(void);
+
+#if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+// Held sends are flushed once this many bytes are waiting.
+#define SOCKETPOOL_SEND_COALESCE_BUFFER_SIZE (TCP_MSS)
+
+// Send any coalesced data that has been held for long enough. Called from the background tick.
+void socketpool_socket_background_tick(void);
+#endif
 // Unblock workflow socket select thread (platform specific)
 void socketpool_socket_poll_resume(void);
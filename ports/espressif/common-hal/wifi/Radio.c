@@ -37,6 +37,9 @@
 
 #define MAC_ADDRESS_LENGTH 6
 
+// Beacon intervals between wakeups in PowerManagement.MAX when none is set.
+#define DEFAULT_LISTEN_INTERVAL (3)
+
 static void set_mode_station(wifi_radio_obj_t *self, bool state) {
     wifi_mode_t next_mode;
     if (state) {
@@ -164,8 +167,10 @@ void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_pow
         case POWER_MANAGEMENT_MAX: {
             // listen_interval is only used in this case.
             wifi_config_t *config = &self->sta_config;
-            // This is a typical value seen in various examples.
-            config->sta.listen_interval = 3;
+            if (config->sta.listen_interval == 0) {
+                // This is a typical value seen in various examples.
+                config->sta.listen_interval = DEFAULT_LISTEN_INTERVAL;
+            }
             esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
             esp_wifi_set_config(ESP_IF_WIFI_STA, config);
         }
@@ -179,6 +184,19 @@ void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_pow
     }
 }
 
+mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self) {
+    uint16_t listen_interval = self->sta_config.sta.listen_interval;
+    return listen_interval == 0 ? DEFAULT_LISTEN_INTERVAL : listen_interval;
+}
+
+void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, mp_int_t listen_interval) {
+    wifi_config_t *config = &self->sta_config;
+    config->sta.listen_interval = listen_interval;
+    if (common_hal_wifi_radio_get_power_management(self) == POWER_MANAGEMENT_MAX) {
+        esp_wifi_set_config(ESP_IF_WIFI_STA, config);
+    }
+}
+
 mp_obj_t common_hal_wifi_radio_get_mac_address_ap(wifi_radio_obj_t *self) {
     uint8_t mac[MAC_ADDRESS_LENGTH];
     esp_wifi_get_mac(ESP_IF_WIFI_AP, mac);
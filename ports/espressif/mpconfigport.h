@@ -17,6 +17,18 @@
 
 #define CIRCUITPY_DIGITALIO_HAVE_INPUT_ONLY (1)
 
+#include "sdkconfig.h"
+
+// Fewer, longer display bus transactions per refresh.
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE (16 * 1024)
+#endif
+
+// Bitmaps too big for internal RAM end up in PSRAM.
+#if defined(CONFIG_SPIRAM)
+#define CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE (16 * 1024)
+#endif
+
 #include "py/circuitpy_mpconfig.h"
 
 #define MICROPY_NLR_SETJMP                  (1)
@@ -24,6 +36,14 @@
 
 // PSRAM can require more stack space for GC.
 #define MICROPY_ALLOC_GC_STACK_SIZE         (128)
+// Large PSRAM heaps take long to sweep, so allow gc.sweep_budget() to split it up.
+#define MICROPY_GC_INCREMENTAL_SWEEP        (1)
+// Keep small objects out of the free runs that large buffers need.
+#define MICROPY_GC_SMALL_POOLS              (1)
+// Let long-running programs join up free memory with gc.compact().
+#define MICROPY_GC_MOVABLE                  (1)
+// Report collection pauses with gc.stats() and over the web workflow.
+#define MICROPY_GC_STATS                    (1)
 
 // Nearly all boards have this because it is used to enter the ROM bootloader.
 #ifndef CIRCUITPY_BOOT_BUTTON
@@ -63,6 +83,11 @@ extern portMUX_TYPE background_task_mutex;
 #define CALLBACK_CRITICAL_BEGIN (taskENTER_CRITICAL(&background_task_mutex))
 #define CALLBACK_CRITICAL_END (taskEXIT_CRITICAL(&background_task_mutex))
 
+// Sleep in select.poll() and blocking socket calls until a socket is ready or the main task is
+// otherwise woken, rather than spinning.
+void port_wait_for_event(int timeout_ms);
+#define MICROPY_INTERNAL_WFE(TIMEOUT_MS) port_wait_for_event(TIMEOUT_MS)
+
 // 20 dBm is the default and the highest max tx power.
 // Allow a different value to be specified for boards that have trouble with using the maximum power.
 #ifndef CIRCUITPY_WIFI_DEFAULT_TX_POWER
@@ -38,6 +38,9 @@ CIRCUITPY_4MB_FLASH_LARGE_USER_FS_LAYOUT ?= 0
 # Enable more features
 CIRCUITPY_FULL_BUILD ?= 1
 
+# Keep compiled .py modules in .mpycache so deep sleep wakes don't compile them again.
+CIRCUITPY_MODULE_COMPILE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+
 # If SSL is enabled, it's mbedtls
 CIRCUITPY_SSL_MBEDTLS = 1
 
@@ -77,6 +80,8 @@ CIRCUITPY_TOUCHIO_USE_NATIVE ?= 1
 CIRCUITPY_WATCHDOG ?= 1
 CIRCUITPY_WIFI ?= 1
 CIRCUITPY_SOCKETPOOL_IPV6 ?= 1
+CIRCUITPY_SOCKETPOOL_SEND_COALESCE ?= 1
+CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL ?= 1
 
 # Enable _eve module
 CIRCUITPY__EVE ?= 1
@@ -11,6 +11,7 @@
 #include "rom/ets_sys.h"
 
 #include "esp_attr.h"
+#include "esp_timer.h"
 
 // This is used by ProtoMatter's interrupt so make sure it is available when
 // flash isn't.
@@ -18,6 +19,11 @@ void IRAM_ATTR mp_hal_delay_us(mp_uint_t delay) {
     ets_delay_us(delay);
 }
 
+// Used to time incremental garbage collector sweeps.
+mp_uint_t mp_hal_ticks_us(void) {
+    return esp_timer_get_time();
+}
+
 // This is provided by the esp-idf/components/xtensa/esp32s2/libhal.a binary blob.
 #ifndef CONFIG_IDF_TARGET_ARCH_RISCV
 extern void xthal_window_spill(void);
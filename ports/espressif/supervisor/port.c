@@ -10,6 +10,7 @@
 #include <sys/time.h>
 #include "supervisor/board.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/serial.h"
@@ -55,6 +56,10 @@
 #include "esp_camera.h"
 #endif
 
+#if CIRCUITPY_NEOPIXEL_WRITE
+#include "common-hal/neopixel_write/__init__.h"
+#endif
+
 #if CIRCUITPY_RCLCPY
 #include "common-hal/rclcpy/__init__.h"
 #endif
@@ -83,6 +88,7 @@
 #include "esp_debug_helpers.h"
 #include "esp_efuse.h"
 #include "esp_ipc.h"
+#include "esp_memory_utils.h"
 #include "esp_rom_efuse.h"
 #include "esp_timer.h"
 
@@ -341,6 +347,19 @@ size_t port_heap_get_largest_free_size(void) {
     return free_size;
 }
 
+bool port_ptr_in_external_ram(const void *ptr) {
+    return esp_ptr_external_ram(ptr);
+}
+
+void port_heap_get_stats(port_heap_stats_t *stats) {
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+    stats->used = info.total_allocated_bytes;
+    stats->free = info.total_free_bytes;
+    stats->free_blocks = info.free_blocks;
+    stats->total = heap_caps_get_total_size(MALLOC_CAP_8BIT);
+}
+
 void reset_port(void) {
     // TODO deinit for esp32-camera
     #if CIRCUITPY_ESPCAMERA
@@ -351,6 +370,11 @@ void reset_port(void) {
     ssl_reset();
     #endif
 
+    // Stop any frames still being sent before their pin is reset.
+    #if CIRCUITPY_NEOPIXEL_WRITE
+    neopixel_write_reset();
+    #endif
+
     reset_all_pins();
 
     #if CIRCUITPY_ANALOGIO
@@ -505,6 +529,14 @@ void port_idle_until_interrupt(void) {
     }
 }
 
+void port_wait_for_event(int timeout_ms) {
+    if (timeout_ms == 0 || background_callback_pending() || autoreload_pending()) {
+        return;
+    }
+    // Only wait for one FreeRTOS tick because not everything select.poll() can wait on wakes us.
+    xTaskNotifyWait(0x01, 0x01, NULL, 1);
+}
+
 #if CIRCUITPY_WIFI
 void port_boot_info(void) {
     uint8_t mac[6];
@@ -99,21 +99,24 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return 0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+static void read_message(canio_listener_obj_t *self, canio_message_record_t *record) {
     flexcan_frame_t rx_frame;
     if (FLEXCAN_ReadRxFifo(self->can->data->base, &rx_frame) != kStatus_Success) {
         mp_raise_OSError(MP_EIO);
@@ -123,38 +126,52 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     // allows the CPU to serve the next FIFO entry
     FLEXCAN_ClearMbStatusFlags(self->can->data->base, (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
 
-    const mp_obj_type_t *type;
-    if (rx_frame.type == kFLEXCAN_FrameTypeRemote) {
-        type = &canio_remote_transmission_request_type;
+    bool rtr = rx_frame.type == kFLEXCAN_FrameTypeRemote;
+    bool extended = rx_frame.format == kFLEXCAN_FrameFormatExtend;
+    if (extended) {
+        record->id = rx_frame.id;
     } else {
-        type = &canio_message_type;
-    }
-    canio_message_obj_t *message = mp_obj_malloc(canio_message_obj_t, type);
-    memset(message, 0, sizeof(canio_message_obj_t));
-
-    if (rx_frame.format == kFLEXCAN_FrameFormatExtend) {
-        message->extended = true;
-        message->id = rx_frame.id;
-    } else {
-        message->extended = false;
-        message->id = rx_frame.id >> 18; // standard ids are left-aligned
+        record->id = rx_frame.id >> 18; // standard ids are left-aligned
     }
+    // Classic CAN codes a length of 8 as any DLC from 8 to 15.
+    record->size = MIN(rx_frame.length, sizeof(record->data));
+    record->flags = (extended ? CANIO_MESSAGE_RECORD_EXTENDED : 0) | (rtr ? CANIO_MESSAGE_RECORD_RTR : 0);
+    record->reserved = 0;
 
+    // We can safely copy all bytes, as both flexcan_frame_t and
+    // canio_message_record_t define the data array as 8 bytes long.
+    record->data[0] = rx_frame.dataByte0;
+    record->data[1] = rx_frame.dataByte1;
+    record->data[2] = rx_frame.dataByte2;
+    record->data[3] = rx_frame.dataByte3;
+    record->data[4] = rx_frame.dataByte4;
+    record->data[5] = rx_frame.dataByte5;
+    record->data[6] = rx_frame.dataByte6;
+    record->data[7] = rx_frame.dataByte7;
+    record->timestamp = supervisor_ticks_ms32();
+}
 
-    message->size = rx_frame.length;
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_message_record_t record;
+    read_message(self, &record);
+    return canio_message_new_from_record(&record);
+}
 
-    // We can safely copy all bytes, as both flexcan_frame_t and
-    // canio_message_obj_t define the data array as 8 bytes long.
-    message->data[0] = rx_frame.dataByte0;
-    message->data[1] = rx_frame.dataByte1;
-    message->data[2] = rx_frame.dataByte2;
-    message->data[3] = rx_frame.dataByte3;
-    message->data[4] = rx_frame.dataByte4;
-    message->data[5] = rx_frame.dataByte5;
-    message->data[6] = rx_frame.dataByte6;
-    message->data[7] = rx_frame.dataByte7;
-
-    return message;
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, void *records, size_t count) {
+    if (count == 0 || !wait_for_message(self)) {
+        return 0;
+    }
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        canio_message_record_t record;
+        read_message(self, &record);
+        memcpy((uint8_t *)records + n * sizeof(record), &record, sizeof(record));
+        n++;
+    }
+    return n;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -29,13 +29,15 @@ static void write_to_ringbuf(bleio_characteristic_buffer_obj_t *self, uint8_t *d
         for (uint16_t i = 0; i < len; i++) {
             if (data[i] == mp_interrupt_char) {
                 mp_sched_keyboard_interrupt();
-                ringbuf_clear(&self->ringbuf);
+                ringbuf_request_clear(&self->ringbuf);
             } else {
-                ringbuf_put(&self->ringbuf, data[i]);
+                if (ringbuf_put(&self->ringbuf, data[i]) < 0) {
+                    self->overflow_count++;
+                }
             }
         }
     } else {
-        ringbuf_put_n(&self->ringbuf, data, len);
+        self->overflow_count += len - ringbuf_put_n(&self->ringbuf, data, len);
     }
     sd_nvic_critical_region_exit(is_nested_critical_region);
 }
@@ -85,6 +87,8 @@ void _common_hal_bleio_characteristic_buffer_construct(bleio_characteristic_buff
 
     ringbuf_init(&self->ringbuf, buffer, buffer_size);
 
+    self->overflow_count = 0;
+
     if (static_handler_entry != NULL) {
         ble_drv_add_event_handler_entry((ble_drv_evt_handler_entry_t *)static_handler_entry, characteristic_buffer_on_ble_evt, self);
     } else {
@@ -133,6 +137,10 @@ uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(bleio_ch
     return count;
 }
 
+uint32_t common_hal_bleio_characteristic_buffer_get_overflow_count(bleio_characteristic_buffer_obj_t *self) {
+    return self->overflow_count;
+}
+
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(bleio_characteristic_buffer_obj_t *self) {
     // prevent conflict with uart irq
     uint8_t is_nested_critical_region;
@@ -382,6 +382,25 @@ void common_hal_bleio_connection_set_connection_interval(bleio_connection_intern
     check_nrf_error(status);
 }
 
+void common_hal_bleio_connection_request_high_throughput(bleio_connection_internal_t *self) {
+    ble_gap_phys_t const phys = {
+        .rx_phys = BLE_GAP_PHY_2MBPS,
+        .tx_phys = BLE_GAP_PHY_2MBPS,
+    };
+    uint32_t status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_phy_update(self->conn_handle, &phys);
+        RUN_BACKGROUND_TASKS;
+    }
+    // Let the SD pick the longest data length its configuration allows, up to 251 bytes.
+    status = NRF_ERROR_BUSY;
+    while (status == NRF_ERROR_BUSY) {
+        status = sd_ble_gap_data_length_update(self->conn_handle, NULL, NULL);
+        RUN_BACKGROUND_TASKS;
+    }
+    // NRF_ERROR_RESOURCES or NRF_ERROR_NOT_SUPPORTED mean the current settings are kept.
+}
+
 // service_uuid may be NULL, to discover all services.
 static bool discover_next_services(bleio_connection_internal_t *connection, uint16_t start_handle, ble_uuid_t *service_uuid) {
     m_discovery_successful = false;
@@ -45,6 +45,32 @@ static void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uin
     sd_nvic_critical_region_exit(is_nested_critical_region);
 }
 
+// Hand one value to the SD for transmission as a write or an HVX, depending on our role.
+static uint32_t send_value(bleio_packet_buffer_obj_t *self, const uint8_t *data, uint16_t len) {
+    uint16_t conn_handle = self->conn_handle;
+    if (self->client) {
+        ble_gattc_write_params_t write_params = {
+            .write_op = self->write_type,
+            .handle = self->characteristic->handle,
+            .p_value = data,
+            .len = len,
+        };
+
+        return sd_ble_gattc_write(conn_handle, &write_params);
+    }
+
+    uint16_t hvx_len = len;
+
+    ble_gatts_hvx_params_t hvx_params = {
+        .handle = self->characteristic->handle,
+        .type = self->write_type,
+        .offset = 0,
+        .p_len = &hvx_len,
+        .p_data = data,
+    };
+    return sd_ble_gatts_hvx(conn_handle, &hvx_params);
+}
+
 static uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
     // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
     // transmission (when packet_queued is true) and the other is `pending` and can still be
@@ -52,29 +78,7 @@ static uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
     // of the lower level link and ATT layers.
     self->packet_queued = false;
     if (self->pending_size > 0) {
-        uint16_t conn_handle = self->conn_handle;
-        uint32_t err_code;
-        if (self->client) {
-            ble_gattc_write_params_t write_params = {
-                .write_op = self->write_type,
-                .handle = self->characteristic->handle,
-                .p_value = (const uint8_t *)self->outgoing[self->pending_index],
-                .len = self->pending_size,
-            };
-
-            err_code = sd_ble_gattc_write(conn_handle, &write_params);
-        } else {
-            uint16_t hvx_len = self->pending_size;
-
-            ble_gatts_hvx_params_t hvx_params = {
-                .handle = self->characteristic->handle,
-                .type = self->write_type,
-                .offset = 0,
-                .p_len = &hvx_len,
-                .p_data = (const uint8_t *)self->outgoing[self->pending_index],
-            };
-            err_code = sd_ble_gatts_hvx(conn_handle, &hvx_params);
-        }
+        uint32_t err_code = send_value(self, (const uint8_t *)self->outgoing[self->pending_index], self->pending_size);
         if (err_code != NRF_SUCCESS) {
             // On error, simply skip updating the pending buffers so that the next HVC or WRITE
             // complete event triggers another attempt.
@@ -390,6 +394,53 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, c
     return num_bytes_written;
 }
 
+mp_int_t common_hal_bleio_packet_buffer_send_packet(bleio_packet_buffer_obj_t *self, const uint8_t *data, size_t len) {
+    // The SD copies notifications and write commands into its own TX queue, so they can go
+    // straight to it. Everything else needs its buffer kept until the peer responds.
+    bool queued_by_sd = self->client ?
+        self->write_type == BLE_GATT_OP_WRITE_CMD :
+        self->write_type == BLE_GATT_HVX_NOTIFICATION;
+    if (self->outgoing[0] == NULL || !queued_by_sd) {
+        return common_hal_bleio_packet_buffer_write(self, data, len, NULL, 0);
+    }
+    if (self->conn_handle == BLE_CONN_HANDLE_INVALID) {
+        return -1;
+    }
+    mp_int_t outgoing_packet_length = common_hal_bleio_packet_buffer_get_outgoing_packet_length(self);
+    if (outgoing_packet_length < 0) {
+        return -1;
+    }
+    if (len > (size_t)outgoing_packet_length) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Total data to write is larger than %q"), MP_QSTR_outgoing_packet_length);
+    }
+    if (len > self->max_packet_size) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Total data to write is larger than %q"), MP_QSTR_max_packet_size);
+    }
+
+    // Data from write() that hasn't been queued yet goes first.
+    while (self->pending_size != 0 &&
+           self->conn_handle != BLE_CONN_HANDLE_INVALID &&
+           !mp_hal_is_interrupted()) {
+        if (!self->packet_queued) {
+            queue_next_write(self);
+        }
+        RUN_BACKGROUND_TASKS;
+    }
+
+    while (self->conn_handle != BLE_CONN_HANDLE_INVALID && !mp_hal_is_interrupted()) {
+        uint32_t err_code = send_value(self, data, len);
+        if (err_code == NRF_SUCCESS) {
+            return len;
+        }
+        if (err_code != NRF_ERROR_RESOURCES) {
+            check_nrf_error(err_code);
+        }
+        // The TX queue is full. A slot frees up after the next connection event.
+        RUN_BACKGROUND_TASKS;
+    }
+    return -1;
+}
+
 mp_int_t common_hal_bleio_packet_buffer_get_incoming_packet_length(bleio_packet_buffer_obj_t *self) {
     // If this PacketBuffer is coming from a remote service via NOTIFY or INDICATE
     // the maximum size is what can be sent in one
@@ -11,6 +11,8 @@
 
 #include "py/runtime.h"
 
+// Every series lists flash, FICR & UICR and then RAM before the peripherals.
+#define RAM_RANGE (2)
 
 #ifdef NRF51_SERIES
 size_t allow_ranges[][2] = {
@@ -58,6 +60,8 @@ void common_hal_memorymap_addressrange_construct(memorymap_addressrange_obj_t *s
         if (allowed_start <= start_address &&
             (start_address + length) <= allowed_end) {
             allowed = true;
+            self->memory = i <= RAM_RANGE;
+            self->readonly = i < RAM_RANGE;
             break;
         }
     }
@@ -112,3 +116,10 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
     }
     #pragma GCC diagnostic pop
 }
+
+uint8_t *common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self, bool writable) {
+    if (!self->memory || (writable && self->readonly)) {
+        return NULL;
+    }
+    return self->start_address;
+}
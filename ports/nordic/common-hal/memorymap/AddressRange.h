@@ -12,4 +12,7 @@ typedef struct {
     mp_obj_base_t base;
     uint8_t *start_address;
     size_t len;
+    // Flash and RAM can be shared as buffers, but only RAM can be written that way.
+    bool memory;
+    bool readonly;
 } memorymap_addressrange_obj_t;
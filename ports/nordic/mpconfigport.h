@@ -53,6 +53,10 @@
 #define BOARD_HAS_32KHZ_XTAL (1)
 #endif
 
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (4)
+#endif
+
 #if INTERNAL_FLASH_FILESYSTEM
 #ifndef CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_SIZE
 #define CIRCUITPY_INTERNAL_FLASH_FILESYSTEM_SIZE (256 * 1024)
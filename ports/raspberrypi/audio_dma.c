@@ -10,17 +10,26 @@
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
+#include "shared-module/audiocore/__init__.h"
 #include "supervisor/background_callback.h"
 
 #include "py/mpstate.h"
 #include "py/runtime.h"
 
 #include "hardware/irq.h"
+#include "hardware/regs/addressmap.h"
 #include "hardware/regs/intctrl.h" // For isr_ macro.
+#include "hardware/timer.h"
 
 
 #if CIRCUITPY_AUDIOCORE
 
+#if CIRCUITPY_AUDIOCORE_STATS
+uint32_t audiocore_stats_now_us(void) {
+    return time_us_32();
+}
+#endif
+
 void audio_dma_reset(void) {
     for (size_t channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
         if (MP_STATE_PORT(playing_audio)[channel] == NULL) {
@@ -116,10 +125,13 @@ static size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
     return output_length_used;
 }
 
-// buffer_idx is 0 or 1.
-static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
-    assert(dma->channel[buffer_idx] < NUM_DMA_CHANNELS);
-    size_t dma_channel = dma->channel[buffer_idx];
+// Converts the next block of the sample into the buffer at fill_index. Returns false if there
+// was no free buffer or nothing left to convert.
+static bool audio_dma_fill_next_block(audio_dma_t *dma) {
+    if (dma->free_count == 0 || dma->source_done) {
+        return false;
+    }
+    size_t buffer_idx = dma->fill_index;
 
     audioio_get_buffer_result_t get_buffer_result;
     uint8_t *sample_buffer;
@@ -130,45 +142,80 @@ static void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     if (get_buffer_result == GET_BUFFER_ERROR) {
         audio_dma_stop(dma);
         dma->dma_result = AUDIO_DMA_SOURCE_ERROR;
-        return;
+        return false;
     }
 
-    // Convert the sample format resolution and signedness, as necessary.
-    // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
-    // The output buffer is one of the DMA buffers (passed in).
-
-    size_t output_length_used = audio_dma_convert_samples(
-        dma, sample_buffer, sample_buffer_length,
-        dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    if (dma->passthrough &&
+        ((size_t)sample_buffer) >= SRAM_BASE &&
+        ((size_t)sample_buffer) % dma->output_size == 0) {
+        // Play straight from the sample when it's in DMA-able RAM. It stays valid until the
+        // sample is asked for the block after next, by which time this one has played.
+        dma->block[buffer_idx] = sample_buffer;
+        dma->buffer_used[buffer_idx] = sample_buffer_length;
+    } else {
+        // Convert the sample format resolution and signedness, as necessary.
+        // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
+        // The output buffer is one of the DMA buffers.
+        dma->block[buffer_idx] = dma->buffer[buffer_idx];
+        dma->buffer_used[buffer_idx] = audio_dma_convert_samples(
+            dma, sample_buffer, sample_buffer_length,
+            dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    }
 
-    dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
-    dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
+    dma->fill_index = (buffer_idx + 1) % dma->buffer_count;
+    dma->free_count--;
+    dma->ready_count++;
 
     if (get_buffer_result == GET_BUFFER_DONE) {
         if (dma->loop) {
             audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
         } else {
-            // Set channel trigger to ourselves so we don't keep going.
-            dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
-            c->al1_ctrl =
-                (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
-                (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
-
-            if (output_length_used == 0 &&
-                !dma_channel_is_busy(dma->channel[0]) &&
-                !dma_channel_is_busy(dma->channel[1])) {
-                // No data has been read, and both DMA channels have now finished, so it's safe to stop.
-                audio_dma_stop(dma);
-                dma->dma_result = AUDIO_DMA_OK;
-                return;
-            }
+            dma->source_done = true;
         }
     }
+    dma->dma_result = AUDIO_DMA_OK;
+    return true;
+}
+
+// Points the DMA channel at the oldest converted buffer.
+static void audio_dma_queue_next_block(audio_dma_t *dma, size_t channel_idx) {
+    assert(dma->channel[channel_idx] < NUM_DMA_CHANNELS);
+    size_t dma_channel = dma->channel[channel_idx];
+    size_t buffer_idx = dma->play_index;
+
+    dma_channel_set_read_addr(dma_channel, dma->block[buffer_idx], false /* trigger */);
+    dma_channel_set_trans_count(dma_channel, dma->buffer_used[buffer_idx] / dma->output_size, false /* trigger */);
+
+    dma->play_index = (buffer_idx + 1) % dma->buffer_count;
+    dma->ready_count--;
+    dma->next_channel = !channel_idx;
+
+    if (dma->source_done && dma->ready_count == 0) {
+        // Set channel trigger to ourselves so we don't keep going after the last block.
+        dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
+        c->al1_ctrl =
+            (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
+            (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
+    }
+
     // Enable the channel so that it can be played.
     if (!dma->paused) {
         dma_hw->ch[dma_channel].al1_ctrl |= DMA_CH1_CTRL_TRIG_EN_BITS;
     }
-    dma->dma_result = AUDIO_DMA_OK;
+}
+
+static void audio_dma_free_buffer(audio_dma_t *dma, size_t buffer_idx) {
+    #ifdef PICO_RP2350
+    port_free(dma->buffer[buffer_idx]);
+    #else
+    #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
+    m_free(dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+    #else
+    m_free(dma->buffer[buffer_idx]);
+    #endif
+    #endif
+    dma->buffer[buffer_idx] = NULL;
+    dma->buffer_length[buffer_idx] = 0;
 }
 
 // Playback should be shutdown before calling this.
@@ -233,40 +280,40 @@ audio_dma_result audio_dma_setup_playback(
         max_buffer_length /= dma->sample_spacing;
     }
 
-    #ifdef PICO_RP2350
-    dma->buffer[0] = (uint8_t *)port_realloc(dma->buffer[0], max_buffer_length, true);
-    #else
-    dma->buffer[0] = (uint8_t *)m_realloc(dma->buffer[0],
-        #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-        dma->buffer_length[0], // Old size
-        #endif
-        max_buffer_length);
-    #endif
-    dma->buffer_length[0] = max_buffer_length;
-
-    if (dma->buffer[0] == NULL) {
-        return AUDIO_DMA_MEMORY_ERROR;
-    }
-
-    if (!single_buffer) {
+    // A single buffer is replayed by DMA chaining alone so it only needs one.
+    size_t buffer_count = single_buffer ? 1 : dma->requested_buffer_count;
+    for (size_t i = 0; i < AUDIO_DMA_MAX_BUFFERS; i++) {
+        if (i >= buffer_count) {
+            audio_dma_free_buffer(dma, i);
+            continue;
+        }
+        size_t length = max_buffer_length;
+        if (dma->buffer_length[i] == length) {
+            continue;
+        }
         #ifdef PICO_RP2350
-        dma->buffer[1] = (uint8_t *)port_realloc(dma->buffer[1], max_buffer_length, true);
+        dma->buffer[i] = (uint8_t *)port_realloc(dma->buffer[i], length, true);
         #else
-        dma->buffer[1] = (uint8_t *)m_realloc(dma->buffer[1],
+        dma->buffer[i] = (uint8_t *)m_realloc(dma->buffer[i],
             #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-            dma->buffer_length[1], // Old size
+            dma->buffer_length[i], // Old size
             #endif
-            max_buffer_length);
+            length);
         #endif
-        dma->buffer_length[1] = max_buffer_length;
+        dma->buffer_length[i] = length;
 
-        if (dma->buffer[1] == NULL) {
+        if (dma->buffer[i] == NULL) {
+            dma->buffer_length[i] = 0;
             return AUDIO_DMA_MEMORY_ERROR;
         }
     }
 
     dma->signed_to_unsigned = !output_signed && samples_signed;
     dma->unsigned_to_signed = output_signed && !samples_signed;
+    // Samples only keep the last two blocks they returned so any deeper ring has to copy.
+    dma->passthrough = !dma->signed_to_unsigned && !dma->unsigned_to_signed &&
+        dma->sample_spacing == 1 && dma->sample_resolution == dma->output_resolution &&
+        !swap_channel && buffer_count <= 2;
 
     if (output_resolution > 8) {
         dma->output_size = 2;
@@ -305,15 +352,27 @@ audio_dma_result audio_dma_setup_playback(
 
     dma->paused = false;
 
-    // Load the first two blocks up front.
-    audio_dma_load_next_block(dma, 0);
+    // Convert as many blocks as there are buffers up front and queue the first two.
+    dma->play_index = 0;
+    dma->fill_index = 0;
+    dma->ready_count = 0;
+    dma->buffer_count = buffer_count;
+    dma->free_count = buffer_count;
+    dma->source_done = false;
+    dma->underruns = 0;
+    dma->dma_result = AUDIO_DMA_OK;
+    while (audio_dma_fill_next_block(dma)) {
+    }
     if (dma->dma_result != AUDIO_DMA_OK) {
         return dma->dma_result;
     }
+    audio_dma_queue_next_block(dma, 0);
     if (!single_buffer) {
-        audio_dma_load_next_block(dma, 1);
-        if (dma->dma_result != AUDIO_DMA_OK) {
-            return dma->dma_result;
+        if (dma->ready_count > 0) {
+            audio_dma_queue_next_block(dma, 1);
+        } else {
+            // The whole sample fit in one block so don't let the first channel chain to the second.
+            dma_hw->ch[dma->channel[1]].al1_ctrl &= ~DMA_CH1_CTRL_TRIG_EN_BITS;
         }
     }
 
@@ -331,7 +390,7 @@ audio_dma_result audio_dma_setup_playback(
         channel_config_set_chain_to(&c, dma->channel[1]); // Chain to ourselves so we stop.
         dma_channel_configure(dma->channel[1], &c,
             &dma_hw->ch[dma->channel[0]].al3_read_addr_trig, // write address
-            &dma->buffer[0], // read address
+            &dma->block[0], // read address
             1, // transaction count
             false); // trigger
     } else {
@@ -446,11 +505,12 @@ void audio_dma_unpause_mask(uint32_t channel_mask) {
 }
 
 void audio_dma_init(audio_dma_t *dma) {
-    dma->buffer[0] = NULL;
-    dma->buffer[1] = NULL;
-
-    dma->buffer_length[0] = 0;
-    dma->buffer_length[1] = 0;
+    for (size_t i = 0; i < AUDIO_DMA_MAX_BUFFERS; i++) {
+        dma->buffer[i] = NULL;
+        dma->buffer_length[i] = 0;
+    }
+    dma->requested_buffer_count = AUDIO_DMA_MIN_BUFFERS;
+    dma->underruns = 0;
 
     dma->channel[0] = NUM_DMA_CHANNELS;
     dma->channel[1] = NUM_DMA_CHANNELS;
@@ -460,29 +520,21 @@ void audio_dma_init(audio_dma_t *dma) {
 }
 
 void audio_dma_deinit(audio_dma_t *dma) {
-    #ifdef PICO_RP2350
-    port_free(dma->buffer[0]);
-    #else
-    #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-    m_free(dma->buffer[0], dma->buffer_length[0]);
-    #else
-    m_free(dma->buffer[0]);
-    #endif
-    #endif
-    dma->buffer[0] = NULL;
-    dma->buffer_length[0] = 0;
+    for (size_t i = 0; i < AUDIO_DMA_MAX_BUFFERS; i++) {
+        audio_dma_free_buffer(dma, i);
+    }
+}
 
-    #ifdef PICO_RP2350
-    port_free(dma->buffer[1]);
-    #else
-    #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-    m_free(dma->buffer[1], dma->buffer_length[1]);
-    #else
-    m_free(dma->buffer[1]);
-    #endif
-    #endif
-    dma->buffer[1] = NULL;
-    dma->buffer_length[1] = 0;
+void audio_dma_set_buffer_count(audio_dma_t *dma, uint8_t buffer_count) {
+    dma->requested_buffer_count = buffer_count;
+}
+
+uint8_t audio_dma_get_buffer_count(audio_dma_t *dma) {
+    return dma->requested_buffer_count;
+}
+
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
 }
 
 bool audio_dma_get_playing(audio_dma_t *dma) {
@@ -510,25 +562,49 @@ static void dma_callback_fun(void *arg) {
     // dma_callback_fun and the above read of channels_to_load_mask.
     dma->channels_to_load_mask = 0;
     common_hal_mcu_enable_interrupts();
-
-    uint8_t first_filled_channel = NUM_DMA_CHANNELS;
-    size_t filled_count = 0;
-    if (dma->channel[0] != NUM_DMA_CHANNELS && (channels_to_load_mask & (1 << dma->channel[0]))) {
-        audio_dma_load_next_block(dma, 0);
-        first_filled_channel = dma->channel[0];
-        filled_count++;
+    #if CIRCUITPY_AUDIOCORE_STATS
+    if (channels_to_load_mask != 0) {
+        audiocore_stats_record_callback(dma->interrupt_us);
     }
-    if (dma->channel[1] != NUM_DMA_CHANNELS && (channels_to_load_mask & (1 << dma->channel[1]))) {
-        audio_dma_load_next_block(dma, 1);
-        first_filled_channel = dma->channel[1];
-        filled_count++;
+    #endif
+
+    // The channels finish in turn so requeue them in the same order.
+    while (dma->channel[0] != NUM_DMA_CHANNELS &&
+           (channels_to_load_mask & (1 << dma->channel[dma->next_channel]))) {
+        size_t channel_idx = dma->next_channel;
+        channels_to_load_mask &= ~(1 << dma->channel[channel_idx]);
+        // The buffer this channel played can be refilled.
+        dma->free_count++;
+        if (dma->ready_count == 0) {
+            audio_dma_fill_next_block(dma);
+            if (dma->channel[0] == NUM_DMA_CHANNELS) {
+                // Stopped because of a source error.
+                return;
+            }
+        }
+        if (dma->ready_count == 0) {
+            // Everything has been converted. Stop once the last block has played.
+            if (!dma_channel_is_busy(dma->channel[0]) && !dma_channel_is_busy(dma->channel[1])) {
+                audio_dma_stop(dma);
+                dma->dma_result = AUDIO_DMA_OK;
+                return;
+            }
+            dma->next_channel = !channel_idx;
+            continue;
+        }
+        audio_dma_queue_next_block(dma, channel_idx);
+
+        // If the other channel finished before this one was reloaded, its chain trigger was
+        // dropped because this channel was disabled, so start it by hand.
+        if (!dma->paused && !dma_channel_is_busy(dma->channel[!channel_idx])) {
+            dma_channel_start(dma->channel[channel_idx]);
+            dma->underruns++;
+            audiocore_stats_record_underrun();
+        }
     }
 
-    // Restart if the other channel has been queued while we were filling the first or we filled two
-    // now. (Two get filled if the second buffer completes while the first is waiting in the
-    // background task queue.)
-    if (first_filled_channel != NUM_DMA_CHANNELS && (dma->channels_to_load_mask != 0 || filled_count == 2)) {
-        dma_channel_start(first_filled_channel);
+    // Convert ahead now that the DMA has something to play.
+    while (audio_dma_fill_next_block(dma)) {
     }
 }
 
@@ -545,12 +621,17 @@ void __not_in_flash_func(isr_dma_0)(void) {
         dma_hw->ints0 = mask;
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
+            #if CIRCUITPY_AUDIOCORE_STATS
+            if (dma->channels_to_load_mask == 0) {
+                dma->interrupt_us = audiocore_stats_now_us();
+            }
+            #endif
             // Record all channels whose DMA has completed; they need loading.
             dma->channels_to_load_mask |= mask;
             // Disable the channel so that we don't play it without filling it.
             dma_hw->ch[i].al1_ctrl &= ~DMA_CH0_CTRL_TRIG_EN_BITS;
             // This is a noop if the callback is already queued.
-            background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
+            background_callback_add_with_priority(&dma->callback, dma_callback_fun, (void *)dma, BACKGROUND_CALLBACK_PRIORITY_HIGH);
         }
         if (MP_STATE_PORT(background_pio_read)[i] != NULL) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio_read)[i];
@@ -18,11 +18,31 @@ typedef enum {
     AUDIO_DMA_SOURCE_ERROR,
 } audio_dma_result;
 
+#define AUDIO_DMA_MIN_BUFFERS (2)
+#define AUDIO_DMA_MAX_BUFFERS (8)
+
 typedef struct {
     mp_obj_t sample;
-    uint8_t *buffer[2]; // Allocated through port_malloc on RP2350 so they are dma-able
-    size_t buffer_length[2];
+    uint8_t *buffer[AUDIO_DMA_MAX_BUFFERS]; // Allocated through port_malloc on RP2350 so they are dma-able
+    size_t buffer_length[AUDIO_DMA_MAX_BUFFERS];
+    // What the DMA reads for each entry of the ring: the buffer above or, when no conversion is
+    // needed, the sample's own buffer.
+    uint8_t *block[AUDIO_DMA_MAX_BUFFERS];
+    size_t buffer_used[AUDIO_DMA_MAX_BUFFERS]; // Bytes of block waiting to be played
+    // The buffers form a ring. The two oldest are queued on the DMA channels, followed by
+    // ready_count converted buffers and then free_count buffers waiting to be filled.
+    uint32_t underruns;
+    uint8_t requested_buffer_count; // Used by the next setup_playback.
+    uint8_t buffer_count; // In use by the current playback.
+    uint8_t play_index; // Next converted buffer to queue on a DMA channel.
+    uint8_t fill_index; // Next buffer to convert into.
+    uint8_t ready_count;
+    uint8_t free_count;
+    uint8_t next_channel; // Index into channel of the one that plays next when both are idle.
     uint32_t channels_to_load_mask;
+    #if CIRCUITPY_AUDIOCORE_STATS
+    uint32_t interrupt_us; // When channels_to_load_mask last became non-zero.
+    #endif
     uint32_t output_register_address;
     background_callback_t callback;
     uint8_t channel[2];
@@ -37,12 +57,20 @@ typedef struct {
     bool signed_to_unsigned;
     bool unsigned_to_signed;
     bool output_signed;
+    bool passthrough; // The sample is already in the output format.
+    bool source_done;
     bool playing_in_progress;
     bool paused;
     bool swap_channel;
 } audio_dma_t;
 
 void audio_dma_init(audio_dma_t *dma);
+// The number of buffers to convert ahead is used by the next setup_playback. More buffers let
+// samples with short buffers play without underruns at the cost of latency.
+void audio_dma_set_buffer_count(audio_dma_t *dma, uint8_t buffer_count);
+uint8_t audio_dma_get_buffer_count(audio_dma_t *dma);
+// The number of times playback restarted late because no converted buffer was ready in time.
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
 void audio_dma_deinit(audio_dma_t *dma);
 void audio_dma_reset(void);
 
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 #include "background.h"
 
+#include "core1_worker.h"
 #include "py/runtime.h"
 #include "supervisor/port.h"
 
@@ -18,4 +19,5 @@ void port_background_tick(void) {
 }
 
 void port_background_task(void) {
+    core1_worker_background();
 }
@@ -602,6 +602,79 @@ static mp_obj_t rp2pio_statemachine_background_write(size_t n_args, const mp_obj
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_background_write_obj, 1, rp2pio_statemachine_background_write);
 
+//|     def background_write_chain(
+//|         self,
+//|         buffers: Sequence[ReadableBuffer],
+//|         *,
+//|         repeats: Optional[Sequence[int]] = None,
+//|         loop: bool = False,
+//|         swap: bool = False,
+//|     ) -> None:
+//|         """Write a list of buffers to the TX fifo in the background, one after another.
+//|
+//|         The DMA moves from one buffer to the next by itself so the buffers can be scattered
+//|         through memory, such as the rows of a frame, without any CPU work between them.
+//|         Any background write in progress is stopped first. All buffers must have the same
+//|         element size.
+//|
+//|         :param ~Sequence[circuitpython_typing.ReadableBuffer] buffers: Data to be written in order
+//|         :param ~Optional[Sequence[int]] repeats: How many times in a row to write each buffer.
+//|             Defaults to once each.
+//|         :param bool loop: Start over from the first buffer after the last one, until
+//|             `stop_background_write` or another background write
+//|         :param bool swap: For 2- and 4-byte elements, swap (reverse) the byte order
+//|         """
+//|         ...
+//|
+static mp_obj_t rp2pio_statemachine_background_write_chain(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffers, ARG_repeats, ARG_loop, ARG_swap };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffers,  MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_repeats,  MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_loop,     MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_swap,     MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    rp2pio_statemachine_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    // Keep our own copy of the list so changes to the caller's don't free buffers in use.
+    mp_obj_t buffers_obj = mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_tuple), args[ARG_buffers].u_obj);
+    size_t count;
+    mp_obj_t *items;
+    mp_obj_tuple_get(buffers_obj, &count, &items);
+
+    size_t repeat_count = count;
+    mp_obj_t *repeat_items = NULL;
+    if (args[ARG_repeats].u_obj != mp_const_none) {
+        mp_obj_get_array(args[ARG_repeats].u_obj, &repeat_count, &repeat_items);
+    }
+    mp_arg_validate_length(repeat_count, count, MP_QSTR_repeats);
+
+    mp_buffer_info_t *buffers = m_new(mp_buffer_info_t, count);
+    mp_int_t *repeats = m_new(mp_int_t, count);
+    size_t stride_in_bytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        sm_buf_info info;
+        fill_buf_info(&info, items[i], &stride_in_bytes, MP_BUFFER_READ);
+        buffers[i] = info.info;
+        repeats[i] = repeat_items == NULL ? 1 : mp_arg_validate_int_min(mp_obj_get_int(repeat_items[i]), 1, MP_QSTR_repeats);
+    }
+
+    bool ok = stride_in_bytes == 0 ||
+        common_hal_rp2pio_statemachine_background_write_chain(self, buffers_obj, buffers, repeats, count,
+            args[ARG_loop].u_bool, stride_in_bytes, args[ARG_swap].u_bool);
+    m_del(mp_buffer_info_t, buffers, count);
+    m_del(mp_int_t, repeats, count);
+
+    if (!ok) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(rp2pio_statemachine_background_write_chain_obj, 2, rp2pio_statemachine_background_write_chain);
+
 //|     def stop_background_write(self) -> None:
 //|         """Immediately stop a background write, if one is in progress.  Any
 //|         DMA in progress is halted, but items already in the TX FIFO are not
@@ -1133,6 +1206,7 @@ static const mp_rom_map_elem_t rp2pio_statemachine_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&rp2pio_statemachine_write_readinto_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_background_write), MP_ROM_PTR(&rp2pio_statemachine_background_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_background_write_chain), MP_ROM_PTR(&rp2pio_statemachine_background_write_chain_obj) },
     { MP_ROM_QSTR(MP_QSTR_stop_background_write), MP_ROM_PTR(&rp2pio_statemachine_stop_background_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_writing), MP_ROM_PTR(&rp2pio_statemachine_writing_obj) },
     { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&rp2pio_statemachine_pending_write_obj) },
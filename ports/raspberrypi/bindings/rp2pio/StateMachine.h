@@ -55,6 +55,11 @@ bool common_hal_rp2pio_statemachine_write(rp2pio_statemachine_obj_t *self, const
 bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *self,
     uint8_t stride_in_bytes, bool swap);
 
+// buffers_obj is kept alive while the chain runs. Empty buffers are skipped.
+bool common_hal_rp2pio_statemachine_background_write_chain(rp2pio_statemachine_obj_t *self,
+    mp_obj_t buffers_obj, const mp_buffer_info_t *buffers, const mp_int_t *repeats, size_t count,
+    bool loop, uint8_t stride_in_bytes, bool swap);
+
 bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self,
     uint8_t stride_in_bytes, bool swap);
 
@@ -46,10 +46,36 @@ static mp_obj_t rp2pio_pins_are_sequential(mp_obj_t pins_obj) {
 
 static MP_DEFINE_CONST_FUN_OBJ_1(rp2pio_pins_are_sequential_obj, rp2pio_pins_are_sequential);
 
+//| def pio_usage() -> Tuple[Tuple[int, int, int], ...]:
+//|     """Return how much of each PIO block is in use, one entry per block. Each entry is
+//|     ``(used_instructions, largest_free_block, free_state_machines)``. A new program only
+//|     fits on a block whose ``largest_free_block`` is at least its length, unless an
+//|     identical program is already loaded there."""
+//|     ...
+//|
+//|
+static mp_obj_t rp2pio_pio_usage(void) {
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(NUM_PIOS, NULL));
+    for (size_t i = 0; i < NUM_PIOS; i++) {
+        size_t used_instructions, largest_free_block, free_state_machines;
+        common_hal_rp2pio_get_pio_usage(i, &used_instructions, &largest_free_block, &free_state_machines);
+        mp_obj_t items[3] = {
+            MP_OBJ_NEW_SMALL_INT(used_instructions),
+            MP_OBJ_NEW_SMALL_INT(largest_free_block),
+            MP_OBJ_NEW_SMALL_INT(free_state_machines),
+        };
+        result->items[i] = mp_obj_new_tuple(3, items);
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+
+static MP_DEFINE_CONST_FUN_OBJ_0(rp2pio_pio_usage_obj, rp2pio_pio_usage);
+
 static const mp_rom_map_elem_t rp2pio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_rp2pio) },
     { MP_ROM_QSTR(MP_QSTR_StateMachine),  MP_ROM_PTR(&rp2pio_statemachine_type) },
     { MP_ROM_QSTR(MP_QSTR_pins_are_sequential),  MP_ROM_PTR(&rp2pio_pins_are_sequential_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pio_usage),  MP_ROM_PTR(&rp2pio_pio_usage_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(rp2pio_module_globals, rp2pio_module_globals_table);
@@ -9,3 +9,4 @@
 #include "shared-bindings/microcontroller/Pin.h"
 
 bool common_hal_rp2pio_pins_are_sequential(size_t len, const mcu_pin_obj_t **pins);
+void common_hal_rp2pio_get_pio_usage(size_t pio_index, size_t *used_instructions, size_t *largest_free_block, size_t *free_state_machines);
@@ -11,6 +11,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared/runtime/interrupt_char.h"
 #include "py/runtime.h"
+#include "supervisor/port_heap.h"
 #include "hardware/adc.h"
 #include "hardware/dma.h"
 #include "pico/stdlib.h"
@@ -94,6 +95,8 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
     // Chain to adc channel
     channel_config_set_chain_to(&(self->cfg[1]), self->dma_chan[0]);
 
+    self->ring = NULL;
+
     // clear any previous activity
     adc_fifo_drain();
     adc_run(false);
@@ -108,6 +111,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    common_hal_analogbufio_bufferedin_stop_capture(self);
+
     // stop DMA
     dma_channel_abort(self->dma_chan[0]);
     dma_channel_abort(self->dma_chan[1]);
@@ -223,3 +228,127 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
 
     }
 }
+
+void common_hal_analogbufio_bufferedin_start_capture(analogbufio_bufferedin_obj_t *self, uint32_t buffer_size, uint16_t decimation) {
+    common_hal_analogbufio_bufferedin_stop_capture(self);
+    // Stop a previous readinto(loop=True).
+    adc_run(false);
+    dma_channel_abort(self->dma_chan[0]);
+    dma_channel_abort(self->dma_chan[1]);
+
+    self->ring_samples = buffer_size / sizeof(uint16_t);
+    self->ring = port_malloc(self->ring_samples * sizeof(uint16_t), true);
+    if (self->ring == NULL) {
+        m_malloc_fail(self->ring_samples * sizeof(uint16_t));
+    }
+    self->ring_start = (uint32_t)self->ring;
+    self->read_index = 0;
+    self->overruns = 0;
+    self->average_sum = 0;
+    self->average_count = 0;
+    self->decimation = decimation;
+    // 4095 * decimation * scale must stay below 1 << 32.
+    self->scale = (65535u << 16) / (4095u * decimation);
+
+    adc_fifo_drain();
+    adc_fifo_setup(
+        true,  // Write each completed conversion to the sample FIFO
+        true,  // Enable DMA data request (DREQ)
+        1,     // DREQ (and IRQ) asserted when at least 1 sample present
+        false, // Errors are rare enough to average in rather than drop
+        false  // Keep all 12 bits
+        );
+
+    channel_config_set_transfer_data_size(&(self->cfg[0]), DMA_SIZE_16);
+    channel_config_set_chain_to(&(self->cfg[0]), self->dma_chan[1]);
+    dma_channel_configure(self->dma_chan[0], &(self->cfg[0]),
+        self->ring,             // dst
+        &adc_hw->fifo,          // src
+        self->ring_samples,     // transfer count
+        false                   // don't start yet
+        );
+    // Writing the write address trigger register restarts channel 0 with its transfer count reloaded.
+    dma_channel_configure(self->dma_chan[1], &(self->cfg[1]),
+        &dma_hw->ch[self->dma_chan[0]].al2_write_addr_trig,
+        &self->ring_start,
+        1,
+        false
+        );
+
+    dma_channel_start(self->dma_chan[0]);
+    adc_run(true);
+}
+
+void common_hal_analogbufio_bufferedin_stop_capture(analogbufio_bufferedin_obj_t *self) {
+    if (self->ring == NULL) {
+        return;
+    }
+    adc_run(false);
+    // Unchain channel 0 first so finishing the ring can't restart channel 1.
+    hw_write_masked(&dma_hw->ch[self->dma_chan[0]].al1_ctrl,
+        self->dma_chan[0] << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB, DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_abort(self->dma_chan[0]);
+    dma_channel_abort(self->dma_chan[1]);
+    adc_fifo_drain();
+    port_free(self->ring);
+    self->ring = NULL;
+}
+
+bool common_hal_analogbufio_bufferedin_get_capturing(analogbufio_bufferedin_obj_t *self) {
+    return self->ring != NULL;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self) {
+    return self->overruns;
+}
+
+// Returns the number of conversions waiting in the ring and where the DMA will write next.
+static uint32_t ring_available(analogbufio_bufferedin_obj_t *self, uint32_t *write_index) {
+    // The write address is the end of the ring for the moment it takes channel 1 to reload it.
+    uint32_t index = ((uint32_t)dma_hw->ch[self->dma_chan[0]].write_addr - self->ring_start) / sizeof(uint16_t);
+    if (index >= self->ring_samples) {
+        index = 0;
+    }
+    *write_index = index;
+    return (index + self->ring_samples - self->read_index) % self->ring_samples;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_available(analogbufio_bufferedin_obj_t *self) {
+    uint32_t write_index;
+    return (ring_available(self, &write_index) + self->average_count) / self->decimation;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_read_capture(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    uint32_t write_index;
+    uint32_t available = ring_available(self, &write_index);
+    // The DMA can't be told to stop at the read position so a ring that is nearly full may already
+    // have been lapped. Keep only the newest half rather than return data that may be overwritten.
+    if (available > self->ring_samples - self->ring_samples / 8) {
+        self->overruns++;
+        self->read_index = (write_index + self->ring_samples / 2) % self->ring_samples;
+        self->average_sum = 0;
+        self->average_count = 0;
+    }
+
+    uint32_t sample_count = len / bytes_per_sample;
+    uint32_t captured_count = 0;
+    while (captured_count < sample_count && self->read_index != write_index) {
+        self->average_sum += self->ring[self->read_index] & 0xfff;
+        if (++self->read_index == self->ring_samples) {
+            self->read_index = 0;
+        }
+        if (++self->average_count < self->decimation) {
+            continue;
+        }
+        uint16_t value = (self->average_sum * self->scale) >> 16;
+        if (bytes_per_sample == 2) {
+            ((uint16_t *)buffer)[captured_count] = value;
+        } else {
+            buffer[captured_count] = value >> 8;
+        }
+        captured_count++;
+        self->average_sum = 0;
+        self->average_count = 0;
+    }
+    return captured_count;
+}
@@ -19,4 +19,17 @@ typedef struct {
     uint8_t chan;
     uint dma_chan[2];
     dma_channel_config cfg[2];
+
+    // Background capture into a ring of raw 12-bit conversions.
+    uint16_t *ring; // NULL when not capturing.
+    uint32_t ring_start; // Read by the control DMA channel to restart the data channel.
+    uint32_t ring_samples;
+    uint32_t read_index;
+    uint32_t overruns;
+    // Each output sample is the average of `decimation` conversions. A partial average is kept
+    // between reads so no conversions are lost.
+    uint32_t average_sum;
+    uint16_t average_count;
+    uint16_t decimation;
+    uint32_t scale; // Maps average_sum to 16 bits in 16.16 fixed point.
 } analogbufio_bufferedin_obj_t;
@@ -326,6 +326,19 @@ bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
 
+uint8_t common_hal_audiobusio_i2sout_get_buffer_count(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_buffer_count(&self->dma);
+}
+
+void common_hal_audiobusio_i2sout_set_buffer_count(audiobusio_i2sout_obj_t *self, uint8_t buffer_count) {
+    mp_arg_validate_int_range(buffer_count, AUDIO_DMA_MIN_BUFFERS, AUDIO_DMA_MAX_BUFFERS, MP_QSTR_buffer_count);
+    audio_dma_set_buffer_count(&self->dma, buffer_count);
+}
+
+uint32_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
+
 void common_hal_audiobusio_i2sout_stop(audiobusio_i2sout_obj_t *self) {
     audio_dma_stop(&self->dma);
 
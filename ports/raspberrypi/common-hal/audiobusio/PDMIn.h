@@ -12,6 +12,19 @@
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
 
+#define PDMIN_CIC_ORDER (3)
+#define PDMIN_FIR_TAPS (32)
+
+typedef struct {
+    uint32_t integrator[PDMIN_CIC_ORDER];
+    uint32_t comb[PDMIN_CIC_ORDER];
+    // Twice as long as the filter so the taps can always be read from one contiguous run.
+    int16_t history[2 * PDMIN_FIR_TAPS];
+    uint8_t history_index;
+    uint8_t nibble_count;
+    bool odd;
+} audiobusio_pdmin_decimator_t;
+
 typedef struct {
     mp_obj_base_t base;
     uint32_t sample_rate;
@@ -19,7 +32,21 @@ typedef struct {
     uint8_t clock_unit;
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
+    uint8_t oversample;
     rp2pio_statemachine_obj_t state_machine;
+
+    // Background capture
+    uint32_t *ring; // Raw PDM words written by DMA. NULL when not capturing.
+    uint32_t ring_start; // Read by the control channel to restart the data channel.
+    uint32_t ring_words;
+    uint32_t read_index;
+    uint32_t overruns;
+    int data_channel;
+    int control_channel;
+    uint8_t cic_decimation; // PDM nibbles per CIC output
+    uint32_t cic_full_scale;
+    uint32_t cic_scale;
+    audiobusio_pdmin_decimator_t decimator;
 } audiobusio_pdmin_obj_t;
 
 void pdmin_reset(void);
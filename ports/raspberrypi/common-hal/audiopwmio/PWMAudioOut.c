@@ -259,3 +259,16 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
+
+uint8_t common_hal_audiopwmio_pwmaudioout_get_buffer_count(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_buffer_count(&self->dma);
+}
+
+void common_hal_audiopwmio_pwmaudioout_set_buffer_count(audiopwmio_pwmaudioout_obj_t *self, uint8_t buffer_count) {
+    mp_arg_validate_int_range(buffer_count, AUDIO_DMA_MIN_BUFFERS, AUDIO_DMA_MAX_BUFFERS, MP_QSTR_buffer_count);
+    audio_dma_set_buffer_count(&self->dma, buffer_count);
+}
+
+uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
@@ -14,6 +14,7 @@
 #include "shared-bindings/bitbangio/I2C.h"
 
 #include "hardware/gpio.h"
+#include "hardware/timer.h"
 
 // Synopsys  DW_apb_i2c  (v2.01)  IP
 
@@ -144,8 +145,75 @@ void common_hal_busio_i2c_unlock(busio_i2c_obj_t *self) {
     self->has_lock = false;
 }
 
-static uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
-    const uint8_t *data, size_t len, bool transmit_stop_bit) {
+// The controller's TX and RX FIFOs are this many entries deep.
+#define FIFO_DEPTH (16)
+
+// The pico-sdk calls wait for each byte before queueing the next command, which leaves the bus
+// idle between bytes. Keeping the TX FIFO full of commands instead runs the bus back to back.
+// out_data is written, then in_data is read after a repeated start, all in one transaction that
+// ends with a stop.
+static uint8_t _transfer(busio_i2c_obj_t *self, uint16_t addr,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len) {
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+    // Forget any stop or abort left from an earlier transfer.
+    (void)hw->clr_intr;
+
+    const size_t total = out_len + in_len;
+    size_t sent = 0;
+    size_t received = 0;
+    uint8_t status = 0;
+    const uint64_t deadline = time_us_64() + BUS_TIMEOUT_US;
+    while (sent < total || received < in_len) {
+        // Don't queue more reads than the RX FIFO can hold.
+        while (sent < total && i2c_get_write_available(self->peripheral) > 0 &&
+               (sent < out_len || sent - out_len - received < FIFO_DEPTH)) {
+            uint32_t cmd;
+            if (sent < out_len) {
+                cmd = out_data[sent];
+            } else {
+                cmd = I2C_IC_DATA_CMD_CMD_BITS;
+                if (sent == out_len && out_len > 0) {
+                    cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+                }
+            }
+            if (sent == total - 1) {
+                cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+            }
+            hw->data_cmd = cmd;
+            sent++;
+        }
+        while (received < in_len && i2c_get_read_available(self->peripheral) > 0) {
+            in_data[received++] = (uint8_t)hw->data_cmd;
+        }
+        if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+            break;
+        }
+        if (time_us_64() > deadline) {
+            return MP_ETIMEDOUT;
+        }
+    }
+
+    // Wait for the stop, which the controller also sends after an abort.
+    while ((hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) == 0) {
+        if (time_us_64() > deadline) {
+            return MP_ETIMEDOUT;
+        }
+    }
+    (void)hw->clr_stop_det;
+
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        uint32_t abort_source = hw->tx_abrt_source;
+        (void)hw->clr_tx_abrt;
+        status = (abort_source & I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS) != 0 ? MP_ENODEV : MP_EIO;
+    }
+    return status;
+}
+
+uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
+    const uint8_t *data, size_t len) {
     if (len == 0) {
         // The RP2040 I2C peripheral will not perform 0 byte writes.
         // So use bitbangio.I2C to do the write.
@@ -158,7 +226,7 @@ static uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
         gpio_put(self->sda_pin, false);
 
         uint8_t status = shared_module_bitbangio_i2c_write(&self->bitbangio_i2c,
-            addr, data, len, transmit_stop_bit);
+            addr, data, len, true);
 
         // The pins must be set back to GPIO_FUNC_I2C in the order given here,
         // SCL first, otherwise reads will hang.
@@ -168,49 +236,23 @@ static uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
         return status;
     }
 
-    size_t result = i2c_write_timeout_us(self->peripheral, addr, data, len, !transmit_stop_bit, BUS_TIMEOUT_US);
-    if (result == len) {
-        return 0;
-    }
-    switch (result) {
-        case PICO_ERROR_GENERIC:
-            return MP_ENODEV;
-        case PICO_ERROR_TIMEOUT:
-            return MP_ETIMEDOUT;
-        default:
-            return MP_EIO;
-    }
-}
-
-uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
-    const uint8_t *data, size_t len) {
-    return _common_hal_busio_i2c_write(self, addr, data, len, true);
+    return _transfer(self, addr, data, len, NULL, 0);
 }
 
 uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr,
     uint8_t *data, size_t len) {
-    size_t result = i2c_read_timeout_us(self->peripheral, addr, data, len, false, BUS_TIMEOUT_US);
-    if (result == len) {
+    if (len == 0) {
         return 0;
     }
-    switch (result) {
-        case PICO_ERROR_GENERIC:
-            return MP_ENODEV;
-        case PICO_ERROR_TIMEOUT:
-            return MP_ETIMEDOUT;
-        default:
-            return MP_EIO;
-    }
+    return _transfer(self, addr, NULL, 0, data, len);
 }
 
 uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t addr,
     uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len) {
-    uint8_t result = _common_hal_busio_i2c_write(self, addr, out_data, out_len, false);
-    if (result != 0) {
-        return result;
+    if (in_len == 0) {
+        return common_hal_busio_i2c_write(self, addr, out_data, out_len);
     }
-
-    return common_hal_busio_i2c_read(self, addr, in_data, in_len);
+    return _transfer(self, addr, out_data, out_len, in_data, in_len);
 }
 
 void common_hal_busio_i2c_never_reset(busio_i2c_obj_t *self) {
@@ -10,12 +10,15 @@
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/board.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
 #include "hardware/dma.h"
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 
 #define NO_INSTANCE 0xff
 
@@ -77,6 +80,9 @@ void common_hal_busio_spi_construct(busio_spi_obj_t *self,
 
     self->target_frequency = 250000;
     self->real_frequency = spi_init(self->peripheral, self->target_frequency);
+    self->write_in_progress = false;
+    self->tx_dma_channel = -1;
+    self->rx_dma_channel = -1;
 
     gpio_set_function(clock->number, GPIO_FUNC_SPI);
     claim_pin(clock);
@@ -111,6 +117,15 @@ void common_hal_busio_spi_deinit(busio_spi_obj_t *self) {
     if (common_hal_busio_spi_deinited(self)) {
         return;
     }
+    common_hal_busio_spi_finish_write(self);
+    if (self->tx_dma_channel >= 0) {
+        dma_channel_unclaim(self->tx_dma_channel);
+        self->tx_dma_channel = -1;
+    }
+    if (self->rx_dma_channel >= 0) {
+        dma_channel_unclaim(self->rx_dma_channel);
+        self->rx_dma_channel = -1;
+    }
     never_reset_spi[spi_get_index(self->peripheral)] = false;
     spi_deinit(self->peripheral);
 
@@ -129,6 +144,8 @@ bool common_hal_busio_spi_configure(busio_spi_obj_t *self,
         return true;
     }
 
+    common_hal_busio_spi_finish_write(self);
+
     spi_set_format(self->peripheral, bits, polarity, phase, SPI_MSB_FIRST);
 
     // Workaround to start with clock line high if polarity=1. The hw SPI peripheral does not do this
@@ -169,20 +186,56 @@ void common_hal_busio_spi_unlock(busio_spi_obj_t *self) {
     self->has_lock = false;
 }
 
+// Keep the channels once claimed so that each transfer only needs to reconfigure them.
+static void _claim_dma(busio_spi_obj_t *self) {
+    if (self->tx_dma_channel < 0) {
+        self->tx_dma_channel = dma_claim_unused_channel(false);
+    }
+    if (self->rx_dma_channel < 0) {
+        self->rx_dma_channel = dma_claim_unused_channel(false);
+    }
+}
+
+static void _wait_for_dma(uint channel) {
+    // isr_dma_0 is part of audio_dma.c. With it, sleep until the channel's completion interrupt
+    // instead of spinning. The interrupt is acknowledged there without any other effect.
+    #if CIRCUITPY_AUDIOCORE
+    dma_hw->inte0 |= 1u << channel;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    #endif
+    while (dma_channel_is_busy(channel)) {
+        RUN_BACKGROUND_TASKS;
+        #if CIRCUITPY_AUDIOCORE
+        // A pending interrupt still ends WFI with interrupts disabled, so checking first can't
+        // miss the completion.
+        uint32_t state = save_and_disable_interrupts();
+        if (dma_channel_is_busy(channel) && !background_callback_pending()) {
+            __wfi();
+        }
+        restore_interrupts(state);
+        #endif
+    }
+    #if CIRCUITPY_AUDIOCORE
+    dma_hw->inte0 &= ~(1u << channel);
+    #endif
+}
+
 static bool _transfer(busio_spi_obj_t *self,
     const uint8_t *data_out, size_t out_len,
     uint8_t *data_in, size_t in_len) {
+    // Don't interleave with a background write.
+    common_hal_busio_spi_finish_write(self);
+
     // Use DMA for large transfers if channels are available
     const size_t dma_min_size_threshold = 32;
-    int chan_tx = -1;
-    int chan_rx = -1;
     size_t len = MAX(out_len, in_len);
     if (len >= dma_min_size_threshold) {
         // Use two DMA channels to service the two FIFOs
-        chan_tx = dma_claim_unused_channel(false);
-        chan_rx = dma_claim_unused_channel(false);
+        _claim_dma(self);
     }
-    bool use_dma = chan_rx >= 0 && chan_tx >= 0;
+    int chan_tx = self->tx_dma_channel;
+    int chan_rx = self->rx_dma_channel;
+    bool use_dma = len >= dma_min_size_threshold && chan_rx >= 0 && chan_tx >= 0;
     if (use_dma) {
         dma_channel_config c = dma_channel_get_default_config(chan_tx);
         channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
@@ -207,21 +260,12 @@ static bool _transfer(busio_spi_obj_t *self,
             false);
 
         dma_start_channel_mask((1u << chan_rx) | (1u << chan_tx));
-        while (dma_channel_is_busy(chan_rx) || dma_channel_is_busy(chan_tx)) {
-            // TODO: We should idle here until we get a DMA interrupt or something else.
-            RUN_BACKGROUND_TASKS;
+        // The last byte is received after the last one is sent, so RX finishes last.
+        _wait_for_dma(chan_rx);
+        while (dma_channel_is_busy(chan_tx)) {
         }
     }
 
-    // If we have claimed only one channel successfully, we should release immediately. This also
-    // releases the DMA after use_dma has been done.
-    if (chan_rx >= 0) {
-        dma_channel_unclaim(chan_rx);
-    }
-    if (chan_tx >= 0) {
-        dma_channel_unclaim(chan_tx);
-    }
-
     if (!use_dma) {
         // Use software for small transfers, or if couldn't claim two DMA channels
         // Never have more transfers in flight than will fit into the RX FIFO,
@@ -259,6 +303,50 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     return _transfer(self, data, len, (uint8_t *)&data_in, MIN(len, 4));
 }
 
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self,
+    const uint8_t *data, size_t len) {
+    common_hal_busio_spi_finish_write(self);
+    _claim_dma(self);
+    int chan_tx = self->tx_dma_channel;
+    if (chan_tx < 0) {
+        return false;
+    }
+    // Only TX is serviced by DMA. Incoming bytes overrun the RX FIFO and are
+    // discarded; common_hal_busio_spi_finish_write cleans up after them.
+    dma_channel_config c = dma_channel_get_default_config(chan_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(self->peripheral) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(chan_tx, &c,
+        &spi_get_hw(self->peripheral)->dr,
+        data,
+        len,
+        true);
+    self->write_in_progress = true;
+    return true;
+}
+
+void common_hal_busio_spi_finish_write(busio_spi_obj_t *self) {
+    if (!self->write_in_progress) {
+        return;
+    }
+    _wait_for_dma(self->tx_dma_channel);
+    // DMA is done once the last byte is in the FIFO. Wait for it to be shifted out.
+    while (spi_is_busy(self->peripheral)) {
+    }
+    while (spi_is_readable(self->peripheral)) {
+        (void)spi_get_hw(self->peripheral)->dr;
+    }
+    spi_get_hw(self->peripheral)->icr = SPI_SSPICR_RORIC_BITS;
+    self->write_in_progress = false;
+}
+
+bool common_hal_busio_spi_get_write_in_progress(busio_spi_obj_t *self) {
+    return self->write_in_progress &&
+           (dma_channel_is_busy(self->tx_dma_channel) || spi_is_busy(self->peripheral));
+}
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
     uint8_t *data, size_t len, uint8_t write_value) {
     uint32_t data_out = write_value << 24 | write_value << 16 | write_value << 8 | write_value;
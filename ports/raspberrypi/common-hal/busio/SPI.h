@@ -24,6 +24,11 @@ typedef struct {
     uint8_t polarity;
     uint8_t phase;
     uint8_t bits;
+    // Claimed by the first DMA transfer and kept until deinit. -1 when not claimed.
+    int8_t tx_dma_channel;
+    int8_t rx_dma_channel;
+    // True while common_hal_busio_spi_start_write's DMA may still be running.
+    bool write_in_progress;
 } busio_spi_obj_t;
 
 void reset_spi(void);
@@ -80,14 +80,71 @@ static uint8_t pin_init(const uint8_t uart, const mcu_pin_obj_t *pin, const uint
 
 static busio_uart_obj_t *active_uarts[NUM_UARTS];
 
-static void _copy_into_ringbuf(ringbuf_t *r, uart_inst_t *uart) {
-    while (uart_is_readable(uart) && ringbuf_num_empty(r) > 0) {
-        ringbuf_put(r, (uint8_t)uart_get_hw(uart)->dr);
+// The RX interrupt fires once the 32 byte FIFO is half full, so at least this many bytes are waiting.
+#define RX_FIFO_THRESHOLD (16)
+
+static void _copy_into_ringbuf(busio_uart_obj_t *self, size_t max_count) {
+    uint8_t bytes[32];
+    size_t count = 0;
+    size_t space = MIN(ringbuf_num_empty(&self->ringbuf), MIN(max_count, sizeof(bytes)));
+    while (count < space && uart_is_readable(self->uart)) {
+        bytes[count++] = (uint8_t)uart_get_hw(self->uart)->dr;
     }
+    ringbuf_put_n(&self->ringbuf, bytes, count);
+    self->open_frame_len += count;
+    // Nothing will interrupt for the bytes left behind, so the reader has to pick them up.
+    self->rx_stalled = ringbuf_num_empty(&self->ringbuf) == 0 && uart_is_readable(self->uart);
+}
+
+// Called with the UART irq disabled from everything but the irq itself.
+static void _end_frame(busio_uart_obj_t *self) {
+    if (self->open_frame_len == 0) {
+        return;
+    }
+    if (self->frame_count == UART_MAX_FRAMES) {
+        // Out of slots so merge it into the newest frame.
+        self->frame_lengths[(self->frame_first + self->frame_count - 1) % UART_MAX_FRAMES] += self->open_frame_len;
+    } else {
+        self->frame_lengths[(self->frame_first + self->frame_count) % UART_MAX_FRAMES] = self->open_frame_len;
+        self->frame_count++;
+    }
+    self->open_frame_len = 0;
+}
+
+// Keeps the frame lengths in step with count bytes taken out of the ringbuf.
+static void _consume_frames(busio_uart_obj_t *self, size_t count) {
+    while (count > 0 && self->frame_count > 0) {
+        uint16_t *frame_len = &self->frame_lengths[self->frame_first];
+        size_t taken = MIN(count, *frame_len);
+        *frame_len -= taken;
+        count -= taken;
+        if (*frame_len == 0) {
+            self->frame_first = (self->frame_first + 1) % UART_MAX_FRAMES;
+            self->frame_count--;
+        }
+    }
+    self->open_frame_len -= MIN(count, self->open_frame_len);
+}
+
+static size_t _get_from_ringbuf(busio_uart_obj_t *self, uint8_t *data, size_t len) {
+    size_t count = ringbuf_get_n(&self->ringbuf, data, len);
+    _consume_frames(self, count);
+    if (self->rx_stalled) {
+        _copy_into_ringbuf(self, SIZE_MAX);
+    }
+    return count;
 }
 
 static void shared_callback(busio_uart_obj_t *self) {
-    _copy_into_ringbuf(&self->ringbuf, self->uart);
+    if (uart_get_hw(self->uart)->mis & UART_UARTMIS_RTMIS_BITS) {
+        // The receive timeout only fires once the line has been idle for 32 bit periods with data
+        // left in the FIFO, which is the end of a frame.
+        _copy_into_ringbuf(self, SIZE_MAX);
+        _end_frame(self);
+    } else {
+        // Leave a byte in the FIFO so the receive timeout still fires when the line goes idle.
+        _copy_into_ringbuf(self, RX_FIFO_THRESHOLD - 1);
+    }
     // We always clear the interrupt so it doesn't continue to fire because we
     // may not have read everything available.
     uart_get_hw(self->uart)->icr = UART_UARTICR_RXIC_BITS | UART_UARTICR_RTIC_BITS;
@@ -157,6 +214,10 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     self->uart_id = uart_id;
     self->baudrate = baudrate;
     self->timeout_ms = timeout * 1000;
+    self->rx_stalled = false;
+    self->open_frame_len = 0;
+    self->frame_first = 0;
+    self->frame_count = 0;
 
     uart_init(self->uart, self->baudrate);
     uart_set_fifo_enabled(self->uart, true);
@@ -185,6 +246,9 @@ void common_hal_busio_uart_construct(busio_uart_obj_t *self,
     }
     irq_set_enabled(self->uart_irq_id, true);
     uart_set_irq_enables(self->uart, true /* rx has data */, false /* tx needs data */);
+    // The SDK interrupts every 4 bytes. Half full still leaves plenty of room at high baudrates
+    // and the receive timeout picks up the tail of each frame.
+    hw_write_masked(&uart_get_hw(self->uart)->ifls, 2 << UART_UARTIFLS_RXIFLSEL_LSB, UART_UARTIFLS_RXIFLSEL_BITS);
 }
 
 bool common_hal_busio_uart_deinited(busio_uart_obj_t *self) {
@@ -252,43 +316,29 @@ size_t common_hal_busio_uart_read(busio_uart_obj_t *self, uint8_t *data, size_t
 
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
-
     // Copy as much received data as available, up to len bytes.
-    size_t total_read = ringbuf_get_n(&self->ringbuf, data, len);
-
-    // Check if we still need to read more data.
-    if (len > total_read) {
-        len -= total_read;
-        uint64_t start_ticks = supervisor_ticks_ms64();
-        // Busy-wait until timeout or until we've read enough chars.
-        while (len > 0 && (supervisor_ticks_ms64() - start_ticks < self->timeout_ms)) {
-            if (uart_is_readable(self->uart)) {
-                // Read and advance.
-                data[total_read] = uart_get_hw(self->uart)->dr;
-
-                // Adjust the counters.
-                len--;
-                total_read++;
-
-                // Reset the timeout on every character read.
-                start_ticks = supervisor_ticks_ms64();
-            }
-            RUN_BACKGROUND_TASKS;
-            // Allow user to break out of a timeout with a KeyboardInterrupt.
-            if (mp_hal_is_interrupted()) {
-                break;
-            }
+    size_t total_read = _get_from_ringbuf(self, data, len);
+    irq_set_enabled(self->uart_irq_id, true);
+
+    // Wait for the irq to bring in the rest. Reading the FIFO directly would hide the end of
+    // the frame from the receive timeout.
+    uint64_t start_ticks = supervisor_ticks_ms64();
+    while (total_read < len && (supervisor_ticks_ms64() - start_ticks < self->timeout_ms)) {
+        RUN_BACKGROUND_TASKS;
+        // Allow user to break out of a timeout with a KeyboardInterrupt.
+        if (mp_hal_is_interrupted()) {
+            break;
+        }
+        irq_set_enabled(self->uart_irq_id, false);
+        size_t count = _get_from_ringbuf(self, data + total_read, len - total_read);
+        irq_set_enabled(self->uart_irq_id, true);
+        if (count > 0) {
+            total_read += count;
+            // Reset the timeout on every character read.
+            start_ticks = supervisor_ticks_ms64();
         }
     }
 
-    // Now that we've emptied the ringbuf some, fill it up with anything in the
-    // FIFO. This ensures that we'll empty the FIFO as much as possible and
-    // reset the interrupt when we catch up.
-    _copy_into_ringbuf(&self->ringbuf, self->uart);
-
-    // Re-enable irq.
-    irq_set_enabled(self->uart_irq_id, true);
-
     if (total_read == 0) {
         *errcode = EAGAIN;
         return MP_STREAM_ERROR;
@@ -317,9 +367,11 @@ void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t timeou
 uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
-    // The UART only interrupts after a threshold so make sure to copy anything
-    // out of its FIFO before measuring how many bytes we've received.
-    _copy_into_ringbuf(&self->ringbuf, self->uart);
+    // Bytes below the FIFO threshold arrive with the receive timeout. Only pick
+    // them up here when a full ringbuf has stopped the irq from doing so.
+    if (self->rx_stalled) {
+        _copy_into_ringbuf(self, SIZE_MAX);
+    }
     irq_set_enabled(self->uart_irq_id, true);
     return ringbuf_num_filled(&self->ringbuf);
 }
@@ -328,6 +380,10 @@ void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
     // Prevent conflict with uart irq.
     irq_set_enabled(self->uart_irq_id, false);
     ringbuf_clear(&self->ringbuf);
+    self->rx_stalled = false;
+    self->open_frame_len = 0;
+    self->frame_first = 0;
+    self->frame_count = 0;
 
     // Throw away the FIFO contents too.
     while (uart_is_readable(self->uart)) {
@@ -336,6 +392,29 @@ void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
     irq_set_enabled(self->uart_irq_id, true);
 }
 
+bool common_hal_busio_uart_readinto_frame(busio_uart_obj_t *self, uint8_t *data, size_t len, size_t *frame_len) {
+    if (self->rx_pin == NO_PIN) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("No %q pin"), MP_QSTR_rx);
+    }
+    irq_set_enabled(self->uart_irq_id, false);
+    if (self->frame_count == 0) {
+        irq_set_enabled(self->uart_irq_id, true);
+        return false;
+    }
+    size_t full_len = self->frame_lengths[self->frame_first];
+    *frame_len = ringbuf_get_n(&self->ringbuf, data, MIN(len, full_len));
+    // Drop whatever doesn't fit so the next call starts on a frame boundary.
+    for (size_t i = *frame_len; i < full_len; i++) {
+        ringbuf_get(&self->ringbuf);
+    }
+    _consume_frames(self, full_len);
+    if (self->rx_stalled) {
+        _copy_into_ringbuf(self, SIZE_MAX);
+    }
+    irq_set_enabled(self->uart_irq_id, true);
+    return true;
+}
+
 bool common_hal_busio_uart_ready_to_tx(busio_uart_obj_t *self) {
     if (self->tx_pin == NO_PIN) {
         return false;
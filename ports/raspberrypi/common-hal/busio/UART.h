@@ -11,6 +11,9 @@
 
 #include "hardware/uart.h"
 
+// Complete frames whose boundaries are remembered. Older ones merge once it fills up.
+#define UART_MAX_FRAMES (8)
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t tx_pin;
@@ -25,6 +28,13 @@ typedef struct {
     uint32_t timeout_ms;
     uart_inst_t *uart;
     ringbuf_t ringbuf;
+    // Set when the ringbuf filled up with bytes still in the FIFO.
+    bool rx_stalled;
+    // Bytes in the ringbuf since the last idle line.
+    uint16_t open_frame_len;
+    uint8_t frame_first;
+    uint8_t frame_count;
+    uint16_t frame_lengths[UART_MAX_FRAMES];
 } busio_uart_obj_t;
 
 extern void reset_uart(void);
@@ -9,9 +9,19 @@
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/floppyio/__init__.h"
 #include "common-hal/floppyio/__init__.h"
+#include "shared-module/floppyio/__init__.h"
 #include "shared-bindings/time/__init__.h"
 #include "supervisor/shared/tick.h"
 
+#include "hardware/dma.h"
+
+// Room for 512 pulses, about a millisecond of flux at the shortest MFM pulse length.
+#define FLOPPYIO_RING_BITS (10)
+#define FLOPPYIO_RING_WORDS ((1u << FLOPPYIO_RING_BITS) / sizeof(uint32_t))
+// Far more words than a revolution holds, while staying clear of the RP2350's transfer count
+// mode bits.
+#define FLOPPYIO_DMA_COUNT (0x0fffffff)
+
 static const uint16_t fluxread_program[] = {
     // ; Count flux pulses and watch for index pin
     // ; flux input is the 'jmp pin'.  index is "pin zero".
@@ -70,18 +80,10 @@ static uint16_t read_fifo(floppy_reader *reader) {
 }
 
 
-int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms) {
-#define READ_INDEX() (!!(*index_port & index_mask))
-    uint32_t index_mask;
-    volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
-
-    memset(buf, 0, len);
-
-
+static void construct_fluxread(rp2pio_statemachine_obj_t *state_machine, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index) {
     pio_pinmask_t pins_we_use = PIO_PINMASK_FROM_PIN(data->pin->number);
 
-    rp2pio_statemachine_obj_t state_machine;
-    bool ok = rp2pio_statemachine_construct(&state_machine,
+    bool ok = rp2pio_statemachine_construct(state_machine,
         fluxread_program, MP_ARRAY_SIZE(fluxread_program),
         FLOPPYIO_SAMPLERATE * 3, // 3 PIO cycles per sample count
         NULL, 0, // init program
@@ -107,38 +109,66 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
     if (!ok) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("All state machines in use"));
     }
+}
 
-    floppy_reader reader = { .pio = state_machine.pio, .sm = state_machine.state_machine, };
-
-    uint8_t *ptr = buf, *end = ptr + len;
-
+// Waits for flux to arrive and then for the start of the index pulse, with interrupts disabled.
+static void wait_for_index(rp2pio_statemachine_obj_t *state_machine, volatile uint32_t *index_port, uint32_t index_mask, mp_int_t index_wait_ms) {
+    PIO pio = state_machine->pio;
+    uint sm = state_machine->state_machine;
     uint64_t index_deadline_us = time_us_64() + index_wait_ms * 1000;
 
-    common_hal_mcu_disable_interrupts();
-
     // check if flux is arriving
     uint64_t flux_deadline_us = time_us_64() + 20;
-    while (pio_sm_is_rx_fifo_empty(reader.pio, reader.sm)) {
+    while (pio_sm_is_rx_fifo_empty(pio, sm)) {
         if (time_us_64() > flux_deadline_us) {
             common_hal_mcu_enable_interrupts();
-            common_hal_rp2pio_statemachine_deinit(&state_machine);
+            common_hal_rp2pio_statemachine_deinit(state_machine);
             mp_raise_RuntimeError(MP_ERROR_TEXT("timeout waiting for flux"));
         }
     }
 
     // wait for index pulse low
-    while (READ_INDEX()) {
+    while (*index_port & index_mask) {
         if (time_us_64() > index_deadline_us) {
             common_hal_mcu_enable_interrupts();
-            common_hal_rp2pio_statemachine_deinit(&state_machine);
+            common_hal_rp2pio_statemachine_deinit(state_machine);
             mp_raise_RuntimeError(MP_ERROR_TEXT("timeout waiting for index pulse"));
         }
     }
 
-    pio_sm_clear_fifos(reader.pio, reader.sm);
+    pio_sm_clear_fifos(pio, sm);
+}
+
+// Turns two successive counter values into a pulse length, in samples.
+static uint8_t flux_delta(int last, int timestamp) {
+    int delta = last - timestamp;
+    if (delta < 0) {
+        delta += 65536;
+    }
+    delta /= 2;
+    return delta > 255 ? 255 : delta;
+}
+
+int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms) {
+#define READ_INDEX() (!!(*index_port & index_mask))
+    uint32_t index_mask;
+    volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
+
+    memset(buf, 0, len);
+
+    rp2pio_statemachine_obj_t state_machine;
+    construct_fluxread(&state_machine, data, index);
+
+    floppy_reader reader = { .pio = state_machine.pio, .sm = state_machine.state_machine, };
+
+    uint8_t *ptr = buf, *end = ptr + len;
+
+    common_hal_mcu_disable_interrupts();
+
+    wait_for_index(&state_machine, index_port, index_mask, index_wait_ms);
 
     // if another index doesn't show up ...
-    index_deadline_us = time_us_64() + index_wait_ms * 1000;
+    uint64_t index_deadline_us = time_us_64() + index_wait_ms * 1000;
 
     int last = read_fifo(&reader);
     bool last_index = READ_INDEX();
@@ -161,14 +191,8 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
         }
 
         int timestamp = read_fifo(&reader);
-        int delta = last - timestamp;
-        if (delta < 0) {
-            delta += 65536;
-        }
-        delta /= 2;
-
+        *ptr++ = flux_delta(last, timestamp);
         last = timestamp;
-        *ptr++ = delta > 255 ? 255 : delta;
     }
 
     common_hal_mcu_enable_interrupts();
@@ -176,3 +200,88 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
 
     return ptr - (uint8_t *)buf;
 }
+
+int common_hal_floppyio_mfm_track_readinto(const mp_buffer_info_t *buf, uint8_t *validity, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms, size_t t2_max, size_t t3_max) {
+    uint32_t index_mask;
+    volatile uint32_t *index_port = common_hal_digitalio_digitalinout_get_reg(index, DIGITALINOUT_REG_READ, &index_mask);
+
+    floppyio_mfm_decoder_t decoder;
+    floppyio_mfm_decoder_init(&decoder, buf->buf, validity, buf->len / 512, t2_max, t3_max);
+    if (decoder.n_valid == decoder.n_sectors) {
+        return decoder.n_valid;
+    }
+
+    // DMA keeps capturing into this ring while the CPU decodes, so a slow byte or an interrupt
+    // only uses up some slack instead of losing flux.
+    uint32_t ring[FLOPPYIO_RING_WORDS] __attribute__((aligned(FLOPPYIO_RING_WORDS * sizeof(uint32_t))));
+
+    rp2pio_statemachine_obj_t state_machine;
+    construct_fluxread(&state_machine, data, index);
+    PIO pio = state_machine.pio;
+    uint sm = state_machine.state_machine;
+
+    common_hal_mcu_disable_interrupts();
+    wait_for_index(&state_machine, index_port, index_mask, index_wait_ms);
+
+    int dma_channel = dma_claim_unused_channel(false);
+    if (dma_channel < 0) {
+        common_hal_mcu_enable_interrupts();
+        common_hal_rp2pio_statemachine_deinit(&state_machine);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All dma channels in use"));
+    }
+    dma_channel_config c = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, FLOPPYIO_RING_BITS);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    dma_channel_configure(dma_channel, &c, ring, &pio->rxf[sm], FLOPPYIO_DMA_COUNT, true);
+    common_hal_mcu_enable_interrupts();
+
+    // if another index doesn't show up ...
+    uint64_t index_deadline_us = time_us_64() + index_wait_ms * 1000;
+
+    uint32_t consumed = 0;
+    bool have_last = false;
+    int last = 0;
+    bool last_index = READ_INDEX();
+    // Stop after one revolution, or sooner once every sector has been read.
+    while (decoder.n_valid < decoder.n_sectors) {
+        bool now_index = READ_INDEX();
+        if (!now_index && last_index) {
+            break;
+        }
+        last_index = now_index;
+
+        uint32_t written = FLOPPYIO_DMA_COUNT - dma_channel_hw_addr(dma_channel)->transfer_count;
+        if (written == consumed) {
+            if (time_us_64() > index_deadline_us) {
+                break;
+            }
+            continue;
+        }
+        if (written - consumed > FLOPPYIO_RING_WORDS) {
+            // The ring has been overwritten, so drop what was in it and find the next sector.
+            floppyio_mfm_decoder_resync(&decoder);
+            consumed = written;
+            have_last = false;
+            continue;
+        }
+
+        uint32_t value = ring[consumed % FLOPPYIO_RING_WORDS];
+        consumed++;
+        int timestamp = value & 0xffff;
+        if (have_last) {
+            floppyio_mfm_decoder_feed(&decoder, flux_delta(last, timestamp));
+        }
+        last = value >> 16;
+        floppyio_mfm_decoder_feed(&decoder, flux_delta(timestamp, last));
+        have_last = true;
+    }
+
+    dma_channel_abort(dma_channel);
+    dma_channel_unclaim(dma_channel);
+    common_hal_rp2pio_statemachine_deinit(&state_machine);
+
+    return decoder.n_valid;
+}
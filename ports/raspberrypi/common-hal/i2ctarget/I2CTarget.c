@@ -15,13 +15,73 @@
 #include "py/runtime.h"
 
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
 
 static i2c_inst_t *i2c[2] = {i2c0, i2c1};
+static i2ctarget_i2c_target_obj_t *register_targets[2];
 
 #define NO_PIN 0xff
 
+static void finish_change(i2ctarget_i2c_target_obj_t *self) {
+    if (self->change_length == 0) {
+        return;
+    }
+    uint8_t next_head = (self->change_head + 1) % I2CTARGET_CHANGE_QUEUE_LEN;
+    // Changes are dropped when Python falls this far behind.
+    if (next_head != self->change_tail) {
+        self->changes[self->change_head].start = self->change_start;
+        self->changes[self->change_head].length = MIN(self->change_length, self->register_count);
+        self->change_head = next_head;
+    }
+    self->change_length = 0;
+}
+
+// Serves the register map without any help from the VM. The first byte of each write sets the
+// register pointer, and every byte read or written after that moves it on by one.
+static void register_target_irq(i2ctarget_i2c_target_obj_t *self) {
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        hw->clr_tx_abrt;
+    }
+    // Drain received bytes before looking at the end of the transaction they belong to.
+    while (hw->rxflr > 0) {
+        uint32_t data_cmd = hw->data_cmd;
+        uint8_t data = data_cmd & I2C_IC_DATA_CMD_DAT_BITS;
+        if (data_cmd & I2C_IC_DATA_CMD_FIRST_DATA_BYTE_BITS) {
+            finish_change(self);
+            self->register_pointer = data % self->register_count;
+            self->change_start = self->register_pointer;
+        } else {
+            self->registers[self->register_pointer] = data;
+            self->register_pointer = (self->register_pointer + 1) % self->register_count;
+            self->change_length++;
+        }
+    }
+    if (status & I2C_IC_INTR_STAT_R_RD_REQ_BITS) {
+        hw->data_cmd = self->registers[self->register_pointer];
+        self->register_pointer = (self->register_pointer + 1) % self->register_count;
+        hw->clr_rd_req;
+    }
+    if (status & (I2C_IC_INTR_STAT_R_STOP_DET_BITS | I2C_IC_INTR_STAT_R_RESTART_DET_BITS)) {
+        hw->clr_stop_det;
+        hw->clr_restart_det;
+        finish_change(self);
+    }
+}
+
+static void i2c0_register_target_irq(void) {
+    register_target_irq(register_targets[0]);
+}
+
+static void i2c1_register_target_irq(void) {
+    register_target_irq(register_targets[1]);
+}
+
 void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self, const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
-    uint8_t *addresses, unsigned int num_addresses, bool smbus) {
+    uint8_t *addresses, unsigned int num_addresses, bool smbus,
+    uint8_t *registers, size_t register_count) {
     self->peripheral = NULL;
 
     // I2C pins have a regular pattern. SCL is always odd and SDA is even. They match up in pairs
@@ -46,6 +106,12 @@ void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
 
     self->addresses = addresses;
     self->num_addresses = num_addresses;
+    self->registers = registers;
+    self->register_count = register_count;
+    self->register_pointer = 0;
+    self->change_length = 0;
+    self->change_head = 0;
+    self->change_tail = 0;
     self->scl_pin = scl->number;
     self->sda_pin = sda->number;
 
@@ -62,6 +128,21 @@ void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
     self->peripheral->hw->intr_mask |= I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
     i2c_set_slave_mode(self->peripheral, true, self->addresses[0]);
 
+    if (self->registers != NULL) {
+        // Interrupt once per received byte so the register pointer is always current.
+        self->peripheral->hw->rx_tl = 0;
+        self->peripheral->hw->intr_mask = I2C_IC_INTR_MASK_M_RX_FULL_BITS |
+            I2C_IC_INTR_MASK_M_RD_REQ_BITS |
+            I2C_IC_INTR_MASK_M_TX_ABRT_BITS |
+            I2C_IC_INTR_MASK_M_STOP_DET_BITS |
+            I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
+        size_t index = i2c_hw_index(self->peripheral);
+        register_targets[index] = self;
+        uint irq = I2C0_IRQ + index;
+        irq_set_exclusive_handler(irq, index == 0 ? i2c0_register_target_irq : i2c1_register_target_irq);
+        irq_set_enabled(irq, true);
+    }
+
     return;
 }
 
@@ -74,6 +155,15 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
         return;
     }
 
+    if (self->registers != NULL) {
+        size_t index = i2c_hw_index(self->peripheral);
+        uint irq = I2C0_IRQ + index;
+        irq_set_enabled(irq, false);
+        irq_remove_handler(irq, index == 0 ? i2c0_register_target_irq : i2c1_register_target_irq);
+        register_targets[index] = NULL;
+        self->registers = NULL;
+    }
+
     i2c_deinit(self->peripheral);
 
     reset_pin_number(self->sda_pin);
@@ -85,6 +175,10 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
 }
 
 int common_hal_i2ctarget_i2c_target_is_addressed(i2ctarget_i2c_target_obj_t *self, uint8_t *address, bool *is_read, bool *is_restart) {
+    if (self->registers != NULL) {
+        // The interrupt handler answers every request itself.
+        return -MP_EBUSY;
+    }
     if (!((self->peripheral->hw->raw_intr_stat & I2C_IC_INTR_STAT_R_RX_FULL_BITS) || (self->peripheral->hw->raw_intr_stat & I2C_IC_INTR_STAT_R_RD_REQ_BITS))) {
         return 0;
     }
@@ -130,3 +224,13 @@ void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool
 void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self) {
     return;
 }
+
+bool common_hal_i2ctarget_i2c_target_get_change(i2ctarget_i2c_target_obj_t *self, uint8_t *start, uint16_t *length) {
+    if (self->change_tail == self->change_head) {
+        return false;
+    }
+    *start = self->changes[self->change_tail].start;
+    *length = self->changes[self->change_tail].length;
+    self->change_tail = (self->change_tail + 1) % I2CTARGET_CHANGE_QUEUE_LEN;
+    return true;
+}
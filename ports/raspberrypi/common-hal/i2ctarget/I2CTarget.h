@@ -10,6 +10,13 @@
 #include "common-hal/microcontroller/Pin.h"
 #include "hardware/i2c.h"
 
+#define I2CTARGET_CHANGE_QUEUE_LEN (16)
+
+typedef struct {
+    uint8_t start;
+    uint16_t length;
+} i2ctarget_change_t;
+
 typedef struct {
     mp_obj_base_t base;
 
@@ -18,6 +25,18 @@ typedef struct {
 
     i2c_inst_t *peripheral;
 
+    // Register map serviced by the interrupt handler, or NULL when Python handles requests.
+    uint8_t *registers;
+    uint16_t register_count;
+    uint8_t register_pointer;
+    // Registers written so far in the current transaction, starting at change_start.
+    uint8_t change_start;
+    uint16_t change_length;
+    // Written by the interrupt handler at change_head and read by Python at change_tail.
+    i2ctarget_change_t changes[I2CTARGET_CHANGE_QUEUE_LEN];
+    volatile uint8_t change_head;
+    volatile uint8_t change_tail;
+
     uint8_t scl_pin;
     uint8_t sda_pin;
 } i2ctarget_i2c_target_obj_t;
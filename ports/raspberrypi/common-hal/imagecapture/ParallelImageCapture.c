@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/obj.h"
 #include "py/runtime.h"
 
@@ -105,12 +107,15 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
         PIO_ANY_OFFSET,
         PIO_FIFO_TYPE_DEFAULT,
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    self->buffer1 = MP_OBJ_NULL;
+    self->buffer2 = MP_OBJ_NULL;
 }
 
 void common_hal_imagecapture_parallelimagecapture_deinit(imagecapture_parallelimagecapture_obj_t *self) {
     if (common_hal_imagecapture_parallelimagecapture_deinited(self)) {
         return;
     }
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
     return common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 }
 
@@ -118,10 +123,8 @@ bool common_hal_imagecapture_parallelimagecapture_deinited(imagecapture_parallel
     return common_hal_rp2pio_statemachine_deinited(&self->state_machine);
 }
 
-void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
-
+// Start over at the wait for the next frame.
+static void restart_program(imagecapture_parallelimagecapture_obj_t *self) {
     PIO pio = self->state_machine.pio;
     uint sm = self->state_machine.state_machine;
     uint8_t offset = rp2pio_statemachine_program_offset(&self->state_machine);
@@ -132,8 +135,76 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
     pio_sm_restart(pio, sm);
     pio_sm_exec(pio, sm, pio_encode_jmp(offset));
     pio_sm_set_enabled(pio, sm, true);
+}
+
+void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
+
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    restart_program(self);
 
     common_hal_rp2pio_statemachine_readinto(&self->state_machine, bufinfo.buf, bufinfo.len, 4, false);
 
     pio_sm_set_enabled(pio, sm, false);
 }
+
+// Each buffer holds exactly one frame. The state machine is restarted as each one fills so the
+// next frame starts at VSYNC even if the camera sends more data than fits.
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer1, mp_obj_t buffer2) {
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+
+    rp2pio_statemachine_obj_t *state_machine = &self->state_machine;
+    memset(&state_machine->once_read_buf_info, 0, sizeof(state_machine->once_read_buf_info));
+    state_machine->loop_read_buf_info.obj = buffer1;
+    mp_get_buffer_raise(buffer1, &state_machine->loop_read_buf_info.info, MP_BUFFER_RW);
+    state_machine->loop2_read_buf_info.obj = buffer2;
+    mp_get_buffer_raise(buffer2, &state_machine->loop2_read_buf_info.info, MP_BUFFER_RW);
+
+    restart_program(self);
+    state_machine->restart_after_read = true;
+    if (!common_hal_rp2pio_statemachine_background_read(state_machine, 4, false)) {
+        state_machine->restart_after_read = false;
+        pio_sm_set_enabled(state_machine->pio, state_machine->state_machine, false);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All dma channels in use"));
+    }
+    self->buffer1 = buffer1;
+    self->buffer2 = buffer2;
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == MP_OBJ_NULL) {
+        return;
+    }
+    rp2pio_statemachine_obj_t *state_machine = &self->state_machine;
+    common_hal_rp2pio_statemachine_stop_background_read(state_machine);
+    state_machine->restart_after_read = false;
+    pio_sm_set_enabled(state_machine->pio, state_machine->state_machine, false);
+    self->buffer1 = MP_OBJ_NULL;
+    self->buffer2 = MP_OBJ_NULL;
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q not in use"), MP_QSTR_continuous_capture_start);
+    }
+    rp2pio_statemachine_obj_t *state_machine = &self->state_machine;
+    // Wait for a frame to finish. It stays untouched until the one after it finishes too.
+    while (!state_machine->switched_read_buffers) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+    }
+    common_hal_mcu_disable_interrupts();
+    state_machine->switched_read_buffers = false;
+    void *filling = state_machine->current_read_buf.info.buf;
+    common_hal_mcu_enable_interrupts();
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->buffer1, &bufinfo, MP_BUFFER_READ);
+    return filling == bufinfo.buf ? self->buffer2 : self->buffer1;
+}
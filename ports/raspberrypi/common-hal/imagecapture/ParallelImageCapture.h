@@ -12,4 +12,6 @@
 struct imagecapture_parallelimagecapture_obj {
     mp_obj_base_t base;
     rp2pio_statemachine_obj_t state_machine;
+    // Set during continuous capture.
+    mp_obj_t buffer1, buffer2;
 };
@@ -0,0 +1,200 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+
+#include "common-hal/keypad/KeyMatrix.h"
+#include "common-hal/microcontroller/Pin.h"
+#include "supervisor/port_heap.h"
+
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+
+// Each PIO cycle takes 1us and a row takes 13 cycles, so a 16 row matrix is scanned at almost 5kHz
+// while the CPU only debounces the latest results every interval.
+#define KEYPAD_PIO_FREQUENCY (1000000)
+// Extra cycles for the columns to settle after a row is driven.
+#define KEYPAD_PIO_SETTLE_CYCLES (2)
+
+static keypad_keymatrix_pio_t *keymatrix_pios[NUM_PIOS * NUM_PIO_STATE_MACHINES];
+
+static bool pins_are_consecutive(mp_uint_t num_pins, const mcu_pin_obj_t *pins[]) {
+    for (size_t i = 1; i < num_pins; i++) {
+        if (pins[i]->number != pins[0]->number + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Y holds a one-hot row mask. Driving a row only changes its direction because every row pin's
+// output level is already set to the driven level. Rows past num_rows land outside the out pins so
+// every pass pushes padded_rows samples, which keeps the DMA ring lined up with the rows.
+static void build_program(uint16_t *p, uint8_t num_rows, uint8_t padded_rows, uint8_t num_columns) {
+    p[0] = pio_encode_set(pio_y, 1);
+    p[1] = pio_encode_set(pio_x, padded_rows - 1);
+    // Drive the row and sample the columns.
+    p[2] = pio_encode_mov(pio_osr, pio_y);
+    p[3] = pio_encode_out(pio_pindirs, num_rows) | pio_encode_delay(KEYPAD_PIO_SETTLE_CYCLES);
+    p[4] = pio_encode_in(pio_pins, num_columns);
+    p[5] = pio_encode_push(false, true);
+    // Release the row.
+    p[6] = pio_encode_mov(pio_osr, pio_null);
+    p[7] = pio_encode_out(pio_pindirs, num_rows);
+    // Move on to the next row by shifting Y left through the ISR.
+    p[8] = pio_encode_mov(pio_isr, pio_y);
+    p[9] = pio_encode_in(pio_null, 1);
+    p[10] = pio_encode_mov(pio_y, pio_isr);
+    p[11] = pio_encode_mov(pio_isr, pio_null);
+    p[12] = pio_encode_jmp_x_dec(2);
+}
+
+static void release(keypad_keymatrix_pio_t *pio) {
+    dma_channel_abort(pio->dma_channel);
+    dma_channel_unclaim(pio->dma_channel);
+    rp2pio_statemachine_deinit(&pio->state_machine, false);
+    for (size_t i = 0; i < MP_ARRAY_SIZE(keymatrix_pios); i++) {
+        if (keymatrix_pios[i] == pio) {
+            keymatrix_pios[i] = NULL;
+        }
+    }
+    port_free(pio);
+}
+
+bool keypad_keymatrix_pio_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, const mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, const mcu_pin_obj_t *column_pins[]) {
+    // The state machine needs each set of pins to be one contiguous range.
+    if (num_row_pins == 0 || num_row_pins > KEYPAD_PIO_MAX_PINS ||
+        num_column_pins == 0 || num_column_pins > KEYPAD_PIO_MAX_PINS ||
+        !pins_are_consecutive(num_row_pins, row_pins) ||
+        !pins_are_consecutive(num_column_pins, column_pins)) {
+        return false;
+    }
+    size_t slot = 0;
+    while (slot < MP_ARRAY_SIZE(keymatrix_pios) && keymatrix_pios[slot] != NULL) {
+        slot++;
+    }
+    if (slot == MP_ARRAY_SIZE(keymatrix_pios)) {
+        return false;
+    }
+
+    keypad_keymatrix_pio_t *pio = port_malloc(sizeof(keypad_keymatrix_pio_t), true);
+    if (pio == NULL) {
+        return false;
+    }
+    pio->dma_channel = dma_claim_unused_channel(false);
+    if (pio->dma_channel < 0) {
+        port_free(pio);
+        return false;
+    }
+
+    uint8_t ring_bits = 2;
+    while ((1u << (ring_bits - 2)) < num_row_pins) {
+        ring_bits++;
+    }
+    const uint8_t padded_rows = 1u << (ring_bits - 2);
+    const uintptr_t ring_size = 1u << ring_bits;
+    pio->samples = (volatile uint32_t *)(((uintptr_t)pio->sample_storage + ring_size - 1) & ~(ring_size - 1));
+    // Start out with nothing pressed.
+    for (size_t row = 0; row < padded_rows; row++) {
+        pio->samples[row] = self->columns_to_anodes ? UINT32_MAX : 0;
+    }
+
+    build_program(pio->program, num_row_pins, padded_rows, num_column_pins);
+
+    pio_pinmask_t rows = PIO_PINMASK_NONE;
+    for (size_t i = 0; i < num_row_pins; i++) {
+        PIO_PINMASK_SET(rows, row_pins[i]->number);
+    }
+    pio_pinmask_t columns = PIO_PINMASK_NONE;
+    for (size_t i = 0; i < num_column_pins; i++) {
+        PIO_PINMASK_SET(columns, column_pins[i]->number);
+    }
+    pio_pinmask_t all_pins = PIO_PINMASK_OR(rows, columns);
+
+    bool ok = rp2pio_statemachine_construct(&pio->state_machine,
+        pio->program, KEYPAD_PIO_PROGRAM_LEN,
+        KEYPAD_PIO_FREQUENCY,
+        NULL, 0, // init
+        row_pins[0], num_row_pins, // out pins
+        column_pins[0], num_column_pins, // in pins
+        self->columns_to_anodes ? all_pins : PIO_PINMASK_NONE, // pull up
+        self->columns_to_anodes ? PIO_PINMASK_NONE : all_pins, // pull down
+        NULL, 0, // set pins
+        NULL, 0, false, // sideset pins
+        self->columns_to_anodes ? PIO_PINMASK_NONE : rows, PIO_PINMASK_NONE, // initial pin state and direction
+        NULL, // jmp pin
+        all_pins, false, true,
+        false, 32, false, // autopull
+        false, // wait for txstall
+        false, 32, false, // autopush
+        true, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        0, -1, // wrap
+        PIO_ANY_OFFSET,
+        PIO_FIFO_JOIN_RX,
+        PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    if (!ok) {
+        dma_channel_unclaim(pio->dma_channel);
+        port_free(pio);
+        return false;
+    }
+
+    PIO hw = pio->state_machine.pio;
+    uint sm = pio->state_machine.state_machine;
+    dma_channel_config c = dma_channel_get_default_config(pio->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_bits);
+    channel_config_set_dreq(&c, pio_get_dreq(hw, sm, false));
+    // The top bits make this endless on RP2350. RP2040 runs for days and then gets restarted by
+    // keypad_keymatrix_pio_get_samples().
+    dma_channel_configure(pio->dma_channel, &c, pio->samples, &hw->rxf[sm], UINT32_MAX, true);
+
+    pio->keymatrix = self;
+    keymatrix_pios[slot] = pio;
+    self->pio = pio;
+    return true;
+}
+
+void keypad_keymatrix_pio_deinit(keypad_keymatrix_obj_t *self) {
+    release(self->pio);
+    self->pio = NULL;
+}
+
+const volatile uint32_t *keypad_keymatrix_pio_get_samples(keypad_keymatrix_obj_t *self) {
+    keypad_keymatrix_pio_t *pio = self->pio;
+    if (!dma_channel_is_busy(pio->dma_channel)) {
+        // The write address has wrapped to where the next sample belongs, so keep going from there.
+        dma_channel_set_trans_count(pio->dma_channel, UINT32_MAX, true);
+    }
+    return pio->samples;
+}
+
+void keypad_keymatrix_pio_reset(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(keymatrix_pios); i++) {
+        keypad_keymatrix_pio_t *pio = keymatrix_pios[i];
+        if (pio == NULL) {
+            continue;
+        }
+        if (pio->keymatrix->never_reset) {
+            rp2pio_statemachine_never_reset(pio->state_machine.pio, pio->state_machine.state_machine);
+            mp_obj_tuple_t *row_pins = pio->keymatrix->row_digitalinouts;
+            for (size_t row = 0; row < row_pins->len; row++) {
+                never_reset_pin_number(((const mcu_pin_obj_t *)row_pins->items[row])->number);
+            }
+            mp_obj_tuple_t *column_pins = pio->keymatrix->column_digitalinouts;
+            for (size_t column = 0; column < column_pins->len; column++) {
+                never_reset_pin_number(((const mcu_pin_obj_t *)column_pins->items[column])->number);
+            }
+        } else {
+            release(pio);
+        }
+    }
+}
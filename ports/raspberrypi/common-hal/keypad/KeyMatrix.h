@@ -0,0 +1,26 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/rp2pio/StateMachine.h"
+#include "shared-module/keypad/KeyMatrix.h"
+
+#define KEYPAD_PIO_MAX_PINS (32)
+#define KEYPAD_PIO_PROGRAM_LEN (13)
+
+typedef struct _keypad_keymatrix_pio_t {
+    rp2pio_statemachine_obj_t state_machine;
+    keypad_keymatrix_obj_t *keymatrix;
+    // Points into sample_storage, aligned so the DMA can wrap around it.
+    volatile uint32_t *samples;
+    int dma_channel;
+    uint16_t program[KEYPAD_PIO_PROGRAM_LEN];
+    // Twice the largest ring so there is always room to align it.
+    uint32_t sample_storage[2 * KEYPAD_PIO_MAX_PINS];
+} keypad_keymatrix_pio_t;
+
+void keypad_keymatrix_pio_reset(void);
@@ -11,8 +11,12 @@
 
 #include "py/runtime.h"
 
+#include "hardware/dma.h"
 #include "hardware/regs/addressmap.h"
 
+// Transfers at least this long are done by DMA when a channel is free.
+#define DMA_MIN_LEN (64)
+
 // RP2 address map ranges, must be arranged in order by ascending start address
 #ifdef PICO_RP2040
 addressmap_rp2_range_t rp2_ranges[] = {
@@ -137,3 +141,88 @@ void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_ob
             break;
     }
 }
+
+static bool dma_transfer(volatile void *dest, const volatile void *src, size_t len, size_t width,
+    bool read_increment, bool write_increment) {
+    // DMA ignores the low address bits, so both ends must be aligned to the access width.
+    if (len < DMA_MIN_LEN || (((size_t)dest | (size_t)src) & (width - 1))) {
+        return false;
+    }
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        return false;
+    }
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, width == 4 ? DMA_SIZE_32 : width == 2 ? DMA_SIZE_16 : DMA_SIZE_8);
+    channel_config_set_read_increment(&c, read_increment);
+    channel_config_set_write_increment(&c, write_increment);
+    dma_channel_configure(channel, &c, dest, src, len / width, true);
+    dma_channel_wait_for_finish_blocking(channel);
+    dma_channel_unclaim(channel);
+    return true;
+}
+
+static void check_access(const memorymap_addressrange_obj_t *self, const uint8_t *address, size_t width) {
+    if ((size_t)address & (width - 1) || (self->type == IO && width != 4)) {
+        // The CPU and DMA only make accesses aligned to their width, and IO registers only
+        // take 32-bit ones.
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to access unaligned IO register"));
+    }
+}
+
+void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, uint8_t *values, size_t len, size_t width, bool increment) {
+    const volatile uint8_t *src_addr = self->start_address + start_index;
+    check_access(self, (const uint8_t *)src_addr, width);
+    if (dma_transfer(values, src_addr, len, width, increment, true)) {
+        return;
+    }
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    for (size_t i = 0; i < len; i += width) {
+        const volatile uint8_t *a = increment ? src_addr + i : src_addr;
+        uint32_t word = width == 4 ? *(const volatile uint32_t *)a : width == 2 ? *(const volatile uint16_t *)a : *a;
+        memcpy(values + i, &word, width);
+    }
+    #pragma GCC diagnostic pop
+}
+
+void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, const uint8_t *values, size_t len, size_t width, bool increment) {
+    if (self->type == XIP || self->type == ROM) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Unable to write to read-only memory"));
+    }
+    volatile uint8_t *dest_addr = self->start_address + start_index;
+    check_access(self, (const uint8_t *)dest_addr, width);
+    if (dma_transfer(dest_addr, values, len, width, true, increment)) {
+        return;
+    }
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    for (size_t i = 0; i < len; i += width) {
+        volatile uint8_t *a = increment ? dest_addr + i : dest_addr;
+        uint32_t word = 0;
+        memcpy(&word, values + i, width);
+        if (width == 4) {
+            *(volatile uint32_t *)a = word;
+        } else if (width == 2) {
+            *(volatile uint16_t *)a = word;
+        } else {
+            *a = word;
+        }
+    }
+    #pragma GCC diagnostic pop
+}
+
+uint8_t *common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self, bool writable) {
+    switch (self->type) {
+        case SRAM:
+            return self->start_address;
+        case XIP:
+        case ROM:
+            return writable ? NULL : self->start_address;
+        case IO:
+            break;
+    }
+    return NULL;
+}
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/neopixel_write/__init__.h"
 
 #include "bindings/rp2pio/StateMachine.h"
@@ -13,6 +15,8 @@
 
 #include "supervisor/port.h"
 
+#include "hardware/pio_instructions.h"
+
 uint64_t next_start_raw_ticks = 0;
 
 // NeoPixels are 800khz bit streams. We are choosing zeros as <312ns hi, 936 lo> and ones
@@ -85,3 +89,110 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     // Update the next start to +2 ticks. This ensures we give it at least 300us.
     next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
 }
+
+// One bit for every strip per sample. At 8MHz each bit is 10 cycles: 3 high, 3 high only for ones
+// and 4 low, counting the out that stalls low while waiting for data.
+static void build_parallel_program(uint16_t *p, uint8_t sample_bits) {
+    p[0] = pio_encode_out(pio_x, sample_bits);
+    p[1] = pio_encode_mov_not(pio_pins, pio_null) | pio_encode_delay(2);
+    p[2] = pio_encode_mov(pio_pins, pio_x) | pio_encode_delay(2);
+    p[3] = pio_encode_mov(pio_pins, pio_null) | pio_encode_delay(2);
+}
+
+// One program per sample size so identical ones are shared between state machines.
+static uint16_t parallel_programs[3][4];
+
+void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, const mp_buffer_info_t *bufs, size_t count) {
+    const mcu_pin_obj_t *first_pin = digitalinouts[0]->pin;
+    pio_pinmask_t pins_we_use = PIO_PINMASK_NONE;
+    size_t max_len = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (digitalinouts[i]->pin->number != first_pin->number + i) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Pins must be sequential GPIO pins"));
+        }
+        PIO_PINMASK_SET(pins_we_use, digitalinouts[i]->pin->number);
+        max_len = MAX(max_len, bufs[i].len);
+    }
+    if (max_len == 0) {
+        return;
+    }
+
+    size_t program_index = count <= 8 ? 0 : (count <= 16 ? 1 : 2);
+    uint8_t sample_bytes = 1 << program_index;
+    uint16_t *program = parallel_programs[program_index];
+    build_parallel_program(program, sample_bytes * 8);
+
+    // Transpose the strips so every sample carries the same bit of each of them, msb first.
+    size_t num_samples = max_len * 8;
+    uint8_t *samples = m_malloc(num_samples * sample_bytes);
+    memset(samples, 0, num_samples * sample_bytes);
+    for (size_t k = 0; k < max_len; k++) {
+        uint32_t lanes[8] = {0};
+        for (size_t i = 0; i < count; i++) {
+            if (k >= bufs[i].len) {
+                continue;
+            }
+            uint8_t value = ((const uint8_t *)bufs[i].buf)[k];
+            for (size_t bit = 0; bit < 8; bit++) {
+                lanes[bit] |= ((value >> (7 - bit)) & 1) << i;
+            }
+        }
+        for (size_t bit = 0; bit < 8; bit++) {
+            size_t sample = k * 8 + bit;
+            if (sample_bytes == 1) {
+                samples[sample] = lanes[bit];
+            } else if (sample_bytes == 2) {
+                ((uint16_t *)samples)[sample] = lanes[bit];
+            } else {
+                ((uint32_t *)samples)[sample] = lanes[bit];
+            }
+        }
+    }
+
+    rp2pio_statemachine_obj_t state_machine;
+    bool ok = rp2pio_statemachine_construct(&state_machine,
+        program, MP_ARRAY_SIZE(parallel_programs[0]),
+        8000000,
+        NULL, 0, // init program
+        first_pin, count, // out
+        NULL, 1, // in
+        PIO_PINMASK_NONE, PIO_PINMASK_NONE, // gpio pulls
+        NULL, 1, // set
+        NULL, 0, false, // sideset
+        PIO_PINMASK_NONE, pins_we_use, // initial pin state
+        NULL, // jump pin
+        pins_we_use, true, false,
+        true, sample_bytes * 8, true, // TX, auto pull every sample. shift right to take the low bits
+        true, // Wait for txstall. If we don't, then we'll deinit too quickly.
+        false, 32, true, // RX setting we don't use
+        false, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        0, -1, // wrap
+        PIO_ANY_OFFSET,  // offset
+        PIO_FIFO_TYPE_DEFAULT,
+        PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    if (!ok) {
+        m_free(samples);
+        // Fall back to one strip at a time.
+        for (size_t i = 0; i < count; i++) {
+            common_hal_neopixel_write(digitalinouts[i], (uint8_t *)bufs[i].buf, bufs[i].len);
+        }
+        return;
+    }
+
+    while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
+    }
+
+    common_hal_rp2pio_statemachine_write(&state_machine, samples, num_samples * sample_bytes, sample_bytes, false);
+    m_free(samples);
+
+    rp2pio_statemachine_deinit(&state_machine, true);
+
+    for (size_t i = 0; i < count; i++) {
+        gpio_init(digitalinouts[i]->pin->number);
+        common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinouts[i], false, DRIVE_MODE_PUSH_PULL);
+    }
+
+    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+}
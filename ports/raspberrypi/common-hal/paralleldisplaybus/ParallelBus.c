@@ -15,6 +15,8 @@
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/rp2pio/StateMachine.h"
 
+#include "hardware/dma.h"
+
 static const uint16_t parallel_program[] = {
 // .side_set 1
 // .wrap_target
@@ -23,12 +25,20 @@ static const uint16_t parallel_program[] = {
 // .wrap
 };
 
-void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_parallelbus_obj_t *self,
+static const uint16_t parallel_program_16[] = {
+// .side_set 1
+// .wrap_target
+    0x6010, // out pins, 16 side 0
+    0xB042  // nop          side 1
+// .wrap
+};
+
+static void construct(paralleldisplaybus_parallelbus_obj_t *self, uint8_t bus_width,
     const mcu_pin_obj_t *data0, const mcu_pin_obj_t *command, const mcu_pin_obj_t *chip_select,
     const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
 
     uint8_t data_pin = data0->number;
-    for (uint8_t i = 0; i < 8; i++) {
+    for (uint8_t i = 0; i < bus_width; i++) {
         if (!pin_number_is_free(data_pin + i)) {
             mp_raise_ValueError_varg(MP_ERROR_TEXT("Bus pin %d is already in use"), i);
         }
@@ -56,7 +66,9 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
     }
 
     self->data0_pin = data_pin;
+    self->bus_width = bus_width;
     self->write = write_pin;
+    self->send_in_progress = false;
 
     self->reset.base.type = &mp_type_NoneType;
     if (reset != NULL) {
@@ -70,16 +82,17 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
     never_reset_pin_number(command->number);
     never_reset_pin_number(chip_select->number);
     never_reset_pin_number(write_pin);
-    for (uint8_t i = 0; i < 8; i++) {
+    for (uint8_t i = 0; i < bus_width; i++) {
         never_reset_pin_number(data_pin + i);
     }
 
+    bool wide = bus_width == 16;
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
-        parallel_program, MP_ARRAY_SIZE(parallel_program),
+        wide ? parallel_program_16 : parallel_program, MP_ARRAY_SIZE(parallel_program),
         frequency * 2, // frequency multiplied by 2 as 2 PIO instructions
         NULL, 0, // init
         NULL, 0, // may_exec
-        data0, 8, PIO_PINMASK32_NONE, PIO_PINMASK32_FROM_VALUE(255), // first out pin, # out pins
+        data0, bus_width, PIO_PINMASK32_NONE, PIO_PINMASK32_FROM_VALUE((1u << bus_width) - 1), // first out pin, # out pins
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first in pin, # in pins
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first set pin
         write, 1, false, PIO_PINMASK32_NONE, PIO_PINMASK32_FROM_VALUE(1), // first sideset pin
@@ -87,7 +100,7 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
         NULL, PULL_NONE, // jump pin
         PIO_PINMASK_NONE, // wait gpio pins
         true, // exclusive pin usage
-        true, 8, true, // TX, auto pull every 8 bits. shift left to output msb first
+        true, bus_width, true, // TX, auto pull every bus_width bits. shift left to output msb first
         false, // wait for TX stall
         false, 32, true, // RX setting we don't use
         false, // Not user-interruptible.
@@ -99,10 +112,32 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
     common_hal_rp2pio_statemachine_never_reset(&self->state_machine);
 }
 
+void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_parallelbus_obj_t *self,
+    const mcu_pin_obj_t *data0, const mcu_pin_obj_t *command, const mcu_pin_obj_t *chip_select,
+    const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
+    construct(self, 8, data0, command, chip_select, write, read, reset, frequency);
+}
+
+void common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(paralleldisplaybus_parallelbus_obj_t *self,
+    uint8_t n_pins, const mcu_pin_obj_t **data_pins, const mcu_pin_obj_t *command, const mcu_pin_obj_t *chip_select,
+    const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
+    if (n_pins != 8 && n_pins != 16) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Number of data_pins must be %d or %d, not %d"), 8, 16, n_pins);
+    }
+    // PIO drives the data from one contiguous range of pins.
+    for (uint8_t i = 1; i < n_pins; i++) {
+        if (data_pins[i]->number != data_pins[0]->number + i) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Pins must be sequential GPIO pins"));
+        }
+    }
+    construct(self, n_pins, data_pins[0], command, chip_select, write, read, reset, frequency);
+}
+
 void common_hal_paralleldisplaybus_parallelbus_deinit(paralleldisplaybus_parallelbus_obj_t *self) {
+    common_hal_paralleldisplaybus_parallelbus_finish_send(self);
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 
-    for (uint8_t i = 0; i < 8; i++) {
+    for (uint8_t i = 0; i < self->bus_width; i++) {
         reset_pin_number(self->data0_pin + i);
     }
 
@@ -144,11 +179,80 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t obj, display_byte_t
 
     paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
 
+    // The command pin must not change while a background send is still going.
+    common_hal_paralleldisplaybus_parallelbus_finish_send(self);
     common_hal_digitalio_digitalinout_set_value(&self->command, byte_type == DISPLAY_DATA);
-    common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
+    if (self->bus_width == 8) {
+        common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
+        return;
+    }
+    // Like other 16-bit buses, commands take one cycle per byte on D0-D7 and data takes one cycle
+    // per pair of bytes with the first byte on D8-D15.
+    if (byte_type == DISPLAY_COMMAND) {
+        for (uint32_t i = 0; i < data_length; i++) {
+            uint16_t word = data[i];
+            common_hal_rp2pio_statemachine_write(&self->state_machine, (const uint8_t *)&word, 2, 2, false);
+        }
+        return;
+    }
+    uint32_t even_length = data_length & ~1;
+    if (even_length > 0) {
+        common_hal_rp2pio_statemachine_write(&self->state_machine, data, even_length, 2, true);
+    }
+    if (even_length != data_length) {
+        uint16_t word = data[even_length] << 8;
+        common_hal_rp2pio_statemachine_write(&self->state_machine, (const uint8_t *)&word, 2, 2, false);
+    }
+}
+
+bool common_hal_paralleldisplaybus_parallelbus_start_send(mp_obj_t obj, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    uint8_t stride = self->bus_width / 8;
+    if (byte_type != DISPLAY_DATA || data_length % stride != 0) {
+        return false;
+    }
+    common_hal_paralleldisplaybus_parallelbus_finish_send(self);
+    int channel = dma_claim_unused_channel(false);
+    if (channel < 0) {
+        return false;
+    }
+    common_hal_digitalio_digitalinout_set_value(&self->command, true);
+
+    rp2pio_statemachine_obj_t *sm = &self->state_machine;
+    // The state machine shifts left, so narrow writes go to the top of the FIFO word.
+    volatile uint8_t *destination = (volatile uint8_t *)&sm->pio->txf[sm->state_machine] + 4 - stride;
+    dma_channel_config c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, stride == 2 ? DMA_SIZE_16 : DMA_SIZE_8);
+    channel_config_set_dreq(&c, sm->tx_dreq);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    // Put the first byte of each pair on D8-D15.
+    channel_config_set_bswap(&c, stride == 2);
+    dma_channel_configure(channel, &c, destination, data, data_length / stride, true);
+    self->send_dma_channel = channel;
+    self->send_in_progress = true;
+    return true;
+}
+
+void common_hal_paralleldisplaybus_parallelbus_finish_send(mp_obj_t obj) {
+    paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    if (!self->send_in_progress) {
+        return;
+    }
+    while (dma_channel_is_busy(self->send_dma_channel)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    // DMA is done once the last word is in the FIFO. Wait for it to be clocked out.
+    rp2pio_statemachine_obj_t *sm = &self->state_machine;
+    while (!pio_sm_is_tx_fifo_empty(sm->pio, sm->state_machine)) {
+    }
+    dma_channel_unclaim(self->send_dma_channel);
+    self->send_in_progress = false;
 }
 
 void common_hal_paralleldisplaybus_parallelbus_end_transaction(mp_obj_t obj) {
     paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_paralleldisplaybus_parallelbus_finish_send(self);
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
 }
@@ -18,5 +18,9 @@ typedef struct {
     digitalio_digitalinout_obj_t read;
     uint8_t write;
     uint8_t data0_pin;
+    uint8_t bus_width; // 8 or 16 data pins
+    // DMA channel used by common_hal_paralleldisplaybus_parallelbus_start_send while a send is in flight.
+    uint8_t send_dma_channel;
+    bool send_in_progress;
     rp2pio_statemachine_obj_t state_machine;
 } paralleldisplaybus_parallelbus_obj_t;
@@ -11,6 +11,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "common-hal/pwmio/PWMOut.h"
 #include "common-hal/rp2pio/StateMachine.h"
+#include "core1_worker.h"
 #include "supervisor/port.h"
 
 #include "pico/stdlib.h"
@@ -25,6 +26,9 @@
 
 picodvi_framebuffer_obj_t *active_picodvi = NULL;
 
+// Core 1 only TMDS encodes lines that are already in the framebuffer. It can't render them just in
+// time because it is locked out of flash, where displayio lives, and the heap belongs to the VM on
+// core 0.
 static void __not_in_flash_func(core1_main)(void) {
     // The MPU is reset before this starts.
 
@@ -282,6 +286,7 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
 
     // Core 1 will wait until it sees the first colour buffer, then start up the
     // DVI signalling.
+    core1_worker_claim();
     multicore_launch_core1(core1_main);
 
     self->next_scanline = 0;
@@ -324,6 +329,7 @@ void common_hal_picodvi_framebuffer_deinit(picodvi_framebuffer_obj_t *self) {
     uint32_t tmds_save = spin_lock_blocking(tmds_lock);
     uint32_t colour_save = spin_lock_blocking(colour_lock);
     multicore_reset_core1();
+    core1_worker_release();
     spin_unlock(colour_lock, colour_save);
     spin_unlock(tmds_lock, tmds_save);
 
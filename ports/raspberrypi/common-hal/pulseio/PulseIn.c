@@ -4,7 +4,9 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "hardware/dma.h"
 #include "hardware/gpio.h"
+#include "hardware/pio_instructions.h"
 
 #include <stdint.h>
 
@@ -17,28 +19,62 @@
 
 #define NO_PIN 0xff
 #define MAX_PULSE 65535
-#define MIN_PULSE 0
-
-static const uint16_t pulsein_program[] = {
-    0x4001, //  1: in     pins, 1
-};
+// The DMA can only wrap within 32kB.
+#define MAX_RING_BITS (15)
+// Restarted by pulsein_sync() long before it runs out.
+#define DMA_TRANSFER_COUNT (0x0fffffff)
+
+// Times each level in microseconds and pushes the count when the pin changes, so the CPU isn't
+// involved until the pulses are read. Each count takes two cycles at 2MHz. Entry depends on the
+// idle state and waits for the first edge.
+enum { PULSEIN_IDLE_LOW_ENTRY = 0, PULSEIN_IDLE_HIGH_ENTRY = 8, PULSEIN_PROGRAM_LEN = 14 };
+static uint16_t pulsein_program[PULSEIN_PROGRAM_LEN];
+
+static void build_program(uint16_t *p) {
+    p[0] = pio_encode_wait_pin(true, 0);
+    // Time a high level.
+    p[1] = pio_encode_mov_not(pio_x, pio_null);
+    p[2] = pio_encode_jmp_pin(4);
+    p[3] = pio_encode_jmp(5);
+    p[4] = pio_encode_jmp_x_dec(2);
+    p[5] = pio_encode_mov_not(pio_isr, pio_x);
+    p[6] = pio_encode_push(false, false);
+    p[7] = pio_encode_jmp(9);
+    p[8] = pio_encode_wait_pin(false, 0);
+    // Time a low level.
+    p[9] = pio_encode_mov_not(pio_x, pio_null);
+    p[10] = pio_encode_jmp_pin(12);
+    p[11] = pio_encode_jmp_x_dec(10);
+    p[12] = pio_encode_mov_not(pio_isr, pio_x);
+    p[13] = pio_encode_push(false, false);
+}
 
 void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
     const mcu_pin_obj_t *pin, uint16_t maxlen, bool idle_state) {
 
-    self->buffer = (uint16_t *)m_malloc_without_collect(maxlen * sizeof(uint16_t));
-    if (self->buffer == NULL) {
-        m_malloc_fail(maxlen * sizeof(uint16_t));
+    mp_arg_validate_int_max(maxlen, 1 << (MAX_RING_BITS - 2), MP_QSTR_maxlen);
+    uint8_t ring_bits = 2;
+    while ((1u << (ring_bits - 2)) < maxlen) {
+        ring_bits++;
+    }
+    // Twice the ring so there is always room to align it.
+    size_t storage_len = 2 << ring_bits;
+    self->ring_storage = m_malloc_without_collect(storage_len);
+    if (self->ring_storage == NULL) {
+        m_malloc_fail(storage_len);
     }
+    uintptr_t ring_size = 1u << ring_bits;
+    self->ring = (volatile uint32_t *)(((uintptr_t)self->ring_storage + ring_size - 1) & ~(ring_size - 1));
+    self->ring_mask = (ring_size / sizeof(uint32_t)) - 1;
     self->pin = pin->number;
     self->maxlen = maxlen;
     self->idle_state = idle_state;
-    self->start = 0;
-    self->len = 0;
+    self->read_count = 0;
 
+    build_program(pulsein_program);
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         pulsein_program, MP_ARRAY_SIZE(pulsein_program),
-        1000000, // frequency
+        2000000, // frequency
         NULL, 0, // init, init_len
         NULL, 0, // may_exec
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first out pin, # out pins, initial_out_pin_state
@@ -46,25 +82,67 @@ void common_hal_pulseio_pulsein_construct(pulseio_pulsein_obj_t *self,
         NULL, 0, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first set pin
         NULL, 0, false, PIO_PINMASK32_NONE, PIO_PINMASK32_NONE, // first sideset pin
         false, // No sideset enable
-        NULL, PULL_NONE, // jump pin, jmp_pull
+        pin, PULL_NONE, // jump pin, jmp_pull
         PIO_PINMASK_NONE, // wait gpio pins
         true, // exclusive pin usage
         false, 8, false, // TX, setting we don't use
         false, // wait for TX stall
-        true, 32, true, // RX auto pull every 32 bits. shift left to output msb first
+        false, 32, true, // RX, pushed by the program
         false, // Not user-interruptible.
-        0, -1, // wrap settings
+        1, -1, // wrap back to timing a high level
         PIO_ANY_OFFSET,
-        PIO_FIFO_TYPE_DEFAULT,
+        PIO_FIFO_JOIN_RX,
         PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
 
     common_hal_pulseio_pulsein_pause(self);
 
-    common_hal_rp2pio_statemachine_set_interrupt_handler(&(self->state_machine), &common_hal_pulseio_pulsein_interrupt, self, PIO_IRQ0_INTE_SM0_RXNEMPTY_BITS);
+    self->dma_channel = dma_claim_unused_channel(false);
+    if (self->dma_channel < 0) {
+        common_hal_pulseio_pulsein_deinit(self);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All dma channels in use"));
+    }
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+    dma_channel_config c = dma_channel_get_default_config(self->dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_bits);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+    dma_channel_configure(self->dma_channel, &c, self->ring, &pio->rxf[sm], DMA_TRANSFER_COUNT, true);
+    self->dma_base_count = 0;
 
     common_hal_pulseio_pulsein_resume(self, 0);
 }
 
+// Number of pulses the DMA has stored since construction.
+static uint32_t pulsein_written(pulseio_pulsein_obj_t *self) {
+    return self->dma_base_count + DMA_TRANSFER_COUNT - dma_channel_hw_addr(self->dma_channel)->transfer_count;
+}
+
+// Catch the read position up so at most maxlen pulses are waiting, dropping the oldest.
+static uint32_t pulsein_sync(pulseio_pulsein_obj_t *self) {
+    if (!dma_channel_is_busy(self->dma_channel)) {
+        // The write address has wrapped to where the next pulse belongs, so keep going from there.
+        self->dma_base_count += DMA_TRANSFER_COUNT;
+        dma_channel_set_trans_count(self->dma_channel, DMA_TRANSFER_COUNT, true);
+    }
+    uint32_t written = pulsein_written(self);
+    if (written - self->read_count > self->maxlen) {
+        self->read_count = written - self->maxlen;
+    }
+    return written - self->read_count;
+}
+
+static uint16_t pulsein_get(pulseio_pulsein_obj_t *self, uint32_t index) {
+    uint32_t result = self->ring[index & self->ring_mask];
+    // Pulses that are longer than MAX_PULSE will return MAX_PULSE
+    if (result > MAX_PULSE) {
+        result = MAX_PULSE;
+    }
+    return result;
+}
+
 bool common_hal_pulseio_pulsein_deinited(pulseio_pulsein_obj_t *self) {
     return self->pin == NO_PIN;
 }
@@ -74,8 +152,13 @@ void common_hal_pulseio_pulsein_deinit(pulseio_pulsein_obj_t *self) {
         return;
     }
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    if (self->dma_channel >= 0) {
+        dma_channel_abort(self->dma_channel);
+        dma_channel_unclaim(self->dma_channel);
+        self->dma_channel = -1;
+    }
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
-    m_free(self->buffer);
+    m_free(self->ring_storage);
     reset_pin_number(self->pin);
     self->pin = NO_PIN;
 }
@@ -84,46 +167,9 @@ void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
     pio_sm_restart(self->state_machine.pio, self->state_machine.state_machine);
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
     pio_sm_clear_fifos(self->state_machine.pio, self->state_machine.state_machine);
-    self->last_level = self->idle_state;
-    self->level_count = 0;
     self->paused = true;
 }
-void common_hal_pulseio_pulsein_interrupt(void *self_in) {
-    pulseio_pulsein_obj_t *self = self_in;
-
-    uint32_t rxfifo = 0;
-
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
-            } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
-            }
-        }
-    }
-}
+
 void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
     uint16_t trigger_duration) {
 
@@ -137,29 +183,24 @@ void common_hal_pulseio_pulsein_resume(pulseio_pulsein_obj_t *self,
         gpio_set_function(self->pin, GPIO_FUNC_PIO0);
     }
 
-    // exec a wait for the selected pin to change state
-    if (self->idle_state == true) {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x2020);
-    } else {
-        pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, 0x20a0);
-    }
+    // Start at the entry that waits for the selected pin to change state.
+    uint entry = self->idle_state ? PULSEIN_IDLE_HIGH_ENTRY : PULSEIN_IDLE_LOW_ENTRY;
+    pio_sm_exec(self->state_machine.pio, self->state_machine.state_machine, pio_encode_jmp(self->state_machine.offset + entry));
     pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, true);
     self->paused = false;
 }
 
 void common_hal_pulseio_pulsein_clear(pulseio_pulsein_obj_t *self) {
-    self->len = 0;
+    pulsein_sync(self);
+    self->read_count = pulsein_written(self);
 }
 
 uint16_t common_hal_pulseio_pulsein_popleft(pulseio_pulsein_obj_t *self) {
-    if (self->len == 0) {
+    if (pulsein_sync(self) == 0) {
         mp_raise_IndexError_varg(MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_PulseIn);
     }
-    uint16_t value = self->buffer[self->start];
-    common_hal_mcu_disable_interrupts();
-    self->start = (self->start + 1) % self->maxlen;
-    self->len--;
-    common_hal_mcu_enable_interrupts();
+    uint16_t value = pulsein_get(self, self->read_count);
+    self->read_count++;
     return value;
 }
 
@@ -168,7 +209,7 @@ uint16_t common_hal_pulseio_pulsein_get_maxlen(pulseio_pulsein_obj_t *self) {
 }
 
 uint16_t common_hal_pulseio_pulsein_get_len(pulseio_pulsein_obj_t *self) {
-    return self->len;
+    return pulsein_sync(self);
 }
 
 bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self) {
@@ -177,12 +218,12 @@ bool common_hal_pulseio_pulsein_get_paused(pulseio_pulsein_obj_t *self) {
 
 uint16_t common_hal_pulseio_pulsein_get_item(pulseio_pulsein_obj_t *self,
     int16_t index) {
+    uint16_t len = pulsein_sync(self);
     if (index < 0) {
-        index += self->len;
+        index += len;
     }
-    if (index < 0 || index >= self->len) {
-        mp_arg_validate_index_range(index, 0, self->len, MP_QSTR_index);
+    if (index < 0 || index >= len) {
+        mp_arg_validate_index_range(index, 0, len, MP_QSTR_index);
     }
-    uint16_t value = self->buffer[(self->start + index) % self->maxlen];
-    return value;
+    return pulsein_get(self, self->read_count + index);
 }
@@ -18,12 +18,13 @@ typedef struct {
     bool idle_state;
     bool paused;
     uint16_t maxlen;
-    uint16_t *buffer;
-    volatile bool last_level;
-    volatile uint32_t level_count;
-    volatile uint16_t len;
-    volatile uint16_t start;
+    uint16_t ring_mask;
+    int dma_channel;
+    // Pulses written by the DMA before its current run, and pulses consumed by reads.
+    uint32_t dma_base_count;
+    uint32_t read_count;
+    // Points into ring_storage, aligned so the DMA can wrap around it.
+    volatile uint32_t *ring;
+    uint32_t *ring_storage;
     rp2pio_statemachine_obj_t state_machine;
 } pulseio_pulsein_obj_t;
-
-void common_hal_pulseio_pulsein_interrupt(void *);
@@ -40,12 +40,19 @@ static pio_pinmask_t _current_sm_pins[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 
 static int8_t _sm_dma_plus_one_write[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 static int8_t _sm_dma_plus_one_read[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+// Control channel that feeds a write chain into the write channel.
+static int8_t _sm_dma_plus_one_chain[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 
 #define SM_DMA_ALLOCATED_WRITE(pio_index, sm) (_sm_dma_plus_one_write[(pio_index)][(sm)] != 0)
 #define SM_DMA_GET_CHANNEL_WRITE(pio_index, sm) (_sm_dma_plus_one_write[(pio_index)][(sm)] - 1)
 #define SM_DMA_CLEAR_CHANNEL_WRITE(pio_index, sm) (_sm_dma_plus_one_write[(pio_index)][(sm)] = 0)
 #define SM_DMA_SET_CHANNEL_WRITE(pio_index, sm, channel) (_sm_dma_plus_one_write[(pio_index)][(sm)] = (channel) + 1)
 
+#define SM_DMA_ALLOCATED_CHAIN(pio_index, sm) (_sm_dma_plus_one_chain[(pio_index)][(sm)] != 0)
+#define SM_DMA_GET_CHANNEL_CHAIN(pio_index, sm) (_sm_dma_plus_one_chain[(pio_index)][(sm)] - 1)
+#define SM_DMA_CLEAR_CHANNEL_CHAIN(pio_index, sm) (_sm_dma_plus_one_chain[(pio_index)][(sm)] = 0)
+#define SM_DMA_SET_CHANNEL_CHAIN(pio_index, sm, channel) (_sm_dma_plus_one_chain[(pio_index)][(sm)] = (channel) + 1)
+
 #define SM_DMA_ALLOCATED_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] != 0)
 #define SM_DMA_GET_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] - 1)
 #define SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] = 0)
@@ -69,6 +76,13 @@ static void rp2pio_statemachine_set_pull(pio_pinmask_t pull_pin_up, pio_pinmask_
 }
 
 static void rp2pio_statemachine_clear_dma_write(int pio_index, int sm) {
+    if (SM_DMA_ALLOCATED_CHAIN(pio_index, sm)) {
+        // Stop the control channel first so it can't restart the write channel.
+        int channel_chain = SM_DMA_GET_CHANNEL_CHAIN(pio_index, sm);
+        dma_channel_abort(channel_chain);
+        dma_channel_unclaim(channel_chain);
+    }
+    SM_DMA_CLEAR_CHANNEL_CHAIN(pio_index, sm);
     if (SM_DMA_ALLOCATED_WRITE(pio_index, sm)) {
         int channel_write = SM_DMA_GET_CHANNEL_WRITE(pio_index, sm);
         uint32_t channel_mask_write = 1u << channel_write;
@@ -222,14 +236,15 @@ static bool is_gpio_compatible(PIO pio, uint32_t used_gpio_ranges) {
     #endif
 }
 
-static bool use_existing_program(PIO *pio_out, int *sm_out, int *offset_inout, uint32_t program_id, size_t program_len, uint gpio_base, uint gpio_count) {
-    uint32_t required_gpio_ranges;
-    if (gpio_count) {
-        required_gpio_ranges = (1u << (gpio_base >> 4)) |
-            (1u << ((gpio_base + gpio_count - 1) >> 4));
-    } else {
-        required_gpio_ranges = 0;
+static uint32_t gpio_ranges(uint gpio_base, uint gpio_count) {
+    if (gpio_count == 0) {
+        return 0;
     }
+    return (1u << (gpio_base >> 4)) | (1u << ((gpio_base + gpio_count - 1) >> 4));
+}
+
+static bool use_existing_program(PIO *pio_out, int *sm_out, int *offset_inout, uint32_t program_id, size_t program_len, uint gpio_base, uint gpio_count) {
+    uint32_t required_gpio_ranges = gpio_ranges(gpio_base, gpio_count);
 
     for (size_t i = 0; i < NUM_PIOS; i++) {
         PIO pio = pio_get_instance(i);
@@ -252,6 +267,60 @@ static bool use_existing_program(PIO *pio_out, int *sm_out, int *offset_inout, u
     return false;
 }
 
+uint32_t rp2pio_statemachine_used_instructions(PIO pio) {
+    // Ask the SDK one slot at a time so programs loaded outside of rp2pio are counted too.
+    uint16_t instruction = pio_encode_nop();
+    pio_program_t slot = {
+        .instructions = &instruction,
+        .length = 1,
+        .origin = -1,
+    };
+    uint32_t used = 0;
+    for (uint offset = 0; offset < PIO_INSTRUCTION_COUNT; offset++) {
+        if (!pio_can_add_program_at_offset(pio, &slot, offset)) {
+            used |= 1u << offset;
+        }
+    }
+    return used;
+}
+
+static bool pio_has_free_sm(PIO pio) {
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+        if (!pio_sm_is_claimed(pio, sm)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The SDK loads into the first PIO with room, which fragments instruction memory until a large
+// program fits nowhere. Instead pick the smallest free run that holds the program, across every
+// PIO that already has a compatible GPIO base, and place it at the end of that run.
+static bool find_best_fit(size_t program_len, uint32_t required_gpio_ranges, PIO *pio_out, int *offset_out) {
+    size_t best_run = PIO_INSTRUCTION_COUNT + 1;
+    for (size_t i = 0; i < NUM_PIOS; i++) {
+        PIO pio = pio_get_instance(i);
+        if (!is_gpio_compatible(pio, required_gpio_ranges) || !pio_has_free_sm(pio)) {
+            continue;
+        }
+        uint32_t used = rp2pio_statemachine_used_instructions(pio);
+        size_t run = 0;
+        for (size_t offset = 0; offset <= PIO_INSTRUCTION_COUNT; offset++) {
+            if (offset < PIO_INSTRUCTION_COUNT && !(used & (1u << offset))) {
+                run++;
+                continue;
+            }
+            if (run >= program_len && run < best_run) {
+                best_run = run;
+                *pio_out = pio;
+                *offset_out = offset - program_len;
+            }
+            run = 0;
+        }
+    }
+    return best_run <= PIO_INSTRUCTION_COUNT;
+}
+
 bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     const uint16_t *program, size_t program_len,
     size_t frequency,
@@ -311,12 +380,20 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     bool added = false;
 
     if (!use_existing_program(&pio, &state_machine, &offset, program_id, program_len, gpio_base, gpio_count)) {
-        uint program_offset;
-        bool r = pio_claim_free_sm_and_add_program_for_gpio_range(&program_struct, &pio, (uint *)&state_machine, &program_offset, gpio_base, gpio_count, true);
-        if (!r) {
-            return false;
+        int best_offset;
+        if (offset == -1 && find_best_fit(program_len, gpio_ranges(gpio_base, gpio_count), &pio, &best_offset)) {
+            state_machine = pio_claim_unused_sm(pio, true);
+            pio_add_program_at_offset(pio, &program_struct, best_offset);
+            offset = best_offset;
+        } else {
+            // Let the SDK handle fixed offsets and moving a PIO's GPIO base.
+            uint program_offset;
+            bool r = pio_claim_free_sm_and_add_program_for_gpio_range(&program_struct, &pio, (uint *)&state_machine, &program_offset, gpio_base, gpio_count, true);
+            if (!r) {
+                return false;
+            }
+            offset = program_offset;
         }
-        offset = program_offset;
         added = true;
     }
 
@@ -341,6 +418,8 @@ bool rp2pio_statemachine_construct(rp2pio_statemachine_obj_t *self,
     self->pio = pio;
     self->state_machine = state_machine;
     self->offset = offset;
+    self->write_chain = NULL;
+    self->restart_after_read = false;
     _current_program_id[pio_index][state_machine] = program_id;
     _current_program_len[pio_index][state_machine] = program_len;
     _current_program_offset[pio_index][state_machine] = offset;
@@ -1105,6 +1184,11 @@ uint8_t rp2pio_statemachine_program_offset(rp2pio_statemachine_obj_t *self) {
 
 bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *self, uint8_t stride_in_bytes, bool swap) {
 
+    if (self->write_chain != NULL) {
+        // The chain owns the write channel, so start over with a fresh one.
+        (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+    }
+
     uint8_t pio_index = pio_get_index(self->pio);
     uint8_t sm = self->state_machine;
 
@@ -1227,6 +1311,18 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
 }
 
 void rp2pio_statemachine_dma_complete_write(rp2pio_statemachine_obj_t *self, int channel_write) {
+    if (self->write_chain != NULL) {
+        // Only the null entry at the end of the chain interrupts.
+        if (self->write_chain_loop) {
+            uint8_t pio_index = pio_get_index(self->pio);
+            dma_channel_set_read_addr(SM_DMA_GET_CHANNEL_CHAIN(pio_index, self->state_machine), self->write_chain, true);
+        } else {
+            self->dma_completed_write = true;
+        }
+        self->switched_write_buffers = true;
+        return;
+    }
+
     self->current_write_buf = self->next_write_buf_1;
     self->next_write_buf_1 = self->next_write_buf_2;
     self->next_write_buf_2 = self->next_write_buf_3;
@@ -1250,6 +1346,11 @@ bool common_hal_rp2pio_statemachine_stop_background_write(rp2pio_statemachine_ob
     uint8_t pio_index = pio_get_index(self->pio);
     uint8_t sm = self->state_machine;
     rp2pio_statemachine_clear_dma_write(pio_index, sm);
+    if (self->write_chain != NULL) {
+        m_del(uint32_t, self->write_chain, self->write_chain_len);
+        self->write_chain = NULL;
+        self->write_chain_buffers = MP_OBJ_NULL;
+    }
     memset(&self->current_write_buf, 0, sizeof(self->current_write_buf));
     memset(&self->next_write_buf_1, 0, sizeof(self->next_write_buf_1));
     memset(&self->next_write_buf_2, 0, sizeof(self->next_write_buf_2));
@@ -1258,6 +1359,96 @@ bool common_hal_rp2pio_statemachine_stop_background_write(rp2pio_statemachine_ob
     return true;
 }
 
+bool common_hal_rp2pio_statemachine_background_write_chain(rp2pio_statemachine_obj_t *self,
+    mp_obj_t buffers_obj, const mp_buffer_info_t *buffers, const mp_int_t *repeats, size_t count,
+    bool loop, uint8_t stride_in_bytes, bool swap) {
+    (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+
+    // Each entry is a transfer count and a read address. The control channel copies one into the
+    // write channel's alias 3 registers, which starts it, and the write channel chains back to
+    // the control channel when it finishes, so the CPU isn't involved between buffers.
+    size_t entries = 1;
+    for (size_t i = 0; i < count; i++) {
+        if (buffers[i].len >= stride_in_bytes) {
+            entries += repeats[i];
+        }
+    }
+    if (entries == 1) {
+        return true;
+    }
+    size_t chain_len = entries * 2;
+    uint32_t *chain = m_new(uint32_t, chain_len);
+    uint32_t *entry = chain;
+    for (size_t i = 0; i < count; i++) {
+        if (buffers[i].len < stride_in_bytes) {
+            continue;
+        }
+        for (mp_int_t r = 0; r < repeats[i]; r++) {
+            *entry++ = buffers[i].len / stride_in_bytes;
+            *entry++ = (uint32_t)buffers[i].buf;
+        }
+    }
+    // A null trigger ends the chain and raises the write channel's quiet interrupt.
+    *entry++ = 0;
+    *entry++ = 0;
+
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    int channel_write = dma_claim_unused_channel(false);
+    int channel_chain = dma_claim_unused_channel(false);
+    if (channel_write == -1 || channel_chain == -1) {
+        if (channel_write != -1) {
+            dma_channel_unclaim(channel_write);
+        }
+        if (channel_chain != -1) {
+            dma_channel_unclaim(channel_chain);
+        }
+        m_del(uint32_t, chain, chain_len);
+        return false;
+    }
+    SM_DMA_SET_CHANNEL_WRITE(pio_index, sm, channel_write);
+    SM_DMA_SET_CHANNEL_CHAIN(pio_index, sm, channel_chain);
+
+    self->write_chain = chain;
+    self->write_chain_len = chain_len;
+    self->write_chain_buffers = buffers_obj;
+    self->write_chain_loop = loop;
+    self->pending_buffers_write = 0;
+    self->dma_completed_write = false;
+    self->background_stride_in_bytes = stride_in_bytes;
+    self->byteswap = swap;
+    self->tx_dreq = pio_get_dreq(self->pio, sm, true);
+
+    dma_channel_config c_write = dma_channel_get_default_config(channel_write);
+    channel_config_set_transfer_data_size(&c_write, _stride_to_dma_size(stride_in_bytes));
+    channel_config_set_dreq(&c_write, self->tx_dreq);
+    channel_config_set_read_increment(&c_write, true);
+    channel_config_set_write_increment(&c_write, false);
+    channel_config_set_bswap(&c_write, swap);
+    channel_config_set_chain_to(&c_write, channel_chain);
+    channel_config_set_irq_quiet(&c_write, true);
+    dma_channel_configure(channel_write, &c_write, &self->pio->txf[sm], NULL, 0, false);
+
+    dma_channel_config c_chain = dma_channel_get_default_config(channel_chain);
+    channel_config_set_transfer_data_size(&c_chain, DMA_SIZE_32);
+    channel_config_set_read_increment(&c_chain, true);
+    channel_config_set_write_increment(&c_chain, true);
+    // Wrap the writes around the two registers.
+    channel_config_set_ring(&c_chain, true, 3);
+    dma_channel_configure(channel_chain, &c_chain, &dma_hw->ch[channel_write].al3_transfer_count, chain, 2, false);
+
+    common_hal_mcu_disable_interrupts();
+    // Acknowledge any previous pending interrupt
+    dma_hw->ints0 |= 1u << channel_write;
+    MP_STATE_PORT(background_pio_write)[channel_write] = self;
+    dma_hw->inte0 |= 1u << channel_write;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_start_channel_mask(1u << channel_chain);
+    common_hal_mcu_enable_interrupts();
+
+    return true;
+}
+
 bool common_hal_rp2pio_statemachine_get_writing(rp2pio_statemachine_obj_t *self) {
     return !self->dma_completed_write;
 }
@@ -1390,6 +1581,15 @@ bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *s
 }
 
 void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel_read) {
+    if (self->restart_after_read) {
+        // Drop anything past the end of the buffer and start the program over, so the next
+        // buffer begins wherever the program first waits.
+        pio_sm_set_enabled(self->pio, self->state_machine, false);
+        pio_sm_clear_fifos(self->pio, self->state_machine);
+        pio_sm_restart(self->pio, self->state_machine);
+        pio_sm_exec(self->pio, self->state_machine, pio_encode_jmp(self->offset));
+        pio_sm_set_enabled(self->pio, self->state_machine, true);
+    }
 
     self->current_read_buf = self->next_read_buf_1;
     self->next_read_buf_1 = self->next_read_buf_2;
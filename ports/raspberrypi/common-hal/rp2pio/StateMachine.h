@@ -137,6 +137,13 @@ typedef struct {
     int background_stride_in_bytes;
     bool dma_completed_write, byteswap;
     bool dma_completed_read;
+    // Set while background_write_chain() owns the write channel.
+    uint32_t *write_chain;
+    size_t write_chain_len;
+    mp_obj_t write_chain_buffers;
+    bool write_chain_loop;
+    // Restart the program from its first instruction each time a background read buffer fills.
+    bool restart_after_read;
     #if PICO_PIO_VERSION > 0
     memorymap_addressrange_obj_t rxfifo_obj;
     #endif
@@ -178,5 +185,7 @@ void rp2pio_statemachine_reset_ok(PIO pio, int sm);
 void rp2pio_statemachine_never_reset(PIO pio, int sm);
 
 uint8_t rp2pio_statemachine_find_pio(int program_size, int sm_count);
+// Bit n is set when instruction slot n is taken, by rp2pio or anything else using the SDK.
+uint32_t rp2pio_statemachine_used_instructions(PIO pio);
 
 extern const mp_obj_type_t rp2pio_statemachine_type;
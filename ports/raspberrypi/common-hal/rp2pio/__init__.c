@@ -7,6 +7,7 @@
 #include "py/obj.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "bindings/rp2pio/__init__.h"
+#include "common-hal/rp2pio/StateMachine.h"
 
 bool common_hal_rp2pio_pins_are_sequential(size_t len, const mcu_pin_obj_t **pins) {
     if (len == 0) {
@@ -21,3 +22,21 @@ bool common_hal_rp2pio_pins_are_sequential(size_t len, const mcu_pin_obj_t **pin
     }
     return true;
 }
+
+void common_hal_rp2pio_get_pio_usage(size_t pio_index, size_t *used_instructions, size_t *largest_free_block, size_t *free_state_machines) {
+    PIO pio = pio_get_instance(pio_index);
+    uint32_t used = rp2pio_statemachine_used_instructions(pio);
+    *used_instructions = __builtin_popcount(used);
+    *largest_free_block = 0;
+    size_t run = 0;
+    for (size_t offset = 0; offset < PIO_INSTRUCTION_COUNT; offset++) {
+        run = (used & (1u << offset)) ? 0 : run + 1;
+        *largest_free_block = MAX(*largest_free_block, run);
+    }
+    *free_state_machines = 0;
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+        if (!pio_sm_is_claimed(pio, sm)) {
+            (*free_state_machines)++;
+        }
+    }
+}
@@ -0,0 +1,897 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "py/runtime.h"
+
+#include "bindings/rp2pio/StateMachine.h"
+#include "common-hal/microcontroller/Pin.h"
+#include "shared-bindings/microcontroller/Pin.h"
+#include "shared-bindings/sdioio/SDCard.h"
+#include "shared-bindings/util.h"
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/pio.h"
+#include "hardware/timer.h"
+
+#include "lib/sdmmc/include/sdmmc_cmd.h"
+#include "lib/sdmmc/include/sdmmc_defs.h"
+#include "lib/sdmmc/sdmmc_common.h"
+
+// The data state machines run at the system clock and follow SDIO_CLK, which needs at least
+// two PIO cycles per clock phase.
+#define SDIO_CLOCK_DIVISOR (4)
+#define SDIO_DEFAULT_SPEED_MAX (25000000)
+#define SDIO_HIGH_SPEED_MAX (50000000)
+
+// Offset of the command program's idle loop. SDIO_CLK keeps toggling while the state machine is
+// in it.
+#define SDIO_COMMAND_IDLE (0)
+
+static sdioio_sdcard_obj_t *sdcards[2];
+
+#if !CIRCUITPY_MAX3421E
+void osal_task_delay(uint32_t msec) {
+    mp_hal_delay_ms(msec);
+}
+#endif
+
+static void check_for_deinit(sdioio_sdcard_obj_t *self) {
+    if (common_hal_sdioio_sdcard_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+static uint8_t sdio_crc7(const uint8_t *data, size_t len) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t d = data[i];
+        for (size_t j = 0; j < 8; j++) {
+            crc <<= 1;
+            if ((d ^ crc) & 0x80) {
+                crc ^= 0x09;
+            }
+            d <<= 1;
+        }
+    }
+    return crc & 0x7f;
+}
+
+// Fill in the CRC16 of one block as sent on the data lines. In 1-bit mode this is the plain
+// CRC16-CCITT of the data. In 4-bit mode each line carries its own CRC16 over the bits sent on
+// it. Keeping line n's CRC in bits n, n + 4, n + 8 ... of a 64 bit value lets one byte-wise
+// CRC16 step per 32 bit word update all four at once, and the result is then exactly the 8
+// bytes that follow the block on the bus.
+static void sdio_block_crc(sdioio_sdcard_obj_t *self, const uint8_t *data, size_t len, uint8_t *crc_out) {
+    if (self->width == 1) {
+        uint16_t crc = 0;
+        for (size_t i = 0; i < len; i++) {
+            uint8_t x = (crc >> 8) ^ data[i];
+            x ^= x >> 4;
+            crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ x;
+        }
+        crc_out[0] = crc >> 8;
+        crc_out[1] = crc;
+        return;
+    }
+    uint64_t crc = 0;
+    for (size_t i = 0; i < len; i += 4) {
+        uint32_t word = data[i] << 24 | data[i + 1] << 16 | data[i + 2] << 8 | data[i + 3];
+        uint32_t x = (uint32_t)(crc >> 32) ^ word;
+        x ^= x >> 16;
+        crc = (crc << 32) ^ ((uint64_t)x << 48) ^ ((uint64_t)x << 20) ^ x;
+    }
+    for (size_t i = 0; i < 8; i++) {
+        crc_out[i] = crc >> (56 - 8 * i);
+    }
+}
+
+static uint8_t sdio_crc_size(sdioio_sdcard_obj_t *self) {
+    return self->width == 4 ? 8 : 2;
+}
+
+// Bytes per FIFO word. DMA byte swaps so that memory holds bytes in the order they are sent.
+static uint8_t sdio_unit_size(sdioio_sdcard_obj_t *self) {
+    return self->width == 4 ? 4 : 2;
+}
+
+// The command state machine toggles SDIO_CLK with its mandatory side set bit on every
+// instruction, so it runs at twice the card clock. Commands are 48 bits: the first FIFO word
+// holds the bit count, the response length and the first 16 bits of the command. The response
+// comes back MSB first with the start bit dropped.
+static void sdio_build_command_program(sdioio_sdcard_obj_t *self) {
+    uint16_t *p = self->command_program;
+    #define SIDE(v) pio_encode_sideset(1, (v))
+    // Idle with SDIO_CLK running until a command arrives.
+    p[0] = pio_encode_mov(pio_osr, pio_null) | SIDE(0);
+    p[1] = pio_encode_mov(pio_x, pio_status) | SIDE(1);
+    p[2] = pio_encode_jmp_not_x(3) | SIDE(0);
+    // Discard the nulls so that the next out pulls the command.
+    p[3] = pio_encode_out(pio_null, 32) | SIDE(1);
+    p[4] = pio_encode_out(pio_x, 8) | SIDE(0);
+    p[5] = pio_encode_out(pio_y, 8) | SIDE(1);
+    p[6] = pio_encode_set(pio_pindirs, 1) | SIDE(0);
+    p[7] = pio_encode_nop() | SIDE(1);
+    // Change SDIO_CMD on the falling edge.
+    p[8] = pio_encode_out(pio_pins, 1) | SIDE(0);
+    p[9] = pio_encode_jmp_x_dec(8) | SIDE(1);
+    p[10] = pio_encode_set(pio_pindirs, 0) | SIDE(0);
+    p[11] = pio_encode_jmp_not_y(0) | SIDE(1);
+    // Wait for the response's start bit.
+    p[12] = pio_encode_jmp_pin(18) | SIDE(0);
+    p[13] = pio_encode_nop() | SIDE(1);
+    p[14] = pio_encode_in(pio_pins, 1) | SIDE(0);
+    p[15] = pio_encode_jmp_y_dec(14) | SIDE(1);
+    p[16] = pio_encode_push(false, true) | SIDE(0);
+    p[17] = pio_encode_jmp(0) | SIDE(1);
+    p[18] = pio_encode_jmp(12) | SIDE(1);
+    #undef SIDE
+}
+
+// The data state machines sample or change the data lines on SDIO_CLK edges. In default speed
+// cards change their outputs after the falling edge and are sampled after the rising edge. In
+// high speed they change after the rising edge so sample after the falling edge instead. Y
+// holds the number of data line samples per block, less one.
+static void sdio_build_data_programs(sdioio_sdcard_obj_t *self) {
+    uint8_t width = self->width;
+    uint8_t clock = self->clock_pin - self->gpio_offset;
+    bool sample = !self->high_speed;
+    uint8_t unit_bits = sdio_unit_size(self) * 8;
+
+    uint16_t *r = self->read_program;
+    r[0] = pio_encode_mov(pio_x, pio_y);
+    // Start bit.
+    r[1] = pio_encode_wait_pin(false, 0);
+    r[2] = pio_encode_wait_gpio(sample, clock);
+    r[3] = pio_encode_wait_gpio(!sample, clock);
+    r[4] = pio_encode_wait_gpio(sample, clock);
+    r[5] = pio_encode_in(pio_pins, width);
+    r[6] = pio_encode_jmp_x_dec(3);
+    // End bit.
+    r[7] = pio_encode_wait_gpio(!sample, clock);
+    r[8] = pio_encode_wait_gpio(sample, clock);
+
+    uint16_t *w = self->write_program;
+    w[0] = pio_encode_mov(pio_x, pio_y);
+    // The first FIFO word holds idle bits then the start bit, and the last one the end bit.
+    w[1] = pio_encode_out(pio_pins, width);
+    w[2] = pio_encode_set(pio_pindirs, (1 << width) - 1);
+    w[3] = pio_encode_wait_gpio(true, clock);
+    w[4] = pio_encode_wait_gpio(false, clock);
+    w[5] = pio_encode_out(pio_pins, width);
+    w[6] = pio_encode_jmp_x_dec(3);
+    w[7] = pio_encode_out(pio_null, unit_bits - width);
+    w[8] = pio_encode_wait_gpio(true, clock);
+    w[9] = pio_encode_wait_gpio(false, clock);
+    w[10] = pio_encode_set(pio_pindirs, 0);
+    // Read the CRC status token from DAT0 into the RX FIFO, then wait out busy.
+    w[11] = pio_encode_wait_gpio(!sample, clock);
+    w[12] = pio_encode_wait_gpio(sample, clock);
+    w[13] = pio_encode_jmp_pin(11);
+    w[14] = pio_encode_set(pio_x, 7);
+    w[15] = pio_encode_wait_gpio(!sample, clock);
+    w[16] = pio_encode_wait_gpio(sample, clock);
+    w[17] = pio_encode_in(pio_pins, 1);
+    w[18] = pio_encode_jmp_x_dec(15);
+    w[19] = pio_encode_push(false, true);
+    w[20] = pio_encode_wait_pin(true, 0);
+}
+
+static void sdio_data_deinit(sdioio_sdcard_obj_t *self, bool leave_pins) {
+    if (!common_hal_rp2pio_statemachine_deinited(&self->read_sm)) {
+        rp2pio_statemachine_deinit(&self->read_sm, leave_pins);
+    }
+    if (!common_hal_rp2pio_statemachine_deinited(&self->write_sm)) {
+        rp2pio_statemachine_deinit(&self->write_sm, leave_pins);
+    }
+}
+
+static bool sdio_data_construct(sdioio_sdcard_obj_t *self) {
+    sdio_data_deinit(self, true);
+    sdio_build_data_programs(self);
+
+    const mcu_pin_obj_t *data0 = mcu_get_pin_by_number(self->data_pin);
+    pio_pinmask_t data_pins = PIO_PINMASK_FROM_VALUE(((PIO_PINMASK_C(1) << self->num_data) - 1) << self->data_pin);
+    uint8_t unit_bits = sdio_unit_size(self) * 8;
+
+    // Construct the write state machine first. It has the longer program and both must share a
+    // PIO because they use the same pins.
+    bool ok = rp2pio_statemachine_construct(&self->write_sm,
+        self->write_program, SDIO_WRITE_PROGRAM_LEN,
+        0, // Run at the system clock.
+        NULL, 0, // init
+        data0, self->width, // out pins
+        data0, 1, // in pins
+        data_pins, PIO_PINMASK_NONE, // pull up
+        data0, self->width, // set pins
+        NULL, 0, false, // sideset pins
+        PIO_PINMASK_NONE, PIO_PINMASK_NONE, // initial pin state and direction
+        data0, // jmp pin
+        data_pins, true, true,
+        true, unit_bits, false, // autopull
+        false, // wait for txstall
+        false, 32, false, // autopush
+        true, // claim pins
+        false, // Not user-interruptible.
+        false, // No sideset enable
+        0, -1, // wrap
+        PIO_ANY_OFFSET,
+        PIO_FIFO_JOIN_NONE,
+        PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    if (ok) {
+        ok = rp2pio_statemachine_construct(&self->read_sm,
+            self->read_program, SDIO_READ_PROGRAM_LEN,
+            0, // Run at the system clock.
+            NULL, 0, // init
+            NULL, 0, // out pins
+            data0, self->width, // in pins
+            data_pins, PIO_PINMASK_NONE, // pull up
+            NULL, 0, // set pins
+            NULL, 0, false, // sideset pins
+            PIO_PINMASK_NONE, PIO_PINMASK_NONE, // initial pin state and direction
+            NULL, // jmp pin
+            data_pins, true, true,
+            false, 32, false, // autopull
+            false, // wait for txstall
+            true, unit_bits, false, // autopush
+            true, // claim pins
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            0, -1, // wrap
+            PIO_ANY_OFFSET,
+            PIO_FIFO_JOIN_NONE,
+            PIO_MOV_STATUS_DEFAULT, PIO_MOV_N_DEFAULT);
+    }
+    #if PICO_PIO_VERSION > 0
+    // wait gpio counts from the PIO's GPIO base, which must match the one SDIO_CLK was
+    // numbered from.
+    if (ok && pio_get_gpio_base(self->read_sm.pio) != self->gpio_offset) {
+        ok = false;
+    }
+    #endif
+    if (!ok) {
+        sdio_data_deinit(self, false);
+        return false;
+    }
+    // SDIO_CLK comes from another state machine on the same clock so it doesn't need
+    // synchronizing. This saves two cycles of latency on every edge.
+    hw_set_bits(&self->read_sm.pio->input_sync_bypass, 1u << (self->clock_pin - self->gpio_offset));
+    if (self->never_reset) {
+        rp2pio_statemachine_never_reset(self->read_sm.pio, self->read_sm.state_machine);
+        rp2pio_statemachine_never_reset(self->write_sm.pio, self->write_sm.state_machine);
+    }
+    return true;
+}
+
+// Stop a data state machine wherever it is, release the data lines and load Y.
+static void sdio_data_restart(rp2pio_statemachine_obj_t *sm, uint32_t count) {
+    PIO pio = sm->pio;
+    uint n = sm->state_machine;
+    pio_sm_set_enabled(pio, n, false);
+    pio_sm_clear_fifos(pio, n);
+    pio_sm_restart(pio, n);
+    pio_sm_exec(pio, n, pio_encode_set(pio_pindirs, 0));
+    pio_sm_put(pio, n, count);
+    pio_sm_exec(pio, n, pio_encode_pull(false, true));
+    pio_sm_exec(pio, n, pio_encode_mov(pio_y, pio_osr));
+    // Empty the OSR so the first out pulls data.
+    pio_sm_exec(pio, n, pio_encode_out(pio_null, 32));
+    pio_sm_exec(pio, n, pio_encode_jmp(sm->offset));
+    pio_sm_set_enabled(pio, n, true);
+}
+
+static void sdio_command_restart(sdioio_sdcard_obj_t *self) {
+    PIO pio = self->command_sm.pio;
+    uint sm = self->command_sm.state_machine;
+    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_clear_fifos(pio, sm);
+    pio_sm_restart(pio, sm);
+    pio_sm_exec(pio, sm, pio_encode_set(pio_pindirs, 0) | pio_encode_sideset(1, 0));
+    pio_sm_exec(pio, sm, pio_encode_jmp(self->command_sm.offset + SDIO_COMMAND_IDLE) | pio_encode_sideset(1, 0));
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+static bool sdio_command_idle(sdioio_sdcard_obj_t *self) {
+    PIO pio = self->command_sm.pio;
+    uint sm = self->command_sm.state_machine;
+    return pio_sm_is_tx_fifo_empty(pio, sm) && (uint8_t)(pio_sm_get_pc(pio, sm) - self->command_sm.offset) <= 2;
+}
+
+static sdmmc_err_t sdio_wait_not_busy(sdioio_sdcard_obj_t *self, int timeout_ms) {
+    uint64_t deadline = time_us_64() + (uint64_t)timeout_ms * 1000;
+    while (!gpio_get(self->data_pin)) {
+        if (time_us_64() > deadline) {
+            return SDMMC_ERR_TIMEOUT;
+        }
+    }
+    return SDMMC_OK;
+}
+
+static sdmmc_err_t sdio_command(sdioio_sdcard_obj_t *self, sdmmc_command_t *cmd) {
+    PIO pio = self->command_sm.pio;
+    uint sm = self->command_sm.state_machine;
+
+    uint8_t packet[5] = {
+        0x40 | cmd->opcode, cmd->arg >> 24, cmd->arg >> 16, cmd->arg >> 8, cmd->arg
+    };
+    uint32_t response_bits = 0;
+    size_t response_words = 0;
+    if ((cmd->flags & SCF_RSP_PRESENT) != 0) {
+        bool long_response = (cmd->flags & SCF_RSP_136) != 0;
+        response_bits = long_response ? 135 : 47;
+        response_words = long_response ? 5 : 2;
+    }
+
+    while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+        (void)pio_sm_get(pio, sm);
+    }
+    pio_sm_put_blocking(pio, sm, 47 << 24 | (response_bits ? response_bits - 1 : 0) << 16 | packet[0] << 8 | packet[1]);
+    pio_sm_put_blocking(pio, sm, packet[2] << 24 | packet[3] << 16 | packet[4] << 8 | sdio_crc7(packet, 5) << 1 | 1);
+
+    // The command, the longest wait for a response and the longest response.
+    uint64_t deadline = time_us_64() + 1000 + (48 + 64 + 136) * 1000000ull / self->frequency;
+    if (response_words == 0) {
+        while (!sdio_command_idle(self)) {
+            if (time_us_64() > deadline) {
+                sdio_command_restart(self);
+                return SDMMC_ERR_TIMEOUT;
+            }
+        }
+        return SDMMC_OK;
+    }
+
+    // R2 is longer than the FIFO so read the words as they arrive.
+    uint32_t words[5];
+    for (size_t i = 0; i < response_words; i++) {
+        while (pio_sm_is_rx_fifo_empty(pio, sm)) {
+            if (time_us_64() > deadline) {
+                cmd->response[0] = 0;
+                sdio_command_restart(self);
+                return SDMMC_ERR_TIMEOUT;
+            }
+        }
+        words[i] = pio_sm_get(pio, sm);
+    }
+    // Give the card 8 clocks before the next command.
+    busy_wait_us_32(8 * 1000000 / self->frequency + 1);
+
+    uint8_t crc;
+    uint8_t expected_crc;
+    if (response_words == 5) {
+        // Drop the start, transmission and reserved bits so the register is MSB aligned.
+        words[4] <<= 25;
+        uint8_t bytes[15];
+        for (size_t i = 0; i < 4; i++) {
+            cmd->response[3 - i] = words[i] << 7 | words[i + 1] >> 25;
+        }
+        for (size_t i = 0; i < 15; i++) {
+            bytes[i] = cmd->response[3 - i / 4] >> (24 - 8 * (i % 4));
+        }
+        crc = sdio_crc7(bytes, 15);
+        expected_crc = (cmd->response[0] >> 1) & 0x7f;
+    } else {
+        uint64_t response = (uint64_t)words[0] << 15 | words[1];
+        uint8_t bytes[5];
+        for (size_t i = 0; i < 5; i++) {
+            bytes[i] = response >> (40 - 8 * i);
+        }
+        if ((cmd->flags & SCF_RSP_IDX) != 0 && (bytes[0] & 0x3f) != cmd->opcode) {
+            return SDMMC_ERR_INVALID_RESPONSE;
+        }
+        crc = sdio_crc7(bytes, 5);
+        expected_crc = (response >> 1) & 0x7f;
+        cmd->response[0] = response >> 8;
+    }
+    if ((cmd->flags & SCF_RSP_CRC) != 0 && crc != expected_crc) {
+        return SDMMC_ERR_INVALID_RESPONSE;
+    }
+
+    if ((cmd->flags & (SCF_RSP_BSY | SCF_WAIT_BUSY)) != 0) {
+        return sdio_wait_not_busy(self, cmd->timeout_ms);
+    }
+    return SDMMC_OK;
+}
+
+static sdmmc_err_t sdio_stop_transmission(sdioio_sdcard_obj_t *self) {
+    sdmmc_command_t cmd = {
+        .opcode = MMC_STOP_TRANSMISSION,
+        .flags = SCF_CMD_AC | SCF_RSP_R1B,
+        .timeout_ms = SDMMC_WRITE_CMD_TIMEOUT_MS,
+    };
+    return sdio_command(self, &cmd);
+}
+
+static bool sdio_claim_dma(int *data_channel, int *control_channel) {
+    *data_channel = dma_claim_unused_channel(false);
+    *control_channel = dma_claim_unused_channel(false);
+    if (*data_channel < 0 || *control_channel < 0) {
+        if (*data_channel >= 0) {
+            dma_channel_unclaim(*data_channel);
+        }
+        if (*control_channel >= 0) {
+            dma_channel_unclaim(*control_channel);
+        }
+        return false;
+    }
+    return true;
+}
+
+static void sdio_release_dma(int data_channel, int control_channel) {
+    // Unchain the data channel so aborting it doesn't start the control channel again.
+    hw_write_masked(&dma_hw->ch[data_channel].al1_ctrl, data_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB, DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+    dma_channel_abort(data_channel);
+    dma_channel_abort(control_channel);
+    dma_channel_unclaim(data_channel);
+    dma_channel_unclaim(control_channel);
+}
+
+// The data channel moves one run of FIFO words and then chains to the control channel, which
+// reloads its address and count from the next control block. A zero count ends the chain.
+static void sdio_start_dma(sdioio_sdcard_obj_t *self, rp2pio_statemachine_obj_t *sm, bool read,
+    int data_channel, int control_channel) {
+    PIO pio = sm->pio;
+    uint n = sm->state_machine;
+    uint8_t unit = sdio_unit_size(self);
+
+    dma_channel_config c = dma_channel_get_default_config(data_channel);
+    channel_config_set_transfer_data_size(&c, unit == 4 ? DMA_SIZE_32 : DMA_SIZE_16);
+    channel_config_set_read_increment(&c, !read);
+    channel_config_set_write_increment(&c, read);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, n, !read));
+    channel_config_set_bswap(&c, true);
+    channel_config_set_chain_to(&c, control_channel);
+    if (read) {
+        dma_channel_configure(data_channel, &c, NULL, &pio->rxf[n], 0, false);
+    } else {
+        // Left shifting state machines take narrow writes from the top of the FIFO word.
+        dma_channel_configure(data_channel, &c, (uint8_t *)&pio->txf[n] + 4 - unit, NULL, 0, false);
+    }
+
+    c = dma_channel_get_default_config(control_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, true);
+    // Wrap writes around the two registers that retrigger the data channel.
+    channel_config_set_ring(&c, true, 3);
+    volatile void *target = read ? (volatile void *)&dma_hw->ch[data_channel].al1_write_addr
+        : (volatile void *)&dma_hw->ch[data_channel].al3_transfer_count;
+    dma_channel_configure(control_channel, &c, target, self->control_blocks, 2, true);
+}
+
+static sdmmc_err_t sdio_read_blocks(sdioio_sdcard_obj_t *self, sdmmc_command_t *cmd,
+    size_t block_size, size_t block_count, int data_channel, int control_channel) {
+    uint8_t *data = cmd->data;
+    uint8_t unit = sdio_unit_size(self);
+    uint8_t crc_size = sdio_crc_size(self);
+
+    uint32_t *control = self->control_blocks;
+    for (size_t i = 0; i < block_count; i++) {
+        *control++ = (uint32_t)(data + i * block_size);
+        *control++ = block_size / unit;
+        *control++ = (uint32_t)self->block_trailers[i];
+        *control++ = crc_size / unit;
+    }
+    *control++ = 0;
+    *control++ = 0;
+
+    // The first block can follow the response immediately so be ready before sending the command.
+    sdio_data_restart(&self->read_sm, (block_size + crc_size) * 8 / self->width - 1);
+    sdio_start_dma(self, &self->read_sm, true, data_channel, control_channel);
+
+    sdmmc_err_t err = sdio_command(self, cmd);
+    if (err != SDMMC_OK) {
+        return err;
+    }
+
+    // Check each block's CRC while later ones are still arriving. A block is complete once the
+    // control channel has loaded the control block after its CRC.
+    uint64_t deadline = time_us_64() + (uint64_t)cmd->timeout_ms * 1000;
+    size_t checked = 0;
+    uint8_t crc[8];
+    while (checked < block_count) {
+        size_t loaded = (dma_hw->ch[control_channel].read_addr - (uint32_t)self->control_blocks) / 8;
+        if (loaded < 2 * checked + 3) {
+            if (time_us_64() > deadline) {
+                err = SDMMC_ERR_TIMEOUT;
+                break;
+            }
+            continue;
+        }
+        sdio_block_crc(self, data + checked * block_size, block_size, crc);
+        if (memcmp(crc, self->block_trailers[checked], crc_size) != 0) {
+            err = SDMMC_ERR_INVALID_RESPONSE;
+            break;
+        }
+        checked++;
+    }
+
+    if ((cmd->flags & SCF_AUTO_STOP) != 0) {
+        sdmmc_err_t stop_err = sdio_stop_transmission(self);
+        if (err == SDMMC_OK) {
+            err = stop_err;
+        }
+    }
+    return err;
+}
+
+static sdmmc_err_t sdio_write_blocks(sdioio_sdcard_obj_t *self, sdmmc_command_t *cmd,
+    size_t block_size, size_t block_count, int data_channel, int control_channel) {
+    static const uint8_t start_4bit[4] __attribute__((aligned(4))) = {0xff, 0xff, 0xff, 0xf0};
+    static const uint8_t start_1bit[2] __attribute__((aligned(4))) = {0xff, 0xfe};
+    const uint8_t *data = cmd->data;
+    uint8_t unit = sdio_unit_size(self);
+    uint8_t crc_size = sdio_crc_size(self);
+    const uint8_t *start = self->width == 4 ? start_4bit : start_1bit;
+
+    // Each block is idle bits and the start bit, the data, then the CRC with the end bit.
+    uint32_t *control = self->control_blocks;
+    for (size_t i = 0; i < block_count; i++) {
+        uint8_t *trailer = (uint8_t *)self->block_trailers[i];
+        sdio_block_crc(self, data + i * block_size, block_size, trailer);
+        memset(trailer + crc_size, 0xff, unit);
+        *control++ = 1;
+        *control++ = (uint32_t)start;
+        *control++ = block_size / unit;
+        *control++ = (uint32_t)(data + i * block_size);
+        *control++ = (crc_size + unit) / unit;
+        *control++ = (uint32_t)trailer;
+    }
+    *control++ = 0;
+    *control++ = 0;
+
+    sdio_data_restart(&self->write_sm, (unit + block_size + crc_size) * 8 / self->width - 1);
+
+    sdmmc_err_t err = sdio_command(self, cmd);
+    if (err != SDMMC_OK) {
+        return err;
+    }
+    sdio_start_dma(self, &self->write_sm, false, data_channel, control_channel);
+
+    PIO pio = self->write_sm.pio;
+    uint sm = self->write_sm.state_machine;
+    uint64_t deadline = time_us_64() + (uint64_t)cmd->timeout_ms * 1000;
+    size_t accepted = 0;
+    while (accepted < block_count) {
+        if (pio_sm_is_rx_fifo_empty(pio, sm)) {
+            if (time_us_64() > deadline) {
+                err = SDMMC_ERR_TIMEOUT;
+                break;
+            }
+            continue;
+        }
+        // The three status bits between the start and end bit: 010 means the data was accepted.
+        if (((pio_sm_get(pio, sm) >> 5) & 0x7) != 0x2) {
+            err = SDMMC_ERR_INVALID_RESPONSE;
+            break;
+        }
+        accepted++;
+    }
+    if (err == SDMMC_OK) {
+        err = sdio_wait_not_busy(self, cmd->timeout_ms);
+    }
+    if (err != SDMMC_OK) {
+        // Don't leave the data lines driven.
+        sdio_data_restart(&self->write_sm, 0);
+    }
+
+    if ((cmd->flags & SCF_AUTO_STOP) != 0) {
+        sdmmc_err_t stop_err = sdio_stop_transmission(self);
+        if (err == SDMMC_OK) {
+            err = stop_err;
+        }
+    }
+    return err;
+}
+
+/*!< Host function to initialize the driver */
+static sdmmc_err_t _init(void) {
+    return SDMMC_OK;
+}
+
+/*!< host function to set bus width */
+static sdmmc_err_t _set_bus_width(int slot, size_t width) {
+    sdioio_sdcard_obj_t *self = sdcards[slot];
+    if (width != 1 && width != 4) {
+        return SDMMC_ERR_INVALID_ARG;
+    }
+    self->width = width;
+    if (!sdio_data_construct(self)) {
+        return SDMMC_ERR_NO_MEM;
+    }
+    return SDMMC_OK;
+}
+
+/*!< host function to get the maximum bus width of a particular slot */
+static size_t _get_bus_width(int slot) {
+    return sdcards[slot]->num_data;
+}
+
+static void sdio_set_frequency(sdioio_sdcard_obj_t *self, uint32_t frequency) {
+    common_hal_rp2pio_statemachine_set_frequency(&self->command_sm, frequency * 2);
+    self->frequency = common_hal_rp2pio_statemachine_get_frequency(&self->command_sm) / 2;
+}
+
+/*!< host function to set card clock frequency */
+static sdmmc_err_t _set_card_clk(int slot, uint32_t freq_khz) {
+    sdioio_sdcard_obj_t *self = sdcards[slot];
+    uint32_t frequency = freq_khz * 1000;
+    if (freq_khz >= SDMMC_FREQ_DEFAULT) {
+        // sdmmc asks for more than the default speed only once the card is in high speed mode.
+        bool high_speed = freq_khz > SDMMC_FREQ_DEFAULT;
+        frequency = MIN(self->max_frequency, high_speed ? SDIO_HIGH_SPEED_MAX : SDIO_DEFAULT_SPEED_MAX);
+        if (high_speed != self->high_speed) {
+            self->high_speed = high_speed;
+            if (!sdio_data_construct(self)) {
+                return SDMMC_ERR_NO_MEM;
+            }
+        }
+    }
+    sdio_set_frequency(self, MIN(frequency, self->max_frequency));
+    return SDMMC_OK;
+}
+
+/*!< host function to do a transaction */
+static sdmmc_err_t _do_transaction(int slot, sdmmc_command_t *cmdinfo) {
+    sdioio_sdcard_obj_t *self = sdcards[slot];
+    if (cmdinfo->data == NULL || cmdinfo->datalen == 0) {
+        return sdio_command(self, cmdinfo);
+    }
+
+    size_t block_size = cmdinfo->blklen;
+    size_t block_count = cmdinfo->datalen / block_size;
+    if (block_count > SDIO_MAX_BLOCKS || cmdinfo->datalen % block_size != 0 ||
+        block_size % sdio_unit_size(self) != 0 || ((uint32_t)cmdinfo->data & 0x3) != 0) {
+        return SDMMC_ERR_INVALID_SIZE;
+    }
+    if (common_hal_rp2pio_statemachine_deinited(&self->read_sm)) {
+        return SDMMC_ERR_NOT_SUPPORTED;
+    }
+
+    int data_channel, control_channel;
+    if (!sdio_claim_dma(&data_channel, &control_channel)) {
+        return SDMMC_ERR_NO_MEM;
+    }
+    sdmmc_err_t err;
+    if ((cmdinfo->flags & SCF_CMD_READ) != 0) {
+        err = sdio_read_blocks(self, cmdinfo, block_size, block_count, data_channel, control_channel);
+    } else {
+        err = sdio_write_blocks(self, cmdinfo, block_size, block_count, data_channel, control_channel);
+    }
+    sdio_release_dma(data_channel, control_channel);
+    return err;
+}
+
+/*!< host function to deinitialize the driver, called with the `slot` */
+static sdmmc_err_t _deinit(int slot) {
+    return SDMMC_OK;
+}
+
+void common_hal_sdioio_sdcard_construct(sdioio_sdcard_obj_t *self,
+    const mcu_pin_obj_t *clock, const mcu_pin_obj_t *command,
+    uint8_t num_data, const mcu_pin_obj_t **data, uint32_t frequency) {
+
+    if (num_data != 1 && num_data != 4) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Number of data_pins must be %d or %d, not %d"), 1, 4, num_data);
+    }
+    for (size_t i = 1; i < num_data; i++) {
+        if (data[i]->number != data[0]->number + i) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Pins must be sequential GPIO pins"));
+        }
+    }
+    mp_arg_validate_int_min(frequency, SDMMC_FREQ_PROBING * 1000, MP_QSTR_frequency);
+
+    uint8_t gpio_offset = 0;
+    #if NUM_BANK0_GPIOS > 32
+    uint8_t lowest = MIN(MIN(clock->number, command->number), data[0]->number);
+    uint8_t highest = MAX(MAX(clock->number, command->number), data[num_data - 1]->number);
+    if (highest >= 32) {
+        if (lowest < 16) {
+            raise_ValueError_invalid_pins();
+        }
+        gpio_offset = 16;
+    }
+    #endif
+
+    size_t slot = 0;
+    while (slot < MP_ARRAY_SIZE(sdcards) && sdcards[slot] != NULL) {
+        slot++;
+    }
+    if (slot == MP_ARRAY_SIZE(sdcards)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All state machines in use"));
+    }
+
+    self->slot = slot;
+    self->num_data = num_data;
+    self->width = 1;
+    self->high_speed = false;
+    self->never_reset = false;
+    self->gpio_offset = gpio_offset;
+    self->clock_pin = clock->number;
+    self->command_pin = command->number;
+    self->data_pin = data[0]->number;
+    self->max_frequency = MIN(frequency, clock_get_hz(clk_sys) / SDIO_CLOCK_DIVISOR);
+    self->command_sm.state_machine = NUM_PIO_STATE_MACHINES;
+    self->read_sm.state_machine = NUM_PIO_STATE_MACHINES;
+    self->write_sm.state_machine = NUM_PIO_STATE_MACHINES;
+
+    // The data state machines go first so they get the PIO with the most room.
+    bool ok = sdio_data_construct(self);
+    if (ok) {
+        sdio_build_command_program(self);
+        ok = rp2pio_statemachine_construct(&self->command_sm,
+            self->command_program, SDIO_COMMAND_PROGRAM_LEN,
+            SDMMC_FREQ_PROBING * 1000 * 2,
+            NULL, 0, // init
+            command, 1, // out pins
+            command, 1, // in pins
+            PIO_PINMASK_FROM_PIN(command->number), PIO_PINMASK_NONE, // pull up
+            command, 1, // set pins
+            clock, 1, false, // sideset pins
+            PIO_PINMASK_FROM_PIN(command->number), PIO_PINMASK_FROM_PIN(clock->number), // initial pin state and direction
+            command, // jmp pin
+            PIO_PINMASK_OR(PIO_PINMASK_FROM_PIN(clock->number), PIO_PINMASK_FROM_PIN(command->number)), true, true,
+            true, 32, false, // autopull
+            false, // wait for txstall
+            true, 32, false, // autopush
+            true, // claim pins
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            1, 2, // wrap around the idle loop
+            PIO_ANY_OFFSET,
+            PIO_FIFO_JOIN_NONE,
+            STATUS_TX_LESSTHAN, 1);
+    }
+    if (!ok) {
+        common_hal_sdioio_sdcard_deinit(self);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("All state machines in use"));
+    }
+    self->frequency = common_hal_rp2pio_statemachine_get_frequency(&self->command_sm) / 2;
+    sdcards[slot] = self;
+
+    self->host_info = (sdmmc_host_t) {
+        .flags = SDMMC_HOST_FLAG_1BIT | SDMMC_HOST_FLAG_4BIT | SDMMC_HOST_FLAG_DEINIT_ARG,
+        .slot = slot,
+        .max_freq_khz = self->max_frequency / 1000,
+        .io_voltage = 3.3f,
+        .command_timeout_ms = 0,
+        .init = _init,
+        .set_bus_width = _set_bus_width,
+        .get_bus_width = _get_bus_width,
+        .set_bus_ddr_mode = NULL,
+        .set_card_clk = _set_card_clk,
+        .do_transaction = _do_transaction,
+        .deinit_p = _deinit,
+    };
+
+    // Let the card see at least 74 clocks before the first command.
+    mp_hal_delay_ms(1);
+
+    sdmmc_err_t err = SDMMC_ERR_INVALID_RESPONSE;
+    size_t tries = 3;
+    while (err == SDMMC_ERR_INVALID_RESPONSE && tries > 0) {
+        err = sdmmc_card_init(&self->host_info, &self->card_info);
+        tries--;
+    }
+    if (err != SDMMC_OK) {
+        common_hal_sdioio_sdcard_deinit(self);
+        mp_raise_OSError_msg_varg(MP_ERROR_TEXT("SDIO Init Error %x"), err);
+    }
+
+    self->capacity = self->card_info.csd.capacity;
+}
+
+uint32_t common_hal_sdioio_sdcard_get_count(sdioio_sdcard_obj_t *self) {
+    return self->capacity;
+}
+
+uint32_t common_hal_sdioio_sdcard_get_frequency(sdioio_sdcard_obj_t *self) {
+    return self->frequency;
+}
+
+uint8_t common_hal_sdioio_sdcard_get_width(sdioio_sdcard_obj_t *self) {
+    return self->width;
+}
+
+static void check_whole_block(mp_buffer_info_t *bufinfo) {
+    if (bufinfo->len % 512) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffer length must be a multiple of 512"));
+    }
+}
+
+int common_hal_sdioio_sdcard_writeblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
+    check_for_deinit(self);
+    check_whole_block(bufinfo);
+    const uint8_t *buf = bufinfo->buf;
+    size_t block_count = bufinfo->len / 512;
+    while (block_count > 0) {
+        size_t n = MIN(block_count, SDIO_MAX_BLOCKS);
+        if (sdmmc_write_sectors(&self->card_info, buf, start_block, n) != SDMMC_OK) {
+            return -EIO;
+        }
+        buf += n * 512;
+        start_block += n;
+        block_count -= n;
+    }
+    return 0;
+}
+
+int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *bufinfo) {
+    check_for_deinit(self);
+    check_whole_block(bufinfo);
+    uint8_t *buf = bufinfo->buf;
+    size_t block_count = bufinfo->len / 512;
+    while (block_count > 0) {
+        size_t n = MIN(block_count, SDIO_MAX_BLOCKS);
+        if (sdmmc_read_sectors(&self->card_info, buf, start_block, n) != SDMMC_OK) {
+            return -EIO;
+        }
+        buf += n * 512;
+        start_block += n;
+        block_count -= n;
+    }
+    return 0;
+}
+
+bool common_hal_sdioio_sdcard_configure(sdioio_sdcard_obj_t *self, uint32_t frequency, uint8_t bits) {
+    check_for_deinit(self);
+    if (bits != 0 && bits != self->width) {
+        if (bits > self->num_data || (bits == 4 && !(self->card_info.scr.bus_width & SCR_SD_BUS_WIDTHS_4BIT))) {
+            return false;
+        }
+        if (sdmmc_send_cmd_set_bus_width(&self->card_info, bits) != SDMMC_OK ||
+            _set_bus_width(self->slot, bits) != SDMMC_OK) {
+            return false;
+        }
+    }
+    if (frequency != 0) {
+        self->max_frequency = MIN(frequency, clock_get_hz(clk_sys) / SDIO_CLOCK_DIVISOR);
+        sdio_set_frequency(self, MIN(self->max_frequency, self->high_speed ? SDIO_HIGH_SPEED_MAX : SDIO_DEFAULT_SPEED_MAX));
+    }
+    return true;
+}
+
+bool common_hal_sdioio_sdcard_deinited(sdioio_sdcard_obj_t *self) {
+    return common_hal_rp2pio_statemachine_deinited(&self->command_sm);
+}
+
+void common_hal_sdioio_sdcard_deinit(sdioio_sdcard_obj_t *self) {
+    if (!common_hal_rp2pio_statemachine_deinited(&self->read_sm)) {
+        hw_clear_bits(&self->read_sm.pio->input_sync_bypass, 1u << (self->clock_pin - self->gpio_offset));
+    }
+    sdio_data_deinit(self, false);
+    if (!common_hal_rp2pio_statemachine_deinited(&self->command_sm)) {
+        rp2pio_statemachine_deinit(&self->command_sm, false);
+    }
+    if (sdcards[self->slot] == self) {
+        sdcards[self->slot] = NULL;
+    }
+}
+
+void common_hal_sdioio_sdcard_never_reset(sdioio_sdcard_obj_t *self) {
+    rp2pio_statemachine_never_reset(self->command_sm.pio, self->command_sm.state_machine);
+    rp2pio_statemachine_never_reset(self->read_sm.pio, self->read_sm.state_machine);
+    rp2pio_statemachine_never_reset(self->write_sm.pio, self->write_sm.state_machine);
+    never_reset_pin_number(self->clock_pin);
+    never_reset_pin_number(self->command_pin);
+    for (size_t i = 0; i < self->num_data; i++) {
+        never_reset_pin_number(self->data_pin + i);
+    }
+    self->never_reset = true;
+}
+
+void sdioio_reset(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(sdcards); i++) {
+        if (sdcards[i] != NULL && !sdcards[i]->never_reset) {
+            sdcards[i] = NULL;
+        }
+    }
+}
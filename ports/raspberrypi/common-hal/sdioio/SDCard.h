@@ -0,0 +1,54 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "common-hal/microcontroller/Pin.h"
+#include "common-hal/rp2pio/StateMachine.h"
+
+#include "lib/sdmmc/include/sdmmc_types.h"
+
+// The most blocks moved by one multi-block command. Longer reads and writes are split up.
+#define SDIO_MAX_BLOCKS (32)
+
+#define SDIO_COMMAND_PROGRAM_LEN (19)
+#define SDIO_READ_PROGRAM_LEN (9)
+#define SDIO_WRITE_PROGRAM_LEN (21)
+
+typedef struct {
+    mp_obj_base_t base;
+    sdmmc_host_t host_info;
+    sdmmc_card_t card_info;
+    // Runs SDIO_CLK all the time and sends commands on SDIO_CMD.
+    rp2pio_statemachine_obj_t command_sm;
+    // Follow SDIO_CLK to move blocks on the data lines.
+    rp2pio_statemachine_obj_t read_sm;
+    rp2pio_statemachine_obj_t write_sm;
+    // The programs depend on the pins, bus width and speed mode so they are built at runtime.
+    uint16_t command_program[SDIO_COMMAND_PROGRAM_LEN];
+    uint16_t read_program[SDIO_READ_PROGRAM_LEN];
+    uint16_t write_program[SDIO_WRITE_PROGRAM_LEN];
+    // DMA control blocks: up to three transfers per block plus the null trigger that ends the chain.
+    uint32_t control_blocks[(3 * SDIO_MAX_BLOCKS + 1) * 2];
+    // Per block CRC16 (and the end bits when writing).
+    uint32_t block_trailers[SDIO_MAX_BLOCKS][3];
+    uint32_t frequency;
+    uint32_t max_frequency;
+    uint32_t capacity;
+    uint8_t slot;
+    uint8_t num_data;
+    uint8_t width;
+    uint8_t gpio_offset;
+    uint8_t clock_pin;
+    uint8_t command_pin;
+    uint8_t data_pin;
+    bool high_speed;
+    bool never_reset;
+} sdioio_sdcard_obj_t;
+
+void sdioio_reset(void);
@@ -155,6 +155,11 @@ static void lwip_socket_free_incoming(socketpool_socket_obj_t *socket) {
             pbuf_free(socket->incoming.pbuf);
             socket->incoming.pbuf = NULL;
         }
+        while (socket->udp_queue_len > 0) {
+            pbuf_free(socket->udp_queue[socket->udp_queue_get].pbuf);
+            socket->udp_queue_get = (socket->udp_queue_get + 1) % CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN;
+            socket->udp_queue_len--;
+        }
     } else {
         uint8_t alloc = socket->incoming.connection.alloc;
         struct tcp_pcb *volatile *tcp_array = lwip_socket_incoming_array(socket);
@@ -203,7 +208,8 @@ static u8_t _lwip_raw_incoming(void *arg, struct raw_pcb *pcb, struct pbuf *p, c
 #endif
 
 // Callback for incoming UDP packets. We simply stash the packet and the source address,
-// in case we need it for recvfrom.
+// in case we need it for recvfrom. Packets arriving before the last is read are queued so a
+// burst isn't lost.
 #if LWIP_VERSION_MAJOR < 2
 static void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p, ip_addr_t *addr, u16_t port)
 #else
@@ -212,13 +218,20 @@ static void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p,
 {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        // That's why they call it "unreliable". No room in the inn, drop the packet.
-        pbuf_free(p);
-    } else {
+    if (socket->incoming.pbuf == NULL) {
         socket->incoming.pbuf = p;
         socket->peer_port = (mp_uint_t)port;
         memcpy(&socket->peer, addr, sizeof(socket->peer));
+    } else if (socket->udp_queue_len < CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN) {
+        socketpool_udp_datagram_t *datagram = &socket->udp_queue[
+            (socket->udp_queue_get + socket->udp_queue_len) % CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN];
+        datagram->pbuf = p;
+        datagram->peer_port = port;
+        memcpy(&datagram->peer, addr, sizeof(datagram->peer));
+        socket->udp_queue_len++;
+    } else {
+        // That's why they call it "unreliable". No room in the inn, drop the packet.
+        pbuf_free(p);
     }
 }
 
@@ -443,6 +456,16 @@ static mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
     pbuf_free(p);
     socket->incoming.pbuf = NULL;
 
+    // The next queued datagram is the one to read now.
+    if (socket->udp_queue_len > 0) {
+        socketpool_udp_datagram_t *datagram = &socket->udp_queue[socket->udp_queue_get];
+        socket->incoming.pbuf = datagram->pbuf;
+        socket->peer_port = datagram->peer_port;
+        memcpy(&socket->peer, &datagram->peer, sizeof(socket->peer));
+        socket->udp_queue_get = (socket->udp_queue_get + 1) % CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN;
+        socket->udp_queue_len--;
+    }
+
     MICROPY_PY_LWIP_EXIT
 
     return (mp_uint_t)result;
@@ -686,6 +709,8 @@ bool socketpool_socket(socketpool_socketpool_obj_t *self,
 
     socket->timeout = -1;
     socket->recv_offset = 0;
+    socket->udp_queue_get = 0;
+    socket->udp_queue_len = 0;
     socket->domain = SOCKETPOOL_AF_INET;
     socket->type = type;
     socket->callback = MP_OBJ_NULL;
@@ -827,6 +852,7 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, mp_obj_t *peer_out,
     accepted->timeout = self->timeout;
     accepted->state = STATE_CONNECTED;
     accepted->recv_offset = 0;
+    accepted->udp_queue_len = 0;
     accepted->callback = MP_OBJ_NULL;
     tcp_arg(accepted->pcb.tcp, (void *)accepted);
     tcp_err(accepted->pcb.tcp, _lwip_tcp_error);
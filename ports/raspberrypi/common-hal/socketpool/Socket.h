@@ -13,6 +13,18 @@
 
 #include "common-hal/socketpool/SocketPool.h"
 
+// How many more UDP datagrams are held while one is already waiting to be read. Later ones are
+// dropped.
+#ifndef CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN
+#define CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN (4)
+#endif
+
+typedef struct {
+    struct pbuf *pbuf;
+    ip_addr_t peer;
+    uint16_t peer_port;
+} socketpool_udp_datagram_t;
+
 typedef struct _lwip_socket_obj_t {
     mp_obj_base_t base;
 
@@ -40,6 +52,11 @@ typedef struct _lwip_socket_obj_t {
     mp_uint_t timeout;
     uint16_t recv_offset;
 
+    // UDP datagrams that arrived after the one in incoming.pbuf, oldest at udp_queue_get.
+    socketpool_udp_datagram_t udp_queue[CIRCUITPY_SOCKETPOOL_UDP_QUEUE_LEN];
+    uint8_t udp_queue_get;
+    uint8_t udp_queue_len;
+
     uint8_t domain;
     uint8_t type;
 
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "bindings/rp2pio/StateMachine.h"
+#include "core1_worker.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/Processor.h"
 #include "shared-bindings/usb_host/Port.h"
@@ -161,6 +162,7 @@ usb_host_port_obj_t *common_hal_usb_host_port_construct(const mcu_pin_obj_t *dp,
     common_hal_never_reset_pin(dm);
 
     // Core 1 will run the SOF interrupt directly.
+    core1_worker_claim();
     _core1_ready = false;
     multicore_launch_core1(core1_main);
     while (!_core1_ready) {
@@ -0,0 +1,154 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "core1_worker.h"
+
+#include "py/mpconfig.h"
+#include "supervisor/port.h"
+
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+
+// Power of two so the free running indices can wrap.
+#define CORE1_WORKER_QUEUE_LEN (8)
+
+// Single producer, single consumer. The producer only writes head and the consumer only tail.
+typedef struct {
+    core1_worker_job_t *volatile jobs[CORE1_WORKER_QUEUE_LEN];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+} job_ring_t;
+
+// core0 to core1.
+static job_ring_t pending;
+// core1 to core0, for jobs with a callback.
+static job_ring_t finished;
+
+static volatile bool core1_running = false;
+static bool core1_claimed = false;
+
+static bool ring_push(job_ring_t *ring, core1_worker_job_t *job) {
+    if (ring->head - ring->tail == CORE1_WORKER_QUEUE_LEN) {
+        return false;
+    }
+    ring->jobs[ring->head % CORE1_WORKER_QUEUE_LEN] = job;
+    // Publish the job before the index that makes it visible.
+    __dmb();
+    ring->head++;
+    return true;
+}
+
+static core1_worker_job_t *ring_pop(job_ring_t *ring) {
+    if (ring->tail == ring->head) {
+        return NULL;
+    }
+    __dmb();
+    core1_worker_job_t *job = ring->jobs[ring->tail % CORE1_WORKER_QUEUE_LEN];
+    __dmb();
+    ring->tail++;
+    return job;
+}
+
+static void __not_in_flash_func(core1_main)(void) {
+    // Lets core0 park this core in RAM while it writes to flash.
+    multicore_lockout_victim_init();
+    core1_running = true;
+    __sev();
+
+    while (true) {
+        core1_worker_job_t *job = ring_pop(&pending);
+        if (job == NULL) {
+            __wfe();
+            continue;
+        }
+        job->fun(job->data);
+        __dmb();
+        job->done = true;
+        if (job->callback != NULL) {
+            // The ring holds as many jobs as can be pending, so this can't be full.
+            ring_push(&finished, job);
+        }
+        __sev();
+    }
+}
+
+bool core1_worker_submit(core1_worker_job_t *job) {
+    if (core1_claimed) {
+        return false;
+    }
+    if (!core1_running) {
+        pending.head = pending.tail = 0;
+        finished.head = finished.tail = 0;
+        multicore_launch_core1(core1_main);
+        while (!core1_running) {
+            __wfe();
+        }
+    }
+    job->done = false;
+    if (!ring_push(&pending, job)) {
+        return false;
+    }
+    __sev();
+    return true;
+}
+
+void core1_worker_claim(void) {
+    core1_claimed = true;
+    if (core1_running) {
+        multicore_reset_core1();
+        core1_running = false;
+    }
+}
+
+void core1_worker_release(void) {
+    core1_claimed = false;
+}
+
+void core1_worker_flash_lockout_start(void) {
+    if (core1_running) {
+        multicore_lockout_start_blocking();
+    }
+}
+
+void core1_worker_flash_lockout_end(void) {
+    if (core1_running) {
+        multicore_lockout_end_blocking();
+    }
+}
+
+void core1_worker_background(void) {
+    core1_worker_job_t *job;
+    while ((job = ring_pop(&finished)) != NULL) {
+        background_callback_add_core(job->callback);
+    }
+}
+
+typedef struct {
+    port_split_fun_t fun;
+    void *data;
+    size_t start;
+    size_t end;
+} split_range_t;
+
+static void run_split_range(void *data) {
+    split_range_t *range = data;
+    range->fun(range->data, range->start, range->end);
+}
+
+void port_run_split(port_split_fun_t fun, void *data, size_t count) {
+    size_t half = count / 2;
+    split_range_t range = { fun, data, half, count };
+    core1_worker_job_t job = { .fun = run_split_range, .data = &range, .callback = NULL };
+    if (half == 0 || !core1_worker_submit(&job)) {
+        fun(data, 0, count);
+        return;
+    }
+    fun(data, 0, half);
+    while (!job.done) {
+        __wfe();
+    }
+    __dmb();
+}
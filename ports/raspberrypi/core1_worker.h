@@ -0,0 +1,36 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "supervisor/background_callback.h"
+
+// Runs native work on core1 while it isn't used by anything else. Jobs run in the order they are
+// submitted. A job's function runs on core1 so it must not allocate, raise or otherwise touch the
+// VM, and whatever data it uses must stay valid until it is done.
+typedef struct {
+    void (*fun)(void *data);
+    void *data;
+    // Queued from port_background_task() on core0 once fun has returned. May be NULL.
+    background_callback_t *callback;
+    volatile bool done;
+} core1_worker_job_t;
+
+// Returns false, without running the job, if core1 is in use or the queue is full.
+bool core1_worker_submit(core1_worker_job_t *job);
+
+// For code that runs its own program on core1. Stops the worker until core1_worker_release().
+void core1_worker_claim(void);
+void core1_worker_release(void);
+
+// Keep core1 off flash while core0 writes to it.
+void core1_worker_flash_lockout_start(void);
+void core1_worker_flash_lockout_end(void);
+
+// Called from port_background_task() to queue the callbacks of finished jobs.
+void core1_worker_background(void);
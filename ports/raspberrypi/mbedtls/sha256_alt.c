@@ -0,0 +1,231 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "mbedtls/sha256.h"
+
+#include "hardware/resets.h"
+#include "hardware/structs/sha256.h"
+
+// The context using the hardware, if any. It has fed the block every whole 64 bytes since it
+// started.
+static mbedtls_sha256_context *hardware_owner = NULL;
+
+static const uint32_t initial_state[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+static const uint32_t initial_state_224[8] = {
+    0xC1059ED8, 0x367CD507, 0x3070DD17, 0xF70E5939, 0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4,
+};
+
+static const uint32_t k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+static inline uint32_t ror(uint32_t x, int n) {
+    return x >> n | x << (32 - n);
+}
+
+static inline uint32_t load_be32(const unsigned char *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static inline void store_be32(unsigned char *p, uint32_t value) {
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+static void software_process(uint32_t state[8], const unsigned char data[64]) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = load_be32(data + 4 * i);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (ror(e, 6) ^ ror(e, 11) ^ ror(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+        uint32_t t2 = (ror(a, 2) ^ ror(a, 13) ^ ror(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+static void hardware_start(void) {
+    unreset_block_wait(RESETS_RESET_SHA256_BITS);
+    // Swap bytes so that words loaded little endian are taken in the big endian order SHA-256
+    // uses. This also swaps the SUM registers when they are read.
+    hw_set_bits(&sha256_hw->csr, SHA256_CSR_BSWAP_BITS);
+    hw_set_bits(&sha256_hw->csr, SHA256_CSR_START_BITS);
+}
+
+static void hardware_process(const unsigned char data[64]) {
+    while ((sha256_hw->csr & SHA256_CSR_WDATA_RDY_BITS) == 0) {
+    }
+    for (int i = 0; i < 16; i++) {
+        uint32_t word;
+        memcpy(&word, data + 4 * i, sizeof(word));
+        sha256_hw->wdata = word;
+    }
+}
+
+// Copies the hash of the blocks fed so far into the owner's state.
+static void hardware_read_state(mbedtls_sha256_context *ctx) {
+    while ((sha256_hw->csr & SHA256_CSR_SUM_VLD_BITS) == 0) {
+    }
+    for (int i = 0; i < 8; i++) {
+        ctx->state[i] = __builtin_bswap32(sha256_hw->sum[i]);
+    }
+}
+
+// first is true for the context's first block.
+static void process(mbedtls_sha256_context *ctx, const unsigned char data[64], bool first) {
+    // Only a SHA-256 context that hasn't hashed anything yet can take over the free block.
+    if (first && hardware_owner == NULL && !ctx->is224) {
+        hardware_owner = ctx;
+        hardware_start();
+    }
+    if (hardware_owner == ctx) {
+        hardware_process(data);
+    } else {
+        software_process(ctx->state, data);
+    }
+}
+
+static void release(mbedtls_sha256_context *ctx) {
+    if (hardware_owner == ctx) {
+        hardware_read_state(ctx);
+        hardware_owner = NULL;
+    }
+}
+
+void mbedtls_sha256_init(mbedtls_sha256_context *ctx) {
+    memset(ctx, 0, sizeof(mbedtls_sha256_context));
+}
+
+void mbedtls_sha256_free(mbedtls_sha256_context *ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+    if (hardware_owner == ctx) {
+        hardware_owner = NULL;
+    }
+    memset(ctx, 0, sizeof(mbedtls_sha256_context));
+}
+
+void mbedtls_sha256_clone(mbedtls_sha256_context *dst, const mbedtls_sha256_context *src) {
+    if (hardware_owner == src) {
+        // src keeps the hardware and the copy carries on in software.
+        hardware_read_state((mbedtls_sha256_context *)src);
+    }
+    if (hardware_owner == dst) {
+        hardware_owner = NULL;
+    }
+    *dst = *src;
+}
+
+int mbedtls_sha256_starts_ret(mbedtls_sha256_context *ctx, int is224) {
+    if (hardware_owner == ctx) {
+        hardware_owner = NULL;
+    }
+    ctx->total[0] = 0;
+    ctx->total[1] = 0;
+    ctx->is224 = is224;
+    memcpy(ctx->state, is224 ? initial_state_224 : initial_state, sizeof(ctx->state));
+    return 0;
+}
+
+int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx, const unsigned char data[64]) {
+    // Called directly, the block isn't counted in total so it can't tell the hardware apart.
+    release(ctx);
+    software_process(ctx->state, data);
+    return 0;
+}
+
+int mbedtls_sha256_update_ret(mbedtls_sha256_context *ctx, const unsigned char *input, size_t ilen) {
+    // Whether the next block is the context's first.
+    bool first = ctx->total[0] < 64 && ctx->total[1] == 0;
+    size_t left = ctx->total[0] & 0x3F;
+    size_t fill = 64 - left;
+
+    ctx->total[0] += ilen;
+    if (ctx->total[0] < ilen) {
+        ctx->total[1]++;
+    }
+
+    if (left != 0 && ilen >= fill) {
+        memcpy(ctx->buffer + left, input, fill);
+        process(ctx, ctx->buffer, first);
+        first = false;
+        input += fill;
+        ilen -= fill;
+        left = 0;
+    }
+    while (ilen >= 64) {
+        process(ctx, input, first);
+        first = false;
+        input += 64;
+        ilen -= 64;
+    }
+    if (ilen > 0) {
+        memcpy(ctx->buffer + left, input, ilen);
+    }
+    return 0;
+}
+
+int mbedtls_sha256_finish_ret(mbedtls_sha256_context *ctx, unsigned char output[32]) {
+    // The padding is hashed in software.
+    release(ctx);
+
+    uint32_t used = ctx->total[0] & 0x3F;
+    ctx->buffer[used++] = 0x80;
+    if (used > 56) {
+        memset(ctx->buffer + used, 0, 64 - used);
+        software_process(ctx->state, ctx->buffer);
+        used = 0;
+    }
+    memset(ctx->buffer + used, 0, 56 - used);
+    uint32_t high = (ctx->total[0] >> 29) | (ctx->total[1] << 3);
+    uint32_t low = ctx->total[0] << 3;
+    store_be32(ctx->buffer + 56, high);
+    store_be32(ctx->buffer + 60, low);
+    software_process(ctx->state, ctx->buffer);
+
+    for (int i = 0; i < (ctx->is224 ? 7 : 8); i++) {
+        store_be32(output + 4 * i, ctx->state[i]);
+    }
+    return 0;
+}
@@ -17,6 +17,12 @@
 
 // PSRAM can require more stack space for GC.
 #define MICROPY_ALLOC_GC_STACK_SIZE         (128)
+
+// Fewer, longer display bus transactions per refresh.
+#define CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE (8 * 1024)
+
+// Bitmaps too big for internal RAM end up in PSRAM, when there is any.
+#define CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE (16 * 1024)
 #endif
 
 // Setting a non-default value also requires a non-default link.ld
@@ -24,6 +24,8 @@ CIRCUITPY_ROTARYIO_SOFTENCODER = 1
 CIRCUITPY_SYNTHIO_MAX_CHANNELS = 24
 CIRCUITPY_USB_HOST ?= 1
 CIRCUITPY_USB_VIDEO ?= 1
+CIRCUITPY_USB_CDC_RX_BUFSIZE ?= 1024
+CIRCUITPY_USB_CDC_TX_BUFSIZE ?= 1024
 
 # Things that need to be implemented.
 CIRCUITPY_FREQUENCYIO = 0
@@ -33,6 +35,8 @@ CIRCUITPY_I2CTARGET = 1
 CIRCUITPY_NVM = 1
 # Use PIO internally
 CIRCUITPY_PULSEIO ?= 1
+CIRCUITPY_SDIOIO ?= $(CIRCUITPY_RP2PIO)
+CIRCUITPY_KEYPAD_KEYMATRIX_PIO ?= $(CIRCUITPY_RP2PIO)
 CIRCUITPY_WATCHDOG ?= 1
 
 # Use of analogbufio
@@ -69,6 +73,9 @@ CIRCUITPY_CYW43_INIT_DELAY ?= 0
 
 # Audio effects
 CIRCUITPY_AUDIOEFFECTS ?= 1
+
+# The queues for USB audio take about 5 kB of RAM.
+CIRCUITPY_USB_AUDIO ?= 1
 endif
 
 INTERNAL_LIBM = 1
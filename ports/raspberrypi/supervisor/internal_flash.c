@@ -20,6 +20,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 
 #include "audio_dma.h"
+#include "core1_worker.h"
 #include "supervisor/flash.h"
 #include "supervisor/usb.h"
 
@@ -45,6 +46,8 @@ static uint32_t _audio_channel_mask;
 #endif
 
 void supervisor_flash_pre_write(void) {
+    // Park core1 in RAM if it is running jobs from flash.
+    core1_worker_flash_lockout_start();
     // Disable interrupts. XIP accesses will fault during flash writes.
     common_hal_mcu_disable_interrupts();
     #if CIRCUITPY_AUDIOCORE
@@ -60,6 +63,7 @@ void supervisor_flash_post_write(void) {
     #endif
     // Re-enable interrupts.
     common_hal_mcu_enable_interrupts();
+    core1_worker_flash_lockout_end();
 }
 
 void supervisor_flash_init(void) {
@@ -117,6 +121,11 @@ mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t n
     return 0;
 }
 
+const uint8_t *supervisor_flash_get_mapped_block(uint32_t block_num) {
+    // The filesystem is read straight out of XIP too so the mapping is always valid.
+    return (const uint8_t *)(XIP_BASE + CIRCUITPY_CIRCUITPY_DRIVE_START_ADDR + block_num * FILESYSTEM_BLOCK_SIZE);
+}
+
 mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t lba, uint32_t num_blocks) {
     uint32_t blocks_per_sector = SECTOR_SIZE / FILESYSTEM_BLOCK_SIZE;
     uint32_t block = 0;
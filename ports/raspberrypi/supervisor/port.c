@@ -11,6 +11,7 @@
 #include "supervisor/background_callback.h"
 #include "supervisor/board.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 
 #include "bindings/rp2pio/StateMachine.h"
 #include "genhdr/mpversion.h"
@@ -34,6 +35,14 @@
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/busio/UART.h"
 
+#if CIRCUITPY_SDIOIO
+#include "common-hal/sdioio/SDCard.h"
+#endif
+
+#if CIRCUITPY_KEYPAD_KEYMATRIX && CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+#include "common-hal/keypad/KeyMatrix.h"
+#endif
+
 #include "supervisor/shared/safe_mode.h"
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/tick.h"
@@ -291,6 +300,10 @@ void *port_realloc(void *ptr, size_t size, bool dma_capable) {
     return tlsf_realloc(_heap, ptr, size);
 }
 
+bool port_ptr_in_external_ram(const void *ptr) {
+    return _psram_size > 0 && (size_t)ptr - 0x11000000 < _psram_size;
+}
+
 static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
     size_t *max_size = (size_t *)user;
     if (!used && *max_size < size) {
@@ -299,6 +312,14 @@ static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
     return true;
 }
 
+void port_heap_get_stats(port_heap_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    port_heap_add_tlsf_pool_stats(tlsf_get_pool(_heap), stats);
+    if (_psram_heap != NULL) {
+        port_heap_add_tlsf_pool_stats(tlsf_get_pool(_psram_heap), stats);
+    }
+}
+
 size_t port_heap_get_largest_free_size(void) {
     size_t max_size = 0;
     tlsf_walk_pool(tlsf_get_pool(_heap), max_size_walker, &max_size);
@@ -411,10 +432,19 @@ void reset_port(void) {
     reset_countio();
     #endif
 
+    #if CIRCUITPY_KEYPAD_KEYMATRIX && CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+    // Before the state machines are reset so never-reset matrices can keep theirs.
+    keypad_keymatrix_pio_reset();
+    #endif
+
     #if CIRCUITPY_RP2PIO
     reset_rp2pio_statemachine();
     #endif
 
+    #if CIRCUITPY_SDIOIO
+    sdioio_reset();
+    #endif
+
     #if CIRCUITPY_RTC
     rtc_reset();
     #endif
@@ -188,7 +188,10 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     mp_float_t interval,
     mp_float_t window,
     mp_int_t minimum_rssi,
-    bool active) {
+    bool active,
+    uint8_t *addresses,
+    size_t address_count,
+    mp_int_t dedup_window_ms) {
 
     sl_status_t sc;
     uint64_t start_ticks = supervisor_ticks_ms64();
@@ -211,7 +214,10 @@ mp_obj_t common_hal_bleio_adapter_start_scan(bleio_adapter_obj_t *self,
     self->scan_results = shared_module_bleio_new_scanresults(buffer_size,
         prefixes,
         prefix_length,
-        minimum_rssi);
+        minimum_rssi,
+        addresses,
+        address_count,
+        dedup_window_ms);
     xscan_event = xEventGroupCreate();
     if (xscan_event != NULL) {
         xEventGroupClearBits(xscan_event, 1 << 0);
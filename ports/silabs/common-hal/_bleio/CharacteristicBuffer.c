@@ -53,11 +53,13 @@ bool characteristic_buffer_on_ble_evt(uint16_t attribute,
                     if (data[i] == mp_interrupt_char) {
                         mp_sched_keyboard_interrupt();
                     } else {
-                        ringbuf_put(&bleio_characteristic_buffer_list.data[cindex]->ringbuf, data[i]);
+                        if (ringbuf_put(&bleio_characteristic_buffer_list.data[cindex]->ringbuf, data[i]) < 0) {
+                            bleio_characteristic_buffer_list.data[cindex]->overflow_count++;
+                        }
                     }
                 }
             } else {
-                ringbuf_put_n(&bleio_characteristic_buffer_list.data[cindex]->ringbuf, data, len);
+                bleio_characteristic_buffer_list.data[cindex]->overflow_count += len - ringbuf_put_n(&bleio_characteristic_buffer_list.data[cindex]->ringbuf, data, len);
             }
             taskEXIT_CRITICAL();
 
@@ -79,6 +81,7 @@ void _common_hal_bleio_characteristic_buffer_construct(
     self->timeout_ms = timeout * 1000;
     self->watch_for_interrupt_char = watch_for_interrupt_char;
     ringbuf_init(&self->ringbuf, buffer, buffer_size);
+    self->overflow_count = 0;
 }
 
 void common_hal_bleio_characteristic_buffer_construct(
@@ -128,6 +131,10 @@ uint32_t common_hal_bleio_characteristic_buffer_rx_characters_available(
     return ringbuf_num_filled(&self->ringbuf);
 }
 
+uint32_t common_hal_bleio_characteristic_buffer_get_overflow_count(bleio_characteristic_buffer_obj_t *self) {
+    return self->overflow_count;
+}
+
 void common_hal_bleio_characteristic_buffer_clear_rx_buffer(
     bleio_characteristic_buffer_obj_t *self) {
     taskENTER_CRITICAL();
@@ -349,6 +349,11 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self,
 }
 
 // Get length of receiving packet
+mp_int_t common_hal_bleio_packet_buffer_send_packet(bleio_packet_buffer_obj_t *self, const uint8_t *data, size_t len) {
+    // Packets can't be queued past the outgoing buffers on this port yet.
+    return common_hal_bleio_packet_buffer_write(self, data, len, NULL, 0);
+}
+
 mp_int_t common_hal_bleio_packet_buffer_get_incoming_packet_length(
     bleio_packet_buffer_obj_t *self) {
 
@@ -160,14 +160,14 @@ static void install_all_match_filter(canio_listener_obj_t *self) {
 
     // filter mode: 0 = mask
     // (this bit should be clear already, we never set it; but just in case)
-    CLEAR_BIT(self->can->filter_hw->FM1R, bank);
+    CLEAR_BIT(self->can->filter_hw->FM1R, 1 << bank);
     // filter scale: 1 = 32 bits
-    SET_BIT(self->can->filter_hw->FS1R, bank);
+    SET_BIT(self->can->filter_hw->FS1R, 1 << bank);
     // fifo assignment: 1 = FIFO 1
     if (self->fifo_idx) {
-        SET_BIT(self->can->filter_hw->FFA1R, bank);
+        SET_BIT(self->can->filter_hw->FFA1R, 1 << bank);
     } else {
-        CLEAR_BIT(self->can->filter_hw->FFA1R, bank);
+        CLEAR_BIT(self->can->filter_hw->FFA1R, 1 << bank);
     }
 
     // filter activation: 1 = enabled
@@ -246,42 +246,73 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return *(self->rfr) & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+static bool wait_for_message(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+// Copy the oldest message out of the FIFO and release its mailbox.
+static void read_message(canio_listener_obj_t *self, canio_message_record_t *record) {
     uint32_t rir = self->mailbox->RIR;
     uint32_t rdtr = self->mailbox->RDTR;
 
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
-    message->extended = rir & CAN_RI0R_IDE;
-    if (message->extended) {
-        message->id = rir >> 3;
+    bool extended = rir & CAN_RI0R_IDE;
+    if (extended) {
+        record->id = rir >> 3;
     } else {
-        message->id = rir >> 21;
+        record->id = rir >> 21;
     }
-    message->size = rdtr & CAN_RDT0R_DLC;
-    if (!rtr) {
+    // Classic CAN codes a length of 8 as any DLC from 8 to 15.
+    record->size = MIN(rdtr & CAN_RDT0R_DLC, sizeof(record->data));
+    record->flags = (extended ? CANIO_MESSAGE_RECORD_EXTENDED : 0) | (rtr ? CANIO_MESSAGE_RECORD_RTR : 0);
+    record->reserved = 0;
+    if (rtr) {
+        memset(record->data, 0, sizeof(record->data));
+    } else {
         uint32_t payload[] = { self->mailbox->RDLR, self->mailbox->RDHR };
-        MP_STATIC_ASSERT(sizeof(payload) == sizeof(message->data));
-        memcpy(message->data, payload, sizeof(payload));
+        MP_STATIC_ASSERT(sizeof(payload) == sizeof(record->data));
+        memcpy(record->data, payload, sizeof(payload));
     }
+    record->timestamp = supervisor_ticks_ms32();
     // Release the mailbox
     SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
-    return message;
+}
+
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!wait_for_message(self)) {
+        return NULL;
+    }
+    canio_message_record_t record;
+    read_message(self, &record);
+    return canio_message_new_from_record(&record);
+}
+
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, void *records, size_t count) {
+    if (count == 0 || !wait_for_message(self)) {
+        return 0;
+    }
+    // The FIFO only holds three messages, so empty it completely each time.
+    size_t n = 0;
+    while (n < count && common_hal_canio_listener_in_waiting(self)) {
+        canio_message_record_t record;
+        read_message(self, &record);
+        memcpy((uint8_t *)records + n * sizeof(record), &record, sizeof(record));
+        n++;
+    }
+    return n;
 }
 
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
@@ -6,9 +6,11 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdint.h>
+#include <string.h>
 #include "supervisor/background_callback.h"
 #include "supervisor/board.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/microcontroller/__init__.h"
@@ -208,6 +210,15 @@ static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
     return true;
 }
 
+void port_heap_get_stats(port_heap_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    for (size_t i = 0; i < CIRCUITPY_RAM_DEVICE_COUNT; i++) {
+        if (pools[i]) {
+            port_heap_add_tlsf_pool_stats(pools[i], stats);
+        }
+    }
+}
+
 size_t port_heap_get_largest_free_size(void) {
     size_t max_size = 0;
     for (size_t i = 0; i < CIRCUITPY_RAM_DEVICE_COUNT; i++) {
@@ -184,6 +184,21 @@ static void pairheap_test(size_t nops, int *ops) {
     mp_printf(&mp_plat_print, "\n");
 }
 
+// CIRCUITPY-CHANGE: copies data to a buffer outside the heap, as a file in
+// memory-mapped flash would be, and returns a memoryview of it
+static byte rom_buffer_data[1024];
+
+static mp_obj_t rom_buffer(mp_obj_t data_in) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len > sizeof(rom_buffer_data)) {
+        mp_raise_ValueError(NULL);
+    }
+    memcpy(rom_buffer_data, bufinfo.buf, bufinfo.len);
+    return mp_obj_new_memoryview('B', bufinfo.len, rom_buffer_data);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rom_buffer_obj, rom_buffer);
+
 // function to run extra tests for things that can't be checked by scripts
 static mp_obj_t extra_coverage(void) {
     // mp_printf (used by ports that don't have a native printf)
@@ -693,6 +708,55 @@ static mp_obj_t extra_coverage(void) {
         ringbuf_clear(&ringbuf);
         ringbuf_put(&ringbuf, 0xaa);
         mp_printf(&mp_plat_print, "%d\n", ringbuf_get16(&ringbuf));
+
+        // Multi-byte put/get when full and empty.
+        ringbuf_clear(&ringbuf);
+        byte data[RINGBUF_SIZE + 1];
+        for (int i = 0; i < RINGBUF_SIZE + 1; ++i) {
+            data[i] = i;
+        }
+        size_t count = ringbuf_put_n(&ringbuf, data, sizeof(data));
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, ringbuf_num_empty(&ringbuf));
+        count = ringbuf_put_n(&ringbuf, data, 1);
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, ringbuf_put(&ringbuf, 1));
+        byte out[RINGBUF_SIZE + 1];
+        count = ringbuf_get_n(&ringbuf, out, sizeof(out));
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, out[RINGBUF_SIZE - 1]);
+        count = ringbuf_get_n(&ringbuf, out, 1);
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, ringbuf_get(&ringbuf));
+
+        // Multi-byte put/get wrapping around the storage and around both index ranges.
+        int mismatches = 0;
+        for (int i = 0; i < 5 * RINGBUF_SIZE; ++i) {
+            size_t put = ringbuf_put_n(&ringbuf, data + i % 7, 30 + i % 7);
+            size_t got = ringbuf_get_n(&ringbuf, out, put);
+            if (got != put || memcmp(out, data + i % 7, got) != 0 || ringbuf_num_filled(&ringbuf) != 0) {
+                mismatches++;
+            }
+        }
+        mp_printf(&mp_plat_print, "%d %d %d\n", mismatches, ringbuf_num_empty(&ringbuf), ringbuf_num_filled(&ringbuf));
+
+        // Clear requested by the producer, applied when the consumer reads.
+        ringbuf_put_n(&ringbuf, data, 10);
+        ringbuf_get_n(&ringbuf, out, 4);
+        ringbuf_request_clear(&ringbuf);
+        mp_printf(&mp_plat_print, "%d %d\n", ringbuf_num_filled(&ringbuf), ringbuf_num_empty(&ringbuf));
+        ringbuf_put_n(&ringbuf, data + 20, 3);
+        count = ringbuf_get_n(&ringbuf, out, sizeof(out));
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, out[0]);
+        mp_printf(&mp_plat_print, "%d %d\n", ringbuf_num_filled(&ringbuf), ringbuf_num_empty(&ringbuf));
+        // The handled request doesn't move the read index back.
+        ringbuf_put_n(&ringbuf, data + 30, 2);
+        count = ringbuf_num_filled(&ringbuf);
+        mp_printf(&mp_plat_print, "%d %d\n", (int)count, ringbuf_get(&ringbuf));
+        // Two requests before a read.
+        ringbuf_request_clear(&ringbuf);
+        ringbuf_put_n(&ringbuf, data + 40, 2);
+        ringbuf_request_clear(&ringbuf);
+        ringbuf_put(&ringbuf, 50);
+        count = ringbuf_num_filled(&ringbuf);
+        int first = ringbuf_get(&ringbuf);
+        mp_printf(&mp_plat_print, "%d %d %d\n", (int)count, first, ringbuf_get(&ringbuf));
     }
 
     // pairheap
@@ -639,6 +639,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
         mp_store_global(MP_QSTR_NativeBaseClass, MP_OBJ_FROM_PTR(&native_base_class_type));
         mp_store_global(MP_QSTR_getenv_int, MP_OBJ_FROM_PTR(&mod_os_getenv_int_obj));
         mp_store_global(MP_QSTR_getenv_str, MP_OBJ_FROM_PTR(&mod_os_getenv_str_obj));
+        MP_DECLARE_CONST_FUN_OBJ_1(rom_buffer_obj);
+        mp_store_global(MP_QSTR_rom_buffer, MP_OBJ_FROM_PTR(&rom_buffer_obj));
     }
     #endif
 
@@ -37,6 +37,75 @@
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
 
+// Enable testing of incremental sweeping.
+#define MICROPY_GC_INCREMENTAL_SWEEP   (1)
+
+// Enable testing of small allocation pools.
+#define MICROPY_GC_SMALL_POOLS         (1)
+
+// Enable testing of heap compaction.
+#define MICROPY_GC_MOVABLE             (1)
+
+// Enable testing of continuing the GC stack in free heap.
+#define MICROPY_GC_STACK_IN_FREE_HEAP  (1)
+
+// Enable testing of GC statistics.
+#define MICROPY_GC_STATS               (1)
+
+// Enable testing of memorymonitor.AllocationProfiler.
+#define MICROPY_TRACK_CURRENT_CODE_STATE (1)
+
+// Enable testing of the type attribute cache.
+#define MICROPY_OPT_TYPE_ATTR_CACHE    (1)
+
+// Enable testing of running .mpy files in place.
+#define MICROPY_PERSISTENT_CODE_LOAD_ROM (1)
+
+// Enable testing of the compiled code cache.
+#define MICROPY_MODULE_COMPILE_CACHE   (1)
+
+// Enable testing of the import lookup cache.
+#define MICROPY_VFS_IMPORT_STAT_CACHE  (1)
+
+// Enable testing of compiling in batches.
+#define MICROPY_COMP_STREAMING         (1)
+
+// Enable testing of fused bytecode opcodes.
+#define MICROPY_OPT_FUSED_BYTECODE     (1)
+
+// Enable testing of compiling hot functions to native code.
+#define MICROPY_OPT_NATIVE_TIER_UP     (1)
+
+// Enable testing of the qstr hash index.
+#define MICROPY_OPT_QSTR_HASH_INDEX    (1)
+
+// Enable testing of the faster mpz multiplication, division and pow.
+#define MICROPY_OPT_MPZ_FAST_ARITH     (1)
+
+// Enable testing of Horspool substring search.
+#define MICROPY_OPT_FIND_SUBBYTES_HORSPOOL (1)
+
+// Enable testing of the stable list sort.
+#define MICROPY_OPT_LIST_STABLE_SORT   (1)
+
+// Enable testing of the compact, insertion-ordered hash map.
+#define MICROPY_MAP_COMPACT            (1)
+
+// Enable testing of table-driven error message decompression.
+#define CIRCUITPY_TRANSLATE_LOOKUP     (1)
+
+// Enable testing of fixed-layout instances for classes with __slots__.
+#define MICROPY_PY_CLASS_SLOTS         (1)
+
+// Enable testing of shortest round-trip float repr.
+#define MICROPY_FLOAT_SHORTEST_REPR    (1)
+
+// Enable testing of streaming JSON parsing.
+#define MICROPY_PY_JSON_ITERPARSE      (1)
+
+// Enable testing of linear-time regex matching.
+#define MICROPY_PY_RE_PIKEVM           (1)
+
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
@@ -30,8 +30,12 @@ SRC_BITMAP := \
 	shared-bindings/__future__/__init__.c \
 	shared-bindings/aesio/aes.c \
 	shared-bindings/aesio/__init__.c \
+	shared-bindings/arrayops/__init__.c \
 	shared-bindings/audiocore/__init__.c \
+	shared-bindings/audiocore/Playlist.c \
 	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/Resampler.c \
+	shared-bindings/audiocore/Spectrum.c \
 	shared-bindings/audiocore/WaveFile.c \
 	shared-bindings/audiodelays/Echo.c \
 	shared-bindings/audiodelays/Chorus.c \
@@ -52,6 +56,8 @@ SRC_BITMAP := \
 	shared-bindings/bitmapfilter/__init__.c \
 	shared-bindings/bitmaptools/__init__.c \
 	shared-bindings/codeop/__init__.c \
+	shared-bindings/crc/__init__.c \
+	shared-bindings/crc/CRC.c \
 	shared-bindings/displayio/Bitmap.c \
 	shared-bindings/displayio/ColorConverter.c \
 	shared-bindings/displayio/Palette.c \
@@ -59,13 +65,19 @@ SRC_BITMAP := \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
+	shared-bindings/memorymonitor/__init__.c \
+	shared-bindings/memorymonitor/AllocationAlarm.c \
+	shared-bindings/memorymonitor/AllocationProfiler.c \
+	shared-bindings/memorymonitor/AllocationSize.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
 	shared-bindings/synthio/LFO.c \
 	shared-bindings/synthio/Note.c \
+	shared-bindings/synthio/Sample.c \
 	shared-bindings/synthio/Biquad.c \
 	shared-bindings/synthio/Synthesizer.c \
 	shared-bindings/traceback/__init__.c \
@@ -76,10 +88,15 @@ SRC_BITMAP := \
 	shared-bindings/vectorio/Rectangle.c \
 	shared-bindings/vectorio/VectorShape.c \
 	shared-bindings/zlib/__init__.c \
+	shared-bindings/zlib/CompressIO.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
+	shared-module/arrayops/__init__.c \
 	shared-module/audiocore/__init__.c \
+	shared-module/audiocore/Playlist.c \
 	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/Resampler.c \
+	shared-module/audiocore/Spectrum.c \
 	shared-module/audiocore/WaveFile.c \
 	shared-module/audiodelays/Echo.c \
 	shared-module/audiodelays/Chorus.c \
@@ -98,6 +115,7 @@ SRC_BITMAP := \
 	shared-module/audiomixer/MixerVoice.c \
 	shared-module/bitmapfilter/__init__.c \
 	shared-module/bitmaptools/__init__.c \
+	shared-module/crc/CRC.c \
 	shared-module/displayio/area.c \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
@@ -105,14 +123,20 @@ SRC_BITMAP := \
 	shared-module/floppyio/__init__.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
+	shared-module/memorymonitor/__init__.c \
+	shared-module/memorymonitor/AllocationAlarm.c \
+	shared-module/memorymonitor/AllocationProfiler.c \
+	shared-module/memorymonitor/AllocationSize.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
+	shared-module/struct/Struct.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
 	shared-module/synthio/MidiTrack.c \
 	shared-module/synthio/LFO.c \
 	shared-module/synthio/Note.c \
+	shared-module/synthio/Sample.c \
 	shared-module/synthio/Biquad.c \
 	shared-module/synthio/Synthesizer.c \
 	shared-bindings/vectorio/Circle.c \
@@ -123,6 +147,7 @@ SRC_BITMAP := \
 	shared-module/vectorio/VectorShape.c \
 	shared-module/traceback/__init__.c \
 	shared-module/zlib/__init__.c \
+	shared-module/zlib/CompressIO.c \
 
 SRC_C += $(SRC_BITMAP)
 
@@ -148,6 +173,7 @@ $(BUILD)/lib/mp3/src/buffers.o: CFLAGS += -include "shared-module/audiomp3/__ini
 
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
+	-DCIRCUITPY_ARRAYOPS=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
 	-DCIRCUITPY_AUDIOEFFECTS=1 \
 	-DCIRCUITPY_AUDIODELAYS=1 \
@@ -155,14 +181,17 @@ CFLAGS += \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOMP3=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
+	-DCIRCUITPY_AUDIOCORE_STATS=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
 	-DCIRCUITPY_CODEOP=1 \
+	-DCIRCUITPY_CRC=1 \
 	-DCIRCUITPY_DISPLAYIO_UNIX=1 \
 	-DCIRCUITPY_FLOPPYIO=1 \
 	-DCIRCUITPY_FUTURE=1 \
 	-DCIRCUITPY_GIFIO=1 \
 	-DCIRCUITPY_JPEGIO=1 \
 	-DCIRCUITPY_LOCALE=1 \
+	-DCIRCUITPY_MEMORYMONITOR=1 \
 	-DCIRCUITPY_OS_GETENV=1 \
 	-DCIRCUITPY_RAINBOWIO=1 \
 	-DCIRCUITPY_STRUCT=1 \
@@ -0,0 +1,3 @@
+# Standard variant with allocation counting, for tests/run-perfcount.py.
+
+FROZEN_MANIFEST ?= $(VARIANT_DIR)/../standard/manifest.py
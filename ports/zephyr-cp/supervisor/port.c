@@ -5,6 +5,9 @@
 // SPDX-License-Identifier: MIT
 
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
+
+#include <string.h>
 
 #include "mpconfigboard.h"
 
@@ -163,6 +166,13 @@ static bool max_size_walker(void *ptr, size_t size, int used, void *user) {
     return true;
 }
 
+void port_heap_get_stats(port_heap_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    for (size_t i = 0; i < CIRCUITPY_RAM_DEVICE_COUNT; i++) {
+        port_heap_add_tlsf_pool_stats(pools[i], stats);
+    }
+}
+
 size_t port_heap_get_largest_free_size(void) {
     size_t max_size = 0;
     for (size_t i = 0; i < CIRCUITPY_RAM_DEVICE_COUNT; i++) {
@@ -329,13 +329,38 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     #if MICROPY_STACKLESS
     code_state->prev = NULL;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_TRACK_CURRENT_CODE_STATE
     code_state->prev_state = NULL;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     code_state->frame = NULL;
     #endif
     mp_setup_code_state_helper(code_state, n_args, n_kw, args);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_TRACK_CURRENT_CODE_STATE
+qstr mp_code_state_get_source_line(const mp_code_state_t *code_state, size_t *line) {
+    const byte *ip = code_state->fun_bc->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    const byte *bytecode_start = ip + n_info + n_cell;
+    // Skip the function name and argument names.
+    for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    size_t bc = code_state->ip > bytecode_start ? code_state->ip - bytecode_start : 0;
+    *line = mp_bytecode_get_source_line(ip, line_info_top, bc);
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    return code_state->fun_bc->context->constants.qstr_table[0];
+    #else
+    return code_state->fun_bc->context->constants.source_file;
+    #endif
+}
+#endif
+
 #if MICROPY_EMIT_NATIVE
 // On entry code_state should be allocated somewhere (stack/heap) and
 // contain the following valid entries:
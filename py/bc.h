@@ -216,6 +216,12 @@ typedef struct _mp_module_constants_t {
 typedef struct _mp_module_context_t {
     mp_obj_module_t module;
     mp_module_constants_t constants;
+    // CIRCUITPY-CHANGE: the size and modification time of the source file when
+    // it was compiled, or zero if the code didn't come from a source file
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    mp_uint_t source_size;
+    mp_uint_t source_mtime;
+    #endif
 } mp_module_context_t;
 
 // Outer level struct defining a compiled module.
@@ -250,8 +256,11 @@ typedef struct _mp_code_state_t {
     #if MICROPY_STACKLESS
     struct _mp_code_state_t *prev;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_TRACK_CURRENT_CODE_STATE
     struct _mp_code_state_t *prev_state;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     struct _mp_obj_frame_t *frame;
     #endif
     // Variable-length
@@ -287,6 +296,12 @@ mp_vm_return_kind_t mp_execute_bytecode(mp_code_state_t *code_state,
 mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t func, size_t n_args, size_t n_kw, const mp_obj_t *args);
 void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args);
 void mp_setup_code_state_native(mp_code_state_native_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args);
+// CIRCUITPY-CHANGE
+#if MICROPY_TRACK_CURRENT_CODE_STATE
+// Finds the source file and line a running bytecode function is on. It doesn't allocate, so it
+// can be used from an interrupt.
+qstr mp_code_state_get_source_line(const mp_code_state_t *code_state, size_t *line);
+#endif
 void mp_bytecode_print(const mp_print_t *print, const struct _mp_raw_code_t *rc, size_t fun_data_len, const mp_module_constants_t *cm);
 void mp_bytecode_print2(const mp_print_t *print, const byte *ip, size_t len, struct _mp_raw_code_t *const *child_table, const mp_module_constants_t *cm);
 const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start, const byte *ip, struct _mp_raw_code_t *const *child_table, const mp_module_constants_t *cm);
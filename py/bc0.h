@@ -159,4 +159,12 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// CIRCUITPY-CHANGE: opcodes doing the work of common sequences of opcodes, see
+// MICROPY_OPT_FUSED_BYTECODE. Each is the size of the sequence it replaces.
+#define MP_BC_LOAD_FAST_ATTR                (MP_BC_BASE_RESERVED + 0x01) // byte local; qstr
+#define MP_BC_LOAD_FAST_METHOD              (MP_BC_BASE_RESERVED + 0x02) // byte local; qstr
+#define MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP (MP_BC_BASE_RESERVED + 0x03) // 2 bytes: local, small int and op
+#define MP_BC_BINARY_OP_POP_JUMP_IF_TRUE    (MP_BC_BASE_RESERVED + 0x04) // signed relative bytecode offset; then byte op
+#define MP_BC_BINARY_OP_POP_JUMP_IF_FALSE   (MP_BC_BASE_RESERVED + 0x05) // signed relative bytecode offset; then byte op
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
@@ -33,11 +33,18 @@
 #include "py/compile.h"
 // CIRCUITPY-CHANGE: for gc_collect() after each import
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#include "py/objfun.h"
 #include "py/objmodule.h"
 #include "py/persistentcode.h"
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -198,6 +205,164 @@ static void do_execute_proto_fun(const mp_module_context_t *context, mp_proto_fu
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+// A .py file is compiled once and its code saved in the .mpycache directory beside
+// it, if there is one, as a .mpy file preceded by the size and modification time
+// of the source. Later imports load the saved code while the size and time match.
+
+#define COMPILE_CACHE_DIR ".mpycache"
+#define COMPILE_CACHE_KEY_LEN (8)
+
+// Turns "dir/name.py" into "dir/.mpycache/name.mpy", or MP_QSTRnull if there is no
+// cache directory.
+static qstr compile_cache_path(vstr_t *file) {
+    const char *file_str = vstr_null_terminated_str(file);
+    const char *name = strrchr(file_str, '/');
+    name = name == NULL ? file_str : name + 1;
+    vstr_t path;
+    vstr_init(&path, file->len + sizeof(COMPILE_CACHE_DIR) + 2);
+    vstr_add_strn(&path, file_str, name - file_str);
+    vstr_add_str(&path, COMPILE_CACHE_DIR);
+    qstr cache = MP_QSTRnull;
+    if (mp_import_stat(vstr_null_terminated_str(&path)) == MP_IMPORT_STAT_DIR) {
+        vstr_add_char(&path, '/');
+        // Drop the "py" of ".py".
+        vstr_add_strn(&path, name, file_str + file->len - 2 - name);
+        vstr_add_str(&path, "mpy");
+        cache = qstr_from_strn(path.buf, path.len);
+    }
+    vstr_clear(&path);
+    return cache;
+}
+
+// Returns false if the file is empty, to keep an all zero key from matching.
+static bool compile_cache_key(qstr file, byte *key) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(mp_vfs_stat(MP_OBJ_NEW_QSTR(file)), &len, &items);
+    mp_uint_t size = mp_obj_get_int_truncated(items[6]);
+    mp_uint_t mtime = mp_obj_get_int_truncated(items[8]);
+    for (size_t i = 0; i < 4; i++) {
+        key[i] = size >> (8 * i);
+        key[4 + i] = mtime >> (8 * i);
+    }
+    return size != 0;
+}
+
+// Re-raises the exception unless it means the cache file couldn't be used.
+static void compile_cache_check_error(nlr_buf_t *nlr) {
+    mp_obj_t type = MP_OBJ_FROM_PTR(((mp_obj_base_t *)nlr->ret_val)->type);
+    if (!mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_OSError))
+        && !mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_ValueError))) {
+        nlr_jump(nlr->ret_val);
+    }
+}
+
+// Returns true, having loaded the saved code, if its key matches. Closes the reader.
+static bool compile_cache_read(mp_reader_t *reader, mp_compiled_module_t *cm, const byte *key) {
+    // Close the reader if reading the key raises.
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, reader->close, reader->data);
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    bool match = true;
+    for (size_t i = 0; i < COMPILE_CACHE_KEY_LEN; i++) {
+        match &= reader->readbyte(reader->data) == key[i];
+    }
+    // mp_raw_code_load closes the reader itself, even when it raises.
+    nlr_pop_jump_callback(!match);
+    if (match) {
+        mp_raw_code_load(reader, cm);
+    }
+    return match;
+}
+
+// Returns true if the saved code for the current source was loaded.
+static bool compile_cache_load(mp_compiled_module_t *cm, qstr cache, const byte *key) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, cache);
+        bool match = compile_cache_read(&reader, cm, key);
+        nlr_pop();
+        return match;
+    }
+    // Missing, or saved by an incompatible version.
+    compile_cache_check_error(&nlr);
+    return false;
+}
+
+static void compile_cache_close(void *file) {
+    mp_stream_close(MP_OBJ_FROM_PTR(file));
+}
+
+// Returns true if the whole file, key included, was written. Closes the file.
+static bool compile_cache_write(mp_obj_t file, mp_compiled_module_t *cm, const byte *key) {
+    // Close the file if writing raises.
+    MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, compile_cache_close, MP_OBJ_TO_PTR(file));
+    nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
+    // The key is written last so that a partly written file never matches.
+    static const byte no_key[COMPILE_CACHE_KEY_LEN] = { 0 };
+    mp_stream_write(file, no_key, sizeof(no_key), MP_STREAM_RW_WRITE);
+    mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+    mp_raw_code_save(cm, &print);
+    int errcode;
+    bool written = mp_stream_seek(file, 0, MP_SEEK_SET, &errcode) == 0;
+    if (written) {
+        mp_stream_write(file, key, COMPILE_CACHE_KEY_LEN, MP_STREAM_RW_WRITE);
+    }
+    nlr_pop_jump_callback(true);
+    return written;
+}
+
+static void compile_cache_save(mp_compiled_module_t *cm, qstr cache, const byte *key) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = {
+            MP_OBJ_NEW_QSTR(cache),
+            MP_OBJ_NEW_QSTR(MP_QSTR_wb),
+        };
+        mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+        if (!compile_cache_write(file, cm, key)) {
+            // The file can't be made to match, so don't spend time saving more.
+            MP_STATE_VM(compile_cache_save_failed) = true;
+        }
+        nlr_pop();
+    } else {
+        // Such as when the filesystem is read-only. Later saves would fail too.
+        compile_cache_check_error(&nlr);
+        MP_STATE_VM(compile_cache_save_failed) = true;
+    }
+}
+
+// Returns false, having done nothing, if the file has no cache directory.
+static bool do_load_with_compile_cache(mp_module_context_t *module_obj, vstr_t *file, qstr file_qstr) {
+    qstr cache = compile_cache_path(file);
+    byte key[COMPILE_CACHE_KEY_LEN];
+    if (cache == MP_QSTRnull || !compile_cache_key(file_qstr, key)) {
+        return false;
+    }
+    mp_compiled_module_t cm;
+    cm.context = module_obj;
+    if (compile_cache_load(&cm, cache, key)) {
+        #if MICROPY_OPT_NATIVE_TIER_UP
+        // The saved code was compiled from the source file as it is now.
+        mp_obj_fun_bc_tier_up_set_source(cm.context, file_qstr);
+        #endif
+    } else {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_compile_to_raw_code(&parse_tree, source_name, false, &cm);
+        // Native code would need relocating when loaded.
+        if (!cm.has_native && !MP_STATE_VM(compile_cache_save_failed)) {
+            compile_cache_save(&cm, cache, key);
+        }
+    }
+    do_execute_proto_fun(module_obj, cm.rc, file_qstr);
+    return true;
+}
+#endif
+
 static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_ENABLE_COMPILER || (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_HAS_FILE_READER)
     const char *file_str = vstr_null_terminated_str(file);
@@ -257,6 +422,12 @@ static void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MODULE_COMPILE_CACHE
+        if (do_load_with_compile_cache(module_obj, file, file_qstr)) {
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_qstr);
         do_load_from_lexer(module_obj, lex);
         return;
@@ -116,6 +116,9 @@ endif
 ifeq ($(CIRCUITPY_ANALOGIO),1)
 SRC_PATTERNS += analogio/%
 endif
+ifeq ($(CIRCUITPY_ARRAYOPS),1)
+SRC_PATTERNS += arrayops/%
+endif
 ifeq ($(CIRCUITPY_ATEXIT),1)
 SRC_PATTERNS += atexit/%
 endif
@@ -192,6 +195,9 @@ endif
 ifeq ($(CIRCUITPY_COUNTIO),1)
 SRC_PATTERNS += countio/%
 endif
+ifeq ($(CIRCUITPY_CRC),1)
+SRC_PATTERNS += crc/%
+endif
 ifeq ($(CIRCUITPY_CYW43),1)
 SRC_PATTERNS += cyw43/%
 endif
@@ -324,6 +330,9 @@ endif
 ifeq ($(CIRCUITPY_PICODVI),1)
 SRC_PATTERNS += picodvi/%
 endif
+ifeq ($(CIRCUITPY_PROFILER),1)
+SRC_PATTERNS += profiler/%
+endif
 ifeq ($(CIRCUITPY_PS2IO),1)
 SRC_PATTERNS += ps2io/%
 endif
@@ -423,6 +432,9 @@ endif
 ifeq ($(CIRCUITPY_PYUSB),1)
 SRC_PATTERNS += usb/%
 endif
+ifeq ($(CIRCUITPY_USB_AUDIO),1)
+SRC_PATTERNS += usb_audio/%
+endif
 ifeq ($(CIRCUITPY_USB_CDC),1)
 SRC_PATTERNS += usb_cdc/%
 endif
@@ -510,6 +522,7 @@ SRC_COMMON_HAL_ALL = \
 	digitalio/__init__.c \
 	dotclockframebuffer/DotClockFramebuffer.c \
 	dotclockframebuffer/__init__.c \
+	dualbank/Update.c \
 	dualbank/__init__.c \
 	floppyio/__init__.c \
 	frequencyio/FrequencyIn.c \
@@ -669,8 +682,12 @@ SRC_SHARED_MODULE_ALL = \
 	_stage/__init__.c \
 	aesio/__init__.c \
 	aesio/aes.c \
+	arrayops/__init__.c \
 	atexit/__init__.c \
+	audiocore/Playlist.c \
 	audiocore/RawSample.c \
+	audiocore/Resampler.c \
+	audiocore/Spectrum.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
 	audiodelays/Echo.c \
@@ -708,6 +725,7 @@ SRC_SHARED_MODULE_ALL = \
 	canio/Match.c \
 	canio/Message.c \
 	canio/RemoteTransmissionRequest.c \
+	crc/CRC.c \
 	displayio/Bitmap.c \
 	displayio/ColorConverter.c \
 	displayio/Group.c \
@@ -752,6 +770,7 @@ SRC_SHARED_MODULE_ALL = \
 	max3421e/Max3421E.c \
 	memorymonitor/__init__.c \
 	memorymonitor/AllocationAlarm.c \
+	memorymonitor/AllocationProfiler.c \
 	memorymonitor/AllocationSize.c \
 	network/__init__.c \
 	msgpack/__init__.c \
@@ -759,6 +778,8 @@ SRC_SHARED_MODULE_ALL = \
 	onewireio/OneWire.c \
 	os/__init__.c \
 	paralleldisplaybus/ParallelBus.c \
+	profiler/__init__.c \
+	profiler/SamplingProfiler.c \
 	qrio/__init__.c \
 	qrio/QRDecoder.c \
 	rainbowio/__init__.c \
@@ -773,6 +794,7 @@ SRC_SHARED_MODULE_ALL = \
 	socket/__init__.c \
 	storage/__init__.c \
 	struct/__init__.c \
+	struct/Struct.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
@@ -780,6 +802,7 @@ SRC_SHARED_MODULE_ALL = \
 	synthio/Math.c \
 	synthio/MidiTrack.c \
 	synthio/Note.c \
+	synthio/Sample.c \
 	synthio/Synthesizer.c \
 	synthio/__init__.c \
 	terminalio/Terminal.c \
@@ -792,6 +815,7 @@ SRC_SHARED_MODULE_ALL = \
 	usb/__init__.c \
 	usb/core/__init__.c \
 	usb/core/Device.c \
+	usb/core/Transfer.c \
 	usb/util/__init__.c \
 	ustack/__init__.c \
 	vectorio/Circle.c \
@@ -802,6 +826,7 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/CompressIO.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -43,7 +43,10 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_OS_DUPTERM            (0)
 #define MICROPY_ROM_TEXT_COMPRESSION     (0)
 #define MICROPY_VFS_LFS1                 (0)
+// CIRCUITPY_SAVES_LITTLEFS turns this on from the makefiles.
+#ifndef MICROPY_VFS_LFS2
 #define MICROPY_VFS_LFS2                 (0)
+#endif
 
 // Sorted alphabetically for easy finding.
 //
@@ -55,6 +58,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_COMP_CONST               (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_MODULE_CONST        (1)
+#define MICROPY_COMP_STREAMING           (CIRCUITPY_COMP_STREAMING)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (0)
 #define MICROPY_DEBUG_PRINTERS           (0)
 #define MICROPY_EMIT_INLINE_THUMB        (CIRCUITPY_ENABLE_MPY_NATIVE)
@@ -66,14 +70,17 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_ENABLE_GC                (1)
 #define MICROPY_ENABLE_PYSTACK           (1)
 #define MICROPY_TRACKED_ALLOC            (CIRCUITPY_SSL_MBEDTLS)
+#define MICROPY_TRACK_CURRENT_CODE_STATE (CIRCUITPY_MEMORYMONITOR || CIRCUITPY_PROFILER)
 #define MICROPY_ENABLE_SOURCE_LINE       (1)
 #define MICROPY_EPOCH_IS_1970            (1)
 #define MICROPY_ERROR_REPORTING          (CIRCUITPY_FULL_BUILD ? MICROPY_ERROR_REPORTING_NORMAL : MICROPY_ERROR_REPORTING_TERSE)
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
+#define MICROPY_FLOAT_SHORTEST_REPR      (CIRCUITPY_FULL_BUILD)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
+#define MICROPY_GC_STACK_IN_FREE_HEAP    (1)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
 #define MP_PLAT_FREE_HEAP(ptr) port_free(ptr)
 #include "supervisor/port_heap.h"
@@ -83,12 +90,20 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_MEM_STATS                (0)
 #define MICROPY_MODULE_BUILTIN_INIT      (1)
 #define MICROPY_MODULE_BUILTIN_SUBPACKAGES (1)
+#define MICROPY_MODULE_COMPILE_CACHE     (CIRCUITPY_MODULE_COMPILE_CACHE)
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_TYPE_ATTR_CACHE  (CIRCUITPY_OPT_TYPE_ATTR_CACHE)
+#define MICROPY_OPT_FUSED_BYTECODE  (CIRCUITPY_OPT_FUSED_BYTECODE)
+#define MICROPY_OPT_NATIVE_TIER_UP  (CIRCUITPY_OPT_NATIVE_TIER_UP)
+#define MICROPY_OPT_QSTR_HASH_INDEX  (CIRCUITPY_OPT_QSTR_HASH_INDEX)
 #define MICROPY_OPT_MPZ_BITWISE          (0)
+#define MICROPY_OPT_MPZ_FAST_ARITH  (CIRCUITPY_OPT_MPZ_FAST_ARITH)
+#define MICROPY_OPT_FIND_SUBBYTES_HORSPOOL  (CIRCUITPY_OPT_FIND_SUBBYTES_HORSPOOL)
+#define MICROPY_OPT_LIST_STABLE_SORT  (CIRCUITPY_OPT_LIST_STABLE_SORT)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
 
@@ -128,6 +143,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_IO_IOBASE             (CIRCUITPY_IO_IOBASE)
 // In extmod
 #define MICROPY_PY_JSON                 (CIRCUITPY_JSON)
+#define MICROPY_PY_JSON_ITERPARSE       (CIRCUITPY_JSON && CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_MATH                  (0)
 #define MICROPY_PY_MICROPYTHON_MEM_INFO  (0)
 // Supplanted by shared-bindings/random
@@ -178,6 +194,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_VFS                 (1)
 #define MICROPY_VFS_FAT             (MICROPY_VFS)
 #define MICROPY_READER_VFS          (MICROPY_VFS)
+#define MICROPY_VFS_IMPORT_STAT_CACHE (CIRCUITPY_VFS_IMPORT_STAT_CACHE)
 
 // type definitions for the specific machine
 
@@ -253,6 +270,7 @@ typedef long mp_off_t;
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES    (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_CLASS_SLOTS                (CIRCUITPY_FULL_BUILD)
 
 #ifndef MICROPY_PY_COLLECTIONS_ORDEREDDICT
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT    (CIRCUITPY_FULL_BUILD)
@@ -279,6 +297,7 @@ typedef long mp_off_t;
 #define MICROPY_PY_RE_MATCH_GROUPS           (CIRCUITPY_RE)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END   (CIRCUITPY_RE)
 #define MICROPY_PY_RE_SUB                    (CIRCUITPY_RE)
+#define MICROPY_PY_RE_PIKEVM                 (CIRCUITPY_RE && CIRCUITPY_FULL_BUILD)
 
 #define CIRCUITPY_MICROPYTHON_ADVANCED        (0)
 
@@ -290,6 +309,12 @@ typedef long mp_off_t;
 #define MICROPY_FATFS_MKFS_FAT32           (CIRCUITPY_FULL_BUILD)
 #endif
 
+// Files opened read-only that span at least this many clusters get a cluster link map so that
+// seeking in them doesn't walk the FAT chain from the start.
+#ifndef CIRCUITPY_FATFS_FASTSEEK_MIN_CLUSTERS
+#define CIRCUITPY_FATFS_FASTSEEK_MIN_CLUSTERS (2)
+#endif
+
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
 #ifdef LONGINT_IMPL_NONE
@@ -371,6 +396,12 @@ typedef long mp_off_t;
 #define CIRCUITPY_CONSOLE_UART_HEXDUMP(...) (void)0
 #endif
 
+// Console output is collected here and sent to all of the serial outputs at once instead of
+// fragment by fragment. 0 sends every write straight through.
+#ifndef CIRCUITPY_SERIAL_TX_BUFFER_SIZE
+#define CIRCUITPY_SERIAL_TX_BUFFER_SIZE (CIRCUITPY_FULL_BUILD ? 128 : 0)
+#endif
+
 // These CIRCUITPY_xxx values should all be defined in the *.mk files as being on or off.
 // So if any are not defined in *.mk, they'll throw an error here.
 
@@ -384,9 +415,24 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// BusDisplay and EPaperDisplay refresh buffer size in bytes. Sizes above the 512 byte
+// stack buffer are allocated from the port heap, falling back to the stack buffer when
+// the allocation fails.
+#ifndef CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE
+#define CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE (512)
+#endif
+
+// Internal RAM used to cache blocks of a large bitmap in external RAM while it is drawn.
+// 0 disables the cache.
+#ifndef CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+#define CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE (0)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
+#define CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE (0)
+#define CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE (0)
 #endif
 
 // This is not a top-level module; it's microcontroller.nvm.
@@ -646,6 +692,16 @@ void background_callback_run_all(void);
 #define CIRCUITPY_SAVES_PARTITION_SIZE 0
 #endif
 
+// littlefs block size for a CIRCUITPY_SAVES_LITTLEFS partition. It should be a multiple of the
+// flash erase sector so a block can be rewritten without touching its neighbors.
+#ifndef CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE
+#define CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE (4096)
+#endif
+
+#if CIRCUITPY_SAVES_LITTLEFS && CIRCUITPY_SAVES_PARTITION_SIZE == 0
+#error "CIRCUITPY_SAVES_LITTLEFS requires CIRCUITPY_SAVES_PARTITION_SIZE"
+#endif
+
 // Boards that have a boot button connected to a GPIO pin should set
 // CIRCUITPY_BOOT_BUTTON_NO_GPIO to 1.
 #ifndef CIRCUITPY_BOOT_BUTTON_NO_GPIO
@@ -107,6 +107,9 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+CIRCUITPY_ARRAYOPS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_ARRAYOPS=$(CIRCUITPY_ARRAYOPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -138,6 +141,11 @@ CIRCUITPY_AUDIOCORE_DEBUG ?= 0
 endif
 CFLAGS += -DCIRCUITPY_AUDIOCORE_DEBUG=$(CIRCUITPY_AUDIOCORE_DEBUG)
 
+# Times every get_buffer call and the audio outputs' refill latency. Adds a little work to each
+# audio buffer so it is off by default.
+CIRCUITPY_AUDIOCORE_STATS ?= 0
+CFLAGS += -DCIRCUITPY_AUDIOCORE_STATS=$(CIRCUITPY_AUDIOCORE_STATS)
+
 CIRCUITPY_AUDIOMP3 ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_AUDIOCORE))
 CFLAGS += -DCIRCUITPY_AUDIOMP3=$(CIRCUITPY_AUDIOMP3)
 
@@ -218,6 +226,10 @@ CFLAGS += -DCIRCUITPY_CODEOP=$(CIRCUITPY_CODEOP)
 CIRCUITPY_COLLECTIONS ?= 1
 CFLAGS += -DCIRCUITPY_COLLECTIONS=$(CIRCUITPY_COLLECTIONS)
 
+# Compiles .py files a batch of statements at a time, so that large files fit in small heaps.
+CIRCUITPY_COMP_STREAMING ?= 1
+CFLAGS += -DCIRCUITPY_COMP_STREAMING=$(CIRCUITPY_COMP_STREAMING)
+
 CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE ?= 0
 CFLAGS += -DCIRCUITPY_COMPUTED_GOTO_SAVE_SPACE=$(CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 
@@ -233,6 +245,9 @@ CFLAGS += -DCIRCUITPY_COPROC=$(CIRCUITPY_COPROC)
 CIRCUITPY_COUNTIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_COUNTIO=$(CIRCUITPY_COUNTIO)
 
+CIRCUITPY_CRC ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_CRC=$(CIRCUITPY_CRC)
+
 CIRCUITPY_DISPLAYIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_DISPLAYIO=$(CIRCUITPY_DISPLAYIO)
 
@@ -364,6 +379,10 @@ CFLAGS += -DCIRCUITPY_KEYPAD_KEYS=$(CIRCUITPY_KEYPAD_KEYS)
 CIRCUITPY_KEYPAD_KEYMATRIX ?= $(CIRCUITPY_KEYPAD)
 CFLAGS += -DCIRCUITPY_KEYPAD_KEYMATRIX=$(CIRCUITPY_KEYPAD_KEYMATRIX)
 
+# Scan KeyMatrix in port hardware when the pins allow it. The port provides keypad_keymatrix_pio_*().
+CIRCUITPY_KEYPAD_KEYMATRIX_PIO ?= 0
+CFLAGS += -DCIRCUITPY_KEYPAD_KEYMATRIX_PIO=$(CIRCUITPY_KEYPAD_KEYMATRIX_PIO)
+
 CIRCUITPY_KEYPAD_SHIFTREGISTERKEYS ?= $(CIRCUITPY_KEYPAD)
 CFLAGS += -DCIRCUITPY_KEYPAD_SHIFTREGISTERKEYS=$(CIRCUITPY_KEYPAD_SHIFTREGISTERKEYS)
 
@@ -391,6 +410,10 @@ CFLAGS += -DCIRCUITPY_MEMORYMONITOR=$(CIRCUITPY_MEMORYMONITOR)
 CIRCUITPY_MICROCONTROLLER ?= 1
 CFLAGS += -DCIRCUITPY_MICROCONTROLLER=$(CIRCUITPY_MICROCONTROLLER)
 
+# Saves compiled code in .mpycache directories. Adds metadata to every function.
+CIRCUITPY_MODULE_COMPILE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_MODULE_COMPILE_CACHE=$(CIRCUITPY_MODULE_COMPILE_CACHE)
+
 CIRCUITPY_MSGPACK ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_MSGPACK=$(CIRCUITPY_MSGPACK)
 
@@ -409,6 +432,32 @@ CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PAT
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_TYPE_ATTR_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_TYPE_ATTR_CACHE=$(CIRCUITPY_OPT_TYPE_ATTR_CACHE)
+
+CIRCUITPY_OPT_FUSED_BYTECODE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_FUSED_BYTECODE=$(CIRCUITPY_OPT_FUSED_BYTECODE)
+
+# Needs the native emitter, which only boards with CIRCUITPY_ENABLE_MPY_NATIVE have.
+CIRCUITPY_OPT_NATIVE_TIER_UP ?= 0
+CFLAGS += -DCIRCUITPY_OPT_NATIVE_TIER_UP=$(CIRCUITPY_OPT_NATIVE_TIER_UP)
+
+CIRCUITPY_OPT_QSTR_HASH_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_QSTR_HASH_INDEX=$(CIRCUITPY_OPT_QSTR_HASH_INDEX)
+
+CIRCUITPY_OPT_MPZ_FAST_ARITH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_FAST_ARITH=$(CIRCUITPY_OPT_MPZ_FAST_ARITH)
+
+CIRCUITPY_OPT_FIND_SUBBYTES_HORSPOOL ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_FIND_SUBBYTES_HORSPOOL=$(CIRCUITPY_OPT_FIND_SUBBYTES_HORSPOOL)
+
+CIRCUITPY_OPT_LIST_STABLE_SORT ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_LIST_STABLE_SORT=$(CIRCUITPY_OPT_LIST_STABLE_SORT)
+
+# Decode error messages with a 512 byte lookup table instead of a bit at a time.
+CIRCUITPY_TRANSLATE_LOOKUP ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_TRANSLATE_LOOKUP=$(CIRCUITPY_TRANSLATE_LOOKUP)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
@@ -429,6 +478,9 @@ CFLAGS += -DCIRCUITPY_PIXELMAP=$(CIRCUITPY_PIXELMAP)
 CIRCUITPY_PORT_SERIAL ?= 0
 CFLAGS += -DCIRCUITPY_PORT_SERIAL=$(CIRCUITPY_PORT_SERIAL)
 
+CIRCUITPY_PROFILER ?= 0
+CFLAGS += -DCIRCUITPY_PROFILER=$(CIRCUITPY_PROFILER)
+
 # Only for SAMD boards for the moment
 CIRCUITPY_PS2IO ?= 0
 CFLAGS += -DCIRCUITPY_PS2IO=$(CIRCUITPY_PS2IO)
@@ -497,6 +549,14 @@ CFLAGS += -DCIRCUITPY_SAFEMODE_PY=$(CIRCUITPY_SAFEMODE_PY)
 CIRCUITPY_SAMD ?= 0
 CFLAGS += -DCIRCUITPY_SAMD=$(CIRCUITPY_SAMD)
 
+# Format the SAVES partition (CIRCUITPY_SAVES_PARTITION_SIZE) as littlefs instead of FAT.
+# It is then only reachable from Python at /saves, not over USB or the workflows.
+CIRCUITPY_SAVES_LITTLEFS ?= 0
+CFLAGS += -DCIRCUITPY_SAVES_LITTLEFS=$(CIRCUITPY_SAVES_LITTLEFS)
+ifeq ($(CIRCUITPY_SAVES_LITTLEFS),1)
+MICROPY_VFS_LFS2 = 1
+endif
+
 CIRCUITPY_SDCARDIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_SDCARDIO=$(CIRCUITPY_SDCARDIO)
 
@@ -512,6 +572,15 @@ CFLAGS += -DCIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY=$(CIRCUITPY_SETTABLE_PROCESSO
 CIRCUITPY_SHARPDISPLAY ?= $(CIRCUITPY_FRAMEBUFFERIO)
 CFLAGS += -DCIRCUITPY_SHARPDISPLAY=$(CIRCUITPY_SHARPDISPLAY)
 
+# Records when each stage of startup finished, for supervisor.runtime.boot_trace().
+CIRCUITPY_BOOT_TRACE ?= 0
+CFLAGS += -DCIRCUITPY_BOOT_TRACE=$(CIRCUITPY_BOOT_TRACE)
+
+# When woken by a deep sleep alarm, wait for code.py to finish without going back to deep sleep
+# before starting the web workflow, and skip the boot-time status bar update.
+CIRCUITPY_FAST_WAKE ?= 0
+CFLAGS += -DCIRCUITPY_FAST_WAKE=$(CIRCUITPY_FAST_WAKE)
+
 # Disable the safe mode blink at boot. Speeds up boot time, but makes it
 # impossible to enter safe mode by pressing buttons on boot.
 CIRCUITPY_SKIP_SAFE_MODE_WAIT ?= 0
@@ -526,6 +595,10 @@ CFLAGS += -DCIRCUITPY_SPITARGET=$(CIRCUITPY_SPITARGET)
 CIRCUITPY_SOCKETPOOL_IPV6 ?= 0
 CFLAGS += -DCIRCUITPY_SOCKETPOOL_IPV6=$(CIRCUITPY_SOCKETPOOL_IPV6)
 
+# Socket.send_coalesce_ms: hold small TCP sends and flush them together
+CIRCUITPY_SOCKETPOOL_SEND_COALESCE ?= 0
+CFLAGS += -DCIRCUITPY_SOCKETPOOL_SEND_COALESCE=$(CIRCUITPY_SOCKETPOOL_SEND_COALESCE)
+
 CIRCUITPY_SSL ?= $(CIRCUITPY_WIFI)
 CFLAGS += -DCIRCUITPY_SSL=$(CIRCUITPY_SSL)
 
@@ -551,6 +624,11 @@ CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 CIRCUITPY_SUPERVISOR ?= 1
 CFLAGS += -DCIRCUITPY_SUPERVISOR=$(CIRCUITPY_SUPERVISOR)
 
+# Times every background callback, grouped by callback function. Adds a little work to each
+# callback so it is off by default.
+CIRCUITPY_BACKGROUND_CALLBACK_STATS ?= 0
+CFLAGS += -DCIRCUITPY_BACKGROUND_CALLBACK_STATS=$(CIRCUITPY_BACKGROUND_CALLBACK_STATS)
+
 CIRCUITPY_SYNTHIO ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_SYNTHIO=$(CIRCUITPY_SYNTHIO)
 
@@ -624,6 +702,12 @@ CIRCUITPY_USB_CDC_CONSOLE_ENABLED_DEFAULT ?= 1
 CFLAGS += -DCIRCUITPY_USB_CDC_CONSOLE_ENABLED_DEFAULT=$(CIRCUITPY_USB_CDC_CONSOLE_ENABLED_DEFAULT)
 CIRCUITPY_USB_CDC_DATA_ENABLED_DEFAULT ?= 0
 CFLAGS += -DCIRCUITPY_USB_CDC_DATA_ENABLED_DEFAULT=$(CIRCUITPY_USB_CDC_DATA_ENABLED_DEFAULT)
+# Size in bytes of each CDC interface's receive and transmit FIFOs. 0 uses the TinyUSB default
+# of one packet. Larger FIFOs let usb_cdc.data keep the bus busy while Python runs.
+CIRCUITPY_USB_CDC_RX_BUFSIZE ?= 0
+CFLAGS += -DCIRCUITPY_USB_CDC_RX_BUFSIZE=$(CIRCUITPY_USB_CDC_RX_BUFSIZE)
+CIRCUITPY_USB_CDC_TX_BUFSIZE ?= 0
+CFLAGS += -DCIRCUITPY_USB_CDC_TX_BUFSIZE=$(CIRCUITPY_USB_CDC_TX_BUFSIZE)
 
 # HID is available by default, but is not turned on if there are fewer than 5 endpoints.
 CIRCUITPY_USB_HID ?= $(CIRCUITPY_USB_DEVICE)
@@ -634,6 +718,10 @@ CFLAGS += -DCIRCUITPY_USB_HID_ENABLED_DEFAULT=$(CIRCUITPY_USB_HID_ENABLED_DEFAUL
 CIRCUITPY_USB_VIDEO ?= 0
 CFLAGS += -DCIRCUITPY_USB_VIDEO=$(CIRCUITPY_USB_VIDEO)
 
+# Plays host audio through the audiocore sample protocol, so it needs audiocore.
+CIRCUITPY_USB_AUDIO ?= 0
+CFLAGS += -DCIRCUITPY_USB_AUDIO=$(CIRCUITPY_USB_AUDIO)
+
 CIRCUITPY_USB_HOST ?= 0
 CFLAGS += -DCIRCUITPY_USB_HOST=$(CIRCUITPY_USB_HOST)
 
@@ -694,6 +782,10 @@ CIRCUITPY_ULAB_OPTIMIZE_SIZE ?= 0
 CIRCUITPY_VIDEOCORE ?= 0
 CFLAGS += -DCIRCUITPY_VIDEOCORE=$(CIRCUITPY_VIDEOCORE)
 
+# Remembers where modules to import were found, and weren't. Uses static RAM.
+CIRCUITPY_VFS_IMPORT_STAT_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_VFS_IMPORT_STAT_CACHE=$(CIRCUITPY_VFS_IMPORT_STAT_CACHE)
+
 CIRCUITPY_WARNINGS ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_WARNINGS=$(CIRCUITPY_WARNINGS)
 
@@ -710,6 +802,9 @@ CFLAGS += -DCIRCUITPY_WEB_WORKFLOW=$(CIRCUITPY_WEB_WORKFLOW)
 CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS?= 1
 CFLAGS += -DCIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS=$(CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS)
 
+CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL ?= 0
+CFLAGS += -DCIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL=$(CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL)
+
 # tinyusb port tailored configuration
 CIRCUITPY_TUSB_MEM_ALIGN ?= 4
 CFLAGS += -DCIRCUITPY_TUSB_MEM_ALIGN=$(CIRCUITPY_TUSB_MEM_ALIGN)
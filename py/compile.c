@@ -36,6 +36,8 @@
 #include "py/runtime.h"
 #include "py/asmbase.h"
 #include "py/nativeglue.h"
+// CIRCUITPY-CHANGE
+#include "py/objfun.h"
 #include "py/persistentcode.h"
 #include "py/smallint.h"
 
@@ -200,6 +202,13 @@ typedef struct _compiler_t {
     #endif
 
     mp_emit_common_t emit_common;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    // the function to compile with the native emitter, and its scope once created
+    mp_parse_node_struct_t *tier_up_funcdef;
+    scope_t *tier_up_scope;
+    #endif
 } compiler_t;
 
 #if MICROPY_COMP_ALLOW_TOP_LEVEL_AWAIT
@@ -780,8 +789,21 @@ static void compile_funcdef_lambdef(compiler_t *comp, scope_t *scope, mp_parse_n
 // returns function name
 static qstr compile_funcdef_helper(compiler_t *comp, mp_parse_node_struct_t *pns, uint emit_options) {
     if (comp->pass == MP_PASS_SCOPE) {
+        // CIRCUITPY-CHANGE: a function not decorated to choose an emitter may be
+        // the one to compile to native code
+        #if MICROPY_OPT_NATIVE_TIER_UP
+        bool tier_up = pns == comp->tier_up_funcdef && emit_options == MP_EMIT_OPT_NONE;
+        if (tier_up) {
+            emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+        }
+        #endif
         // create a new scope for this function
         scope_t *s = scope_new_and_link(comp, SCOPE_FUNCTION, (mp_parse_node_t)pns, emit_options);
+        #if MICROPY_OPT_NATIVE_TIER_UP
+        if (tier_up) {
+            comp->tier_up_scope = s;
+        }
+        #endif
         // store the function scope so the compiling function can use it at each pass
         pns->nodes[4] = (mp_parse_node_t)s;
     }
@@ -3479,14 +3501,20 @@ static void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
-static
-#endif
-void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
+// CIRCUITPY-CHANGE: tier_up_funcdef is compiled with the native emitter, and
+// its raw code is returned
+static mp_raw_code_t *compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm,
+    mp_parse_node_struct_t *tier_up_funcdef) {
     // put compiler state on the stack, it's relatively small
     compiler_t comp_state = {0};
     compiler_t *comp = &comp_state;
 
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    comp->tier_up_funcdef = tier_up_funcdef;
+    #else
+    (void)tier_up_funcdef;
+    #endif
+
     comp->is_repl = is_repl;
     comp->break_label = INVALID_LABEL;
     comp->continue_label = INVALID_LABEL;
@@ -3672,6 +3700,13 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     // free the parse tree
     mp_parse_tree_clear(parse_tree);
 
+    mp_raw_code_t *tier_up_rc = NULL;
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    if (comp->tier_up_scope != NULL) {
+        tier_up_rc = comp->tier_up_scope->raw_code;
+    }
+    #endif
+
     // free the scopes
     for (scope_t *s = module_scope; s;) {
         scope_t *next = s->next;
@@ -3682,6 +3717,19 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     if (comp->compile_error != MP_OBJ_NULL) {
         nlr_raise(comp->compile_error);
     }
+
+    return tier_up_rc;
+}
+
+#if !MICROPY_PERSISTENT_CODE_SAVE
+static
+#endif
+void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
+    compile_to_raw_code(parse_tree, source_file, is_repl, cm, NULL);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    mp_obj_fun_bc_tier_up_set_source(cm->context, source_file);
+    #endif
 }
 
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
@@ -3693,4 +3741,74 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
     return mp_make_function_from_proto_fun(cm.rc, cm.context, NULL);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+// Finds the last function called name defined on or before line.
+static void find_funcdef(mp_parse_node_t pn, qstr name, size_t line, mp_parse_node_struct_t **funcdef) {
+    if (!MP_PARSE_NODE_IS_STRUCT(pn)) {
+        return;
+    }
+    mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn;
+    // nothing inside a node starts before it does
+    if (pns->source_line > line || MP_PARSE_NODE_STRUCT_KIND(pns) == PN_const_object) {
+        return;
+    }
+    if (MP_PARSE_NODE_STRUCT_KIND(pns) == PN_funcdef
+        && MP_PARSE_NODE_LEAF_ARG(pns->nodes[0]) == name
+        && (*funcdef == NULL || (*funcdef)->source_line < pns->source_line)) {
+        *funcdef = pns;
+    }
+    size_t num_nodes = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
+    for (size_t i = 0; i < num_nodes; i++) {
+        find_funcdef(pns->nodes[i], name, line, funcdef);
+    }
+}
+
+mp_raw_code_t *mp_compile_tier_up(mp_parse_tree_t *parse_tree, qstr source_file, qstr name, size_t line, mp_module_context_t *context) {
+    mp_parse_node_struct_t *funcdef = NULL;
+    find_funcdef(parse_tree->root, name, line, &funcdef);
+    if (funcdef == NULL) {
+        mp_parse_tree_clear(parse_tree);
+        return NULL;
+    }
+    mp_compiled_module_t cm;
+    cm.context = context;
+    return compile_to_raw_code(parse_tree, source_file, false, &cm, funcdef);
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+typedef struct _compile_batches_t {
+    qstr source_file;
+    mp_obj_t module_funs;
+} compile_batches_t;
+
+static void compile_batch(void *env, mp_parse_tree_t *parse_tree) {
+    compile_batches_t *batches = env;
+    mp_obj_list_append(batches->module_funs, mp_compile(parse_tree, batches->source_file, false));
+}
+
+static mp_obj_t run_batches(mp_obj_t module_funs) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(module_funs, &len, &items);
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_t module_fun = items[i];
+        // each batch runs once, so its code can be freed once it has run
+        items[i] = mp_const_none;
+        mp_call_function_0(module_fun);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(run_batches_obj, run_batches);
+
+mp_obj_t mp_compile_file_in_batches(mp_lexer_t *lex) {
+    compile_batches_t batches = { lex->source_name, mp_obj_new_list(0, NULL) };
+    mp_parse_file_in_batches(lex, compile_batch, &batches);
+    // return function that executes each batch in turn
+    return mp_obj_new_closure(MP_OBJ_FROM_PTR(&run_batches_obj), 1, &batches.module_funs);
+}
+#endif
+
 #endif // MICROPY_ENABLE_COMPILER
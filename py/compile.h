@@ -45,6 +45,22 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// like mp_parse with MP_PARSE_FILE_INPUT then mp_compile, but without the parse
+// tree of the whole file in memory at once
+// the parser will free the lexer before it returns
+mp_obj_t mp_compile_file_in_batches(mp_lexer_t *lex);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+// like mp_compile_to_raw_code, but the last function called name defined on or
+// before the given line is compiled with the native emitter
+// returns the raw code of that function, or NULL if there isn't one
+mp_raw_code_t *mp_compile_tier_up(mp_parse_tree_t *parse_tree, qstr source_file, qstr name, size_t line, mp_module_context_t *context);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
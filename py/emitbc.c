@@ -73,6 +73,16 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    // The last two opcodes written, most recent first, and their offsets, for
+    // fusing with the opcode being written. Nothing before the last label or
+    // source line, at fuse_barrier, is fused with anything after it.
+    byte fuse_op[2];
+    size_t fuse_offset[2];
+    size_t fuse_barrier;
+    #endif
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -167,10 +177,47 @@ static void emit_write_bytecode_raw_byte(emit_t *emit, byte b1) {
 
 static void emit_write_bytecode_byte(emit_t *emit, int stack_adj, byte b1) {
     mp_emit_bc_adjust_stack_size(emit, stack_adj);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    if (!emit->suppress) {
+        emit->fuse_op[1] = emit->fuse_op[0];
+        emit->fuse_offset[1] = emit->fuse_offset[0];
+        emit->fuse_op[0] = b1;
+        emit->fuse_offset[0] = emit->bytecode_offset;
+    }
+    #endif
     byte *c = emit_get_cur_to_write_bytecode(emit, 1);
     c[0] = b1;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_FUSED_BYTECODE
+// Returns the n'th last opcode written, counting from 0, if it and every opcode
+// after it is a single byte that can be fused with the one being written.
+// Otherwise returns MP_BC_BASE_RESERVED, which is never fused.
+static byte emit_fusable_op(emit_t *emit, size_t n) {
+    size_t end = emit->bytecode_offset;
+    for (size_t i = 0; i <= n; i++) {
+        if (emit->fuse_offset[i] + 1 != end) {
+            return MP_BC_BASE_RESERVED;
+        }
+        end = emit->fuse_offset[i];
+    }
+    if (emit->suppress || end < emit->fuse_barrier) {
+        return MP_BC_BASE_RESERVED;
+    }
+    return emit->fuse_op[n];
+}
+
+// Goes back to the n'th last opcode written, to write a fused opcode over it
+// and the ones after it.
+static void emit_fuse_rewind(emit_t *emit, size_t n) {
+    emit->bytecode_offset = emit->fuse_offset[n];
+    emit->fuse_op[0] = MP_BC_BASE_RESERVED;
+    emit->fuse_op[1] = MP_BC_BASE_RESERVED;
+}
+#endif
+
 // Similar to mp_encode_uint(), just some extra handling to encode sign
 static void emit_write_bytecode_byte_int(emit_t *emit, int stack_adj, byte b1, mp_int_t num) {
     emit_write_bytecode_byte(emit, stack_adj, b1);
@@ -291,6 +338,12 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    emit->fuse_op[0] = MP_BC_BASE_RESERVED;
+    emit->fuse_op[1] = MP_BC_BASE_RESERVED;
+    emit->fuse_barrier = 0;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -438,6 +491,10 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_FUSED_BYTECODE
+        emit->fuse_barrier = emit->bytecode_offset;
+        #endif
     }
     #else
     (void)emit;
@@ -463,6 +520,11 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
 
     // Assign label offset.
     emit->label_offsets[l] = emit->bytecode_offset;
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    emit->fuse_barrier = emit->bytecode_offset;
+    #endif
 }
 
 void mp_emit_bc_import(emit_t *emit, qstr qst, int kind) {
@@ -528,6 +590,17 @@ void mp_emit_bc_load_global(emit_t *emit, qstr qst, int kind) {
 }
 
 void mp_emit_bc_load_method(emit_t *emit, qstr qst, bool is_super) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    byte op = emit_fusable_op(emit, 0);
+    if (!is_super && MP_BC_LOAD_FAST_MULTI <= op && op < MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM) {
+        emit_fuse_rewind(emit, 0);
+        emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_METHOD);
+        emit_write_bytecode_raw_byte(emit, op - MP_BC_LOAD_FAST_MULTI);
+        mp_encode_uint(emit, emit_get_cur_to_write_bytecode, mp_emit_common_use_qstr(emit->emit_common, qst));
+        return;
+    }
+    #endif
     int stack_adj = 1 - 2 * is_super;
     emit_write_bytecode_byte_qstr(emit, stack_adj, is_super ? MP_BC_LOAD_SUPER_METHOD : MP_BC_LOAD_METHOD, qst);
 }
@@ -550,6 +623,17 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
     if (kind == MP_EMIT_ATTR_LOAD) {
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_FUSED_BYTECODE
+        byte op = emit_fusable_op(emit, 0);
+        if (MP_BC_LOAD_FAST_MULTI <= op && op < MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM) {
+            emit_fuse_rewind(emit, 0);
+            emit_write_bytecode_byte(emit, 0, MP_BC_LOAD_FAST_ATTR);
+            emit_write_bytecode_raw_byte(emit, op - MP_BC_LOAD_FAST_MULTI);
+            mp_encode_uint(emit, emit_get_cur_to_write_bytecode, mp_emit_common_use_qstr(emit->emit_common, qst));
+            return;
+        }
+        #endif
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
         if (kind == MP_EMIT_ATTR_DELETE) {
@@ -616,6 +700,17 @@ void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    byte op = emit_fusable_op(emit, 0);
+    if (MP_BC_BINARY_OP_MULTI <= op && op < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
+        // The binary op follows the jump offset, which is relative to the op.
+        emit_fuse_rewind(emit, 0);
+        emit_write_bytecode_byte_label(emit, -1, cond ? MP_BC_BINARY_OP_POP_JUMP_IF_TRUE : MP_BC_BINARY_OP_POP_JUMP_IF_FALSE, label);
+        emit_write_bytecode_raw_byte(emit, op - MP_BC_BINARY_OP_MULTI);
+        return;
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -725,6 +820,24 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    byte lhs_op = emit_fusable_op(emit, 1);
+    byte rhs_op = emit_fusable_op(emit, 0);
+    if (MP_BC_LOAD_FAST_MULTI <= lhs_op && lhs_op < MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM
+        && MP_BC_LOAD_CONST_SMALL_INT_MULTI <= rhs_op
+        && rhs_op < MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM) {
+        // The local (4 bits), the int (6 bits) and the op (6 bits) fit in the two
+        // bytes the loads took.
+        MP_STATIC_ASSERT(MP_BINARY_OP_NUM_BYTECODE <= 64);
+        byte local = lhs_op - MP_BC_LOAD_FAST_MULTI;
+        byte num = rhs_op - MP_BC_LOAD_CONST_SMALL_INT_MULTI;
+        emit_fuse_rewind(emit, 1);
+        emit_write_bytecode_byte(emit, -1, MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP);
+        emit_write_bytecode_raw_byte(emit, local | (num & 0xf) << 4);
+        emit_write_bytecode_raw_byte(emit, op | (num >> 4) << 6);
+    } else
+    #endif
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
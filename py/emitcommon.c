@@ -71,6 +71,9 @@ static bool strictly_equal(mp_obj_t a, mp_obj_t b) {
             }
         }
         return true;
+    // CIRCUITPY-CHANGE: const() dicts are only shared when they are the same object
+    } else if (a_type == &mp_type_dict) {
+        return false;
     } else {
         return mp_obj_equal(a, b);
     }
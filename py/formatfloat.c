@@ -33,6 +33,9 @@
 #include <stdint.h>
 #include <math.h>
 #include "py/formatfloat.h"
+// CIRCUITPY-CHANGE
+#include "py/gc.h"
+#include "py/parsenum.h"
 
 /***********************************************************************
 
@@ -423,4 +426,376 @@ int mp_format_float(FPTYPE f, char *buf, size_t buf_size, char fmt, int prec, ch
     return s - buf;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_FLOAT_SHORTEST_REPR
+
+/***********************************************************************
+
+  Shortest round-trip formatting, by the Grisu2 algorithm from Florian
+  Loitsch's "Printing Floating-Point Numbers Quickly and Accurately with
+  Integers". The value and the halfway points to its neighbours are scaled
+  by a cached power of ten into 64-bit fixed point, so that the digits come
+  from integer division alone. The digits always read back as the same
+  float. Rounding in the scaling leaves a few values near a boundary
+  uncertain, and with big integers those are checked exactly so that the
+  digits are always the shortest.
+
+***********************************************************************/
+
+// A 64-bit significand and binary exponent, f * 2^e.
+typedef struct _diy_fp_t {
+    uint64_t f;
+    int e;
+} diy_fp_t;
+
+typedef struct _cached_power_t {
+    uint64_t f;
+    int16_t e;
+    int16_t k;
+} cached_power_t;
+
+#if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C
+// Boxing a float drops its two lowest fraction bits, so anything up to
+// 3.5 ulp above the value reads back as it.
+#define SHORTEST_UPPER_HALF_ULPS (7)
+#else
+#define SHORTEST_UPPER_HALF_ULPS (1)
+#endif
+
+// The scaled significands fall in [2^ALPHA, 2^GAMMA) times 2^64.
+#define GRISU_ALPHA (-60)
+#define GRISU_GAMMA (-32)
+
+// 10^k for k = -300, -292, ..., 324, rounded to 64 bits. Single precision
+// only needs the powers for its smaller exponent range.
+#define CACHED_POWERS_DEC_STEP (8)
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+#define CACHED_POWERS_FIRST_INDEX (0)
+#else
+#define CACHED_POWERS_FIRST_INDEX (33)
+#endif
+static const cached_power_t cached_powers[] = {
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    { 0xab70fe17c79ac6ca, -1060, -300 },
+    { 0xff77b1fcbebcdc4f, -1034, -292 },
+    { 0xbe5691ef416bd60c, -1007, -284 },
+    { 0x8dd01fad907ffc3c, -980, -276 },
+    { 0xd3515c2831559a83, -954, -268 },
+    { 0x9d71ac8fada6c9b5, -927, -260 },
+    { 0xea9c227723ee8bcb, -901, -252 },
+    { 0xaecc49914078536d, -874, -244 },
+    { 0x823c12795db6ce57, -847, -236 },
+    { 0xc21094364dfb5637, -821, -228 },
+    { 0x9096ea6f3848984f, -794, -220 },
+    { 0xd77485cb25823ac7, -768, -212 },
+    { 0xa086cfcd97bf97f4, -741, -204 },
+    { 0xef340a98172aace5, -715, -196 },
+    { 0xb23867fb2a35b28e, -688, -188 },
+    { 0x84c8d4dfd2c63f3b, -661, -180 },
+    { 0xc5dd44271ad3cdba, -635, -172 },
+    { 0x936b9fcebb25c996, -608, -164 },
+    { 0xdbac6c247d62a584, -582, -156 },
+    { 0xa3ab66580d5fdaf6, -555, -148 },
+    { 0xf3e2f893dec3f126, -529, -140 },
+    { 0xb5b5ada8aaff80b8, -502, -132 },
+    { 0x87625f056c7c4a8b, -475, -124 },
+    { 0xc9bcff6034c13053, -449, -116 },
+    { 0x964e858c91ba2655, -422, -108 },
+    { 0xdff9772470297ebd, -396, -100 },
+    { 0xa6dfbd9fb8e5b88f, -369, -92 },
+    { 0xf8a95fcf88747d94, -343, -84 },
+    { 0xb94470938fa89bcf, -316, -76 },
+    { 0x8a08f0f8bf0f156b, -289, -68 },
+    { 0xcdb02555653131b6, -263, -60 },
+    { 0x993fe2c6d07b7fac, -236, -52 },
+    { 0xe45c10c42a2b3b06, -210, -44 },
+    #endif
+    { 0xaa242499697392d3, -183, -36 },
+    { 0xfd87b5f28300ca0e, -157, -28 },
+    { 0xbce5086492111aeb, -130, -20 },
+    { 0x8cbccc096f5088cc, -103, -12 },
+    { 0xd1b71758e219652c, -77, -4 },
+    { 0x9c40000000000000, -50, 4 },
+    { 0xe8d4a51000000000, -24, 12 },
+    { 0xad78ebc5ac620000, 3, 20 },
+    { 0x813f3978f8940984, 30, 28 },
+    { 0xc097ce7bc90715b3, 56, 36 },
+    { 0x8f7e32ce7bea5c70, 83, 44 },
+    { 0xd5d238a4abe98068, 109, 52 },
+    #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    { 0x9f4f2726179a2245, 136, 60 },
+    { 0xed63a231d4c4fb27, 162, 68 },
+    { 0xb0de65388cc8ada8, 189, 76 },
+    { 0x83c7088e1aab65db, 216, 84 },
+    { 0xc45d1df942711d9a, 242, 92 },
+    { 0x924d692ca61be758, 269, 100 },
+    { 0xda01ee641a708dea, 295, 108 },
+    { 0xa26da3999aef774a, 322, 116 },
+    { 0xf209787bb47d6b85, 348, 124 },
+    { 0xb454e4a179dd1877, 375, 132 },
+    { 0x865b86925b9bc5c2, 402, 140 },
+    { 0xc83553c5c8965d3d, 428, 148 },
+    { 0x952ab45cfa97a0b3, 455, 156 },
+    { 0xde469fbd99a05fe3, 481, 164 },
+    { 0xa59bc234db398c25, 508, 172 },
+    { 0xf6c69a72a3989f5c, 534, 180 },
+    { 0xb7dcbf5354e9bece, 561, 188 },
+    { 0x88fcf317f22241e2, 588, 196 },
+    { 0xcc20ce9bd35c78a5, 614, 204 },
+    { 0x98165af37b2153df, 641, 212 },
+    { 0xe2a0b5dc971f303a, 667, 220 },
+    { 0xa8d9d1535ce3b396, 694, 228 },
+    { 0xfb9b7cd9a4a7443c, 720, 236 },
+    { 0xbb764c4ca7a44410, 747, 244 },
+    { 0x8bab8eefb6409c1a, 774, 252 },
+    { 0xd01fef10a657842c, 800, 260 },
+    { 0x9b10a4e5e9913129, 827, 268 },
+    { 0xe7109bfba19c0c9d, 853, 276 },
+    { 0xac2820d9623bf429, 880, 284 },
+    { 0x80444b5e7aa7cf85, 907, 292 },
+    { 0xbf21e44003acdd2d, 933, 300 },
+    { 0x8e679c2f5e44ff8f, 960, 308 },
+    { 0xd433179d9c8cb841, 986, 316 },
+    { 0x9e19db92b4e31ba9, 1013, 324 },
+    #endif
+};
+
+static diy_fp_t diy_fp_mul(diy_fp_t x, diy_fp_t y) {
+    // The upper 64 bits of the 128-bit product, rounded.
+    uint64_t a = x.f >> 32;
+    uint64_t b = x.f & 0xffffffff;
+    uint64_t c = y.f >> 32;
+    uint64_t d = y.f & 0xffffffff;
+    uint64_t ac = a * c;
+    uint64_t bc = b * c;
+    uint64_t ad = a * d;
+    uint64_t bd = b * d;
+    uint64_t mid = (bd >> 32) + (ad & 0xffffffff) + (bc & 0xffffffff) + (UINT64_C(1) << 31);
+    diy_fp_t r = { ac + (ad >> 32) + (bc >> 32) + (mid >> 32), x.e + y.e + 64 };
+    return r;
+}
+
+static diy_fp_t diy_fp_normalize(diy_fp_t x) {
+    while ((x.f >> 63) == 0) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+static uint64_t grisu2_round(char *buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t ten_k) {
+    // Move the last digit towards w while it stays inside the boundaries. Halfway
+    // between two digits, round to the even one as Python does.
+    while (rest < dist && delta - rest >= ten_k
+           && (rest + ten_k < dist || dist - rest > rest + ten_k - dist
+               || (dist - rest == rest + ten_k - dist && (buf[len - 1] & 1)))) {
+        buf[len - 1]--;
+        rest += ten_k;
+    }
+    return rest;
+}
+
+// Generates the fewest digits of w that lie between w_minus and w_plus, which must be
+// within [2^ALPHA, 2^GAMMA) times 2^64. The value is the digits times 10^*dec_exp.
+// *inside tells whether the digits are also at least slack units inside the boundaries.
+static int grisu2_digit_gen(diy_fp_t w_minus, diy_fp_t w, diy_fp_t w_plus, uint64_t slack,
+    char *buf, int *dec_exp, bool *inside) {
+    uint64_t delta = w_plus.f - w_minus.f;
+    uint64_t dist = w_plus.f - w.f;
+
+    // Split w_plus into its integral part p1 and fraction p2, then generate
+    // digits until the rest is within delta.
+    int shift = -w_plus.e;
+    uint64_t one = (uint64_t)1 << shift;
+    uint32_t p1 = w_plus.f >> shift;
+    uint64_t p2 = w_plus.f & (one - 1);
+
+    uint32_t pow10 = 1;
+    int n = 1;
+    while (n < 10 && p1 >= pow10 * 10) {
+        pow10 *= 10;
+        n++;
+    }
+
+    int len = 0;
+    uint64_t rest;
+    while (n > 0) {
+        buf[len++] = '0' + p1 / pow10;
+        p1 %= pow10;
+        n--;
+        rest = ((uint64_t)p1 << shift) + p2;
+        if (rest <= delta) {
+            *dec_exp += n;
+            rest = grisu2_round(buf, len, dist, delta, rest, (uint64_t)pow10 << shift);
+            goto done;
+        }
+        pow10 /= 10;
+    }
+
+    int m = 0;
+    for (;;) {
+        p2 *= 10;
+        buf[len++] = '0' + (p2 >> shift);
+        p2 &= one - 1;
+        m++;
+        delta *= 10;
+        dist *= 10;
+        slack *= 10;
+        if (p2 <= delta) {
+            break;
+        }
+    }
+    *dec_exp -= m;
+    rest = grisu2_round(buf, len, dist, delta, p2, one);
+
+done:
+    *inside = rest >= slack && delta - rest >= slack;
+    return len;
+}
+
+#if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_MPZ
+// Whether the digits read back as f, checked exactly.
+static bool grisu2_reads_back(FPTYPE f, const char *digits, int len, int dec_exp) {
+    if (gc_is_locked()) {
+        // The check needs big integers from the heap.
+        return false;
+    }
+    mp_float_union_t u = {f};
+    mp_float_union_t back = {mp_parse_float_nearest(f, digits, len, dec_exp)};
+    #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C
+    back.i &= ~3;
+    #endif
+    return back.i == u.i;
+}
+#endif
+
+// Writes the digits of a positive finite f to buf and returns how many there are. The
+// value is the digits times 10^*dec_exp.
+static int grisu2(FPTYPE f, char *buf, int *dec_exp) {
+    mp_float_union_t u = {f};
+    uint64_t frac = u.p.frc;
+    int bin_exp = u.p.exp;
+    const int bias = MP_FLOAT_EXP_OFFSET + MP_FLOAT_FRAC_BITS;
+    const uint64_t hidden_bit = (uint64_t)1 << MP_FLOAT_FRAC_BITS;
+
+    // v and the points halfway to the floats below and above it
+    diy_fp_t v;
+    if (bin_exp == 0) {
+        v.f = frac;
+        v.e = 1 - bias;
+    } else {
+        v.f = frac + hidden_bit;
+        v.e = bin_exp - bias;
+    }
+    diy_fp_t m_plus = { 2 * v.f + SHORTEST_UPPER_HALF_ULPS, v.e - 1 };
+    diy_fp_t m_minus;
+    if (frac == 0 && bin_exp > 1) {
+        // The float below is closer at a power of two.
+        m_minus.f = 4 * v.f - 1;
+        m_minus.e = v.e - 2;
+    } else {
+        m_minus.f = 2 * v.f - 1;
+        m_minus.e = v.e - 1;
+    }
+    m_plus = diy_fp_normalize(m_plus);
+    m_minus.f <<= m_minus.e - m_plus.e;
+    m_minus.e = m_plus.e;
+    v = diy_fp_normalize(v);
+
+    // Pick the cached power c ~= 10^-k that brings m_plus into range.
+    int e = GRISU_ALPHA - m_plus.e - 1;
+    int k = (e * 78913) / (1 << 18) + (e > 0);
+    int index = (300 + k + (CACHED_POWERS_DEC_STEP - 1)) / CACHED_POWERS_DEC_STEP - CACHED_POWERS_FIRST_INDEX;
+    assert(index >= 0 && (size_t)index < MP_ARRAY_SIZE(cached_powers));
+    const cached_power_t *cached = &cached_powers[index];
+    diy_fp_t c = { cached->f, cached->e };
+    diy_fp_t w = diy_fp_mul(v, c);
+    diy_fp_t w_minus = diy_fp_mul(m_minus, c);
+    diy_fp_t w_plus = diy_fp_mul(m_plus, c);
+    assert(w_plus.e >= GRISU_ALPHA && w_plus.e <= GRISU_GAMMA);
+
+    // The products are within a unit of the exact boundaries, so digits a unit inside them are
+    // certain to read back.
+    *dec_exp = -cached->k;
+    bool inside;
+    #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_MPZ
+    // Digits just outside may still read back, as with ties that round to even. Try those
+    // first, and check the rare ones not certain to read back exactly.
+    diy_fp_t wide_minus = { w_minus.f - 1, w_minus.e };
+    diy_fp_t wide_plus = { w_plus.f + 1, w_plus.e };
+    int len = grisu2_digit_gen(wide_minus, w, wide_plus, 2, buf, dec_exp, &inside);
+    if (inside || grisu2_reads_back(f, buf, len, *dec_exp)) {
+        return len;
+    }
+    *dec_exp = -cached->k;
+    #endif
+    diy_fp_t safe_minus = { w_minus.f + 1, w_minus.e };
+    diy_fp_t safe_plus = { w_plus.f - 1, w_plus.e };
+    return grisu2_digit_gen(safe_minus, w, safe_plus, 0, buf, dec_exp, &inside);
+}
+
+int mp_format_float_shortest(FPTYPE f, char *buf, size_t buf_size) {
+    assert(buf_size >= MP_FLOAT_SHORTEST_BUF_SIZE);
+    if (fp_isnan(f) || fp_isinf(f) || fp_iszero(f)) {
+        return mp_format_float(f, buf, buf_size, 'g', 1, '\0');
+    }
+
+    char *s = buf;
+    if (fp_signbit(f)) {
+        *s++ = '-';
+        f = -f;
+    }
+    char digits[17];
+    int dec_exp;
+    int len = grisu2(f, digits, &dec_exp);
+    // The decimal point goes after the first point digits.
+    int point = len + dec_exp;
+
+    // Like Python, use fixed notation from 1e-4 up to 1e16.
+    if (point > -4 && point <= 16) {
+        if (point <= 0) {
+            *s++ = '0';
+            *s++ = '.';
+            for (int i = point; i < 0; ++i) {
+                *s++ = '0';
+            }
+            point = 0;
+        }
+        for (int i = 0; i < len; ++i) {
+            if (i == point && point > 0) {
+                *s++ = '.';
+            }
+            *s++ = digits[i];
+        }
+        for (int i = len; i < point; ++i) {
+            *s++ = '0';
+        }
+    } else {
+        *s++ = digits[0];
+        if (len > 1) {
+            *s++ = '.';
+            for (int i = 1; i < len; ++i) {
+                *s++ = digits[i];
+            }
+        }
+        int e = point - 1;
+        *s++ = 'e';
+        if (e < 0) {
+            *s++ = '-';
+            e = -e;
+        } else {
+            *s++ = '+';
+        }
+        if (e >= 100) {
+            *s++ = '0' + e / 100;
+        }
+        *s++ = '0' + (e / 10) % 10;
+        *s++ = '0' + e % 10;
+    }
+    *s = '\0';
+    return s - buf;
+}
+
+#endif // MICROPY_FLOAT_SHORTEST_REPR
+
 #endif // MICROPY_FLOAT_IMPL != MICROPY_FLOAT_IMPL_NONE
@@ -30,6 +30,16 @@
 
 #if MICROPY_PY_BUILTINS_FLOAT
 int mp_format_float(mp_float_t f, char *buf, size_t bufSize, char fmt, int prec, char sign);
+// CIRCUITPY-CHANGE
+#if MICROPY_FLOAT_SHORTEST_REPR
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+#define MP_FLOAT_SHORTEST_BUF_SIZE (32)
+#else
+#define MP_FLOAT_SHORTEST_BUF_SIZE (24)
+#endif
+// Formats f with the fewest digits that read back as the same float, like Python's repr.
+int mp_format_float_shortest(mp_float_t f, char *buf, size_t buf_size);
+#endif
 #endif
 
 #endif // MICROPY_INCLUDED_PY_FORMATFLOAT_H
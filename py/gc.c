@@ -32,6 +32,11 @@
 #include "py/gc.h"
 #include "py/runtime.h"
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP || MICROPY_GC_MOVABLE || MICROPY_GC_STATS
+#include "py/mphal.h"
+#endif
+
 #if MICROPY_DEBUG_VALGRIND
 #include <valgrind/memcheck.h>
 #endif
@@ -91,6 +96,12 @@
 #define ATB_2_IS_FREE(a) (((a) & ATB_MASK_2) == 0)
 #define ATB_3_IS_FREE(a) (((a) & ATB_MASK_3) == 0)
 
+// CIRCUITPY-CHANGE: Long runs of free or used blocks are scanned a word of the ATB at a time.
+#define BLOCKS_PER_ATB_WORD (BLOCKS_PER_ATB * sizeof(uintptr_t))
+#define ATB_WORD_LOW_BITS ((uintptr_t)-1 / 3)
+#define ATB_WORD_ALL_TAIL (ATB_WORD_LOW_BITS << 1)
+#define ATB_WORD_NONE_FREE(w) ((((w) | ((w) >> 1)) & ATB_WORD_LOW_BITS) == ATB_WORD_LOW_BITS)
+
 #if MICROPY_GC_SPLIT_HEAP
 #define NEXT_AREA(area) ((area)->next)
 #else
@@ -108,6 +119,49 @@
 #define BLOCK_FROM_PTR(area, ptr) (((byte *)(ptr) - area->gc_pool_start) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)area->gc_pool_start))
 
+// CIRCUITPY-CHANGE
+// Returns the ATB word starting at byte index, or NULL if that byte isn't word aligned or the
+// word doesn't end by end_index.
+static inline uintptr_t *gc_atb_word(mp_state_mem_area_t *area, size_t index, size_t end_index) {
+    byte *atb = area->gc_alloc_table_start + index;
+    if (((uintptr_t)atb & (sizeof(uintptr_t) - 1)) != 0 || index + sizeof(uintptr_t) > end_index) {
+        return NULL;
+    }
+    return (uintptr_t *)(void *)atb;
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_SMALL_POOLS
+static void gc_small_pools_reset(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(MP_STATE_MEM(gc_small_pool)); i++) {
+        MP_STATE_MEM(gc_small_pool)[i].len = 0;
+        MP_STATE_MEM(gc_small_pool)[i].next = 0;
+        MP_STATE_MEM(gc_small_pool)[i].exhausted = false;
+    }
+}
+
+// Lets the pools be scanned again, once blocks that may leave a small hole have been freed.
+static inline void gc_small_pools_retry(void) {
+    for (size_t i = 0; i < MP_ARRAY_SIZE(MP_STATE_MEM(gc_small_pool)); i++) {
+        MP_STATE_MEM(gc_small_pool)[i].exhausted = false;
+    }
+}
+#endif
+
+// CIRCUITPY-CHANGE
+// Called when a chain of n_blocks in the area is freed outside of a sweep.
+static inline void gc_note_free(mp_state_mem_area_t *area, size_t n_blocks) {
+    area->gc_max_free_run = SIZE_MAX;
+    #if MICROPY_GC_SMALL_POOLS
+    // Only a chain that small can leave a hole that small.
+    if (n_blocks <= 2) {
+        gc_small_pools_retry();
+    }
+    #else
+    (void)n_blocks;
+    #endif
+}
+
 // After the ATB, there must be a byte filled with AT_FREE so that gc_mark_tree
 // cannot erroneously conclude that a block extends past the end of the GC heap
 // due to bit patterns in the FTB (or first block, if finalizers are disabled)
@@ -218,6 +272,8 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
 
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
+    // CIRCUITPY-CHANGE
+    area->gc_max_free_run = SIZE_MAX;
 
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
@@ -263,6 +319,33 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    MP_STATE_MEM(gc_sweep_running) = false;
+    MP_STATE_MEM(gc_sweep_budget_us) = 0;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_SMALL_POOLS
+    gc_small_pools_reset();
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    MP_STATE_MEM(gc_movable_len) = 0;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_collections) = 0;
+    MP_STATE_MEM(gc_stats_pause_total_us) = 0;
+    MP_STATE_MEM(gc_stats_pause_max_us) = 0;
+    MP_STATE_MEM(gc_stats_bytes_allocated) = 0;
+    memset(MP_STATE_MEM(gc_stats_allocs), 0, sizeof(MP_STATE_MEM(gc_stats_allocs)));
+    MP_STATE_MEM(gc_stats_largest_free_min) = SIZE_MAX;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
@@ -474,6 +557,83 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 #endif
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STACK_IN_FREE_HEAP || MICROPY_GC_STATS
+// Returns the length in blocks of the longest run of free blocks in the heap, and sets *start
+// to its first block. The heap must be locked.
+static size_t gc_longest_free_run(void **start) {
+    size_t best_free = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        size_t n_free = 0;
+        for (size_t block = 0; block <= end_block; block++) {
+            if (block < end_block && (block & (BLOCKS_PER_ATB - 1)) == 0) {
+                uintptr_t *word = gc_atb_word(area, block / BLOCKS_PER_ATB, area->gc_alloc_table_byte_len);
+                if (word != NULL && *word == 0) {
+                    n_free += BLOCKS_PER_ATB_WORD;
+                    block += BLOCKS_PER_ATB_WORD - 1;
+                    continue;
+                }
+            }
+            if (block < end_block && ATB_GET_KIND(area, block) == AT_FREE) {
+                n_free++;
+                continue;
+            }
+            if (n_free > best_free) {
+                best_free = n_free;
+                *start = (void *)PTR_FROM_BLOCK(area, block - n_free);
+            }
+            n_free = 0;
+        }
+    }
+    return best_free;
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STACK_IN_FREE_HEAP
+#if MICROPY_GC_SPLIT_HEAP
+#define GC_STACK_EXT_WORDS (2)
+#else
+#define GC_STACK_EXT_WORDS (1)
+#endif
+
+// Borrows the longest run of free blocks to continue the GC stack in. The blocks stay free:
+// marking never looks inside free blocks and allocations don't expect them to be clear.
+static void gc_stack_ext_find(void) {
+    MP_STATE_MEM(gc_stack_ext_found) = true;
+    void *start = NULL;
+    size_t n_free = gc_longest_free_run(&start);
+    MP_STATE_MEM(gc_stack_ext) = start;
+    MP_STATE_MEM(gc_stack_ext_len) = n_free * BYTES_PER_BLOCK / (GC_STACK_EXT_WORDS * sizeof(uintptr_t));
+}
+#endif
+
+// CIRCUITPY-CHANGE
+// Pushes onto the part of the GC stack past gc_block_stack. Returns false if there is none.
+static inline bool gc_stack_ext_push(size_t sp, mp_state_mem_area_t *area, size_t block) {
+    #if MICROPY_GC_STACK_IN_FREE_HEAP
+    if (!MP_STATE_MEM(gc_stack_ext_found)) {
+        gc_stack_ext_find();
+    }
+    size_t i = sp - MICROPY_ALLOC_GC_STACK_SIZE;
+    if (i >= MP_STATE_MEM(gc_stack_ext_len)) {
+        return false;
+    }
+    uintptr_t *entry = MP_STATE_MEM(gc_stack_ext) + i * GC_STACK_EXT_WORDS;
+    entry[0] = block;
+    #if MICROPY_GC_SPLIT_HEAP
+    entry[1] = (uintptr_t)area;
+    #endif
+    return true;
+    #else
+    (void)sp;
+    (void)area;
+    (void)block;
+    return false;
+    #endif
+}
+
 // Take the given block as the topmost block on the stack. Check all it's
 // children: mark the unmarked child blocks and put those newly marked
 // blocks on the stack. When all children have been checked, pop off the
@@ -544,6 +704,9 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
                     MP_STATE_MEM(gc_area_stack)[sp] = ptr_area;
                     #endif
                     sp += 1;
+                // CIRCUITPY-CHANGE
+                } else if (gc_stack_ext_push(sp, ptr_area, ptr_block)) {
+                    sp += 1;
                 } else {
                     MP_STATE_MEM(gc_stack_overflow) = 1;
                 }
@@ -557,6 +720,17 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 
         // pop the next block off the stack
         sp -= 1;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_STACK_IN_FREE_HEAP
+        if (sp >= MICROPY_ALLOC_GC_STACK_SIZE) {
+            uintptr_t *entry = MP_STATE_MEM(gc_stack_ext) + (sp - MICROPY_ALLOC_GC_STACK_SIZE) * GC_STACK_EXT_WORDS;
+            block = entry[0];
+            #if MICROPY_GC_SPLIT_HEAP
+            area = (mp_state_mem_area_t *)entry[1];
+            #endif
+            continue;
+        }
+        #endif
         block = MP_STATE_MEM(gc_block_stack)[sp];
         #if MICROPY_GC_SPLIT_HEAP
         area = MP_STATE_MEM(gc_area_stack)[sp];
@@ -585,10 +759,100 @@ static void gc_deal_with_stack_overflow(void) {
     }
 }
 
+#if MICROPY_ENABLE_FINALISER
+// CIRCUITPY-CHANGE: Shared by the full and incremental sweeps.
+static void gc_sweep_finalise(mp_state_mem_area_t *area, size_t block) {
+    if (FTB_GET(area, block)) {
+        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+        if (obj->type != NULL) {
+            // if the object has a type then see if it has a __del__ method
+            mp_obj_t dest[2];
+            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+            if (dest[0] != MP_OBJ_NULL) {
+                // load_method returned a method, execute it in a protected environment
+                #if MICROPY_ENABLE_SCHEDULER
+                mp_sched_lock();
+                #endif
+                mp_call_function_1_protected(dest[0], dest[1]);
+                #if MICROPY_ENABLE_SCHEDULER
+                mp_sched_unlock();
+                #endif
+            }
+        }
+        // clear finaliser flag
+        FTB_CLEAR(area, block);
+    }
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+// The sweep tells these about the blocks it keeps. The free run between one kept block and the
+// next is known there, so the largest free block is found without searching the heap again.
+static void gc_stats_sweep_start(void) {
+    MP_STATE_MEM(gc_stats_sweep_free_start) = 0;
+    MP_STATE_MEM(gc_stats_sweep_largest_free) = 0;
+}
+
+static inline void gc_stats_sweep_keep(size_t block, size_t n_blocks) {
+    size_t free_run = block - MP_STATE_MEM(gc_stats_sweep_free_start);
+    MP_STATE_MEM(gc_stats_sweep_largest_free) = MAX(MP_STATE_MEM(gc_stats_sweep_largest_free), free_run);
+    MP_STATE_MEM(gc_stats_sweep_free_start) = block + n_blocks;
+}
+
+// Blocks past the last used one are free up to the end of the area.
+static void gc_stats_sweep_area_end(mp_state_mem_area_t *area) {
+    gc_stats_sweep_keep(area->gc_alloc_table_byte_len * BLOCKS_PER_ATB, 0);
+    MP_STATE_MEM(gc_stats_sweep_free_start) = 0;
+}
+
+static void gc_stats_sweep_end(void) {
+    MP_STATE_MEM(gc_stats_largest_free_min) = MIN(MP_STATE_MEM(gc_stats_largest_free_min), MP_STATE_MEM(gc_stats_sweep_largest_free));
+}
+#define GC_STATS_SWEEP_KEEP(block, n_blocks) gc_stats_sweep_keep(block, n_blocks)
+#else
+#define GC_STATS_SWEEP_KEEP(block, n_blocks)
+#endif
+
+// CIRCUITPY-CHANGE
+// Sweeps the ATB word starting at block in one step if its blocks are all free or all tails,
+// which covers most of a heap of large buffers. Returns false if it must be swept block by block.
+static inline bool gc_sweep_word(mp_state_mem_area_t *area, size_t block, size_t end_block,
+    bool free_tail, size_t *last_used_block) {
+    if ((block & (BLOCKS_PER_ATB - 1)) != 0 || block + BLOCKS_PER_ATB_WORD > end_block) {
+        return false;
+    }
+    uintptr_t *word = gc_atb_word(area, block / BLOCKS_PER_ATB, area->gc_alloc_table_byte_len);
+    if (word == NULL) {
+        return false;
+    }
+    if (*word == 0) {
+        return true;
+    }
+    if (*word != ATB_WORD_ALL_TAIL) {
+        return false;
+    }
+    if (free_tail) {
+        *word = 0;
+        #if CLEAR_ON_SWEEP
+        memset((void *)PTR_FROM_BLOCK(area, block), 0, BLOCKS_PER_ATB_WORD * BYTES_PER_BLOCK);
+        #endif
+    } else {
+        *last_used_block = block + BLOCKS_PER_ATB_WORD - 1;
+        GC_STATS_SWEEP_KEEP(block, BLOCKS_PER_ATB_WORD);
+    }
+    return true;
+}
+
+// CIRCUITPY-CHANGE
+#if !MICROPY_GC_INCREMENTAL_SWEEP
 static void gc_sweep(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
+    #if MICROPY_GC_STATS
+    gc_stats_sweep_start();
+    #endif
     // free unmarked heads and their tails
     int free_tail = 0;
     #if MICROPY_GC_SPLIT_HEAP_AUTO
@@ -604,29 +868,15 @@ static void gc_sweep(void) {
 
         for (size_t block = 0; block < end_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
+            // CIRCUITPY-CHANGE
+            if (gc_sweep_word(area, block, end_block, free_tail, &last_used_block)) {
+                block += BLOCKS_PER_ATB_WORD - 1;
+                continue;
+            }
             switch (ATB_GET_KIND(area, block)) {
                 case AT_HEAD:
                     #if MICROPY_ENABLE_FINALISER
-                    if (FTB_GET(area, block)) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
-                        // clear finaliser flag
-                        FTB_CLEAR(area, block);
-                    }
+                    gc_sweep_finalise(area, block);
                     #endif
                     free_tail = 1;
                     DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
@@ -644,11 +894,13 @@ static void gc_sweep(void) {
                         #endif
                     } else {
                         last_used_block = block;
+                        GC_STATS_SWEEP_KEEP(block, 1);
                     }
                     break;
 
                 case AT_MARK:
                     ATB_MARK_TO_HEAD(area, block);
+                    GC_STATS_SWEEP_KEEP(block, 1);
                     free_tail = 0;
                     last_used_block = block;
                     break;
@@ -656,6 +908,9 @@ static void gc_sweep(void) {
         }
 
         area->gc_last_used_block = last_used_block;
+        #if MICROPY_GC_STATS
+        gc_stats_sweep_area_end(area);
+        #endif
 
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
@@ -664,19 +919,391 @@ static void gc_sweep(void) {
             NEXT_AREA(prev_area) = NEXT_AREA(area);
             MP_PLAT_FREE_HEAP(area);
             area = prev_area;
+            #if MICROPY_GC_SMALL_POOLS
+            gc_small_pools_reset();
+            #endif
         }
         prev_area = area;
         #endif
     }
+    #if MICROPY_GC_STATS
+    gc_stats_sweep_end();
+    #endif
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// While a sweep is pending, blocks it hasn't reached yet keep the state marking left them in:
+// MARK heads are live and HEAD heads are garbage that hasn't been freed yet. Everything the
+// sweep has passed is back to HEAD, TAIL and FREE.
+
+// Number of blocks swept between checks of the time budget.
+#define GC_SWEEP_CHECK_BLOCKS (256)
+
+static void gc_sweep_start(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
+    MP_STATE_MEM(gc_collected) = 0;
+    #endif
+    MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
+    #if MICROPY_GC_SPLIT_HEAP_AUTO
+    MP_STATE_MEM(gc_sweep_prev_area) = NULL;
+    #endif
+    MP_STATE_MEM(gc_sweep_block) = 0;
+    MP_STATE_MEM(gc_sweep_last_used_block) = 0;
+    MP_STATE_MEM(gc_sweep_free_tail) = false;
+    #if MICROPY_GC_STATS
+    gc_stats_sweep_start();
+    #endif
+}
+
+// Sweeps from where the pending sweep left off. Stops once budget_us microseconds have passed,
+// unless it is 0. Returns true when the whole heap has been swept.
+static bool gc_sweep_continue(mp_uint_t budget_us) {
+    mp_uint_t start_us = budget_us != 0 ? mp_hal_ticks_us() : 0;
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_sweep_area);
+    size_t block = MP_STATE_MEM(gc_sweep_block);
+    size_t last_used_block = MP_STATE_MEM(gc_sweep_last_used_block);
+    bool free_tail = MP_STATE_MEM(gc_sweep_free_tail);
+    size_t swept = 0;
+    while (area != NULL) {
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        if (area->gc_last_used_block < end_block) {
+            end_block = area->gc_last_used_block + 1;
+        }
+
+        for (; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (budget_us != 0 && ++swept % GC_SWEEP_CHECK_BLOCKS == 0 &&
+                mp_hal_ticks_us() - start_us >= budget_us) {
+                MP_STATE_MEM(gc_sweep_area) = area;
+                MP_STATE_MEM(gc_sweep_block) = block;
+                MP_STATE_MEM(gc_sweep_last_used_block) = last_used_block;
+                MP_STATE_MEM(gc_sweep_free_tail) = free_tail;
+                return false;
+            }
+            if (gc_sweep_word(area, block, end_block, free_tail, &last_used_block)) {
+                block += BLOCKS_PER_ATB_WORD - 1;
+                continue;
+            }
+            switch (ATB_GET_KIND(area, block)) {
+                case AT_HEAD:
+                    #if MICROPY_ENABLE_FINALISER
+                    gc_sweep_finalise(area, block);
+                    #endif
+                    free_tail = true;
+                    DEBUG_printf("gc_sweep(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
+                    #if MICROPY_PY_GC_COLLECT_RETVAL
+                    MP_STATE_MEM(gc_collected)++;
+                    #endif
+                    // Allocations may have moved these past the block since the collection.
+                    #if MICROPY_GC_SPLIT_HEAP
+                    if (MP_STATE_MEM(gc_last_free_area) != area) {
+                        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+                    }
+                    #endif
+                    if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+                        area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
+                    }
+                    area->gc_max_free_run = SIZE_MAX;
+                    #if MICROPY_GC_SMALL_POOLS
+                    // A pool may have run out since the collection ended, and freeing this chain
+                    // can leave a hole its size.
+                    gc_small_pools_retry();
+                    #endif
+                    // fall through to free the head
+                    MP_FALLTHROUGH
+
+                case AT_TAIL:
+                    if (free_tail) {
+                        ATB_ANY_TO_FREE(area, block);
+                        #if CLEAR_ON_SWEEP
+                        memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
+                        #endif
+                    } else {
+                        last_used_block = block;
+                        GC_STATS_SWEEP_KEEP(block, 1);
+                    }
+                    break;
+
+                case AT_MARK:
+                    ATB_MARK_TO_HEAD(area, block);
+                    GC_STATS_SWEEP_KEEP(block, 1);
+                    free_tail = false;
+                    last_used_block = block;
+                    break;
+            }
+        }
+
+        area->gc_last_used_block = last_used_block;
+        #if MICROPY_GC_STATS
+        gc_stats_sweep_area_end(area);
+        #endif
+
+        #if MICROPY_GC_SPLIT_HEAP_AUTO
+        // Free any empty area, aside from the first one
+        mp_state_mem_area_t *prev_area = MP_STATE_MEM(gc_sweep_prev_area);
+        if (last_used_block == 0 && prev_area != NULL) {
+            DEBUG_printf("gc_sweep free empty area %p\n", area);
+            NEXT_AREA(prev_area) = NEXT_AREA(area);
+            MP_PLAT_FREE_HEAP(area);
+            area = prev_area;
+            #if MICROPY_GC_SMALL_POOLS
+            gc_small_pools_reset();
+            #endif
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        }
+        MP_STATE_MEM(gc_sweep_prev_area) = area;
+        #endif
+
+        area = NEXT_AREA(area);
+        block = 0;
+        last_used_block = 0;
+    }
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    #if MICROPY_GC_STATS
+    gc_stats_sweep_end();
+    #endif
+    return true;
+}
+
+// Runs the pending sweep for up to budget_us microseconds, or to the end if it is 0. Does
+// nothing if no sweep is pending or this is called from a finaliser the sweep is running.
+static void gc_sweep_resume(mp_uint_t budget_us) {
+    if (MP_STATE_MEM(gc_sweep_area) == NULL || MP_STATE_MEM(gc_sweep_running)) {
+        return;
+    }
+    GC_ENTER();
+    MP_STATE_THREAD(gc_lock_depth)++;
+    MP_STATE_MEM(gc_sweep_running) = true;
+    gc_sweep_continue(budget_us);
+    MP_STATE_MEM(gc_sweep_running) = false;
+    MP_STATE_THREAD(gc_lock_depth)--;
+    GC_EXIT();
+}
+
+// True if the pending sweep has yet to reach this block.
+static bool gc_sweep_is_ahead(mp_state_mem_area_t *area, size_t block) {
+    mp_state_mem_area_t *sweep_area = MP_STATE_MEM(gc_sweep_area);
+    if (sweep_area == NULL) {
+        return false;
+    }
+    if (area == sweep_area) {
+        return block >= MP_STATE_MEM(gc_sweep_block);
+    }
+    for (mp_state_mem_area_t *a = NEXT_AREA(sweep_area); a != NULL; a = NEXT_AREA(a)) {
+        if (a == area) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Keeps the pending sweep from freeing blocks that were just allocated, from head_block to
+// end_block inclusive.
+static void gc_sweep_protect(mp_state_mem_area_t *area, size_t head_block, size_t end_block) {
+    if (gc_sweep_is_ahead(area, head_block)) {
+        // Live as far as the sweep is concerned.
+        ATB_HEAD_TO_MARK(area, head_block);
+    } else if (area == MP_STATE_MEM(gc_sweep_area)) {
+        MP_STATE_MEM(gc_sweep_last_used_block) = MAX(MP_STATE_MEM(gc_sweep_last_used_block), end_block);
+        if (end_block >= MP_STATE_MEM(gc_sweep_block)) {
+            // The tail runs past the sweep, which must keep it rather than follow the last
+            // garbage head it saw.
+            MP_STATE_MEM(gc_sweep_free_tail) = false;
+        }
+    }
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Returns the area ptr is in, whether or not it is the start of a block.
+static mp_state_mem_area_t *gc_area_containing(const void *ptr) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        if (ptr >= (void *)area->gc_pool_start && ptr < (void *)area->gc_pool_end) {
+            return area;
+        }
+    }
+    return NULL;
+}
+
+static void gc_movable_remove_index(size_t i) {
+    size_t last = --MP_STATE_MEM(gc_movable_len);
+    MP_STATE_MEM(gc_movable_slot)[i] = MP_STATE_MEM(gc_movable_slot)[last];
+    MP_STATE_MEM(gc_movable_owner)[i] = MP_STATE_MEM(gc_movable_owner)[last];
+}
+
+void gc_movable_add(void **slot) {
+    gc_movable_remove(slot);
+    GC_ENTER();
+    if (MP_STATE_MEM(gc_movable_len) < MICROPY_GC_MOVABLE_MAX) {
+        // The slot is in the object whose chain of blocks it falls in.
+        void *owner = NULL;
+        mp_state_mem_area_t *area = gc_area_containing(slot);
+        if (area != NULL) {
+            size_t block = BLOCK_FROM_PTR(area, slot);
+            while (ATB_GET_KIND(area, block) == AT_TAIL) {
+                block--;
+            }
+            owner = (void *)PTR_FROM_BLOCK(area, block);
+        }
+        size_t i = MP_STATE_MEM(gc_movable_len)++;
+        MP_STATE_MEM(gc_movable_slot)[i] = slot;
+        MP_STATE_MEM(gc_movable_owner)[i] = owner;
+    }
+    // Otherwise the buffer just stays put.
+    GC_EXIT();
+}
+
+void gc_movable_remove(void **slot) {
+    GC_ENTER();
+    for (size_t i = 0; i < MP_STATE_MEM(gc_movable_len); i++) {
+        if (MP_STATE_MEM(gc_movable_slot)[i] == slot) {
+            gc_movable_remove_index(i);
+            break;
+        }
+    }
+    GC_EXIT();
+}
+
+// Forgets the slots in objects that marking found unreachable. Called before the sweep.
+static void gc_movable_drop_unmarked(void) {
+    for (size_t i = 0; i < MP_STATE_MEM(gc_movable_len);) {
+        void *owner = MP_STATE_MEM(gc_movable_owner)[i];
+        if (owner != NULL) {
+            mp_state_mem_area_t *area = gc_area_containing(owner);
+            if (area == NULL || ATB_GET_KIND(area, BLOCK_FROM_PTR(area, owner)) != AT_MARK) {
+                gc_movable_remove_index(i);
+                continue;
+            }
+        }
+        i++;
+    }
+}
+
+// Returns the first block of the lowest run of n_blocks free blocks that ends before
+// before_block, or before_block if there is none.
+static size_t gc_compact_find(mp_state_mem_area_t *area, size_t n_blocks, size_t before_block) {
+    size_t n_free = 0;
+    for (size_t block = area->gc_last_free_atb_index * BLOCKS_PER_ATB; block < before_block; block++) {
+        if (ATB_GET_KIND(area, block) != AT_FREE) {
+            n_free = 0;
+        } else if (++n_free == n_blocks) {
+            return block + 1 - n_blocks;
+        }
+    }
+    return before_block;
+}
+
+size_t gc_compact(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return 0;
+    }
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_resume(0);
+    #endif
+    GC_ENTER();
+    void ***slots = MP_STATE_MEM(gc_movable_slot);
+    size_t len = MP_STATE_MEM(gc_movable_len);
+
+    // Lowest buffers first, so each one freed makes room for those above it.
+    for (size_t i = 1; i < len; i++) {
+        for (size_t j = i; j > 0 && *slots[j] < *slots[j - 1]; j--) {
+            void **slot = slots[j];
+            slots[j] = slots[j - 1];
+            slots[j - 1] = slot;
+            void *owner = MP_STATE_MEM(gc_movable_owner)[j];
+            MP_STATE_MEM(gc_movable_owner)[j] = MP_STATE_MEM(gc_movable_owner)[j - 1];
+            MP_STATE_MEM(gc_movable_owner)[j - 1] = owner;
+        }
+    }
+
+    size_t moved = 0;
+    for (size_t i = 0; i < len; i++) {
+        void *ptr = *slots[i];
+        mp_state_mem_area_t *area = gc_area_containing(ptr);
+        if (area == NULL) {
+            continue;
+        }
+        size_t block = BLOCK_FROM_PTR(area, ptr);
+        if ((void *)PTR_FROM_BLOCK(area, block) != ptr || ATB_GET_KIND(area, block) != AT_HEAD) {
+            continue;
+        }
+        size_t n_blocks = 1;
+        while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+            n_blocks++;
+        }
+        size_t new_block = gc_compact_find(area, n_blocks, block);
+        if (new_block == block) {
+            continue;
+        }
+
+        ATB_FREE_TO_HEAD(area, new_block);
+        for (size_t bl = new_block + 1; bl < new_block + n_blocks; bl++) {
+            ATB_FREE_TO_TAIL(area, bl);
+        }
+        #if MICROPY_ENABLE_SELECTIVE_COLLECT
+        if (CTB_GET(area, block)) {
+            CTB_SET(area, new_block);
+        } else {
+            CTB_CLEAR(area, new_block);
+        }
+        #endif
+
+        // Interrupt handlers may use the buffer, so they must see it in one place or the other.
+        void *new_ptr = (void *)PTR_FROM_BLOCK(area, new_block);
+        mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
+        memcpy(new_ptr, ptr, n_blocks * BYTES_PER_BLOCK);
+        *slots[i] = new_ptr;
+        MICROPY_END_ATOMIC_SECTION(atomic_state);
+
+        #if MICROPY_ENABLE_FINALISER
+        FTB_CLEAR(area, block);
+        #endif
+        for (size_t bl = block; bl < block + n_blocks; bl++) {
+            ATB_ANY_TO_FREE(area, bl);
+        }
+        moved += n_blocks * BYTES_PER_BLOCK;
+    }
+
+    if (moved > 0) {
+        #if MICROPY_GC_SPLIT_HEAP
+        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        #endif
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            area->gc_last_free_atb_index = 0;
+            area->gc_max_free_run = SIZE_MAX;
+        }
+        #if MICROPY_GC_SMALL_POOLS
+        gc_small_pools_reset();
+        #endif
+    }
+    GC_EXIT();
+    return moved;
 }
+#endif
 
 void gc_collect_start(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_pause_start_us) = mp_hal_ticks_us();
+    #endif
+    // CIRCUITPY-CHANGE: Marks left by the last collection must be swept before marking again.
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_resume(0);
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    // CIRCUITPY-CHANGE: Free blocks move between collections, so look for them again.
+    #if MICROPY_GC_STACK_IN_FREE_HEAP
+    MP_STATE_MEM(gc_stack_ext_found) = false;
+    MP_STATE_MEM(gc_stack_ext_len) = 0;
+    #endif
 
     // Trace root pointers.  This relies on the root pointers being organised
     // correctly in the mp_state_ctx structure.  We scan nlr_top, dict_locals,
@@ -745,27 +1372,116 @@ void gc_collect_root(void **ptrs, size_t len) {
     }
 }
 
-void gc_collect_end(void) {
+// CIRCUITPY-CHANGE
+static void gc_collect_finish(mp_uint_t sweep_budget_us) {
     gc_deal_with_stack_overflow();
+    #if MICROPY_GC_MOVABLE
+    gc_movable_drop_unmarked();
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_start();
+    MP_STATE_MEM(gc_sweep_running) = true;
+    gc_sweep_continue(sweep_budget_us);
+    MP_STATE_MEM(gc_sweep_running) = false;
+    #else
+    (void)sweep_budget_us;
     gc_sweep();
+    #endif
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         area->gc_last_free_atb_index = 0;
+        area->gc_max_free_run = SIZE_MAX;
     }
+    #if MICROPY_GC_SMALL_POOLS
+    gc_small_pools_reset();
+    #endif
     MP_STATE_THREAD(gc_lock_depth)--;
     GC_EXIT();
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+static void gc_stats_collected(void) {
+    GC_ENTER();
+    mp_uint_t pause_us = mp_hal_ticks_us() - MP_STATE_MEM(gc_stats_pause_start_us);
+    MP_STATE_MEM(gc_stats_collections)++;
+    MP_STATE_MEM(gc_stats_pause_total_us) += pause_us;
+    MP_STATE_MEM(gc_stats_pause_max_us) = MAX(MP_STATE_MEM(gc_stats_pause_max_us), pause_us);
+    GC_EXIT();
+}
+
+void gc_stats(gc_stats_t *stats) {
+    GC_ENTER();
+    stats->collections = MP_STATE_MEM(gc_stats_collections);
+    stats->pause_total_us = MP_STATE_MEM(gc_stats_pause_total_us);
+    stats->pause_max_us = MP_STATE_MEM(gc_stats_pause_max_us);
+    stats->bytes_allocated = MP_STATE_MEM(gc_stats_bytes_allocated);
+    memcpy(stats->allocs, MP_STATE_MEM(gc_stats_allocs), sizeof(stats->allocs));
+    // The heap is only searched here, so collections don't pay for it.
+    void *start;
+    size_t largest_free = gc_longest_free_run(&start);
+    stats->largest_free = largest_free * BYTES_PER_BLOCK;
+    // Until a sweep has finished, the largest free run has only been seen now.
+    stats->largest_free_min = MIN(MP_STATE_MEM(gc_stats_largest_free_min), largest_free) * BYTES_PER_BLOCK;
+    GC_EXIT();
+}
+
+size_t gc_alloc_count(void) {
+    size_t count = 0;
+    for (size_t i = 0; i < MICROPY_GC_STATS_SIZE_CLASSES; i++) {
+        count += MP_STATE_MEM(gc_stats_allocs)[i];
+    }
+    return count;
+}
+#endif
+
+void gc_collect_end(void) {
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_collect_finish(MP_STATE_MEM(gc_sweep_budget_us));
+    #else
+    gc_collect_finish(0);
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    gc_stats_collected();
+    #endif
+}
+
 void gc_sweep_all(void) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_resume(0);
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
     MP_STATE_MEM(gc_stack_overflow) = 0;
-    gc_collect_end();
+    gc_collect_finish(0);
+    // CIRCUITPY-CHANGE: Every buffer is gone, even those whose slots aren't on the heap.
+    #if MICROPY_GC_MOVABLE
+    MP_STATE_MEM(gc_movable_len) = 0;
+    #endif
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+void gc_set_sweep_budget(mp_uint_t budget_us) {
+    MP_STATE_MEM(gc_sweep_budget_us) = budget_us;
+}
+
+mp_uint_t gc_get_sweep_budget(void) {
+    return MP_STATE_MEM(gc_sweep_budget_us);
+}
+#endif
+
 void gc_info(gc_info_t *info) {
+    // CIRCUITPY-CHANGE: Count garbage the pending sweep hasn't reached as free.
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (!gc_is_locked()) {
+        gc_sweep_resume(0);
+    }
+    #endif
     GC_ENTER();
     info->total = 0;
     info->used = 0;
@@ -787,7 +1503,9 @@ void gc_info(gc_info_t *info) {
                     len = 0;
                     break;
 
+                // CIRCUITPY-CHANGE: Heads ahead of a pending sweep may still be marked.
                 case AT_HEAD:
+                case AT_MARK:
                     info->used += 1;
                     len = 1;
                     break;
@@ -796,10 +1514,6 @@ void gc_info(gc_info_t *info) {
                     info->used += 1;
                     len += 1;
                     break;
-
-                case AT_MARK:
-                    // shouldn't happen
-                    break;
             }
 
             block++;
@@ -809,7 +1523,7 @@ void gc_info(gc_info_t *info) {
                 kind = ATB_GET_KIND(area, block);
             }
 
-            if (finish || kind == AT_FREE || kind == AT_HEAD) {
+            if (finish || kind == AT_FREE || kind == AT_HEAD || kind == AT_MARK) {
                 if (len == 1) {
                     info->num_1block += 1;
                 } else if (len == 2) {
@@ -818,7 +1532,7 @@ void gc_info(gc_info_t *info) {
                 if (len > info->max_block) {
                     info->max_block = len;
                 }
-                if (finish || kind == AT_HEAD) {
+                if (finish || kind == AT_HEAD || kind == AT_MARK) {
                     if (len_free > info->max_free) {
                         info->max_free = len_free;
                     }
@@ -838,6 +1552,78 @@ void gc_info(gc_info_t *info) {
     GC_EXIT();
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_SMALL_POOLS
+// Fills the pool with holes of exactly n_blocks from the first area that has any, lowest first.
+// Returns false if there are none.
+static bool gc_small_pool_refill(mp_state_mem_small_pool_t *pool, size_t n_blocks) {
+    pool->len = 0;
+    pool->next = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        if (n_blocks > area->gc_max_free_run) {
+            continue;
+        }
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        size_t n_free = 0;
+        for (size_t block = area->gc_last_free_atb_index * BLOCKS_PER_ATB; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            bool is_free;
+            size_t step = 1;
+            uintptr_t *word = NULL;
+            if ((block & (BLOCKS_PER_ATB - 1)) == 0) {
+                word = gc_atb_word(area, block / BLOCKS_PER_ATB, area->gc_alloc_table_byte_len);
+            }
+            if (word != NULL && (*word == 0 || ATB_WORD_NONE_FREE(*word))) {
+                is_free = *word == 0;
+                step = BLOCKS_PER_ATB_WORD;
+            } else {
+                is_free = ATB_GET_KIND(area, block) == AT_FREE;
+            }
+            block += step - 1;
+            if (is_free) {
+                n_free += step;
+                continue;
+            }
+            if (n_free == n_blocks) {
+                pool->blocks[pool->len++] = block - step + 1 - n_free;
+                if (pool->len == MICROPY_GC_SMALL_POOL_LEN) {
+                    break;
+                }
+            }
+            n_free = 0;
+        }
+        if (n_free == n_blocks && pool->len < MICROPY_GC_SMALL_POOL_LEN) {
+            pool->blocks[pool->len++] = end_block - n_free;
+        }
+        if (pool->len > 0) {
+            pool->area = area;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Takes a hole for an allocation of 1 or 2 blocks from its pool. Returns NULL, so the heap is
+// searched as usual, if there are no holes that size.
+static mp_state_mem_area_t *gc_small_pool_take(size_t n_blocks, size_t *block) {
+    mp_state_mem_small_pool_t *pool = &MP_STATE_MEM(gc_small_pool)[n_blocks - 1];
+    for (;;) {
+        while (pool->next < pool->len) {
+            size_t b = pool->blocks[pool->next++];
+            if (ATB_GET_KIND(pool->area, b) == AT_FREE &&
+                (n_blocks == 1 || ATB_GET_KIND(pool->area, b + 1) == AT_FREE)) {
+                *block = b;
+                return pool->area;
+            }
+        }
+        if (pool->exhausted || !gc_small_pool_refill(pool, n_blocks)) {
+            pool->exhausted = true;
+            return NULL;
+        }
+    }
+}
+#endif
+
 // CIRCUITPY-CHANGE: C code may be used when the VM heap isn't active. This
 // allows that code to test if it is. It can use the outer pool if needed.
 bool gc_alloc_possible(void) {
@@ -870,6 +1656,17 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
+    // CIRCUITPY-CHANGE
+    bool pooled = false;
+
+    // CIRCUITPY-CHANGE: Pay for a slice of the pending sweep.
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (MP_STATE_MEM(gc_sweep_area) != NULL) {
+        GC_EXIT();
+        gc_sweep_resume(MP_STATE_MEM(gc_sweep_budget_us));
+        GC_ENTER();
+    }
+    #endif
 
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
@@ -880,6 +1677,19 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_SMALL_POOLS
+    if (n_blocks <= 2) {
+        area = gc_small_pool_take(n_blocks, &start_block);
+        if (area != NULL) {
+            i = start_block + n_blocks - 1;
+            n_free = n_blocks;
+            pooled = true;
+            goto found;
+        }
+    }
+    #endif
+
     for (;;) {
 
         #if MICROPY_GC_SPLIT_HEAP
@@ -895,9 +1705,32 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            // CIRCUITPY-CHANGE: Skip areas known to have no hole large enough.
+            if (n_blocks > area->gc_max_free_run) {
+                continue;
+            }
             n_free = 0;
             for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
+                // CIRCUITPY-CHANGE: Take a whole ATB word at once when it is all free or all used.
+                uintptr_t *word = gc_atb_word(area, i, area->gc_alloc_table_byte_len);
+                if (word != NULL) {
+                    if (*word == 0) {
+                        if (n_free + BLOCKS_PER_ATB_WORD >= n_blocks) {
+                            i = i * BLOCKS_PER_ATB + (n_blocks - n_free) - 1;
+                            n_free = n_blocks;
+                            goto found;
+                        }
+                        n_free += BLOCKS_PER_ATB_WORD;
+                        i += sizeof(uintptr_t) - 1;
+                        continue;
+                    }
+                    if (ATB_WORD_NONE_FREE(*word)) {
+                        n_free = 0;
+                        i += sizeof(uintptr_t) - 1;
+                        continue;
+                    }
+                }
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
                 if (ATB_0_IS_FREE(a)) { if (++n_free >= n_blocks) { i = i * BLOCKS_PER_ATB + 0; goto found; } } else { n_free = 0; }
@@ -907,6 +1740,9 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
                 // *FORMAT-ON*
             }
 
+            // CIRCUITPY-CHANGE: Remember the failure until blocks are freed.
+            area->gc_max_free_run = n_blocks - 1;
+
             // No free blocks found on this heap. Mark this heap as
             // filled, so we won't try to find free space here again until
             // space is freed.
@@ -918,6 +1754,15 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         }
 
         GC_EXIT();
+        // CIRCUITPY-CHANGE: Free the rest of the garbage from the last collection before
+        // starting another.
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (MP_STATE_MEM(gc_sweep_area) != NULL && !MP_STATE_MEM(gc_sweep_running)) {
+            gc_sweep_resume(0);
+            GC_ENTER();
+            continue;
+        }
+        #endif
         // nothing found!
         if (collected) {
             #if MICROPY_GC_SPLIT_HEAP_AUTO
@@ -950,7 +1795,8 @@ found:
     // for a single free block, which guarantees that there are no free blocks
     // before this one.  Also, whenever we free or shink a block we must check
     // if this index needs adjusting (see gc_realloc and gc_free).
-    if (n_free == 1) {
+    // CIRCUITPY-CHANGE: Pooled holes may have free blocks before them.
+    if (n_free == 1 && !pooled) {
         #if MICROPY_GC_SPLIT_HEAP
         MP_STATE_MEM(gc_last_free_area) = area;
         #endif
@@ -973,6 +1819,11 @@ found:
         ATB_FREE_TO_TAIL(area, bl);
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_protect(area, start_block, end_block);
+    #endif
+
     // get pointer to first block
     // we must create this pointer before unlocking the GC so a collection can find it
     void *ret_ptr = (void *)(area->gc_pool_start + start_block * BYTES_PER_BLOCK);
@@ -982,6 +1833,16 @@ found:
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_bytes_allocated) += n_blocks * BYTES_PER_BLOCK;
+    size_t size_class = 0;
+    for (size_t n = n_blocks - 1; n != 0 && size_class < MICROPY_GC_STATS_SIZE_CLASSES - 1; n >>= 1) {
+        size_class++;
+    }
+    MP_STATE_MEM(gc_stats_allocs)[size_class]++;
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -1071,7 +1932,8 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE: Heads ahead of a pending sweep may still be marked.
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || ATB_GET_KIND(area, block) == AT_MARK);
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1103,10 +1965,13 @@ void gc_free(void *ptr) {
     #endif
 
     // free head and all of its tail blocks
+    // CIRCUITPY-CHANGE: counting them
+    size_t head_block = block;
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
+    gc_note_free(area, block - head_block);
 
     GC_EXIT();
 
@@ -1131,7 +1996,8 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        // CIRCUITPY-CHANGE: Heads ahead of a pending sweep may still be marked.
+        if (ATB_GET_KIND(area, block) == AT_HEAD || ATB_GET_KIND(area, block) == AT_MARK) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1178,7 +2044,8 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    // CIRCUITPY-CHANGE: Heads ahead of a pending sweep may still be marked.
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || ATB_GET_KIND(area, block) == AT_MARK);
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1233,6 +2100,8 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         if ((block + new_blocks) / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
             area->gc_last_free_atb_index = (block + new_blocks) / BLOCKS_PER_ATB;
         }
+        // CIRCUITPY-CHANGE
+        gc_note_free(area, n_blocks - new_blocks);
 
         GC_EXIT();
 
@@ -1263,6 +2132,11 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        gc_sweep_protect(area, block, end_block - 1);
+        #endif
+
         GC_EXIT();
 
         #if MICROPY_GC_CONSERVATIVE_CLEAR
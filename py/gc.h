@@ -71,6 +71,27 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// After marking, a collection sweeps for at most this long and leaves the rest for allocations
+// to sweep a slice at a time. 0 sweeps the whole heap in the collection.
+void gc_set_sweep_budget(mp_uint_t budget_us);
+mp_uint_t gc_get_sweep_budget(void);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// Lets gc_compact() move the heap buffer *slot points to, updating *slot. Until removed,
+// nothing else may hold a pointer to the buffer across a call back into Python. The
+// registration ends by itself when the object holding the slot is collected.
+void gc_movable_add(void **slot);
+// Stops gc_compact() moving the buffer, such as when a pointer to it is handed out.
+void gc_movable_remove(void **slot);
+// Moves movable buffers down into the lowest free holes that fit them, so free memory
+// joins up above them. Only call from the VM, after gc_collect(). Returns the bytes moved.
+size_t gc_compact(void);
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
     // CIRCUITPY-CHANGE
@@ -103,6 +124,24 @@ typedef struct _gc_info_t {
 } gc_info_t;
 
 void gc_info(gc_info_t *info);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+// Counts since gc_init(). Sizes are in bytes and times in microseconds.
+typedef struct _gc_stats_t {
+    size_t collections;
+    uint64_t pause_total_us;
+    mp_uint_t pause_max_us;
+    uint64_t bytes_allocated;
+    size_t allocs[MICROPY_GC_STATS_SIZE_CLASSES];
+    size_t largest_free;
+    size_t largest_free_min;
+} gc_stats_t;
+
+void gc_stats(gc_stats_t *stats);
+// The total number of allocations, which doesn't need a heap allocation to read.
+size_t gc_alloc_count(void);
+#endif
 void gc_dump_info(const mp_print_t *print);
 void gc_dump_alloc_table(const mp_print_t *print);
 
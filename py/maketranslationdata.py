@@ -395,6 +395,24 @@ def compute_huffman_coding(qstrs, translation_name, translations, f, compression
             ", ".join(str(ord(remove_offset(u))) for u in values)
         )
     )
+    # Decodes the next 8 bits of the bitstream in one step. Entries are the index into values
+    # shifted left by 4 plus the code length, or 0 when the code is longer than 8 bits.
+    huffman_lookup = [0] * 256
+    code = 0
+    index = 0
+    for bit_length, count in enumerate(lengths, 1):
+        for _ in range(count):
+            if bit_length <= 8:
+                shift = 8 - bit_length
+                for suffix in range(1 << shift):
+                    huffman_lookup[(code << shift) | suffix] = (index << 4) | bit_length
+            code += 1
+            index += 1
+        code <<= 1
+    assert index < 4096
+    f.write(
+        "const uint16_t huffman_lookup[] = {{ {} }};\n".format(", ".join(map(str, huffman_lookup)))
+    )
     f.write(
         "#define compress_max_length_bits ({})\n".format(
             max_translation_encoded_length.bit_length()
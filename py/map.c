@@ -89,6 +89,85 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 // CIRCUITPY-CHANGE: Helper for allocating tables of elements
 #define malloc_table(num) m_new0(mp_map_elem_t, num)
 
+#if MICROPY_MAP_COMPACT
+// A hash map (one that isn't ordered) keeps its entries densely in insertion
+// order at the start of its table. The entries are followed by the number of
+// entries appended so far and then by the hash index. Each index slot holds
+// an entry's position plus one, or zero when the slot is empty.
+//
+// Removing an entry only marks its key as MP_OBJ_SENTINEL. Its index slot
+// keeps pointing at it and lookups skip over it until the table is rebuilt,
+// which packs the live entries together again. So each appended entry takes
+// up exactly one index slot, and with more index slots than entries every
+// probe ends at an empty slot.
+
+static size_t compact_index_len(size_t alloc) {
+    return alloc + alloc / 4 + 1;
+}
+
+static size_t compact_index_width(size_t alloc) {
+    if (alloc <= UINT8_MAX) {
+        return 1;
+    } else if (alloc <= UINT16_MAX) {
+        return 2;
+    }
+    return 4;
+}
+
+static size_t compact_table_len(size_t alloc) {
+    if (alloc == 0) {
+        return 0;
+    }
+    size_t index_bytes = sizeof(size_t) + compact_index_len(alloc) * compact_index_width(alloc);
+    return alloc + (index_bytes + sizeof(mp_map_elem_t) - 1) / sizeof(mp_map_elem_t);
+}
+
+static inline size_t *compact_fill(const mp_map_t *map) {
+    return (size_t *)&map->table[map->alloc];
+}
+
+static inline size_t compact_index_get(const mp_map_t *map, size_t width, size_t pos) {
+    const void *index = compact_fill(map) + 1;
+    if (width == 1) {
+        return ((const uint8_t *)index)[pos];
+    } else if (width == 2) {
+        return ((const uint16_t *)index)[pos];
+    }
+    return ((const uint32_t *)index)[pos];
+}
+
+static inline void compact_index_set(mp_map_t *map, size_t width, size_t pos, size_t entry) {
+    void *index = compact_fill(map) + 1;
+    if (width == 1) {
+        ((uint8_t *)index)[pos] = entry;
+    } else if (width == 2) {
+        ((uint16_t *)index)[pos] = entry;
+    } else {
+        ((uint32_t *)index)[pos] = entry;
+    }
+}
+#endif
+
+static mp_uint_t map_hash(mp_obj_t index) {
+    // get hash of index, with fast path for common case of qstr
+    if (mp_obj_is_qstr(index)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(index));
+    }
+    return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
+}
+
+// CIRCUITPY-CHANGE: the number of elements allocated for the map's table
+size_t mp_map_table_len(const mp_map_t *map) {
+    #if MICROPY_MAP_COMPACT
+    // Every table allocated here has room for an index, even an ordered
+    // one, but a fixed ordered map may point at a table of just its entries.
+    if (!map->is_fixed || !map->is_ordered) {
+        return compact_table_len(map->alloc);
+    }
+    #endif
+    return map->alloc;
+}
+
 void mp_map_init(mp_map_t *map, size_t n) {
     if (n == 0) {
         map->alloc = 0;
@@ -96,7 +175,12 @@ void mp_map_init(mp_map_t *map, size_t n) {
     } else {
         map->alloc = n;
         // CIRCUITPY-CHANGE
+        #if MICROPY_MAP_COMPACT
+        // Callers may still make this map ordered, which only uses the entries.
+        map->table = malloc_table(compact_table_len(map->alloc));
+        #else
         map->table = malloc_table(map->alloc);
+        #endif
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
@@ -116,14 +200,14 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(mp_map_elem_t, map->table, mp_map_table_len(map));
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(mp_map_elem_t, map->table, mp_map_table_len(map));
     }
     map->alloc = 0;
     map->used = 0;
@@ -132,6 +216,125 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
+#if MICROPY_MAP_COMPACT
+// Indexes the first n entries of a compact map, whose index must be empty.
+static void compact_index_build(mp_map_t *map, size_t n) {
+    size_t index_len = compact_index_len(map->alloc);
+    size_t width = compact_index_width(map->alloc);
+    for (size_t i = 0; i < n; i++) {
+        // The keys are all different so the first empty slot is the one.
+        size_t pos = map_hash(map->table[i].key) % index_len;
+        while (compact_index_get(map, width, pos) != 0) {
+            pos = (pos + 1) % index_len;
+        }
+        compact_index_set(map, width, pos, i + 1);
+    }
+}
+
+// Moves the live entries of a compact map down over the removed ones and
+// reindexes them, without allocating, so a map that entries are added to and
+// removed from can keep reusing its table even when the heap is locked.
+static void compact_pack(mp_map_t *map) {
+    size_t fill = *compact_fill(map);
+    size_t used = 0;
+    map->all_keys_are_qstrs = 1;
+    for (size_t i = 0; i < fill; i++) {
+        if (map->table[i].key != MP_OBJ_NULL && map->table[i].key != MP_OBJ_SENTINEL) {
+            if (!mp_obj_is_qstr(map->table[i].key)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            map->table[used++] = map->table[i];
+        }
+    }
+    mp_seq_clear(map->table, used, fill, sizeof(*map->table));
+    *compact_fill(map) = used;
+    memset(compact_fill(map) + 1, 0, compact_index_len(map->alloc) * compact_index_width(map->alloc));
+    compact_index_build(map, used);
+}
+
+// Packs the live entries of a compact map into a new table sized for them and
+// one more, and indexes them.
+static void mp_map_rehash(mp_map_t *map) {
+    size_t old_alloc = map->alloc;
+    size_t old_len = mp_map_table_len(map);
+    size_t old_fill = old_alloc == 0 ? 0 : *compact_fill(map);
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->used + 1);
+    DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
+    mp_map_elem_t *old_table = map->table;
+    mp_map_elem_t *new_table = malloc_table(compact_table_len(new_alloc));
+    // If we reach this point, table resizing succeeded, now we can edit the old map.
+    map->alloc = new_alloc;
+    map->all_keys_are_qstrs = 1;
+    map->table = new_table;
+    size_t used = 0;
+    for (size_t i = 0; i < old_fill; i++) {
+        if (old_table[i].key != MP_OBJ_NULL && old_table[i].key != MP_OBJ_SENTINEL) {
+            if (!mp_obj_is_qstr(old_table[i].key)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            new_table[used++] = old_table[i];
+        }
+    }
+    *compact_fill(map) = used;
+    compact_index_build(map, used);
+    m_del(mp_map_elem_t, old_table, old_len);
+}
+
+static mp_map_elem_t *compact_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind, bool compare_only_ptrs) {
+    if (map->alloc == 0) {
+        if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            mp_map_rehash(map);
+        } else {
+            return NULL;
+        }
+    }
+
+    mp_uint_t hash = map_hash(index);
+    for (;;) {
+        size_t index_len = compact_index_len(map->alloc);
+        size_t width = compact_index_width(map->alloc);
+        size_t pos = hash % index_len;
+        size_t entry;
+        while ((entry = compact_index_get(map, width, pos)) != 0) {
+            mp_map_elem_t *slot = &map->table[entry - 1];
+            if (slot->key != MP_OBJ_SENTINEL &&
+                (slot->key == index || (!compare_only_ptrs && mp_obj_equal(slot->key, index)))) {
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    map->used--;
+                    slot->key = MP_OBJ_SENTINEL;
+                    // keep slot->value so that caller can access it if needed
+                }
+                MAP_CACHE_SET(index, entry - 1);
+                return slot;
+            }
+            pos = (pos + 1) % index_len;
+        }
+
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        size_t *fill = compact_fill(map);
+        if (*fill < map->alloc) {
+            mp_map_elem_t *slot = &map->table[*fill];
+            *fill += 1;
+            compact_index_set(map, width, pos, *fill);
+            map->used++;
+            slot->key = index;
+            slot->value = MP_OBJ_NULL;
+            if (!mp_obj_is_qstr(index)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            return slot;
+        }
+        // No room to append, so pack or grow the table and search again.
+        if (map->used < map->alloc) {
+            compact_pack(map);
+        } else {
+            mp_map_rehash(map);
+        }
+    }
+}
+#else
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
@@ -151,6 +354,7 @@ static void mp_map_rehash(mp_map_t *map) {
     }
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
+#endif
 
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
@@ -220,9 +424,12 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         }
         if (map->used == map->alloc) {
             // TODO: Alloc policy
+            // CIRCUITPY-CHANGE: renew the table by its allocated length
+            size_t old_len = mp_map_table_len(map);
             map->alloc += 4;
-            map->table = m_renew(mp_map_elem_t, map->table, map->used, map->alloc);
-            mp_seq_clear(map->table, map->used, map->alloc, sizeof(*map->table));
+            size_t new_len = mp_map_table_len(map);
+            map->table = m_renew(mp_map_elem_t, map->table, old_len, new_len);
+            mp_seq_clear(map->table, map->used, new_len, sizeof(*map->table));
         }
         mp_map_elem_t *elem = map->table + map->used++;
         elem->key = index;
@@ -238,6 +445,9 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // map is a hash table (not an ordered array), so do a hash lookup
 
+    #if MICROPY_MAP_COMPACT
+    return compact_lookup(map, index, lookup_kind, compare_only_ptrs);
+    #else
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
@@ -246,13 +456,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         }
     }
 
-    // get hash of index, with fast path for common case of qstr
-    mp_uint_t hash;
-    if (mp_obj_is_qstr(index)) {
-        hash = qstr_hash(MP_OBJ_QSTR_VALUE(index));
-    } else {
-        hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
-    }
+    mp_uint_t hash = map_hash(index);
 
     size_t pos = hash % map->alloc;
     size_t start_pos = pos;
@@ -324,6 +528,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
 }
 
 /******************************************************************************/
@@ -100,6 +100,58 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_INCREMENTAL_SWEEP
+static mp_obj_t gc_sweep_budget(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(gc_get_sweep_budget());
+    }
+    mp_int_t val = mp_obj_get_int(args[0]);
+    gc_set_sweep_budget(val < 0 ? 0 : val);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_sweep_budget_obj, 0, 1, gc_sweep_budget);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_MOVABLE
+// compact(): collect, then move movable buffers to join up free memory
+static mp_obj_t gc_compact_fun(void) {
+    gc_collect();
+    return mp_obj_new_int_from_uint(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, gc_compact_fun);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+// stats(): return a dict of collection and allocation counts
+static mp_obj_t gc_stats_fun(void) {
+    gc_stats_t stats;
+    gc_stats(&stats);
+    mp_obj_t allocs[MICROPY_GC_STATS_SIZE_CLASSES];
+    for (size_t i = 0; i < MICROPY_GC_STATS_SIZE_CLASSES; i++) {
+        allocs[i] = mp_obj_new_int_from_uint(stats.allocs[i]);
+    }
+    mp_obj_t dict = mp_obj_new_dict(7);
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_collections), mp_obj_new_int_from_uint(stats.collections));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_pause_total_us), mp_obj_new_int_from_ull(stats.pause_total_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_pause_max_us), mp_obj_new_int_from_uint(stats.pause_max_us));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_bytes_allocated), mp_obj_new_int_from_ull(stats.bytes_allocated));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_allocs), mp_obj_new_tuple(MICROPY_GC_STATS_SIZE_CLASSES, allocs));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_largest_free), mp_obj_new_int_from_uint(stats.largest_free));
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(MP_QSTR_largest_free_min), mp_obj_new_int_from_uint(stats.largest_free_min));
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats_fun);
+
+// alloc_count(): return the number of allocations so far without allocating
+static mp_obj_t gc_alloc_count_fun(void) {
+    return mp_obj_new_int_from_uint(gc_alloc_count());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_alloc_count_obj, gc_alloc_count_fun);
+#endif
+
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +163,17 @@ static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    { MP_ROM_QSTR(MP_QSTR_sweep_budget), MP_ROM_PTR(&gc_sweep_budget_obj) },
+    #endif
+    #if MICROPY_GC_MOVABLE
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
+    #if MICROPY_GC_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_alloc_count), MP_ROM_PTR(&gc_alloc_count_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
@@ -174,6 +174,11 @@ static void *thread_entry(void *args_in) {
     ts.nlr_jump_callback_top = NULL;
     ts.mp_pending_exception = MP_OBJ_NULL;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_TRACK_CURRENT_CODE_STATE
+    ts.current_code_state = NULL;
+    #endif
+
     // set locals and globals from the calling context
     mp_locals_set(args->dict_locals);
     mp_globals_set(args->dict_globals);
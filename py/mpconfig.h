@@ -196,6 +196,13 @@
 #define MICROPY_GC_STACK_ENTRY_TYPE size_t
 #endif
 
+// CIRCUITPY-CHANGE
+// Continue the GC stack in the longest run of free heap blocks once it fills up, rather
+// than rescanning the heap for marked blocks whose children weren't traced.
+#ifndef MICROPY_GC_STACK_IN_FREE_HEAP
+#define MICROPY_GC_STACK_IN_FREE_HEAP (0)
+#endif
+
 // Be conservative and always clear to zero newly (re)allocated memory in the GC.
 // This helps eliminate stray pointers that hold on to memory that's no longer
 // used.  It decreases performance due to unnecessary memory clearing.
@@ -206,6 +213,48 @@
 #define MICROPY_GC_CONSERVATIVE_CLEAR (MICROPY_ENABLE_GC)
 #endif
 
+// CIRCUITPY-CHANGE
+// Support sweeping the heap a slice at a time across allocations after each
+// collection, bounded by gc.sweep_budget(). Requires mp_hal_ticks_us().
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Serve 1 and 2 block allocations from pools of holes that size, found a batch at a
+// time, so small objects fill the gaps between larger ones instead of splitting free runs.
+#ifndef MICROPY_GC_SMALL_POOLS
+#define MICROPY_GC_SMALL_POOLS (0)
+#endif
+
+// Number of holes each small allocation pool holds.
+#ifndef MICROPY_GC_SMALL_POOL_LEN
+#define MICROPY_GC_SMALL_POOL_LEN (16)
+#endif
+
+// CIRCUITPY-CHANGE
+// Support moving registered buffers to join up free memory, with gc.compact().
+#ifndef MICROPY_GC_MOVABLE
+#define MICROPY_GC_MOVABLE (0)
+#endif
+
+// Number of buffers that can be registered as movable at once.
+#ifndef MICROPY_GC_MOVABLE_MAX
+#define MICROPY_GC_MOVABLE_MAX (16)
+#endif
+
+// CIRCUITPY-CHANGE
+// Keep counts of collections, their pause times and allocations, for gc.stats().
+// Requires mp_hal_ticks_us().
+#ifndef MICROPY_GC_STATS
+#define MICROPY_GC_STATS (0)
+#endif
+
+// Number of power of two allocation sizes, in blocks, that gc.stats() counts separately.
+#ifndef MICROPY_GC_STATS_SIZE_CLASSES
+#define MICROPY_GC_STATS_SIZE_CLASSES (8)
+#endif
+
 // Support automatic GC when reaching allocation threshold,
 // configurable by gc.threshold().
 #ifndef MICROPY_GC_ALLOC_THRESHOLD
@@ -342,11 +391,43 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE: Whether loading persistent code from read-only memory (see
+// MP_READER_IS_ROM) references the bytecode and constant data in place instead
+// of copying it to the heap. Only the qstrs and object tables are built in RAM.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_ROM
+#define MICROPY_PERSISTENT_CODE_LOAD_ROM (0)
+#endif
+
+// CIRCUITPY-CHANGE: Whether importing a .py file from a directory containing a
+// .mpycache directory saves the compiled code there, and loads it on later
+// imports while the source is unchanged. Requires the VFS.
+#ifndef MICROPY_MODULE_COMPILE_CACHE
+#define MICROPY_MODULE_COMPILE_CACHE (0)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
-#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
+// CIRCUITPY-CHANGE: also for MICROPY_MODULE_COMPILE_CACHE
+#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE || MICROPY_MODULE_COMPILE_CACHE)
+#endif
+
+// CIRCUITPY-CHANGE: Whether the results of looking for modules to import on FAT
+// filesystems are remembered, until the next write to any of them. Kept outside
+// the heap so that the lookups after a soft reload are fast too.
+#ifndef MICROPY_VFS_IMPORT_STAT_CACHE
+#define MICROPY_VFS_IMPORT_STAT_CACHE (0)
+#endif
+
+// Number of lookups remembered. Each takes the path length below plus 12 bytes.
+#ifndef MICROPY_VFS_IMPORT_STAT_CACHE_SIZE
+#define MICROPY_VFS_IMPORT_STAT_CACHE_SIZE (32)
+#endif
+
+// Longest path whose lookup is remembered, such as "/lib/adafruit_display_text/label.mpy".
+#ifndef MICROPY_VFS_IMPORT_STAT_CACHE_PATH_LEN
+#define MICROPY_VFS_IMPORT_STAT_CACHE_PATH_LEN (48)
 #endif
 
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
@@ -487,6 +568,13 @@
 #define MICROPY_COMP_CONST (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether const() also takes dicts of constants, eg id = const({1: 2}), making them read-only
+// dicts that frozen code keeps in ROM
+#ifndef MICROPY_COMP_CONST_DICT
+#define MICROPY_COMP_CONST_DICT (MICROPY_COMP_CONST && MICROPY_COMP_CONST_FOLDING)
+#endif
+
 // Whether to enable optimisation of: a, b = c, d
 // Costs 124 bytes (Thumb2)
 #ifndef MICROPY_COMP_DOUBLE_TUPLE_ASSIGN
@@ -505,6 +593,20 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE: Whether files are parsed and compiled a batch of top-level
+// statements at a time, freeing each batch's parse tree before parsing the
+// next, so that the parse tree of the whole file is never in memory at once.
+// All of the file is compiled before any of it runs.
+#ifndef MICROPY_COMP_STREAMING
+#define MICROPY_COMP_STREAMING (0)
+#endif
+
+// Bytes of parse tree after which a batch of statements is compiled. A single
+// statement larger than this, such as a long function, is its own batch.
+#ifndef MICROPY_COMP_STREAMING_BATCH
+#define MICROPY_COMP_STREAMING_BATCH (1024)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -591,12 +693,88 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE: Lay out hash maps like CPython's compact dicts: a dense
+// array of entries in insertion order, found through a separate index of
+// byte, halfword or word slots. Dicts then iterate in insertion order and
+// lookups probe a small index that is never more than 80% full.
+#ifndef MICROPY_MAP_COMPACT
+#define MICROPY_MAP_COMPACT (0)
+#endif
+
+// CIRCUITPY-CHANGE: Use extra RAM to cache the class attributes found when
+// looking up an attribute of an instance, so that calling a method doesn't
+// search the locals dict of the class and each of its bases every time.
+// Entries are invalidated whenever any class is created or modified.
+#ifndef MICROPY_OPT_TYPE_ATTR_CACHE
+#define MICROPY_OPT_TYPE_ATTR_CACHE (0)
+#endif
+
+// Number of entries in the type attribute cache. Each is five words.
+#ifndef MICROPY_OPT_TYPE_ATTR_CACHE_SIZE
+#define MICROPY_OPT_TYPE_ATTR_CACHE_SIZE (32)
+#endif
+
+// CIRCUITPY-CHANGE: Whether the bytecode compiler replaces common sequences of
+// opcodes, such as loading a local and one of its attributes, with a single
+// opcode that does the work of all of them. This doesn't change the size of
+// the bytecode. Saved .mpy files marked as using these opcodes only load when
+// this is enabled, so it should stay disabled in mpy-cross.
+#ifndef MICROPY_OPT_FUSED_BYTECODE
+#define MICROPY_OPT_FUSED_BYTECODE (0)
+#endif
+
+// CIRCUITPY-CHANGE: Whether a bytecode function that is called or loops often
+// is compiled again from its source file with the native emitter, as if it
+// were decorated with @micropython.native, and the native version is called
+// from then on. This is only done while the file has the size and
+// modification time it had when the module was compiled. Decorating a function with @micropython.bytecode keeps it in
+// bytecode. Tracebacks show no line numbers inside native functions.
+#ifndef MICROPY_OPT_NATIVE_TIER_UP
+#define MICROPY_OPT_NATIVE_TIER_UP (0)
+#endif
+
+// Number of calls and loop iterations after which a function is compiled.
+#ifndef MICROPY_OPT_NATIVE_TIER_UP_THRESHOLD
+#define MICROPY_OPT_NATIVE_TIER_UP_THRESHOLD (1000)
+#endif
+
+// CIRCUITPY-CHANGE: Whether qstrs interned at runtime are also found through a
+// hash table of their ids, so interning a string doesn't slow down as more are
+// added. The table is reallocated each time a new qstr pool is, and uses 3 to 6
+// bytes of heap per qstr.
+#ifndef MICROPY_OPT_QSTR_HASH_INDEX
+#define MICROPY_OPT_QSTR_HASH_INDEX (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to use Karatsuba multiplication for long mpz numbers, a short
+// division for single-digit divisors, and sliding windows in pow(a, b, m).
+// These make big integer arithmetic much faster for about 1k of code.
+#ifndef MICROPY_OPT_MPZ_FAST_ARITH
+#define MICROPY_OPT_MPZ_FAST_ARITH (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether str and bytes searches with longer needles use Boyer-Moore-Horspool,
+// which skips most of the haystack. Uses 256 bytes of stack while searching.
+#ifndef MICROPY_OPT_FIND_SUBBYTES_HORSPOOL
+#define MICROPY_OPT_FIND_SUBBYTES_HORSPOOL (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether list.sort and sorted() use a stable merge sort that calls the key
+// function once per item and takes advantage of runs already in order. Needs
+// temporary heap of up to half the list, or twice the list with a key function.
+#ifndef MICROPY_OPT_LIST_STABLE_SORT
+#define MICROPY_OPT_LIST_STABLE_SORT (0)
+#endif
+
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
@@ -905,6 +1083,16 @@ typedef double mp_float_t;
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether repr() of a float prints the shortest digits that read back as the
+// same float, as CPython does, instead of rounding to a fixed precision. With
+// mpz long ints, parsing floats is also made correctly rounded so that the
+// digits do read back. Costs about 3k of code, of which the table of powers of
+// ten is 1k for double precision and 200 bytes for single precision.
+#ifndef MICROPY_FLOAT_SHORTEST_REPR
+#define MICROPY_FLOAT_SHORTEST_REPR (0)
+#endif
+
 // Enable features which improve CPython compatibility
 // but may lead to more code size/memory usage.
 // TODO: Originally intended as generic category to not
@@ -1089,6 +1277,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_DELATTR_SETATTR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether a class's __slots__ gives its instances a fixed array of attributes
+// instead of a members map. This makes the instances smaller and their
+// attributes faster to access, for a little more code.
+#ifndef MICROPY_PY_CLASS_SLOTS
+#define MICROPY_PY_CLASS_SLOTS (0)
+#endif
+
 // Support for async/await/async for/async with
 #ifndef MICROPY_PY_ASYNC_AWAIT
 #define MICROPY_PY_ASYNC_AWAIT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
@@ -1113,6 +1309,15 @@ typedef double mp_float_t;
 #define MICROPY_PY_GENERATOR_PEND_THROW (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether a generator or coroutine that has finished gives its local and
+// exception stacks back to the heap right away, keeping only its header.
+// (This keeps tasks that spawn many short-lived coroutines from filling the
+// heap with dead frames between collections.)
+#ifndef MICROPY_PY_GENERATOR_RELEASE_STATE
+#define MICROPY_PY_GENERATOR_RELEASE_STATE (MICROPY_ENABLE_GC && !MICROPY_PY_SYS_SETTRACE)
+#endif
+
 // Issue a warning when comparing str and bytes objects
 #ifndef MICROPY_PY_STR_BYTES_CMP_WARN
 #define MICROPY_PY_STR_BYTES_CMP_WARN (0)
@@ -1573,6 +1778,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether MP_STATE_THREAD(current_code_state) follows the innermost running bytecode
+// function without sys.settrace, so allocations can be attributed to a source line
+#ifndef MICROPY_TRACK_CURRENT_CODE_STATE
+#define MICROPY_TRACK_CURRENT_CODE_STATE (0)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -1714,6 +1926,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_JSON_SEPARATORS (1)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide json.iterparse, which streams a document and builds only
+// the values at the paths asked for
+#ifndef MICROPY_PY_JSON_ITERPARSE
+#define MICROPY_PY_JSON_ITERPARSE (0)
+#endif
+
 #ifndef MICROPY_PY_OS
 #define MICROPY_PY_OS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -1742,6 +1961,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_RE_SUB (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to match regexes with a Pike VM, which takes time linear in the
+// length of the subject and no deep recursion, instead of by backtracking.
+// It allocates space for the threads on the heap while matching.
+#ifndef MICROPY_PY_RE_PIKEVM
+#define MICROPY_PY_RE_PIKEVM (0)
+#endif
+
 #ifndef MICROPY_PY_HEAPQ
 #define MICROPY_PY_HEAPQ (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
@@ -88,6 +88,19 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_TYPE_ATTR_CACHE
+// The result of looking up attr on instances of type: value was found in the
+// locals dict of found_in, which is type or one of its bases.
+typedef struct _mp_type_attr_cache_entry_t {
+    const mp_obj_type_t *type;
+    const mp_obj_type_t *found_in;
+    mp_obj_t value;
+    size_t version;
+    qstr attr;
+} mp_type_attr_cache_entry_t;
+#endif
+
 // This structure holds information about a single contiguous area of
 // memory reserved for the memory manager.
 typedef struct _mp_state_mem_area_t {
@@ -109,8 +122,25 @@ typedef struct _mp_state_mem_area_t {
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+    // CIRCUITPY-CHANGE: No run of free blocks in the area is longer than this. SIZE_MAX when
+    // blocks have been freed since the last search that failed.
+    size_t gc_max_free_run;
 } mp_state_mem_area_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_SMALL_POOLS
+// Free holes of exactly one size in an area, for allocations of that many blocks. Holes may
+// have been taken by other allocations since they were found, so each is checked when used.
+typedef struct _mp_state_mem_small_pool_t {
+    mp_state_mem_area_t *area;
+    size_t blocks[MICROPY_GC_SMALL_POOL_LEN];
+    uint8_t len;
+    uint8_t next;
+    // Set when no holes were found, until blocks are next freed.
+    bool exhausted;
+} mp_state_mem_small_pool_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -127,6 +157,13 @@ typedef struct _mp_state_mem_t {
     // Array that tracks the area for each block on gc_block_stack.
     mp_state_mem_area_t *gc_area_stack[MICROPY_ALLOC_GC_STACK_SIZE];
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STACK_IN_FREE_HEAP
+    // Free heap blocks that continue the GC stack during marking once it is full.
+    uintptr_t *gc_stack_ext;
+    size_t gc_stack_ext_len;
+    bool gc_stack_ext_found;
+    #endif
 
     // This variable controls auto garbage collection.  If set to 0 then the
     // GC won't automatically run when gc_alloc can't find enough blocks.  But
@@ -146,6 +183,53 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Where the pending sweep continues. gc_sweep_area is NULL when none is pending.
+    mp_state_mem_area_t *gc_sweep_area;
+    #if MICROPY_GC_SPLIT_HEAP_AUTO
+    mp_state_mem_area_t *gc_sweep_prev_area;
+    #endif
+    size_t gc_sweep_block;
+    size_t gc_sweep_last_used_block;
+    bool gc_sweep_free_tail;
+    bool gc_sweep_running;
+    // Longest a collection or allocation sweeps for. 0 sweeps everything in the collection.
+    mp_uint_t gc_sweep_budget_us;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_SMALL_POOLS
+    // For 1 and 2 block allocations.
+    mp_state_mem_small_pool_t gc_small_pool[2];
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_MOVABLE
+    // Slots holding the only pointer to a buffer that gc_compact() may move, and the heap
+    // object each slot is in, or NULL for a slot outside the heap.
+    void **gc_movable_slot[MICROPY_GC_MOVABLE_MAX];
+    void *gc_movable_owner[MICROPY_GC_MOVABLE_MAX];
+    size_t gc_movable_len;
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_STATS
+    size_t gc_stats_collections;
+    uint64_t gc_stats_pause_total_us;
+    mp_uint_t gc_stats_pause_max_us;
+    mp_uint_t gc_stats_pause_start_us;
+    uint64_t gc_stats_bytes_allocated;
+    // Allocations of 1, 2, 3-4, 5-8 ... blocks, with the last counting all larger ones.
+    size_t gc_stats_allocs[MICROPY_GC_STATS_SIZE_CLASSES];
+    // Smallest largest free run a finished sweep has left, in blocks.
+    size_t gc_stats_largest_free_min;
+    // Where the free run the sweep is in started, and the longest it has passed, in blocks. Blocks
+    // allocated behind an incremental sweep still count as free here.
+    size_t gc_stats_sweep_free_start;
+    size_t gc_stats_sweep_largest_free;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_mutex_t gc_mutex;
@@ -233,6 +317,14 @@ typedef struct _mp_state_vm_t {
     #if MICROPY_EMIT_NATIVE
     uint8_t default_emit_opt; // one of MP_EMIT_OPT_xxx
     #endif
+    // CIRCUITPY-CHANGE: while non-zero, functions aren't compiled to native code
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    uint8_t tier_up_blocked;
+    #endif
+    // CIRCUITPY-CHANGE: set once saving to a .mpycache directory fails
+    #if MICROPY_MODULE_COMPILE_CACHE
+    bool compile_cache_save_failed;
+    #endif
     #endif
 
     // size of the emergency exception buf, if it's dynamically allocated
@@ -270,6 +362,14 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    // See mp_obj_instance_load_attr. Not a root pointer section: a cached value
+    // is only used while the class it was found through is alive and unchanged.
+    mp_type_attr_cache_entry_t type_attr_cache[MICROPY_OPT_TYPE_ATTR_CACHE_SIZE];
+    size_t type_attr_cache_version;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
@@ -319,6 +419,9 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_TRACK_CURRENT_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 
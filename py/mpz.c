@@ -461,6 +461,108 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MPZ_FAST_ARITH
+
+// Below this many digits in the shorter number, schoolbook multiplication is faster.
+#ifndef MPZ_KARATSUBA_THRESHOLD
+#define MPZ_KARATSUBA_THRESHOLD (24)
+#endif
+// Smaller numbers wouldn't get shorter when split.
+#if MPZ_KARATSUBA_THRESHOLD < 8
+#error MPZ_KARATSUBA_THRESHOLD must be at least 8
+#endif
+
+static size_t mpn_normalised_len(mpz_dig_t *idig, size_t ilen) {
+    return mpn_remove_trailing_zeros(idig, idig + ilen);
+}
+
+/* returns the number of scratch digits mpn_mul_karatsuba needs to multiply
+   numbers of up to n digits
+*/
+static size_t mpn_karatsuba_scratch_len(size_t n) {
+    // Each level of the recursion needs at most 2n + 8 digits, and works on
+    // numbers of at most n / 2 + 2 digits in the next.
+    size_t need = 0;
+    while (n >= MPZ_KARATSUBA_THRESHOLD) {
+        need += 2 * n + 8;
+        n = n / 2 + 2;
+    }
+    return need;
+}
+
+/* computes i = j * k
+   returns number of digits in i
+   assumes enough memory in i; assumes i is zeroed; assumes normalised j, k
+   assumes scratch has mpn_karatsuba_scratch_len(max(jlen, klen)) digits
+   can have j, k point to same memory
+
+   Numbers long enough are split in halves, j = j1 * B^m + j0 and likewise for k,
+   so that j * k = z2 * B^2m + z1 * B^m + z0 takes three half-size products:
+   z0 = j0 * k0, z2 = j1 * k1 and z1 = (j0 + j1) * (k0 + k1) - z0 - z2. Multiplying
+   n digits then takes about n^1.58 steps instead of n^2.
+*/
+static size_t mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen, mpz_dig_t *scratch) {
+    if (jlen < klen) {
+        mpz_dig_t *tdig = jdig;
+        jdig = kdig;
+        kdig = tdig;
+        size_t t = jlen;
+        jlen = klen;
+        klen = t;
+    }
+    if (klen < MPZ_KARATSUBA_THRESHOLD) {
+        return mpn_mul(idig, jdig, jlen, kdig, klen);
+    }
+
+    size_t m = jlen / 2;
+    size_t j0len = mpn_normalised_len(jdig, m);
+    mpz_dig_t *j1dig = jdig + m;
+    size_t j1len = jlen - m;
+    // i is added to from digit m up to its end
+    size_t ihigh_len = jlen + klen - m;
+
+    if (klen <= m) {
+        // k is too short to split, so compute j0 * k + j1 * k * B^m instead
+        mpn_mul_karatsuba(idig, jdig, j0len, kdig, klen, scratch);
+        mpz_dig_t *tdig = scratch;
+        size_t tlen = j1len + klen;
+        memset(tdig, 0, tlen * sizeof(mpz_dig_t));
+        tlen = mpn_mul_karatsuba(tdig, j1dig, j1len, kdig, klen, scratch + tlen);
+        mpn_add(idig + m, idig + m, ihigh_len, tdig, tlen);
+        return mpn_normalised_len(idig, jlen + klen);
+    }
+
+    size_t k0len = mpn_normalised_len(kdig, m);
+    mpz_dig_t *k1dig = kdig + m;
+    size_t k1len = klen - m;
+
+    // z0 and z2 go straight into the low and high digits of i
+    size_t z0len = mpn_mul_karatsuba(idig, jdig, j0len, kdig, k0len, scratch);
+    size_t z2len = mpn_mul_karatsuba(idig + 2 * m, j1dig, j1len, k1dig, k1len, scratch);
+
+    size_t s = j1len + 1;
+    mpz_dig_t *sjdig = scratch;
+    mpz_dig_t *skdig = scratch + s;
+    mpz_dig_t *z1dig = scratch + 2 * s;
+    size_t sjlen = mpn_add(sjdig, j1dig, j1len, jdig, j0len);
+    size_t sklen;
+    if (k1len >= k0len) {
+        sklen = mpn_add(skdig, k1dig, k1len, kdig, k0len);
+    } else {
+        sklen = mpn_add(skdig, kdig, k0len, k1dig, k1len);
+    }
+    memset(z1dig, 0, (sjlen + sklen) * sizeof(mpz_dig_t));
+    size_t z1len = mpn_mul_karatsuba(z1dig, sjdig, sjlen, skdig, sklen, scratch + 4 * s);
+    z1len = mpn_sub(z1dig, z1dig, z1len, idig, z0len);
+    z1len = mpn_sub(z1dig, z1dig, z1len, idig + 2 * m, z2len);
+
+    mpn_add(idig + m, idig + m, ihigh_len, z1dig, z1len);
+    return mpn_normalised_len(idig, jlen + klen);
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -488,6 +590,25 @@ static void mpn_div(mpz_dig_t *num_dig, size_t *num_len, const mpz_dig_t *den_di
         }
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_ARITH
+    if (den_len == 1) {
+        // A single digit divides each digit of the numerator in turn, without
+        // normalising or correcting the quotient.
+        mpz_dbl_dig_t den = den_dig[0];
+        mpz_dbl_dig_t rem = 0;
+        for (size_t i = *num_len; i > 0; --i) {
+            rem = (rem << DIG_SIZE) | num_dig[i - 1];
+            quo_dig[i - 1] = rem / den;
+            rem %= den;
+        }
+        *quo_len = mpn_normalised_len(quo_dig, *num_len);
+        num_dig[0] = rem;
+        *num_len = rem != 0;
+        return;
+    }
+    #endif
+
     // We need to normalise the denominator (leading bit of leading digit is 1)
     // so that the division routine works.  Since the denominator memory is
     // read-only we do the normalisation on the fly, each time a digit of the
@@ -1311,7 +1432,19 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
     memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_ARITH
+    if (MIN(lhs->len, rhs->len) >= MPZ_KARATSUBA_THRESHOLD) {
+        // One scratch buffer serves the whole recursion.
+        size_t scratch_len = mpn_karatsuba_scratch_len(MAX(lhs->len, rhs->len));
+        mpz_dig_t *scratch = m_new(mpz_dig_t, scratch_len);
+        dest->len = mpn_mul_karatsuba(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len, scratch);
+        m_del(mpz_dig_t, scratch, scratch_len);
+    } else
+    #endif
+    {
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,8 +1489,101 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_MPZ_FAST_ARITH
+
+// The longest run of exponent bits matched at once by mpz_pow3_inpl. The table of
+// powers holds 2^(MPZ_POW_WINDOW - 1) numbers.
+#define MPZ_POW_WINDOW (5)
+
+static mp_uint_t mpz_get_bit(const mpz_t *z, size_t n) {
+    return (z->dig[n / DIG_SIZE] >> (n % DIG_SIZE)) & 1;
+}
+
+/* computes dest = (lhs * rhs) % mod, using prod and quo for the intermediate results
+   can have dest, lhs, rhs the same
+*/
+static void mpz_mul_mod_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod, mpz_t *prod, mpz_t *quo) {
+    mpz_mul_inpl(prod, lhs, rhs);
+    mpz_divmod_inpl(quo, dest, prod, mod);
+}
+
+/* computes dest = (lhs ** rhs) % mod for rhs > 0
+   dest can't be the same as lhs, rhs or mod
+   The bits of rhs are read from the top in windows of up to MPZ_POW_WINDOW bits that
+   end in a 1. Each window costs a squaring per bit, as before, but only one multiply,
+   by an odd power of lhs from a table computed up front.
+*/
+static void mpz_pow3_window(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t nbits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = rhs->dig[rhs->len - 1]; d != 0; d >>= 1) {
+        ++nbits;
+    }
+    // Larger windows save multiplies on long exponents but take longer to set up.
+    size_t window = nbits <= 8 ? 1 : nbits <= 24 ? 2 : nbits <= 80 ? 3 : nbits <= 240 ? 4 : MPZ_POW_WINDOW;
+
+    mpz_t prod, quo;
+    mpz_init_zero(&prod);
+    mpz_init_zero(&quo);
+
+    // table[i] = lhs ** (2 * i + 1) % mod, each fitting in the digits of mod
+    size_t table_len = 1 << (window - 1);
+    size_t entry_alloc = MAX(mod->len, MIN_ALLOC);
+    mpz_dig_t *table_dig = m_new(mpz_dig_t, table_len * entry_alloc);
+    mpz_t table[1 << (MPZ_POW_WINDOW - 1)];
+    for (size_t i = 0; i < table_len; ++i) {
+        mpz_init_fixed_from_int(&table[i], table_dig + i * entry_alloc, entry_alloc, 0);
+    }
+    mpz_divmod_inpl(&quo, dest, lhs, mod);
+    mpz_set(&table[0], dest);
+    if (table_len > 1) {
+        mpz_t square;
+        mpz_init_zero(&square);
+        mpz_mul_mod_inpl(&square, dest, dest, mod, &prod, &quo);
+        for (size_t i = 1; i < table_len; ++i) {
+            mpz_mul_mod_inpl(dest, &table[i - 1], &square, mod, &prod, &quo);
+            mpz_set(&table[i], dest);
+        }
+        mpz_deinit(&square);
+    }
+
+    bool started = false;
+    for (size_t i = nbits; i > 0;) {
+        if (!mpz_get_bit(rhs, i - 1)) {
+            mpz_mul_mod_inpl(dest, dest, dest, mod, &prod, &quo);
+            --i;
+            continue;
+        }
+        size_t low = i > window ? i - window : 0;
+        while (!mpz_get_bit(rhs, low)) {
+            ++low;
+        }
+        size_t value = 0;
+        for (size_t b = i; b > low; --b) {
+            value = (value << 1) | mpz_get_bit(rhs, b - 1);
+            if (started) {
+                mpz_mul_mod_inpl(dest, dest, dest, mod, &prod, &quo);
+            }
+        }
+        if (started) {
+            mpz_mul_mod_inpl(dest, dest, &table[value >> 1], mod, &prod, &quo);
+        } else {
+            // The top window starts the result, there is nothing to square yet.
+            mpz_set(dest, &table[value >> 1]);
+            started = true;
+        }
+        i = low;
+    }
+
+    m_del(mpz_dig_t, table_dig, table_len * entry_alloc);
+    mpz_deinit(&quo);
+    mpz_deinit(&prod);
+}
+
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
-   can have dest, lhs, rhs the same; mod can't be the same as dest
+   CIRCUITPY-CHANGE: dest is set to 1 first, so it can't be the same as lhs, rhs or mod
 */
 void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
     if (lhs->len == 0 || rhs->neg != 0 || (mod->len == 1 && mod->dig[0] == 1)) {
@@ -1371,6 +1597,10 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_ARITH
+    mpz_pow3_window(dest, lhs, rhs, mod);
+    #else
     mpz_t *x = mpz_clone(lhs);
     mpz_t *n = mpz_clone(rhs);
     mpz_t quo;
@@ -1392,6 +1622,7 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
     mpz_deinit(&quo);
     mpz_free(x);
     mpz_free(n);
+    #endif
 }
 
 #if 0
@@ -514,6 +514,8 @@ static inline bool mp_map_slot_is_filled(const mp_map_t *map, size_t pos) {
 }
 
 void mp_map_init(mp_map_t *map, size_t n);
+// CIRCUITPY-CHANGE: The table of a compact hash map is longer than alloc.
+size_t mp_map_table_len(const mp_map_t *map);
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table);
 mp_map_t *mp_map_new(size_t n);
 void mp_map_deinit(mp_map_t *map);
@@ -586,6 +588,8 @@ typedef mp_obj_t (*mp_fun_kw_t)(size_t n, const mp_obj_t *, mp_map_t *);
 #define MP_TYPE_FLAG_INSTANCE_TYPE (0x0200)
 // CIRCUITPY-CHANGE: check for valid types in json dumps
 #define MP_TYPE_FLAG_PRINT_JSON (0x0400)
+// CIRCUITPY-CHANGE: instances keep their attributes in a fixed array, see __slots__
+#define MP_TYPE_FLAG_HAS_INSTANCE_SLOTS (0x0800)
 
 typedef enum {
     PRINT_STR = 0,
@@ -46,11 +46,22 @@ typedef struct _mp_obj_complex_t {
     mp_float_t imag;
 } mp_obj_complex_t;
 
+// CIRCUITPY-CHANGE
+static void complex_format_part(char *buf, size_t buf_size, mp_float_t f, int precision) {
+    #if MICROPY_FLOAT_SHORTEST_REPR
+    (void)precision;
+    mp_format_float_shortest(f, buf, buf_size);
+    #else
+    mp_format_float(f, buf, buf_size, 'g', precision, '\0');
+    #endif
+}
+
 static void complex_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t kind) {
     (void)kind;
     mp_obj_complex_t *o = MP_OBJ_TO_PTR(o_in);
     #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-    char buf[16];
+    // CIRCUITPY-CHANGE: room for the 16 digits shortest repr gives 1e15
+    char buf[24];
     #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C
     const int precision = 6;
     #else
@@ -61,15 +72,15 @@ static void complex_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_
     const int precision = 16;
     #endif
     if (o->real == 0) {
-        mp_format_float(o->imag, buf, sizeof(buf), 'g', precision, '\0');
+        complex_format_part(buf, sizeof(buf), o->imag, precision);
         mp_printf(print, "%sj", buf);
     } else {
-        mp_format_float(o->real, buf, sizeof(buf), 'g', precision, '\0');
+        complex_format_part(buf, sizeof(buf), o->real, precision);
         mp_printf(print, "(%s", buf);
         if (o->imag >= 0 || isnan(o->imag)) {
             mp_print_str(print, "+");
         }
-        mp_format_float(o->imag, buf, sizeof(buf), 'g', precision, '\0');
+        complex_format_part(buf, sizeof(buf), o->imag, precision);
         mp_printf(print, "%sj)", buf);
     }
 }
@@ -158,6 +158,46 @@ static void decompress_error_text_maybe(mp_obj_exception_t *o) {
             o_str->hash = qstr_compute_hash(o_str->data, o_str->len);
         }
     }
+    // CIRCUITPY-CHANGE: messages without arguments are kept compressed until they are looked at.
+    // See mp_obj_new_exception_msg().
+    #elif MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
+    if (o->args != NULL && o->args->len == 1 && mp_obj_is_obj(o->args->items[0]) && mp_obj_is_exact_type(o->args->items[0], &mp_type_str)) {
+        mp_obj_str_t *o_str = MP_OBJ_TO_PTR(o->args->items[0]);
+        if (o_str->data != NULL || o_str->hash == 0) {
+            return;
+        }
+        mp_rom_error_text_t msg = (mp_rom_error_text_t)o_str->hash;
+        size_t alloc = decompress_length(msg);
+        byte *buf = m_new_maybe(byte, alloc);
+        #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
+        if (buf == NULL) {
+            // Try and use the emergency exception buf if enough space is available.
+            buf = (byte *)((uint8_t *)MP_STATE_VM(mp_emergency_exception_buf) + EMG_BUF_STR_BUF_OFFSET);
+            size_t avail = (uint8_t *)MP_STATE_VM(mp_emergency_exception_buf) + mp_emergency_exception_buf_size - buf;
+            if (avail < alloc) {
+                buf = NULL;
+            }
+        }
+        #endif
+        if (buf == NULL) {
+            // No way to decompress, fallback to no message text.
+            o_str->hash = 0;
+            return;
+        }
+        decompress(msg, (char *)buf);
+        // The message would have gone through mp_vcprintf() so undo its "%%" escapes.
+        size_t len = 0;
+        for (const byte *c = buf; *c != '\0'; c++) {
+            buf[len++] = *c;
+            if (c[0] == '%' && c[1] == '%') {
+                c++;
+            }
+        }
+        buf[len] = '\0';
+        o_str->data = buf;
+        o_str->len = len;
+        o_str->hash = qstr_compute_hash(buf, len);
+    }
     #endif
 }
 
@@ -485,8 +525,22 @@ mp_obj_t mp_obj_new_exception_args(const mp_obj_type_t *exc_type, size_t n_args,
 #if MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
 
 mp_obj_t mp_obj_new_exception_msg(const mp_obj_type_t *exc_type, mp_rom_error_text_t msg) {
-    // CIRCUITPY-CHANGE
-    return mp_obj_new_exception_msg_varg(exc_type, msg);
+    // CIRCUITPY-CHANGE: Code that raises and catches in a loop rarely looks at the message, so
+    // leave it compressed for decompress_error_text_maybe(). The string keeps the compressed
+    // message in its hash while its data is NULL.
+    mp_obj_str_t *o_str = NULL;
+    if (gc_alloc_possible()) {
+        o_str = m_new_obj_maybe(mp_obj_str_t);
+    }
+    if (o_str == NULL) {
+        return mp_obj_new_exception_msg_varg(exc_type, msg);
+    }
+    o_str->base.type = &mp_type_str;
+    o_str->hash = (size_t)msg;
+    o_str->len = 0;
+    o_str->data = NULL;
+    mp_obj_t arg = MP_OBJ_FROM_PTR(o_str);
+    return mp_obj_exception_make_new(exc_type, 1, 0, &arg);
 }
 
 // The following struct and function implement a simple printer that conservatively
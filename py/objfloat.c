@@ -117,7 +117,8 @@ static void float_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t
     (void)kind;
     mp_float_t o_val = mp_obj_float_get(o_in);
     #if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
-    char buf[16];
+    // CIRCUITPY-CHANGE: room for the 16 digits shortest repr gives 1e15
+    char buf[24];
     #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C
     const int precision = 6;
     #else
@@ -127,7 +128,13 @@ static void float_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kind_t
     char buf[32];
     const int precision = 16;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_FLOAT_SHORTEST_REPR
+    (void)precision;
+    mp_format_float_shortest(o_val, buf, sizeof(buf));
+    #else
     mp_format_float(o_val, buf, sizeof(buf), 'g', precision, '\0');
+    #endif
     mp_print_str(print, buf);
     if (strchr(buf, '.') == NULL && strchr(buf, 'e') == NULL && strchr(buf, 'n') == NULL) {
         // Python floats always have decimal point (unless inf or nan)
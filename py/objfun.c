@@ -34,6 +34,13 @@
 #include "py/bc.h"
 #include "py/cstack.h"
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+#include "py/compile.h"
+#include "py/gc.h"
+#include "extmod/vfs.h"
+#endif
+
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
 #else // don't print debugging info
@@ -229,6 +236,164 @@ mp_code_state_t *mp_obj_fun_bc_prepare_codestate(mp_obj_t self_in, size_t n_args
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+
+#if !MICROPY_EMIT_NATIVE || !MICROPY_ENABLE_COMPILER || !MICROPY_VFS
+#error MICROPY_OPT_NATIVE_TIER_UP requires MICROPY_EMIT_NATIVE, MICROPY_ENABLE_COMPILER and MICROPY_VFS
+#endif
+
+// Re-raises the exception unless it is one that stops a function being
+// compiled again: a missing or changed source file, or too little memory.
+static void tier_up_check_error(nlr_buf_t *nlr) {
+    mp_obj_t type = MP_OBJ_FROM_PTR(((mp_obj_base_t *)nlr->ret_val)->type);
+    if (!mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_SyntaxError))
+        && !mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_OSError))
+        && !mp_obj_is_subclass_fast(type, MP_OBJ_FROM_PTR(&mp_type_MemoryError))) {
+        nlr_jump(nlr->ret_val);
+    }
+}
+
+// Gets the size and modification time of the file, or zeros if it is not a
+// file that can be read again.
+static void tier_up_source_key(qstr source_file, mp_uint_t *size, mp_uint_t *mtime) {
+    *size = 0;
+    *mtime = 0;
+    // <stdin>, <string> and the like
+    if (qstr_str(source_file)[0] == '<') {
+        return;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(mp_vfs_stat(MP_OBJ_NEW_QSTR(source_file)), &len, &items);
+        *size = mp_obj_get_int_truncated(items[6]);
+        *mtime = mp_obj_get_int_truncated(items[8]);
+        nlr_pop();
+    } else {
+        tier_up_check_error(&nlr);
+    }
+}
+
+void mp_obj_fun_bc_tier_up_set_source(mp_module_context_t *context, qstr source_file) {
+    tier_up_source_key(source_file, &context->source_size, &context->source_mtime);
+}
+
+// Whether the source file is still the one the module was compiled from.
+static bool tier_up_source_unchanged(const mp_module_context_t *context, qstr source_file) {
+    mp_uint_t size, mtime;
+    tier_up_source_key(source_file, &size, &mtime);
+    return size != 0 && size == context->source_size && mtime == context->source_mtime;
+}
+
+static qstr fun_qstr(const mp_obj_fun_bc_t *fun, mp_uint_t index) {
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    return fun->context->constants.qstr_table[index];
+    #else
+    (void)fun;
+    return index;
+    #endif
+}
+
+// Decodes the signature in a function's prelude and returns a pointer to its name.
+static const byte *fun_signature(const mp_obj_fun_bc_t *fun, size_t sig[4]) {
+    const byte *ip = fun->bytecode;
+    if (fun->base.type == &mp_type_fun_native) {
+        ip = mp_obj_fun_native_get_prelude_ptr(fun);
+    }
+    size_t n_state, n_exc_stack, n_info, n_cell;
+    MP_BC_PRELUDE_SIG_DECODE_INTO(ip, n_state, n_exc_stack, sig[0], sig[1], sig[2], sig[3]);
+    MP_BC_PRELUDE_SIZE_DECODE_INTO(ip, n_info, n_cell);
+    (void)n_state;
+    (void)n_exc_stack;
+    (void)n_info;
+    (void)n_cell;
+    sig[0] &= MP_SCOPE_FLAG_VARARGS | MP_SCOPE_FLAG_VARKEYWORDS | MP_SCOPE_FLAG_DEFKWARGS | MP_SCOPE_FLAG_GENERATOR;
+    return ip;
+}
+
+// Whether two functions have the same name and arguments.
+static bool same_signature(const mp_obj_fun_bc_t *a, const mp_obj_fun_bc_t *b) {
+    size_t sig_a[4], sig_b[4];
+    const byte *ip_a = fun_signature(a, sig_a);
+    const byte *ip_b = fun_signature(b, sig_b);
+    if (memcmp(sig_a, sig_b, sizeof(sig_a)) != 0) {
+        return false;
+    }
+    // the name, then the argument names
+    for (size_t i = 0; i < 1 + sig_a[1] + sig_a[2]; i++) {
+        if (fun_qstr(a, mp_decode_uint(&ip_a)) != fun_qstr(b, mp_decode_uint(&ip_b))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compiles the function again from its source file, with the native emitter.
+// Returns the native function, or MP_OBJ_NULL if it can't be compiled.
+static mp_obj_t fun_bc_tier_up(mp_obj_fun_bc_t *self) {
+    // Frozen code and .mpy files run in place may not come from the source
+    // file of the same name, if there is one.
+    if (!gc_ptr_on_heap((void *)self->bytecode)) {
+        return MP_OBJ_NULL;
+    }
+
+    // Find the function by its name and the line its body starts on.
+    const byte *ip = self->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    MP_BC_PRELUDE_SIZE_DECODE(ip);
+    const byte *line_info_top = ip + n_info;
+    qstr name = fun_qstr(self, mp_decode_uint(&ip));
+    for (size_t i = 0; i < n_pos_args + n_kwonly_args; i++) {
+        ip = mp_decode_uint_skip(ip);
+    }
+    size_t line = mp_bytecode_get_source_line(ip, line_info_top, 0);
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    qstr source_file = fun_qstr(self, 0);
+    #else
+    qstr source_file = self->context->constants.source_file;
+    #endif
+
+    // Code loaded from a .mpy file has no source key, and code from a file
+    // that has changed since may no longer match.
+    if (!tier_up_source_unchanged(self->context, source_file)) {
+        return MP_OBJ_NULL;
+    }
+
+    mp_obj_t native = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(source_file);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_module_context_t *context = m_new_obj(mp_module_context_t);
+        context->module.globals = self->context->module.globals;
+        mp_raw_code_t *rc = mp_compile_tier_up(&parse_tree, source_file, name, line, context);
+        if (rc != NULL) {
+            mp_obj_t def_args[2] = { MP_OBJ_NULL, MP_OBJ_NULL };
+            if (n_def_pos_args > 0) {
+                def_args[0] = mp_obj_new_tuple(n_def_pos_args, self->extra_args);
+            }
+            if (scope_flags & MP_SCOPE_FLAG_DEFKWARGS) {
+                def_args[1] = self->extra_args[n_def_pos_args];
+            }
+            native = mp_make_function_from_proto_fun(rc, context, def_args);
+            if (!mp_obj_is_type(native, &mp_type_fun_native) || !same_signature(self, MP_OBJ_TO_PTR(native))) {
+                native = MP_OBJ_NULL;
+            }
+        }
+        nlr_pop();
+    } else {
+        tier_up_check_error(&nlr);
+    }
+    // The file may have been written to while it was read.
+    if (native != MP_OBJ_NULL && !tier_up_source_unchanged(self->context, source_file)) {
+        native = MP_OBJ_NULL;
+    }
+    return native;
+}
+#endif
+
 // CIRCUITPY-CHANGE: PLACE_IN_ITCM
 static mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_cstack_check();
@@ -241,6 +406,20 @@ static mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
 
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
 
+    // CIRCUITPY-CHANGE: calls made from the VM without this function, when
+    // MICROPY_STACKLESS is enabled, don't count and stay in bytecode.
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    if (self->tier_up_countdown > 0) {
+        self->tier_up_countdown--;
+    } else if (self->tier_up_countdown == 0 && MP_STATE_VM(tier_up_blocked) == 0) {
+        self->tier_up_countdown = -1;
+        self->tier_up_native = fun_bc_tier_up(self);
+    }
+    if (self->tier_up_native != MP_OBJ_NULL) {
+        return mp_call_function_n_kw(self->tier_up_native, n_args, n_kw, args);
+    }
+    #endif
+
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
 
@@ -388,6 +567,11 @@ mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_
     o->bytecode = code;
     o->context = context;
     o->child_table = child_table;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    o->tier_up_countdown = MICROPY_OPT_NATIVE_TIER_UP_THRESHOLD;
+    o->tier_up_native = MP_OBJ_NULL;
+    #endif
     if (def_pos_args != NULL) {
         memcpy(o->extra_args, def_pos_args->items, n_def_args * sizeof(mp_obj_t));
     }
@@ -37,6 +37,14 @@ typedef struct _mp_obj_fun_bc_t {
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    // calls and loop iterations left until the function is compiled to native
+    // code, or -1 once it has been tried
+    mp_int_t tier_up_countdown;
+    // the native version of the function, which is called instead, if any
+    mp_obj_t tier_up_native;
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
@@ -53,6 +61,13 @@ typedef struct _mp_obj_fun_asm_t {
 mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_module_context_t *cm, struct _mp_raw_code_t *const *raw_code_table);
 void mp_obj_fun_bc_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_NATIVE_TIER_UP
+// Records the size and modification time of the module's source file. Its
+// functions are only compiled again to native code while these are unchanged.
+void mp_obj_fun_bc_tier_up_set_source(mp_module_context_t *context, qstr source_file);
+#endif
+
 #if MICROPY_EMIT_NATIVE
 
 static inline mp_obj_t mp_obj_new_fun_native(const mp_obj_t *def_args, const void *fun_data, const mp_module_context_t *mc, struct _mp_raw_code_t *const *child_table) {
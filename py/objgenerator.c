@@ -25,6 +25,7 @@
  * THE SOFTWARE.
  */
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <assert.h>
 
@@ -204,6 +205,37 @@ static void coro_instance_print(const mp_print_t *print, mp_obj_t self_in, mp_pr
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_GENERATOR_RELEASE_STATE
+// Once a generator has finished only its header is ever looked at again, so shrink it in place.
+static void gen_instance_release_state(mp_obj_gen_instance_t *self) {
+    size_t header_size;
+    size_t state_size;
+    #if MICROPY_EMIT_NATIVE
+    if (self->code_state.exc_sp_idx == MP_CODE_STATE_EXC_SP_IDX_SENTINEL) {
+        const uint8_t *ip = mp_obj_fun_native_get_prelude_ptr(self->code_state.fun_bc);
+        MP_BC_PRELUDE_SIG_DECODE(ip);
+        header_size = offsetof(mp_obj_gen_instance_native_t, code_state.state);
+        state_size = n_state * sizeof(mp_obj_t);
+    } else
+    #endif
+    {
+        const uint8_t *ip = self->code_state.fun_bc->bytecode;
+        MP_BC_PRELUDE_SIG_DECODE(ip);
+        header_size = offsetof(mp_obj_gen_instance_t, code_state.state);
+        state_size = n_state * sizeof(mp_obj_t) + n_exc_stack * sizeof(mp_exc_stack_t);
+    }
+    self->code_state.sp = NULL;
+    // This can't move the object, and if the heap is locked it leaves it as it is.
+    #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
+    m_realloc_maybe(self, header_size + state_size, header_size, false);
+    #else
+    (void)state_size;
+    m_realloc_maybe(self, header_size, false);
+    #endif
+}
+#endif
+
 mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_obj_t throw_value, mp_obj_t *ret_val) {
     mp_cstack_check();
     // CIRCUITPY-CHANGE
@@ -286,6 +318,10 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
             self->code_state.ip = 0;
             // This is an optimised "raise StopIteration(*ret_val)".
             *ret_val = *self->code_state.sp;
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PY_GENERATOR_RELEASE_STATE
+            gen_instance_release_state(self);
+            #endif
             break;
 
         case MP_VM_RETURN_YIELD:
@@ -309,6 +345,10 @@ mp_vm_return_kind_t mp_obj_gen_resume(mp_obj_t self_in, mp_obj_t send_value, mp_
             if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(*ret_val)), MP_OBJ_FROM_PTR(&mp_type_StopIteration))) {
                 *ret_val = mp_obj_new_exception_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("generator raised StopIteration"));
             }
+            // CIRCUITPY-CHANGE
+            #if MICROPY_PY_GENERATOR_RELEASE_STATE
+            gen_instance_release_state(self);
+            #endif
             break;
         }
     }
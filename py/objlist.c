@@ -343,7 +343,245 @@ static void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_LIST_STABLE_SORT
+// A stable merge sort that builds on runs already in order, after Timsort but without galloping.
+// Elements are w objects wide and compare by their first object, so key function results can be
+// sorted along with the items they came from.
+
+#define SORT_MIN_RUN (16)
+// Run lengths grow at least as fast as Fibonacci numbers, so this many covers any list that fits
+// in memory. If it does fill up, the top runs are merged early.
+#define SORT_MAX_RUNS (40)
+
+typedef struct {
+    mp_obj_t *tmp;
+    size_t w;
+    bool reverse;
+    // While merging, rest_len elements at rest are missing from the hole at gap. They are put back
+    // if a comparison raises so the list is still a permutation of what it was.
+    mp_obj_t *gap;
+    mp_obj_t *rest;
+    size_t rest_len;
+} sort_state_t;
+
+static bool sort_lt(sort_state_t *s, const mp_obj_t *a, const mp_obj_t *b) {
+    if (s->reverse) {
+        const mp_obj_t *t = a;
+        a = b;
+        b = t;
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a[0], b[0]));
+}
+
+// Sorts base[0, n) given that base[0, sorted) is already in order.
+static void sort_insertion(sort_state_t *s, mp_obj_t *base, size_t sorted, size_t n) {
+    const size_t w = s->w;
+    for (size_t i = sorted; i < n; i++) {
+        // Insert after any equal elements to keep them in order. Nothing moves until the place is
+        // found, so a comparison that raises leaves everything where it was.
+        size_t lo = 0;
+        size_t hi = i;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (sort_lt(s, base + i * w, base + mid * w)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        mp_obj_t item[2];
+        memcpy(item, base + i * w, w * sizeof(mp_obj_t));
+        memmove(base + (lo + 1) * w, base + lo * w, (i - lo) * w * sizeof(mp_obj_t));
+        memcpy(base + lo * w, item, w * sizeof(mp_obj_t));
+    }
+}
+
+// Returns the length of the run at the start of base[0, n), reversing it first if it descends.
+static size_t sort_count_run(sort_state_t *s, mp_obj_t *base, size_t n) {
+    const size_t w = s->w;
+    if (n < 2) {
+        return n;
+    }
+    size_t len = 2;
+    if (sort_lt(s, base + w, base)) {
+        // Only strictly descending runs are reversed so equal elements stay in order.
+        while (len < n && sort_lt(s, base + len * w, base + (len - 1) * w)) {
+            len++;
+        }
+        for (size_t i = 0, j = len - 1; i < j; i++, j--) {
+            for (size_t k = 0; k < w; k++) {
+                mp_obj_t t = base[i * w + k];
+                base[i * w + k] = base[j * w + k];
+                base[j * w + k] = t;
+            }
+        }
+    } else {
+        while (len < n && !sort_lt(s, base + len * w, base + (len - 1) * w)) {
+            len++;
+        }
+    }
+    return len;
+}
+
+// Merges the sorted runs a[0, na) and a[na, na + nb), copying the shorter one out to tmp.
+static void sort_merge(sort_state_t *s, mp_obj_t *a, size_t na, size_t nb) {
+    const size_t w = s->w;
+    const size_t size = w * sizeof(mp_obj_t);
+    mp_obj_t *b = a + na * w;
+    if (!sort_lt(s, b, b - w)) {
+        // Already in order.
+        return;
+    }
+    if (na <= nb) {
+        // Merge forwards from the front. The hole is always just before the rest of b.
+        mp_obj_t *b_end = b + nb * w;
+        memcpy(s->tmp, a, na * size);
+        s->gap = a;
+        s->rest = s->tmp;
+        s->rest_len = na;
+        while (s->rest_len > 0 && b < b_end) {
+            if (sort_lt(s, b, s->rest)) {
+                memcpy(s->gap, b, size);
+                b += w;
+            } else {
+                memcpy(s->gap, s->rest, size);
+                s->rest += w;
+                s->rest_len--;
+            }
+            s->gap += w;
+        }
+    } else {
+        // Merge backwards from the end. The hole is always just after the rest of a.
+        mp_obj_t *dest = b + (nb - 1) * w;
+        memcpy(s->tmp, b, nb * size);
+        s->gap = b;
+        s->rest = s->tmp;
+        s->rest_len = nb;
+        while (s->rest_len > 0 && s->gap > a) {
+            mp_obj_t *last_b = s->tmp + (s->rest_len - 1) * w;
+            if (sort_lt(s, last_b, s->gap - w)) {
+                s->gap -= w;
+                memcpy(dest, s->gap, size);
+            } else {
+                memcpy(dest, last_b, size);
+                s->rest_len--;
+            }
+            dest -= w;
+        }
+    }
+    memcpy(s->gap, s->rest, s->rest_len * size);
+    s->rest_len = 0;
+}
+
+static void sort_runs(sort_state_t *s, mp_obj_t *base, size_t n) {
+    const size_t w = s->w;
+    size_t run_start[SORT_MAX_RUNS];
+    size_t run_len[SORT_MAX_RUNS];
+    size_t runs = 0;
+
+    #define MERGE_AT(k) do { \
+        sort_merge(s, base + run_start[k] * w, run_len[k], run_len[(k) + 1]); \
+        run_len[k] += run_len[(k) + 1]; \
+        for (size_t r = (k) + 1; r < runs - 1; r++) { \
+            run_start[r] = run_start[r + 1]; \
+            run_len[r] = run_len[r + 1]; \
+        } \
+        runs--; \
+} while (0)
+
+    for (size_t i = 0; i < n;) {
+        size_t len = sort_count_run(s, base + i * w, n - i);
+        if (len < SORT_MIN_RUN) {
+            size_t forced = MIN(SORT_MIN_RUN, n - i);
+            sort_insertion(s, base + i * w, len, forced);
+            len = forced;
+        }
+        if (runs == SORT_MAX_RUNS) {
+            MERGE_AT(runs - 2);
+        }
+        run_start[runs] = i;
+        run_len[runs] = len;
+        runs++;
+        i += len;
+
+        // Keep run lengths decreasing quickly towards the top of the stack so merges stay balanced.
+        while (runs > 1) {
+            size_t k = runs - 2;
+            if ((k > 0 && run_len[k - 1] <= run_len[k] + run_len[k + 1]) ||
+                (k > 1 && run_len[k - 2] <= run_len[k - 1] + run_len[k])) {
+                if (run_len[k - 1] < run_len[k + 1]) {
+                    k--;
+                }
+            } else if (run_len[k] > run_len[k + 1]) {
+                break;
+            }
+            MERGE_AT(k);
+        }
+    }
+    while (runs > 1) {
+        MERGE_AT(runs - 2);
+    }
+    #undef MERGE_AT
+}
+
+// Returns false without changing anything if there isn't enough memory.
+static bool mp_stable_sort(mp_obj_list_t *self, mp_obj_t key_fn, bool reverse) {
+    size_t n = self->len;
+    sort_state_t s = { .w = key_fn == MP_OBJ_NULL ? 1 : 2, .reverse = reverse };
+    // Merges only copy out the shorter run, which is never more than half.
+    size_t tmp_len = n > SORT_MIN_RUN ? (n / 2) * s.w : 0;
+    size_t elements_len = key_fn == MP_OBJ_NULL ? 0 : n * 2;
+    mp_obj_t *elements = self->items;
+    if (elements_len > 0) {
+        elements = m_new_maybe(mp_obj_t, elements_len);
+        if (elements == NULL) {
+            return false;
+        }
+    }
+    if (tmp_len > 0) {
+        s.tmp = m_new_maybe(mp_obj_t, tmp_len);
+        if (s.tmp == NULL) {
+            if (elements_len > 0) {
+                m_del(mp_obj_t, elements, elements_len);
+            }
+            return false;
+        }
+    }
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        if (key_fn != MP_OBJ_NULL) {
+            // Call the key function once per item and sort (key, item) pairs.
+            for (size_t i = 0; i < n; i++) {
+                elements[i * 2] = mp_call_function_1(key_fn, self->items[i]);
+                elements[i * 2 + 1] = self->items[i];
+            }
+        }
+        sort_runs(&s, elements, n);
+        nlr_pop();
+    } else {
+        if (s.rest_len > 0) {
+            memcpy(s.gap, s.rest, s.rest_len * s.w * sizeof(mp_obj_t));
+        }
+        nlr_jump(nlr.ret_val);
+    }
+
+    if (key_fn != MP_OBJ_NULL) {
+        for (size_t i = 0; i < MIN(n, self->len); i++) {
+            self->items[i] = elements[i * 2 + 1];
+        }
+        m_del(mp_obj_t, elements, elements_len);
+    }
+    if (tmp_len > 0) {
+        m_del(mp_obj_t, s.tmp, tmp_len);
+    }
+    return true;
+}
+#endif
+
+// CIRCUITPY-CHANGE: Python defines sort to be stable. Ours is when MICROPY_OPT_LIST_STABLE_SORT
+// is enabled and there is memory for it.
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -362,8 +600,14 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = native_list(pos_args[0]);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
-            args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
+        mp_obj_t key_fn = args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_LIST_STABLE_SORT
+        if (mp_stable_sort(self, key_fn, args.reverse.u_bool)) {
+            return mp_const_none;
+        }
+        #endif
+        mp_quicksort(self->items, self->items + self->len - 1, key_fn,
             args.reverse.u_bool ? mp_const_false : mp_const_true);
     }
 
@@ -315,28 +315,61 @@ wrong_args:
     mp_raise_TypeError(MP_ERROR_TEXT("wrong number of arguments"));
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_FIND_SUBBYTES_HORSPOOL
+// Boyer-Moore-Horspool search, which skips ahead by up to the needle length at each step.
+static const byte *find_subbytes_horspool(const byte *haystack, size_t hlen, const byte *needle, size_t nlen) {
+    // Skips are capped so the table fits in bytes. A shorter skip than possible is still correct.
+    size_t max_skip = MIN(nlen, 255);
+    uint8_t skip[256];
+    memset(skip, max_skip, sizeof(skip));
+    for (size_t i = nlen - max_skip; i < nlen - 1; i++) {
+        skip[needle[i]] = nlen - 1 - i;
+    }
+    const byte last = needle[nlen - 1];
+    const byte *end = haystack + hlen - nlen;
+    for (const byte *p = haystack; p <= end; p += skip[p[nlen - 1]]) {
+        if (p[nlen - 1] == last && memcmp(p, needle, nlen - 1) == 0) {
+            return p;
+        }
+    }
+    return NULL;
+}
+#endif
+
 // like strstr but with specified length and allows \0 bytes
-// TODO replace with something more efficient/standard
 const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle, size_t nlen, int direction) {
     if (hlen >= nlen) {
-        size_t str_index, str_index_end;
-        if (direction > 0) {
-            str_index = 0;
-            str_index_end = hlen - nlen;
-        } else {
-            str_index = hlen - nlen;
-            str_index_end = 0;
+        // CIRCUITPY-CHANGE: Only compare where the first byte matches, and find those with memchr()
+        // when searching forward, instead of comparing the whole needle at every offset.
+        if (nlen == 0) {
+            return direction > 0 ? haystack : haystack + hlen;
         }
-        for (;;) {
-            if (memcmp(&haystack[str_index], needle, nlen) == 0) {
-                // found
-                return haystack + str_index;
+        const byte first = needle[0];
+        if (direction > 0) {
+            #if MICROPY_OPT_FIND_SUBBYTES_HORSPOOL
+            // Building the skip table only pays off for longer needles and haystacks.
+            if (nlen >= 8 && hlen - nlen >= 128) {
+                return find_subbytes_horspool(haystack, hlen, needle, nlen);
             }
-            if (str_index == str_index_end) {
-                // not found
-                break;
+            #endif
+            const byte *p = haystack;
+            const byte *end = haystack + hlen - nlen + 1;
+            while ((p = memchr(p, first, end - p)) != NULL) {
+                if (memcmp(p + 1, needle + 1, nlen - 1) == 0) {
+                    return p;
+                }
+                p++;
+            }
+        } else {
+            for (size_t str_index = hlen - nlen; ; str_index--) {
+                if (haystack[str_index] == first && memcmp(&haystack[str_index + 1], needle + 1, nlen - 1) == 0) {
+                    return haystack + str_index;
+                }
+                if (str_index == 0) {
+                    break;
+                }
             }
-            str_index += direction;
         }
     }
     return NULL;
@@ -83,6 +83,31 @@ static int instance_count_native_bases(const mp_obj_type_t *type, const mp_obj_t
     }
 }
 
+// CIRCUITPY-CHANGE
+// mp_obj_new_type fills in 10 type slots, plus one each for a parent and a base protocol.
+#define INSTANCE_TYPE_NUM_SLOTS(has_parent, has_protocol) (10 + ((has_parent) ? 1 : 0) + ((has_protocol) ? 1 : 0))
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_CLASS_SLOTS
+// A class with a fixed instance layout keeps the names of its instance slots, those of its base
+// first, in a tuple of qstrs after the type slots that mp_obj_new_type fills in.
+static mp_obj_tuple_t *instance_slot_names(const mp_obj_type_t *type) {
+    assert(type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS);
+    size_t index = INSTANCE_TYPE_NUM_SLOTS(MP_OBJ_TYPE_HAS_SLOT(type, parent), MP_OBJ_TYPE_HAS_SLOT(type, protocol));
+    return (mp_obj_tuple_t *)type->slots[index];
+}
+
+mp_obj_t *mp_obj_instance_find_slot(mp_obj_instance_t *self, qstr attr) {
+    const mp_obj_tuple_t *names = instance_slot_names(self->base.type);
+    for (size_t i = 0; i < names->len; i++) {
+        if (names->items[i] == MP_OBJ_NEW_QSTR(attr)) {
+            return &self->subobj[i];
+        }
+    }
+    return NULL;
+}
+#endif
+
 // CIRCUITPY-CHANGE: support superclass constructors that take kw args
 // This wrapper function allows a subclass of a native type to call the
 // __init__() method (corresponding to type->make_new) of the native type.
@@ -119,6 +144,19 @@ static
 mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *class, const mp_obj_type_t **native_base) {
     size_t num_native_bases = instance_count_native_bases(class, native_base);
     assert(num_native_bases < 2);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_CLASS_SLOTS
+    if (class->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+        // The attributes go in subobj, which is free because the class has no native base.
+        size_t num_slots = instance_slot_names(class)->len;
+        mp_obj_instance_t *o = mp_obj_malloc_var(mp_obj_instance_t, subobj, mp_obj_t, num_slots, class);
+        mp_map_init(&o->members, 0);
+        for (size_t i = 0; i < num_slots; i++) {
+            o->subobj[i] = MP_OBJ_NULL;
+        }
+        return o;
+    }
+    #endif
     mp_obj_instance_t *o = mp_obj_malloc_var(mp_obj_instance_t, subobj, mp_obj_t, num_native_bases, class);
     mp_map_init(&o->members, 0);
     // Initialise the native base-class slot (should be 1 at most) with a valid
@@ -161,6 +199,15 @@ struct class_lookup_data {
     size_t slot_offset;
     mp_obj_t *dest;
     bool is_type;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    // Set when the attribute is found in a locals dict, for the type attribute cache.
+    const mp_obj_type_t *found_in;
+    mp_obj_t found;
+    // Set when the attribute was looked up on the native base object, so the result
+    // depends on the instance and can't be cached.
+    bool uncacheable;
+    #endif
 };
 
 static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_type_t *type) {
@@ -190,6 +237,11 @@ static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
             mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map;
             mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(lookup->attr), MP_MAP_LOOKUP);
             if (elem != NULL) {
+                // CIRCUITPY-CHANGE
+                #if MICROPY_OPT_TYPE_ATTR_CACHE
+                lookup->found_in = type;
+                lookup->found = elem->value;
+                #endif
                 if (lookup->is_type) {
                     // If we look up a class method, we need to return original type for which we
                     // do a lookup, not a (base) type in which we found the class method.
@@ -222,6 +274,10 @@ static void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
         // but some attributes of native types may be handled using .load_attr method,
         // so make sure we try to lookup those too.
         if (lookup->obj != NULL && !lookup->is_type && mp_obj_is_native_type(type) && type != &mp_type_object /* object is not a real type */) {
+            // CIRCUITPY-CHANGE
+            #if MICROPY_OPT_TYPE_ATTR_CACHE
+            lookup->uncacheable = true;
+            #endif
             mp_load_method_maybe(lookup->obj->subobj[0], lookup->attr, lookup->dest);
             if (lookup->dest[0] != MP_OBJ_NULL) {
                 return;
@@ -435,6 +491,12 @@ static mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         // TODO: This doesn't count inherited objects (self->subobj)
         const mp_obj_type_t *native_base;
         size_t num_native_bases = instance_count_native_bases(mp_obj_get_type(self_in), &native_base);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PY_CLASS_SLOTS
+        if (self->base.type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+            num_native_bases = instance_slot_names(self->base.type)->len;
+        }
+        #endif
 
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
             + sizeof(*self->members.table) * self->members.alloc;
@@ -609,12 +671,65 @@ static mp_obj_t instance_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t
     return res;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_TYPE_ATTR_CACHE
+static mp_type_attr_cache_entry_t *type_attr_cache_entry(const mp_obj_type_t *type, qstr attr) {
+    return &MP_STATE_VM(type_attr_cache)[(((uintptr_t)type >> 2) ^ attr) % MICROPY_OPT_TYPE_ATTR_CACHE_SIZE];
+}
+
+// Called before any class is created or modified. A new class may reuse the
+// memory of one that was collected, so creating one must invalidate too. Class
+// attributes can only change through type_attr: mp_obj_new_type copies the dict
+// the class is made from, and __dict__ returns a read-only copy. Code that
+// stores into a class's locals_dict directly must call this first.
+static void type_attr_cache_invalidate(void) {
+    if (++MP_STATE_VM(type_attr_cache_version) == 0) {
+        // Don't let entries from before the version wrapped become valid again.
+        memset(MP_STATE_VM(type_attr_cache), 0, sizeof(MP_STATE_VM(type_attr_cache)));
+    }
+}
+
+// Looks up attr in the class of self like mp_obj_class_lookup, remembering where
+// it was found so the search of the class and its bases can be skipped next time.
+static void instance_class_lookup_cached(struct class_lookup_data *lookup) {
+    const mp_obj_type_t *type = lookup->obj->base.type;
+    mp_type_attr_cache_entry_t *entry = type_attr_cache_entry(type, lookup->attr);
+    if (entry->type == type && entry->attr == lookup->attr
+        && entry->version == MP_STATE_VM(type_attr_cache_version)) {
+        if (mp_obj_is_type(entry->value, &mp_type_property)) {
+            lookup->dest[0] = entry->value;
+        } else {
+            mp_convert_member_lookup(MP_OBJ_FROM_PTR(lookup->obj), entry->found_in, entry->value, lookup->dest);
+        }
+        return;
+    }
+    mp_obj_class_lookup(lookup, type);
+    if (lookup->found != MP_OBJ_NULL && !lookup->uncacheable) {
+        entry->type = type;
+        entry->found_in = lookup->found_in;
+        entry->value = lookup->found;
+        entry->version = MP_STATE_VM(type_attr_cache_version);
+        entry->attr = lookup->attr;
+    }
+}
+#endif
+
 static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     // logic: look in instance members then class locals
     assert(mp_obj_is_instance_type(mp_obj_get_type(self_in)));
     mp_obj_instance_t *self = MP_OBJ_TO_PTR(self_in);
 
     // Note: This is fast-path'ed in the VM for the MP_BC_LOAD_ATTR operation.
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_CLASS_SLOTS
+    if (self->base.type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+        mp_obj_t *slot = mp_obj_instance_find_slot(self, attr);
+        if (slot != NULL && *slot != MP_OBJ_NULL) {
+            dest[0] = *slot;
+            return;
+        }
+    }
+    #endif
     mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
     if (elem != NULL) {
         // object member, always treated as a value
@@ -622,7 +737,8 @@ static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         return;
     }
     #if MICROPY_CPYTHON_COMPAT
-    if (attr == MP_QSTR___dict__) {
+    // CIRCUITPY-CHANGE: instances with slots have no __dict__
+    if (attr == MP_QSTR___dict__ && !(self->base.type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS)) {
         // Create a new dict with a copy of the instance's map items.
         // This creates, unlike CPython, a read-only __dict__ that can't be modified.
         mp_obj_dict_t dict;
@@ -641,7 +757,12 @@ static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         .dest = dest,
         .is_type = false,
     };
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    instance_class_lookup_cached(&lookup);
+    #else
     mp_obj_class_lookup(&lookup, self->base.type);
+    #endif
     mp_obj_t member = dest[0];
     if (member != MP_OBJ_NULL) {
         if (!(self->base.type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
@@ -830,6 +951,19 @@ static bool mp_obj_instance_store_attr(mp_obj_t self_in, qstr attr, mp_obj_t val
 
 skip_special_accessors:
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_CLASS_SLOTS
+    if (self->base.type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+        // Only the attributes named in __slots__ can be stored or deleted.
+        mp_obj_t *slot = mp_obj_instance_find_slot(self, attr);
+        if (slot == NULL || (value == MP_OBJ_NULL && *slot == MP_OBJ_NULL)) {
+            return false;
+        }
+        *slot = value;
+        return true;
+    }
+    #endif
+
     if (value == MP_OBJ_NULL) {
         // delete attribute
         mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -1113,6 +1247,11 @@ static void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     } else {
         // delete/store attribute
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_TYPE_ATTR_CACHE
+        type_attr_cache_invalidate();
+        #endif
+
         if (MP_OBJ_TYPE_HAS_SLOT(self, locals_dict)) {
             assert(mp_obj_is_dict_or_ordereddict(MP_OBJ_FROM_PTR(MP_OBJ_TYPE_GET_SLOT(self, locals_dict)))); // MicroPython restriction, for now
             mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(self, locals_dict)->map;
@@ -1159,6 +1298,47 @@ MP_DEFINE_CONST_OBJ_TYPE(
     attr, type_attr
     );
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_CLASS_SLOTS
+// Returns a tuple of the names of the instance slots for a class with __slots__, or
+// MP_OBJ_NULL if its instances need a members map. As in CPython, they do when __slots__
+// names __dict__, and here also when a base doesn't have a fixed layout itself.
+static mp_obj_t class_slot_names(size_t bases_len, const mp_obj_t *bases_items, mp_obj_dict_t *locals) {
+    mp_map_elem_t *elem = mp_map_lookup(&locals->map, MP_OBJ_NEW_QSTR(MP_QSTR___slots__), MP_MAP_LOOKUP);
+    if (elem == NULL || bases_len > 1) {
+        return MP_OBJ_NULL;
+    }
+    const mp_obj_tuple_t *base_names = &mp_const_empty_tuple_obj;
+    if (bases_len == 1) {
+        const mp_obj_type_t *base = MP_OBJ_TO_PTR(bases_items[0]);
+        if (base->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+            base_names = instance_slot_names(base);
+        } else if (base != &mp_type_object) {
+            return MP_OBJ_NULL;
+        }
+    }
+    mp_obj_t names = mp_obj_new_list(base_names->len, (mp_obj_t *)base_names->items);
+    mp_obj_t own_names = elem->value;
+    if (mp_obj_is_str(own_names)) {
+        own_names = mp_obj_new_tuple(1, &own_names);
+    }
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(own_names, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        qstr attr = mp_obj_str_get_qstr(mp_arg_validate_type_string(item, MP_QSTR___slots__));
+        if (attr == MP_QSTR___dict__) {
+            return MP_OBJ_NULL;
+        }
+        mp_obj_list_append(names, MP_OBJ_NEW_QSTR(attr));
+    }
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_list_get(names, &len, &items);
+    return mp_obj_new_tuple(len, items);
+}
+#endif
+
 mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict) {
     // Verify input objects have expected type
     if (!mp_obj_is_type(bases_tuple, &mp_type_tuple)) {
@@ -1168,7 +1348,16 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
         mp_raise_TypeError(NULL);
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    type_attr_cache_invalidate();
+    // Copy the dict like CPython does. The one passed in is still reachable, from type() or
+    // from locals() in the class body, and changing it must not change the class behind the
+    // type attribute cache.
+    locals_dict = mp_obj_dict_copy(locals_dict);
+    #else
     // TODO might need to make a copy of locals_dict; at least that's how CPython does it
+    #endif
 
     // Basic validation of base classes
     uint16_t base_flags = MP_TYPE_FLAG_EQ_NOT_REFLEXIVE
@@ -1211,13 +1400,28 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
         base_protocol = MP_OBJ_TYPE_GET_SLOT_OR_NULL(((mp_obj_type_t *)MP_OBJ_TO_PTR(bases_items[0])), protocol);
     }
 
+    mp_obj_dict_t *locals_ptr = MP_OBJ_TO_PTR(locals_dict);
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_CLASS_SLOTS
+    mp_obj_t slot_names = class_slot_names(bases_len, bases_items, locals_ptr);
+    #else
+    const mp_obj_t slot_names = MP_OBJ_NULL;
+    #endif
+
     // Allocate a variable-sized mp_obj_type_t with as many slots as we need
     // (currently 10, plus 1 for base, plus 1 for base-protocol).
     // Note: mp_obj_type_t is (2 + 3 + #slots) words, so going from 11 to 12 slots
     // moves from 4 to 5 gc blocks.
-    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, 10 + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
+    // CIRCUITPY-CHANGE: plus 1 for the names of the instance slots
+    size_t num_slots = INSTANCE_TYPE_NUM_SLOTS(bases_len, base_protocol);
+    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, num_slots + (slot_names != MP_OBJ_NULL ? 1 : 0));
     o->base.type = &mp_type_type;
     o->flags = base_flags;
+    if (slot_names != MP_OBJ_NULL) {
+        o->flags |= MP_TYPE_FLAG_HAS_INSTANCE_SLOTS;
+        o->slots[num_slots] = MP_OBJ_TO_PTR(slot_names);
+    }
     o->name = name;
     MP_OBJ_TYPE_SET_SLOT(o, make_new, mp_obj_instance_make_new, 0);
     MP_OBJ_TYPE_SET_SLOT(o, print, instance_print, 1);
@@ -1229,7 +1433,6 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     MP_OBJ_TYPE_SET_SLOT(o, iter, mp_obj_instance_getiter, 7);
     MP_OBJ_TYPE_SET_SLOT(o, buffer, instance_get_buffer, 8);
 
-    mp_obj_dict_t *locals_ptr = MP_OBJ_TO_PTR(locals_dict);
     MP_OBJ_TYPE_SET_SLOT(o, locals_dict, locals_ptr, 9);
 
     if (bases_len > 0) {
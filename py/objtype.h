@@ -55,4 +55,12 @@ mp_obj_t mp_obj_instance_getiter(mp_obj_t self_in, mp_obj_iter_buf_t *iter_buf);
 // CIRCUITPY-CHANGE: addition
 void mp_obj_assert_native_inited(mp_obj_t native_object);
 
+// CIRCUITPY-CHANGE: addition
+#if MICROPY_PY_CLASS_SLOTS
+// For an instance of a class with MP_TYPE_FLAG_HAS_INSTANCE_SLOTS, returns the
+// slot holding attr, or NULL if __slots__ doesn't name it. An unset slot holds
+// MP_OBJ_NULL.
+mp_obj_t *mp_obj_instance_find_slot(mp_obj_instance_t *self, qstr attr);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJTYPE_H
@@ -240,6 +240,12 @@ typedef struct _parser_t {
     #if MICROPY_COMP_CONST
     mp_map_t consts;
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    // bytes of parse nodes allocated since the last batch was handed over
+    size_t batch_bytes;
+    #endif
 } parser_t;
 
 static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t num_args);
@@ -294,10 +300,29 @@ static void *parser_alloc(parser_t *parser, size_t num_bytes) {
 
     byte *ret = chunk->data + chunk->union_.used;
     chunk->union_.used += num_bytes;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    parser->batch_bytes += num_bytes;
+    #endif
     return ret;
 }
 #pragma GCC diagnostic pop
 
+// CIRCUITPY-CHANGE: factored out of mp_parse
+static void parser_link_final_chunk(parser_t *parser) {
+    // truncate final chunk and link into chain of chunks
+    if (parser->cur_chunk != NULL) {
+        (void)m_renew_maybe(byte, parser->cur_chunk,
+            sizeof(mp_parse_chunk_t) + parser->cur_chunk->alloc,
+            sizeof(mp_parse_chunk_t) + parser->cur_chunk->union_.used,
+            false);
+        parser->cur_chunk->alloc = parser->cur_chunk->union_.used;
+        parser->cur_chunk->union_.next = parser->tree.chunk;
+        parser->tree.chunk = parser->cur_chunk;
+        parser->cur_chunk = NULL;
+    }
+}
+
 #if MICROPY_COMP_CONST_TUPLE
 static void parser_free_parse_node_struct(parser_t *parser, mp_parse_node_struct_t *pns) {
     mp_parse_chunk_t *chunk = parser->cur_chunk;
@@ -639,6 +664,62 @@ static void push_result_token(parser_t *parser, uint8_t rule_id) {
 
 #if MICROPY_COMP_CONST_FOLDING
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_CONST_DICT
+// Builds a read-only dict from a dict display whose keys and values are all constants, or
+// returns false if pn is anything else. Values may be such dicts too.
+static bool const_dict_from_node(mp_parse_node_t pn, mp_obj_t *dict_out) {
+    if (!MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_atom_brace)) {
+        return false;
+    }
+    mp_parse_node_t pn_items = ((mp_parse_node_struct_t *)pn)->nodes[0];
+    mp_parse_node_t first = pn_items;
+    mp_parse_node_t *rest = NULL;
+    size_t num_rest = 0;
+    if (MP_PARSE_NODE_IS_STRUCT_KIND(pn_items, RULE_dictorsetmaker)) {
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)pn_items;
+        if (!MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], RULE_dictorsetmaker_list)) {
+            // A comprehension.
+            return false;
+        }
+        first = pns->nodes[0];
+        num_rest = mp_parse_node_extract_list(&((mp_parse_node_struct_t *)pns->nodes[1])->nodes[0],
+            RULE_dictorsetmaker_list2, &rest);
+    }
+    size_t num_items = MP_PARSE_NODE_IS_NULL(first) ? 0 : 1 + num_rest;
+
+    // Check everything before building anything.
+    for (size_t i = 0; i < num_items; i++) {
+        mp_parse_node_t item = i == 0 ? first : rest[i - 1];
+        if (!MP_PARSE_NODE_IS_STRUCT_KIND(item, RULE_dictorsetmaker_item)) {
+            // A set.
+            return false;
+        }
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)item;
+        if (!mp_parse_node_is_const(pns->nodes[0])
+            || !(mp_parse_node_is_const(pns->nodes[1])
+                 || MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], RULE_atom_brace))) {
+            return false;
+        }
+    }
+
+    mp_obj_t dict = mp_obj_new_dict(num_items);
+    for (size_t i = 0; i < num_items; i++) {
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t *)(i == 0 ? first : rest[i - 1]);
+        mp_obj_t value;
+        if (mp_parse_node_is_const(pns->nodes[1])) {
+            value = mp_parse_node_convert_to_obj(pns->nodes[1]);
+        } else if (!const_dict_from_node(pns->nodes[1], &value)) {
+            return false;
+        }
+        mp_obj_dict_store(dict, mp_parse_node_convert_to_obj(pns->nodes[0]), value);
+    }
+    ((mp_obj_dict_t *)MP_OBJ_TO_PTR(dict))->map.is_fixed = 1;
+    *dict_out = dict;
+    return true;
+}
+#endif
+
 #if MICROPY_COMP_MODULE_CONST
 static const mp_rom_map_elem_t mp_constants_table[] = {
     #if MICROPY_PY_ERRNO
@@ -817,14 +898,23 @@ static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
 
                 // get the value
                 mp_parse_node_t pn_value = ((mp_parse_node_struct_t *)((mp_parse_node_struct_t *)pn1)->nodes[1])->nodes[0];
-                if (!mp_parse_node_is_const(pn_value)) {
-                    mp_obj_t exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
-                        MP_ERROR_TEXT("not a constant"));
-                    mp_obj_exception_add_traceback(exc, parser->lexer->source_name,
-                        ((mp_parse_node_struct_t *)pn1)->source_line, MP_QSTRnull);
-                    nlr_raise(exc);
+                mp_obj_t value;
+                // CIRCUITPY-CHANGE: dicts of constants become read-only dicts
+                #if MICROPY_COMP_CONST_DICT
+                if (const_dict_from_node(pn_value, &value)) {
+                    pn_value = make_node_const_object(parser, ((mp_parse_node_struct_t *)pn1)->source_line, value);
+                } else
+                #endif
+                {
+                    if (!mp_parse_node_is_const(pn_value)) {
+                        mp_obj_t exc = mp_obj_new_exception_msg(&mp_type_SyntaxError,
+                            MP_ERROR_TEXT("not a constant"));
+                        mp_obj_exception_add_traceback(exc, parser->lexer->source_name,
+                            ((mp_parse_node_struct_t *)pn1)->source_line, MP_QSTRnull);
+                        nlr_raise(exc);
+                    }
+                    value = mp_parse_node_convert_to_obj(pn_value);
                 }
-                mp_obj_t value = mp_parse_node_convert_to_obj(pn_value);
 
                 // store the value in the table of dynamic constants
                 mp_map_elem_t *elem = mp_map_lookup(&parser->consts, MP_OBJ_NEW_QSTR(id), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
@@ -1022,7 +1112,31 @@ static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
-mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+#if MICROPY_ENABLE_DOC_STRING
+// The first statement of every batch would be taken as the module's doc string.
+#error MICROPY_COMP_STREAMING requires MICROPY_ENABLE_DOC_STRING to be disabled
+#endif
+
+// Hands the statements parsed so far, the top num_args results, to the handler.
+static void parser_hand_over_batch(parser_t *parser, size_t src_line, size_t num_args,
+    mp_parse_batch_handler_t handler, void *env) {
+    if (num_args > 1) {
+        push_result_rule(parser, src_line, RULE_file_input_2, num_args);
+    }
+    parser_link_final_chunk(parser);
+    mp_parse_tree_t tree = parser->tree;
+    tree.root = pop_result(parser);
+    parser->tree.chunk = NULL;
+    parser->batch_bytes = 0;
+    handler(env, &tree);
+}
+#endif
+
+// CIRCUITPY-CHANGE: handler is NULL unless parsing in batches
+static mp_parse_tree_t parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind,
+    mp_parse_batch_handler_t handler, void *env) {
     // Set exception handler to free the lexer if an exception is raised.
     MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
     nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
@@ -1069,6 +1183,14 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_init(&parser.consts, 0);
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    parser.batch_bytes = 0;
+    #else
+    (void)handler;
+    (void)env;
+    #endif
+
     // work out the top-level rule to use, and push it on the stack
     size_t top_level_rule;
     switch (input_kind) {
@@ -1255,6 +1377,16 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
             default: {
                 assert((rule_act & RULE_ACT_KIND_MASK) == RULE_ACT_LIST);
 
+                // CIRCUITPY-CHANGE: compile the top-level statements parsed so far once
+                // their parse tree is large enough, and carry on with an empty list
+                #if MICROPY_COMP_STREAMING
+                if (handler != NULL && rule_id == RULE_file_input_2 && i > 0 && !backtrack
+                    && parser.batch_bytes >= MICROPY_COMP_STREAMING_BATCH) {
+                    parser_hand_over_batch(&parser, rule_src_line, i, handler, env);
+                    i = 0;
+                }
+                #endif
+
                 // n=2 is: item item*
                 // n=1 is: item (sep item)*
                 // n=3 is: item (sep item)* [sep]
@@ -1345,16 +1477,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_deinit(&parser.consts);
     #endif
 
-    // truncate final chunk and link into chain of chunks
-    if (parser.cur_chunk != NULL) {
-        (void)m_renew_maybe(byte, parser.cur_chunk,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->alloc,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->union_.used,
-            false);
-        parser.cur_chunk->alloc = parser.cur_chunk->union_.used;
-        parser.cur_chunk->union_.next = parser.tree.chunk;
-        parser.tree.chunk = parser.cur_chunk;
-    }
+    // CIRCUITPY-CHANGE: factored out
+    parser_link_final_chunk(&parser);
 
     if (
         lex->tok_kind != MP_TOKEN_END // check we are at the end of the token stream
@@ -1397,6 +1521,19 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     return parser.tree;
 }
 
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    return parse(lex, input_kind, NULL, NULL);
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+void mp_parse_file_in_batches(mp_lexer_t *lex, mp_parse_batch_handler_t handler, void *env) {
+    // the statements after the last full batch
+    mp_parse_tree_t tree = parse(lex, MP_PARSE_FILE_INPUT, handler, env);
+    handler(env, &tree);
+}
+#endif
+
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
@@ -113,4 +113,15 @@ typedef struct _mp_parse_t {
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
+// CIRCUITPY-CHANGE
+// Called with each batch of top-level statements of a file as it is parsed.
+// The handler must clear the tree before it returns.
+typedef void (*mp_parse_batch_handler_t)(void *env, mp_parse_tree_t *tree);
+
+#if MICROPY_COMP_STREAMING
+// like mp_parse with MP_PARSE_FILE_INPUT, but passes the tree to the handler in
+// batches of statements instead of returning it
+void mp_parse_file_in_batches(struct _mp_lexer_t *lex, mp_parse_batch_handler_t handler, void *env);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PARSE_H
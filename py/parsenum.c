@@ -31,6 +31,8 @@
 #include "py/parsenumbase.h"
 #include "py/parsenum.h"
 #include "py/smallint.h"
+// CIRCUITPY-CHANGE
+#include "py/mpz.h"
 
 #if MICROPY_PY_BUILTINS_FLOAT
 #include <math.h>
@@ -215,6 +217,131 @@ static void accept_digit(mp_float_t *p_dec_val, int dig, int *p_exp_extra, int i
         }
     }
 }
+
+// CIRCUITPY-CHANGE
+// With shortest float repr, every digit printed matters, so values that can't
+// be computed exactly in floating point are checked against the decimal input
+// with big integers and moved to the correctly rounded float.
+#if MICROPY_FLOAT_SHORTEST_REPR && MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_MPZ
+#define PARSE_FLOAT_EXACT (1)
+
+// Decimal exponents beyond which a value is certainly inf or 0.
+#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT
+#define EXACT_MAX_EXP (40)
+#define EXACT_MIN_EXP (-47)
+#else
+#define EXACT_MAX_EXP (310)
+#define EXACT_MIN_EXP (-326)
+#endif
+
+// The exponent of the lowest bit of a subnormal.
+#define EXACT_MIN_BIN_EXP (1 - MP_FLOAT_EXP_OFFSET - MP_FLOAT_FRAC_BITS)
+
+// Compares d * 10^e10 with n * 2^e2.
+static int exact_cmp(const mpz_t *d, int e10, mp_float_uint_t n, int e2) {
+    mpz_t lhs, rhs, ten;
+    mpz_init_zero(&lhs);
+    mpz_init_zero(&rhs);
+    mpz_init_from_int(&ten, 10);
+    mpz_set(&lhs, d);
+    mpz_set_from_ll(&rhs, n, false);
+    mpz_t *scaled = e10 >= 0 ? &lhs : &rhs;
+    mpz_t pow;
+    mpz_init_from_int(&pow, e10 >= 0 ? e10 : -e10);
+    mpz_pow_inpl(&pow, &ten, &pow);
+    mpz_mul_inpl(scaled, scaled, &pow);
+    if (e2 >= 0) {
+        mpz_shl_inpl(&rhs, &rhs, e2);
+    } else {
+        mpz_shl_inpl(&lhs, &lhs, -e2);
+    }
+    int cmp = mpz_cmp(&lhs, &rhs);
+    mpz_deinit(&pow);
+    mpz_deinit(&ten);
+    mpz_deinit(&rhs);
+    mpz_deinit(&lhs);
+    return cmp;
+}
+
+static void exact_append_digits(mpz_t *d, mpz_t *temp, mp_int_t digits, mp_int_t scale) {
+    mpz_set_from_int(temp, scale);
+    mpz_mul_inpl(d, d, temp);
+    mpz_set_from_int(temp, digits);
+    mpz_add_inpl(d, d, temp);
+}
+
+mp_float_t mp_parse_float_nearest(mp_float_t approx, const char *str, size_t len, int exp10) {
+    const char *top = str + len;
+    mpz_t d, temp;
+    mpz_init_zero(&d);
+    mpz_init_zero(&temp);
+    // Collect the digits nine at a time.
+    mp_int_t digits = 0;
+    mp_int_t scale = 1;
+    int num_digits = 0;
+    bool in_frac = false;
+    for (; str < top && (*str | 0x20) != 'e'; str++) {
+        if (*str == '.') {
+            in_frac = true;
+        } else if ('0' <= *str && *str <= '9') {
+            digits = digits * 10 + (*str - '0');
+            scale *= 10;
+            num_digits += num_digits > 0 || *str != '0';
+            exp10 -= in_frac;
+            if (scale == 1000000000) {
+                exact_append_digits(&d, &temp, digits, scale);
+                digits = 0;
+                scale = 1;
+            }
+        }
+    }
+    exact_append_digits(&d, &temp, digits, scale);
+
+    mp_float_union_t u = {approx};
+    if (num_digits == 0 || exp10 + num_digits > EXACT_MAX_EXP || exp10 + num_digits < EXACT_MIN_EXP) {
+        // Nothing to correct, and the powers of ten could be huge.
+        goto done;
+    }
+    if (isinf(approx)) {
+        // Start from the largest float in case the value rounds down to it.
+        u.i -= 1;
+    }
+    // Each step moves one ulp towards the value, so this only loops a few times.
+    for (int i = 0; i < 8 && !isinf(u.f); i++) {
+        mp_float_uint_t m = u.p.frc;
+        int e2 = EXACT_MIN_BIN_EXP;
+        if (u.p.exp != 0) {
+            m |= (mp_float_uint_t)1 << MP_FLOAT_FRAC_BITS;
+            e2 += u.p.exp - 1;
+        }
+        // Ties round to even.
+        int cmp = exact_cmp(&d, exp10, 2 * m + 1, e2 - 1);
+        if (cmp > 0 || (cmp == 0 && (m & 1))) {
+            u.i += 1;
+            continue;
+        }
+        if (m == 0) {
+            break;
+        }
+        if (u.p.frc == 0 && u.p.exp > 1) {
+            // The float below is closer at a power of two.
+            cmp = exact_cmp(&d, exp10, 4 * m - 1, e2 - 2);
+        } else {
+            cmp = exact_cmp(&d, exp10, 2 * m - 1, e2 - 1);
+        }
+        if (cmp < 0 || (cmp == 0 && (m & 1))) {
+            u.i -= 1;
+            continue;
+        }
+        break;
+    }
+done:
+    mpz_deinit(&temp);
+    mpz_deinit(&d);
+    return u.f;
+}
+#endif
+
 #endif // MICROPY_PY_BUILTINS_FLOAT
 
 #if MICROPY_PY_BUILTINS_COMPLEX
@@ -339,8 +466,19 @@ parse_start:
             exp_val = -exp_val;
         }
 
+        // CIRCUITPY-CHANGE
+        #if PARSE_FLOAT_EXACT
+        int exp10 = exp_val;
+        #endif
+
         // apply the exponent, making sure it's not a subnormal value
         exp_val += exp_extra + trailing_zeros_intg;
+
+        #if PARSE_FLOAT_EXACT
+        // Digits that fit the significand and an exact power of ten round only once below.
+        bool rounded_once = dec_val <= (mp_float_t)((mp_float_uint_t)1 << (MP_FLOAT_FRAC_BITS + 1))
+            && exp_val >= -EXACT_POWER_OF_10 && exp_val <= EXACT_POWER_OF_10;
+        #endif
         if (exp_val < SMALL_NORMAL_EXP) {
             exp_val -= SMALL_NORMAL_EXP;
             dec_val *= SMALL_NORMAL_VAL;
@@ -356,6 +494,12 @@ parse_start:
         } else {
             dec_val *= MICROPY_FLOAT_C_FUN(pow)(10, exp_val);
         }
+
+        #if PARSE_FLOAT_EXACT
+        if (!rounded_once) {
+            dec_val = mp_parse_float_nearest(dec_val, str_val_start, str - str_val_start, exp10);
+        }
+        #endif
     }
 
     if (allow_imag && str < top && (*str | 0x20) == 'j') {
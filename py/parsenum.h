@@ -48,4 +48,11 @@ static inline mp_obj_t mp_parse_num_complex(const char *str, size_t len, mp_lexe
 mp_obj_t mp_parse_num_float(const char *str, size_t len, bool allow_imag, mp_lexer_t *lex);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_BUILTINS_FLOAT && MICROPY_FLOAT_SHORTEST_REPR && MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_MPZ
+// Returns the float nearest the decimal digits in str times 10^exp10, starting from the
+// estimate approx, which must be within a few ulp. The digits may include a decimal point.
+mp_float_t mp_parse_float_nearest(mp_float_t approx, const char *str, size_t len, int exp10);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_PARSENUM_H
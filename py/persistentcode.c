@@ -188,6 +188,13 @@ static qstr load_qstr(mp_reader_t *reader) {
         return len >> 1;
     }
     len >>= 1;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+    const char *rom_str = (const char *)mp_reader_try_read_rom(reader, len + 1);
+    if (rom_str != NULL) {
+        return qstr_from_strn(rom_str, len);
+    }
+    #endif
     char *str = m_new(char, len);
     read_bytes(reader, (byte *)str, len);
     read_byte(reader); // read and discard null terminator
@@ -222,7 +229,32 @@ static mp_obj_t load_obj(mp_reader_t *reader) {
                 tuple->items[i] = load_obj(reader);
             }
             return MP_OBJ_FROM_PTR(tuple);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_COMP_CONST_DICT
+        } else if (obj_type == MP_PERSISTENT_OBJ_DICT) {
+            mp_obj_t dict = mp_obj_new_dict(len);
+            for (size_t i = 0; i < len; ++i) {
+                mp_obj_t key = load_obj(reader);
+                mp_obj_dict_store(dict, key, load_obj(reader));
+            }
+            ((mp_obj_dict_t *)MP_OBJ_TO_PTR(dict))->map.is_fixed = 1;
+            return dict;
+        #endif
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+        if (obj_type == MP_PERSISTENT_OBJ_STR || obj_type == MP_PERSISTENT_OBJ_BYTES) {
+            // The data is followed by a null terminator, like heap strings.
+            const byte *data = mp_reader_try_read_rom(reader, len + 1);
+            if (data != NULL) {
+                mp_obj_str_t *o = MP_OBJ_TO_PTR(mp_obj_new_str_copy(
+                    obj_type == MP_PERSISTENT_OBJ_STR ? &mp_type_str : &mp_type_bytes, NULL, len));
+                o->data = data;
+                o->hash = qstr_compute_hash(data, len);
+                return MP_OBJ_FROM_PTR(o);
+            }
+        }
+        #endif
         vstr_t vstr;
         vstr_init_len(&vstr, len);
         read_bytes(reader, (byte *)vstr.buf, len);
@@ -264,10 +296,17 @@ static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
-        // Allocate memory for the bytecode
-        fun_data = m_new(uint8_t, fun_data_len);
-        // Load bytecode
-        read_bytes(reader, fun_data, fun_data_len);
+        // CIRCUITPY-CHANGE: Run bytecode in place from read-only memory.
+        #if MICROPY_PERSISTENT_CODE_LOAD_ROM
+        fun_data = (uint8_t *)mp_reader_try_read_rom(reader, fun_data_len);
+        if (fun_data == NULL)
+        #endif
+        {
+            // Allocate memory for the bytecode
+            fun_data = m_new(uint8_t, fun_data_len);
+            // Load bytecode
+            read_bytes(reader, fun_data, fun_data_len);
+        }
 
     #if MICROPY_EMIT_MACHINE_CODE
     } else {
@@ -421,6 +460,17 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
         || header[3] > MP_SMALL_INT_BITS) {
         mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
     }
+    // CIRCUITPY-CHANGE
+    #if !MICROPY_OPT_FUSED_BYTECODE
+    if (arch == MP_NATIVE_ARCH_NONE && (header[2] & MPY_FEATURE_FUSED_BYTECODE)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    #endif
+    #if !MICROPY_COMP_CONST_DICT
+    if (arch == MP_NATIVE_ARCH_NONE && (header[2] & MPY_FEATURE_CONST_DICT)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    #endif
     if (MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE) {
         if (!MPY_FEATURE_ARCH_TEST(arch)) {
             if (MPY_FEATURE_ARCH_TEST(MP_NATIVE_ARCH_NONE)) {
@@ -436,6 +486,11 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
     size_t n_qstr = read_uint(reader);
     size_t n_obj = read_uint(reader);
     mp_module_context_alloc_tables(cm->context, n_qstr, n_obj);
+    // CIRCUITPY-CHANGE: there is no source to compile the functions from
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    cm->context->source_size = 0;
+    cm->context->source_mtime = 0;
+    #endif
 
     // Load qstrs.
     for (size_t i = 0; i < n_qstr; ++i) {
@@ -551,6 +606,20 @@ static void save_obj(mp_print_t *print, mp_obj_t o) {
         for (size_t i = 0; i < len; ++i) {
             save_obj(print, items[i]);
         }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_CONST_DICT
+    } else if (mp_obj_is_exact_type(o, &mp_type_dict)) {
+        mp_map_t *map = mp_obj_dict_get_map(o);
+        byte obj_type = MP_PERSISTENT_OBJ_DICT;
+        mp_print_bytes(print, &obj_type, 1);
+        mp_print_uint(print, map->used);
+        for (size_t i = 0; i < map->alloc; ++i) {
+            if (mp_map_slot_is_filled(map, i)) {
+                save_obj(print, map->table[i].key);
+                save_obj(print, map->table[i].value);
+            }
+        }
+    #endif
     } else {
         // we save numbers using a simplistic text representation
         // TODO could be improved
@@ -609,7 +678,43 @@ static void save_raw_code(mp_print_t *print, const mp_raw_code_t *rc) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_CONST_DICT
+static bool obj_has_const_dict(mp_obj_t o) {
+    if (mp_obj_is_exact_type(o, &mp_type_dict)) {
+        return true;
+    }
+    if (mp_obj_is_type(o, &mp_type_tuple)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(o, &len, &items);
+        for (size_t i = 0; i < len; ++i) {
+            if (obj_has_const_dict(items[i])) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#endif
+
 void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
+    // CIRCUITPY-CHANGE: mark bytecode that only loads with MICROPY_OPT_FUSED_BYTECODE
+    byte features = MICROPY_OPT_FUSED_BYTECODE * MPY_FEATURE_FUSED_BYTECODE;
+    #if MICROPY_COMP_CONST_DICT
+    // Files with const() dicts are marked so VMs that can't load them reject them. Native
+    // files use these bits for the sub-version, so they can't be marked.
+    for (size_t i = 0; i < cm->n_obj; ++i) {
+        if (obj_has_const_dict(cm->context->constants.obj_table[i])) {
+            if (cm->has_native) {
+                mp_raise_ValueError(MP_ERROR_TEXT("can't save const dict with native code"));
+            }
+            features |= MPY_FEATURE_CONST_DICT;
+            break;
+        }
+    }
+    #endif
+
     // header contains:
     // CIRCUITPY-CHANGE
     //  byte  'C' (CIRCUITPY)
@@ -619,7 +724,8 @@ void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
     byte header[4] = {
         'C',
         MPY_VERSION,
-        cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0,
+        // CIRCUITPY-CHANGE
+        cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : features,
         #if MICROPY_DYNAMIC_COMPILER
         mp_dynamic_compiler.small_int_bits,
         #else
@@ -47,6 +47,12 @@
 #define MPY_FEATURE_ENCODE_ARCH(arch) ((arch) << 2)
 #define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
 
+// CIRCUITPY-CHANGE: a bytecode-only .mpy file has no sub-version, so one of its
+// bits marks bytecode that uses the opcodes of MICROPY_OPT_FUSED_BYTECODE.
+#define MPY_FEATURE_FUSED_BYTECODE (1)
+// CIRCUITPY-CHANGE: the other bit marks files with MP_PERSISTENT_OBJ_DICT constants.
+#define MPY_FEATURE_CONST_DICT (2)
+
 // Define the host architecture
 #if MICROPY_EMIT_X86
     #define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_X86)
@@ -113,6 +119,8 @@ enum {
     MP_PERSISTENT_OBJ_FLOAT,
     MP_PERSISTENT_OBJ_COMPLEX,
     MP_PERSISTENT_OBJ_TUPLE,
+    // CIRCUITPY-CHANGE: read-only dicts from const()
+    MP_PERSISTENT_OBJ_DICT,
 };
 
 void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *ctx);
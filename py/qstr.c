@@ -60,13 +60,17 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// CIRCUITPY-CHANGE: the unmasked hash is also used by the qstr hash index
+static size_t compute_full_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+static size_t mask_hash(size_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -75,6 +79,11 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+// this must match the equivalent function in makeqstrdata.py
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return mask_hash(compute_full_hash(data, len));
+}
+
 // The first pool is the static qstr table. The contents must remain stable as
 // it is part of the .mpy ABI. See the top of py/persistentcode.c and
 // static_qstr_list in makeqstrdata.py. This pool is unsorted (although in a
@@ -206,6 +215,9 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 void qstr_reset(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    #if MICROPY_OPT_QSTR_HASH_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    #endif
 }
 
 void qstr_init(void) {
@@ -228,6 +240,79 @@ static const qstr_pool_t *find_qstr(qstr *q) {
     return pool;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_QSTR_HASH_INDEX
+// The qstrs in the heap pools are also found through an open-addressed table of
+// their ids, indexed by their unmasked hash. The ROM pools are still searched
+// directly. Ids are stored in 16 bits, so once there are more qstrs than that
+// the pools are searched directly again.
+typedef struct _qstr_index_t {
+    size_t mask;
+    qstr_short_t slots[];
+} qstr_index_t;
+
+static void qstr_index_insert(qstr_index_t *index, size_t hash, qstr_short_t q) {
+    size_t i = hash & index->mask;
+    while (index->slots[i] != MP_QSTRnull) {
+        i = (i + 1) & index->mask;
+    }
+    index->slots[i] = q;
+}
+
+// Makes a table with room for capacity heap qstrs and adds the existing ones.
+// If there isn't the memory, the heap pools are searched directly instead.
+// qstr_mutex must be taken while in this function
+static void qstr_index_rebuild(size_t capacity) {
+    // Keep the table at most two thirds full.
+    size_t n_slots = 16;
+    while (n_slots < capacity + capacity / 2) {
+        n_slots *= 2;
+    }
+    qstr_index_t *old_index = MP_STATE_VM(qstr_index);
+    MP_STATE_VM(qstr_index) = NULL;
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    // Another thread may still be reading the old table, so leave it to the GC.
+    (void)old_index;
+    #else
+    if (old_index != NULL) {
+        m_del_var(qstr_index_t, slots, qstr_short_t, old_index->mask + 1, old_index);
+    }
+    #endif
+    if (CONST_POOL.total_prev_len + CONST_POOL.len + capacity > UINT16_MAX) {
+        return;
+    }
+    qstr_index_t *index = m_malloc_maybe(sizeof(qstr_index_t) + n_slots * sizeof(qstr_short_t));
+    if (index == NULL) {
+        return;
+    }
+    index->mask = n_slots - 1;
+    memset(index->slots, 0, n_slots * sizeof(qstr_short_t));
+    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != &CONST_POOL; pool = pool->prev) {
+        for (size_t at = 0; at < pool->len; at++) {
+            size_t hash = compute_full_hash((const byte *)pool->qstrs[at], pool->lengths[at]);
+            qstr_index_insert(index, hash, pool->total_prev_len + at);
+        }
+    }
+    MP_STATE_VM(qstr_index) = index;
+}
+
+static qstr qstr_index_find(const qstr_index_t *index, size_t full_hash, const char *str, size_t str_len) {
+    for (size_t i = full_hash & index->mask;; i = (i + 1) & index->mask) {
+        qstr q = index->slots[i];
+        if (q == MP_QSTRnull) {
+            return MP_QSTRnull;
+        }
+        size_t at = q;
+        const qstr_pool_t *pool = find_qstr(&at);
+        if (pool->lengths[at] == str_len && memcmp(pool->qstrs[at], str, str_len) == 0) {
+            return q;
+        }
+    }
+}
+
+MP_REGISTER_ROOT_POINTER(struct _qstr_index_t *qstr_index);
+#endif
+
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     #if MICROPY_QSTR_BYTES_IN_HASH
@@ -273,6 +358,10 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
         pool->len = 0;
         MP_STATE_VM(last_pool) = pool;
         DEBUG_printf("QSTR: allocate new pool of size %d\n", MP_STATE_VM(last_pool)->alloc);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_QSTR_HASH_INDEX
+        qstr_index_rebuild(pool->total_prev_len + new_alloc - (CONST_POOL.total_prev_len + CONST_POOL.len));
+        #endif
     }
 
     // add the new qstr
@@ -284,6 +373,14 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_QSTR_HASH_INDEX
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        qstr_index_insert(MP_STATE_VM(qstr_index), compute_full_hash((const byte *)q_ptr, len),
+            MP_STATE_VM(last_pool)->total_prev_len + at);
+    }
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
@@ -294,13 +391,32 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_QSTR_HASH_INDEX
+    size_t full_hash = compute_full_hash((const byte *)str, str_len);
+    const qstr_pool_t *first_pool = MP_STATE_VM(last_pool);
+    const qstr_index_t *index = MP_STATE_VM(qstr_index);
+    if (index != NULL) {
+        qstr q = qstr_index_find(index, full_hash, str, str_len);
+        if (q != MP_QSTRnull) {
+            return q;
+        }
+        // Only the ROM pools are left to search.
+        first_pool = &CONST_POOL;
+    }
+    #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = mask_hash(full_hash);
+    #endif
+    #else
+    const qstr_pool_t *first_pool = MP_STATE_VM(last_pool);
     #if MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
+    #endif
 
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (const qstr_pool_t *pool = first_pool; pool != NULL; pool = pool->prev) {
         size_t low = 0;
         size_t high = pool->len - 1;
 
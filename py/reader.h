@@ -39,7 +39,20 @@ typedef struct _mp_reader_t {
     void (*close)(void *data);
 } mp_reader_t;
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_ROM
+// Passed as free_len to mp_reader_new_mem when buf is read-only and lives at least
+// as long as whatever is loaded from it, so that it may be referenced, not copied.
+#define MP_READER_IS_ROM ((size_t)-1)
+#endif
+
 void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t free_len);
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_ROM
+// Returns the next len bytes in place, skipping over them, if the reader is for
+// read-only memory. Returns NULL, and doesn't advance, otherwise.
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len);
+#endif
 void mp_reader_new_file(mp_reader_t *reader, qstr filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
 
@@ -7,16 +7,21 @@
 // SPDX-License-Identifier: MIT
 
 // CIRCUITPY-CHANGE: API and implementation thoroughly reworked
-// No attempt to have atomic operations. Add guards if atomicity required.
+// Safe for one producer and one consumer without locking. Add guards if there are more of either.
+
+#include <stdatomic.h>
+#include <string.h>
 
 #include "ringbuf.h"
 
 bool ringbuf_init(ringbuf_t *r, uint8_t *buf, size_t size) {
     r->buf = buf;
     r->size = size;
-    r->used = 0;
     r->next_read = 0;
     r->next_write = 0;
+    r->clear_index = 0;
+    r->clear_requests = 0;
+    r->clears_handled = 0;
     return r->buf != NULL;
 }
 
@@ -31,96 +36,147 @@ void ringbuf_deinit(ringbuf_t *r) {
     // this will be safe.
     r->buf = (uint8_t *)NULL;
     r->size = 0;
-    ringbuf_clear(r);
+    r->next_read = 0;
+    r->next_write = 0;
+    r->clear_index = 0;
+    r->clear_requests = 0;
+    r->clears_handled = 0;
 }
 
 size_t ringbuf_size(ringbuf_t *r) {
     return r->size;
 }
 
+static inline uint32_t ringbuf_advance(ringbuf_t *r, uint32_t index, size_t count) {
+    index += count;
+    if (index >= 2 * r->size) {
+        index -= 2 * r->size;
+    }
+    return index;
+}
+
+static inline size_t ringbuf_filled(ringbuf_t *r, uint32_t next_read, uint32_t next_write) {
+    return next_write >= next_read ? next_write - next_read : next_write + 2 * r->size - next_read;
+}
+
+static inline uint32_t ringbuf_offset(ringbuf_t *r, uint32_t index) {
+    return index < r->size ? index : index - r->size;
+}
+
+// Where the consumer should read from next, taking a clear asked for by the producer into account.
+static uint32_t ringbuf_read_index(ringbuf_t *r, uint32_t next_write) {
+    uint32_t next_read = r->next_read;
+    if (r->clear_requests != r->clears_handled) {
+        atomic_thread_fence(memory_order_acquire);
+        uint32_t clear_index = r->clear_index;
+        // A newer request may have moved clear_index since the count was read, which is fine.
+        // Only move forward, in case the consumer has already read past it.
+        if (ringbuf_filled(r, next_read, clear_index) <= ringbuf_filled(r, next_read, next_write)) {
+            next_read = clear_index;
+        }
+    }
+    return next_read;
+}
+
+// Returns how many bytes were successfully written.
+size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize) {
+    uint32_t next_write = r->next_write;
+    uint32_t next_read = r->next_read;
+    // Don't write into space until the consumer is done reading it.
+    atomic_thread_fence(memory_order_acquire);
+    size_t count = MIN(bufsize, r->size - ringbuf_filled(r, next_read, next_write));
+    if (count == 0) {
+        return 0;
+    }
+    // Copy in at most two pieces: up to the end of the storage, then from the start.
+    uint32_t offset = ringbuf_offset(r, next_write);
+    size_t first = MIN(count, r->size - offset);
+    memcpy(r->buf + offset, buf, first);
+    memcpy(r->buf, buf + first, count - first);
+    // Make the bytes visible before the consumer can see the new index.
+    atomic_thread_fence(memory_order_release);
+    r->next_write = ringbuf_advance(r, next_write, count);
+    return count;
+}
+
+// Returns how many bytes were fetched.
+size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize) {
+    uint32_t requests = r->clear_requests;
+    uint32_t next_write = r->next_write;
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t next_read = ringbuf_read_index(r, next_write);
+    r->clears_handled = requests;
+    size_t count = MIN(bufsize, ringbuf_filled(r, next_read, next_write));
+    if (count == 0) {
+        r->next_read = next_read;
+        return 0;
+    }
+    uint32_t offset = ringbuf_offset(r, next_read);
+    size_t first = MIN(count, r->size - offset);
+    memcpy(buf, r->buf + offset, first);
+    memcpy(buf + first, r->buf, count - first);
+    // Finish reading before the producer can reuse the space.
+    atomic_thread_fence(memory_order_release);
+    r->next_read = ringbuf_advance(r, next_read, count);
+    return count;
+}
+
 // Return -1 if buffer is empty, else return byte fetched.
 int ringbuf_get(ringbuf_t *r) {
-    if (r->used < 1) {
+    uint8_t v;
+    if (ringbuf_get_n(r, &v, 1) == 0) {
         return -1;
     }
-    uint8_t v = r->buf[r->next_read];
-    r->next_read++;
-    if (r->next_read >= r->size) {
-        r->next_read = 0;
-    }
-    r->used--;
     return v;
 }
 
 int ringbuf_get16(ringbuf_t *r) {
-    if (r->used < 2) {
+    uint8_t bytes[2];
+    if (ringbuf_num_filled(r) < 2) {
         return -1;
     }
-    int high_byte = ringbuf_get(r);
-    int low_byte = ringbuf_get(r);
-    return (high_byte << 8) | low_byte;
+    ringbuf_get_n(r, bytes, 2);
+    return (bytes[0] << 8) | bytes[1];
 }
 
 // Return -1 if no room in buffer, else return 0.
 int ringbuf_put(ringbuf_t *r, uint8_t v) {
-    if (r->used >= r->size) {
+    if (ringbuf_put_n(r, &v, 1) == 0) {
         return -1;
     }
-    r->buf[r->next_write] = v;
-    r->next_write++;
-    if (r->next_write >= r->size) {
-        r->next_write = 0;
-    }
-    r->used++;
     return 0;
 }
 
 int ringbuf_put16(ringbuf_t *r, uint16_t v) {
-    if (r->size - r->used < 2) {
+    if (ringbuf_num_empty(r) < 2) {
         return -1;
     }
-    ringbuf_put(r, (v >> 8) & 0xff);
-    ringbuf_put(r, v & 0xff);
+    // Write both bytes at once so the consumer never sees half of the value.
+    uint8_t bytes[2] = { (v >> 8) & 0xff, v & 0xff };
+    ringbuf_put_n(r, bytes, 2);
     return 0;
 }
 
 void ringbuf_clear(ringbuf_t *r) {
-    r->next_write = 0;
-    r->next_read = 0;
-    r->used = 0;
+    // Only the read index moves, so this is safe while the producer keeps going.
+    r->clears_handled = r->clear_requests;
+    r->next_read = r->next_write;
+}
+
+void ringbuf_request_clear(ringbuf_t *r) {
+    r->clear_index = r->next_write;
+    // Publish the index before the request.
+    atomic_thread_fence(memory_order_release);
+    r->clear_requests = r->clear_requests + 1;
 }
 
 // Number of free slots that can be written.
 size_t ringbuf_num_empty(ringbuf_t *r) {
-    return r->size - r->used;
+    return r->size - ringbuf_filled(r, r->next_read, r->next_write);
 }
 
 // Number of bytes available to read.
 size_t ringbuf_num_filled(ringbuf_t *r) {
-    return r->used;
-}
-
-// If the ring buffer fills up, not all bytes will be written.
-// Returns how many bytes were successfully written.
-size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        if (ringbuf_put(r, buf[i]) < 0) {
-            // If ringbuf is full, give up and return how many bytes
-            // we wrote so far.
-            return i;
-        }
-    }
-    return bufsize;
-}
-
-// Returns how many bytes were fetched.
-size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        int b = ringbuf_get(r);
-        if (b < 0) {
-            return i;
-        }
-        buf[i] = b;
-    }
-    return bufsize;
+    uint32_t next_write = r->next_write;
+    return ringbuf_filled(r, ringbuf_read_index(r, next_write), next_write);
 }
@@ -14,12 +14,20 @@
 
 // CIRCUITPY-CHANGE: API and implementation thoroughly reworked
 
+// One producer and one consumer, for example an interrupt handler and the VM, can use a ringbuf at
+// the same time without disabling interrupts. The producer only moves next_write and the consumer
+// only moves next_read. Both run from 0 to twice the size so a full buffer can be told apart from
+// an empty one without a shared count.
 typedef struct _ringbuf_t {
     uint8_t *buf;
     uint32_t size;
-    uint32_t used;
-    uint32_t next_read;
-    uint32_t next_write;
+    volatile uint32_t next_read;
+    volatile uint32_t next_write;
+    // The producer asks for a clear by noting next_write in clear_index and then counting the
+    // request. The consumer moves next_read there once it sees a request it hasn't handled.
+    volatile uint32_t clear_index;
+    volatile uint32_t clear_requests;
+    uint32_t clears_handled;
 } ringbuf_t;
 
 // For static initialization with an existing buffer, use ringbuf_init().
@@ -31,15 +39,20 @@ bool ringbuf_alloc(ringbuf_t *r, size_t capacity);
 // Mark ringbuf as no longer in use, and allow any heap storage to be freed by gc.
 void ringbuf_deinit(ringbuf_t *r);
 
-// Note: Ringbuf operations are not atomic.
 size_t ringbuf_size(ringbuf_t *r);
-int ringbuf_get(ringbuf_t *r);
+// Producer side.
 int ringbuf_put(ringbuf_t *r, uint8_t v);
-void ringbuf_clear(ringbuf_t *r);
 size_t ringbuf_num_empty(ringbuf_t *r);
-size_t ringbuf_num_filled(ringbuf_t *r);
+// Either all bufsize bytes become readable at once or, if they don't all fit, only the ones that do.
 size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize);
+// Discards everything put so far, once the consumer next reads. Until then the space isn't free.
+void ringbuf_request_clear(ringbuf_t *r);
+// Consumer side.
+int ringbuf_get(ringbuf_t *r);
+size_t ringbuf_num_filled(ringbuf_t *r);
 size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize);
+// Discards everything that has been put so far. The producer must use ringbuf_request_clear().
+void ringbuf_clear(ringbuf_t *r);
 
 // Note: big-endian. Return -1 if can't read or write two bytes.
 int ringbuf_get16(ringbuf_t *r);
@@ -89,6 +89,12 @@ void mp_init(void) {
     MP_STATE_VM(sched_len) = 0;
     #endif
 
+    // CIRCUITPY-CHANGE: classes from before a soft reset are gone
+    #if MICROPY_OPT_TYPE_ATTR_CACHE
+    memset(MP_STATE_VM(type_attr_cache), 0, sizeof(MP_STATE_VM(type_attr_cache)));
+    MP_STATE_VM(type_attr_cache_version) = 0;
+    #endif
+
     #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
     mp_init_emergency_exception_buf();
     #endif
@@ -112,6 +118,13 @@ void mp_init(void) {
     #if MICROPY_EMIT_NATIVE
     MP_STATE_VM(default_emit_opt) = MP_EMIT_OPT_NONE;
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_NATIVE_TIER_UP
+    MP_STATE_VM(tier_up_blocked) = 0;
+    #endif
+    #if MICROPY_MODULE_COMPILE_CACHE
+    MP_STATE_VM(compile_cache_save_failed) = false;
+    #endif
     #endif
 
     // init global module dict
@@ -172,6 +185,9 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_SYS_SETTRACE || MICROPY_TRACK_CURRENT_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
@@ -1732,9 +1748,18 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
     // set exception handler to restore context if an exception is raised
     nlr_push_jump_callback(&ctx.callback, mp_globals_locals_set_from_nlr_jump_callback);
 
-    qstr source_name = lex->source_name;
-    mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
-    mp_obj_t module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    mp_obj_t module_fun;
+    // CIRCUITPY-CHANGE: compile() must return a single bytecode function
+    #if MICROPY_COMP_STREAMING
+    if (parse_input_kind == MP_PARSE_FILE_INPUT && globals != NULL) {
+        module_fun = mp_compile_file_in_batches(lex);
+    } else
+    #endif
+    {
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
+        module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    }
 
     mp_obj_t ret;
     if (MICROPY_PY_BUILTINS_COMPILE && globals == NULL) {
@@ -526,6 +526,43 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        // CIRCUITPY-CHANGE
+        #if MICROPY_OPT_FUSED_BYTECODE
+        case MP_BC_LOAD_FAST_ATTR: {
+            mp_uint_t local_num = *ip++;
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_ATTR " UINT_FMT " %s", local_num, qstr_str(qst));
+            break;
+        }
+
+        case MP_BC_LOAD_FAST_METHOD: {
+            mp_uint_t local_num = *ip++;
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST_METHOD " UINT_FMT " %s", local_num, qstr_str(qst));
+            break;
+        }
+
+        case MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP: {
+            mp_uint_t op = ip[1] & 0x3f;
+            mp_int_t num = (mp_int_t)((ip[0] >> 4) | (ip[1] >> 6) << 4) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS;
+            mp_printf(print, "LOAD_FAST_SMALL_INT_BINARY_OP " UINT_FMT " " INT_FMT " " UINT_FMT " %s",
+                (mp_uint_t)(ip[0] & 0xf), num, op, qstr_str(mp_binary_op_method_name[op]));
+            ip += 2;
+            break;
+        }
+
+        case MP_BC_BINARY_OP_POP_JUMP_IF_TRUE:
+        case MP_BC_BINARY_OP_POP_JUMP_IF_FALSE: {
+            const char *name = ip[-1] == MP_BC_BINARY_OP_POP_JUMP_IF_TRUE ? "TRUE" : "FALSE";
+            DECODE_SLABEL;
+            mp_uint_t op = *ip;
+            mp_printf(print, "BINARY_OP_POP_JUMP_IF_%s " UINT_FMT " " UINT_FMT " %s",
+                name, (mp_uint_t)(ip + unum - ip_start), op, qstr_str(mp_binary_op_method_name[op]));
+            ip++;
+            break;
+        }
+        #endif
+
         default:
             if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
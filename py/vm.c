@@ -188,9 +188,16 @@
 } while(0)
 
 #else // MICROPY_PY_SYS_SETTRACE
+// CIRCUITPY-CHANGE
+#if MICROPY_TRACK_CURRENT_CODE_STATE
+#define FRAME_SETUP() do { MP_STATE_THREAD(current_code_state) = code_state; } while (0)
+#define FRAME_ENTER() do { code_state->prev_state = MP_STATE_THREAD(current_code_state); } while (0)
+#define FRAME_LEAVE() do { MP_STATE_THREAD(current_code_state) = code_state->prev_state; } while (0)
+#else
 #define FRAME_SETUP()
 #define FRAME_ENTER()
 #define FRAME_LEAVE()
+#endif
 #define FRAME_UPDATE()
 #define TRACE_TICK(current_ip, current_sp, is_exception)
 #endif // MICROPY_PY_SYS_SETTRACE
@@ -236,6 +243,18 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
 #define MARK_EXC_IP_GLOBAL() { code_state->ip = ip; }
 #endif
 
+// CIRCUITPY-CHANGE: a jump backwards is a loop iteration, which counts towards
+// compiling the running function to native code.
+#if MICROPY_OPT_NATIVE_TIER_UP
+#define TIER_UP_BACK_EDGE(offset) do { \
+    if ((mp_int_t)(offset) < 0 && code_state->fun_bc->tier_up_countdown > 0) { \
+        code_state->fun_bc->tier_up_countdown--; \
+    } \
+} while (0)
+#else
+#define TIER_UP_BACK_EDGE(offset)
+#endif
+
 #if MICROPY_OPT_COMPUTED_GOTO
     #include "py/vmentrytable.h"
     // CIRCUITPY-CHANGE
@@ -415,6 +434,10 @@ dispatch_loop:
                 }
 
                 ENTRY(MP_BC_LOAD_ATTR): {
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_FUSED_BYTECODE
+                    load_attr:
+                    #endif
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -426,12 +449,24 @@ dispatch_loop:
                     // types are extremely common, so avoid all the other checks and
                     // calls that normally happen first.
                     mp_map_elem_t *elem = NULL;
-                    if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
+                    // CIRCUITPY-CHANGE: and to its slots if the class has __slots__
+                    mp_obj_t *slot = NULL;
+                    const mp_obj_type_t *type = mp_obj_get_type(top);
+                    if (mp_obj_is_instance_type(type)) {
                         mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
-                        elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        #if MICROPY_PY_CLASS_SLOTS
+                        if (type->flags & MP_TYPE_FLAG_HAS_INSTANCE_SLOTS) {
+                            slot = mp_obj_instance_find_slot(self, qst);
+                        } else
+                        #endif
+                        {
+                            elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        }
                     }
                     if (elem) {
                         obj = elem->value;
+                    } else if (slot != NULL && *slot != MP_OBJ_NULL) {
+                        obj = *slot;
                     } else
                     #endif
                     {
@@ -442,6 +477,10 @@ dispatch_loop:
                 }
 
                 ENTRY(MP_BC_LOAD_METHOD): {
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_FUSED_BYTECODE
+                    load_method:
+                    #endif
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_load_method(*sp, qst, sp);
@@ -449,6 +488,57 @@ dispatch_loop:
                     DISPATCH();
                 }
 
+                // CIRCUITPY-CHANGE
+                #if MICROPY_OPT_FUSED_BYTECODE
+                ENTRY(MP_BC_LOAD_FAST_ATTR): {
+                    obj_shared = fastn[-(mp_int_t)*ip++];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_attr;
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_METHOD): {
+                    obj_shared = fastn[-(mp_int_t)*ip++];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj_shared);
+                    goto load_method;
+                }
+
+                ENTRY(MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP): {
+                    MARK_EXC_IP_SELECTIVE();
+                    // See mp_emit_bc_binary_op for the encoding.
+                    mp_uint_t arg = ip[0] | ip[1] << 8;
+                    ip += 2;
+                    obj_shared = fastn[-(mp_int_t)(arg & 0xf)];
+                    if (obj_shared == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    mp_int_t num = ((arg >> 4) & 0xf) | (arg >> 14) << 4;
+                    mp_obj_t rhs = MP_OBJ_NEW_SMALL_INT(num - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
+                    PUSH(mp_binary_op((arg >> 8) & 0x3f, obj_shared, rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_POP_JUMP_IF_TRUE):
+                ENTRY(MP_BC_BINARY_OP_POP_JUMP_IF_FALSE): {
+                    MARK_EXC_IP_SELECTIVE();
+                    bool jump_if = ip[-1] == MP_BC_BINARY_OP_POP_JUMP_IF_TRUE;
+                    DECODE_SLABEL;
+                    const byte *target = ip + slab;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    if (mp_obj_is_true(mp_binary_op(*ip++, lhs, rhs)) == jump_if) {
+                        TIER_UP_BACK_EDGE(slab);
+                        ip = target;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
                 ENTRY(MP_BC_LOAD_SUPER_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -577,6 +667,7 @@ dispatch_loop:
 
                 ENTRY(MP_BC_JUMP): {
                     DECODE_SLABEL;
+                    TIER_UP_BACK_EDGE(slab);
                     ip += slab;
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -584,6 +675,7 @@ dispatch_loop:
                 ENTRY(MP_BC_POP_JUMP_IF_TRUE): {
                     DECODE_SLABEL;
                     if (mp_obj_is_true(POP())) {
+                        TIER_UP_BACK_EDGE(slab);
                         ip += slab;
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
@@ -592,6 +684,7 @@ dispatch_loop:
                 ENTRY(MP_BC_POP_JUMP_IF_FALSE): {
                     DECODE_SLABEL;
                     if (!mp_obj_is_true(POP())) {
+                        TIER_UP_BACK_EDGE(slab);
                         ip += slab;
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
@@ -127,6 +127,14 @@ static entry_table_type const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_IMPORT_NAME] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_NAME),
     [MP_BC_IMPORT_FROM] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_FROM),
     [MP_BC_IMPORT_STAR] = COMPUTE_ENTRY(&& entry_MP_BC_IMPORT_STAR),
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_FUSED_BYTECODE
+    [MP_BC_LOAD_FAST_ATTR] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_ATTR),
+    [MP_BC_LOAD_FAST_METHOD] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_METHOD),
+    [MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_SMALL_INT_BINARY_OP),
+    [MP_BC_BINARY_OP_POP_JUMP_IF_TRUE] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_POP_JUMP_IF_TRUE),
+    [MP_BC_BINARY_OP_POP_JUMP_IF_FALSE] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_POP_JUMP_IF_FALSE),
+    #endif
     [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI),
     [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_FAST_MULTI),
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_FAST_MULTI),
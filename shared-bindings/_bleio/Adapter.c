@@ -267,6 +267,8 @@ static MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|         window: float = 0.1,
 //|         minimum_rssi: int = -80,
 //|         active: bool = True,
+//|         addresses: Optional[Sequence[Address]] = None,
+//|         dedup_window: float = 0,
 //|     ) -> Iterable[ScanEntry]:
 //|         """Starts a BLE scan and returns an iterator of results. Advertisements and scan responses are
 //|         filtered and returned separately.
@@ -283,12 +285,22 @@ static MP_DEFINE_CONST_FUN_OBJ_1(bleio_adapter_stop_advertising_obj, bleio_adapt
 //|            window must be <= interval.
 //|         :param int minimum_rssi: the minimum rssi of entries to return.
 //|         :param bool active: retrieve scan responses for scannable advertisements.
+//|         :param Sequence[Address] addresses: only return entries from these addresses. `None`
+//|            returns entries from any address.
+//|         :param float dedup_window: drop an advertisement or scan response identical to one
+//|            returned from the same address less than this many seconds ago. Zero disables
+//|            deduplication.
+//|
+//|         All filtering, including ``prefixes`` and ``minimum_rssi``, happens before entries are
+//|         buffered so dropped packets never allocate a `ScanEntry`. Service UUIDs and
+//|         manufacturer IDs can be matched with ``prefixes``; for example
+//|         ``b"\\x03\\xff\\x22\\x08"`` matches manufacturer specific data from company 0x0822.
 //|         :returns: an iterable of `_bleio.ScanEntry` objects
 //|         :rtype: iterable"""
 //|         ...
 //|
 static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active };
+    enum { ARG_prefixes, ARG_buffer_size, ARG_extended, ARG_timeout, ARG_interval, ARG_window, ARG_minimum_rssi, ARG_active, ARG_addresses, ARG_dedup_window };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_prefixes,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_buffer_size,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 512} },
@@ -298,6 +310,8 @@ static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         { MP_QSTR_window,   MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_minimum_rssi,  MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = -80} },
         { MP_QSTR_active,  MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+        { MP_QSTR_addresses,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_dedup_window,  MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
     };
 
     bleio_adapter_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -344,7 +358,26 @@ static mp_obj_t bleio_adapter_start_scan(size_t n_args, const mp_obj_t *pos_args
         }
     }
 
-    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool);
+    // The scan keeps a copy of the address bytes, on the heap, until it is done.
+    uint8_t *addresses = NULL;
+    size_t address_count = 0;
+    if (args[ARG_addresses].u_obj != mp_const_none) {
+        mp_obj_t *items;
+        mp_obj_get_array(args[ARG_addresses].u_obj, &address_count, &items);
+        addresses = m_new(uint8_t, address_count * NUM_BLEIO_ADDRESS_BYTES);
+        for (size_t i = 0; i < address_count; i++) {
+            bleio_address_obj_t *address = MP_OBJ_TO_PTR(mp_arg_validate_type(items[i], &bleio_address_type, MP_QSTR_addresses));
+            mp_buffer_info_t address_bufinfo;
+            mp_get_buffer_raise(common_hal_bleio_address_get_address_bytes(address), &address_bufinfo, MP_BUFFER_READ);
+            memcpy(addresses + i * NUM_BLEIO_ADDRESS_BYTES, address_bufinfo.buf, NUM_BLEIO_ADDRESS_BYTES);
+        }
+    }
+
+    const mp_int_t dedup_window_ms =
+        (mp_int_t)(mp_arg_validate_obj_float_non_negative(args[ARG_dedup_window].u_obj, 0, MP_QSTR_dedup_window) * 1000);
+
+    return common_hal_bleio_adapter_start_scan(self, prefix_bufinfo.buf, prefix_bufinfo.len, args[ARG_extended].u_bool, args[ARG_buffer_size].u_int, timeout, interval, window, args[ARG_minimum_rssi].u_int, args[ARG_active].u_bool,
+        addresses, address_count, dedup_window_ms);
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_adapter_start_scan_obj, 1, bleio_adapter_start_scan);
 
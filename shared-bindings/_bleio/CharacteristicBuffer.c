@@ -158,6 +158,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(bleio_characteristic_buffer_get_in_waiting_obj, bleio_
 MP_PROPERTY_GETTER(bleio_characteristic_buffer_in_waiting_obj,
     (mp_obj_t)&bleio_characteristic_buffer_get_in_waiting_obj);
 
+//|     overflow_count: int
+//|     """The number of incoming bytes dropped because the input buffer was full.
+//|     Pass a larger ``buffer_size`` if this keeps growing."""
+//|
+static mp_obj_t bleio_characteristic_buffer_obj_get_overflow_count(mp_obj_t self_in) {
+    bleio_characteristic_buffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_bleio_characteristic_buffer_get_overflow_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(bleio_characteristic_buffer_get_overflow_count_obj, bleio_characteristic_buffer_obj_get_overflow_count);
+
+MP_PROPERTY_GETTER(bleio_characteristic_buffer_overflow_count_obj,
+    (mp_obj_t)&bleio_characteristic_buffer_get_overflow_count_obj);
+
 //|     def reset_input_buffer(self) -> None:
 //|         """Discard any unread characters in the input buffer."""
 //|         ...
@@ -195,6 +209,7 @@ static const mp_rom_map_elem_t bleio_characteristic_buffer_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR_reset_input_buffer), MP_ROM_PTR(&bleio_characteristic_buffer_reset_input_buffer_obj) },
     // Properties
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&bleio_characteristic_buffer_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overflow_count), MP_ROM_PTR(&bleio_characteristic_buffer_overflow_count_obj) },
 
 };
 
@@ -94,6 +94,26 @@ static mp_obj_t bleio_connection_pair(mp_uint_t n_args, const mp_obj_t *pos_args
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_connection_pair_obj, 1, bleio_connection_pair);
 
+//|     def request_high_throughput(self) -> None:
+//|         """Ask the peer to switch the link to the 2M PHY and the longest (251 byte) link layer
+//|         data length. Combined with a short `connection_interval` this lets many more bytes be
+//|         sent per connection event.
+//|
+//|         This is only a request. The peer or this radio may not support either, in which case
+//|         the link keeps its current settings.
+//|
+//|         Raises `NotImplementedError` on Silicon Labs boards, which can't make the request yet."""
+//|         ...
+//|
+static mp_obj_t bleio_connection_request_high_throughput(mp_obj_t self_in) {
+    bleio_connection_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    bleio_connection_ensure_connected(self);
+    common_hal_bleio_connection_request_high_throughput(self->connection);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(bleio_connection_request_high_throughput_obj, bleio_connection_request_high_throughput);
+
 //|     def discover_remote_services(
 //|         self, service_uuids_whitelist: Optional[Iterable[UUID]] = None
 //|     ) -> Tuple[Service, ...]:
@@ -225,6 +245,7 @@ static const mp_rom_map_elem_t bleio_connection_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_pair),                     MP_ROM_PTR(&bleio_connection_pair_obj) },
     { MP_ROM_QSTR(MP_QSTR_disconnect),               MP_ROM_PTR(&bleio_connection_disconnect_obj) },
     { MP_ROM_QSTR(MP_QSTR_discover_remote_services), MP_ROM_PTR(&bleio_connection_discover_remote_services_obj) },
+    { MP_ROM_QSTR(MP_QSTR_request_high_throughput),  MP_ROM_PTR(&bleio_connection_request_high_throughput_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_connected),           MP_ROM_PTR(&bleio_connection_connected_obj) },
@@ -149,6 +149,39 @@ static mp_obj_t bleio_packet_buffer_write(mp_uint_t n_args, const mp_obj_t *pos_
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(bleio_packet_buffer_write_obj, 1, bleio_packet_buffer_write);
 
+//|     def write_many(self, packets: Iterable[ReadableBuffer]) -> int:
+//|         """Writes each buffer in packets as a packet of its own, in order.
+//|
+//|         Notifications and writes without response are handed straight to the BLE stack, which
+//|         can send as many of them as fit in each connection event. This only blocks while the
+//|         stack's transmit queue is full. Other packet types are written like `write`.
+//|
+//|         :return: number of bytes written, which stops short if the connection is lost.
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_obj_t bleio_packet_buffer_write_many(mp_obj_t self_in, mp_obj_t packets_in) {
+    bleio_packet_buffer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_int_t total_written = 0;
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(packets_in, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(item, &bufinfo, MP_BUFFER_READ);
+        mp_int_t num_bytes_written = common_hal_bleio_packet_buffer_send_packet(self, bufinfo.buf, bufinfo.len);
+        if (num_bytes_written < 0) {
+            // Not connected. See the TODO in write().
+            break;
+        }
+        total_written += num_bytes_written;
+    }
+    return MP_OBJ_NEW_SMALL_INT(total_written);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(bleio_packet_buffer_write_many_obj, bleio_packet_buffer_write_many);
+
 //|     def deinit(self) -> None:
 //|         """Disable permanently."""
 //|         ...
@@ -200,6 +233,7 @@ static const mp_rom_map_elem_t bleio_packet_buffer_locals_dict_table[] = {
     // Standard stream methods.
     { MP_ROM_QSTR(MP_QSTR_readinto),               MP_ROM_PTR(&bleio_packet_buffer_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write),                  MP_ROM_PTR(&bleio_packet_buffer_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_many),             MP_ROM_PTR(&bleio_packet_buffer_write_many_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_incoming_packet_length), MP_ROM_PTR(&bleio_packet_buffer_incoming_packet_length_obj) },
     { MP_ROM_QSTR(MP_QSTR_outgoing_packet_length), MP_ROM_PTR(&bleio_packet_buffer_outgoing_packet_length_obj) },
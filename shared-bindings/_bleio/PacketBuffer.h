@@ -29,6 +29,8 @@ void _common_hal_bleio_packet_buffer_construct(
     ble_event_handler_t *static_handler_entry);
 #endif
 mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, const uint8_t *data, size_t len, uint8_t *header, size_t header_len);
+// Queue data as a packet of its own, waiting only for the BLE stack to have room for it.
+mp_int_t common_hal_bleio_packet_buffer_send_packet(bleio_packet_buffer_obj_t *self, const uint8_t *data, size_t len);
 mp_int_t common_hal_bleio_packet_buffer_readinto(bleio_packet_buffer_obj_t *self, uint8_t *data, size_t len);
 mp_int_t common_hal_bleio_packet_buffer_get_incoming_packet_length(bleio_packet_buffer_obj_t *self);
 mp_int_t common_hal_bleio_packet_buffer_get_outgoing_packet_length(bleio_packet_buffer_obj_t *self);
@@ -28,3 +28,13 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self,
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self,
     uint8_t *buffer,
     size_t len);
+
+// Ports with an AES peripheral can do the work in these. They return false to
+// use the software implementation instead. Either way ctx.Iv must be left as
+// the software implementation would leave it, so CBC and CTR can continue.
+bool common_hal_aesio_aes_port_encrypt(aesio_aes_obj_t *self,
+    uint8_t *buffer,
+    size_t len);
+bool common_hal_aesio_aes_port_decrypt(aesio_aes_obj_t *self,
+    uint8_t *buffer,
+    size_t len);
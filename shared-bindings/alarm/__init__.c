@@ -122,6 +122,11 @@ MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(alarm_light_sleep_until_alarms_obj, 1, MP_OB
 //|
 //|     If no alarms are specified, the microcontroller will deep sleep until reset.
 //|
+//|     Every wake imports the program's modules again. On builds with the compile cache, such as
+//|     Espressif, create an empty ``.mpycache`` directory next to the ``.py`` files and make the
+//|     filesystem writable from ``boot.py``. Each module is then compiled only once and later wakes
+//|     load the saved code. Values that must survive the sleep can be kept in `alarm.sleep_memory`.
+//|
 //|     :param circuitpython_typing.Alarm alarms: the alarms that can wake the microcontroller.
 //|     :param Sequence[digitalio.DigitalInOut] preserve_dios: A sequence of `DigitalInOut` objects
 //|       whose state should be preserved during deep sleep.
@@ -9,6 +9,7 @@
 #include "py/binary.h"
 #include "py/mphal.h"
 #include "py/nlr.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
@@ -32,6 +33,19 @@
 //|         for i in range(length):
 //|             print(i, mybuffer[i])
 //|
+//|     To stream without gaps while other code runs::
+//|
+//|         import array
+//|         import analogbufio
+//|         import board
+//|
+//|         samples = array.array("H", [0] * 256)
+//|         adcbuf = analogbufio.BufferedIn(board.GP26, sample_rate=100000)
+//|         adcbuf.start_capture(buffer_size=16384, decimation=4)
+//|         while True:
+//|             n = adcbuf.readinto(samples)
+//|             # Process samples[:n], captured at 25000 samples per second
+//|
 //|         (TODO) The reference voltage varies by platform so use
 //|         ``reference_voltage`` to read the configured setting.
 //|         (TODO) Provide mechanism to read CPU Temperature."""
@@ -109,12 +123,15 @@ static void check_for_deinit(analogbufio_bufferedin_obj_t *self) {
 //|         For 16-bit samples, if loop=False, the 12-bit ADC values are scaled up to fill the 16 bit range.
 //|         If loop=True, ADC values are stored without scaling.
 //|
+//|         While `capturing`, copies the samples captured since the previous call instead, without
+//|         waiting for more, and ``loop`` must be False. These are always scaled to the buffer's range.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples
 //|         :param ~bool loop: loop: Set to true for continuous conversions, False to fill buffer once then stop
+//|         :return: The number of samples written
 //|         """
 //|         ...
 //|
-//|
 static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_buffer, ARG_loop };
     static const mp_arg_t allowed_args[] = {
@@ -135,17 +152,138 @@ static mp_obj_t analogbufio_bufferedin_obj_readinto(size_t n_args, const mp_obj_
     } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
     }
-    mp_uint_t captured = common_hal_analogbufio_bufferedin_readinto(self, bufinfo.buf, bufinfo.len, bytes_per_sample, args[ARG_loop].u_bool);
+    mp_uint_t captured;
+    if (common_hal_analogbufio_bufferedin_get_capturing(self)) {
+        if (args[ARG_loop].u_bool) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+        }
+        captured = common_hal_analogbufio_bufferedin_read_capture(self, bufinfo.buf, bufinfo.len, bytes_per_sample);
+    } else {
+        captured = common_hal_analogbufio_bufferedin_readinto(self, bufinfo.buf, bufinfo.len, bytes_per_sample, args[ARG_loop].u_bool);
+    }
     return MP_OBJ_NEW_SMALL_INT(captured);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_readinto_obj, 1, analogbufio_bufferedin_obj_readinto);
 
+//|     def start_capture(self, *, buffer_size: int = 8192, decimation: int = 1) -> None:
+//|         """Starts converting continuously in the background. Use `readinto` to collect the samples
+//|         before ``buffer_size`` fills up.
+//|
+//|         :param int buffer_size: Size in bytes of the buffer that holds conversions until `readinto`
+//|           is called. Each conversion takes two bytes.
+//|         :param int decimation: Each sample returned is the average of this many conversions, so
+//|           samples arrive at ``sample_rate / decimation`` with less noise. Must be 1 to 256."""
+//|         ...
+//|
+static mp_obj_t analogbufio_bufferedin_obj_start_capture(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer_size, ARG_decimation };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 8192} },
+        { MP_QSTR_decimation, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1} },
+    };
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t buffer_size = mp_arg_validate_int_range(args[ARG_buffer_size].u_int, 256, 262144, MP_QSTR_buffer_size);
+    mp_int_t decimation = mp_arg_validate_int_range(args[ARG_decimation].u_int, 1, 256, MP_QSTR_decimation);
+    common_hal_analogbufio_bufferedin_start_capture(self, buffer_size, decimation);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(analogbufio_bufferedin_start_capture_obj, 1, analogbufio_bufferedin_obj_start_capture);
+
+//|     def stop_capture(self) -> None:
+//|         """Stops converting in the background and releases the capture buffer."""
+//|         ...
+//|
+static mp_obj_t analogbufio_bufferedin_obj_stop_capture(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_stop_capture(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_stop_capture_obj, analogbufio_bufferedin_obj_stop_capture);
+
+//|     capturing: bool
+//|     """True while converting in the background. (read-only)"""
+static mp_obj_t analogbufio_bufferedin_obj_get_capturing(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_analogbufio_bufferedin_get_capturing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_capturing_obj, analogbufio_bufferedin_obj_get_capturing);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_capturing_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_capturing_obj);
+
+//|     available: int
+//|     """The number of samples `readinto` can return right now while `capturing`. (read-only)"""
+static mp_obj_t analogbufio_bufferedin_obj_get_available(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (!common_hal_analogbufio_bufferedin_get_capturing(self)) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    return mp_obj_new_int_from_uint(common_hal_analogbufio_bufferedin_get_available(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_available_obj, analogbufio_bufferedin_obj_get_available);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_available_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_available_obj);
+
+//|     overruns: int
+//|     """The number of times captured data was dropped because `readinto` wasn't called often
+//|     enough. Reset by `start_capture`. (read-only)"""
+//|
+//|
+static mp_obj_t analogbufio_bufferedin_obj_get_overruns(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_analogbufio_bufferedin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_overruns_obj, analogbufio_bufferedin_obj_get_overruns);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_overruns_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_overruns_obj);
+
+// Ports that can only capture in the foreground.
+MP_WEAK void common_hal_analogbufio_bufferedin_start_capture(analogbufio_bufferedin_obj_t *self, uint32_t buffer_size, uint16_t decimation) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+MP_WEAK void common_hal_analogbufio_bufferedin_stop_capture(analogbufio_bufferedin_obj_t *self) {
+}
+
+MP_WEAK bool common_hal_analogbufio_bufferedin_get_capturing(analogbufio_bufferedin_obj_t *self) {
+    return false;
+}
+
+MP_WEAK uint32_t common_hal_analogbufio_bufferedin_get_available(analogbufio_bufferedin_obj_t *self) {
+    return 0;
+}
+
+MP_WEAK uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self) {
+    return 0;
+}
+
+MP_WEAK uint32_t common_hal_analogbufio_bufferedin_read_capture(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    return 0;
+}
+
 static const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&default___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),   MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_start_capture), MP_ROM_PTR(&analogbufio_bufferedin_start_capture_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_capture), MP_ROM_PTR(&analogbufio_bufferedin_stop_capture_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_available),  MP_ROM_PTR(&analogbufio_bufferedin_available_obj) },
+    { MP_ROM_QSTR(MP_QSTR_capturing),  MP_ROM_PTR(&analogbufio_bufferedin_capturing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns),   MP_ROM_PTR(&analogbufio_bufferedin_overruns_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(analogbufio_bufferedin_locals_dict, analogbufio_bufferedin_locals_dict_table);
@@ -15,3 +15,9 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self);
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self);
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample, bool loop);
+void common_hal_analogbufio_bufferedin_start_capture(analogbufio_bufferedin_obj_t *self, uint32_t buffer_size, uint16_t decimation);
+void common_hal_analogbufio_bufferedin_stop_capture(analogbufio_bufferedin_obj_t *self);
+bool common_hal_analogbufio_bufferedin_get_capturing(analogbufio_bufferedin_obj_t *self);
+uint32_t common_hal_analogbufio_bufferedin_get_available(analogbufio_bufferedin_obj_t *self);
+uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self);
+uint32_t common_hal_analogbufio_bufferedin_read_capture(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample);
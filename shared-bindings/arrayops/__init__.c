@@ -0,0 +1,222 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <math.h>
+
+#include "py/binary.h"
+#include "py/obj.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/arrayops/__init__.h"
+
+//| """Fast math on arrays of samples
+//|
+//| The `arrayops` module works on `array.array`, `memoryview` and other buffers in place, such
+//| as the sample buffers filled by `analogbufio.BufferedIn`. Each operation runs over the
+//| buffer's own element type with no conversion to Python objects. Arrays of type ``'b'``,
+//| ``'B'``, ``'h'``, ``'H'``, ``'i'``, ``'I'`` and ``'f'`` are supported, and ``bytes`` and
+//| ``bytearray`` are treated as type ``'B'``. Integer results are exact.
+//|
+//| For larger numeric work, use ``ulab`` where it is available.
+//| """
+//|
+//|
+
+static void get_array(mp_obj_t obj, arrayops_array_t *array, mp_uint_t flags, qstr arg_name) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(obj, &bufinfo, flags);
+    if (bufinfo.typecode == BYTEARRAY_TYPECODE) {
+        bufinfo.typecode = 'B';
+    }
+    size_t item_size = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    bool is_signed = bufinfo.typecode == 'b' || bufinfo.typecode == 'h' || bufinfo.typecode == 'i' || bufinfo.typecode == 'l';
+    bool is_unsigned = bufinfo.typecode == 'B' || bufinfo.typecode == 'H' || bufinfo.typecode == 'I' || bufinfo.typecode == 'L';
+    if (bufinfo.typecode == 'f') {
+        array->type = ARRAYOPS_FLOAT;
+    } else if ((is_signed || is_unsigned) && item_size == 1) {
+        array->type = is_signed ? ARRAYOPS_INT8 : ARRAYOPS_UINT8;
+    } else if ((is_signed || is_unsigned) && item_size == 2) {
+        array->type = is_signed ? ARRAYOPS_INT16 : ARRAYOPS_UINT16;
+    } else if ((is_signed || is_unsigned) && item_size == 4) {
+        array->type = is_signed ? ARRAYOPS_INT32 : ARRAYOPS_UINT32;
+    } else {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), arg_name);
+    }
+    array->items = bufinfo.buf;
+    array->len = bufinfo.len / item_size;
+}
+
+static mp_obj_t new_number(const arrayops_array_t *array, int64_t i, mp_float_t f) {
+    if (array->type == ARRAYOPS_FLOAT) {
+        return mp_obj_new_float(f);
+    }
+    return mp_obj_new_int_from_ll(i);
+}
+
+//| def scale(buffer: WriteableBuffer, gain: float, offset: float = 0) -> None:
+//|     """Replaces every element x with ``x * gain + offset``. Integer elements are rounded to
+//|     the nearest value and clamped to the type's range. The math stays in integers when the
+//|     buffer, gain and offset are all integers."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_scale(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_gain, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_gain, MP_ARG_OBJ | MP_ARG_REQUIRED, { .u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_offset, MP_ARG_OBJ, { .u_obj = MP_OBJ_NEW_SMALL_INT(0) } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    arrayops_array_t array;
+    get_array(args[ARG_buffer].u_obj, &array, MP_BUFFER_WRITE, MP_QSTR_buffer);
+    mp_obj_t gain = args[ARG_gain].u_obj;
+    mp_obj_t offset = args[ARG_offset].u_obj;
+    if (array.type != ARRAYOPS_FLOAT && mp_obj_is_int(gain) && mp_obj_is_int(offset)) {
+        common_hal_arrayops_scale_int(&array, mp_obj_get_int(gain), mp_obj_get_int(offset));
+    } else {
+        common_hal_arrayops_scale_float(&array, mp_obj_get_float(gain), mp_obj_get_float(offset));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(arrayops_scale_obj, 0, arrayops_scale);
+
+//| def sum(buffer: ReadableBuffer) -> float:
+//|     """Returns the sum of the elements, an `int` for integer arrays and a `float` for float
+//|     arrays."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_sum(mp_obj_t buffer) {
+    arrayops_array_t array;
+    get_array(buffer, &array, MP_BUFFER_READ, MP_QSTR_buffer);
+    if (array.type == ARRAYOPS_FLOAT) {
+        return mp_obj_new_float(common_hal_arrayops_sum_float(&array));
+    }
+    return mp_obj_new_int_from_ll(common_hal_arrayops_sum_int(&array));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arrayops_sum_obj, arrayops_sum);
+
+//| def minmax(buffer: ReadableBuffer) -> Tuple[float, float]:
+//|     """Returns the smallest and largest elements as a tuple. Raises ValueError if buffer is
+//|     empty."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_minmax(mp_obj_t buffer) {
+    arrayops_array_t array;
+    get_array(buffer, &array, MP_BUFFER_READ, MP_QSTR_buffer);
+    if (array.len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("arg is an empty sequence"));
+    }
+    int64_t min_i = 0, max_i = 0;
+    mp_float_t min_f = 0, max_f = 0;
+    if (array.type == ARRAYOPS_FLOAT) {
+        common_hal_arrayops_minmax_float(&array, &min_f, &max_f);
+    } else {
+        common_hal_arrayops_minmax_int(&array, &min_i, &max_i);
+    }
+    mp_obj_t items[] = { new_number(&array, min_i, min_f), new_number(&array, max_i, max_f) };
+    return mp_obj_new_tuple(2, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(arrayops_minmax_obj, arrayops_minmax);
+
+//| def dot(a: ReadableBuffer, b: ReadableBuffer) -> float:
+//|     """Returns the sum of the products of the elements of a and b. Both must have the same
+//|     type and length. Arrays of type ``'h'`` use the DSP extension's dual multiply-accumulate
+//|     where the CPU has it."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_dot(mp_obj_t a_obj, mp_obj_t b_obj) {
+    arrayops_array_t a;
+    arrayops_array_t b;
+    get_array(a_obj, &a, MP_BUFFER_READ, MP_QSTR_a);
+    get_array(b_obj, &b, MP_BUFFER_READ, MP_QSTR_b);
+    if (a.type != b.type) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_b);
+    }
+    mp_arg_validate_length(b.len, a.len, MP_QSTR_b);
+    if (a.type == ARRAYOPS_FLOAT) {
+        return mp_obj_new_float(common_hal_arrayops_dot_float(&a, &b));
+    }
+    return mp_obj_new_int_from_ll(common_hal_arrayops_dot_int(&a, &b));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_dot_obj, arrayops_dot);
+
+//| def moving_average(input: ReadableBuffer, output: WriteableBuffer, window: int) -> int:
+//|     """Stores the mean of each run of window elements of input into output, so
+//|     ``output[i]`` is the mean of ``input[i:i + window]``. Integer means are truncated toward
+//|     zero. output must have the same type as input and room for ``len(input) - window + 1``
+//|     elements. output may be input itself to smooth a buffer in place.
+//|
+//|     Returns the number of elements stored."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_moving_average(mp_obj_t input_obj, mp_obj_t output_obj, mp_obj_t window_obj) {
+    arrayops_array_t input;
+    arrayops_array_t output;
+    get_array(input_obj, &input, MP_BUFFER_READ, MP_QSTR_input);
+    get_array(output_obj, &output, MP_BUFFER_WRITE, MP_QSTR_output);
+    if (input.type != output.type) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_output);
+    }
+    mp_int_t window = mp_arg_validate_int_range(mp_obj_get_int(window_obj), 1, MAX(input.len, 1), MP_QSTR_window);
+    if (input.len == 0) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    size_t count = input.len - window + 1;
+    mp_arg_validate_length_min(output.len, count, MP_QSTR_output);
+    common_hal_arrayops_moving_average(&input, &output, window);
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(arrayops_moving_average_obj, arrayops_moving_average);
+
+//| def crossings(buffer: ReadableBuffer, threshold: float) -> int:
+//|     """Returns how many times consecutive elements cross threshold in either direction. An
+//|     element equal to threshold counts as above it."""
+//|     ...
+//|
+//|
+static mp_obj_t arrayops_crossings(mp_obj_t buffer, mp_obj_t threshold_obj) {
+    arrayops_array_t array;
+    get_array(buffer, &array, MP_BUFFER_READ, MP_QSTR_buffer);
+    if (array.type == ARRAYOPS_FLOAT) {
+        return MP_OBJ_NEW_SMALL_INT(common_hal_arrayops_crossings_float(&array, mp_obj_get_float(threshold_obj)));
+    }
+    int64_t threshold;
+    if (mp_obj_is_int(threshold_obj)) {
+        threshold = mp_obj_get_int(threshold_obj);
+    } else {
+        // x >= t is the same as x >= ceil(t) for integer x.
+        threshold = (int64_t)MICROPY_FLOAT_C_FUN(ceil)(mp_obj_get_float(threshold_obj));
+    }
+    return MP_OBJ_NEW_SMALL_INT(common_hal_arrayops_crossings_int(&array, threshold));
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(arrayops_crossings_obj, arrayops_crossings);
+
+static const mp_rom_map_elem_t arrayops_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_arrayops) },
+    { MP_ROM_QSTR(MP_QSTR_scale), MP_ROM_PTR(&arrayops_scale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&arrayops_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_minmax), MP_ROM_PTR(&arrayops_minmax_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&arrayops_dot_obj) },
+    { MP_ROM_QSTR(MP_QSTR_moving_average), MP_ROM_PTR(&arrayops_moving_average_obj) },
+    { MP_ROM_QSTR(MP_QSTR_crossings), MP_ROM_PTR(&arrayops_crossings_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(arrayops_module_globals, arrayops_module_globals_table);
+
+const mp_obj_module_t arrayops_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&arrayops_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_arrayops, arrayops_module);
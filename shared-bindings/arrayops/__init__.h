@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "shared-module/arrayops/__init__.h"
+
+void common_hal_arrayops_scale_int(const arrayops_array_t *array, mp_int_t gain, mp_int_t offset);
+void common_hal_arrayops_scale_float(const arrayops_array_t *array, mp_float_t gain, mp_float_t offset);
+int64_t common_hal_arrayops_sum_int(const arrayops_array_t *array);
+mp_float_t common_hal_arrayops_sum_float(const arrayops_array_t *array);
+void common_hal_arrayops_minmax_int(const arrayops_array_t *array, int64_t *min, int64_t *max);
+void common_hal_arrayops_minmax_float(const arrayops_array_t *array, mp_float_t *min, mp_float_t *max);
+int64_t common_hal_arrayops_dot_int(const arrayops_array_t *a, const arrayops_array_t *b);
+mp_float_t common_hal_arrayops_dot_float(const arrayops_array_t *a, const arrayops_array_t *b);
+void common_hal_arrayops_moving_average(const arrayops_array_t *input, const arrayops_array_t *output, size_t window);
+size_t common_hal_arrayops_crossings_int(const arrayops_array_t *array, int64_t threshold);
+size_t common_hal_arrayops_crossings_float(const arrayops_array_t *array, mp_float_t threshold);
@@ -46,7 +46,8 @@
 //|          to allow microphone to turn on. Most require only 0.01s; some require 0.1s. Longer is safer.
 //|          Must be in range 0.0-1.0 seconds.
 //|
-//|         **Limitations:** On SAMD and RP2040, supports only 8 or 16 bit mono input, with 64x oversampling.
+//|         **Limitations:** On SAMD and RP2040, supports only 8 or 16 bit mono input. SAMD requires 64x
+//|         oversampling; RP2040 accepts multiples of 32 and uses a higher quality filter for anything but 64x.
 //|         On nRF52840, supports only 16 bit mono input at 16 kHz; oversampling is fixed at 64x. Not provided
 //|         on nRF52833 for space reasons. Not available on Espressif.
 //|
@@ -69,6 +70,19 @@
 //|           b = array.array("H", [0] * 200)
 //|           with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16) as mic:
 //|               mic.record(b, len(b))
+//|
+//|         To capture continuously while other code runs::
+//|
+//|           import array
+//|           import audiobusio
+//|           import board
+//|
+//|           b = array.array("H", [0] * 256)
+//|           mic = audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16)
+//|           mic.start_capture()
+//|           while True:
+//|               n = mic.readinto(b)
+//|               # Process b[:n]
 //|         """
 //|
 //|     ...
@@ -167,9 +181,21 @@ static void check_for_deinit(audiobusio_pdmin_obj_t *self) {
 //|           some samples were missed due to processing time."""
 //|         ...
 //|
+static void validate_destination(audiobusio_pdmin_obj_t *self, mp_buffer_info_t *bufinfo) {
+    uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
+    if (bufinfo->typecode != 'H' && bit_depth == 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be an array of type 'H' for bit_depth = 16"));
+    } else if (bufinfo->typecode != 'B' && bufinfo->typecode != BYTEARRAY_TYPECODE && bit_depth == 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be a bytearray or array of type 'B' for bit_depth = 8"));
+    }
+}
+
 static mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destination, mp_obj_t destination_length) {
     audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
     check_for_deinit(self);
+    if (common_hal_audiobusio_pdmin_get_capturing(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
     uint32_t length = mp_arg_validate_type_int(destination_length, MP_QSTR_length);
     mp_arg_validate_length_min(length, 0, MP_QSTR_length);
 
@@ -180,12 +206,7 @@ static mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
         if (bufinfo.len / mp_binary_get_size('@', bufinfo.typecode, NULL) < length) {
             mp_raise_ValueError(MP_ERROR_TEXT("Destination capacity is smaller than destination_length."));
         }
-        uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
-        if (bufinfo.typecode != 'H' && bit_depth == 16) {
-            mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be an array of type 'H' for bit_depth = 16"));
-        } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE && bit_depth == 8) {
-            mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be a bytearray or array of type 'B' for bit_depth = 8"));
-        }
+        validate_destination(self, &bufinfo);
         // length is the buffer length in slots, not bytes.
         uint32_t length_written =
             common_hal_audiobusio_pdmin_record_to_buffer(self, bufinfo.buf, length);
@@ -195,6 +216,109 @@ static mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
 }
 MP_DEFINE_CONST_FUN_OBJ_3(audiobusio_pdmin_record_obj, audiobusio_pdmin_obj_record);
 
+//|     def start_capture(self, *, buffer_size: int = 16384) -> None:
+//|         """Starts recording continuously in the background. Use `readinto` to collect the samples.
+//|         `record` can't be used until `stop_capture` is called.
+//|
+//|         :param int buffer_size: Size in bytes of the buffer that holds captured data until `readinto`
+//|           is called. At 64x oversampling, 16384 bytes is 128 ms at 16 kHz."""
+//|         ...
+//|
+static mp_obj_t audiobusio_pdmin_obj_start_capture(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16384} },
+    };
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t buffer_size = mp_arg_validate_int_range(args[ARG_buffer_size].u_int, 256, 262144, MP_QSTR_buffer_size);
+    common_hal_audiobusio_pdmin_start_capture(self, buffer_size);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiobusio_pdmin_start_capture_obj, 1, audiobusio_pdmin_obj_start_capture);
+
+//|     def stop_capture(self) -> None:
+//|         """Stops recording in the background and releases the capture buffer."""
+//|         ...
+//|
+static mp_obj_t audiobusio_pdmin_obj_stop_capture(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_stop_capture(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_capture_obj, audiobusio_pdmin_obj_stop_capture);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Fills ``buffer`` with samples captured since the previous call, without waiting for more.
+//|         The buffer must have the same type as for `record`.
+//|
+//|         :return: The number of samples written, which may be 0."""
+//|         ...
+//|
+static mp_obj_t audiobusio_pdmin_obj_readinto(mp_obj_t self_in, mp_obj_t destination) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    if (!common_hal_audiobusio_pdmin_get_capturing(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Not running"));
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(destination, &bufinfo, MP_BUFFER_WRITE);
+    validate_destination(self, &bufinfo);
+    size_t length = bufinfo.len / mp_binary_get_size('@', bufinfo.typecode, NULL);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_pdmin_readinto(self, bufinfo.buf, length));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_pdmin_readinto_obj, audiobusio_pdmin_obj_readinto);
+
+//|     capturing: bool
+//|     """True while recording in the background. (read-only)"""
+static mp_obj_t audiobusio_pdmin_obj_get_capturing(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiobusio_pdmin_get_capturing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_capturing_obj, audiobusio_pdmin_obj_get_capturing);
+
+MP_PROPERTY_GETTER(audiobusio_pdmin_capturing_obj,
+    (mp_obj_t)&audiobusio_pdmin_get_capturing_obj);
+
+//|     overruns: int
+//|     """The number of times captured data was dropped because `readinto` wasn't called often
+//|     enough. Reset by `start_capture`. (read-only)"""
+static mp_obj_t audiobusio_pdmin_obj_get_overruns(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_pdmin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_overruns_obj, audiobusio_pdmin_obj_get_overruns);
+
+MP_PROPERTY_GETTER(audiobusio_pdmin_overruns_obj,
+    (mp_obj_t)&audiobusio_pdmin_get_overruns_obj);
+
+// Ports that can only record in the foreground.
+MP_WEAK void common_hal_audiobusio_pdmin_start_capture(audiobusio_pdmin_obj_t *self, uint32_t buffer_size) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+MP_WEAK void common_hal_audiobusio_pdmin_stop_capture(audiobusio_pdmin_obj_t *self) {
+}
+
+MP_WEAK bool common_hal_audiobusio_pdmin_get_capturing(audiobusio_pdmin_obj_t *self) {
+    return false;
+}
+
+MP_WEAK uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *buffer, uint32_t length) {
+    return 0;
+}
+
+MP_WEAK uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return 0;
+}
+
 //|     sample_rate: int
 //|     """The actual sample_rate of the recording. This may not match the constructed
 //|     sample rate due to internal clock limitations."""
@@ -217,6 +341,13 @@ static const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
+    { MP_ROM_QSTR(MP_QSTR_start_capture), MP_ROM_PTR(&audiobusio_pdmin_start_capture_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_capture), MP_ROM_PTR(&audiobusio_pdmin_stop_capture_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&audiobusio_pdmin_readinto_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_capturing), MP_ROM_PTR(&audiobusio_pdmin_capturing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns), MP_ROM_PTR(&audiobusio_pdmin_overruns_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
 };
 static MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
@@ -22,5 +22,11 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
     uint16_t *buffer, uint32_t length);
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t *self);
 uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *self);
+void common_hal_audiobusio_pdmin_start_capture(audiobusio_pdmin_obj_t *self, uint32_t buffer_size);
+void common_hal_audiobusio_pdmin_stop_capture(audiobusio_pdmin_obj_t *self);
+bool common_hal_audiobusio_pdmin_get_capturing(audiobusio_pdmin_obj_t *self);
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *buffer, uint32_t length);
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self);
 // TODO(tannewt): Add record to file
 #endif
@@ -0,0 +1,215 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/Playlist.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+//| class Playlist:
+//|     """Plays a queue of samples back to back without gaps"""
+//|
+//|     def __init__(
+//|         self,
+//|         samples: Iterable[circuitpython_typing.AudioSample] = (),
+//|         *,
+//|         sample_rate: int,
+//|         channel_count: int = 1,
+//|         crossfade: float = 0.0,
+//|         continuous: bool = False,
+//|         buffer_size: int = 1024,
+//|     ) -> None:
+//|         """Create a Playlist that plays each sample in its queue in turn. Unlike playing the
+//|         samples one at a time from Python, the switch happens inside the audio buffer being
+//|         filled, so there is no gap while the output stops and the next sample is opened.
+//|         Each sample is opened when it is added, and the first buffer of the next one is read
+//|         ahead while the current one plays.
+//|
+//|         The output is always signed 16 bit. Queued samples may be 8 or 16 bit, signed or
+//|         unsigned, but must have the playlist's sample rate and channel count. Use
+//|         `audiocore.Resampler` to convert ones that don't.
+//|
+//|         :param Iterable[~circuitpython_typing.AudioSample] samples: Samples to queue initially
+//|         :param int sample_rate: The sample rate of the samples and of the output
+//|         :param int channel_count: The number of channels of the samples and of the output
+//|         :param float crossfade: Seconds over which each sample fades into the next, up to 1.
+//|           Crossfading delays all output by this long, because the end of a sample can only
+//|           be known once it has been read.
+//|         :param bool continuous: When True, silence is played once the queue runs out instead
+//|           of ending, so samples appended later play without restarting the output.
+//|         :param int buffer_size: The total size in bytes of each of the two playback buffers to use
+//|
+//|         Playing two files back to back, with a one second crossfade::
+//|
+//|           import audiocore
+//|           import audiopwmio
+//|           import board
+//|
+//|           playlist = audiocore.Playlist(
+//|               (audiocore.WaveFile("one.wav"), audiocore.WaveFile("two.wav")),
+//|               sample_rate=22050, crossfade=1.0)
+//|           audio = audiopwmio.PWMAudioOut(board.A0)
+//|           audio.play(playlist)"""
+//|         ...
+//|
+static mp_obj_t audiocore_playlist_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_samples, ARG_sample_rate, ARG_channel_count, ARG_crossfade, ARG_continuous, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_samples, MP_ARG_OBJ, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_int = 0 } },
+        { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1 } },
+        { MP_QSTR_crossfade, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
+        { MP_QSTR_continuous, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024 } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t channel_count = mp_arg_validate_int_range(args[ARG_channel_count].u_int, 1, 2, MP_QSTR_channel_count);
+    mp_float_t crossfade = mp_arg_validate_obj_float_range(args[ARG_crossfade].u_obj, 0, 1, MP_QSTR_crossfade);
+    // Bounded so the fade arithmetic fits in 32 bits.
+    mp_int_t crossfade_frames = mp_arg_validate_int_max((mp_int_t)(crossfade * sample_rate), UINT16_MAX, MP_QSTR_crossfade);
+    // Each buffer must hold at least one frame.
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiocore_playlist_obj_t *self = mp_obj_malloc(audiocore_playlist_obj_t, &audiocore_playlist_type);
+    common_hal_audiocore_playlist_construct(self, sample_rate, channel_count, crossfade_frames,
+        args[ARG_continuous].u_bool, buffer_size);
+
+    mp_obj_t iterable = mp_getiter(args[ARG_samples].u_obj, NULL);
+    mp_obj_t sample;
+    while ((sample = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        common_hal_audiocore_playlist_append(self, sample);
+    }
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Playlist and releases its buffers. The queued samples are not deinitialized."""
+//|         ...
+//|
+static mp_obj_t audiocore_playlist_deinit(mp_obj_t self_in) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiocore_playlist_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_playlist_deinit_obj, audiocore_playlist_deinit);
+
+//|     def __enter__(self) -> Playlist:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def append(self, sample: circuitpython_typing.AudioSample) -> None:
+//|         """Adds ``sample`` to the end of the queue. It is rewound to its beginning now, so a
+//|         sample must not be queued more than once at a time. If the playlist has ended, it must
+//|         be played again for the new sample to be heard."""
+//|         ...
+//|
+static mp_obj_t audiocore_playlist_obj_append(mp_obj_t self_in, mp_obj_t sample) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    common_hal_audiocore_playlist_append(self, sample);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(audiocore_playlist_append_obj, audiocore_playlist_obj_append);
+
+//|     def skip(self) -> None:
+//|         """Removes the playing sample from the queue and starts the next one, crossfading if
+//|         configured to."""
+//|         ...
+//|
+static mp_obj_t audiocore_playlist_obj_skip(mp_obj_t self_in) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    common_hal_audiocore_playlist_skip(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_playlist_skip_obj, audiocore_playlist_obj_skip);
+
+//|     def clear(self) -> None:
+//|         """Removes every sample from the queue, including the playing one."""
+//|         ...
+//|
+static mp_obj_t audiocore_playlist_obj_clear(mp_obj_t self_in) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    common_hal_audiocore_playlist_clear(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_playlist_clear_obj, audiocore_playlist_obj_clear);
+
+//|     current: Optional[circuitpython_typing.AudioSample]
+//|     """The sample being played, or ``None`` when the queue is empty. (read-only)"""
+//|
+static mp_obj_t audiocore_playlist_obj_get_current(mp_obj_t self_in) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audiocore_playlist_get_current(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_playlist_get_current_obj, audiocore_playlist_obj_get_current);
+
+MP_PROPERTY_GETTER(audiocore_playlist_current_obj,
+    (mp_obj_t)&audiocore_playlist_get_current_obj);
+
+//|     queued: int
+//|     """The number of samples in the queue, including the playing one. (read-only)"""
+//|
+//|
+static mp_obj_t audiocore_playlist_obj_get_queued(mp_obj_t self_in) {
+    audiocore_playlist_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiocore_playlist_get_queued(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_playlist_get_queued_obj, audiocore_playlist_obj_get_queued);
+
+MP_PROPERTY_GETTER(audiocore_playlist_queued_obj,
+    (mp_obj_t)&audiocore_playlist_get_queued_obj);
+
+static const mp_rom_map_elem_t audiocore_playlist_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiocore_playlist_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&audiocore_playlist_append_obj) },
+    { MP_ROM_QSTR(MP_QSTR_skip), MP_ROM_PTR(&audiocore_playlist_skip_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&audiocore_playlist_clear_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_current), MP_ROM_PTR(&audiocore_playlist_current_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queued), MP_ROM_PTR(&audiocore_playlist_queued_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audiocore_playlist_locals_dict, audiocore_playlist_locals_dict_table);
+
+static const audiosample_p_t audiocore_playlist_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audiocore_playlist_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiocore_playlist_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiocore_playlist_type,
+    MP_QSTR_Playlist,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiocore_playlist_make_new,
+    locals_dict, &audiocore_playlist_locals_dict,
+    protocol, &audiocore_playlist_proto
+    );
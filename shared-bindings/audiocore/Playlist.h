@@ -0,0 +1,21 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/Playlist.h"
+
+extern const mp_obj_type_t audiocore_playlist_type;
+
+void common_hal_audiocore_playlist_construct(audiocore_playlist_obj_t *self, uint32_t sample_rate,
+    uint8_t channel_count, uint32_t crossfade_frames, bool continuous, uint32_t buffer_size);
+
+void common_hal_audiocore_playlist_deinit(audiocore_playlist_obj_t *self);
+void common_hal_audiocore_playlist_append(audiocore_playlist_obj_t *self, mp_obj_t sample);
+void common_hal_audiocore_playlist_skip(audiocore_playlist_obj_t *self);
+void common_hal_audiocore_playlist_clear(audiocore_playlist_obj_t *self);
+mp_obj_t common_hal_audiocore_playlist_get_current(audiocore_playlist_obj_t *self);
+size_t common_hal_audiocore_playlist_get_queued(audiocore_playlist_obj_t *self);
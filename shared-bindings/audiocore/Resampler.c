@@ -0,0 +1,162 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+//| class Resampler:
+//|     """Converts another sample to a different sample rate and channel count while it plays"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         sample_rate: int,
+//|         channel_count: Optional[int] = None,
+//|         filter_taps: int = 0,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Create a Resampler that plays ``sample`` at ``sample_rate``. The output is always signed
+//|         16 bit so it can be played by a `audiomixer.Mixer` or an effect with a different sample
+//|         rate than the original asset.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to convert. It must be mono or stereo.
+//|         :param int sample_rate: The output sample rate
+//|         :param int channel_count: The number of output channels. Defaults to the sample's channel count.
+//|           Mono is copied to both stereo channels and stereo is averaged down to mono.
+//|         :param int filter_taps: 0 uses linear interpolation. An even number from 4 to 16 uses a windowed
+//|           sinc filter of that length instead, which sounds cleaner and filters out aliases when
+//|           downsampling, at the cost of more computation per sample.
+//|         :param int buffer_size: The total size in bytes of each of the two playback buffers to use
+//|
+//|         Playing an 8 kHz sample through a 22.05 kHz mixer::
+//|
+//|           import audiocore
+//|           import audiomixer
+//|           import audiopwmio
+//|           import board
+//|
+//|           wave = audiocore.WaveFile("sound_8k.wav")
+//|           mixer = audiomixer.Mixer(sample_rate=22050, channel_count=1)
+//|           audio = audiopwmio.PWMAudioOut(board.A0)
+//|           audio.play(mixer)
+//|           mixer.voice[0].play(audiocore.Resampler(wave, sample_rate=22050))"""
+//|         ...
+//|
+static mp_obj_t audiocore_resampler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_sample_rate, ARG_channel_count, ARG_filter_taps, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_int = 0 } },
+        { MP_QSTR_channel_count, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_filter_taps, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0 } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512 } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audiosample_base_t *source = audiosample_check(sample);
+    audiosample_check_for_deinit(source);
+    mp_arg_validate_int_range(audiosample_get_channel_count(source), 1, 2, MP_QSTR_channel_count);
+    uint32_t bits_per_sample = audiosample_get_bits_per_sample(source);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t channel_count = audiosample_get_channel_count(source);
+    if (args[ARG_channel_count].u_obj != mp_const_none) {
+        channel_count = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_channel_count].u_obj), 1, 2, MP_QSTR_channel_count);
+    }
+    mp_int_t filter_taps = mp_arg_validate_int_range(args[ARG_filter_taps].u_int, 0, RESAMPLER_MAX_TAPS, MP_QSTR_filter_taps);
+    if (filter_taps == 2 || filter_taps % 2 != 0) {
+        mp_arg_error_invalid(MP_QSTR_filter_taps);
+    }
+    // Each buffer must hold at least one frame.
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiocore_resampler_obj_t *self = mp_obj_malloc(audiocore_resampler_obj_t, &audiocore_resampler_type);
+    common_hal_audiocore_resampler_construct(self, sample, sample_rate, channel_count, filter_taps, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Resampler and releases its buffers. The wrapped sample is not deinitialized."""
+//|         ...
+//|
+static mp_obj_t audiocore_resampler_deinit(mp_obj_t self_in) {
+    audiocore_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiocore_resampler_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_resampler_deinit_obj, audiocore_resampler_deinit);
+
+//|     def __enter__(self) -> Resampler:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being converted. (read-only)"""
+//|
+static mp_obj_t audiocore_resampler_obj_get_sample(mp_obj_t self_in) {
+    audiocore_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audiocore_resampler_get_sample(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_resampler_get_sample_obj, audiocore_resampler_obj_get_sample);
+
+MP_PROPERTY_GETTER(audiocore_resampler_sample_obj,
+    (mp_obj_t)&audiocore_resampler_get_sample_obj);
+
+//|     sample_rate: int
+//|     """The output sample rate in Hertz. The rate of the wrapped sample is read each time a buffer
+//|     is converted so either one may be changed during playback."""
+//|
+//|
+
+static const mp_rom_map_elem_t audiocore_resampler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiocore_resampler_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiocore_resampler_sample_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audiocore_resampler_locals_dict, audiocore_resampler_locals_dict_table);
+
+static const audiosample_p_t audiocore_resampler_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audiocore_resampler_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiocore_resampler_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiocore_resampler_type,
+    MP_QSTR_Resampler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiocore_resampler_make_new,
+    locals_dict, &audiocore_resampler_locals_dict,
+    protocol, &audiocore_resampler_proto
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/Resampler.h"
+
+extern const mp_obj_type_t audiocore_resampler_type;
+
+void common_hal_audiocore_resampler_construct(audiocore_resampler_obj_t *self, mp_obj_t sample,
+    uint32_t sample_rate, uint8_t channel_count, uint8_t filter_taps, uint32_t buffer_size);
+
+void common_hal_audiocore_resampler_deinit(audiocore_resampler_obj_t *self);
+mp_obj_t common_hal_audiocore_resampler_get_sample(audiocore_resampler_obj_t *self);
@@ -0,0 +1,186 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/Spectrum.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+//| class Spectrum:
+//|     """Measures the frequency content of another sample while it plays"""
+//|
+//|     def __init__(self, sample: circuitpython_typing.AudioSample, *, fft_size: int = 256) -> None:
+//|         """Create a Spectrum that plays ``sample`` unchanged and analyzes it on the way through.
+//|         The sample's buffers are handed to the output as they are, with no copy. Every
+//|         ``fft_size`` frames, the block just played is Hann windowed and transformed with a
+//|         fixed-point FFT in native code, and the magnitudes of its ``fft_size // 2`` frequency
+//|         bins replace the previous ones.
+//|
+//|         Bin ``i`` is centered on ``i * sample_rate / fft_size`` Hz. A full scale sine wave at a
+//|         bin's center frequency reads about 8192 in that bin.
+//|
+//|         The magnitudes are read through the buffer protocol as unsigned 16 bit values, for
+//|         example with `memoryview` or ``ulab.numpy.frombuffer``, without copying them. They
+//|         are updated in the background, so a block may finish while they are being read.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to analyze. Stereo is
+//|           averaged to mono before it is analyzed.
+//|         :param int fft_size: The number of frames in each block, a power of two from 16 to 1024.
+//|           Larger blocks resolve finer frequency detail but update less often.
+//|
+//|         A level meter for the bass and treble of a mixer's output::
+//|
+//|           import audiocore
+//|           import audiomixer
+//|           import audiopwmio
+//|           import board
+//|
+//|           mixer = audiomixer.Mixer(sample_rate=22050, channel_count=1)
+//|           spectrum = audiocore.Spectrum(mixer, fft_size=256)
+//|           audio = audiopwmio.PWMAudioOut(board.A0)
+//|           audio.play(spectrum)
+//|           mixer.voice[0].play(audiocore.WaveFile("song.wav"), loop=True)
+//|
+//|           bins = memoryview(spectrum)
+//|           while True:
+//|               print(max(bins[1:8]), max(bins[32:128]))"""
+//|         ...
+//|
+static mp_obj_t audiocore_spectrum_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_fft_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_fft_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 256 } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audiosample_base_t *source = audiosample_check(sample);
+    audiosample_check_for_deinit(source);
+    uint32_t bits_per_sample = audiosample_get_bits_per_sample(source);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+
+    mp_int_t fft_size = mp_arg_validate_int_range(args[ARG_fft_size].u_int, SPECTRUM_MIN_FFT_SIZE, SPECTRUM_MAX_FFT_SIZE, MP_QSTR_fft_size);
+    if ((fft_size & (fft_size - 1)) != 0) {
+        mp_arg_error_invalid(MP_QSTR_fft_size);
+    }
+
+    audiocore_spectrum_obj_t *self = mp_obj_malloc(audiocore_spectrum_obj_t, &audiocore_spectrum_type);
+    common_hal_audiocore_spectrum_construct(self, sample, fft_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Spectrum and releases its buffers. The wrapped sample is not deinitialized."""
+//|         ...
+//|
+static mp_obj_t audiocore_spectrum_deinit(mp_obj_t self_in) {
+    audiocore_spectrum_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiocore_spectrum_deinit(self);
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_spectrum_deinit_obj, audiocore_spectrum_deinit);
+
+//|     def __enter__(self) -> Spectrum:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//  Provided by context manager helper.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being analyzed. (read-only)"""
+//|
+static mp_obj_t audiocore_spectrum_obj_get_sample(mp_obj_t self_in) {
+    audiocore_spectrum_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return common_hal_audiocore_spectrum_get_sample(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_spectrum_get_sample_obj, audiocore_spectrum_obj_get_sample);
+
+MP_PROPERTY_GETTER(audiocore_spectrum_sample_obj,
+    (mp_obj_t)&audiocore_spectrum_get_sample_obj);
+
+//|     fft_size: int
+//|     """The number of frames in each analyzed block. (read-only)"""
+//|
+static mp_obj_t audiocore_spectrum_obj_get_fft_size(mp_obj_t self_in) {
+    audiocore_spectrum_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiocore_spectrum_get_fft_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_spectrum_get_fft_size_obj, audiocore_spectrum_obj_get_fft_size);
+
+MP_PROPERTY_GETTER(audiocore_spectrum_fft_size_obj,
+    (mp_obj_t)&audiocore_spectrum_get_fft_size_obj);
+
+//|     updates: int
+//|     """The number of blocks analyzed since playback started. It changes each time the
+//|     magnitudes do, so polling code can tell whether there is anything new. (read-only)"""
+//|
+//|
+static mp_obj_t audiocore_spectrum_obj_get_updates(mp_obj_t self_in) {
+    audiocore_spectrum_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiosample_check_for_deinit(&self->base);
+    return mp_obj_new_int_from_uint(common_hal_audiocore_spectrum_get_updates(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiocore_spectrum_get_updates_obj, audiocore_spectrum_obj_get_updates);
+
+MP_PROPERTY_GETTER(audiocore_spectrum_updates_obj,
+    (mp_obj_t)&audiocore_spectrum_get_updates_obj);
+
+static const mp_rom_map_elem_t audiocore_spectrum_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiocore_spectrum_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiocore_spectrum_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fft_size), MP_ROM_PTR(&audiocore_spectrum_fft_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_updates), MP_ROM_PTR(&audiocore_spectrum_updates_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(audiocore_spectrum_locals_dict, audiocore_spectrum_locals_dict_table);
+
+// (the get_buffer protocol returns 0 for success, 1 for failure)
+static mp_int_t audiocore_spectrum_get_magnitudes(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    audiocore_spectrum_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (audiosample_deinited(&self->base)) {
+        return 1;
+    }
+    return common_hal_audiocore_spectrum_get_buffer(self, bufinfo, flags);
+}
+
+static const audiosample_p_t audiocore_spectrum_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)audiocore_spectrum_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiocore_spectrum_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiocore_spectrum_type,
+    MP_QSTR_Spectrum,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiocore_spectrum_make_new,
+    locals_dict, &audiocore_spectrum_locals_dict,
+    buffer, audiocore_spectrum_get_magnitudes,
+    protocol, &audiocore_spectrum_proto
+    );
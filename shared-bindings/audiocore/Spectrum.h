@@ -0,0 +1,20 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/audiocore/Spectrum.h"
+
+extern const mp_obj_type_t audiocore_spectrum_type;
+
+void common_hal_audiocore_spectrum_construct(audiocore_spectrum_obj_t *self, mp_obj_t sample,
+    uint16_t fft_size);
+
+void common_hal_audiocore_spectrum_deinit(audiocore_spectrum_obj_t *self);
+mp_obj_t common_hal_audiocore_spectrum_get_sample(audiocore_spectrum_obj_t *self);
+uint16_t common_hal_audiocore_spectrum_get_fft_size(audiocore_spectrum_obj_t *self);
+uint32_t common_hal_audiocore_spectrum_get_updates(audiocore_spectrum_obj_t *self);
+int common_hal_audiocore_spectrum_get_buffer(audiocore_spectrum_obj_t *self, mp_buffer_info_t *bufinfo, mp_uint_t flags);
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/objproperty.h"
@@ -12,7 +13,10 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/audiocore/Playlist.h"
 #include "shared-bindings/audiocore/RawSample.h"
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/Spectrum.h"
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/util.h"
 // #include "shared-bindings/audiomixer/Mixer.h"
@@ -79,15 +83,63 @@ static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_reset_buffer_obj, audiocore_reset_buf
 
 #endif
 
+#if CIRCUITPY_AUDIOCORE_STATS
+// (no docstrings so that the profiling functions are not shown on docs.circuitpython.org)
+static void stats_store(mp_obj_t dict, qstr key, uint32_t value) {
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(key), mp_obj_new_int_from_uint(value));
+}
+
+static mp_obj_t audiocore_obj_stats(void) {
+    // Copied first because the values may change in an interrupt.
+    audiocore_stats_t stats = audiocore_stats;
+    mp_obj_t result = mp_obj_new_dict(3);
+    stats_store(result, MP_QSTR_callbacks, stats.callbacks);
+    stats_store(result, MP_QSTR_max_latency_us, stats.max_latency_us);
+    stats_store(result, MP_QSTR_underruns, stats.underruns);
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_0(audiocore_stats_obj, audiocore_obj_stats);
+
+static mp_obj_t audiocore_sample_stats(mp_obj_t sample_in) {
+    audiosample_stats_t stats = audiosample_check(sample_in)->stats;
+    mp_obj_t result = mp_obj_new_dict(4);
+    stats_store(result, MP_QSTR_calls, stats.calls);
+    stats_store(result, MP_QSTR_total_us, stats.total_us);
+    stats_store(result, MP_QSTR_max_us, stats.max_us);
+    stats_store(result, MP_QSTR_max_length, stats.max_length);
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(audiocore_sample_stats_obj, audiocore_sample_stats);
+
+// Resets the shared statistics and those of any samples given.
+static mp_obj_t audiocore_reset_stats(size_t n_args, const mp_obj_t *args) {
+    memset(&audiocore_stats, 0, sizeof(audiocore_stats));
+    for (size_t i = 0; i < n_args; i++) {
+        audiosample_base_t *sample = audiosample_check(args[i]);
+        memset(&sample->stats, 0, sizeof(sample->stats));
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR(audiocore_reset_stats_obj, 0, audiocore_reset_stats);
+#endif
+
 static const mp_rom_map_elem_t audiocore_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiocore) },
+    { MP_ROM_QSTR(MP_QSTR_Playlist), MP_ROM_PTR(&audiocore_playlist_type) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
+    { MP_ROM_QSTR(MP_QSTR_Resampler), MP_ROM_PTR(&audiocore_resampler_type) },
+    { MP_ROM_QSTR(MP_QSTR_Spectrum), MP_ROM_PTR(&audiocore_spectrum_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
     #if CIRCUITPY_AUDIOCORE_DEBUG
     { MP_ROM_QSTR(MP_QSTR_get_buffer), MP_ROM_PTR(&audiocore_get_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_buffer), MP_ROM_PTR(&audiocore_reset_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_structure), MP_ROM_PTR(&audiocore_get_structure_obj) },
     #endif
+    #if CIRCUITPY_AUDIOCORE_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&audiocore_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_stats), MP_ROM_PTR(&audiocore_sample_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset_stats), MP_ROM_PTR(&audiocore_reset_stats_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(audiocore_module_globals, audiocore_module_globals_table);
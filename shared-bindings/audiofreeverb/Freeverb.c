@@ -30,6 +30,7 @@
 //|         bits_per_sample: int = 16,
 //|         samples_signed: bool = True,
 //|         channel_count: int = 1,
+//|         compact: bool = False,
 //|     ) -> None:
 //|         """Create a Reverb effect simulating the audio taking place in a large room where you get echos
 //|            off of various surfaces at various times. The size of the room can be adjusted as well as how
@@ -46,6 +47,8 @@
 //|         :param int channel_count: The number of channels the source samples contain. 1 = mono; 2 = stereo.
 //|         :param int bits_per_sample: The bits per sample of the effect. Freeverb requires 16 bits.
 //|         :param bool samples_signed: Effect is signed (True) or unsigned (False). Freeverb requires signed (True).
+//|         :param bool compact: Use delay lines half as long. This halves the memory used (about 12 KiB instead
+//|           of 25 KiB per channel) and gives a shorter, brighter reverb.
 //|
 //|         Playing adding reverb to a synth::
 //|
@@ -70,7 +73,7 @@
 //|         ...
 //|
 static mp_obj_t audiofreeverb_freeverb_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_roomsize, ARG_damp, ARG_mix, ARG_buffer_size, ARG_sample_rate, ARG_bits_per_sample, ARG_samples_signed, ARG_channel_count, };
+    enum { ARG_roomsize, ARG_damp, ARG_mix, ARG_buffer_size, ARG_sample_rate, ARG_bits_per_sample, ARG_samples_signed, ARG_channel_count, ARG_compact, };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_roomsize, MP_ARG_OBJ | MP_ARG_KW_ONLY,  {.u_obj = MP_OBJ_NULL} },
         { MP_QSTR_damp, MP_ARG_OBJ | MP_ARG_KW_ONLY,  {.u_obj = MP_OBJ_NULL} },
@@ -80,6 +83,7 @@ static mp_obj_t audiofreeverb_freeverb_make_new(const mp_obj_type_t *type, size_
         { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
         { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1 } },
+        { MP_QSTR_compact, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -96,7 +100,7 @@ static mp_obj_t audiofreeverb_freeverb_make_new(const mp_obj_type_t *type, size_
     }
 
     audiofreeverb_freeverb_obj_t *self = mp_obj_malloc(audiofreeverb_freeverb_obj_t, &audiofreeverb_freeverb_type);
-    common_hal_audiofreeverb_freeverb_construct(self, args[ARG_roomsize].u_obj, args[ARG_damp].u_obj, args[ARG_mix].u_obj, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate);
+    common_hal_audiofreeverb_freeverb_construct(self, args[ARG_roomsize].u_obj, args[ARG_damp].u_obj, args[ARG_mix].u_obj, args[ARG_buffer_size].u_int, bits_per_sample, args[ARG_samples_signed].u_bool, channel_count, sample_rate, args[ARG_compact].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -183,6 +187,18 @@ MP_PROPERTY_GETSET(audiofreeverb_freeverb_mix_obj,
     (mp_obj_t)&audiofreeverb_freeverb_get_mix_obj,
     (mp_obj_t)&audiofreeverb_freeverb_set_mix_obj);
 
+//|     compact: bool
+//|     """True when the effect uses the shorter, reduced-memory delay lines. (read-only)"""
+static mp_obj_t audiofreeverb_freeverb_obj_get_compact(mp_obj_t self_in) {
+    audiofreeverb_freeverb_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_audiofreeverb_freeverb_get_compact(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofreeverb_freeverb_get_compact_obj, audiofreeverb_freeverb_obj_get_compact);
+
+MP_PROPERTY_GETTER(audiofreeverb_freeverb_compact_obj,
+    (mp_obj_t)&audiofreeverb_freeverb_get_compact_obj);
+
 //|     playing: bool
 //|     """True when the effect is playing a sample. (read-only)"""
 //|
@@ -248,6 +264,7 @@ static const mp_rom_map_elem_t audiofreeverb_freeverb_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_roomsize), MP_ROM_PTR(&audiofreeverb_freeverb_roomsize_obj) },
     { MP_ROM_QSTR(MP_QSTR_damp), MP_ROM_PTR(&audiofreeverb_freeverb_damp_obj) },
     { MP_ROM_QSTR(MP_QSTR_mix), MP_ROM_PTR(&audiofreeverb_freeverb_mix_obj) },
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&audiofreeverb_freeverb_compact_obj) },
     AUDIOSAMPLE_FIELDS,
 };
 static MP_DEFINE_CONST_DICT(audiofreeverb_freeverb_locals_dict, audiofreeverb_freeverb_locals_dict_table);
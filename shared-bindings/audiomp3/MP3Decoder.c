@@ -25,11 +25,21 @@
 //|         https://learn.adafruit.com/Memory-saving-tips-for-CircuitPython/reducing-memory-fragmentation
 //|     """
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self,
+//|         file: Union[str, typing.BinaryIO],
+//|         buffer: WriteableBuffer,
+//|         *,
+//|         input_buffer_size: int = 0,
+//|     ) -> None:
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
 //|         :param Union[str, typing.BinaryIO] file: The name of a mp3 file (preferred) or an already opened mp3 file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer, that will be split and used for buffering the data. The buffer is split into two parts for decoded data and the remainder is used for pre-decoded data. When playing from a socket, a larger buffer can help reduce playback glitches at the expense of increased memory usage.
+//|         :param int input_buffer_size: When non-zero, the size in bytes of a separate buffer for pre-decoded data, at least 2048.
+//|           It is allocated outside of the CircuitPython heap, in PSRAM when the board has it, and ``buffer`` is only used for
+//|           decoded data. The buffer is topped up in the background and only read into while decoding once it holds less than a
+//|           frame, so a large one rides out network and SD card stalls. `input_buffered` and `underruns` show how well it is keeping up.
 //|
 //|         Playback of mp3 audio is CPU intensive, and the
 //|         exact limit depends on many factors such as the particular
@@ -83,9 +93,16 @@
 //|         ...
 //|
 
-static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 1, 2, false);
-    mp_obj_t stream = args[0];
+static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_file, ARG_buffer, ARG_input_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_buffer, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_input_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_obj_t stream = args[ARG_file].u_obj;
 
     if (mp_obj_is_str(stream)) {
         stream = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), stream, MP_ROM_QSTR(MP_QSTR_rb));
@@ -100,13 +117,17 @@ static mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_ar
     }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
-    if (n_args >= 2) {
+    if (args[ARG_buffer].u_obj != mp_const_none) {
         mp_buffer_info_t bufinfo;
-        mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
+        mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audiomp3_mp3file_construct(self, stream, buffer, buffer_size);
+    mp_int_t input_buffer_size = args[ARG_input_buffer_size].u_int;
+    if (input_buffer_size != 0) {
+        mp_arg_validate_int_min(input_buffer_size, 2048, MP_QSTR_input_buffer_size);
+    }
+    common_hal_audiomp3_mp3file_construct(self, stream, buffer, buffer_size, input_buffer_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -208,8 +229,6 @@ MP_PROPERTY_GETTER(audiomp3_mp3file_rms_level_obj,
 
 //|     samples_decoded: int
 //|     """The number of audio samples decoded from the current file. (read only)"""
-//|
-//|
 static mp_obj_t audiomp3_mp3file_obj_get_samples_decoded(mp_obj_t self_in) {
     audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -220,6 +239,46 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_samples_decoded_obj, audiomp3_mp3
 MP_PROPERTY_GETTER(audiomp3_mp3file_samples_decoded_obj,
     (mp_obj_t)&audiomp3_mp3file_get_samples_decoded_obj);
 
+//|     input_buffer_size: int
+//|     """The size in bytes of the buffer for pre-decoded data. (read only)"""
+static mp_obj_t audiomp3_mp3file_obj_get_input_buffer_size(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiomp3_mp3file_get_input_buffer_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_input_buffer_size_obj, audiomp3_mp3file_obj_get_input_buffer_size);
+
+MP_PROPERTY_GETTER(audiomp3_mp3file_input_buffer_size_obj,
+    (mp_obj_t)&audiomp3_mp3file_get_input_buffer_size_obj);
+
+//|     input_buffered: int
+//|     """The number of bytes of pre-decoded data waiting to be decoded. If this stays well below
+//|     `input_buffer_size` while playing, the stream is barely keeping up. (read only)"""
+static mp_obj_t audiomp3_mp3file_obj_get_input_buffered(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiomp3_mp3file_get_input_buffered(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_input_buffered_obj, audiomp3_mp3file_obj_get_input_buffered);
+
+MP_PROPERTY_GETTER(audiomp3_mp3file_input_buffered_obj,
+    (mp_obj_t)&audiomp3_mp3file_get_input_buffered_obj);
+
+//|     underruns: int
+//|     """The number of frames played as silence because not enough pre-decoded data had arrived.
+//|     Reset when a new file is set. (read only)"""
+//|
+//|
+static mp_obj_t audiomp3_mp3file_obj_get_underruns(mp_obj_t self_in) {
+    audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiomp3_mp3file_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_underruns_obj, audiomp3_mp3file_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiomp3_mp3file_underruns_obj,
+    (mp_obj_t)&audiomp3_mp3file_get_underruns_obj);
+
 static const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_open), MP_ROM_PTR(&audiomp3_mp3file_open_obj) },
@@ -232,6 +291,9 @@ static const mp_rom_map_elem_t audiomp3_mp3file_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_file), MP_ROM_PTR(&audiomp3_mp3file_file_obj) },
     { MP_ROM_QSTR(MP_QSTR_rms_level), MP_ROM_PTR(&audiomp3_mp3file_rms_level_obj) },
     { MP_ROM_QSTR(MP_QSTR_samples_decoded), MP_ROM_PTR(&audiomp3_mp3file_samples_decoded_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_buffer_size), MP_ROM_PTR(&audiomp3_mp3file_input_buffer_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_buffered), MP_ROM_PTR(&audiomp3_mp3file_input_buffered_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiomp3_mp3file_underruns_obj) },
     AUDIOSAMPLE_FIELDS,
 };
 static MP_DEFINE_CONST_DICT(audiomp3_mp3file_locals_dict, audiomp3_mp3file_locals_dict_table);
@@ -224,7 +224,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_resume_obj, audiopwmio_pwmaudio
 //|     paused: bool
 //|     """True when playback is paused. (read-only)"""
 //|
-//|
 static mp_obj_t audiopwmio_pwmaudioout_obj_get_paused(mp_obj_t self_in) {
     audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -235,6 +234,49 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_paused_obj, audiopwmio_pwma
 MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_paused_obj,
     (mp_obj_t)&audiopwmio_pwmaudioout_get_paused_obj);
 
+//|     buffer_count: int
+//|     """The number of buffers of output to convert ahead of the one playing. It takes effect on the
+//|     next `play`. The default of 2 is the minimum. The latency from changing the sample being
+//|     played to hearing it is about this many times the sample's buffer length, so combine a small
+//|     count with a short buffer, such as a `audiomixer.Mixer` with a small ``buffer_size``, for
+//|     interactive instruments and use more buffers when streaming from a file.
+//|
+//|     Only 2 is supported on some ports."""
+//|
+static mp_obj_t audiopwmio_pwmaudioout_obj_get_buffer_count(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiopwmio_pwmaudioout_get_buffer_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_buffer_count_obj, audiopwmio_pwmaudioout_obj_get_buffer_count);
+
+static mp_obj_t audiopwmio_pwmaudioout_obj_set_buffer_count(mp_obj_t self_in, mp_obj_t buffer_count) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiopwmio_pwmaudioout_set_buffer_count(self, mp_arg_validate_int_range(mp_obj_get_int(buffer_count), 2, 255, MP_QSTR_buffer_count));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiopwmio_pwmaudioout_set_buffer_count_obj, audiopwmio_pwmaudioout_obj_set_buffer_count);
+
+MP_PROPERTY_GETSET(audiopwmio_pwmaudioout_buffer_count_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_buffer_count_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_set_buffer_count_obj);
+
+//|     underruns: int
+//|     """The number of times since `play` was called that a buffer wasn't ready in time, so there
+//|     was a gap in the output. Always 0 on ports that don't count them. (read-only)"""
+//|
+//|
+static mp_obj_t audiopwmio_pwmaudioout_obj_get_underruns(mp_obj_t self_in) {
+    audiopwmio_pwmaudioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiopwmio_pwmaudioout_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiopwmio_pwmaudioout_get_underruns_obj, audiopwmio_pwmaudioout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiopwmio_pwmaudioout_underruns_obj,
+    (mp_obj_t)&audiopwmio_pwmaudioout_get_underruns_obj);
+
 static const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiopwmio_pwmaudioout_deinit_obj) },
@@ -249,6 +291,8 @@ static const mp_rom_map_elem_t audiopwmio_pwmaudioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiopwmio_pwmaudioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiopwmio_pwmaudioout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_buffer_count), MP_ROM_PTR(&audiopwmio_pwmaudioout_buffer_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiopwmio_pwmaudioout_underruns_obj) },
 };
 static MP_DEFINE_CONST_DICT(audiopwmio_pwmaudioout_locals_dict, audiopwmio_pwmaudioout_locals_dict_table);
 
@@ -259,3 +303,18 @@ MP_DEFINE_CONST_OBJ_TYPE(
     make_new, audiopwmio_pwmaudioout_make_new,
     locals_dict, &audiopwmio_pwmaudioout_locals_dict
     );
+
+// Ports that always double buffer only support the default.
+MP_WEAK uint8_t common_hal_audiopwmio_pwmaudioout_get_buffer_count(audiopwmio_pwmaudioout_obj_t *self) {
+    return 2;
+}
+
+MP_WEAK void common_hal_audiopwmio_pwmaudioout_set_buffer_count(audiopwmio_pwmaudioout_obj_t *self, uint8_t buffer_count) {
+    if (buffer_count != 2) {
+        mp_raise_NotImplementedError(NULL);
+    }
+}
+
+MP_WEAK uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self) {
+    return 0;
+}
@@ -24,3 +24,6 @@ bool common_hal_audiopwmio_pwmaudioout_get_playing(audiopwmio_pwmaudioout_obj_t
 void common_hal_audiopwmio_pwmaudioout_pause(audiopwmio_pwmaudioout_obj_t *self);
 void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self);
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self);
+uint8_t common_hal_audiopwmio_pwmaudioout_get_buffer_count(audiopwmio_pwmaudioout_obj_t *self);
+void common_hal_audiopwmio_pwmaudioout_set_buffer_count(audiopwmio_pwmaudioout_obj_t *self, uint8_t buffer_count);
+uint32_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self);
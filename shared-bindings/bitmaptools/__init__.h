@@ -68,6 +68,13 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
 void common_hal_bitmaptools_alphablend(displayio_bitmap_t *destination, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
     bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none);
 
+// Optional port hooks to copy or fill with hardware such as DMA. Areas are clipped to the
+// bitmaps and both bitmaps use the same bits_per_value (at least 8). Return false to fall
+// back to the portable implementation. The defaults always return false.
+bool common_hal_bitmaptools_port_blit(displayio_bitmap_t *destination, int16_t x, int16_t y,
+    displayio_bitmap_t *source, const displayio_area_t *source_area);
+bool common_hal_bitmaptools_port_fill_region(displayio_bitmap_t *destination, const displayio_area_t *area, uint32_t value);
+
 typedef struct {
     union {
         struct {
@@ -239,6 +239,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_show_obj, busdisplay_busdisplay_
 //|         *,
 //|         target_frames_per_second: Optional[int] = None,
 //|         minimum_frames_per_second: int = 0,
+//|         blocking: bool = True,
 //|     ) -> bool:
 //|         """When auto_refresh is off, and :py:attr:`target_frames_per_second` is not `None` this waits
 //|         for the target frame rate and then refreshes the display,
@@ -255,17 +256,26 @@ MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_show_obj, busdisplay_busdisplay_
 //|         When auto_refresh is on, updates the display immediately. (The display will also update
 //|         without calls to this.)
 //|
+//|         When :py:attr:`blocking` is False, the areas that need updating are noted and then sent
+//|         in the background, a piece at a time, while the code continues on to draw the next frame.
+//|         The areas to update are chosen when :py:func:`refresh` is called, but their contents
+//|         are drawn as they are sent. Changes made while `refresh_in_progress` is True may show up
+//|         partially in the frame being sent, and are sent in full by the next refresh. Another
+//|         call to :py:func:`refresh` first waits for the previous frame to finish.
+//|
 //|         :param Optional[int] target_frames_per_second: The target frame rate that :py:func:`refresh` should try to
 //|             achieve. Set to `None` for immediate refresh.
 //|         :param int minimum_frames_per_second: The minimum number of times the screen should be updated per second.
+//|         :param bool blocking: Wait until the display has been updated before returning.
 //|         """
 //|         ...
 //|
 static mp_obj_t busdisplay_busdisplay_obj_refresh(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_target_frames_per_second, ARG_minimum_frames_per_second };
+    enum { ARG_target_frames_per_second, ARG_minimum_frames_per_second, ARG_blocking };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_target_frames_per_second, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
         { MP_QSTR_minimum_frames_per_second, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_blocking, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -285,11 +295,23 @@ static mp_obj_t busdisplay_busdisplay_obj_refresh(size_t n_args, const mp_obj_t
         target_ms_per_frame = 1000 / mp_obj_get_int(args[ARG_target_frames_per_second].u_obj);
     }
 
-    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_refresh(self, target_ms_per_frame, maximum_ms_per_real_frame));
+    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_refresh(self, target_ms_per_frame, maximum_ms_per_real_frame,
+        args[ARG_blocking].u_bool));
 }
 
 MP_DEFINE_CONST_FUN_OBJ_KW(busdisplay_busdisplay_refresh_obj, 1, busdisplay_busdisplay_obj_refresh);
 
+//|     refresh_in_progress: bool
+//|     """True while a refresh started with ``blocking=False`` is still being sent. (read-only)"""
+static mp_obj_t busdisplay_busdisplay_obj_get_refresh_in_progress(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_get_refresh_in_progress(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_refresh_in_progress_obj, busdisplay_busdisplay_obj_get_refresh_in_progress);
+
+MP_PROPERTY_GETTER(busdisplay_busdisplay_refresh_in_progress_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_refresh_in_progress_obj);
+
 //|     auto_refresh: bool
 //|     """True when the display is refreshed automatically."""
 static mp_obj_t busdisplay_busdisplay_obj_get_auto_refresh(mp_obj_t self_in) {
@@ -341,6 +363,57 @@ MP_PROPERTY_GETSET(busdisplay_busdisplay_brightness_obj,
     (mp_obj_t)&busdisplay_busdisplay_get_brightness_obj,
     (mp_obj_t)&busdisplay_busdisplay_set_brightness_obj);
 
+//|     pipelined_refresh: bool
+//|     """True when the display renders the next part of a refresh while the previous part is
+//|     still being sent, on buses that can send in the background. This needs extra RAM for a
+//|     second pixel buffer. The bus stays locked while rendering, so don't enable this if the
+//|     bus is shared with a device that is read during a refresh, such as an SD card that
+//|     holds a `displayio.OnDiskBitmap`. Defaults to False."""
+static mp_obj_t busdisplay_busdisplay_obj_get_pipelined_refresh(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_get_pipelined_refresh(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_pipelined_refresh_obj, busdisplay_busdisplay_obj_get_pipelined_refresh);
+
+static mp_obj_t busdisplay_busdisplay_obj_set_pipelined_refresh(mp_obj_t self_in, mp_obj_t pipelined_refresh) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+
+    common_hal_busdisplay_busdisplay_set_pipelined_refresh(self, mp_obj_is_true(pipelined_refresh));
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_set_pipelined_refresh_obj, busdisplay_busdisplay_obj_set_pipelined_refresh);
+
+MP_PROPERTY_GETSET(busdisplay_busdisplay_pipelined_refresh_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_pipelined_refresh_obj,
+    (mp_obj_t)&busdisplay_busdisplay_set_pipelined_refresh_obj);
+
+//|     shadow_refresh: bool
+//|     """True when the display keeps a copy of what the panel shows, so that a refresh only
+//|     sends the pages and columns that actually changed. This suits monochrome OLEDs such as
+//|     the SSD1306 and SH1107, where the bus is slow and most updates change a few bytes.
+//|     Needs one byte of RAM per eight pixels and is only supported for 1-bit displays with
+//|     vertically packed pixels. Anything sent to the panel with `bus` directly is not
+//|     tracked. Defaults to False."""
+static mp_obj_t busdisplay_busdisplay_obj_get_shadow_refresh(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_busdisplay_busdisplay_get_shadow_refresh(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_get_shadow_refresh_obj, busdisplay_busdisplay_obj_get_shadow_refresh);
+
+static mp_obj_t busdisplay_busdisplay_obj_set_shadow_refresh(mp_obj_t self_in, mp_obj_t shadow_refresh) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+
+    common_hal_busdisplay_busdisplay_set_shadow_refresh(self, mp_obj_is_true(shadow_refresh));
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busdisplay_busdisplay_set_shadow_refresh_obj, busdisplay_busdisplay_obj_set_shadow_refresh);
+
+MP_PROPERTY_GETSET(busdisplay_busdisplay_shadow_refresh_obj,
+    (mp_obj_t)&busdisplay_busdisplay_get_shadow_refresh_obj,
+    (mp_obj_t)&busdisplay_busdisplay_set_shadow_refresh_obj);
+
 //|     width: int
 //|     """Gets the width of the board"""
 static mp_obj_t busdisplay_busdisplay_obj_get_width(mp_obj_t self_in) {
@@ -488,8 +561,11 @@ static const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_fill_row), MP_ROM_PTR(&busdisplay_busdisplay_fill_row_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&busdisplay_busdisplay_auto_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh_in_progress), MP_ROM_PTR(&busdisplay_busdisplay_refresh_in_progress_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&busdisplay_busdisplay_brightness_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pipelined_refresh), MP_ROM_PTR(&busdisplay_busdisplay_pipelined_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_shadow_refresh), MP_ROM_PTR(&busdisplay_busdisplay_shadow_refresh_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&busdisplay_busdisplay_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&busdisplay_busdisplay_height_obj) },
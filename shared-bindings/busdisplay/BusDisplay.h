@@ -26,7 +26,8 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     bool single_byte_bounds, bool data_as_commands, bool auto_refresh, uint16_t native_frames_per_second,
     bool backlight_on_high, bool SH1107_addressing, uint16_t backlight_pwm_frequency);
 
-bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame);
+bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame, bool blocking);
+bool common_hal_busdisplay_busdisplay_get_refresh_in_progress(busdisplay_busdisplay_obj_t *self);
 
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_auto_refresh(busdisplay_busdisplay_obj_t *self, bool auto_refresh);
@@ -39,6 +40,11 @@ void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *
 bool common_hal_busdisplay_busdisplay_get_dither(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_dither(busdisplay_busdisplay_obj_t *self, bool dither);
 
+bool common_hal_busdisplay_busdisplay_get_pipelined_refresh(busdisplay_busdisplay_obj_t *self);
+void common_hal_busdisplay_busdisplay_set_pipelined_refresh(busdisplay_busdisplay_obj_t *self, bool pipelined_refresh);
+bool common_hal_busdisplay_busdisplay_get_shadow_refresh(busdisplay_busdisplay_obj_t *self);
+void common_hal_busdisplay_busdisplay_set_shadow_refresh(busdisplay_busdisplay_obj_t *self, bool shadow_refresh);
+
 mp_float_t common_hal_busdisplay_busdisplay_get_brightness(busdisplay_busdisplay_obj_t *self);
 bool common_hal_busdisplay_busdisplay_set_brightness(busdisplay_busdisplay_obj_t *self, mp_float_t brightness);
 
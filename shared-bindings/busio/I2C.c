@@ -336,7 +336,6 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_obj, 1, busio_i2c_writeto);
 //|         """
 //|         ...
 //|
-//|
 static mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_address, ARG_out_buffer, ARG_in_buffer, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
@@ -386,6 +385,53 @@ static mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
+
+//|     def read_registers_into(
+//|         self, addresses: ReadableBuffer, register: int, buffer: WriteableBuffer
+//|     ) -> None:
+//|         """Read the same registers from several devices in one call, such as a set of
+//|         identical sensors.
+//|
+//|         ``buffer`` is split into ``len(addresses)`` equal slices. For each address, the
+//|         one byte ``register`` is written, followed by a repeated start and a read
+//|         that fills that device's slice. This is the same as calling
+//|         `writeto_then_readfrom` once per device, without the per-call overhead.
+//|
+//|         Each device takes about ``9 * (3 + bytes_per_device)`` bus clocks, which can be
+//|         used to budget the bus.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer addresses: 7-bit device addresses, one per byte
+//|         :param int register: the first register to read from each device
+//|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer to read into
+//|         """
+//|         ...
+//|
+//|
+static mp_obj_t busio_i2c_read_registers_into(size_t n_args, const mp_obj_t *args) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+
+    mp_buffer_info_t addresses;
+    mp_get_buffer_raise(args[1], &addresses, MP_BUFFER_READ);
+    mp_arg_validate_length_min(addresses.len, 1, MP_QSTR_addresses);
+    uint8_t reg = (uint8_t)mp_arg_validate_int_range(mp_obj_get_int(args[2]), 0, 255, MP_QSTR_register);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[3], &bufinfo, MP_BUFFER_WRITE);
+    size_t bytes_per_device = bufinfo.len / addresses.len;
+    mp_arg_validate_length_min(bytes_per_device, 1, MP_QSTR_buffer);
+
+    for (size_t i = 0; i < addresses.len; i++) {
+        uint8_t status = common_hal_busio_i2c_write_read(self, ((uint8_t *)addresses.buf)[i],
+            &reg, 1, ((uint8_t *)bufinfo.buf) + i * bytes_per_device, bytes_per_device);
+        if (status != 0) {
+            mp_raise_OSError(status);
+        }
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(busio_i2c_read_registers_into_obj, 4, 4, busio_i2c_read_registers_into);
 #endif // CIRCUITPY_BUSIO_I2C
 
 static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
@@ -403,6 +449,7 @@ static const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_registers_into), MP_ROM_PTR(&busio_i2c_read_registers_into_obj) },
     #endif // CIRCUITPY_BUSIO_I2C
 };
 
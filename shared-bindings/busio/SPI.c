@@ -285,6 +285,90 @@ static mp_obj_t busio_spi_write(size_t n_args, const mp_obj_t *pos_args, mp_map_
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_obj, 1, busio_spi_write);
 
+//|     def start_write(self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize) -> None:
+//|         """Start writing ``buffer`` and return while it is still being sent.
+//|         The SPI object must be locked.
+//|
+//|         Python can prepare the next batch while the bus is busy. Use `write_in_progress`
+//|         to poll for completion, or `finish_write` to wait for it. Any other operation on
+//|         this bus, including `configure` and `deinit`, waits for the write first, so it is
+//|         safe to deassert chip select right after `finish_write`. ``buffer`` must not be
+//|         changed until the write is finished.
+//|
+//|         On ports that can't write in the background this behaves like `write`.
+//|
+//|         :param ReadableBuffer buffer: write out the data in this buffer
+//|         :param int start: beginning of buffer slice
+//|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
+//|         """
+//|         ...
+//|
+
+static mp_obj_t busio_spi_start_write(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,     MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_start,      MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end,        MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    check_lock(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    // Compute bounds in terms of elements, not bytes.
+    int stride_in_bytes = mp_binary_get_size('@', bufinfo.typecode, NULL);
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len / stride_in_bytes;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    // Treat start and length in terms of bytes from now on.
+    start *= stride_in_bytes;
+    length *= stride_in_bytes;
+
+    if (length == 0) {
+        return mp_const_none;
+    }
+
+    const uint8_t *data = ((uint8_t *)bufinfo.buf) + start;
+    if (!common_hal_busio_spi_start_write(self, data, length) &&
+        !common_hal_busio_spi_write(self, data, length)) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_start_write_obj, 1, busio_spi_start_write);
+
+//|     def finish_write(self) -> None:
+//|         """Wait until the write begun by `start_write` has been completely sent."""
+//|         ...
+//|
+
+static mp_obj_t busio_spi_finish_write(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_busio_spi_finish_write(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_finish_write_obj, busio_spi_finish_write);
+
+//|     write_in_progress: bool
+//|     """True while a write begun by `start_write` is still being sent. (read-only)"""
+//|
+
+static mp_obj_t busio_spi_obj_get_write_in_progress(mp_obj_t self_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_busio_spi_get_write_in_progress(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_spi_get_write_in_progress_obj, busio_spi_obj_get_write_in_progress);
+
+MP_PROPERTY_GETTER(busio_spi_write_in_progress_obj,
+    (mp_obj_t)&busio_spi_get_write_in_progress_obj);
+
 
 //|     import sys
 //|
@@ -475,6 +559,9 @@ static const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_start_write), MP_ROM_PTR(&busio_spi_start_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finish_write), MP_ROM_PTR(&busio_spi_finish_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write_in_progress), MP_ROM_PTR(&busio_spi_write_in_progress_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
 
@@ -493,3 +580,15 @@ MP_DEFINE_CONST_OBJ_TYPE(
 busio_spi_obj_t *validate_obj_is_spi_bus(mp_obj_t obj, qstr arg_name) {
     return mp_arg_validate_type(obj, &busio_spi_type, arg_name);
 }
+
+// Ports without background writes say so and callers use common_hal_busio_spi_write.
+MP_WEAK bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, const uint8_t *data, size_t len) {
+    return false;
+}
+
+MP_WEAK void common_hal_busio_spi_finish_write(busio_spi_obj_t *self) {
+}
+
+MP_WEAK bool common_hal_busio_spi_get_write_in_progress(busio_spi_obj_t *self) {
+    return false;
+}
@@ -34,6 +34,17 @@ extern bool common_hal_busio_spi_write(busio_spi_obj_t *self, const uint8_t *dat
 // Reads in len bytes while outputting the byte write_value.
 extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value);
 
+// Starts writing len bytes in the background and returns immediately. Returns false
+// when the port can't do so; the caller should then fall back to
+// common_hal_busio_spi_write. data must stay valid until the write is finished.
+extern bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
+
+// Blocks until a write started by common_hal_busio_spi_start_write completes.
+extern void common_hal_busio_spi_finish_write(busio_spi_obj_t *self);
+
+// True until a write started by common_hal_busio_spi_start_write has been shifted out.
+extern bool common_hal_busio_spi_get_write_in_progress(busio_spi_obj_t *self);
+
 // Reads and write len bytes simultaneously.
 extern bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, const uint8_t *data_out, uint8_t *data_in, size_t len);
 
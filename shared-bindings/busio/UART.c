@@ -356,6 +356,34 @@ MP_PROPERTY_GETSET(busio_uart_timeout_obj,
     (mp_obj_t)&busio_uart_get_timeout_obj,
     (mp_obj_t)&busio_uart_set_timeout_obj);
 
+//|     def readinto_frame(self, buf: WriteableBuffer) -> Optional[int]:
+//|         """Read the oldest complete frame into ``buf``. A frame ends when the line goes idle
+//|         for a few character times. Any part of the frame that doesn't fit in ``buf`` is
+//|         discarded. Doesn't wait for a frame to arrive.
+//|
+//|         Mixing this with `read` or `readinto` is allowed but those split frames apart.
+//|
+//|         :return: number of bytes stored into ``buf`` or ``None`` when no frame is complete
+//|         :rtype: int or None"""
+//|         ...
+//|
+static mp_obj_t busio_uart_obj_readinto_frame(mp_obj_t self_in, mp_obj_t buf_in) {
+    busio_uart_obj_t *self = native_uart(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t frame_len;
+    if (!common_hal_busio_uart_readinto_frame(self, bufinfo.buf, bufinfo.len, &frame_len)) {
+        return mp_const_none;
+    }
+    return MP_OBJ_NEW_SMALL_INT(frame_len);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(busio_uart_readinto_frame_obj, busio_uart_obj_readinto_frame);
+
+MP_WEAK bool common_hal_busio_uart_readinto_frame(busio_uart_obj_t *self, uint8_t *data, size_t len, size_t *frame_len) {
+    mp_raise_NotImplementedError(NULL);
+}
+
 //|     def reset_input_buffer(self) -> None:
 //|         """Discard any unread characters in the input buffer."""
 //|         ...
@@ -425,6 +453,7 @@ static const mp_rom_map_elem_t busio_uart_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
 
+    { MP_ROM_QSTR(MP_QSTR_readinto_frame), MP_ROM_PTR(&busio_uart_readinto_frame_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_input_buffer), MP_ROM_PTR(&busio_uart_reset_input_buffer_obj) },
 
     // Properties
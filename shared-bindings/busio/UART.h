@@ -45,6 +45,8 @@ extern void common_hal_busio_uart_set_timeout(busio_uart_obj_t *self, mp_float_t
 
 extern uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self);
 extern void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self);
+// Returns false when no complete frame has been received.
+extern bool common_hal_busio_uart_readinto_frame(busio_uart_obj_t *self, uint8_t *data, size_t len, size_t *frame_len);
 extern bool common_hal_busio_uart_ready_to_tx(busio_uart_obj_t *self);
 
 extern void common_hal_busio_uart_never_reset(busio_uart_obj_t *self);
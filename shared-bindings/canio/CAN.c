@@ -188,8 +188,9 @@ static MP_DEFINE_CONST_FUN_OBJ_1(canio_can_restart_obj, canio_can_restart);
 //|         There are 14 filter blocks.  Each block can match 2 standard addresses with
 //|         mask or 1 extended address with mask.
 //|
-//|         ESP32S2 supports one Listener.  There is a single filter block, which can either match a
-//|         standard address with mask or an extended address with mask.
+//|         ESP32S2 supports one Listener with up to 8 matches.  There is a single filter block,
+//|         which is set to the narrowest mask that passes all the matches; messages it lets
+//|         through are then checked against each match in software.
 //|
 //|         i.MX RT10xx supports one Listener and 8 filter blocks per CAN interface.
 //|         Each interface is fully independent from the other.  A filter block can match
@@ -44,6 +44,39 @@ static mp_obj_t canio_listener_receive(mp_obj_t self_in) {
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+//|     def receive_into(self, buffer: WriteableBuffer) -> int:
+//|         """Reads as many messages as fit into ``buffer``, after waiting up to
+//|         ``self.timeout`` seconds for the first one, and returns how many were stored.
+//|
+//|         Unlike `receive`, this does not allocate. Each message is stored as a record of
+//|         `RECORD_SIZE` bytes laid out as ``struct.Struct("<IBBH8sI")``: the id, the
+//|         length, flags (``1`` if the id is extended, ``2`` for a remote transmission
+//|         request), two reserved bytes, the data padded to 8 bytes, and the time in
+//|         `supervisor.ticks_ms` milliseconds when the message was taken from the hardware.
+//|         An ``array.array("I")`` of ``5 * n`` items holds ``n`` messages.
+//|
+//|         :param WriteableBuffer buffer: Buffer to fill, usually a multiple of `RECORD_SIZE` bytes.
+//|         :return: The number of messages stored, ``0`` if none arrived in time.
+//|         :rtype: int
+//|         """
+//|         ...
+//|
+static mp_obj_t canio_listener_receive_into(mp_obj_t self_in, mp_obj_t buffer_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    size_t count = common_hal_canio_listener_receive_into(self, bufinfo.buf, bufinfo.len / sizeof(canio_message_record_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_receive_into_obj, canio_listener_receive_into);
+
+//|     RECORD_SIZE: int
+//|     """The size in bytes of each message record written by `receive_into`."""
+//|
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -145,11 +178,13 @@ MP_PROPERTY_GETSET(canio_listener_timeout_obj,
 
 
 static const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_RECORD_SIZE), MP_ROM_INT(sizeof(canio_message_record_t)) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&canio_listener_enter_obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&canio_listener_exit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
+    { MP_ROM_QSTR(MP_QSTR_receive_into), MP_ROM_PTR(&canio_listener_receive_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
 static MP_DEFINE_CONST_DICT(canio_listener_locals_dict, canio_listener_locals_dict_table);
@@ -18,6 +18,7 @@ void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_o
 void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self);
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self);
 mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self);
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, void *records, size_t count);
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self);
 float common_hal_canio_listener_get_timeout(canio_listener_obj_t *self);
 void common_hal_canio_listener_set_timeout(canio_listener_obj_t *self, float timeout);
@@ -0,0 +1,125 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/crc/CRC.h"
+
+//| class CRC:
+//|     def __init__(
+//|         self,
+//|         width: int,
+//|         poly: int,
+//|         *,
+//|         init: int = 0,
+//|         reflect_in: bool = False,
+//|         reflect_out: bool = False,
+//|         xor_out: int = 0,
+//|     ) -> None:
+//|         """A cyclic redundancy check computed over the data given to `update()`. The
+//|         parameters are those of the usual catalogues of CRCs. `crc.crc32()` and the other
+//|         functions in `crc` make the common ones.
+//|
+//|         :param int width: The number of bits in the CRC, from 8 to 32
+//|         :param int poly: The polynomial, without its top bit, such as ``0x1021``
+//|         :param int init: The starting value of the register
+//|         :param bool reflect_in: True for the bits of each byte to go in least significant first
+//|         :param bool reflect_out: True to reverse the bits of the register for `value`
+//|         :param int xor_out: Combined with the register by exclusive or for `value`
+//|
+//|         Check a Modbus RTU frame, which ends with its CRC least significant byte first::
+//|
+//|           import crc
+//|
+//|           check = crc.crc16_modbus(frame[:-2])
+//|           ok = check.value == frame[-2] | frame[-1] << 8
+//|         """
+//|         ...
+//|
+static uint32_t validate_bits(mp_obj_t value, mp_int_t width, qstr arg_name) {
+    mp_uint_t bits = mp_obj_int_get_uint_checked(value);
+    if (width < 32 && bits >> width != 0) {
+        mp_arg_error_invalid(arg_name);
+    }
+    return bits;
+}
+
+static mp_obj_t crc_crc_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_width, ARG_poly, ARG_init, ARG_reflect_in, ARG_reflect_out, ARG_xor_out };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_INT, {} },
+        { MP_QSTR_poly, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_init, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+        { MP_QSTR_reflect_in, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_reflect_out, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_xor_out, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t width = mp_arg_validate_int_range(args[ARG_width].u_int, 8, 32, MP_QSTR_width);
+    uint32_t poly = validate_bits(args[ARG_poly].u_obj, width, MP_QSTR_poly);
+    uint32_t init = validate_bits(args[ARG_init].u_obj, width, MP_QSTR_init);
+    uint32_t xor_out = validate_bits(args[ARG_xor_out].u_obj, width, MP_QSTR_xor_out);
+
+    crc_crc_obj_t *self = mp_obj_malloc(crc_crc_obj_t, &crc_crc_type);
+    common_hal_crc_crc_construct(self, width, poly, init, args[ARG_reflect_in].u_bool,
+        args[ARG_reflect_out].u_bool, xor_out);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def update(self, data: ReadableBuffer) -> None:
+//|         """Adds data to the CRC, following any given before."""
+//|         ...
+//|
+static mp_obj_t crc_crc_update(mp_obj_t self_in, mp_obj_t data) {
+    crc_crc_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    common_hal_crc_crc_update(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(crc_crc_update_obj, crc_crc_update);
+
+//|     def reset(self) -> None:
+//|         """Starts again, as though no data had been given."""
+//|         ...
+//|
+static mp_obj_t crc_crc_reset(mp_obj_t self_in) {
+    crc_crc_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_crc_crc_reset(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(crc_crc_reset_obj, crc_crc_reset);
+
+//|     value: int
+//|     """The CRC of the data so far. More data can still be given afterwards. (read-only)"""
+//|
+//|
+static mp_obj_t crc_crc_get_value(mp_obj_t self_in) {
+    crc_crc_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_crc_crc_get_value(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(crc_crc_get_value_obj, crc_crc_get_value);
+
+MP_PROPERTY_GETTER(crc_crc_value_obj,
+    (mp_obj_t)&crc_crc_get_value_obj);
+
+static const mp_rom_map_elem_t crc_crc_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_update), MP_ROM_PTR(&crc_crc_update_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&crc_crc_reset_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_value), MP_ROM_PTR(&crc_crc_value_obj) },
+};
+static MP_DEFINE_CONST_DICT(crc_crc_locals_dict, crc_crc_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    crc_crc_type,
+    MP_QSTR_CRC,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, crc_crc_make_new,
+    locals_dict, &crc_crc_locals_dict
+    );
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/crc/CRC.h"
+
+extern const mp_obj_type_t crc_crc_type;
+
+void common_hal_crc_crc_construct(crc_crc_obj_t *self, uint8_t width, uint32_t poly, uint32_t init,
+    bool reflect_in, bool reflect_out, uint32_t xor_out);
+void common_hal_crc_crc_update(crc_crc_obj_t *self, const uint8_t *data, size_t len);
+uint32_t common_hal_crc_crc_get_value(crc_crc_obj_t *self);
+void common_hal_crc_crc_reset(crc_crc_obj_t *self);
+
+// Ports with a CRC peripheral can work through some of data in this, by updating self->reg
+// for the bytes from the start of data it handled and returning how many that was. The rest
+// are done with the table.
+size_t common_hal_crc_crc_port_update(crc_crc_obj_t *self, const uint8_t *data, size_t len);
@@ -0,0 +1,90 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/crc/CRC.h"
+
+//| """Cyclic redundancy checks
+//|
+//| The `crc` module computes CRCs of any width from 8 to 32 bits and any polynomial, a byte at
+//| a time from a table. Where a port has a CRC peripheral, it is used for the CRCs it can do.
+//| """
+//|
+//|
+
+static mp_obj_t new_crc(uint8_t width, uint32_t poly, uint32_t init, bool reflect, uint32_t xor_out,
+    size_t n_args, const mp_obj_t *args) {
+    crc_crc_obj_t *self = mp_obj_malloc(crc_crc_obj_t, &crc_crc_type);
+    common_hal_crc_crc_construct(self, width, poly, init, reflect, reflect, xor_out);
+    if (n_args > 0) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(args[0], &bufinfo, MP_BUFFER_READ);
+        common_hal_crc_crc_update(self, bufinfo.buf, bufinfo.len);
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//| def crc8(data: ReadableBuffer = b"") -> CRC:
+//|     """Returns a `CRC` for CRC-8 (SMBus), started with data."""
+//|     ...
+//|
+//|
+static mp_obj_t crc_crc8(size_t n_args, const mp_obj_t *args) {
+    return new_crc(8, 0x07, 0, false, 0, n_args, args);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(crc_crc8_obj, 0, 1, crc_crc8);
+
+//| def crc16_ccitt(data: ReadableBuffer = b"") -> CRC:
+//|     """Returns a `CRC` for CRC-16/CCITT-FALSE, as used by XMODEM-1K and many radios,
+//|     started with data."""
+//|     ...
+//|
+//|
+static mp_obj_t crc_crc16_ccitt(size_t n_args, const mp_obj_t *args) {
+    return new_crc(16, 0x1021, 0xffff, false, 0, n_args, args);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(crc_crc16_ccitt_obj, 0, 1, crc_crc16_ccitt);
+
+//| def crc16_modbus(data: ReadableBuffer = b"") -> CRC:
+//|     """Returns a `CRC` for the CRC-16 of Modbus RTU, started with data."""
+//|     ...
+//|
+//|
+static mp_obj_t crc_crc16_modbus(size_t n_args, const mp_obj_t *args) {
+    return new_crc(16, 0x8005, 0xffff, true, 0, n_args, args);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(crc_crc16_modbus_obj, 0, 1, crc_crc16_modbus);
+
+//| def crc32(data: ReadableBuffer = b"") -> CRC:
+//|     """Returns a `CRC` for the CRC-32 of Ethernet, zlib and `binascii.crc32`, started with
+//|     data."""
+//|     ...
+//|
+//|
+static mp_obj_t crc_crc32(size_t n_args, const mp_obj_t *args) {
+    return new_crc(32, 0x04c11db7, 0xffffffff, true, 0xffffffff, n_args, args);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(crc_crc32_obj, 0, 1, crc_crc32);
+
+static const mp_rom_map_elem_t crc_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_crc) },
+    { MP_ROM_QSTR(MP_QSTR_CRC), MP_ROM_PTR(&crc_crc_type) },
+    { MP_ROM_QSTR(MP_QSTR_crc8), MP_ROM_PTR(&crc_crc8_obj) },
+    { MP_ROM_QSTR(MP_QSTR_crc16_ccitt), MP_ROM_PTR(&crc_crc16_ccitt_obj) },
+    { MP_ROM_QSTR(MP_QSTR_crc16_modbus), MP_ROM_PTR(&crc_crc16_modbus_obj) },
+    { MP_ROM_QSTR(MP_QSTR_crc32), MP_ROM_PTR(&crc_crc32_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(crc_module_globals, crc_module_globals_table);
+
+const mp_obj_module_t crc_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&crc_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_crc, crc_module);
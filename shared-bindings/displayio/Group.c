@@ -192,6 +192,22 @@ static mp_obj_t displayio_group_obj_index(mp_obj_t self_in, mp_obj_t layer) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_group_index_obj, displayio_group_obj_index);
 
+//|     def hit_test(self, x: int, y: int) -> Optional[Union[Group, TileGrid]]:
+//|         """Returns the topmost visible member that covers the pixel at x, y or None. The
+//|         coordinates are in the same space as the members' x and y, such as a touch point when
+//|         this is the root group. Nested groups are searched by their TileGrids and are
+//|         returned when one of them is hit. vectorio shapes are not tested. Returns None when the
+//|         group isn't shown on a display."""
+//|         ...
+//|
+static mp_obj_t displayio_group_obj_hit_test(mp_obj_t self_in, mp_obj_t x_obj, mp_obj_t y_obj) {
+    displayio_group_t *self = native_group(self_in);
+    mp_int_t x = mp_arg_validate_int_range(mp_obj_get_int(x_obj), -32768, 32767, MP_QSTR_x);
+    mp_int_t y = mp_arg_validate_int_range(mp_obj_get_int(y_obj), -32768, 32767, MP_QSTR_y);
+    return common_hal_displayio_group_hit_test(self, x, y);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(displayio_group_hit_test_obj, displayio_group_obj_hit_test);
+
 //|     def pop(
 //|         self, i: int = -1
 //|     ) -> Union[vectorio.Circle, vectorio.Rectangle, vectorio.Polygon, Group, TileGrid]:
@@ -336,6 +352,7 @@ static const mp_rom_map_elem_t displayio_group_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_append), MP_ROM_PTR(&displayio_group_append_obj) },
     { MP_ROM_QSTR(MP_QSTR_insert), MP_ROM_PTR(&displayio_group_insert_obj) },
     { MP_ROM_QSTR(MP_QSTR_index), MP_ROM_PTR(&displayio_group_index_obj) },
+    { MP_ROM_QSTR(MP_QSTR_hit_test), MP_ROM_PTR(&displayio_group_hit_test_obj) },
     { MP_ROM_QSTR(MP_QSTR_pop), MP_ROM_PTR(&displayio_group_pop_obj) },
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&displayio_group_remove_obj) },
     { MP_ROM_QSTR(MP_QSTR_sort), MP_ROM_PTR(&displayio_group_sort_obj) },
@@ -49,4 +49,9 @@ typedef bool (*display_bus_begin_transaction)(mp_obj_t bus);
 typedef void (*display_bus_send)(mp_obj_t bus, display_byte_type_t byte_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
 typedef void (*display_bus_end_transaction)(mp_obj_t bus);
+// Optional: start sending data in the background. Returns false if it can't, in
+// which case nothing was sent. data must stay valid until finish_send returns.
+typedef bool (*display_bus_start_send)(mp_obj_t bus, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length);
+typedef void (*display_bus_finish_send)(mp_obj_t bus);
 typedef void (*display_bus_collect_ptrs)(mp_obj_t bus);
@@ -289,6 +289,14 @@ static void dotclockframebuffer_framebuffer_swapbuffers(mp_obj_t self_in, uint8_
     common_hal_dotclockframebuffer_framebuffer_refresh(self);
 }
 
+static void dotclockframebuffer_framebuffer_swapbuffers_areas(mp_obj_t self_in, const displayio_area_t *dirty_areas, size_t dirty_area_count) {
+    dotclockframebuffer_framebuffer_obj_t *self = (dotclockframebuffer_framebuffer_obj_t *)self_in;
+    for (size_t i = 0; i < dirty_area_count; i++) {
+        const displayio_area_t *area = &dirty_areas[i];
+        common_hal_dotclockframebuffer_framebuffer_refresh_area(self, area->x1, area->y1, area->x2, area->y2);
+    }
+}
+
 static void dotclockframebuffer_framebuffer_deinit_proto(mp_obj_t self_in) {
     common_hal_dotclockframebuffer_framebuffer_deinit(self_in);
 }
@@ -350,6 +358,7 @@ static const framebuffer_p_t dotclockframebuffer_framebuffer_proto = {
     .get_bytes_per_cell = dotclockframebuffer_framebuffer_get_bytes_per_cell_proto,
     .get_native_frames_per_second = dotclockframebuffer_framebuffer_get_native_frames_per_second_proto,
     .swapbuffers = dotclockframebuffer_framebuffer_swapbuffers,
+    .swapbuffers_areas = dotclockframebuffer_framebuffer_swapbuffers_areas,
     .deinit = dotclockframebuffer_framebuffer_deinit_proto,
 };
 
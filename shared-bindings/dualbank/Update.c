@@ -0,0 +1,133 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Update.h"
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+//| class Update:
+//|     """Writes a new firmware image to the next-update partition as it arrives.
+//|
+//|     The image is written in order, one chunk after another, and hashed with SHA-256 on the
+//|     way. Pass each chunk to `write` straight from ``socket.recv_into`` so it doesn't have to be
+//|     copied or hashed in Python. Call `dualbank.switch()` once the whole image is written.
+//|
+//|     .. code-block:: python
+//|
+//|         import dualbank
+//|
+//|         update = dualbank.Update(size=image_size)
+//|         buf = bytearray(4096)
+//|         remaining = image_size
+//|         while remaining:
+//|             n = sock.recv_into(buf, min(remaining, len(buf)))
+//|             update.write(memoryview(buf)[:n])
+//|             remaining -= n
+//|         if update.sha256 != expected_sha256:
+//|             raise RuntimeError("bad download")
+//|         dualbank.switch()
+//|     """
+//|
+//|     def __init__(self, *, size: int = 0) -> None:
+//|         """Starts a new update.
+//|
+//|         :param int size: The size of the image, if known. All of it is erased when the first
+//|           chunk is written so later writes don't wait for erases. When 0, each flash sector is
+//|           erased when the image reaches it."""
+//|         ...
+//|
+static mp_obj_t dualbank_update_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    #if CIRCUITPY_STORAGE_EXTEND
+    dualbank_raise_error_if_storage_extended();
+    #endif
+
+    mp_int_t size = mp_arg_validate_int_min(args[ARG_size].u_int, 0, MP_QSTR_size);
+
+    dualbank_update_obj_t *self = mp_obj_malloc(dualbank_update_obj_t, &dualbank_update_type);
+    common_hal_dualbank_update_construct(self, size);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|     def write(self, buf: ReadableBuffer) -> int:
+//|         """Append the buffer to the image.
+//|
+//|         :return: the number of bytes written
+//|         :rtype: int"""
+//|         ...
+//|
+static mp_uint_t dualbank_update_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    #if CIRCUITPY_STORAGE_EXTEND
+    dualbank_raise_error_if_storage_extended();
+    #endif
+
+    common_hal_dualbank_update_write(self, buf_in, size);
+    return size;
+}
+
+//|     bytes_written: int
+//|     """The number of bytes written so far."""
+static mp_obj_t dualbank_update_get_bytes_written(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_dualbank_update_get_bytes_written(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_get_bytes_written_obj, dualbank_update_get_bytes_written);
+
+MP_PROPERTY_GETTER(dualbank_update_bytes_written_obj,
+    (mp_obj_t)&dualbank_update_get_bytes_written_obj);
+
+//|     sha256: bytes
+//|     """The SHA-256 digest of everything written so far."""
+//|
+static mp_obj_t dualbank_update_get_sha256(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t digest[32];
+    common_hal_dualbank_update_get_sha256(self, digest);
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_get_sha256_obj, dualbank_update_get_sha256);
+
+MP_PROPERTY_GETTER(dualbank_update_sha256_obj,
+    (mp_obj_t)&dualbank_update_get_sha256_obj);
+
+static const mp_rom_map_elem_t dualbank_update_locals_dict_table[] = {
+    // Standard stream methods.
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_bytes_written), MP_ROM_PTR(&dualbank_update_bytes_written_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&dualbank_update_sha256_obj) },
+};
+static MP_DEFINE_CONST_DICT(dualbank_update_locals_dict, dualbank_update_locals_dict_table);
+
+static const mp_stream_p_t dualbank_update_stream_p = {
+    .read = NULL,
+    .write = dualbank_update_write,
+    .ioctl = NULL,
+    .is_text = false,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    dualbank_update_type,
+    MP_QSTR_Update,
+    MP_TYPE_FLAG_NONE,
+    make_new, dualbank_update_make_new,
+    locals_dict, &dualbank_update_locals_dict,
+    protocol, &dualbank_update_stream_p
+    );
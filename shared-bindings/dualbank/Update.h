@@ -0,0 +1,16 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common-hal/dualbank/Update.h"
+
+extern const mp_obj_type_t dualbank_update_type;
+
+void common_hal_dualbank_update_construct(dualbank_update_obj_t *self, size_t image_size);
+void common_hal_dualbank_update_write(dualbank_update_obj_t *self, const uint8_t *buf, size_t len);
+size_t common_hal_dualbank_update_get_bytes_written(dualbank_update_obj_t *self);
+void common_hal_dualbank_update_get_sha256(dualbank_update_obj_t *self, uint8_t digest[32]);
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Update.h"
 
 #if CIRCUITPY_STORAGE_EXTEND
 #include "supervisor/flash.h"
@@ -24,6 +25,8 @@
 //| and on a successful validation this partition is set as the boot partition.
 //| On next reset, firmware will be loaded from this partition.
 //|
+//| To update while the image downloads, write it through a `dualbank.Update` instead.
+//|
 //| Use cases:
 //|     * Can be used for ``OTA`` Over-The-Air updates.
 //|     * Can be used for ``dual-boot`` of different firmware versions or platforms.
@@ -50,7 +53,7 @@
 //|
 
 #if CIRCUITPY_STORAGE_EXTEND
-static void raise_error_if_storage_extended(void) {
+void dualbank_raise_error_if_storage_extended(void) {
     if (supervisor_flash_get_extended()) {
         mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("%q is %q"), MP_QSTR_storage, MP_QSTR_extended);
     }
@@ -76,7 +79,7 @@ static mp_obj_t dualbank_flash(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     };
 
     #if CIRCUITPY_STORAGE_EXTEND
-    raise_error_if_storage_extended();
+    dualbank_raise_error_if_storage_extended();
     #endif
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -104,7 +107,7 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_flash_obj, 0, dualbank_flash);
 //|
 static mp_obj_t dualbank_switch(void) {
     #if CIRCUITPY_STORAGE_EXTEND
-    raise_error_if_storage_extended();
+    dualbank_raise_error_if_storage_extended();
     #endif
     common_hal_dualbank_switch();
     return mp_const_none;
@@ -117,6 +120,8 @@ static const mp_rom_map_elem_t dualbank_module_globals_table[] = {
     // module functions
     { MP_ROM_QSTR(MP_QSTR_flash), MP_ROM_PTR(&dualbank_flash_obj) },
     { MP_ROM_QSTR(MP_QSTR_switch), MP_ROM_PTR(&dualbank_switch_obj) },
+    // module classes
+    { MP_ROM_QSTR(MP_QSTR_Update), MP_ROM_PTR(&dualbank_update_type) },
 };
 static MP_DEFINE_CONST_DICT(dualbank_module_globals, dualbank_module_globals_table);
 
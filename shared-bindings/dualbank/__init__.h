@@ -10,3 +10,7 @@
 
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
+
+#if CIRCUITPY_STORAGE_EXTEND
+extern void dualbank_raise_error_if_storage_extended(void);
+#endif
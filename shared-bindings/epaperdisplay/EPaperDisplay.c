@@ -66,6 +66,10 @@
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
 //|         address_little_endian: bool = False,
+//|         partial_start_sequence: Optional[circuitpython_typing.ReadableBuffer] = None,
+//|         partial_refresh_display_command: Optional[Union[int, circuitpython_typing.ReadableBuffer]] = None,
+//|         partial_refresh_time: Optional[float] = None,
+//|         partial_refreshes_per_full: int = 10,
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`fourwire.FourWire` or `paralleldisplaybus.ParallelBus`).
 //|
@@ -109,9 +113,31 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param ~circuitpython_typing.ReadableBuffer partial_start_sequence: Byte-packed command sequence sent instead of ``start_sequence`` before a partial refresh. Typically loads the partial update waveform LUT. Defaults to ``start_sequence``.
+//|         :param int partial_refresh_display_command: Command used to start a partial refresh. Single int or byte-packed command sequence. When None, every refresh is a full refresh.
+//|         :param float partial_refresh_time: Time it takes to partially refresh the display. Defaults to ``refresh_time``. Ignored when busy_pin is provided.
+//|         :param int partial_refreshes_per_full: Number of partial refreshes to do before a full refresh clears any ghosting. 0 never forces a full refresh.
 //|         """
 //|         ...
 //|
+// Refresh commands may be a single command int or a byte-packed command sequence.
+static const uint8_t *get_refresh_sequence(mp_obj_t refresh_obj, bool two_byte_sequence_length, qstr arg_name, size_t *len) {
+    mp_buffer_info_t refresh_bufinfo;
+    mp_int_t refresh_command;
+    if (mp_obj_get_int_maybe(refresh_obj, &refresh_command)) {
+        uint8_t *command_buf = m_malloc_without_collect(3);
+        command_buf[0] = refresh_command;
+        command_buf[1] = 0;
+        command_buf[2] = 0;
+        *len = two_byte_sequence_length? 3: 2;
+        return command_buf;
+    } else if (mp_get_buffer(refresh_obj, &refresh_bufinfo, MP_BUFFER_READ)) {
+        *len = refresh_bufinfo.len;
+        return refresh_bufinfo.buf;
+    }
+    mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), arg_name);
+}
+
 static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_display_bus, ARG_start_sequence, ARG_stop_sequence, ARG_width, ARG_height,
            ARG_ram_width, ARG_ram_height, ARG_colstart, ARG_rowstart, ARG_rotation,
@@ -120,7 +146,9 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper, ARG_spectra6,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian,
+           ARG_partial_start_sequence, ARG_partial_refresh_display_command, ARG_partial_refresh_time,
+           ARG_partial_refreshes_per_full };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -153,6 +181,10 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_partial_start_sequence, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_refresh_display_command, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_refresh_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_partial_refreshes_per_full, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 10} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -187,23 +219,15 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
 
     bool two_byte_sequence_length = args[ARG_two_byte_sequence_length].u_bool;
 
-    mp_obj_t refresh_obj = args[ARG_refresh_display_command].u_obj;
-    const uint8_t *refresh_buf;
-    mp_buffer_info_t refresh_bufinfo;
-    size_t refresh_buf_len = 0;
-    mp_int_t refresh_command;
-    if (mp_obj_get_int_maybe(refresh_obj, &refresh_command)) {
-        uint8_t *command_buf = m_malloc_without_collect(3);
-        command_buf[0] = refresh_command;
-        command_buf[1] = 0;
-        command_buf[2] = 0;
-        refresh_buf = command_buf;
-        refresh_buf_len = two_byte_sequence_length? 3: 2;
-    } else if (mp_get_buffer(refresh_obj, &refresh_bufinfo, MP_BUFFER_READ)) {
-        refresh_buf = refresh_bufinfo.buf;
-        refresh_buf_len = refresh_bufinfo.len;
-    } else {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_refresh_display_command);
+    size_t refresh_buf_len;
+    const uint8_t *refresh_buf = get_refresh_sequence(args[ARG_refresh_display_command].u_obj,
+        two_byte_sequence_length, MP_QSTR_refresh_display_command, &refresh_buf_len);
+
+    mp_int_t partial_refreshes_per_full = mp_arg_validate_int_range(args[ARG_partial_refreshes_per_full].u_int,
+        0, 0xffff, MP_QSTR_partial_refreshes_per_full);
+    mp_float_t partial_refresh_time = refresh_time;
+    if (args[ARG_partial_refresh_time].u_obj != mp_const_none) {
+        partial_refresh_time = mp_obj_get_float(args[ARG_partial_refresh_time].u_obj);
     }
 
     self->base.type = &epaperdisplay_epaperdisplay_type;
@@ -222,6 +246,23 @@ static mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
 
+    if (args[ARG_partial_refresh_display_command].u_obj != mp_const_none) {
+        size_t partial_refresh_buf_len;
+        const uint8_t *partial_refresh_buf = get_refresh_sequence(args[ARG_partial_refresh_display_command].u_obj,
+            two_byte_sequence_length, MP_QSTR_partial_refresh_display_command, &partial_refresh_buf_len);
+        const uint8_t *partial_start_buf = NULL;
+        size_t partial_start_buf_len = 0;
+        if (args[ARG_partial_start_sequence].u_obj != mp_const_none) {
+            mp_buffer_info_t partial_start_bufinfo;
+            mp_get_buffer_raise(args[ARG_partial_start_sequence].u_obj, &partial_start_bufinfo, MP_BUFFER_READ);
+            partial_start_buf = partial_start_bufinfo.buf;
+            partial_start_buf_len = partial_start_bufinfo.len;
+        }
+        epaperdisplay_epaperdisplay_set_partial_refresh_parameters(self,
+            partial_start_buf, partial_start_buf_len, partial_refresh_buf, partial_refresh_buf_len,
+            partial_refresh_time, partial_refreshes_per_full);
+    }
+
     return self;
 }
 
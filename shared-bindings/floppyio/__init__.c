@@ -162,6 +162,88 @@ static mp_obj_t floppyio_mfm_readinto(size_t n_args, const mp_obj_t *pos_args, m
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(floppyio_mfm_readinto_obj, 0, floppyio_mfm_readinto);
 
+//| def mfm_track_readinto(
+//|     buffer: WriteableBuffer,
+//|     data: digitalio.DigitalInOut,
+//|     index: digitalio.DigitalInOut,
+//|     flux_t2_max: int,
+//|     flux_t3_max: int,
+//|     validity: bytearray | None = None,
+//|     clear_validity: bool = True,
+//|     index_wait: float = 0.220,
+//| ) -> int:
+//|     """Read a track of MFM sectors straight from the drive into the buffer
+//|
+//|     This is like `flux_readinto` followed by `mfm_readinto`, except that the sectors are
+//|     decoded while the flux is being read and no flux buffer is needed. Reading stops after one
+//|     revolution of the disk, or as soon as every sector has been read.
+//|
+//|     Not all ports support this.
+//|
+//|     :param buffer: Read data into this buffer.  Byte length must be a multiple of 512.
+//|     :param data: Pin on which the flux data appears
+//|     :param index: Pin on which the index pulse appears
+//|     :param t2_max: Maximum time of a flux cell in counts, as for `mfm_readinto`.
+//|     :param t3_max: Nominal time of a flux cell in counts, as for `mfm_readinto`.
+//|     :param validity: Optional bytearray. For each sector successfully read, the corresponding validity entry is set to ``1`` and previously valid sectors are not decoded.
+//|     :param clear_validity: If `True`, clear the validity information before reading and attempt to read all sectors.
+//|     :param index_wait: Time to wait, in seconds, for the index pulse
+//|     :return: The number of valid sectors in the buffer
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t floppyio_mfm_track_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    #if CIRCUITPY_DIGITALIO
+    enum { ARG_buffer, ARG_data, ARG_index, ARG_t2_max, ARG_t3_max, ARG_validity, ARG_clear_validity, ARG_index_wait };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_index, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_flux_t2_max, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_flux_t3_max, MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_validity, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_clear_validity, MP_ARG_BOOL, {.u_bool = true } },
+        { MP_QSTR_index_wait, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    if (bufinfo.len % 512 != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Buffer must be a multiple of %d bytes"), 512);
+    }
+    size_t n_sectors = bufinfo.len / 512;
+
+    digitalio_digitalinout_obj_t *data = assert_digitalinout(args[ARG_data].u_obj);
+    digitalio_digitalinout_obj_t *index = assert_digitalinout(args[ARG_index].u_obj);
+
+    mp_buffer_info_t bufinfo_validity;
+    uint8_t validity_buf[n_sectors];
+    if (args[ARG_validity].u_obj) {
+        mp_get_buffer_raise(args[ARG_validity].u_obj, &bufinfo_validity, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(bufinfo_validity.len, n_sectors, MP_QSTR_validity);
+        if (args[ARG_clear_validity].u_bool) {
+            memset(bufinfo_validity.buf, 0, n_sectors);
+        }
+    } else {
+        bufinfo_validity.buf = &validity_buf;
+        bufinfo_validity.len = n_sectors;
+        memset(validity_buf, 0, sizeof(validity_buf));
+    }
+
+    mp_int_t index_wait_ms = args[ARG_index_wait].u_obj ?
+        MICROPY_FLOAT_C_FUN(round)(mp_arg_validate_type_float(args[ARG_index_wait].u_obj, MP_QSTR_index_wait) * 1000) :
+        220;
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_floppyio_mfm_track_readinto(&bufinfo, bufinfo_validity.buf, data, index, index_wait_ms, args[ARG_t2_max].u_int, args[ARG_t3_max].u_int));
+    #else
+    mp_raise_NotImplementedError(NULL);
+    #endif
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(floppyio_mfm_track_readinto_obj, 0, floppyio_mfm_track_readinto);
+
 //| samplerate: int
 //| """The approximate sample rate in Hz used by flux_readinto."""
 
@@ -169,6 +251,7 @@ static const mp_rom_map_elem_t floppyio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_floppyio) },
     { MP_ROM_QSTR(MP_QSTR_flux_readinto), MP_ROM_PTR(&floppyio_flux_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_mfm_readinto), MP_ROM_PTR(&floppyio_mfm_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mfm_track_readinto), MP_ROM_PTR(&floppyio_mfm_track_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_samplerate), MP_ROM_INT(FLOPPYIO_SAMPLERATE) },
 };
 static MP_DEFINE_CONST_DICT(floppyio_module_globals, floppyio_module_globals_table);
@@ -11,6 +11,7 @@
 #if CIRCUITPY_DIGITALIO
 #include "common-hal/digitalio/DigitalInOut.h"
 int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms);
+int common_hal_floppyio_mfm_track_readinto(const mp_buffer_info_t *buf, uint8_t *validity, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms, size_t t2_max, size_t t3_max);
 #endif
 
 int common_hal_floppyio_mfm_readinto(const mp_buffer_info_t *buf, const mp_buffer_info_t *flux_buf, uint8_t *validity, size_t t2_max, size_t t3_max);
@@ -13,6 +13,9 @@
 #include "shared/runtime/context_manager_helpers.h"
 #include "shared-bindings/util.h"
 #include "shared-bindings/gifio/OnDiskGif.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
 
 //| class OnDiskGif:
 //|     """Loads one frame of a GIF into memory at a time.
@@ -85,14 +88,28 @@
 //|       odg = None
 //|       gc.collect()
 //|
+//|     Frames can also be decoded a line at a time straight to a `busdisplay.BusDisplay`. This
+//|     needs no frame bitmap, so pass ``use_bitmap=False`` to not allocate one:
+//|
+//|     .. code-block:: Python
+//|
+//|       display.root_group = None
+//|       display.auto_refresh = False
+//|       odg = gifio.OnDiskGif('/sample.gif', use_bitmap=False)
+//|
+//|       while True:
+//|           time.sleep(odg.next_frame(display))
+//|
 //|     """
 //|
-//|     def __init__(self, file: str) -> None:
+//|     def __init__(self, file: str, *, use_palette: bool = False, use_bitmap: bool = True) -> None:
 //|         """Create an `OnDiskGif` object with the given file.
 //|         The GIF frames are decoded into RGB565 big-endian format.
 //|         `displayio` expects little-endian, so the example above uses `Colorspace.RGB565_SWAPPED`.
 //|
 //|         :param file file: The name of the GIF file.
+//|         :param bool use_bitmap: Allocate `bitmap` to hold the current frame. Only frames
+//|             decoded straight to a display work without it.
 //|
 //|         If the image is too large it will be cropped at the bottom and right when displayed.
 //|
@@ -103,10 +120,11 @@
 //|         ...
 //|
 static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_filename, ARG_use_palette, NUM_ARGS };
+    enum { ARG_filename, ARG_use_palette, ARG_use_bitmap, NUM_ARGS };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_filename, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_use_palette, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_use_bitmap, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
     };
     MP_STATIC_ASSERT(MP_ARRAY_SIZE(allowed_args) == NUM_ARGS);
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -122,7 +140,8 @@ static mp_obj_t gifio_ondiskgif_make_new(const mp_obj_type_t *type, size_t n_arg
     }
 
     gifio_ondiskgif_t *self = mp_obj_malloc(gifio_ondiskgif_t, &gifio_ondiskgif_type);
-    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool);
+    common_hal_gifio_ondiskgif_construct(self, MP_OBJ_TO_PTR(filename), args[ARG_use_palette].u_bool,
+        args[ARG_use_bitmap].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -174,8 +193,8 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_height_obj, gifio_ondiskgif_obj_ge
 MP_PROPERTY_GETTER(gifio_ondiskgif_height_obj,
     (mp_obj_t)&gifio_ondiskgif_get_height_obj);
 
-//|     bitmap: displayio.Bitmap
-//|     """The bitmap used to hold the current frame."""
+//|     bitmap: Optional[displayio.Bitmap]
+//|     """The bitmap used to hold the current frame. `None` when created with ``use_bitmap=False``."""
 static mp_obj_t gifio_ondiskgif_obj_get_bitmap(mp_obj_t self_in) {
     gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -203,17 +222,50 @@ MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_get_palette_obj, gifio_ondiskgif_obj_g
 MP_PROPERTY_GETTER(gifio_ondiskgif_palette_obj,
     (mp_obj_t)&gifio_ondiskgif_get_palette_obj);
 
-//|     def next_frame(self) -> float:
-//|         """Loads the next frame. Returns expected delay before the next frame in seconds."""
+//|     def next_frame(
+//|         self, display: Optional[busdisplay.BusDisplay] = None, *, x: int = 0, y: int = 0
+//|     ) -> float:
+//|         """Loads the next frame. Returns expected delay before the next frame in seconds.
 //|
-static mp_obj_t gifio_ondiskgif_obj_next_frame(mp_obj_t self_in) {
-    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(self_in);
+//|         If a `busdisplay.BusDisplay` is given, each line is sent to the display as soon as it
+//|         is decoded instead of going into `bitmap`. The display must use a 16-bit colorspace
+//|         and the GIF must not use ``use_palette``. Transparent pixels leave the screen as it
+//|         was, so frames build on each other like they do in `bitmap`. Set the display's
+//|         ``root_group`` to `None` first so a refresh doesn't draw over the animation.
+//|
+//|         :param busdisplay.BusDisplay display: Optional display to draw the frame on
+//|         :param int x: Horizontal position on the display of the GIF's left edge
+//|         :param int y: Vertical position on the display of the GIF's top edge
+//|         """
+//|
+static mp_obj_t gifio_ondiskgif_obj_next_frame(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_display, ARG_x, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_display, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_x, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_y, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+    };
+    gifio_ondiskgif_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     check_for_deinit(self);
-    return mp_obj_new_float((float)common_hal_gifio_ondiskgif_next_frame(self, true) / 1000);
+    mp_obj_t display_in = args[ARG_display].u_obj;
+    if (display_in == mp_const_none) {
+        return mp_obj_new_float((float)common_hal_gifio_ondiskgif_next_frame(self, true) / 1000);
+    }
+    #if CIRCUITPY_BUSDISPLAY
+    mp_arg_validate_type(display_in, &busdisplay_busdisplay_type, MP_QSTR_display);
+    busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(display_in);
+    int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, common_hal_busdisplay_busdisplay_get_width(display), MP_QSTR_x);
+    int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, common_hal_busdisplay_busdisplay_get_height(display), MP_QSTR_y);
+    return mp_obj_new_float((float)common_hal_gifio_ondiskgif_next_frame_into_display(self, display, x, y) / 1000);
+    #else
+    mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_display);
+    #endif
 }
 
-MP_DEFINE_CONST_FUN_OBJ_1(gifio_ondiskgif_next_frame_obj, gifio_ondiskgif_obj_next_frame);
+MP_DEFINE_CONST_FUN_OBJ_KW(gifio_ondiskgif_next_frame_obj, 1, gifio_ondiskgif_obj_next_frame);
 
 
 //|     duration: float
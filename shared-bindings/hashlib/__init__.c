@@ -19,8 +19,8 @@
 //|
 //|
 //| def new(name: str, data: bytes = b"") -> hashlib.Hash:
-//|     """Returns a Hash object setup for the named algorithm. Raises ValueError when the named
-//|        algorithm is unsupported.
+//|     """Returns a Hash object setup for the named algorithm, ``"sha1"`` or ``"sha256"``. Raises
+//|        ValueError when the named algorithm is unsupported.
 //|
 //|     :return: a hash object for the given algorithm
 //|     :rtype: hashlib.Hash"""
@@ -38,25 +38,37 @@ static mp_obj_t mp_obj_new_i2ctarget_i2c_target_request(i2ctarget_i2c_target_obj
 //|         sda: microcontroller.Pin,
 //|         addresses: Sequence[int],
 //|         smbus: bool = False,
+//|         *,
+//|         registers: Optional[WriteableBuffer] = None,
 //|     ) -> None:
 //|         """I2C is a two-wire protocol for communicating between devices.
 //|         This implements the target (peripheral, sensor, secondary) side.
 //|
+//|         When ``registers`` is given, the target acts like a typical register based device and
+//|         answers the controller from an interrupt, so it keeps responding while the VM is busy.
+//|         The first byte of a write sets the register pointer and the rest are stored from there.
+//|         A read returns bytes starting at the register pointer. The pointer moves on by one for
+//|         every byte and wraps around at the end of ``registers``. Use `get_change` to find out
+//|         what the controller wrote. `request` can't be used in this mode.
+//|
 //|         :param ~microcontroller.Pin scl: The clock pin
 //|         :param ~microcontroller.Pin sda: The data pin
 //|         :param addresses: The I2C addresses to respond to (how many is hardware dependent).
 //|         :type addresses: list[int]
-//|         :param bool smbus: Use SMBUS timings if the hardware supports it"""
+//|         :param bool smbus: Use SMBUS timings if the hardware supports it
+//|         :param ~circuitpython_typing.WriteableBuffer registers: Contents of up to 256 registers,
+//|           read and written in place. Only available on some ports."""
 //|         ...
 //|
 static mp_obj_t i2ctarget_i2c_target_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     i2ctarget_i2c_target_obj_t *self = mp_obj_malloc_with_finaliser(i2ctarget_i2c_target_obj_t, &i2ctarget_i2c_target_type);
-    enum { ARG_scl, ARG_sda, ARG_addresses, ARG_smbus };
+    enum { ARG_scl, ARG_sda, ARG_addresses, ARG_smbus, ARG_registers };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_scl, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_sda, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_addresses, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_smbus, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+        { MP_QSTR_registers, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -78,7 +90,14 @@ static mp_obj_t i2ctarget_i2c_target_make_new(const mp_obj_type_t *type, size_t
         mp_raise_ValueError(MP_ERROR_TEXT("addresses is empty"));
     }
 
-    common_hal_i2ctarget_i2c_target_construct(self, scl, sda, addresses, i, args[ARG_smbus].u_bool);
+    mp_buffer_info_t registers = { .buf = NULL, .len = 0 };
+    if (args[ARG_registers].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_registers].u_obj, &registers, MP_BUFFER_WRITE);
+        mp_arg_validate_length_range(registers.len, 1, 256, MP_QSTR_registers);
+    }
+
+    common_hal_i2ctarget_i2c_target_construct(self, scl, sda, addresses, i, args[ARG_smbus].u_bool,
+        registers.buf, registers.len);
     return (mp_obj_t)self;
 }
 
@@ -186,12 +205,39 @@ static mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_
 }
 static MP_DEFINE_CONST_FUN_OBJ_KW(i2ctarget_i2c_target_request_obj, 1, i2ctarget_i2c_target_request);
 
+//|     def get_change(self) -> Optional[Tuple[int, int]]:
+//|         """Return the oldest write to ``registers`` by the controller as a tuple of the first
+//|         register written and the number of registers written, or None if there are no more.
+//|         Only a limited number of writes are remembered and newer ones are dropped once that
+//|         is reached."""
+//|
+//|
+static mp_obj_t i2ctarget_i2c_target_get_change(mp_obj_t self_in) {
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    uint8_t start;
+    uint16_t length;
+    if (!common_hal_i2ctarget_i2c_target_get_change(self, &start, &length)) {
+        return mp_const_none;
+    }
+    mp_obj_t items[] = { MP_OBJ_NEW_SMALL_INT(start), MP_OBJ_NEW_SMALL_INT(length) };
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_target_get_change_obj, i2ctarget_i2c_target_get_change);
+
+// Ports without register maps never have any changes.
+MP_WEAK bool common_hal_i2ctarget_i2c_target_get_change(i2ctarget_i2c_target_obj_t *self, uint8_t *start, uint16_t *length) {
+    return false;
+}
+
 static const mp_rom_map_elem_t i2ctarget_i2c_target_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&default___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_request), MP_ROM_PTR(&i2ctarget_i2c_target_request_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_change), MP_ROM_PTR(&i2ctarget_i2c_target_get_change_obj) },
 
 };
 
@@ -25,7 +25,8 @@ extern const mp_obj_type_t i2ctarget_i2c_target_type;
 
 extern void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
     const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
-    uint8_t *addresses, unsigned int num_addresses, bool smbus);
+    uint8_t *addresses, unsigned int num_addresses, bool smbus,
+    uint8_t *registers, size_t register_count);
 extern void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self);
 extern bool common_hal_i2ctarget_i2c_target_deinited(i2ctarget_i2c_target_obj_t *self);
 
@@ -35,3 +36,4 @@ extern int common_hal_i2ctarget_i2c_target_read_byte(i2ctarget_i2c_target_obj_t
 extern int common_hal_i2ctarget_i2c_target_write_byte(i2ctarget_i2c_target_obj_t *self, uint8_t data);
 extern void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool ack);
 extern void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self);
+extern bool common_hal_i2ctarget_i2c_target_get_change(i2ctarget_i2c_target_obj_t *self, uint8_t *start, uint16_t *length);
@@ -203,6 +203,22 @@
 //|    print(f"read from device index {index_buffer}: {read_buffer}")
 //|    i2c.unlock()
 //|
+//| The same device can be emulated without handling each request in Python by passing the
+//| registers to `I2CTarget`. Requests are then answered in the background, even while the VM is
+//| busy with garbage collection or a display refresh::
+//|
+//|    import board
+//|    from i2ctarget import I2CTarget
+//|
+//|    regs = bytearray(16)
+//|
+//|    with I2CTarget(board.SCL, board.SDA, (0x40,), registers=regs) as device:
+//|        while True:
+//|            change = device.get_change()
+//|            if change:
+//|                start, count = change
+//|                print(f"controller wrote {count} registers at index {start}")
+//|
 //| Or accessed from Linux like this::
 //|
 //|    $ i2cget -y 1 0x40 0x0b
@@ -9,6 +9,9 @@
 #include "py/runtime.h"
 
 #include "shared-bindings/bitmaptools/__init__.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-module/jpegio/JpegDecoder.h"
@@ -89,7 +92,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 
 //|     def decode(
 //|         self,
-//|         bitmap: displayio.Bitmap,
+//|         bitmap: displayio.Bitmap | busdisplay.BusDisplay,
 //|         scale: int = 0,
 //|         x: int = 0,
 //|         y: int = 0,
@@ -120,6 +123,14 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         possible to repeatedly ``decode`` the same jpeg data, even if it is to
 //|         select different scales or crop regions from it.
 //|
+//|         If a `busdisplay.BusDisplay` is given instead of a bitmap, each block is
+//|         sent to the display as soon as it is decoded, so no image-sized buffer is
+//|         needed. The display must use a 16-bit colorspace. The image is drawn over
+//|         whatever is on the screen and will be drawn over in turn when the display
+//|         refreshes its ``root_group``, so first set ``root_group`` to `None` and
+//|         let the display refresh once.
+//|         ``skip_source_index`` and ``skip_dest_index`` are not supported in this mode.
+//|
 //|         :param Bitmap bitmap: Optional output buffer
 //|         :param int scale: Scale factor from 0 to 3, inclusive.
 //|         :param int x: Horizontal pixel location in bitmap where source_bitmap upper-left
@@ -154,12 +165,31 @@ static mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
-    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
-    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
-
     int scale = args[ARG_scale].u_int;
     mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
 
+    #if CIRCUITPY_BUSDISPLAY
+    if (mp_obj_is_type(bitmap_in, &busdisplay_busdisplay_type)) {
+        busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(bitmap_in);
+        if (args[ARG_skip_source_index].u_obj != mp_const_none) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_skip_source_index);
+        }
+        if (args[ARG_skip_dest_index].u_obj != mp_const_none) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_skip_dest_index);
+        }
+        int width = common_hal_busdisplay_busdisplay_get_width(display);
+        int height = common_hal_busdisplay_busdisplay_get_height(display);
+        int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, width, MP_QSTR_x);
+        int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, height, MP_QSTR_y);
+        bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], width, height);
+        common_hal_jpegio_jpegdecoder_decode_into_display(self, display, scale, x, y, &lim);
+        return mp_const_none;
+    }
+    #endif
+
+    mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
+    displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
+
     int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, bitmap->width, MP_QSTR_x);
     int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, bitmap->height, MP_QSTR_y);
     bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], bitmap->width, bitmap->height);
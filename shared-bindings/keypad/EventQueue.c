@@ -68,6 +68,35 @@ static mp_obj_t keypad_eventqueue_get_into(mp_obj_t self_in, mp_obj_t event_in)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_into_obj, keypad_eventqueue_get_into);
 
+//|     def get_many_into(self, buffer: WriteableBuffer) -> int:
+//|         """Remove as many queued events as fit into ``buffer`` and return how many were stored.
+//|
+//|         Like ``get_into()``, this does not allocate. Each event is stored as a record of
+//|         `RECORD_SIZE` bytes laid out as ``struct.Struct("<HHI")``: the key number, ``1`` if
+//|         the key was pressed or ``0`` if released, and the timestamp in `supervisor.ticks_ms`
+//|         milliseconds. An ``array.array("H")`` of ``4 * n`` items holds ``n`` events.
+//|
+//|         :param WriteableBuffer buffer: Buffer to fill, usually a multiple of `RECORD_SIZE` bytes.
+//|         :return: The number of events stored.
+//|         :rtype: int
+//|         """
+//|         ...
+//|
+static mp_obj_t keypad_eventqueue_get_many_into(mp_obj_t self_in, mp_obj_t buffer_in) {
+    keypad_eventqueue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    size_t count = common_hal_keypad_eventqueue_get_many_into(self, bufinfo.buf, bufinfo.len / sizeof(keypad_eventqueue_record_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_many_into_obj, keypad_eventqueue_get_many_into);
+
+//|     RECORD_SIZE: int
+//|     """The size in bytes of each event record written by `get_many_into`."""
+//|
+
 //|     def clear(self) -> None:
 //|         """Clear any queued key transition events. Also sets `overflowed` to ``False``."""
 //|         ...
@@ -122,6 +151,8 @@ static const mp_rom_map_elem_t keypad_eventqueue_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_clear),      MP_ROM_PTR(&keypad_eventqueue_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_get),        MP_ROM_PTR(&keypad_eventqueue_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_into),   MP_ROM_PTR(&keypad_eventqueue_get_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_many_into), MP_ROM_PTR(&keypad_eventqueue_get_many_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RECORD_SIZE), MP_ROM_INT(sizeof(keypad_eventqueue_record_t)) },
     { MP_ROM_QSTR(MP_QSTR_overflowed), MP_ROM_PTR(&keypad_eventqueue_overflowed_obj) },
 };
 
@@ -68,6 +68,10 @@
 //|           Successive measurements are spaced apart by ``interval`` seconds.
 //|           The default is 1, which resolves immediately. The maximum is 127.
 //|
+//|         On Raspberry Pi RP2040 and RP2350, if the row pins are consecutive GPIOs and so are the
+//|         column pins, a PIO state machine scans the matrix continuously at several kHz.
+//|         ``interval`` then only sets how often the latest scan is debounced.
+//|
 //|         .. warning:: On Raspberry Pi RP2350, using ``columns_to_anodes=False``
 //|            normally depends on the internal pull-down resistors.
 //|            This will not work, due to an RP2350 issue.
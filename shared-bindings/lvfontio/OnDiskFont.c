@@ -23,7 +23,9 @@
 //|         """Create a OnDiskFont by loading an LVGL font file from the filesystem.
 //|
 //|         :param str file_path: The path to the font file
-//|         :param int max_glyphs: Maximum number of glyphs to cache at once
+//|         :param int max_glyphs: Maximum number of glyphs to cache at once. Full-width glyphs
+//|             take two. When the cache is full, the least recently used glyph that is not on
+//|             screen is replaced.
 //|         """
 //|         ...
 //|
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "py/binary.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
@@ -20,6 +22,10 @@
 //|
 //|     Multiple AddressRanges may overlap. There is no "claiming" of addresses.
 //|
+//|     Ranges of plain memory, such as RAM, also support the buffer protocol so
+//|     ``memoryview(address_range)`` accesses them without copying. Use
+//|     `readinto` and `write` to move larger blocks to and from other ranges.
+//|
 //|     Example usage on ESP32-S2::
 //|
 //|        import memorymap
@@ -116,7 +122,90 @@ static mp_obj_t memorymap_addressrange_unary_op(mp_unary_op_t op, mp_obj_t self_
     }
 }
 
+// Parses the arguments shared by readinto() and write() and checks them against the range.
+static void memorymap_addressrange_parse_transfer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args,
+    mp_buffer_info_t *bufinfo, mp_uint_t buffer_flags, size_t *start, size_t *width, bool *increment) {
+    enum { ARG_buffer, ARG_start, ARG_width, ARG_increment };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_start, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_width, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_increment, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, bufinfo, buffer_flags);
+    size_t length = common_hal_memorymap_addressrange_get_length(self);
+    *start = mp_arg_validate_int_range(args[ARG_start].u_int, 0, length - 1, MP_QSTR_start);
+    *increment = args[ARG_increment].u_bool;
+
+    mp_int_t access_width = args[ARG_width].u_int;
+    if (access_width == 0) {
+        access_width = 4;
+        while ((*start | bufinfo->len) & (access_width - 1)) {
+            access_width >>= 1;
+        }
+    }
+    if ((access_width != 1 && access_width != 2 && access_width != 4) ||
+        (*start | bufinfo->len) & (access_width - 1)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_width);
+    }
+    *width = access_width;
+
+    size_t span = *increment ? bufinfo->len : (size_t)access_width;
+    if (span > length - *start) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q out of bounds"), MP_QSTR_buffer);
+    }
+}
+
+//|     def readinto(
+//|         self, buffer: WriteableBuffer, *, start: int = 0, width: int = 0, increment: bool = True
+//|     ) -> None:
+//|         """Read ``len(buffer)`` bytes into ``buffer`` without allocating.
+//|
+//|         Large transfers may be done by DMA on ports that support it.
+//|
+//|         :param int start: Offset of the first address to read, from the start of the range
+//|         :param int width: Size of each access in bytes: 1, 2 or 4. ``0`` uses the widest
+//|           access that ``start`` and the length of ``buffer`` are multiples of.
+//|         :param bool increment: When False, every access reads the address at ``start``,
+//|           such as a peripheral FIFO register.
+//|         """
+//|         ...
+//|
+static mp_obj_t memorymap_addressrange_readinto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_buffer_info_t bufinfo;
+    size_t start, width;
+    bool increment;
+    memorymap_addressrange_parse_transfer(n_args, pos_args, kw_args, &bufinfo, MP_BUFFER_WRITE, &start, &width, &increment);
+    common_hal_memorymap_addressrange_readinto(self, start, bufinfo.buf, bufinfo.len, width, increment);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(memorymap_addressrange_readinto_obj, 1, memorymap_addressrange_readinto);
+
+//|     def write(
+//|         self, buffer: ReadableBuffer, *, start: int = 0, width: int = 0, increment: bool = True
+//|     ) -> None:
+//|         """Write all of ``buffer``. The arguments are the same as for `readinto`."""
+//|         ...
+//|
+static mp_obj_t memorymap_addressrange_write(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_buffer_info_t bufinfo;
+    size_t start, width;
+    bool increment;
+    memorymap_addressrange_parse_transfer(n_args, pos_args, kw_args, &bufinfo, MP_BUFFER_READ, &start, &width, &increment);
+    common_hal_memorymap_addressrange_write(self, start, bufinfo.buf, bufinfo.len, width, increment);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(memorymap_addressrange_write_obj, 1, memorymap_addressrange_write);
+
 static const mp_rom_map_elem_t memorymap_addressrange_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&memorymap_addressrange_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&memorymap_addressrange_write_obj) },
 };
 
 static MP_DEFINE_CONST_DICT(memorymap_addressrange_locals_dict, memorymap_addressrange_locals_dict_table);
@@ -217,6 +306,42 @@ static mp_obj_t memorymap_addressrange_subscr(mp_obj_t self_in, mp_obj_t index_i
     }
 }
 
+// Plain memory ranges can be used directly through memoryview without copying.
+static mp_int_t memorymap_addressrange_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    memorymap_addressrange_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint8_t *buf = common_hal_memorymap_addressrange_get_buffer(self, flags & MP_BUFFER_WRITE);
+    if (buf == NULL) {
+        return 1;
+    }
+    bufinfo->buf = buf;
+    bufinfo->len = common_hal_memorymap_addressrange_get_length(self);
+    bufinfo->typecode = 'B';
+    return 0;
+}
+
+// Ports without faster transfers go through get_bytes and set_bytes one access at a time.
+MP_WEAK void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, uint8_t *values, size_t len, size_t width, bool increment) {
+    uint32_t word;
+    for (size_t i = 0; i < len; i += width) {
+        common_hal_memorymap_addressrange_get_bytes(self, increment ? start_index + i : start_index, width, (uint8_t *)&word);
+        memcpy(values + i, &word, width);
+    }
+}
+
+MP_WEAK void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, const uint8_t *values, size_t len, size_t width, bool increment) {
+    uint32_t word;
+    for (size_t i = 0; i < len; i += width) {
+        memcpy(&word, values + i, width);
+        common_hal_memorymap_addressrange_set_bytes(self, increment ? start_index + i : start_index, (uint8_t *)&word, width);
+    }
+}
+
+MP_WEAK uint8_t *common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self, bool writable) {
+    return NULL;
+}
+
 MP_DEFINE_CONST_OBJ_TYPE(
     memorymap_addressrange_type,
     MP_QSTR_AddressRange,
@@ -224,5 +349,6 @@ MP_DEFINE_CONST_OBJ_TYPE(
     make_new, memorymap_addressrange_make_new,
     locals_dict, (mp_obj_t)&memorymap_addressrange_locals_dict,
     subscr, memorymap_addressrange_subscr,
+    buffer, memorymap_addressrange_get_buffer,
     unary_op, memorymap_addressrange_unary_op
     );
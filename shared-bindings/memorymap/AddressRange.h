@@ -21,3 +21,14 @@ void common_hal_memorymap_addressrange_set_bytes(const memorymap_addressrange_ob
 // also leverage the compiler to validate uses are expected.
 void common_hal_memorymap_addressrange_get_bytes(const memorymap_addressrange_obj_t *self,
     size_t start_index, size_t len, uint8_t *values);
+
+// Copies len bytes with accesses of width bytes each. When increment is false every access is to
+// the address at start_index, such as a peripheral FIFO.
+void common_hal_memorymap_addressrange_readinto(const memorymap_addressrange_obj_t *self,
+    size_t start_index, uint8_t *values, size_t len, size_t width, bool increment);
+void common_hal_memorymap_addressrange_write(const memorymap_addressrange_obj_t *self,
+    size_t start_index, const uint8_t *values, size_t len, size_t width, bool increment);
+
+// Returns the start of the range when it is plain memory that can be shared without copying, or
+// NULL when it has to be accessed through the functions above.
+uint8_t *common_hal_memorymap_addressrange_get_buffer(const memorymap_addressrange_obj_t *self, bool writable);
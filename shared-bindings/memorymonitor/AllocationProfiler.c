@@ -0,0 +1,151 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/memorymonitor/AllocationProfiler.h"
+
+//| class AllocationProfiler:
+//|     def __init__(self, *, interval: int = 256, slots: int = 32) -> None:
+//|         """Finds the source lines that allocate the most by sampling allocations. Each time
+//|         another ``interval`` bytes have been allocated, the line of Python code making the
+//|         allocation is recorded. Lines that allocate more are sampled more often, so the
+//|         profile shows where memory goes without the cost of recording every allocation.
+//|
+//|         Allocations are measured in whole blocks, like `AllocationSize`.
+//|
+//|         :param int interval: Bytes allocated between samples. 1 records every allocation.
+//|         :param int slots: How many different lines can be recorded. Samples from further
+//|           lines are counted in `dropped`.
+//|
+//|         Find the lines allocating in a loop::
+//|
+//|           import memorymonitor
+//|
+//|           profiler = memorymonitor.AllocationProfiler(interval=64)
+//|           with profiler:
+//|               for i in range(100):
+//|                   control_loop()
+//|
+//|           for source_file, line, samples, sampled_bytes in profiler.results():
+//|               print(source_file, line, samples * 64)
+//|
+//|         """
+//|         ...
+//|
+static mp_obj_t memorymonitor_allocationprofiler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_interval, ARG_slots };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_interval, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 256} },
+        { MP_QSTR_slots, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t interval = mp_arg_validate_int_min(args[ARG_interval].u_int, 1, MP_QSTR_interval);
+    mp_int_t slots = mp_arg_validate_int_range(args[ARG_slots].u_int, 1, 1024, MP_QSTR_slots);
+
+    memorymonitor_allocationprofiler_obj_t *self =
+        mp_obj_malloc(memorymonitor_allocationprofiler_obj_t, &memorymonitor_allocationprofiler_type);
+
+    common_hal_memorymonitor_allocationprofiler_construct(self, interval, slots);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def __enter__(self) -> AllocationProfiler:
+//|         """Clears the samples and starts sampling."""
+//|         ...
+//|
+static mp_obj_t memorymonitor_allocationprofiler_obj___enter__(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_memorymonitor_allocationprofiler_clear(self);
+    common_hal_memorymonitor_allocationprofiler_resume(self);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler___enter___obj, memorymonitor_allocationprofiler_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Automatically stops sampling when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t memorymonitor_allocationprofiler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_memorymonitor_allocationprofiler_pause(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(memorymonitor_allocationprofiler___exit___obj, 4, 4, memorymonitor_allocationprofiler_obj___exit__);
+
+//|     def results(self) -> List[Tuple[Optional[str], int, int, int]]:
+//|         """Returns a ``(source_file, line, samples, sampled_bytes)`` tuple for each line
+//|         sampled, most sampled first. ``samples`` times ``interval`` estimates the bytes the
+//|         line allocated. ``sampled_bytes`` is the total size of the allocations that were
+//|         sampled. Allocations made outside of Python code, such as while importing, have a
+//|         ``source_file`` of ``None`` and a ``line`` of 0."""
+//|         ...
+//|
+static mp_obj_t memorymonitor_allocationprofiler_obj_results(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Copy the entries first because the allocations below may be sampled too.
+    memorymonitor_allocationprofiler_entry_t *entries = m_new(memorymonitor_allocationprofiler_entry_t, self->slots);
+    size_t len = common_hal_memorymonitor_allocationprofiler_get_entries(self, entries);
+    for (size_t i = 1; i < len; i++) {
+        memorymonitor_allocationprofiler_entry_t entry = entries[i];
+        size_t j = i;
+        for (; j > 0 && entries[j - 1].samples < entry.samples; j--) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = entry;
+    }
+    mp_obj_t results = mp_obj_new_list(len, NULL);
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_t items[] = {
+            entries[i].source_file == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(entries[i].source_file),
+            mp_obj_new_int_from_uint(entries[i].line),
+            mp_obj_new_int_from_uint(entries[i].samples),
+            mp_obj_new_int_from_uint(entries[i].bytes),
+        };
+        mp_obj_list_store(results, MP_OBJ_NEW_SMALL_INT(i), mp_obj_new_tuple(MP_ARRAY_SIZE(items), items));
+    }
+    m_del(memorymonitor_allocationprofiler_entry_t, entries, self->slots);
+    return results;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler_results_obj, memorymonitor_allocationprofiler_obj_results);
+
+//|     dropped: int
+//|     """Number of samples not recorded because every slot held another line. (read-only)"""
+//|
+//|
+static mp_obj_t memorymonitor_allocationprofiler_obj_get_dropped(mp_obj_t self_in) {
+    memorymonitor_allocationprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_memorymonitor_allocationprofiler_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(memorymonitor_allocationprofiler_get_dropped_obj, memorymonitor_allocationprofiler_obj_get_dropped);
+
+MP_PROPERTY_GETTER(memorymonitor_allocationprofiler_dropped_obj,
+    (mp_obj_t)&memorymonitor_allocationprofiler_get_dropped_obj);
+
+static const mp_rom_map_elem_t memorymonitor_allocationprofiler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&memorymonitor_allocationprofiler___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&memorymonitor_allocationprofiler___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_results), MP_ROM_PTR(&memorymonitor_allocationprofiler_results_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_dropped), MP_ROM_PTR(&memorymonitor_allocationprofiler_dropped_obj) },
+};
+static MP_DEFINE_CONST_DICT(memorymonitor_allocationprofiler_locals_dict, memorymonitor_allocationprofiler_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    memorymonitor_allocationprofiler_type,
+    MP_QSTR_AllocationProfiler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, memorymonitor_allocationprofiler_make_new,
+    locals_dict, &memorymonitor_allocationprofiler_locals_dict
+    );
@@ -0,0 +1,21 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/memorymonitor/AllocationProfiler.h"
+
+extern const mp_obj_type_t memorymonitor_allocationprofiler_type;
+
+void common_hal_memorymonitor_allocationprofiler_construct(memorymonitor_allocationprofiler_obj_t *self,
+    size_t interval, size_t slots);
+void common_hal_memorymonitor_allocationprofiler_pause(memorymonitor_allocationprofiler_obj_t *self);
+void common_hal_memorymonitor_allocationprofiler_resume(memorymonitor_allocationprofiler_obj_t *self);
+void common_hal_memorymonitor_allocationprofiler_clear(memorymonitor_allocationprofiler_obj_t *self);
+size_t common_hal_memorymonitor_allocationprofiler_get_dropped(memorymonitor_allocationprofiler_obj_t *self);
+// Copies the used entries, at most slots of them, into entries and returns how many there are.
+size_t common_hal_memorymonitor_allocationprofiler_get_entries(memorymonitor_allocationprofiler_obj_t *self,
+    memorymonitor_allocationprofiler_entry_t *entries);
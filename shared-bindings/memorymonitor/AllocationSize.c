@@ -41,9 +41,9 @@
 //|         """
 //|         ...
 //|
-static mp_obj_t memorymonitor_allocationsize_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *all_args, mp_map_t *kw_args) {
+static mp_obj_t memorymonitor_allocationsize_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     memorymonitor_allocationsize_obj_t *self =
-        m_new_obj(memorymonitor_allocationsize_obj_t, &memorymonitor_allocationsize_type);
+        mp_obj_malloc(memorymonitor_allocationsize_obj_t, &memorymonitor_allocationsize_type);
 
     common_hal_memorymonitor_allocationsize_construct(self);
 
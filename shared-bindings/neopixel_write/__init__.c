@@ -85,33 +85,123 @@ static void check_for_deinit(digitalio_digitalinout_obj_t *self) {
 //| """
 //|
 //|
-//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer) -> None:
+//| def neopixel_write(
+//|     digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer, *, blocking: bool = True
+//| ) -> None:
 //|     """Write buf out on the given DigitalInOut.
 //|
 //|     :param ~digitalio.DigitalInOut digitalinout: the DigitalInOut to output with
 //|     :param ~circuitpython_typing.ReadableBuffer buf: The bytes to clock out. No assumption is made about color order
+//|     :param bool blocking: When False, ``buf`` is copied and this returns as soon as it has been
+//|         queued, so the next frame can be worked on while this one is sent. Use `busy()` to find
+//|         out when it is done. Only the Espressif port sends in the background. Other ports
+//|         always finish the write before returning.
 //|     """
 //|     ...
 //|
 //|
-static mp_obj_t neopixel_write_neopixel_write_(mp_obj_t digitalinout_obj, mp_obj_t buf) {
+static mp_obj_t neopixel_write_neopixel_write_(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinout, ARG_buf, ARG_blocking };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinout, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_blocking, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
     const digitalio_digitalinout_obj_t *digitalinout =
-        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+        mp_arg_validate_type(args[ARG_digitalinout].u_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
 
     // Check to see if the NeoPixel has been deinited before writing to it.
-    check_for_deinit(digitalinout_obj);
+    check_for_deinit(args[ARG_digitalinout].u_obj);
 
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
     // Call platform's neopixel write function with provided buffer and options.
-    common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    if (args[ARG_blocking].u_bool) {
+        common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    } else {
+        common_hal_neopixel_write_nonblocking(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_obj, 2, neopixel_write_neopixel_write_);
+
+// Ports that can't send in the background finish the write before returning.
+MP_WEAK void common_hal_neopixel_write_nonblocking(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t numBytes) {
+    common_hal_neopixel_write(digitalinout, pixels, numBytes);
+}
+
+//| def busy(digitalinout: digitalio.DigitalInOut) -> bool:
+//|     """True while frames from non-blocking writes to the DigitalInOut are still being sent.
+//|
+//|     :param ~digitalio.DigitalInOut digitalinout: the DigitalInOut to check
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t neopixel_write_busy(mp_obj_t digitalinout_obj) {
+    const digitalio_digitalinout_obj_t *digitalinout =
+        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+    return mp_obj_new_bool(common_hal_neopixel_write_busy(digitalinout));
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(neopixel_write_busy_obj, neopixel_write_busy);
+
+MP_WEAK bool common_hal_neopixel_write_busy(const digitalio_digitalinout_obj_t *digitalinout) {
+    return false;
+}
+
+//| def neopixel_write_parallel(
+//|     digitalinouts: Sequence[digitalio.DigitalInOut], bufs: Sequence[ReadableBuffer]
+//| ) -> None:
+//|     """Write each buffer out on the matching DigitalInOut, all at the same time when the port
+//|     supports it. The whole write then takes as long as the longest buffer instead of the sum
+//|     of all of them. Shorter buffers are padded with zeros, which turn off any pixels past
+//|     their end.
+//|
+//|     On Raspberry Pi RP2 chips the pins must have sequential GPIO numbers.
+//|
+//|     :param ~Sequence[digitalio.DigitalInOut] digitalinouts: the DigitalInOuts to output with
+//|     :param ~Sequence[circuitpython_typing.ReadableBuffer] bufs: The bytes to clock out on each
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t neopixel_write_neopixel_write_parallel(mp_obj_t digitalinouts_obj, mp_obj_t bufs_obj) {
+    size_t count;
+    mp_obj_t *digitalinout_items;
+    mp_obj_get_array(digitalinouts_obj, &count, &digitalinout_items);
+    size_t buf_count;
+    mp_obj_t *buf_items;
+    mp_obj_get_array(bufs_obj, &buf_count, &buf_items);
+    mp_arg_validate_length_range(count, 1, NEOPIXEL_WRITE_MAX_PARALLEL, MP_QSTR_digitalinouts);
+    mp_arg_validate_length(buf_count, count, MP_QSTR_bufs);
+
+    const digitalio_digitalinout_obj_t *digitalinouts[count];
+    mp_buffer_info_t bufs[count];
+    for (size_t i = 0; i < count; i++) {
+        digitalinouts[i] = mp_arg_validate_type(digitalinout_items[i], &digitalio_digitalinout_type, MP_QSTR_digitalinouts);
+        check_for_deinit(digitalinout_items[i]);
+        mp_get_buffer_raise(buf_items[i], &bufs[i], MP_BUFFER_READ);
+    }
+    common_hal_neopixel_write_parallel(digitalinouts, bufs, count);
     return mp_const_none;
 }
-static MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_obj, neopixel_write_neopixel_write_);
+static MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_parallel_obj, neopixel_write_neopixel_write_parallel);
+
+// Ports that can't drive strips simultaneously write them one after another.
+MP_WEAK void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, const mp_buffer_info_t *bufs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        common_hal_neopixel_write(digitalinouts[i], (uint8_t *)bufs[i].buf, bufs[i].len);
+    }
+}
 
 static const mp_rom_map_elem_t neopixel_write_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write) },
     { MP_ROM_QSTR(MP_QSTR_neopixel_write), (mp_obj_t)&neopixel_write_neopixel_write_obj },
+    { MP_ROM_QSTR(MP_QSTR_neopixel_write_parallel), (mp_obj_t)&neopixel_write_neopixel_write_parallel_obj },
+    { MP_ROM_QSTR(MP_QSTR_busy), (mp_obj_t)&neopixel_write_busy_obj },
 };
 
 static MP_DEFINE_CONST_DICT(neopixel_write_module_globals, neopixel_write_module_globals_table);
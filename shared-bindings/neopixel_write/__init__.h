@@ -9,6 +9,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "py/obj.h"
 #include "common-hal/digitalio/DigitalInOut.h"
 
+// The most strips neopixel_write_parallel() takes at once.
+#define NEOPIXEL_WRITE_MAX_PARALLEL (32)
+
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+// Copies pixels and returns once they are queued. Ports without background writes finish the write first.
+extern void common_hal_neopixel_write_nonblocking(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
+extern bool common_hal_neopixel_write_busy(const digitalio_digitalinout_obj_t *gpio);
+extern void common_hal_neopixel_write_parallel(const digitalio_digitalinout_obj_t **digitalinouts, const mp_buffer_info_t *bufs, size_t count);
@@ -45,6 +45,8 @@
 //|         :py:func:`displayio.release_displays` first, otherwise it will error after the first code.py run.
 //|
 //|         :param microcontroller.Pin data_pins: A list of data pins.  Specify exactly one of ``data_pins`` or ``data0``.
+//|           Some ports accept 16 pins for a 16-bit bus, which sends two bytes of pixel data per write cycle.
+//|           On RP2 the pins must be sequential.
 //|         :param microcontroller.Pin data0: The first data pin. The rest are implied
 //|         :param microcontroller.Pin command: Data or command pin
 //|         :param microcontroller.Pin chip_select: Chip select pin
@@ -0,0 +1,203 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/profiler/SamplingProfiler.h"
+
+//| class SamplingProfiler:
+//|     def __init__(self, *, rate: int = 100, slots: int = 32) -> None:
+//|         """Finds the source lines that take the most time by sampling the running line
+//|         ``rate`` times a second from the supervisor tick. Lines that run longer are sampled
+//|         more often, so the profile shows where the CPU goes without slowing the code down
+//|         the way ``sys.settrace`` does. Only one SamplingProfiler can run at a time.
+//|
+//|         The line sampled is the innermost one running bytecode. Time spent in native code,
+//|         such as a ``time.sleep()`` or a library call, counts for the line that called it.
+//|
+//|         The counts are also served by the web workflow at ``/cp/profile.json``.
+//|
+//|         :param int rate: Samples per second, up to 1024. The interval is rounded to a whole
+//|           number of 1/1024 second ticks.
+//|         :param int slots: How many different lines can be recorded. Samples from further
+//|           lines are counted in `dropped`.
+//|
+//|         Find the lines taking the most time in a loop::
+//|
+//|           import profiler
+//|
+//|           sampler = profiler.SamplingProfiler(rate=200)
+//|           with sampler:
+//|               for i in range(100):
+//|                   control_loop()
+//|
+//|           for source_file, line, samples in sampler.results():
+//|               print(source_file, line, samples / 200, "seconds")
+//|
+//|         """
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_rate, ARG_slots };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_rate, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 100} },
+        { MP_QSTR_slots, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 32} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t rate = mp_arg_validate_int_range(args[ARG_rate].u_int, 1, 1024, MP_QSTR_rate);
+    mp_int_t slots = mp_arg_validate_int_range(args[ARG_slots].u_int, 1, 1024, MP_QSTR_slots);
+
+    profiler_samplingprofiler_obj_t *self =
+        mp_obj_malloc(profiler_samplingprofiler_obj_t, &profiler_samplingprofiler_type);
+
+    common_hal_profiler_samplingprofiler_construct(self, (1024 + rate / 2) / rate, slots);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def start(self) -> None:
+//|         """Starts sampling, adding to the samples already taken."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj_start(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_profiler_samplingprofiler_start(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_start_obj, profiler_samplingprofiler_obj_start);
+
+//|     def stop(self) -> None:
+//|         """Stops sampling. The samples are kept until `clear()`."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj_stop(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_profiler_samplingprofiler_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_stop_obj, profiler_samplingprofiler_obj_stop);
+
+//|     def clear(self) -> None:
+//|         """Forgets the samples taken so far."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj_clear(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_profiler_samplingprofiler_clear(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_clear_obj, profiler_samplingprofiler_obj_clear);
+
+//|     def __enter__(self) -> SamplingProfiler:
+//|         """Clears the samples and starts sampling."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj___enter__(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_profiler_samplingprofiler_clear(self);
+    common_hal_profiler_samplingprofiler_start(self);
+    return self_in;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler___enter___obj, profiler_samplingprofiler_obj___enter__);
+
+//|     def __exit__(self) -> None:
+//|         """Automatically stops sampling when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_profiler_samplingprofiler_stop(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(profiler_samplingprofiler___exit___obj, 4, 4, profiler_samplingprofiler_obj___exit__);
+
+//|     def results(self) -> List[Tuple[Optional[str], int, int]]:
+//|         """Returns a ``(source_file, line, samples)`` tuple for each line sampled, most sampled
+//|         first. ``samples`` divided by the rate estimates the seconds spent on the line.
+//|         Samples taken while no Python code was running, such as while waiting at the REPL,
+//|         have a ``source_file`` of ``None`` and a ``line`` of 0."""
+//|         ...
+//|
+static mp_obj_t profiler_samplingprofiler_obj_results(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Copy the entries first so the counts don't change while they are sorted.
+    profiler_samplingprofiler_entry_t *entries = m_new(profiler_samplingprofiler_entry_t, self->slots);
+    size_t len = common_hal_profiler_samplingprofiler_get_entries(self, entries);
+    for (size_t i = 1; i < len; i++) {
+        profiler_samplingprofiler_entry_t entry = entries[i];
+        size_t j = i;
+        for (; j > 0 && entries[j - 1].samples < entry.samples; j--) {
+            entries[j] = entries[j - 1];
+        }
+        entries[j] = entry;
+    }
+    mp_obj_t results = mp_obj_new_list(len, NULL);
+    for (size_t i = 0; i < len; i++) {
+        mp_obj_t items[] = {
+            entries[i].source_file == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(entries[i].source_file),
+            mp_obj_new_int_from_uint(entries[i].line),
+            mp_obj_new_int_from_uint(entries[i].samples),
+        };
+        mp_obj_list_store(results, MP_OBJ_NEW_SMALL_INT(i), mp_obj_new_tuple(MP_ARRAY_SIZE(items), items));
+    }
+    m_del(profiler_samplingprofiler_entry_t, entries, self->slots);
+    return results;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_results_obj, profiler_samplingprofiler_obj_results);
+
+//|     running: bool
+//|     """True while sampling. (read-only)"""
+//|
+static mp_obj_t profiler_samplingprofiler_obj_get_running(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_profiler_samplingprofiler_get_running(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_get_running_obj, profiler_samplingprofiler_obj_get_running);
+
+MP_PROPERTY_GETTER(profiler_samplingprofiler_running_obj,
+    (mp_obj_t)&profiler_samplingprofiler_get_running_obj);
+
+//|     dropped: int
+//|     """Number of samples not recorded because every slot held another line, or because
+//|     background tasks didn't run often enough to keep up with the rate. (read-only)"""
+//|
+//|
+static mp_obj_t profiler_samplingprofiler_obj_get_dropped(mp_obj_t self_in) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_profiler_samplingprofiler_get_dropped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(profiler_samplingprofiler_get_dropped_obj, profiler_samplingprofiler_obj_get_dropped);
+
+MP_PROPERTY_GETTER(profiler_samplingprofiler_dropped_obj,
+    (mp_obj_t)&profiler_samplingprofiler_get_dropped_obj);
+
+static const mp_rom_map_elem_t profiler_samplingprofiler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&profiler_samplingprofiler_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&profiler_samplingprofiler_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&profiler_samplingprofiler_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&profiler_samplingprofiler___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&profiler_samplingprofiler___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_results), MP_ROM_PTR(&profiler_samplingprofiler_results_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_running), MP_ROM_PTR(&profiler_samplingprofiler_running_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dropped), MP_ROM_PTR(&profiler_samplingprofiler_dropped_obj) },
+};
+static MP_DEFINE_CONST_DICT(profiler_samplingprofiler_locals_dict, profiler_samplingprofiler_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    profiler_samplingprofiler_type,
+    MP_QSTR_SamplingProfiler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, profiler_samplingprofiler_make_new,
+    locals_dict, &profiler_samplingprofiler_locals_dict
+    );
@@ -0,0 +1,22 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/profiler/SamplingProfiler.h"
+
+extern const mp_obj_type_t profiler_samplingprofiler_type;
+
+void common_hal_profiler_samplingprofiler_construct(profiler_samplingprofiler_obj_t *self,
+    size_t interval, size_t slots);
+void common_hal_profiler_samplingprofiler_start(profiler_samplingprofiler_obj_t *self);
+void common_hal_profiler_samplingprofiler_stop(profiler_samplingprofiler_obj_t *self);
+void common_hal_profiler_samplingprofiler_clear(profiler_samplingprofiler_obj_t *self);
+bool common_hal_profiler_samplingprofiler_get_running(profiler_samplingprofiler_obj_t *self);
+size_t common_hal_profiler_samplingprofiler_get_dropped(profiler_samplingprofiler_obj_t *self);
+// Copies the used entries, at most slots of them, into entries and returns how many there are.
+size_t common_hal_profiler_samplingprofiler_get_entries(profiler_samplingprofiler_obj_t *self,
+    profiler_samplingprofiler_entry_t *entries);
@@ -0,0 +1,31 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/profiler/SamplingProfiler.h"
+
+//| """Find where code spends its time
+//|
+//| The `profiler` module samples which line of Python code is running, to show where the CPU
+//| goes in code running in the field. Sampling adds little overhead, unlike ``sys.settrace``."""
+//|
+//|
+
+static const mp_rom_map_elem_t profiler_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_profiler) },
+    { MP_ROM_QSTR(MP_QSTR_SamplingProfiler), MP_ROM_PTR(&profiler_samplingprofiler_type) },
+};
+
+static MP_DEFINE_CONST_DICT(profiler_module_globals, profiler_module_globals_table);
+
+const mp_obj_module_t profiler_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&profiler_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_profiler, profiler_module);
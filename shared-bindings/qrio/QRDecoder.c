@@ -13,26 +13,37 @@
 #include "py/enum.h"
 
 //| class QRDecoder:
-//|     def __init__(self, width: int, height: int) -> None:
+//|     def __init__(self, width: int, height: int, *, downscale: int = 1, track: bool = False) -> None:
 //|         """Construct a QRDecoder object
 //|
 //|         :param int width: The pixel width of the image to decode
 //|         :param int height: The pixel height of the image to decode
+//|         :param int downscale: 1 to decode images at full size, or 2 to average each 2×2 block
+//|             of pixels first. Halving the size makes decoding about four times faster and
+//|             works well when codes are large in the frame, such as from a camera.
+//|         :param bool track: If `True`, `decode` first searches the quarter of the image around
+//|             the last code it found, and only searches the whole image if nothing is there.
+//|             This speeds up decoding a code that stays in view, at the cost of memory for a
+//|             second, smaller decoder.
 //|         """
 //|         ...
 //|
 
 static mp_obj_t qrio_qrdecoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args_in) {
-    enum { ARG_width, ARG_height };
+    enum { ARG_width, ARG_height, ARG_downscale, ARG_track };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_downscale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
+        { MP_QSTR_track, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, args_in, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t downscale = mp_arg_validate_int_range(args[ARG_downscale].u_int, 1, 2, MP_QSTR_downscale);
+
     qrio_qrdecoder_obj_t *self = mp_obj_malloc(qrio_qrdecoder_obj_t, &qrio_qrdecoder_type_obj);
-    shared_module_qrio_qrdecoder_construct(self, args[ARG_width].u_int, args[ARG_height].u_int);
+    shared_module_qrio_qrdecoder_construct(self, args[ARG_width].u_int, args[ARG_height].u_int, downscale, args[ARG_track].u_bool);
 
     return self;
 }
@@ -124,8 +135,6 @@ MP_PROPERTY_GETSET(qrio_qrdecoder_width_obj,
 
 //|     height: int
 //|     """The height of image the decoder expects"""
-//|
-//|
 static mp_obj_t qrio_qrdecoder_get_height(mp_obj_t self_in) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return mp_obj_new_int(shared_module_qrio_qrdecoder_get_height(self));
@@ -144,10 +153,36 @@ MP_PROPERTY_GETSET(qrio_qrdecoder_height_obj,
     (mp_obj_t)&qrio_qrdecoder_get_height_obj,
     (mp_obj_t)&qrio_qrdecoder_set_height_obj);
 
+//|     downscale: int
+//|     """How much images are shrunk before decoding (read-only)"""
+static mp_obj_t qrio_qrdecoder_get_downscale(mp_obj_t self_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int(shared_module_qrio_qrdecoder_get_downscale(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_downscale_obj, qrio_qrdecoder_get_downscale);
+
+MP_PROPERTY_GETTER(qrio_qrdecoder_downscale_obj,
+    (mp_obj_t)&qrio_qrdecoder_get_downscale_obj);
+
+//|     track: bool
+//|     """True when `decode` searches around the last code found first (read-only)"""
+//|
+//|
+static mp_obj_t qrio_qrdecoder_get_track(mp_obj_t self_in) {
+    qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(shared_module_qrio_qrdecoder_get_track(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(qrio_qrdecoder_get_track_obj, qrio_qrdecoder_get_track);
+
+MP_PROPERTY_GETTER(qrio_qrdecoder_track_obj,
+    (mp_obj_t)&qrio_qrdecoder_get_track_obj);
+
 static const mp_rom_map_elem_t qrio_qrdecoder_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_QRDecoder) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&qrio_qrdecoder_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&qrio_qrdecoder_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_downscale), MP_ROM_PTR(&qrio_qrdecoder_downscale_obj) },
+    { MP_ROM_QSTR(MP_QSTR_track), MP_ROM_PTR(&qrio_qrdecoder_track_obj) },
     { MP_ROM_QSTR(MP_QSTR_decode), MP_ROM_PTR(&qrio_qrdecoder_decode_obj) },
     { MP_ROM_QSTR(MP_QSTR_find), MP_ROM_PTR(&qrio_qrdecoder_find_obj) },
 };
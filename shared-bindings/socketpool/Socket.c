@@ -170,6 +170,43 @@ static mp_obj_t socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_obj, socketpool_socket_recvfrom_into);
 
+//|     def recvfrom_into_many(
+//|         self, buffers: List[WriteableBuffer]
+//|     ) -> List[Tuple[int, Tuple[str, int]]]:
+//|         """Reads datagrams into the buffers in order, one per buffer. Waits for the first like
+//|         `recvfrom_into` and then stops at the first buffer with no datagram already waiting,
+//|         so one call can drain a burst of packets.
+//|
+//|         Returns a list with a tuple for each buffer filled containing
+//|         * the number of bytes received into the buffer
+//|         * the remote_address it came from, which is a tuple of ip address and port number
+//|
+//|         :param list buffers: buffers to read into"""
+//|         ...
+//|
+static mp_obj_t socketpool_socket_recvfrom_into_many(mp_obj_t self_in, mp_obj_t buffers_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t buffer_count;
+    mp_obj_t *buffers;
+    mp_obj_get_array(buffers_in, &buffer_count, &buffers);
+
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < buffer_count; i++) {
+        if (i > 0 && !common_hal_socketpool_readable(self)) {
+            break;
+        }
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(buffers[i], &bufinfo, MP_BUFFER_WRITE);
+
+        mp_obj_t tuple_contents[2];
+        tuple_contents[0] = mp_obj_new_int_from_uint(common_hal_socketpool_socket_recvfrom_into(self,
+            (byte *)bufinfo.buf, bufinfo.len, &tuple_contents[1]));
+        mp_obj_list_append(result, mp_obj_new_tuple(2, tuple_contents));
+    }
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_many_obj, socketpool_socket_recvfrom_into_many);
+
 //|     def recv_into(self, buffer: WriteableBuffer, bufsize: int) -> int:
 //|         """Reads some bytes from the connected remote address, writing
 //|         into the provided buffer. If bufsize <= len(buffer) is given,
@@ -389,6 +426,34 @@ static mp_obj_t socketpool_socket_settimeout(mp_obj_t self_in, mp_obj_t timeout_
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_settimeout_obj, socketpool_socket_settimeout);
 
+//|     send_coalesce_ms: int
+//|     """How long, in milliseconds, small sends on a TCP socket are held so they can be sent
+//|     together. Held data is also sent once a full segment is waiting, before receiving and when
+//|     the socket is closed. Holding sends lets the radio wake less often; it adds up to this much
+//|     latency. 0, the default, sends immediately.
+//|
+//|     **Limitations:** Only available on Espressif boards.
+//|     """
+#if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+static mp_obj_t socketpool_socket_obj_get_send_coalesce_ms(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_socketpool_socket_get_send_coalesce_ms(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket_get_send_coalesce_ms_obj, socketpool_socket_obj_get_send_coalesce_ms);
+
+static mp_obj_t socketpool_socket_obj_set_send_coalesce_ms(mp_obj_t self_in, mp_obj_t value) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_socketpool_socket_set_send_coalesce_ms(self,
+        mp_arg_validate_int_range(mp_obj_get_int(value), 0, 1000, MP_QSTR_send_coalesce_ms));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_set_send_coalesce_ms_obj, socketpool_socket_obj_set_send_coalesce_ms);
+
+MP_PROPERTY_GETSET(socketpool_socket_send_coalesce_ms_obj,
+    (mp_obj_t)&socketpool_socket_get_send_coalesce_ms_obj,
+    (mp_obj_t)&socketpool_socket_set_send_coalesce_ms_obj);
+#endif
+
 //|     type: int
 //|     """Read-only access to the socket type"""
 //|
@@ -414,9 +479,13 @@ static const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&socketpool_socket_connect_obj) },
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvfrom_into_many), MP_ROM_PTR(&socketpool_socket_recvfrom_into_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
+    #if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+    { MP_ROM_QSTR(MP_QSTR_send_coalesce_ms), MP_ROM_PTR(&socketpool_socket_send_coalesce_ms_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socketpool_socket_setsockopt_obj) },
@@ -27,6 +27,10 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len);
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms);
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
+#if CIRCUITPY_SOCKETPOOL_SEND_COALESCE
+mp_int_t common_hal_socketpool_socket_get_send_coalesce_ms(socketpool_socket_obj_t *self);
+void common_hal_socketpool_socket_set_send_coalesce_ms(socketpool_socket_obj_t *self, mp_int_t send_coalesce_ms);
+#endif
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self);
 
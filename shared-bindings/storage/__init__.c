@@ -143,6 +143,29 @@ static mp_obj_t storage_getmount(const mp_obj_t mnt_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(storage_getmount_obj, storage_getmount);
 
+//| def mmap(path: str) -> memoryview:
+//|     """Returns a read-only memoryview of the file's contents straight out of flash.
+//|
+//|     Nothing is copied into RAM, so large fonts, bitmaps and wavetables can be used in place.
+//|     The file must be on a filesystem in memory mapped flash and its clusters must be
+//|     contiguous. Copying a file onto a freshly formatted or defragmented drive usually
+//|     achieves this.
+//|
+//|     The memoryview shows the flash as it is. It follows any later changes to the file's
+//|     clusters, including its deletion, so only map files that won't change.
+//|
+//|     :param str path: The file to map.
+//|     :raises OSError: ``EOPNOTSUPP`` if the file's filesystem isn't memory mapped.
+//|     :raises ValueError: if the file is fragmented.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t storage_mmap(mp_obj_t path_in) {
+    return common_hal_storage_mmap(mp_obj_str_get_str(path_in));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(storage_mmap_obj, storage_mmap);
+
 //| def erase_filesystem(extended: Optional[bool] = None) -> None:
 //|     """Erase and re-create the ``CIRCUITPY`` filesystem.
 //|
@@ -242,6 +265,7 @@ static const mp_rom_map_elem_t storage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_umount),            MP_ROM_PTR(&storage_umount_obj) },
     { MP_ROM_QSTR(MP_QSTR_remount),           MP_ROM_PTR(&storage_remount_obj) },
     { MP_ROM_QSTR(MP_QSTR_getmount),          MP_ROM_PTR(&storage_getmount_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mmap),              MP_ROM_PTR(&storage_mmap_obj) },
     { MP_ROM_QSTR(MP_QSTR_erase_filesystem),  MP_ROM_PTR(&storage_erase_filesystem_obj) },
     { MP_ROM_QSTR(MP_QSTR_disable_usb_drive), MP_ROM_PTR(&storage_disable_usb_drive_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable_usb_drive),  MP_ROM_PTR(&storage_enable_usb_drive_obj) },
@@ -0,0 +1,245 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+
+//| class Struct:
+//|     def __init__(self, format: str) -> None:
+//|         """A format parsed once, for packing and unpacking many records with it. The
+//|         methods work like the module functions of the same names, without the format
+//|         argument.
+//|
+//|         Sum a column of a log of records without a tuple for each one::
+//|
+//|           import array
+//|           import struct
+//|
+//|           record = struct.Struct("<Ihh")
+//|           count = len(log) // record.size
+//|           times = array.array("I", bytes(4 * count))
+//|           temps = array.array("h", bytes(2 * count))
+//|           record.unpack_into_arrays(log, (times, temps, None))
+//|           print(sum(temps) / count)
+//|
+//|         :param str format: The format, as for `struct.pack`"""
+//|         ...
+//|
+static mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    struct_struct_obj_t *self = mp_obj_malloc(struct_struct_obj_t, &struct_struct_type);
+    common_hal_struct_struct_construct(self, args[0]);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Checks there are size bytes at offset into buffer, and returns where they start.
+static byte *get_record(struct_struct_obj_t *self, mp_obj_t buffer, mp_int_t offset, mp_uint_t flags, bool exact_size) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    if (offset < 0) {
+        // negative offsets are relative to the end of the buffer
+        offset += bufinfo.len;
+        if (offset < 0) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Buffer too small"));
+        }
+    }
+    if (exact_size) {
+        if (bufinfo.len != self->size) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+        }
+    } else if ((mp_uint_t)offset + self->size > bufinfo.len) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("buffer too small"));
+    }
+    return (byte *)bufinfo.buf + offset;
+}
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values. The return value is a bytes object encoding them."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    vstr_t vstr;
+    vstr_init_len(&vstr, self->size);
+    // Alignment leaves gaps that no field writes.
+    memset(vstr.buf, 0, self->size);
+    common_hal_struct_struct_pack_into(self, (byte *)vstr.buf, n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values into a buffer starting at offset. offset may be negative to
+//|         count from the end of buffer."""
+//|         ...
+//|
+static mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *p = get_record(self, args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE, false);
+    common_hal_struct_struct_pack_into(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+static mp_obj_t unpack_record(struct_struct_obj_t *self, const byte *p) {
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(self->num_items, NULL));
+    common_hal_struct_struct_unpack_into(self, p, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+
+//|     def unpack(self, data: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack the data, which must be exactly `size` bytes long, into a tuple."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return unpack_record(self, get_record(self, data, 0, MP_BUFFER_READ, true));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, data: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpack the record at offset in data into a tuple. offset may be negative to count
+//|         from the end of buffer."""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return unpack_record(self, get_record(self, args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, false));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 1, struct_struct_unpack_from);
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *s;
+    mp_obj_t buffer;
+    size_t offset;
+} struct_unpack_iterator_obj_t;
+
+static mp_obj_t struct_unpack_iterator_iternext(mp_obj_t self_in) {
+    struct_unpack_iterator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Looked up each time, in case the buffer has been resized.
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->buffer, &bufinfo, MP_BUFFER_READ);
+    if (self->offset + self->s->size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_obj_t record = unpack_record(self->s, (byte *)bufinfo.buf + self->offset);
+    self->offset += self->s->size;
+    return record;
+}
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    struct_unpack_iterator_type,
+    MP_QSTR_unpack_iterator,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, struct_unpack_iterator_iternext
+    );
+
+mp_obj_t struct_struct_iter_unpack(struct_struct_obj_t *self, mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    if (self->size == 0 || bufinfo.len % self->size != 0) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+    }
+    struct_unpack_iterator_obj_t *iter = mp_obj_malloc(struct_unpack_iterator_obj_t, &struct_unpack_iterator_type);
+    iter->s = self;
+    iter->buffer = buffer;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
+
+//|     def iter_unpack(self, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|         """Iterate over the records in data, whose length must be a multiple of `size`,
+//|         giving a tuple for each."""
+//|         ...
+//|
+static mp_obj_t struct_struct_obj_iter_unpack(mp_obj_t self_in, mp_obj_t data) {
+    return struct_struct_iter_unpack(MP_OBJ_TO_PTR(self_in), data);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_obj_iter_unpack);
+
+//|     def unpack_into_arrays(self, data: ReadableBuffer, columns: Sequence[Optional[WriteableBuffer]]) -> int:
+//|         """Unpack the records in data into columns, such as `array.array` objects, without
+//|         making a tuple for each record. There is one column for each value in a record.
+//|         Record *n*'s value goes into item *n* of its column, converted to the column's
+//|         type. A column of None skips its value. String (``s``) values can only be skipped.
+//|
+//|         As many records are unpacked as there are whole records in data and room in every
+//|         column.
+//|
+//|         :return: the number of records unpacked"""
+//|         ...
+//|
+static mp_obj_t struct_struct_unpack_into_arrays(mp_obj_t self_in, mp_obj_t data, mp_obj_t columns_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    size_t n_columns;
+    mp_obj_t *columns;
+    mp_obj_get_array(columns_in, &n_columns, &columns);
+    (void)mp_arg_validate_length(n_columns, self->num_items, MP_QSTR_columns);
+    return mp_obj_new_int_from_uint(common_hal_struct_struct_unpack_into_arrays(self, bufinfo.buf, bufinfo.len, columns));
+}
+MP_DEFINE_CONST_FUN_OBJ_3(struct_struct_unpack_into_arrays_obj, struct_struct_unpack_into_arrays);
+
+//|     format: str
+//|     """The format string the Struct was made with. (read-only)"""
+//|
+static mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return self->format;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes in a record, the same as `struct.calcsize` of the format.
+//|     (read-only)"""
+//|
+//|
+static mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(self->size);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+static const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_into_arrays), MP_ROM_PTR(&struct_struct_unpack_into_arrays_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+};
+static MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
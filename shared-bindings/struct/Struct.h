@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/struct/Struct.h"
+
+extern const mp_obj_type_t struct_struct_type;
+
+void common_hal_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format);
+// p must have room for self->size bytes.
+void common_hal_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args);
+// items must have room for self->num_items objects.
+void common_hal_struct_struct_unpack_into(struct_struct_obj_t *self, const byte *p, mp_obj_t *items);
+// Unpacks the records in len bytes from p into columns, one for each item, and returns the
+// number unpacked. A column of mp_const_none skips its item.
+size_t common_hal_struct_struct_unpack_into_arrays(struct_struct_obj_t *self, const byte *p, size_t len,
+    const mp_obj_t *columns);
+
+// Returns an iterator over the records in buffer, for struct.iter_unpack() too.
+mp_obj_t struct_struct_iter_unpack(struct_struct_obj_t *self, mp_obj_t buffer);
@@ -14,6 +14,7 @@
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/supervisor/SafeModeReason.h"
 
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/reload.h"
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/stack.h"
@@ -24,6 +25,14 @@
 #include "shared-bindings/displayio/__init__.h"
 #endif
 
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+#include "supervisor/background_callback.h"
+#endif
+
+#if CIRCUITPY_BOOT_TRACE
+#include "supervisor/shared/boot_trace.h"
+#endif
+
 #if CIRCUITPY_TINYUSB
 #include "tusb.h"
 #endif
@@ -151,6 +160,27 @@ MP_PROPERTY_GETSET(supervisor_runtime_autoreload_obj,
     (mp_obj_t)&supervisor_runtime_get_autoreload_obj,
     (mp_obj_t)&supervisor_runtime_set_autoreload_obj);
 
+//|     keep_wifi_on_reload: bool
+//|     """Whether a WiFi connection made by user code stays up when the code stops or reloads.
+//|     Sockets are still closed. The next run can use `wifi.radio` without waiting to reconnect.
+//|     Only a hard reset sets this back to ``False``. Connections made from ``settings.toml``
+//|     always stay up."""
+//|
+static mp_obj_t supervisor_runtime_get_keep_wifi_on_reload(mp_obj_t self) {
+    return mp_obj_new_bool(reload_keep_wifi());
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_get_keep_wifi_on_reload_obj, supervisor_runtime_get_keep_wifi_on_reload);
+
+static mp_obj_t supervisor_runtime_set_keep_wifi_on_reload(mp_obj_t self, mp_obj_t state_in) {
+    reload_set_keep_wifi(mp_obj_is_true(state_in));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_runtime_set_keep_wifi_on_reload_obj, supervisor_runtime_set_keep_wifi_on_reload);
+
+MP_PROPERTY_GETSET(supervisor_runtime_keep_wifi_on_reload_obj,
+    (mp_obj_t)&supervisor_runtime_get_keep_wifi_on_reload_obj,
+    (mp_obj_t)&supervisor_runtime_set_keep_wifi_on_reload_obj);
+
 //|     ble_workflow: bool
 //|     """Enable/Disable ble workflow until a reset. This prevents BLE advertising outside of the VM and
 //|     the services used for it."""
@@ -224,7 +254,6 @@ MP_PROPERTY_GETSET(supervisor_runtime_rgb_status_brightness_obj,
 //|
 //|     On boards without displayio, this property is present but the value is always `None`."""
 //|
-//|
 static mp_obj_t supervisor_runtime_get_display(mp_obj_t self) {
     return common_hal_displayio_get_primary_display();
 }
@@ -240,6 +269,97 @@ MP_PROPERTY_GETSET(supervisor_runtime_display_obj,
     (mp_obj_t)&supervisor_runtime_set_display_obj);
 #endif
 
+//|     def heap_stats(self) -> dict:
+//|         """Usage of the heap outside the VM, where display buffers, audio DMA buffers,
+//|         sockets and the VM heap itself are allocated. Returns a dict with:
+//|
+//|         * ``total``: size of the heap in bytes
+//|         * ``used``: bytes in use, including allocator overhead
+//|         * ``free``: bytes free
+//|         * ``largest_free``: largest single allocation that would currently succeed
+//|         * ``free_blocks``: number of separate free blocks
+//|
+//|         ``1 - largest_free / free`` is a measure of fragmentation. A large buffer that
+//|         must be allocated outside the VM should fit in ``largest_free``."""
+//|         ...
+//|
+//|
+static void heap_stats_store(mp_obj_t dict, qstr key, size_t value) {
+    mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(key), mp_obj_new_int_from_uint(value));
+}
+
+static mp_obj_t supervisor_runtime_heap_stats(mp_obj_t self) {
+    port_heap_stats_t stats;
+    port_heap_get_stats(&stats);
+    size_t largest_free = port_heap_get_largest_free_size();
+    mp_obj_t result = mp_obj_new_dict(5);
+    heap_stats_store(result, MP_QSTR_total, stats.total);
+    heap_stats_store(result, MP_QSTR_used, stats.used);
+    heap_stats_store(result, MP_QSTR_free, stats.free);
+    heap_stats_store(result, MP_QSTR_largest_free, largest_free);
+    heap_stats_store(result, MP_QSTR_free_blocks, stats.free_blocks);
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_heap_stats_obj, supervisor_runtime_heap_stats);
+
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+// (no docstrings so that the profiling functions are not shown on docs.circuitpython.org)
+// Each entry is (function address, calls, total_us, max_us). Match the address against the
+// firmware's .map file to find the callback.
+static mp_obj_t supervisor_runtime_background_callback_stats(mp_obj_t self) {
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_STATS_MAX; i++) {
+        // Copied first because the values change as callbacks run.
+        background_callback_stats_t stats = background_callback_stats[i];
+        if (stats.fun == NULL) {
+            break;
+        }
+        mp_obj_t items[] = {
+            mp_obj_new_int_from_uint((uintptr_t)stats.fun),
+            mp_obj_new_int_from_uint(stats.calls),
+            mp_obj_new_int_from_uint(stats.total_us),
+            mp_obj_new_int_from_uint(stats.max_us),
+        };
+        mp_obj_list_append(result, mp_obj_new_tuple(MP_ARRAY_SIZE(items), items));
+    }
+    return result;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_background_callback_stats_obj, supervisor_runtime_background_callback_stats);
+
+static mp_obj_t supervisor_runtime_reset_background_callback_stats(mp_obj_t self) {
+    background_callback_reset_stats();
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_reset_background_callback_stats_obj, supervisor_runtime_reset_background_callback_stats);
+#endif
+
+#if CIRCUITPY_BOOT_TRACE
+// (no docstrings so that the profiling functions are not shown on docs.circuitpython.org)
+// Each entry is (stage, ms since reset when it finished), in boot_trace_stage_t order.
+static const qstr boot_trace_stage_names[BOOT_TRACE_STAGE_COUNT] = {
+    [BOOT_TRACE_PORT_INIT] = MP_QSTR_port_init,
+    [BOOT_TRACE_SAFE_MODE_WAIT] = MP_QSTR_safe_mode_wait,
+    [BOOT_TRACE_FILESYSTEM_INIT] = MP_QSTR_filesystem_init,
+    [BOOT_TRACE_BOARD_INIT] = MP_QSTR_board_init,
+    [BOOT_TRACE_BOOT_PY] = MP_QSTR_boot_py,
+    [BOOT_TRACE_WORKFLOW_START] = MP_QSTR_workflow_start,
+    [BOOT_TRACE_CODE_PY_START] = MP_QSTR_code_py_start,
+};
+
+static mp_obj_t supervisor_runtime_boot_trace(mp_obj_t self) {
+    mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(BOOT_TRACE_STAGE_COUNT, NULL));
+    for (size_t i = 0; i < BOOT_TRACE_STAGE_COUNT; i++) {
+        mp_obj_t items[] = {
+            MP_OBJ_NEW_QSTR(boot_trace_stage_names[i]),
+            mp_obj_new_int_from_uint(boot_trace_ms[i]),
+        };
+        result->items[i] = mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(supervisor_runtime_boot_trace_obj, supervisor_runtime_boot_trace);
+#endif
+
 static const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_usb_connected), MP_ROM_PTR(&supervisor_runtime_usb_connected_obj) },
     { MP_ROM_QSTR(MP_QSTR_serial_connected), MP_ROM_PTR(&supervisor_runtime_serial_connected_obj) },
@@ -247,13 +367,22 @@ static const mp_rom_map_elem_t supervisor_runtime_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_run_reason), MP_ROM_PTR(&supervisor_runtime_run_reason_obj) },
     { MP_ROM_QSTR(MP_QSTR_safe_mode_reason), MP_ROM_PTR(&supervisor_runtime_safe_mode_reason_obj) },
     { MP_ROM_QSTR(MP_QSTR_autoreload), MP_ROM_PTR(&supervisor_runtime_autoreload_obj) },
+    { MP_ROM_QSTR(MP_QSTR_keep_wifi_on_reload), MP_ROM_PTR(&supervisor_runtime_keep_wifi_on_reload_obj) },
     { MP_ROM_QSTR(MP_QSTR_ble_workflow),  MP_ROM_PTR(&supervisor_runtime_ble_workflow_obj) },
     { MP_ROM_QSTR(MP_QSTR_rgb_status_brightness),  MP_ROM_PTR(&supervisor_runtime_rgb_status_brightness_obj) },
+    { MP_ROM_QSTR(MP_QSTR_heap_stats),  MP_ROM_PTR(&supervisor_runtime_heap_stats_obj) },
     #if CIRCUITPY_DISPLAYIO
     { MP_ROM_QSTR(MP_QSTR_display),  MP_ROM_PTR(&supervisor_runtime_display_obj) },
     #else
     { MP_ROM_QSTR(MP_QSTR_display),  MP_ROM_NONE },
     #endif
+    #if CIRCUITPY_BOOT_TRACE
+    { MP_ROM_QSTR(MP_QSTR_boot_trace),  MP_ROM_PTR(&supervisor_runtime_boot_trace_obj) },
+    #endif
+    #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+    { MP_ROM_QSTR(MP_QSTR_background_callback_stats),  MP_ROM_PTR(&supervisor_runtime_background_callback_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_reset_background_callback_stats),  MP_ROM_PTR(&supervisor_runtime_reset_background_callback_stats_obj) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(supervisor_runtime_locals_dict, supervisor_runtime_locals_dict_table);
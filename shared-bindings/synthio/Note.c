@@ -22,6 +22,7 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_band_limited, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_FALSE } },
     { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_filter, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
@@ -29,6 +30,8 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_ring_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_velocity, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(127) } },
+    { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
 };
 //| class Note:
 //|     def __init__(
@@ -39,6 +42,7 @@ static const mp_arg_t note_properties[] = {
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         waveform_loop_start: BlockInput = 0,
 //|         waveform_loop_end: BlockInput = waveform_max_length,
+//|         band_limited: bool = False,
 //|         envelope: Optional[Envelope] = None,
 //|         amplitude: BlockInput = 1.0,
 //|         bend: BlockInput = 0.0,
@@ -48,11 +52,15 @@ static const mp_arg_t note_properties[] = {
 //|         ring_waveform: Optional[ReadableBuffer] = None,
 //|         ring_waveform_loop_start: BlockInput = 0,
 //|         ring_waveform_loop_end: BlockInput = waveform_max_length,
+//|         velocity: int = 127,
+//|         sample: Optional[Union[Sample, Sequence[Sample]]] = None,
 //|     ) -> None:
 //|         """Construct a Note object, with a frequency in Hz, and optional panning, waveform, envelope, tremolo (volume change) and bend (frequency change).
 //|
 //|         If waveform or envelope are `None` the synthesizer object's default waveform or envelope are used.
 //|
+//|         If sample is given, the note plays a recording instead of a waveform.
+//|
 //|         If the same Note object is played on multiple Synthesizer objects, the result is undefined.
 //|         """
 //|
@@ -244,6 +252,31 @@ MP_PROPERTY_GETSET(synthio_note_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_get_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_set_waveform_loop_end_obj);
 
+//|     band_limited: bool
+//|     """When `True`, high notes play smoothed copies of the waveform which are 1/2, 1/4, ... as long,
+//|     instead of skipping over samples of the full waveform. This reduces the harsh aliasing of
+//|     bright waveforms such as saw and square waves played at high frequencies.
+//|
+//|     The copies are made when this property or `waveform` is set, so changes made to the
+//|     waveform buffer afterwards are not heard until one of them is set again. They are only
+//|     used while the loop covers the whole waveform, and a waveform whose length is odd or less
+//|     than 16 samples is always played as-is."""
+static mp_obj_t synthio_note_get_band_limited(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_note_get_band_limited(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_band_limited_obj, synthio_note_get_band_limited);
+
+static mp_obj_t synthio_note_set_band_limited(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_band_limited(self, mp_obj_is_true(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_band_limited_obj, synthio_note_set_band_limited);
+MP_PROPERTY_GETSET(synthio_note_band_limited_obj,
+    (mp_obj_t)&synthio_note_get_band_limited_obj,
+    (mp_obj_t)&synthio_note_set_band_limited_obj);
+
 
 //|     envelope: Envelope
 //|     """The envelope of this note"""
@@ -357,7 +390,6 @@ MP_PROPERTY_GETSET(synthio_note_ring_waveform_loop_start_obj,
 //|
 //|     Use the `synthio.waveform_max_length` constant to set the loop point at the end of the wave form, no matter its length."""
 //|
-//|
 static mp_obj_t synthio_note_get_ring_waveform_loop_end(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return common_hal_synthio_note_get_ring_waveform_loop_end(self);
@@ -374,7 +406,49 @@ MP_PROPERTY_GETSET(synthio_note_ring_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_get_ring_waveform_loop_end_obj,
     (mp_obj_t)&synthio_note_set_ring_waveform_loop_end_obj);
 
+//|     velocity: int
+//|     """How hard the note was played, from 0 to 127. It only chooses which `Sample` plays; use
+//|     `amplitude` to change the loudness."""
+static mp_obj_t synthio_note_get_velocity(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_note_get_velocity(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_velocity_obj, synthio_note_get_velocity);
+
+static mp_obj_t synthio_note_set_velocity(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_velocity(self, mp_obj_get_int(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_velocity_obj, synthio_note_set_velocity);
+MP_PROPERTY_GETSET(synthio_note_velocity_obj,
+    (mp_obj_t)&synthio_note_get_velocity_obj,
+    (mp_obj_t)&synthio_note_set_velocity_obj);
+
+//|     sample: Optional[Tuple[Sample, ...]]
+//|     """The recordings to play instead of `waveform`. The first one whose `Sample.note_range` holds
+//|     the MIDI note nearest `frequency` and whose `Sample.velocity_range` holds `velocity` is
+//|     played, resampled to `frequency`. If none matches, the note is silent.
+//|
+//|     A single `Sample` or any sequence of them may be assigned; it is stored as a tuple.
+//|     `bend` and `filter` apply as usual, but ring modulation does not."""
+//|
+//|
+static mp_obj_t synthio_note_get_sample(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_note_get_sample_obj(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_sample_obj, synthio_note_get_sample);
 
+static mp_obj_t synthio_note_set_sample(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_sample(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_sample_obj, synthio_note_set_sample);
+MP_PROPERTY_GETSET(synthio_note_sample_obj,
+    (mp_obj_t)&synthio_note_get_sample_obj,
+    (mp_obj_t)&synthio_note_set_sample_obj);
 
 static void note_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
@@ -388,6 +462,7 @@ static const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_waveform), MP_ROM_PTR(&synthio_note_waveform_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_start), MP_ROM_PTR(&synthio_note_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_end), MP_ROM_PTR(&synthio_note_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_band_limited), MP_ROM_PTR(&synthio_note_band_limited_obj) },
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_note_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_amplitude), MP_ROM_PTR(&synthio_note_amplitude_obj) },
     { MP_ROM_QSTR(MP_QSTR_bend), MP_ROM_PTR(&synthio_note_bend_obj) },
@@ -396,6 +471,8 @@ static const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_ring_waveform), MP_ROM_PTR(&synthio_note_ring_waveform_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_waveform_loop_start), MP_ROM_PTR(&synthio_note_ring_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_waveform_loop_end), MP_ROM_PTR(&synthio_note_ring_waveform_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_velocity), MP_ROM_PTR(&synthio_note_velocity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&synthio_note_sample_obj) },
 };
 static MP_DEFINE_CONST_DICT(synthio_note_locals_dict, synthio_note_locals_dict_table);
 
@@ -0,0 +1,198 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Sample.h"
+#include "shared-module/synthio/Sample.h"
+
+//| class Sample:
+//|     def __init__(
+//|         self,
+//|         data: ReadableBuffer,
+//|         *,
+//|         sample_rate: int,
+//|         root_frequency: float,
+//|         loop_start: int = 0,
+//|         loop_end: Optional[int] = None,
+//|         note_range: Tuple[int, int] = (0, 127),
+//|         velocity_range: Tuple[int, int] = (0, 127),
+//|     ) -> None:
+//|         """A recording of one pitch of an instrument, for `Note` to play at any frequency.
+//|
+//|         The data is played where it is, without being copied, so it may be a `memoryview` of a
+//|         large buffer or of data in flash such as a frozen module's `bytes`.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer data: Mono samples of type 'h' (signed 16 bit)
+//|         :param int sample_rate: The rate ``data`` was recorded at
+//|         :param float root_frequency: The pitch of the recording in Hz. A `Note` with this
+//|           frequency plays ``data`` at its original speed.
+//|         :param int loop_start: The first sample of the part that repeats while the note is held
+//|         :param int loop_end: One past the last sample that repeats. `None` plays the sample
+//|           once, after which the note falls silent.
+//|         :param Tuple[int,int] note_range: The lowest and highest MIDI note numbers this sample is
+//|           used for when a `Note` is given a sequence of samples
+//|         :param Tuple[int,int] velocity_range: The lowest and highest `Note.velocity` this sample
+//|           is used for when a `Note` is given a sequence of samples
+//|
+//|         A two zone piano using samples recorded at C4 and C5::
+//|
+//|           import synthio
+//|
+//|           piano = (
+//|               synthio.Sample(c4, sample_rate=22050, root_frequency=261.63, loop_start=9000,
+//|                   loop_end=11000, note_range=(0, 65)),
+//|               synthio.Sample(c5, sample_rate=22050, root_frequency=523.25, loop_start=8000,
+//|                   loop_end=10000, note_range=(66, 127)),
+//|           )
+//|           synth.press(synthio.Note(synthio.midi_to_hz(64), sample=piano, velocity=100))
+//|         """
+//|
+static void parse_range(mp_obj_t range_in, uint8_t range[2], qstr arg_name) {
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(range_in, 2, &items);
+    range[0] = mp_arg_validate_int_range(mp_obj_get_int(items[0]), 0, 127, arg_name);
+    range[1] = mp_arg_validate_int_range(mp_obj_get_int(items[1]), range[0], 127, arg_name);
+}
+
+static mp_obj_t range_to_tuple(const uint8_t range[2]) {
+    mp_obj_t items[] = { MP_OBJ_NEW_SMALL_INT(range[0]), MP_OBJ_NEW_SMALL_INT(range[1]) };
+    return mp_obj_new_tuple(2, items);
+}
+
+static mp_obj_t synthio_sample_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_data, ARG_sample_rate, ARG_root_frequency, ARG_loop_start, ARG_loop_end, ARG_note_range, ARG_velocity_range };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_root_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop_start, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_note_range, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_velocity_range, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.typecode != 'h') {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'h'"), MP_QSTR_data);
+    }
+    uint32_t length = mp_arg_validate_length_min(bufinfo.len / sizeof(int16_t), 2, MP_QSTR_data);
+
+    uint32_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_float_t root_frequency = mp_arg_validate_float_range(mp_obj_get_float(args[ARG_root_frequency].u_obj),
+        MICROPY_FLOAT_CONST(1.), 32767, MP_QSTR_root_frequency);
+
+    uint32_t loop_start = 0;
+    uint32_t loop_end = 0;
+    if (args[ARG_loop_end].u_obj != mp_const_none) {
+        loop_end = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_loop_end].u_obj), 1, length, MP_QSTR_loop_end);
+        loop_start = mp_arg_validate_int_range(args[ARG_loop_start].u_int, 0, loop_end - 1, MP_QSTR_loop_start);
+    }
+
+    uint8_t note_range[2] = {0, 127};
+    if (args[ARG_note_range].u_obj != mp_const_none) {
+        parse_range(args[ARG_note_range].u_obj, note_range, MP_QSTR_note_range);
+    }
+    uint8_t velocity_range[2] = {0, 127};
+    if (args[ARG_velocity_range].u_obj != mp_const_none) {
+        parse_range(args[ARG_velocity_range].u_obj, velocity_range, MP_QSTR_velocity_range);
+    }
+
+    synthio_sample_obj_t *self = mp_obj_malloc(synthio_sample_obj_t, &synthio_sample_type);
+    common_hal_synthio_sample_construct(self, args[ARG_data].u_obj, &bufinfo, sample_rate, root_frequency,
+        loop_start, loop_end, note_range, velocity_range);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     data: ReadableBuffer
+//|     """The recording. (read-only)"""
+static mp_obj_t synthio_sample_get_data(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_sample_get_data(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_data_obj, synthio_sample_get_data);
+MP_PROPERTY_GETTER(synthio_sample_data_obj, (mp_obj_t)&synthio_sample_get_data_obj);
+
+//|     sample_rate: int
+//|     """The rate the recording was made at, in Hz. (read-only)"""
+static mp_obj_t synthio_sample_get_sample_rate(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_synthio_sample_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_sample_rate_obj, synthio_sample_get_sample_rate);
+MP_PROPERTY_GETTER(synthio_sample_sample_rate_obj, (mp_obj_t)&synthio_sample_get_sample_rate_obj);
+
+//|     root_frequency: float
+//|     """The pitch of the recording, in Hz. (read-only)"""
+static mp_obj_t synthio_sample_get_root_frequency(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_synthio_sample_get_root_frequency(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_root_frequency_obj, synthio_sample_get_root_frequency);
+MP_PROPERTY_GETTER(synthio_sample_root_frequency_obj, (mp_obj_t)&synthio_sample_get_root_frequency_obj);
+
+//|     loop_start: int
+//|     """The first sample of the repeating part. (read-only)"""
+static mp_obj_t synthio_sample_get_loop_start(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_synthio_sample_get_loop_start(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_loop_start_obj, synthio_sample_get_loop_start);
+MP_PROPERTY_GETTER(synthio_sample_loop_start_obj, (mp_obj_t)&synthio_sample_get_loop_start_obj);
+
+//|     loop_end: Optional[int]
+//|     """One past the last sample of the repeating part, or `None` if the sample plays once. (read-only)"""
+static mp_obj_t synthio_sample_get_loop_end(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    uint32_t loop_end = common_hal_synthio_sample_get_loop_end(self);
+    return loop_end == 0 ? mp_const_none : mp_obj_new_int_from_uint(loop_end);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_loop_end_obj, synthio_sample_get_loop_end);
+MP_PROPERTY_GETTER(synthio_sample_loop_end_obj, (mp_obj_t)&synthio_sample_get_loop_end_obj);
+
+//|     note_range: Tuple[int, int]
+//|     """The lowest and highest MIDI note numbers this sample plays. (read-only)"""
+static mp_obj_t synthio_sample_get_note_range(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return range_to_tuple(common_hal_synthio_sample_get_note_range(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_note_range_obj, synthio_sample_get_note_range);
+MP_PROPERTY_GETTER(synthio_sample_note_range_obj, (mp_obj_t)&synthio_sample_get_note_range_obj);
+
+//|     velocity_range: Tuple[int, int]
+//|     """The lowest and highest velocities this sample plays. (read-only)"""
+//|
+//|
+static mp_obj_t synthio_sample_get_velocity_range(mp_obj_t self_in) {
+    synthio_sample_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return range_to_tuple(common_hal_synthio_sample_get_velocity_range(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_sample_get_velocity_range_obj, synthio_sample_get_velocity_range);
+MP_PROPERTY_GETTER(synthio_sample_velocity_range_obj, (mp_obj_t)&synthio_sample_get_velocity_range_obj);
+
+static const mp_rom_map_elem_t synthio_sample_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_data), MP_ROM_PTR(&synthio_sample_data_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&synthio_sample_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_root_frequency), MP_ROM_PTR(&synthio_sample_root_frequency_obj) },
+    { MP_ROM_QSTR(MP_QSTR_loop_start), MP_ROM_PTR(&synthio_sample_loop_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_loop_end), MP_ROM_PTR(&synthio_sample_loop_end_obj) },
+    { MP_ROM_QSTR(MP_QSTR_note_range), MP_ROM_PTR(&synthio_sample_note_range_obj) },
+    { MP_ROM_QSTR(MP_QSTR_velocity_range), MP_ROM_PTR(&synthio_sample_velocity_range_obj) },
+};
+static MP_DEFINE_CONST_DICT(synthio_sample_locals_dict, synthio_sample_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_sample_type,
+    MP_QSTR_Sample,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_sample_make_new,
+    locals_dict, &synthio_sample_locals_dict
+    );
@@ -0,0 +1,24 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct synthio_sample_obj synthio_sample_obj_t;
+extern const mp_obj_type_t synthio_sample_type;
+
+void common_hal_synthio_sample_construct(synthio_sample_obj_t *self, mp_obj_t data_obj,
+    const mp_buffer_info_t *data, uint32_t sample_rate, mp_float_t root_frequency,
+    uint32_t loop_start, uint32_t loop_end, const uint8_t note_range[2], const uint8_t velocity_range[2]);
+
+mp_obj_t common_hal_synthio_sample_get_data(synthio_sample_obj_t *self);
+uint32_t common_hal_synthio_sample_get_sample_rate(synthio_sample_obj_t *self);
+mp_float_t common_hal_synthio_sample_get_root_frequency(synthio_sample_obj_t *self);
+uint32_t common_hal_synthio_sample_get_loop_start(synthio_sample_obj_t *self);
+uint32_t common_hal_synthio_sample_get_loop_end(synthio_sample_obj_t *self);
+const uint8_t *common_hal_synthio_sample_get_note_range(synthio_sample_obj_t *self);
+const uint8_t *common_hal_synthio_sample_get_velocity_range(synthio_sample_obj_t *self);
@@ -21,6 +21,7 @@
 #include "shared-bindings/synthio/Math.h"
 #include "shared-bindings/synthio/MidiTrack.h"
 #include "shared-bindings/synthio/Note.h"
+#include "shared-bindings/synthio/Sample.h"
 #include "shared-bindings/synthio/Synthesizer.h"
 
 #include "shared-module/synthio/LFO.h"
@@ -176,7 +177,9 @@ const mp_obj_namedtuple_type_t synthio_envelope_type_obj = {
 //|     envelope: Optional[Envelope] = None,
 //| ) -> MidiTrack:
 //|     """Create an AudioSample from an already opened MIDI file.
-//|     Currently, only single-track MIDI (type 0) is supported.
+//|     Single-track (type 0) and multi-track (type 1) MIDI files are supported. The tracks of a
+//|     type 1 file are mixed together and tempo changes are followed. The file is read while it
+//|     plays, a few bytes per track at a time, so it must stay open until playback is done.
 //|
 //|     :param typing.BinaryIO file: Already opened MIDI file
 //|     :param int sample_rate: The desired playback sample rate; higher sample rate requires more memory
@@ -216,55 +219,14 @@ static mp_obj_t synthio_from_file(size_t n_args, const mp_obj_t *pos_args, mp_ma
     }
     pyb_file_obj_t *file = MP_OBJ_TO_PTR(args[ARG_file].u_obj);
 
-    uint8_t chunk_header[14];
-    f_rewind(&file->fp);
-    UINT bytes_read;
-    if (f_read(&file->fp, chunk_header, sizeof(chunk_header), &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != sizeof(chunk_header) ||
-        memcmp(chunk_header, "MThd\0\0\0\6\0\0\0\1", 12)) {
-        mp_arg_error_invalid(MP_QSTR_file);
-        // TODO: for a multi-track MIDI (type 1), return an AudioMixer
-    }
-
-    uint16_t tempo;
-    if (chunk_header[12] & 0x80) {
-        tempo = -(int8_t)chunk_header[12] * chunk_header[13];
-    } else {
-        tempo = 2 * ((chunk_header[12] << 8) | chunk_header[13]);
-    }
-
-    if (f_read(&file->fp, chunk_header, 8, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 8 || memcmp(chunk_header, "MTrk", 4)) {
-        mp_arg_error_invalid(MP_QSTR_file);
-    }
-    uint32_t track_size = (chunk_header[4] << 24) |
-        (chunk_header[5] << 16) | (chunk_header[6] << 8) | chunk_header[7];
-    uint8_t *buffer = m_malloc_without_collect(track_size);
-    if (f_read(&file->fp, buffer, track_size, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != track_size) {
-        mp_arg_error_invalid(MP_QSTR_file);
-    }
-
     synthio_miditrack_obj_t *result = mp_obj_malloc(synthio_miditrack_obj_t, &synthio_miditrack_type);
 
-    common_hal_synthio_miditrack_construct(result, buffer, track_size,
-        tempo, args[ARG_sample_rate].u_int, args[ARG_waveform].u_obj,
+    common_hal_synthio_miditrack_construct_from_file(result, file,
+        args[ARG_sample_rate].u_int, args[ARG_waveform].u_obj,
         mp_const_none,
         args[ARG_envelope].u_obj
         );
 
-    #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
-    m_free(buffer, track_size);
-    #else
-    m_free(buffer);
-    #endif
-
     return MP_OBJ_FROM_PTR(result);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(synthio_from_file_obj, 1, synthio_from_file);
@@ -321,6 +283,7 @@ static const mp_rom_map_elem_t synthio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_MathOperation), MP_ROM_PTR(&synthio_math_operation_type) },
     { MP_ROM_QSTR(MP_QSTR_MidiTrack), MP_ROM_PTR(&synthio_miditrack_type) },
     { MP_ROM_QSTR(MP_QSTR_Note), MP_ROM_PTR(&synthio_note_type) },
+    { MP_ROM_QSTR(MP_QSTR_Sample), MP_ROM_PTR(&synthio_sample_type) },
     { MP_ROM_QSTR(MP_QSTR_EnvelopeState), MP_ROM_PTR(&synthio_note_state_type) },
     { MP_ROM_QSTR(MP_QSTR_LFO), MP_ROM_PTR(&synthio_lfo_type) },
     { MP_ROM_QSTR(MP_QSTR_Synthesizer), MP_ROM_PTR(&synthio_synthesizer_type) },
@@ -39,6 +39,7 @@
 
 #include "py/objproperty.h"
 #include "shared-bindings/usb/core/Device.h"
+#include "shared-bindings/usb/core/Transfer.h"
 #include "shared-bindings/util.h"
 #include "py/runtime.h"
 
@@ -256,6 +257,58 @@ static mp_obj_t usb_core_device_read(size_t n_args, const mp_obj_t *pos_args, mp
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_read_obj, 2, usb_core_device_read);
 
+//|     def submit_write(self, endpoint: int, data: ReadableBuffer) -> usb.core.Transfer:
+//|         """Start writing data to a specific endpoint on the device and return right away.
+//|
+//|         ``data`` must not be changed until the returned `Transfer` is done.
+//|
+//|         :param int endpoint: the bEndpointAddress you want to communicate with.
+//|         :param ReadableBuffer data: the data to send
+//|         :returns: the transfer, which reports the number of bytes written once done
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_core_device_submit_write(mp_obj_t self_in, mp_obj_t endpoint_in, mp_obj_t data_in) {
+    usb_core_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t endpoint = mp_obj_get_int(endpoint_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+
+    usb_core_transfer_obj_t *transfer = mp_obj_malloc(usb_core_transfer_obj_t, &usb_core_transfer_type);
+    common_hal_usb_core_device_submit(self, transfer, endpoint, data_in, bufinfo.buf, bufinfo.len);
+    return MP_OBJ_FROM_PTR(transfer);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_core_device_submit_write_obj, usb_core_device_submit_write);
+
+//|     def submit_read(self, endpoint: int, buffer: WriteableBuffer) -> usb.core.Transfer:
+//|         """Start reading data from the endpoint into ``buffer`` and return right away.
+//|
+//|         Submitting several reads on the same endpoint keeps the endpoint busy, so a device
+//|         such as a USB serial adapter or a flash drive is never left waiting for the next
+//|         request while Python handles the previous data.
+//|
+//|         :param int endpoint: the bEndpointAddress you want to communicate with.
+//|         :param WriteableBuffer buffer: the buffer to read data into
+//|         :returns: the transfer, which reports the number of bytes read once done
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_core_device_submit_read(mp_obj_t self_in, mp_obj_t endpoint_in, mp_obj_t buffer_in) {
+    usb_core_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t endpoint = mp_obj_get_int(endpoint_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    usb_core_transfer_obj_t *transfer = mp_obj_malloc(usb_core_transfer_obj_t, &usb_core_transfer_type);
+    common_hal_usb_core_device_submit(self, transfer, endpoint, buffer_in, bufinfo.buf, bufinfo.len);
+    return MP_OBJ_FROM_PTR(transfer);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_core_device_submit_read_obj, usb_core_device_submit_read);
+
 //|     def ctrl_transfer(
 //|         self,
 //|         bmRequestType: int,
@@ -387,6 +440,8 @@ static const mp_rom_map_elem_t usb_core_device_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_configuration), MP_ROM_PTR(&usb_core_device_set_configuration_obj) },
     { MP_ROM_QSTR(MP_QSTR_write),            MP_ROM_PTR(&usb_core_device_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_read),             MP_ROM_PTR(&usb_core_device_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_submit_write),     MP_ROM_PTR(&usb_core_device_submit_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_submit_read),      MP_ROM_PTR(&usb_core_device_submit_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_ctrl_transfer),    MP_ROM_PTR(&usb_core_device_ctrl_transfer_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_is_kernel_driver_active), MP_ROM_PTR(&usb_core_device_is_kernel_driver_active_obj) },
@@ -9,6 +9,7 @@
 #include "py/objarray.h"
 
 #include "shared-module/usb/core/Device.h"
+#include "shared-module/usb/core/Transfer.h"
 
 extern const mp_obj_type_t usb_core_device_type;
 
@@ -27,6 +28,8 @@ mp_int_t common_hal_usb_core_device_get_speed(usb_core_device_obj_t *self);
 void common_hal_usb_core_device_set_configuration(usb_core_device_obj_t *self, mp_int_t configuration);
 mp_int_t common_hal_usb_core_device_write(usb_core_device_obj_t *self, mp_int_t endpoint, const uint8_t *buffer, mp_int_t len, mp_int_t timeout);
 mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t endpoint, uint8_t *buffer, mp_int_t len, mp_int_t timeout);
+void common_hal_usb_core_device_submit(usb_core_device_obj_t *self, usb_core_transfer_obj_t *transfer,
+    mp_int_t endpoint, mp_obj_t buffer, uint8_t *data, mp_int_t len);
 mp_int_t common_hal_usb_core_device_ctrl_transfer(usb_core_device_obj_t *self,
     mp_int_t bmRequestType, mp_int_t bRequest,
     mp_int_t wValue, mp_int_t wIndex,
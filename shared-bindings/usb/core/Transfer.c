@@ -0,0 +1,114 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/usb/core/Transfer.h"
+
+//| class Transfer:
+//|     """A bulk or interrupt transfer started by `Device.submit_read` or `Device.submit_write`.
+//|
+//|     Transfers run in the background while the VM carries on. More than one may be
+//|     submitted for the same endpoint; they run one after another in the order they were
+//|     submitted, with the next one starting as soon as the previous completes.
+//|
+//|     A transfer can be registered with `select.poll`, which reports it readable once it
+//|     is done. That lets an `asyncio` task wait for it without blocking, or a task can
+//|     simply check `done` between ``await asyncio.sleep(0)`` calls."""
+//|
+//|     def __init__(self) -> None:
+//|         """User code cannot create Transfer objects. Instead, get them from
+//|         `Device.submit_read` or `Device.submit_write`.
+//|         """
+//|         ...
+//|
+
+//|     done: bool
+//|     """True once the transfer has completed, failed or been cancelled. (read-only)"""
+//|
+static mp_obj_t usb_core_transfer_get_done(mp_obj_t self_in) {
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_core_transfer_get_done(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_transfer_get_done_obj, usb_core_transfer_get_done);
+
+MP_PROPERTY_GETTER(usb_core_transfer_done_obj,
+    (mp_obj_t)&usb_core_transfer_get_done_obj);
+
+//|     def wait(self, timeout: Optional[int] = None) -> int:
+//|         """Wait for the transfer to finish.
+//|
+//|         :param int timeout: Time to wait specified in milliseconds. (Different from most CircuitPython!)
+//|           If it runs out, `usb.core.USBTimeoutError` is raised and the transfer keeps going.
+//|         :returns: the number of bytes transferred, or 0 if the transfer was cancelled
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_core_transfer_wait(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_timeout };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_timeout, MP_ARG_INT, {.u_int = 0} },
+    };
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_core_transfer_wait(self, args[ARG_timeout].u_int));
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_transfer_wait_obj, 1, usb_core_transfer_wait);
+
+//|     def cancel(self) -> None:
+//|         """Stop the transfer if it hasn't finished yet. Later transfers queued on the same
+//|         endpoint still run."""
+//|         ...
+//|
+//|
+static mp_obj_t usb_core_transfer_cancel(mp_obj_t self_in) {
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_core_transfer_cancel(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_core_transfer_cancel_obj, usb_core_transfer_cancel);
+
+static mp_uint_t usb_core_transfer_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    usb_core_transfer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_uint_t ret;
+    if (request == MP_STREAM_POLL) {
+        mp_uint_t flags = arg;
+        ret = 0;
+        if ((flags & MP_STREAM_POLL_RD) && common_hal_usb_core_transfer_get_done(self)) {
+            ret |= MP_STREAM_POLL_RD;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+static const mp_rom_map_elem_t usb_core_transfer_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_done),             MP_ROM_PTR(&usb_core_transfer_done_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait),             MP_ROM_PTR(&usb_core_transfer_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel),           MP_ROM_PTR(&usb_core_transfer_cancel_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(usb_core_transfer_locals_dict, usb_core_transfer_locals_dict_table);
+
+static const mp_stream_p_t usb_core_transfer_stream_p = {
+    .read = NULL,
+    .write = NULL,
+    .ioctl = usb_core_transfer_ioctl,
+    .is_text = false,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_core_transfer_type,
+    MP_QSTR_Transfer,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &usb_core_transfer_locals_dict,
+    protocol, &usb_core_transfer_stream_p
+    );
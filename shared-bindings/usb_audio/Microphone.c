@@ -0,0 +1,126 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/usb_audio/Microphone.h"
+
+//| class Microphone:
+//|     """The audio the host records from this device. It is sent from a playing sample or
+//|     from buffers written by your code, such as recordings from `audiobusio.PDMIn`.
+//|     The host receives silence while neither is available.
+//|
+//|     Cannot be instantiated. Use `usb_audio.microphone`."""
+//|
+//|     def __init__(self) -> None:
+//|         """Not currently dynamically supported. Use `usb_audio.microphone`."""
+//|         ...
+//|
+
+//|     def play(self, sample: circuitpython_typing.AudioSample, *, loop: bool = False) -> None:
+//|         """Sends ``sample`` to the host in the background, replacing any sample already
+//|         playing. The host takes it at the sample rate, which paces playback.
+//|
+//|         The sample must be mono, signed 16 bit and use the sample rate passed to
+//|         `usb_audio.enable()`. An `audiomixer.Mixer` or `synthio.Synthesizer` with those
+//|         settings can combine several sources.
+//|
+//|         Nothing is sent while the host isn't recording, so the sample pauses until it starts."""
+//|         ...
+//|
+static mp_obj_t usb_audio_microphone_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_loop, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    usb_audio_microphone_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_usb_audio_microphone_play(self, args[ARG_sample].u_obj, args[ARG_loop].u_bool);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_audio_microphone_play_obj, 1, usb_audio_microphone_obj_play);
+
+//|     def stop(self) -> None:
+//|         """Stops sending the playing sample."""
+//|         ...
+//|
+static mp_obj_t usb_audio_microphone_obj_stop(mp_obj_t self_in) {
+    usb_audio_microphone_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_usb_audio_microphone_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_microphone_stop_obj, usb_audio_microphone_obj_stop);
+
+//|     def write(self, buffer: ReadableBuffer) -> int:
+//|         """Queues signed 16 bit mono samples from ``buffer`` to send to the host and returns how
+//|         many were queued. Fewer than all of them are queued when the queue is full, and none
+//|         while the host isn't recording. Cannot be used while a sample is playing."""
+//|         ...
+//|
+static mp_obj_t usb_audio_microphone_obj_write(mp_obj_t self_in, mp_obj_t buffer) {
+    usb_audio_microphone_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_usb_audio_microphone_get_playing(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_READ);
+    if (mp_binary_get_size('@', bufinfo.typecode, NULL) != sizeof(int16_t)) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'h'"), MP_QSTR_buffer);
+    }
+    size_t written = common_hal_usb_audio_microphone_write(self, bufinfo.buf, bufinfo.len / sizeof(int16_t));
+    return MP_OBJ_NEW_SMALL_INT(written);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_audio_microphone_write_obj, usb_audio_microphone_obj_write);
+
+//|     playing: bool
+//|     """True while a sample is being sent. (read-only)"""
+//|
+static mp_obj_t usb_audio_microphone_obj_get_playing(mp_obj_t self_in) {
+    usb_audio_microphone_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_audio_microphone_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_microphone_get_playing_obj, usb_audio_microphone_obj_get_playing);
+
+MP_PROPERTY_GETTER(usb_audio_microphone_playing_obj,
+    (mp_obj_t)&usb_audio_microphone_get_playing_obj);
+
+//|     streaming: bool
+//|     """True while the host is recording. (read-only)"""
+//|
+//|
+static mp_obj_t usb_audio_microphone_obj_get_streaming(mp_obj_t self_in) {
+    usb_audio_microphone_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_audio_microphone_get_streaming(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_microphone_get_streaming_obj, usb_audio_microphone_obj_get_streaming);
+
+MP_PROPERTY_GETTER(usb_audio_microphone_streaming_obj,
+    (mp_obj_t)&usb_audio_microphone_get_streaming_obj);
+
+static const mp_rom_map_elem_t usb_audio_microphone_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&usb_audio_microphone_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&usb_audio_microphone_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&usb_audio_microphone_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&usb_audio_microphone_playing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_streaming), MP_ROM_PTR(&usb_audio_microphone_streaming_obj) },
+};
+static MP_DEFINE_CONST_DICT(usb_audio_microphone_locals_dict, usb_audio_microphone_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_audio_microphone_type,
+    MP_QSTR_Microphone,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &usb_audio_microphone_locals_dict
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb_audio/Microphone.h"
+
+extern const mp_obj_type_t usb_audio_microphone_type;
+
+void common_hal_usb_audio_microphone_play(usb_audio_microphone_obj_t *self, mp_obj_t sample, bool loop);
+void common_hal_usb_audio_microphone_stop(usb_audio_microphone_obj_t *self);
+bool common_hal_usb_audio_microphone_get_playing(usb_audio_microphone_obj_t *self);
+bool common_hal_usb_audio_microphone_get_streaming(usb_audio_microphone_obj_t *self);
+size_t common_hal_usb_audio_microphone_write(usb_audio_microphone_obj_t *self, const int16_t *samples, size_t count);
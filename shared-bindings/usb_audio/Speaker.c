@@ -0,0 +1,115 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/usb_audio/Speaker.h"
+
+//| class Speaker:
+//|     """The audio the host plays to this device, as a sample that plays forever on an audio
+//|     output or `audiomixer.Mixer` voice. It is silent while the host isn't sending audio.
+//|
+//|     A few milliseconds of audio are queued to ride out USB scheduling. The host's clock and
+//|     the audio output's clock never match exactly, so a frame is occasionally dropped or
+//|     repeated to keep the queue from running dry or growing.
+//|
+//|     Cannot be instantiated. Use `usb_audio.speaker`."""
+//|
+//|     def __init__(self) -> None:
+//|         """Not currently dynamically supported. Use `usb_audio.speaker`."""
+//|         ...
+//|
+
+//|     streaming: bool
+//|     """True while the host is sending audio. (read-only)"""
+//|
+static mp_obj_t usb_audio_speaker_obj_get_streaming(mp_obj_t self_in) {
+    usb_audio_speaker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_audio_speaker_get_streaming(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_speaker_get_streaming_obj, usb_audio_speaker_obj_get_streaming);
+
+MP_PROPERTY_GETTER(usb_audio_speaker_streaming_obj,
+    (mp_obj_t)&usb_audio_speaker_get_streaming_obj);
+
+//|     mute: bool
+//|     """True when the host has muted the device. Audio is silenced while muted. (read-only)"""
+//|
+static mp_obj_t usb_audio_speaker_obj_get_mute(mp_obj_t self_in) {
+    usb_audio_speaker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_usb_audio_speaker_get_mute(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_speaker_get_mute_obj, usb_audio_speaker_obj_get_mute);
+
+MP_PROPERTY_GETTER(usb_audio_speaker_mute_obj,
+    (mp_obj_t)&usb_audio_speaker_get_mute_obj);
+
+//|     volume: float
+//|     """The volume set by the host in decibels, from -60.0 to 0.0. It is applied to the
+//|     audio before it is played. (read-only)"""
+//|
+static mp_obj_t usb_audio_speaker_obj_get_volume(mp_obj_t self_in) {
+    usb_audio_speaker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(common_hal_usb_audio_speaker_get_volume(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_speaker_get_volume_obj, usb_audio_speaker_obj_get_volume);
+
+MP_PROPERTY_GETTER(usb_audio_speaker_volume_obj,
+    (mp_obj_t)&usb_audio_speaker_get_volume_obj);
+
+//|     queued: int
+//|     """The number of frames received from the host and not yet played. (read-only)"""
+//|
+static mp_obj_t usb_audio_speaker_obj_get_queued(mp_obj_t self_in) {
+    usb_audio_speaker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_usb_audio_speaker_get_queued(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_speaker_get_queued_obj, usb_audio_speaker_obj_get_queued);
+
+MP_PROPERTY_GETTER(usb_audio_speaker_queued_obj,
+    (mp_obj_t)&usb_audio_speaker_get_queued_obj);
+
+//|     underruns: int
+//|     """The number of times the queue ran dry while the host was streaming, each of which
+//|     causes a short gap. (read-only)"""
+//|
+//|
+static mp_obj_t usb_audio_speaker_obj_get_underruns(mp_obj_t self_in) {
+    usb_audio_speaker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_uint(common_hal_usb_audio_speaker_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(usb_audio_speaker_get_underruns_obj, usb_audio_speaker_obj_get_underruns);
+
+MP_PROPERTY_GETTER(usb_audio_speaker_underruns_obj,
+    (mp_obj_t)&usb_audio_speaker_get_underruns_obj);
+
+static const mp_rom_map_elem_t usb_audio_speaker_locals_dict_table[] = {
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_streaming), MP_ROM_PTR(&usb_audio_speaker_streaming_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mute), MP_ROM_PTR(&usb_audio_speaker_mute_obj) },
+    { MP_ROM_QSTR(MP_QSTR_volume), MP_ROM_PTR(&usb_audio_speaker_volume_obj) },
+    { MP_ROM_QSTR(MP_QSTR_queued), MP_ROM_PTR(&usb_audio_speaker_queued_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&usb_audio_speaker_underruns_obj) },
+    AUDIOSAMPLE_FIELDS,
+};
+static MP_DEFINE_CONST_DICT(usb_audio_speaker_locals_dict, usb_audio_speaker_locals_dict_table);
+
+static const audiosample_p_t usb_audio_speaker_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .reset_buffer = (audiosample_reset_buffer_fun)usb_audio_speaker_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)usb_audio_speaker_get_buffer,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    usb_audio_speaker_type,
+    MP_QSTR_Speaker,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &usb_audio_speaker_locals_dict,
+    protocol, &usb_audio_speaker_proto
+    );
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/usb_audio/Speaker.h"
+
+extern const mp_obj_type_t usb_audio_speaker_type;
+
+bool common_hal_usb_audio_speaker_get_streaming(usb_audio_speaker_obj_t *self);
+bool common_hal_usb_audio_speaker_get_mute(usb_audio_speaker_obj_t *self);
+mp_float_t common_hal_usb_audio_speaker_get_volume(usb_audio_speaker_obj_t *self);
+uint32_t common_hal_usb_audio_speaker_get_queued(usb_audio_speaker_obj_t *self);
+uint32_t common_hal_usb_audio_speaker_get_underruns(usb_audio_speaker_obj_t *self);
@@ -0,0 +1,125 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/usb_audio/__init__.h"
+#include "shared-bindings/usb_audio/Microphone.h"
+#include "shared-bindings/usb_audio/Speaker.h"
+
+//| """Audio over USB
+//|
+//| The `usb_audio` module makes your CircuitPython device identify to the host computer as a
+//| USB Audio Class 2 headset: a stereo speaker the host can play to and a mono microphone the
+//| host can record from. Both use signed 16 bit samples at one fixed sample rate.
+//|
+//| This mode requires 1 IN and 1 OUT endpoint. Generally, microcontrollers have a limit on
+//| the number of endpoints. If you exceed the number of endpoints, CircuitPython
+//| will automatically enter Safe Mode. Even in this case, you may be able to
+//| enable USB audio by also disabling other USB functions, such as `usb_hid` or
+//| `usb_midi`.
+//|
+//| To enable this mode, call `usb_audio.enable()` in ``boot.py``. Then, in ``code.py``, play
+//| `usb_audio.speaker` on an audio output and give `usb_audio.microphone` something to send.
+//|
+//| .. code-block:: py
+//|
+//|     # boot.py
+//|     import usb_audio
+//|     usb_audio.enable(sample_rate=48000)
+//|
+//| .. code-block:: py
+//|
+//|     # code.py
+//|     import audiobusio
+//|     import board
+//|     import usb_audio
+//|
+//|     audio = audiobusio.I2SOut(board.GP0, board.GP1, board.GP2)
+//|     audio.play(usb_audio.speaker)
+//|
+//| This interface is experimental and may change without notice even in stable
+//| versions of CircuitPython."""
+//|
+//| speaker: Optional[Speaker]
+//| """The host's audio output, or ``None`` if USB audio is not enabled."""
+//|
+//| microphone: Optional[Microphone]
+//| """The host's audio input, or ``None`` if USB audio is not enabled."""
+//|
+//|
+
+//| def disable() -> None:
+//|     """Do not present a USB audio device to the host. This is the default.
+//|     Can be called in ``boot.py``, before USB is connected."""
+//|     ...
+//|
+//|
+static mp_obj_t usb_audio_disable(void) {
+    if (!common_hal_usb_audio_disable()) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(usb_audio_disable_obj, usb_audio_disable);
+
+//| def enable(*, sample_rate: int = 48000) -> None:
+//|     """Present a USB audio device to the host.
+//|     Can be called in ``boot.py``, before USB is connected.
+//|
+//|     :param int sample_rate: The sample rate of both directions, in Hz. It must be a whole
+//|       number of kHz, from 8000 to 48000, so each USB frame carries a whole number of samples.
+//|
+//|     If you enable too many devices at once, you will run out of USB endpoints.
+//|     The number of available endpoints varies by microcontroller.
+//|     CircuitPython will go into safe mode after running boot.py to inform you if
+//|     not enough endpoints are available.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t usb_audio_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample_rate };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample_rate, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = USB_AUDIO_MAX_SAMPLE_RATE} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t sample_rate = mp_arg_validate_int_range(args[ARG_sample_rate].u_int, 8000, USB_AUDIO_MAX_SAMPLE_RATE, MP_QSTR_sample_rate);
+    if (sample_rate % 1000 != 0) {
+        mp_arg_error_invalid(MP_QSTR_sample_rate);
+    }
+
+    if (!common_hal_usb_audio_enable(sample_rate)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(usb_audio_enable_obj, 0, usb_audio_enable);
+
+mp_map_elem_t usb_audio_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__),   MP_ROM_QSTR(MP_QSTR_usb_audio) },
+    { MP_ROM_QSTR(MP_QSTR_disable),    MP_OBJ_FROM_PTR(&usb_audio_disable_obj) },
+    { MP_ROM_QSTR(MP_QSTR_enable),     MP_OBJ_FROM_PTR(&usb_audio_enable_obj) },
+    { MP_ROM_QSTR(MP_QSTR_speaker),    mp_const_none },
+    { MP_ROM_QSTR(MP_QSTR_microphone), mp_const_none },
+    { MP_ROM_QSTR(MP_QSTR_Speaker),    MP_OBJ_FROM_PTR(&usb_audio_speaker_type) },
+    { MP_ROM_QSTR(MP_QSTR_Microphone), MP_OBJ_FROM_PTR(&usb_audio_microphone_type) },
+};
+
+// This isn't const so we can set speaker and microphone dynamically.
+MP_DEFINE_MUTABLE_DICT(usb_audio_module_globals, usb_audio_module_globals_table);
+
+const mp_obj_module_t usb_audio_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&usb_audio_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_usb_audio, usb_audio_module);
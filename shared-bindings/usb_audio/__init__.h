@@ -0,0 +1,15 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+#include "shared-module/usb_audio/__init__.h"
+
+extern mp_obj_dict_t usb_audio_module_globals;
+
+bool common_hal_usb_audio_disable(void);
+bool common_hal_usb_audio_enable(uint32_t sample_rate);
@@ -47,7 +47,9 @@ static mp_obj_t usb_hid_disable(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 
-//| def enable(devices: Optional[Sequence[Device]], boot_device: int = 0) -> None:
+//| def enable(
+//|     devices: Optional[Sequence[Device]], boot_device: int = 0, *, poll_interval_us: Optional[int] = None
+//| ) -> None:
 //|     """Specify which USB HID devices that will be available.
 //|     Can be called in ``boot.py``, before USB is connected.
 //|
@@ -60,6 +62,10 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|       If ``boot_device=1``, a boot keyboard is available.
 //|       If ``boot_device=2``, a boot mouse is available. No other values are allowed.
 //|       See below.
+//|     :param int poll_interval_us: How often the host should poll for reports, in microseconds,
+//|       from 125 to 255000. Full speed USB rounds this down to whole milliseconds, with a minimum of 1 ms.
+//|       High speed USB rounds it down to 125 microseconds times a power of two.
+//|       ``None``, the default, uses 8 ms on full speed and 16 ms on high speed.
 //|
 //|     If you enable too many devices at once, you will run out of USB endpoints.
 //|     The number of available endpoints varies by microcontroller.
@@ -94,10 +100,11 @@ MP_DEFINE_CONST_FUN_OBJ_0(usb_hid_disable_obj, usb_hid_disable);
 //|
 //|
 static mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_devices, ARG_boot_device };
+    enum { ARG_devices, ARG_boot_device, ARG_poll_interval_us };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_devices, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_boot_device, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_poll_interval_us, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -113,7 +120,14 @@ static mp_obj_t usb_hid_enable(size_t n_args, const mp_obj_t *pos_args, mp_map_t
     uint8_t boot_device =
         (uint8_t)mp_arg_validate_int_range(args[ARG_boot_device].u_int, 0, 2, MP_QSTR_boot_device);
 
-    if (!common_hal_usb_hid_enable(devices, boot_device)) {
+    // 0 keeps the default interval.
+    uint32_t poll_interval_us = 0;
+    if (args[ARG_poll_interval_us].u_obj != mp_const_none) {
+        poll_interval_us = mp_arg_validate_int_range(
+            mp_obj_get_int(args[ARG_poll_interval_us].u_obj), 125, 255000, MP_QSTR_poll_interval_us);
+    }
+
+    if (!common_hal_usb_hid_enable(devices, boot_device, poll_interval_us)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Cannot change USB devices now"));
     }
 
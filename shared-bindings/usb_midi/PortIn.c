@@ -14,6 +14,10 @@
 #include "py/runtime.h"
 #include "py/stream.h"
 
+#if CIRCUITPY_SYNTHIO
+#include "shared-bindings/synthio/Synthesizer.h"
+#endif
+
 //| class PortIn:
 //|     """Receives midi commands over USB"""
 //|
@@ -45,7 +49,6 @@
 //|         :rtype: bytes or None"""
 //|         ...
 //|
-//|
 
 // These three methods are used by the shared stream methods.
 static mp_uint_t usb_midi_portin_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
@@ -76,10 +79,72 @@ static mp_uint_t usb_midi_portin_ioctl(mp_obj_t self_in, mp_uint_t request, mp_u
     return ret;
 }
 
+//|     def read_events_into(self, buffer: WriteableBuffer) -> int:
+//|         """Parse waiting channel messages into ``buffer`` and return how many were stored.
+//|
+//|         Each USB-MIDI packet already holds one complete message, so this does not allocate
+//|         or need to track running status. Each event is stored as a record of `RECORD_SIZE`
+//|         bytes laid out as ``struct.Struct("<BBBBI")``: the channel, the status byte without
+//|         the channel, the two data bytes and the `supervisor.ticks_ms` time it was read.
+//|         System real-time messages are stored with channel ``0`` and their full status byte.
+//|         SysEx and system common messages are skipped; use `read` to receive those.
+//|
+//|         :param WriteableBuffer buffer: Buffer to fill, usually a multiple of `RECORD_SIZE` bytes.
+//|         :return: The number of events stored.
+//|         :rtype: int
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_midi_portin_read_events_into(mp_obj_t self_in, mp_obj_t buffer_in) {
+    usb_midi_portin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    size_t count = common_hal_usb_midi_portin_read_events_into(self, bufinfo.buf, bufinfo.len / sizeof(usb_midi_event_record_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portin_read_events_into_obj, usb_midi_portin_read_events_into);
+
+//|     RECORD_SIZE: int
+//|     """The size in bytes of each event record written by `read_events_into`."""
+//|
+
+#if CIRCUITPY_SYNTHIO
+//|     def route_to(self, synthesizer: Optional[synthio.Synthesizer]) -> None:
+//|         """Play incoming notes on ``synthesizer`` as they arrive, without running any Python code.
+//|
+//|         Note on messages press the note and note off messages release it, on every
+//|         channel. Control change 123 (All Notes Off) releases every note. All other
+//|         messages are dropped while routing. Pass ``None`` to stop routing and
+//|         receive messages with `read` again. Routing stops when the VM exits.
+//|
+//|         :param Optional[synthio.Synthesizer] synthesizer: The synthesizer to play, or ``None``.
+//|         """
+//|         ...
+//|
+static mp_obj_t usb_midi_portin_route_to(mp_obj_t self_in, mp_obj_t synthesizer_in) {
+    usb_midi_portin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (synthesizer_in != mp_const_none) {
+        mp_arg_validate_type(synthesizer_in, &synthio_synthesizer_type, MP_QSTR_synthesizer);
+    }
+    common_hal_usb_midi_portin_route_to(self, synthesizer_in);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portin_route_to_obj, usb_midi_portin_route_to);
+#endif
+//|
+
 static const mp_rom_map_elem_t usb_midi_portin_locals_dict_table[] = {
     // Standard stream methods.
     { MP_ROM_QSTR(MP_QSTR_read),     MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_read_events_into), MP_ROM_PTR(&usb_midi_portin_read_events_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RECORD_SIZE), MP_ROM_INT(sizeof(usb_midi_event_record_t)) },
+    #if CIRCUITPY_SYNTHIO
+    { MP_ROM_QSTR(MP_QSTR_route_to), MP_ROM_PTR(&usb_midi_portin_route_to_obj) },
+    #endif
 };
 static MP_DEFINE_CONST_DICT(usb_midi_portin_locals_dict, usb_midi_portin_locals_dict_table);
 
@@ -16,3 +16,7 @@ extern size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self,
 
 extern uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self);
 extern void common_hal_usb_midi_portin_clear_buffer(usb_midi_portin_obj_t *self);
+extern size_t common_hal_usb_midi_portin_read_events_into(usb_midi_portin_obj_t *self, uint8_t *buf, size_t max_events);
+#if CIRCUITPY_SYNTHIO
+extern void common_hal_usb_midi_portin_route_to(usb_midi_portin_obj_t *self, mp_obj_t synthesizer);
+#endif
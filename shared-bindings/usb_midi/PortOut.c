@@ -29,6 +29,10 @@
 //|     def write(self, buf: ReadableBuffer) -> Optional[int]:
 //|         """Write the buffer of bytes to the bus.
 //|
+//|         Messages that rely on running status get their status byte added back, because
+//|         every USB-MIDI packet carries its own. Waits until all of ``buf`` has been queued,
+//|         so a long SysEx message can be written in one call.
+//|
 //|         :return: the number of bytes written
 //|         :rtype: int or None"""
 //|         ...
@@ -29,7 +29,11 @@ static void check_for_deinit(usb_video_uvcframebuffer_obj_t *self) {
 //|
 //|     This object is most often used with `framebufferio.FramebufferDisplay`. However,
 //|     it also supports the ``WritableBuffer`` protocol and can be accessed
-//|     as an array of ``H`` (unsigned 16-bit values)."""
+//|     as an array of ``H`` (unsigned 16-bit values).
+//|
+//|     Only the rows that changed are converted for each frame, and frames that are
+//|     unchanged since the last one are not sent, except about once a second so the
+//|     host keeps the stream open."""
 //|
 //|     def __init__(self) -> None:
 //|         """Returns the singleton framebuffer object, if USB video is enabled"""
@@ -98,6 +102,13 @@ static void usb_video_uvcframebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirt
     shared_module_usb_video_uvcframebuffer_refresh(self_in);
 }
 
+static void usb_video_uvcframebuffer_swapbuffers_areas(mp_obj_t self_in, const displayio_area_t *dirty_areas, size_t dirty_area_count) {
+    (void)self_in;
+    for (size_t i = 0; i < dirty_area_count; i++) {
+        shared_module_usb_video_swapbuffers_rows(dirty_areas[i].y1, dirty_areas[i].y2);
+    }
+}
+
 static void usb_video_uvcframebuffer_deinit_proto(mp_obj_t self_in) {
     /* NOTHING */
 }
@@ -126,6 +137,7 @@ static const framebuffer_p_t usb_video_uvcframebuffer_proto = {
     .get_height = usb_video_uvcframebuffer_get_height_proto,
     .get_native_frames_per_second = usb_video_uvcframebuffer_get_native_frames_per_second_proto,
     .swapbuffers = usb_video_uvcframebuffer_swapbuffers,
+    .swapbuffers_areas = usb_video_uvcframebuffer_swapbuffers_areas,
     .deinit = usb_video_uvcframebuffer_deinit_proto,
     .get_reverse_pixels_in_word = usb_video_uvcframebuffer_get_reverse_pixels_in_word_proto,
 };
@@ -10,3 +10,4 @@
 bool shared_module_usb_video_enable(mp_int_t frame_width, mp_int_t frame_height);
 bool shared_module_usb_video_disable(void);
 void shared_module_usb_video_swapbuffers(void);
+void shared_module_usb_video_swapbuffers_rows(uint16_t first_row, uint16_t end_row);
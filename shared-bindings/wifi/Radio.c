@@ -214,6 +214,34 @@ MP_PROPERTY_GETSET(wifi_radio_power_management_obj,
     (mp_obj_t)&wifi_radio_get_power_management_obj,
     (mp_obj_t)&wifi_radio_set_power_management_obj);
 
+//|     listen_interval: int
+//|     """How many AP beacon intervals the station sleeps between wakeups when
+//|     `power_management` is `wifi.PowerManagement.MAX`. Larger values save power at the cost of
+//|     latency; the AP buffers frames for the station in the meantime. The AP is told this value
+//|     when associating, so changes take effect on the next `connect`. The default is 3.
+//|
+//|     **Limitations:** Only available on Espressif boards.
+//|     """
+#if CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL
+static mp_obj_t wifi_radio_get_listen_interval(mp_obj_t self_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_wifi_radio_get_listen_interval(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(wifi_radio_get_listen_interval_obj, wifi_radio_get_listen_interval);
+
+static mp_obj_t wifi_radio_set_listen_interval(mp_obj_t self_in, mp_obj_t listen_interval_in) {
+    wifi_radio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t listen_interval = mp_arg_validate_int_range(mp_obj_get_int(listen_interval_in), 1, 0xffff, MP_QSTR_listen_interval);
+    common_hal_wifi_radio_set_listen_interval(self, listen_interval);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_radio_set_listen_interval_obj, wifi_radio_set_listen_interval);
+
+MP_PROPERTY_GETSET(wifi_radio_listen_interval_obj,
+    (mp_obj_t)&wifi_radio_get_listen_interval_obj,
+    (mp_obj_t)&wifi_radio_set_listen_interval_obj);
+#endif
+
 //|     mac_address_ap: ReadableBuffer
 //|     """MAC address for the AP. When the address is altered after interface is started
 //|        the changes would only be reflected once the interface restarts.
@@ -868,6 +896,9 @@ static const mp_rom_map_elem_t wifi_radio_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_ipv4_address),    MP_ROM_PTR(&wifi_radio_ipv4_address_obj) },
     { MP_ROM_QSTR(MP_QSTR_ipv4_address_ap),    MP_ROM_PTR(&wifi_radio_ipv4_address_ap_obj) },
     { MP_ROM_QSTR(MP_QSTR_power_management),    MP_ROM_PTR(&wifi_radio_power_management_obj) },
+    #if CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL
+    { MP_ROM_QSTR(MP_QSTR_listen_interval),    MP_ROM_PTR(&wifi_radio_listen_interval_obj) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_set_ipv4_address),    MP_ROM_PTR(&wifi_radio_set_ipv4_address_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_ipv4_address_ap),    MP_ROM_PTR(&wifi_radio_set_ipv4_address_ap_obj) },
@@ -79,6 +79,10 @@ extern void common_hal_wifi_radio_set_tx_power(wifi_radio_obj_t *self, const mp_
 
 extern wifi_power_management_t common_hal_wifi_radio_get_power_management(wifi_radio_obj_t *self);
 extern void common_hal_wifi_radio_set_power_management(wifi_radio_obj_t *self, wifi_power_management_t power_management);
+#if CIRCUITPY_WIFI_RADIO_LISTEN_INTERVAL
+extern mp_int_t common_hal_wifi_radio_get_listen_interval(wifi_radio_obj_t *self);
+extern void common_hal_wifi_radio_set_listen_interval(wifi_radio_obj_t *self, mp_int_t listen_interval);
+#endif
 
 extern mp_obj_t common_hal_wifi_radio_start_scanning_networks(wifi_radio_obj_t *self, uint8_t start_channel, uint8_t stop_channel);
 extern void common_hal_wifi_radio_stop_scanning_networks(wifi_radio_obj_t *self);
@@ -0,0 +1,156 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mperrno.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/zlib/CompressIO.h"
+
+//| class CompressIO:
+//|     def __init__(
+//|         self,
+//|         stream: circuitpython_typing.ByteStream,
+//|         wbits: int = 10,
+//|         *,
+//|         chain: int = 16,
+//|         scratch: Optional[WriteableBuffer] = None,
+//|     ) -> None:
+//|         """Compresses the data written to it and writes the result to ``stream``, a chunk at
+//|         a time. `close()` must be called, directly or by leaving a ``with`` block, to finish
+//|         the compressed data.
+//|
+//|         :param ~circuitpython_typing.ByteStream stream: Where to write the compressed data
+//|         :param int wbits: The window size and format. 8 to 15 produce a zlib stream with a
+//|           window of ``2**wbits`` bytes, -8 to -15 raw DEFLATE and 24 to 31 a gzip stream,
+//|           the same as for `zlib.decompress`. A larger window finds more repeats but needs
+//|           more memory.
+//|         :param int chain: How many earlier places with a possible match are compared, from
+//|           1 to 4096. Longer chains compress better and run slower.
+//|         :param ~circuitpython_typing.WriteableBuffer scratch: Memory to compress in, of at
+//|           least ``5 * 2**|wbits|`` bytes, for instance one set aside at startup so that
+//|           compressing never needs the heap. Its contents are overwritten and it must not be
+//|           resized while in use. When None, the memory is allocated.
+//|
+//|         Compress log lines to a file::
+//|
+//|           import zlib
+//|
+//|           with open("/log.gz", "wb") as f:
+//|               with zlib.CompressIO(f, 31) as log:
+//|                   for line in lines:
+//|                       log.write(line)
+//|         """
+//|         ...
+//|
+static mp_obj_t zlib_compressio_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_stream, ARG_wbits, ARG_chain, ARG_scratch };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_stream, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 10} },
+        { MP_QSTR_chain, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16} },
+        { MP_QSTR_scratch, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t wbits = args[ARG_wbits].u_int;
+    zlib_compressio_format_t format;
+    if (wbits >= 8 && wbits <= 15) {
+        format = ZLIB_COMPRESSIO_FORMAT_ZLIB;
+    } else if (wbits >= -15 && wbits <= -8) {
+        format = ZLIB_COMPRESSIO_FORMAT_RAW;
+        wbits = -wbits;
+    } else if (wbits >= 24 && wbits <= 31) {
+        format = ZLIB_COMPRESSIO_FORMAT_GZIP;
+        wbits -= 16;
+    } else {
+        mp_arg_error_invalid(MP_QSTR_wbits);
+    }
+    mp_int_t chain = mp_arg_validate_int_range(args[ARG_chain].u_int, 1, 4096, MP_QSTR_chain);
+
+    zlib_compressio_obj_t *self = mp_obj_malloc(zlib_compressio_obj_t, &zlib_compressio_type);
+    common_hal_zlib_compressio_construct(self, args[ARG_stream].u_obj, format, wbits, chain,
+        args[ARG_scratch].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def write(self, buf: ReadableBuffer) -> int:
+//|         """Compresses ``buf``. Output is written to the stream as it fills a chunk, so some of
+//|         it may be held back until `flush()` or `close()`.
+//|
+//|         :return: the number of bytes taken, always all of ``buf``"""
+//|         ...
+//|
+//|     def flush(self) -> None:
+//|         """Compresses everything written so far and writes it all to the stream, so that it
+//|         can be decompressed up to here. Each flush costs a few bytes of output."""
+//|         ...
+//|
+//|     def close(self) -> None:
+//|         """Finishes the compressed data and releases the memory used. The stream is left
+//|         open."""
+//|         ...
+//|
+//|     def __enter__(self) -> CompressIO:
+//|         """No-op used by Context Managers."""
+//|         ...
+//|
+//|     def __exit__(self) -> None:
+//|         """Automatically closes when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//|
+//|
+static mp_uint_t zlib_compressio_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
+    zlib_compressio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_zlib_compressio_closed(self)) {
+        *errcode = MP_EINVAL;
+        return MP_STREAM_ERROR;
+    }
+    common_hal_zlib_compressio_write(self, buf, size);
+    return size;
+}
+
+static mp_uint_t zlib_compressio_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t arg, int *errcode) {
+    zlib_compressio_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    switch (request) {
+        case MP_STREAM_FLUSH:
+            if (common_hal_zlib_compressio_closed(self)) {
+                break;
+            }
+            common_hal_zlib_compressio_flush(self);
+            return 0;
+        case MP_STREAM_CLOSE:
+            common_hal_zlib_compressio_close(self);
+            return 0;
+    }
+    *errcode = MP_EINVAL;
+    return MP_STREAM_ERROR;
+}
+
+static const mp_rom_map_elem_t zlib_compressio_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&mp_stream___exit___obj) },
+};
+static MP_DEFINE_CONST_DICT(zlib_compressio_locals_dict, zlib_compressio_locals_dict_table);
+
+static const mp_stream_p_t zlib_compressio_stream_p = {
+    .write = zlib_compressio_write,
+    .ioctl = zlib_compressio_ioctl,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_compressio_type,
+    MP_QSTR_CompressIO,
+    MP_TYPE_FLAG_NONE,
+    make_new, zlib_compressio_make_new,
+    protocol, &zlib_compressio_stream_p,
+    locals_dict, &zlib_compressio_locals_dict
+    );
@@ -0,0 +1,23 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "shared-module/zlib/CompressIO.h"
+
+extern const mp_obj_type_t zlib_compressio_type;
+
+// Bytes of scratch memory needed for a window of 2**window_bits bytes.
+size_t common_hal_zlib_compressio_scratch_size(mp_int_t window_bits);
+
+// scratch is a buffer of at least common_hal_zlib_compressio_scratch_size() bytes, or
+// mp_const_none to allocate one.
+void common_hal_zlib_compressio_construct(zlib_compressio_obj_t *self, mp_obj_t stream,
+    zlib_compressio_format_t format, mp_int_t window_bits, mp_int_t chain, mp_obj_t scratch);
+bool common_hal_zlib_compressio_closed(zlib_compressio_obj_t *self);
+void common_hal_zlib_compressio_write(zlib_compressio_obj_t *self, const uint8_t *data, size_t len);
+void common_hal_zlib_compressio_flush(zlib_compressio_obj_t *self);
+void common_hal_zlib_compressio_close(zlib_compressio_obj_t *self);
@@ -18,12 +18,14 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/CompressIO.h"
 
-//| """zlib decompression functionality
+//| """zlib compression and decompression functionality
 //|
 //| The `zlib` module allows limited functionality similar to the CPython zlib library.
 //| This module allows to decompress binary data compressed with DEFLATE algorithm
-//| (commonly used in zlib library and gzip archiver). Compression is not yet implemented."""
+//| (commonly used in zlib library and gzip archiver), and to compress a stream with
+//| `CompressIO`."""
 //|
 //|
 
@@ -45,7 +47,8 @@
 //|
 //|     :param bytes data: data to be decompressed
 //|     :param int wbits: DEFLATE dictionary window size used during compression. See above.
-//|     :param int bufsize: ignored for compatibility with CPython only
+//|     :param int bufsize: the expected size of the decompressed data. When it is right, the
+//|       output is allocated once instead of being grown while decompressing.
 //|     """
 //|     ...
 //|
@@ -55,14 +58,41 @@ static mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
     if (n_args > 1) {
         wbits = MP_OBJ_SMALL_INT_VALUE(args[1]);
     }
+    mp_int_t bufsize = 0;
+    if (n_args > 2) {
+        bufsize = mp_arg_validate_int_min(mp_obj_get_int(args[2]), 0, MP_QSTR_bufsize);
+    }
 
-    return common_hal_zlib_decompress(args[0], wbits);
+    return common_hal_zlib_decompress(args[0], wbits, bufsize);
 }
 static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
 
+//| def decompress_into(data: ReadableBuffer, buffer: WriteableBuffer, wbits: Optional[int] = 0) -> int:
+//|     """Decompress *data* into *buffer* without allocating, and return the number of bytes
+//|     written. Raises `ValueError` if *buffer* is too small for the output.
+//|
+//|     :param bytes data: data to be decompressed
+//|     :param WriteableBuffer buffer: where to write the decompressed data
+//|     :param int wbits: DEFLATE dictionary window size used during compression. See `decompress`.
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t zlib_decompress_into(size_t n_args, const mp_obj_t *args) {
+    mp_int_t wbits = 0;
+    if (n_args > 2) {
+        wbits = mp_obj_get_int(args[2]);
+    }
+
+    return mp_obj_new_int_from_uint(common_hal_zlib_decompress_into(args[0], args[1], wbits));
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_into_obj, 2, 3, zlib_decompress_into);
+
 static const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompress_into), MP_ROM_PTR(&zlib_decompress_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_CompressIO), MP_ROM_PTR(&zlib_compressio_type) },
 };
 
 static MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
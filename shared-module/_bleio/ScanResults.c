@@ -14,15 +14,73 @@
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/_bleio/ScanResults.h"
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi) {
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi,
+    uint8_t *addresses, size_t address_count, mp_int_t dedup_window_ms) {
     bleio_scanresults_obj_t *self = mp_obj_malloc(bleio_scanresults_obj_t, &bleio_scanresults_type);
     ringbuf_alloc(&self->buf, buffer_size);
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
     self->minimum_rssi = minimum_rssi;
+    self->addresses = addresses;
+    self->address_count = address_count;
+    self->dedup = NULL;
+    self->dedup_window_ms = dedup_window_ms;
+    self->dedup_next = 0;
+    if (dedup_window_ms > 0) {
+        self->dedup = m_new0(bleio_scan_dedup_entry_t, BLEIO_SCAN_DEDUP_ENTRIES);
+    }
     return self;
 }
 
+static bool address_allowed(bleio_scanresults_obj_t *self, const uint8_t *peer_addr) {
+    if (self->address_count == 0) {
+        return true;
+    }
+    for (size_t i = 0; i < self->address_count; i++) {
+        if (memcmp(self->addresses + i * NUM_BLEIO_ADDRESS_BYTES, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint32_t fnv1a(uint32_t hash, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619;
+    }
+    return hash;
+}
+
+// Returns true if the same packet from the same peer was kept within the dedup window.
+// Otherwise remembers it and returns false.
+static bool is_duplicate(bleio_scanresults_obj_t *self, uint64_t ticks_ms, uint8_t type,
+    const uint8_t *peer_addr, const uint8_t *data, uint16_t len) {
+    if (self->dedup == NULL) {
+        return false;
+    }
+    uint32_t hash = fnv1a(2166136261, &type, sizeof(type));
+    hash = fnv1a(hash, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    hash = fnv1a(hash, data, len);
+
+    uint32_t now = (uint32_t)ticks_ms;
+    for (size_t i = 0; i < BLEIO_SCAN_DEDUP_ENTRIES; i++) {
+        bleio_scan_dedup_entry_t *entry = &self->dedup[i];
+        if (entry->hash == hash && entry->ticks_ms != 0) {
+            if (now - entry->ticks_ms < self->dedup_window_ms) {
+                return true;
+            }
+            entry->ticks_ms = now | 1;
+            return false;
+        }
+    }
+    // Replace the oldest packet we remember. A zero time marks an unused entry.
+    bleio_scan_dedup_entry_t *entry = &self->dedup[self->dedup_next];
+    entry->hash = hash;
+    entry->ticks_ms = now | 1;
+    self->dedup_next = (self->dedup_next + 1) % BLEIO_SCAN_DEDUP_ENTRIES;
+    return false;
+}
+
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
@@ -82,6 +140,10 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
         return;
     }
 
+    if (!address_allowed(self, peer_addr)) {
+        return;
+    }
+
     // If any prefixes are provided, then only include packets that include at least one of them.
     if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
         return;
@@ -102,7 +164,8 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
         sizeof(addr_type) + sizeof(len) + len;
     int32_t empty_space = self->buf.size - ringbuf_num_filled(&self->buf);
 
-    if (packet_size <= empty_space) {
+    // Only remember packets that are kept, so a dropped one isn't treated as seen.
+    if (packet_size <= empty_space && !is_duplicate(self, ticks_ms, type, peer_addr, data, len)) {
         // Packet will fit.
         ringbuf_put(&self->buf, type);
         ringbuf_put_n(&self->buf, (uint8_t *)&ticks_ms, sizeof(ticks_ms));
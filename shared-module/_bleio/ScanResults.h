@@ -12,6 +12,14 @@
 #include "py/obj.h"
 #include "py/ringbuf.h"
 
+// How many recently seen advertisements are remembered for deduplication.
+#define BLEIO_SCAN_DEDUP_ENTRIES (32)
+
+typedef struct {
+    uint32_t hash;
+    uint32_t ticks_ms;
+} bleio_scan_dedup_entry_t;
+
 typedef struct {
     mp_obj_base_t base;
     // Pointers that needs to live until the scan is done.
@@ -21,11 +29,19 @@ typedef struct {
     uint8_t *prefixes;
     size_t prefix_length;
     mp_int_t minimum_rssi;
+    // Only packets from these addresses are kept. NUM_BLEIO_ADDRESS_BYTES per address.
+    uint8_t *addresses;
+    size_t address_count;
+    // Identical packets seen again within dedup_window_ms are dropped. 0 disables this.
+    bleio_scan_dedup_entry_t *dedup;
+    uint32_t dedup_window_ms;
+    uint8_t dedup_next;
     bool active;
     bool done;
 } bleio_scanresults_obj_t;
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi,
+    uint8_t *addresses, size_t address_count, mp_int_t dedup_window_ms);
 
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t *self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t *self, bool done);
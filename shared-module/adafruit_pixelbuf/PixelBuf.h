@@ -36,6 +36,8 @@ typedef struct {
     // account for any header.
     uint8_t *post_brightness_buffer;
     uint8_t *pre_brightness_buffer;
+    // Set when pre_brightness_buffer has changes that show() still needs to scale.
+    bool post_brightness_stale;
     bool auto_write;
 } pixelbuf_pixelbuf_obj_t;
 
@@ -22,6 +22,8 @@ void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
 void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
     uint32_t key_length, const uint8_t *iv) {
     memset(&self->ctx, 0, sizeof(self->ctx));
+    memcpy(self->key, key, key_length);
+    self->key_length = key_length;
     if (iv != NULL) {
         AES_init_ctx_iv(&self->ctx, key, key_length, iv);
     } else {
@@ -33,8 +35,21 @@ void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
     self->mode = mode;
 }
 
+MP_WEAK bool common_hal_aesio_aes_port_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
+    size_t length) {
+    return false;
+}
+
+MP_WEAK bool common_hal_aesio_aes_port_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
+    size_t length) {
+    return false;
+}
+
 void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    if (common_hal_aesio_aes_port_encrypt(self, buffer, length)) {
+        return;
+    }
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_encrypt(&self->ctx, buffer);
@@ -50,6 +65,9 @@ void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
 
 void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
     size_t length) {
+    if (common_hal_aesio_aes_port_decrypt(self, buffer, length)) {
+        return;
+    }
     switch (self->mode) {
         case AES_MODE_ECB:
             AES_ECB_decrypt(&self->ctx, buffer);
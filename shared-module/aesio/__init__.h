@@ -33,4 +33,8 @@ typedef struct {
 
     // Counter for running in CTR mode
     uint32_t counter;
+
+    // The key as given, for ports that hand the work to a crypto peripheral
+    uint8_t key[32];
+    uint8_t key_length;
 } aesio_aes_obj_t;
@@ -0,0 +1,255 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/arrayops/__init__.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "py/misc.h"
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+// Expands BODY once per integer element type so each loop is compiled for its own type.
+#define ARRAYOPS_FOR_INT_TYPE(array, BODY) \
+    switch ((array)->type) { \
+        case ARRAYOPS_INT8: BODY(int8_t); break; \
+        case ARRAYOPS_UINT8: BODY(uint8_t); break; \
+        case ARRAYOPS_INT16: BODY(int16_t); break; \
+        case ARRAYOPS_UINT16: BODY(uint16_t); break; \
+        case ARRAYOPS_INT32: BODY(int32_t); break; \
+        case ARRAYOPS_UINT32: BODY(uint32_t); break; \
+        default: break; \
+    }
+
+static const int64_t type_min[] = {
+    [ARRAYOPS_INT8] = INT8_MIN,
+    [ARRAYOPS_UINT8] = 0,
+    [ARRAYOPS_INT16] = INT16_MIN,
+    [ARRAYOPS_UINT16] = 0,
+    [ARRAYOPS_INT32] = INT32_MIN,
+    [ARRAYOPS_UINT32] = 0,
+};
+
+static const int64_t type_max[] = {
+    [ARRAYOPS_INT8] = INT8_MAX,
+    [ARRAYOPS_UINT8] = UINT8_MAX,
+    [ARRAYOPS_INT16] = INT16_MAX,
+    [ARRAYOPS_UINT16] = UINT16_MAX,
+    [ARRAYOPS_INT32] = INT32_MAX,
+    [ARRAYOPS_UINT32] = UINT32_MAX,
+};
+
+static inline int64_t saturate(int64_t value, int64_t min, int64_t max) {
+    return MIN(MAX(value, min), max);
+}
+
+void common_hal_arrayops_scale_int(const arrayops_array_t *array, mp_int_t gain, mp_int_t offset) {
+    int64_t min = type_min[array->type];
+    int64_t max = type_max[array->type];
+    #define SCALE_INT(T) do { \
+        T *items = array->items; \
+        for (size_t i = 0; i < array->len; i++) { \
+            items[i] = saturate((int64_t)items[i] * gain + offset, min, max); \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(array, SCALE_INT);
+    #undef SCALE_INT
+}
+
+void common_hal_arrayops_scale_float(const arrayops_array_t *array, mp_float_t gain, mp_float_t offset) {
+    if (array->type == ARRAYOPS_FLOAT) {
+        float *items = array->items;
+        for (size_t i = 0; i < array->len; i++) {
+            items[i] = (float)((mp_float_t)items[i] * gain + offset);
+        }
+        return;
+    }
+    mp_float_t min = type_min[array->type];
+    mp_float_t max = type_max[array->type];
+    #define SCALE_FLOAT(T) do { \
+        T *items = array->items; \
+        for (size_t i = 0; i < array->len; i++) { \
+            mp_float_t value = MICROPY_FLOAT_C_FUN(floor)((mp_float_t)items[i] * gain + offset + MICROPY_FLOAT_CONST(0.5)); \
+            items[i] = (T)MIN(MAX(value, min), max); \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(array, SCALE_FLOAT);
+    #undef SCALE_FLOAT
+}
+
+int64_t common_hal_arrayops_sum_int(const arrayops_array_t *array) {
+    int64_t sum = 0;
+    size_t i = 0;
+    #if defined(__ARM_FEATURE_SIMD32)
+    if (array->type == ARRAYOPS_INT16) {
+        // Multiplying each pair of halfwords by one adds two samples per instruction.
+        const int16_t *items = array->items;
+        for (; i + 2 <= array->len; i += 2) {
+            int32_t pair;
+            memcpy(&pair, items + i, sizeof(pair));
+            sum = __smlald(pair, 0x00010001, sum);
+        }
+    }
+    #endif
+    #define SUM(T) do { \
+        const T *items = array->items; \
+        for (; i < array->len; i++) { \
+            sum += items[i]; \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(array, SUM);
+    #undef SUM
+    return sum;
+}
+
+mp_float_t common_hal_arrayops_sum_float(const arrayops_array_t *array) {
+    const float *items = array->items;
+    mp_float_t sum = 0;
+    for (size_t i = 0; i < array->len; i++) {
+        sum += (mp_float_t)items[i];
+    }
+    return sum;
+}
+
+void common_hal_arrayops_minmax_int(const arrayops_array_t *array, int64_t *min_out, int64_t *max_out) {
+    #define MINMAX(T) do { \
+        const T *items = array->items; \
+        T min = items[0]; \
+        T max = items[0]; \
+        for (size_t i = 1; i < array->len; i++) { \
+            min = MIN(min, items[i]); \
+            max = MAX(max, items[i]); \
+        } \
+        *min_out = min; \
+        *max_out = max; \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(array, MINMAX);
+    #undef MINMAX
+}
+
+void common_hal_arrayops_minmax_float(const arrayops_array_t *array, mp_float_t *min_out, mp_float_t *max_out) {
+    const float *items = array->items;
+    float min = items[0];
+    float max = items[0];
+    for (size_t i = 1; i < array->len; i++) {
+        min = MIN(min, items[i]);
+        max = MAX(max, items[i]);
+    }
+    *min_out = (mp_float_t)min;
+    *max_out = (mp_float_t)max;
+}
+
+int64_t common_hal_arrayops_dot_int(const arrayops_array_t *a, const arrayops_array_t *b) {
+    int64_t sum = 0;
+    size_t i = 0;
+    #if defined(__ARM_FEATURE_SIMD32)
+    if (a->type == ARRAYOPS_INT16) {
+        const int16_t *a_items = a->items;
+        const int16_t *b_items = b->items;
+        for (; i + 2 <= a->len; i += 2) {
+            int32_t a_pair;
+            int32_t b_pair;
+            memcpy(&a_pair, a_items + i, sizeof(a_pair));
+            memcpy(&b_pair, b_items + i, sizeof(b_pair));
+            sum = __smlald(a_pair, b_pair, sum);
+        }
+    }
+    #endif
+    #define DOT(T) do { \
+        const T *a_items = a->items; \
+        const T *b_items = b->items; \
+        for (; i < a->len; i++) { \
+            sum += (int64_t)a_items[i] * b_items[i]; \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(a, DOT);
+    #undef DOT
+    return sum;
+}
+
+mp_float_t common_hal_arrayops_dot_float(const arrayops_array_t *a, const arrayops_array_t *b) {
+    const float *a_items = a->items;
+    const float *b_items = b->items;
+    mp_float_t sum = 0;
+    for (size_t i = 0; i < a->len; i++) {
+        sum += (mp_float_t)a_items[i] * (mp_float_t)b_items[i];
+    }
+    return sum;
+}
+
+// Keeps a running sum of the window. The sample leaving the window is read before its slot can
+// be overwritten, so output may be the input itself.
+void common_hal_arrayops_moving_average(const arrayops_array_t *input, const arrayops_array_t *output, size_t window) {
+    size_t count = input->len - window + 1;
+    if (input->type == ARRAYOPS_FLOAT) {
+        const float *in = input->items;
+        float *out = output->items;
+        mp_float_t sum = 0;
+        for (size_t i = 0; i < window - 1; i++) {
+            sum += (mp_float_t)in[i];
+        }
+        for (size_t i = 0; i < count; i++) {
+            float leaving = in[i];
+            sum += (mp_float_t)in[i + window - 1];
+            out[i] = (float)(sum / window);
+            sum -= (mp_float_t)leaving;
+        }
+        return;
+    }
+    #define MOVING_AVERAGE(T) do { \
+        const T *in = input->items; \
+        T *out = output->items; \
+        int64_t sum = 0; \
+        for (size_t i = 0; i < window - 1; i++) { \
+            sum += in[i]; \
+        } \
+        for (size_t i = 0; i < count; i++) { \
+            T leaving = in[i]; \
+            sum += in[i + window - 1]; \
+            out[i] = sum / (int64_t)window; \
+            sum -= leaving; \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(input, MOVING_AVERAGE);
+    #undef MOVING_AVERAGE
+}
+
+size_t common_hal_arrayops_crossings_int(const arrayops_array_t *array, int64_t threshold) {
+    size_t crossings = 0;
+    if (array->len == 0) {
+        return 0;
+    }
+    #define CROSSINGS(T) do { \
+        const T *items = array->items; \
+        bool above = items[0] >= threshold; \
+        for (size_t i = 1; i < array->len; i++) { \
+            bool now_above = items[i] >= threshold; \
+            crossings += now_above != above; \
+            above = now_above; \
+        } \
+    } while (0)
+    ARRAYOPS_FOR_INT_TYPE(array, CROSSINGS);
+    #undef CROSSINGS
+    return crossings;
+}
+
+size_t common_hal_arrayops_crossings_float(const arrayops_array_t *array, mp_float_t threshold) {
+    const float *items = array->items;
+    size_t crossings = 0;
+    if (array->len == 0) {
+        return 0;
+    }
+    bool above = (mp_float_t)items[0] >= threshold;
+    for (size_t i = 1; i < array->len; i++) {
+        bool now_above = (mp_float_t)items[i] >= threshold;
+        crossings += now_above != above;
+        above = now_above;
+    }
+    return crossings;
+}
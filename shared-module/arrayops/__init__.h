@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+
+#include "py/obj.h"
+
+typedef enum {
+    ARRAYOPS_INT8,
+    ARRAYOPS_UINT8,
+    ARRAYOPS_INT16,
+    ARRAYOPS_UINT16,
+    ARRAYOPS_INT32,
+    ARRAYOPS_UINT32,
+    ARRAYOPS_FLOAT,
+} arrayops_type_t;
+
+// A buffer protocol object viewed as a typed array.
+typedef struct {
+    void *items;
+    size_t len;
+    arrayops_type_t type;
+} arrayops_array_t;
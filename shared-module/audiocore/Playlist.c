@@ -0,0 +1,284 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/Playlist.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/runtime.h"
+#include "shared-module/audiocore/Playlist.h"
+
+void common_hal_audiocore_playlist_construct(audiocore_playlist_obj_t *self, uint32_t sample_rate,
+    uint8_t channel_count, uint32_t crossfade_frames, bool continuous, uint32_t buffer_size) {
+    self->base.bits_per_sample = 16;
+    self->base.samples_signed = true;
+    self->base.channel_count = channel_count;
+    self->base.sample_rate = sample_rate;
+    self->base.single_buffer = false;
+    self->base.max_buffer_length = buffer_size;
+
+    self->queue = mp_obj_new_list(0, NULL);
+    self->continuous = continuous;
+    self->crossfade_frames = crossfade_frames;
+
+    for (size_t i = 0; i < 2; i++) {
+        self->source[i].sample = MP_OBJ_NULL;
+        self->buffer[i] = m_malloc_without_collect(buffer_size);
+        if (self->buffer[i] == NULL) {
+            common_hal_audiocore_playlist_deinit(self);
+            m_malloc_fail(buffer_size);
+        }
+    }
+
+    self->ring = NULL;
+    if (crossfade_frames > 0) {
+        size_t ring_size = crossfade_frames * channel_count * sizeof(int16_t);
+        self->ring = m_malloc_without_collect(ring_size);
+        if (self->ring == NULL) {
+            common_hal_audiocore_playlist_deinit(self);
+            m_malloc_fail(ring_size);
+        }
+    }
+
+    audiocore_playlist_reset_buffer(self, false, 0);
+}
+
+void common_hal_audiocore_playlist_deinit(audiocore_playlist_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->queue = MP_OBJ_NULL;
+    self->source[0].sample = MP_OBJ_NULL;
+    self->source[1].sample = MP_OBJ_NULL;
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->ring = NULL;
+}
+
+// Reads the source's next buffer. Any error ends the sample.
+static void fetch(audiocore_playlist_source_t *source) {
+    uint8_t *buffer;
+    uint32_t buffer_length;
+    audioio_get_buffer_result_t result = audiosample_get_buffer(source->sample, false, 0, &buffer, &buffer_length);
+    if (result == GET_BUFFER_ERROR) {
+        source->frames = 0;
+        source->more_data = false;
+        return;
+    }
+    audiosample_base_t *sample = MP_OBJ_TO_PTR(source->sample);
+    source->data = buffer;
+    source->frames = buffer_length / (sample->bits_per_sample / 8 * sample->channel_count);
+    source->more_data = result == GET_BUFFER_MORE_DATA;
+}
+
+// Fills a slot from the queue and reads ahead its first buffer.
+static void load(audiocore_playlist_obj_t *self, size_t index) {
+    audiocore_playlist_source_t *source = &self->source[index];
+    mp_obj_list_t *queue = MP_OBJ_TO_PTR(self->queue);
+    source->frames = 0;
+    if (index >= queue->len) {
+        source->sample = MP_OBJ_NULL;
+        return;
+    }
+    source->sample = queue->items[index];
+    source->more_data = true;
+    fetch(source);
+}
+
+// Drops the playing sample and starts the next one. Returns false when the queue is empty.
+static bool advance(audiocore_playlist_obj_t *self) {
+    mp_obj_list_t *queue = MP_OBJ_TO_PTR(self->queue);
+    if (queue->len == 0) {
+        return false;
+    }
+    mp_obj_list_pop(queue, 0);
+    self->source[0] = self->source[1];
+    load(self, 1);
+    if (self->source[0].sample == MP_OBJ_NULL) {
+        return false;
+    }
+    self->fade_pending = self->crossfade_frames > 0 && self->ring_live;
+    return true;
+}
+
+// Converts the playing sample's next frame to signed 16 bit. Returns false when it has ended.
+static bool source_frame(audiocore_playlist_obj_t *self, int16_t *frame) {
+    audiocore_playlist_source_t *source = &self->source[0];
+    if (source->sample == MP_OBJ_NULL) {
+        return false;
+    }
+    while (source->frames == 0) {
+        if (!source->more_data) {
+            return false;
+        }
+        fetch(source);
+    }
+    audiosample_base_t *sample = MP_OBJ_TO_PTR(source->sample);
+    for (size_t c = 0; c < sample->channel_count; c++) {
+        int16_t value;
+        if (sample->bits_per_sample == 16) {
+            value = ((const int16_t *)source->data)[c];
+        } else {
+            value = source->data[c] << 8;
+        }
+        if (!sample->samples_signed) {
+            value ^= 0x8000;
+        }
+        frame[c] = value;
+    }
+    source->data += sample->bits_per_sample / 8 * sample->channel_count;
+    source->frames--;
+    return true;
+}
+
+// Fades the head of the newly started sample into the tail of the last one, which is in the ring.
+// The new sample is then read crossfade_frames ahead of the output like the last one was.
+static void crossfade_in(audiocore_playlist_obj_t *self) {
+    uint8_t channel_count = self->base.channel_count;
+    int32_t length = self->crossfade_frames;
+    for (int32_t i = 0; i < length; i++) {
+        int16_t frame[2];
+        if (!source_frame(self, frame)) {
+            break;
+        }
+        int16_t *slot = self->ring + ((self->ring_index + i) % length) * channel_count;
+        for (size_t c = 0; c < channel_count; c++) {
+            slot[c] = (slot[c] * (length - i) + frame[c] * i) / length;
+        }
+    }
+}
+
+// The next frame to go into the ring, or to the output without a crossfade.
+static bool input_frame(audiocore_playlist_obj_t *self, int16_t *frame) {
+    while (true) {
+        if (self->fade_pending) {
+            self->fade_pending = false;
+            crossfade_in(self);
+        }
+        if (source_frame(self, frame)) {
+            return true;
+        }
+        if (!advance(self)) {
+            return false;
+        }
+    }
+}
+
+void common_hal_audiocore_playlist_append(audiocore_playlist_obj_t *self, mp_obj_t sample) {
+    audiosample_base_t *other = audiosample_check(sample);
+    if (other->sample_rate != self->base.sample_rate) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_sample_rate);
+    }
+    if (other->channel_count != self->base.channel_count) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("The sample's %q does not match"), MP_QSTR_channel_count);
+    }
+    if (other->bits_per_sample != 8 && other->bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    // Open the sample now, from the VM, rather than when it is reached.
+    audiosample_reset_buffer(sample, false, 0);
+    mp_obj_list_append(self->queue, sample);
+    mp_obj_list_t *queue = MP_OBJ_TO_PTR(self->queue);
+    if (queue->len <= 2) {
+        load(self, queue->len - 1);
+        self->done = false;
+    }
+}
+
+void common_hal_audiocore_playlist_skip(audiocore_playlist_obj_t *self) {
+    advance(self);
+}
+
+void common_hal_audiocore_playlist_clear(audiocore_playlist_obj_t *self) {
+    mp_obj_list_t *queue = MP_OBJ_TO_PTR(self->queue);
+    mp_seq_clear(queue->items, 0, queue->alloc, sizeof(*queue->items));
+    queue->len = 0;
+    self->source[0].sample = MP_OBJ_NULL;
+    self->source[1].sample = MP_OBJ_NULL;
+    self->fade_pending = false;
+}
+
+mp_obj_t common_hal_audiocore_playlist_get_current(audiocore_playlist_obj_t *self) {
+    mp_obj_t sample = self->source[0].sample;
+    return sample == MP_OBJ_NULL ? mp_const_none : sample;
+}
+
+size_t common_hal_audiocore_playlist_get_queued(audiocore_playlist_obj_t *self) {
+    mp_obj_list_t *queue = MP_OBJ_TO_PTR(self->queue);
+    return queue->len;
+}
+
+void audiocore_playlist_reset_buffer(audiocore_playlist_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    // Start over from the beginning of the playing sample. The next one is already at its start.
+    if (self->source[0].sample != MP_OBJ_NULL) {
+        audiosample_reset_buffer(self->source[0].sample, false, 0);
+        load(self, 0);
+    }
+    if (self->ring != NULL) {
+        memset(self->ring, 0, self->crossfade_frames * self->base.channel_count * sizeof(int16_t));
+    }
+    self->ring_index = 0;
+    self->drain_frames = 0;
+    self->ring_live = false;
+    self->fade_pending = false;
+    self->done = false;
+}
+
+audioio_get_buffer_result_t audiocore_playlist_get_buffer(audiocore_playlist_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    uint8_t channel_count = self->base.channel_count;
+    if (single_channel_output && channel == 1) {
+        // The right channel reads the buffer just rendered for the left one.
+        *buffer = (uint8_t *)(self->buffer[self->buffer_index] + channel % channel_count);
+        *buffer_length = self->buffer_length;
+        return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    }
+
+    self->buffer_index = !self->buffer_index;
+    int16_t *out = self->buffer[self->buffer_index];
+    uint32_t out_frames = self->base.max_buffer_length / sizeof(int16_t) / channel_count;
+
+    uint32_t frame = 0;
+    for (; frame < out_frames && !self->done; frame++) {
+        int16_t in[2] = {0, 0};
+        if (input_frame(self, in)) {
+            self->drain_frames = self->crossfade_frames;
+            self->ring_live = true;
+        } else if (self->drain_frames > 0) {
+            self->drain_frames--;
+        } else if (!self->continuous) {
+            self->done = true;
+            break;
+        } else {
+            // Silence is all that's left in the ring.
+            self->ring_live = false;
+        }
+
+        if (self->ring == NULL) {
+            memcpy(out, in, channel_count * sizeof(int16_t));
+        } else {
+            int16_t *slot = self->ring + self->ring_index * channel_count;
+            memcpy(out, slot, channel_count * sizeof(int16_t));
+            memcpy(slot, in, channel_count * sizeof(int16_t));
+            self->ring_index = (self->ring_index + 1) % self->crossfade_frames;
+        }
+        out += channel_count;
+    }
+
+    *buffer = (uint8_t *)self->buffer[self->buffer_index];
+    self->buffer_length = frame * channel_count * sizeof(int16_t);
+    *buffer_length = self->buffer_length;
+    return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+}
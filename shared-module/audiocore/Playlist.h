@@ -0,0 +1,50 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct {
+    mp_obj_t sample; // MP_OBJ_NULL when the slot is empty.
+    const uint8_t *data; // Frames left from the sample's last buffer.
+    uint32_t frames;
+    bool more_data;
+} audiocore_playlist_source_t;
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t queue; // List of samples. The first one is playing.
+    // The first two samples in the queue. The next one has its first buffer read ahead of time
+    // so the switch to it doesn't wait on storage.
+    audiocore_playlist_source_t source[2];
+    int16_t *buffer[2];
+    uint32_t buffer_length; // Bytes rendered into the current buffer.
+    uint8_t buffer_index;
+    bool continuous;
+    bool done;
+
+    // Output is delayed through this ring of crossfade_frames frames. When a sample ends, the
+    // ring holds its tail, and the next sample's head is faded into it.
+    int16_t *ring;
+    uint32_t crossfade_frames;
+    uint32_t ring_index;
+    uint32_t drain_frames; // Frames of real audio still in the ring after the queue ran out.
+    bool ring_live; // False while the ring holds only silence, so there is nothing to fade from.
+    bool fade_pending;
+} audiocore_playlist_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiocore_playlist_reset_buffer(audiocore_playlist_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiocore_playlist_get_buffer(audiocore_playlist_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
@@ -0,0 +1,245 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/Resampler.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/Resampler.h"
+
+// Fills in a Blackman windowed sinc for each fractional position. cutoff is relative to the
+// source Nyquist frequency and is below 1 when downsampling to keep out aliases.
+static void compute_coefficients(int16_t *coefficients, uint8_t taps, mp_float_t cutoff) {
+    const mp_float_t pi = MICROPY_FLOAT_CONST(3.14159265358979323846);
+    for (size_t phase = 0; phase < RESAMPLER_PHASES; phase++) {
+        mp_float_t fraction = (mp_float_t)phase / RESAMPLER_PHASES;
+        mp_float_t h[RESAMPLER_MAX_TAPS];
+        mp_float_t sum = 0;
+        for (size_t k = 0; k < taps; k++) {
+            // Distance from the output position to this tap, in source frames.
+            mp_float_t x = (mp_float_t)k - (taps / 2 - 1) - fraction;
+            mp_float_t sinc = MICROPY_FLOAT_CONST(1.0);
+            if (x != 0) {
+                sinc = MICROPY_FLOAT_C_FUN(sin)(pi * x * cutoff) / (pi * x * cutoff);
+            }
+            mp_float_t w = (x + taps / 2) / taps;
+            mp_float_t window = MICROPY_FLOAT_CONST(0.42) -
+                MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(2 * pi * w) +
+                MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(4 * pi * w);
+            h[k] = sinc * window;
+            sum += h[k];
+        }
+        // Normalize so every phase has unity gain at DC.
+        for (size_t k = 0; k < taps; k++) {
+            coefficients[phase * taps + k] = (int16_t)MICROPY_FLOAT_C_FUN(round)(h[k] / sum * (1 << 14));
+        }
+    }
+}
+
+void common_hal_audiocore_resampler_construct(audiocore_resampler_obj_t *self, mp_obj_t sample,
+    uint32_t sample_rate, uint8_t channel_count, uint8_t filter_taps, uint32_t buffer_size) {
+    audiosample_base_t *source = audiosample_check(sample);
+    self->sample = sample;
+    self->source_bytes_per_frame = source->bits_per_sample / 8 * source->channel_count;
+
+    self->base.bits_per_sample = 16;
+    self->base.samples_signed = true;
+    self->base.channel_count = channel_count;
+    self->base.sample_rate = sample_rate;
+    self->base.single_buffer = false;
+    self->base.max_buffer_length = buffer_size;
+
+    for (size_t i = 0; i < 2; i++) {
+        self->buffer[i] = m_malloc_without_collect(buffer_size);
+        if (self->buffer[i] == NULL) {
+            common_hal_audiocore_resampler_deinit(self);
+            m_malloc_fail(buffer_size);
+        }
+    }
+
+    self->taps = filter_taps == 0 ? 2 : filter_taps;
+    size_t history_size = self->taps * channel_count * sizeof(int16_t);
+    self->history = m_malloc_without_collect(history_size);
+    if (self->history == NULL) {
+        common_hal_audiocore_resampler_deinit(self);
+        m_malloc_fail(history_size);
+    }
+
+    self->coefficients = NULL;
+    if (filter_taps > 0) {
+        size_t coefficients_size = RESAMPLER_PHASES * self->taps * sizeof(int16_t);
+        self->coefficients = m_malloc_without_collect(coefficients_size);
+        if (self->coefficients == NULL) {
+            common_hal_audiocore_resampler_deinit(self);
+            m_malloc_fail(coefficients_size);
+        }
+        mp_float_t cutoff = MICROPY_FLOAT_CONST(1.0);
+        if (sample_rate < source->sample_rate) {
+            cutoff = (mp_float_t)sample_rate / source->sample_rate;
+        }
+        compute_coefficients(self->coefficients, self->taps, cutoff);
+    }
+
+    audiocore_resampler_reset_buffer(self, false, 0);
+}
+
+void common_hal_audiocore_resampler_deinit(audiocore_resampler_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->sample = MP_OBJ_NULL;
+    self->buffer[0] = NULL;
+    self->buffer[1] = NULL;
+    self->history = NULL;
+    self->coefficients = NULL;
+}
+
+mp_obj_t common_hal_audiocore_resampler_get_sample(audiocore_resampler_obj_t *self) {
+    return self->sample;
+}
+
+void audiocore_resampler_reset_buffer(audiocore_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->source_frames = 0;
+    self->source_more_data = true;
+    self->source_done = false;
+    self->tail_frames = 0;
+    self->done = false;
+    memset(self->history, 0, self->taps * self->base.channel_count * sizeof(int16_t));
+    // Shift in enough frames before the first output to put the first source frame at taps / 2 - 1.
+    self->position = (self->taps / 2 + 1) << 16;
+}
+
+// Shifts the next source frame into the history, converted to signed 16 bit and to the output
+// channel count. Once the source runs out, silence is shifted in until the last source frame has
+// passed the middle of the filter. Returns false after that.
+static bool shift_in_frame(audiocore_resampler_obj_t *self) {
+    audiosample_base_t *source = MP_OBJ_TO_PTR(self->sample);
+    while (self->source_frames == 0 && !self->source_done) {
+        if (!self->source_more_data) {
+            self->source_done = true;
+            break;
+        }
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &buffer, &buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            self->source_done = true;
+            break;
+        }
+        self->source = buffer;
+        self->source_frames = buffer_length / self->source_bytes_per_frame;
+        self->source_more_data = result == GET_BUFFER_MORE_DATA;
+    }
+
+    int16_t frame[2] = {0, 0};
+    if (self->source_done) {
+        if (self->tail_frames == self->taps / 2) {
+            return false;
+        }
+        self->tail_frames++;
+    } else {
+        for (size_t c = 0; c < source->channel_count; c++) {
+            int16_t value;
+            if (source->bits_per_sample == 16) {
+                value = ((const int16_t *)self->source)[c];
+            } else {
+                value = self->source[c] << 8;
+            }
+            if (!source->samples_signed) {
+                value ^= 0x8000;
+            }
+            frame[c] = value;
+        }
+        if (source->channel_count == 1) {
+            frame[1] = frame[0];
+        } else if (self->base.channel_count == 1) {
+            frame[0] = (frame[0] + frame[1]) / 2;
+        }
+        self->source += self->source_bytes_per_frame;
+        self->source_frames--;
+    }
+
+    uint8_t channel_count = self->base.channel_count;
+    memmove(self->history, self->history + channel_count, (self->taps - 1) * channel_count * sizeof(int16_t));
+    memcpy(self->history + (self->taps - 1) * channel_count, frame, channel_count * sizeof(int16_t));
+    return true;
+}
+
+audioio_get_buffer_result_t audiocore_resampler_get_buffer(audiocore_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    uint8_t channel_count = self->base.channel_count;
+    if (single_channel_output && channel == 1) {
+        // The right channel reads the buffer just rendered for the left one.
+        *buffer = (uint8_t *)(self->buffer[self->buffer_index] + channel % channel_count);
+        *buffer_length = self->buffer_length;
+        return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    }
+
+    self->buffer_index = !self->buffer_index;
+    int16_t *out = self->buffer[self->buffer_index];
+    uint32_t out_frames = self->base.max_buffer_length / sizeof(int16_t) / channel_count;
+
+    // Recomputed for every buffer because either sample_rate may be changed while playing.
+    uint32_t source_rate = audiosample_get_sample_rate(MP_OBJ_TO_PTR(self->sample));
+    uint32_t step = ((uint64_t)source_rate << 16) / self->base.sample_rate;
+
+    uint32_t frame = 0;
+    for (; frame < out_frames && !self->done; frame++) {
+        while (self->position >= (1 << 16)) {
+            if (!shift_in_frame(self)) {
+                self->done = true;
+                break;
+            }
+            self->position -= 1 << 16;
+        }
+        if (self->done) {
+            break;
+        }
+
+        uint32_t fraction = self->position & 0xffff;
+        if (self->coefficients == NULL) {
+            const int16_t *a = self->history;
+            const int16_t *b = self->history + channel_count;
+            for (size_t c = 0; c < channel_count; c++) {
+                out[c] = a[c] + (((b[c] - a[c]) * (int32_t)(fraction >> 1)) >> 15);
+            }
+        } else {
+            const int16_t *h = self->coefficients + (fraction >> (16 - RESAMPLER_PHASE_BITS)) * self->taps;
+            for (size_t c = 0; c < channel_count; c++) {
+                int32_t acc = 0;
+                for (size_t k = 0; k < self->taps; k++) {
+                    acc += h[k] * self->history[k * channel_count + c];
+                }
+                acc >>= 14;
+                if (acc > SHRT_MAX) {
+                    acc = SHRT_MAX;
+                } else if (acc < SHRT_MIN) {
+                    acc = SHRT_MIN;
+                }
+                out[c] = acc;
+            }
+        }
+        out += channel_count;
+        self->position += step;
+    }
+
+    *buffer = (uint8_t *)self->buffer[self->buffer_index];
+    self->buffer_length = frame * channel_count * sizeof(int16_t);
+    *buffer_length = self->buffer_length;
+    return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+}
@@ -0,0 +1,50 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Number of fractional positions the windowed-sinc filter is precomputed for.
+#define RESAMPLER_PHASE_BITS (5)
+#define RESAMPLER_PHASES (1 << RESAMPLER_PHASE_BITS)
+#define RESAMPLER_MAX_TAPS (16)
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+    int16_t *buffer[2];
+    uint32_t buffer_length; // Bytes rendered into the current buffer.
+    uint8_t buffer_index;
+
+    // The source buffer currently being consumed.
+    const uint8_t *source;
+    uint32_t source_frames;
+    bool source_more_data;
+    bool source_done;
+    uint8_t tail_frames; // Frames of silence shifted in after the source ended.
+    uint8_t source_bytes_per_frame;
+
+    // Position of the next output frame between history[taps / 2 - 1] and history[taps / 2]
+    // in 16.16 fixed point. Whole frames are shifted into the history before it is used.
+    uint32_t position;
+    uint8_t taps; // 2 for linear interpolation.
+    bool done; // The last source frame has been played.
+    int16_t *history; // taps * channel_count converted source samples.
+    int16_t *coefficients; // RESAMPLER_PHASES * taps in Q14 or NULL for linear interpolation.
+} audiocore_resampler_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiocore_resampler_reset_buffer(audiocore_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiocore_resampler_get_buffer(audiocore_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
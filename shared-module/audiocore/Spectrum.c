@@ -0,0 +1,212 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/audiocore/Spectrum.h"
+#include "shared-bindings/audiocore/__init__.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/Spectrum.h"
+
+static void *spectrum_alloc(audiocore_spectrum_obj_t *self, size_t size) {
+    void *result = m_malloc_without_collect(size);
+    if (result == NULL) {
+        common_hal_audiocore_spectrum_deinit(self);
+        m_malloc_fail(size);
+    }
+    return result;
+}
+
+static int16_t q15(mp_float_t value) {
+    int32_t result = (int32_t)MICROPY_FLOAT_C_FUN(round)(value * 32768);
+    return result > INT16_MAX ? INT16_MAX : result;
+}
+
+void common_hal_audiocore_spectrum_construct(audiocore_spectrum_obj_t *self, mp_obj_t sample,
+    uint16_t fft_size) {
+    audiosample_base_t *source = audiosample_check(sample);
+    self->sample = sample;
+    // Every buffer is passed through untouched, so this looks exactly like the wrapped sample.
+    self->base.bits_per_sample = source->bits_per_sample;
+    self->base.samples_signed = source->samples_signed;
+    self->base.channel_count = source->channel_count;
+    self->base.sample_rate = source->sample_rate;
+    self->base.single_buffer = source->single_buffer;
+    self->base.max_buffer_length = source->max_buffer_length;
+
+    self->fft_size = fft_size;
+    self->fft_bits = 0;
+    while ((1 << self->fft_bits) < fft_size) {
+        self->fft_bits++;
+    }
+
+    self->window = NULL;
+    self->twiddle = NULL;
+    self->real = NULL;
+    self->imag = NULL;
+    self->magnitudes = NULL;
+    self->window = spectrum_alloc(self, fft_size * sizeof(int16_t));
+    self->twiddle = spectrum_alloc(self, fft_size * sizeof(int16_t));
+    self->real = spectrum_alloc(self, fft_size * sizeof(int16_t));
+    self->imag = spectrum_alloc(self, fft_size * sizeof(int16_t));
+    self->magnitudes = spectrum_alloc(self, fft_size / 2 * sizeof(uint16_t));
+    memset(self->magnitudes, 0, fft_size / 2 * sizeof(uint16_t));
+
+    const mp_float_t pi = MICROPY_FLOAT_CONST(3.14159265358979323846);
+    for (size_t i = 0; i < fft_size; i++) {
+        mp_float_t x = 2 * pi * i / fft_size;
+        self->window[i] = q15(MICROPY_FLOAT_CONST(0.5) - MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(x));
+    }
+    for (size_t k = 0; k < fft_size / 2; k++) {
+        mp_float_t x = 2 * pi * k / fft_size;
+        self->twiddle[2 * k] = q15(MICROPY_FLOAT_C_FUN(cos)(x));
+        self->twiddle[2 * k + 1] = q15(-MICROPY_FLOAT_C_FUN(sin)(x));
+    }
+
+    audiocore_spectrum_reset_buffer(self, false, 0);
+}
+
+void common_hal_audiocore_spectrum_deinit(audiocore_spectrum_obj_t *self) {
+    audiosample_mark_deinit(&self->base);
+    self->sample = MP_OBJ_NULL;
+    self->window = NULL;
+    self->twiddle = NULL;
+    self->real = NULL;
+    self->imag = NULL;
+    self->magnitudes = NULL;
+}
+
+mp_obj_t common_hal_audiocore_spectrum_get_sample(audiocore_spectrum_obj_t *self) {
+    return self->sample;
+}
+
+uint16_t common_hal_audiocore_spectrum_get_fft_size(audiocore_spectrum_obj_t *self) {
+    return self->fft_size;
+}
+
+uint32_t common_hal_audiocore_spectrum_get_updates(audiocore_spectrum_obj_t *self) {
+    return self->updates;
+}
+
+int common_hal_audiocore_spectrum_get_buffer(audiocore_spectrum_obj_t *self, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
+    if (flags & MP_BUFFER_WRITE) {
+        return 1;
+    }
+    bufinfo->buf = self->magnitudes;
+    bufinfo->len = self->fft_size / 2 * sizeof(uint16_t);
+    bufinfo->typecode = 'H';
+    return 0;
+}
+
+static uint16_t isqrt(uint32_t value) {
+    uint32_t result = 0;
+    for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+    }
+    return result;
+}
+
+// Transforms the collected block in place with a radix-2 FFT and stores the bin magnitudes. Each
+// stage halves its outputs so nothing overflows, which scales the result by 1 / fft_size.
+static void analyze(audiocore_spectrum_obj_t *self) {
+    int16_t *re = self->real;
+    int16_t *im = self->imag;
+    size_t n = self->fft_size;
+    for (size_t half = 1, stride = n / 2; half < n; half *= 2, stride /= 2) {
+        for (size_t start = 0; start < n; start += 2 * half) {
+            for (size_t k = 0; k < half; k++) {
+                int32_t wr = self->twiddle[2 * k * stride];
+                int32_t wi = self->twiddle[2 * k * stride + 1];
+                size_t a = start + k;
+                size_t b = a + half;
+                int32_t tr = (re[b] * wr - im[b] * wi) >> 15;
+                int32_t ti = (re[b] * wi + im[b] * wr) >> 15;
+                re[b] = (re[a] - tr) >> 1;
+                im[b] = (im[a] - ti) >> 1;
+                re[a] = (re[a] + tr) >> 1;
+                im[a] = (im[a] + ti) >> 1;
+            }
+        }
+    }
+    for (size_t k = 0; k < n / 2; k++) {
+        self->magnitudes[k] = isqrt(re[k] * re[k] + im[k] * im[k]);
+    }
+    self->updates++;
+}
+
+// Windows one mono frame into the block, in bit-reversed order so the FFT can run in place.
+static void collect(audiocore_spectrum_obj_t *self, int16_t value) {
+    size_t index = 0;
+    for (size_t bit = 0; bit < self->fft_bits; bit++) {
+        index |= ((self->fill >> bit) & 1) << (self->fft_bits - 1 - bit);
+    }
+    self->real[index] = (value * self->window[self->fill]) >> 15;
+    self->imag[index] = 0;
+    if (++self->fill == self->fft_size) {
+        self->fill = 0;
+        analyze(self);
+    }
+}
+
+void audiocore_spectrum_reset_buffer(audiocore_spectrum_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    audiosample_reset_buffer(self->sample, single_channel_output, channel);
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    self->fill = 0;
+    self->updates = 0;
+    memset(self->magnitudes, 0, self->fft_size / 2 * sizeof(uint16_t));
+}
+
+audioio_get_buffer_result_t audiocore_spectrum_get_buffer(audiocore_spectrum_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, single_channel_output, channel, buffer, buffer_length);
+    audiosample_base_t *source = MP_OBJ_TO_PTR(self->sample);
+    // Follow the wrapped sample if its rate is changed while playing.
+    self->base.sample_rate = source->sample_rate;
+    if (result == GET_BUFFER_ERROR || (single_channel_output && channel == 1)) {
+        return result;
+    }
+
+    // Stereo is averaged to mono unless only the left channel was asked for.
+    uint8_t channel_count = source->channel_count;
+    uint8_t mixed_channels = single_channel_output ? 1 : channel_count;
+    uint32_t frames = *buffer_length / (source->bits_per_sample / 8) / channel_count;
+    uint16_t flip = source->samples_signed ? 0 : 0x8000;
+    if (source->bits_per_sample == 16) {
+        const int16_t *data = (const int16_t *)*buffer;
+        for (uint32_t i = 0; i < frames; i++, data += channel_count) {
+            int32_t sum = 0;
+            for (size_t c = 0; c < mixed_channels; c++) {
+                sum += (int16_t)(data[c] ^ flip);
+            }
+            collect(self, sum / mixed_channels);
+        }
+    } else {
+        const uint8_t *data = *buffer;
+        for (uint32_t i = 0; i < frames; i++, data += channel_count) {
+            int32_t sum = 0;
+            for (size_t c = 0; c < mixed_channels; c++) {
+                sum += (int16_t)((data[c] << 8) ^ flip);
+            }
+            collect(self, sum / mixed_channels);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,38 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+#define SPECTRUM_MIN_FFT_SIZE (16)
+#define SPECTRUM_MAX_FFT_SIZE (1024)
+
+typedef struct {
+    audiosample_base_t base;
+    mp_obj_t sample;
+    uint16_t fft_size;
+    uint8_t fft_bits;
+    uint16_t fill; // Frames collected toward the next block.
+    uint32_t updates; // Blocks analyzed since the last reset.
+    int16_t *window; // fft_size Hann coefficients in Q15.
+    int16_t *twiddle; // fft_size / 2 pairs of cos and -sin in Q15.
+    int16_t *real; // The block being collected, then transformed in place.
+    int16_t *imag;
+    uint16_t *magnitudes; // fft_size / 2 bins from the last complete block.
+} audiocore_spectrum_obj_t;
+
+// These are not available from Python because it may be called in an interrupt.
+void audiocore_spectrum_reset_buffer(audiocore_spectrum_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiocore_spectrum_get_buffer(audiocore_spectrum_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
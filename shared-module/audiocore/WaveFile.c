@@ -15,6 +15,10 @@
 #include "shared-module/audiocore/WaveFile.h"
 #include "shared-bindings/audiocore/__init__.h"
 
+#if defined(MICROPY_UNIX_COVERAGE)
+#define background_callback_add(buf, fn, arg) ((fn)((arg)))
+#endif
+
 struct wave_format_chunk {
     uint16_t audio_format;
     uint16_t num_channels;
@@ -32,7 +36,8 @@ struct wave_format_chunk {
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     pyb_file_obj_t *file,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    uint8_t buffer_count) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -111,31 +116,29 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = chunk_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // One buffer is loaded from file while another is DMAed to DAC. Any others are read ahead.
+    self->buffer_count = buffer_count;
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        self->len = buffer_size / buffer_count / sizeof(uint32_t) * sizeof(uint32_t);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
         self->len = 256;
-        self->buffer = m_malloc_without_collect(self->len);
+        self->buffer = m_malloc_without_collect(self->len * buffer_count);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc_without_collect(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->len * buffer_count);
         }
     }
+    if (self->len > self->base.max_buffer_length) {
+        self->base.max_buffer_length = self->len;
+    }
+    self->load_slot = 0;
+    self->read_slot = 0;
+    self->buffers_ahead = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
     audiosample_mark_deinit(&self->base);
 }
 
@@ -145,15 +148,79 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    // We don't reset the slots in case we're looping and the consumer is still using the last
+    // ones. Buffers that were read ahead are dropped and their slots reused.
     self->bytes_remaining = self->file_length;
+    self->bytes_unread = self->file_length;
+    self->load_slot = (self->load_slot + self->buffer_count - self->buffers_ahead) % self->buffer_count;
+    self->buffers_ahead = 0;
     f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
 }
 
+// Reads the next chunk of the file into load_slot.
+static bool load_next_buffer(audioio_wavefile_obj_t *self) {
+    uint32_t num_bytes_to_load = self->len;
+    // Keep reads on sector boundaries once the buffers are big enough. FatFs then reads whole
+    // sectors straight into our buffer, with one multi-sector read per contiguous run, instead of
+    // copying through its sector cache.
+    #if FF_MAX_SS == FF_MIN_SS
+    uint32_t sector_size = FF_MIN_SS;
+    #else
+    uint32_t sector_size = self->file->fp.obj.fs->ssize;
+    #endif
+    uint32_t misalignment = f_tell(&self->file->fp) % sector_size;
+    if (self->len >= sector_size && misalignment % sizeof(uint32_t) == 0) {
+        num_bytes_to_load = self->len / sector_size * sector_size - misalignment;
+    }
+    if (num_bytes_to_load > self->bytes_unread) {
+        num_bytes_to_load = self->bytes_unread;
+    }
+
+    uint8_t *buffer = self->buffer + self->load_slot * self->len;
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_unread -= length_read;
+    // Pad the last buffer to word align it.
+    if (self->bytes_unread == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->base.bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->base.bits_per_sample == 16) {
+            // We know the buffer is aligned because slots are a multiple of words long.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t *)buffer)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    self->buffer_length[self->load_slot] = length_read;
+    self->load_slot = (self->load_slot + 1) % self->buffer_count;
+    self->buffers_ahead++;
+    return true;
+}
+
+// Reads ahead into every slot the consumer isn't using. Runs as a background callback so that a
+// slow read delays the next buffer instead of the one being handed out now.
+static void wavefile_fill_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (audiosample_deinited(&self->base)) {
+        return;
+    }
+    while (self->buffers_ahead < self->buffer_count - 2 && self->bytes_unread > 0) {
+        if (!load_next_buffer(self)) {
+            return;
+        }
+    }
+}
+
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel,
@@ -177,54 +244,23 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
     }
 
     if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        if (self->buffers_ahead == 0 && !load_next_buffer(self)) {
             return GET_BUFFER_ERROR;
         }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->base.bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->base.bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
-            }
-        }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
+        self->read_slot = (self->load_slot + self->buffer_count - self->buffers_ahead) % self->buffer_count;
+        self->buffers_ahead--;
+        // Only the last buffer is padded so this reaches zero exactly when it is handed out.
+        self->bytes_remaining -= MIN(self->buffer_length[self->read_slot], self->bytes_remaining);
         self->read_count += 1;
+        if (self->buffer_count > 2 && self->bytes_unread > 0) {
+            background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
+        }
     }
 
     uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t slot = (self->read_slot + self->buffer_count - buffers_back) % self->buffer_count;
+    *buffer = self->buffer + slot * self->len;
+    *buffer_length = self->buffer_length[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
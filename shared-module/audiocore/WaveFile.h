@@ -10,20 +10,27 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#include "supervisor/background_callback.h"
+
+// Two buffers are always in use by the consumer. Any more are read ahead of time.
+#define WAVEFILE_MAX_BUFFERS (8)
 
 typedef struct {
     audiosample_base_t base;
-    uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint8_t *buffer; // buffer_count slots of len bytes each.
+    uint32_t buffer_length[WAVEFILE_MAX_BUFFERS]; // Bytes loaded into each slot.
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint8_t buffer_count;
+    uint8_t load_slot; // Slot the next read from the file goes into.
+    uint8_t read_slot; // Slot most recently handed out.
+    uint8_t buffers_ahead; // Slots read ahead that haven't been handed out yet.
+    uint32_t bytes_remaining; // Bytes not yet handed out.
+    uint32_t bytes_unread; // Bytes not yet read from the file.
 
     uint32_t len;
     pyb_file_obj_t *file;
+    background_callback_t fill_cb;
 
     uint32_t read_count;
     uint32_t left_read_count;
@@ -6,6 +6,7 @@
 
 #include "shared-module/audioio/__init__.h"
 
+#include "py/mphal.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 #include "shared-bindings/audiocore/RawSample.h"
@@ -16,6 +17,10 @@
 #include "shared-bindings/audiomixer/Mixer.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+#if CIRCUITPY_AUDIOCORE_STATS && !defined(UNIX)
+#include "supervisor/port.h"
+#endif
+
 void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel_output, uint8_t audio_channel) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
     proto->reset_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, audio_channel);
@@ -26,8 +31,42 @@ audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
+    #if CIRCUITPY_AUDIOCORE_STATS
+    uint32_t start = audiocore_stats_now_us();
+    audioio_get_buffer_result_t result = proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
+    uint32_t elapsed = audiocore_stats_now_us() - start;
+    audiosample_stats_t *stats = &((audiosample_base_t *)MP_OBJ_TO_PTR(sample_obj))->stats;
+    stats->calls++;
+    stats->total_us += elapsed;
+    stats->max_us = MAX(stats->max_us, elapsed);
+    stats->max_length = MAX(stats->max_length, *buffer_length);
+    return result;
+    #else
     return proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
+    #endif
+}
+
+#if CIRCUITPY_AUDIOCORE_STATS
+audiocore_stats_t audiocore_stats;
+
+// Ports with a cheaper microsecond timer may replace this.
+MP_WEAK uint32_t audiocore_stats_now_us(void) {
+    #if defined(UNIX)
+    return mp_hal_ticks_us();
+    #else
+    // 1024 ticks per second and 32 subticks per tick.
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks) * 32 + subticks;
+    return ticks * 1000000 / 32768;
+    #endif
+}
+
+void audiocore_stats_record_callback(uint32_t interrupt_us) {
+    uint32_t latency = audiocore_stats_now_us() - interrupt_us;
+    audiocore_stats.callbacks++;
+    audiocore_stats.max_latency_us = MAX(audiocore_stats.max_latency_us, latency);
 }
+#endif
 
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
@@ -18,6 +18,26 @@ typedef enum {
     GET_BUFFER_ERROR,           // Error while reading data.
 } audioio_get_buffer_result_t;
 
+#if CIRCUITPY_AUDIOCORE_STATS
+// Time spent in one sample's get_buffer. Nested samples, such as a Mixer's voices, are included in
+// the time of the sample that plays them.
+typedef struct {
+    uint32_t calls;
+    uint32_t total_us;
+    uint32_t max_us;
+    uint32_t max_length; // Longest buffer returned, in bytes.
+} audiosample_stats_t;
+
+// Shared by every audio output.
+typedef struct {
+    uint32_t callbacks;
+    uint32_t max_latency_us; // From the DMA interrupt to the background task that refills it.
+    uint32_t underruns;
+} audiocore_stats_t;
+
+extern audiocore_stats_t audiocore_stats;
+#endif
+
 typedef struct audiosample_base {
     mp_obj_base_t self;
     uint32_t sample_rate;
@@ -26,6 +46,9 @@ typedef struct audiosample_base {
     uint8_t channel_count;
     uint8_t samples_signed;
     bool single_buffer;
+    #if CIRCUITPY_AUDIOCORE_STATS
+    audiosample_stats_t stats;
+    #endif
 } audiosample_base_t;
 
 typedef void (*audiosample_reset_buffer_fun)(mp_obj_t,
@@ -91,6 +114,25 @@ static inline void audiosample_get_buffer_structure_checked(mp_obj_t self_in, bo
 
 void audiosample_must_match(audiosample_base_t *self, mp_obj_t other);
 
+// Audio outputs report their timing through these. They compile to nothing without
+// CIRCUITPY_AUDIOCORE_STATS so they can be called unconditionally.
+#if CIRCUITPY_AUDIOCORE_STATS
+// Microseconds from a free running counter. May be called from an interrupt.
+uint32_t audiocore_stats_now_us(void);
+void audiocore_stats_record_callback(uint32_t interrupt_us);
+static inline void audiocore_stats_record_underrun(void) {
+    audiocore_stats.underruns++;
+}
+#else
+static inline uint32_t audiocore_stats_now_us(void) {
+    return 0;
+}
+static inline void audiocore_stats_record_callback(uint32_t interrupt_us) {
+}
+static inline void audiocore_stats_record_underrun(void) {
+}
+#endif
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_u8s_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
 void audiosample_convert_s8m_s16s(int16_t *buffer_out, const int8_t *buffer_in, size_t nframes);
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 #include "shared-bindings/audiodelays/Chorus.h"
+#include "shared-module/audiodelays/__init__.h"
 
 #include <stdint.h>
 #include <math.h>
@@ -78,12 +79,11 @@ void common_hal_audiodelays_chorus_construct(audiodelays_chorus_obj_t *self, uin
     // Allocate the chorus buffer for the max possible delay, chorus is always 16-bit
     self->max_delay_ms = max_delay_ms;
     self->max_chorus_buffer_len = (uint32_t)(self->base.sample_rate / MICROPY_FLOAT_CONST(1000.0) * max_delay_ms * (self->base.channel_count * sizeof(uint16_t))); // bytes
-    self->chorus_buffer = m_malloc_without_collect(self->max_chorus_buffer_len);
+    self->chorus_buffer = audiodelays_delay_line_alloc(self->max_chorus_buffer_len);
     if (self->chorus_buffer == NULL) {
         common_hal_audiodelays_chorus_deinit(self);
         m_malloc_fail(self->max_chorus_buffer_len);
     }
-    memset(self->chorus_buffer, 0, self->max_chorus_buffer_len);
 
     // calculate the length of a single sample in milliseconds
     self->sample_ms = MICROPY_FLOAT_CONST(1000.0) / self->base.sample_rate;
@@ -107,6 +107,7 @@ void common_hal_audiodelays_chorus_deinit(audiodelays_chorus_obj_t *self) {
     if (common_hal_audiodelays_chorus_deinited(self)) {
         return;
     }
+    audiodelays_delay_line_free(self->chorus_buffer);
     self->chorus_buffer = NULL;
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
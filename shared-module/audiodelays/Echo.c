@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 #include "shared-bindings/audiodelays/Echo.h"
+#include "shared-module/audiodelays/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 
 #include <stdint.h>
@@ -82,12 +83,11 @@ void common_hal_audiodelays_echo_construct(audiodelays_echo_obj_t *self, uint32_
     // Allocate the echo buffer for the max possible delay, echo is always 16-bit
     self->max_delay_ms = max_delay_ms;
     self->max_echo_buffer_len = (uint32_t)(self->base.sample_rate / MICROPY_FLOAT_CONST(1000.0) * max_delay_ms) * (self->base.channel_count * sizeof(uint16_t)); // bytes
-    self->echo_buffer = m_malloc_without_collect(self->max_echo_buffer_len);
+    self->echo_buffer = audiodelays_delay_line_alloc(self->max_echo_buffer_len);
     if (self->echo_buffer == NULL) {
         common_hal_audiodelays_echo_deinit(self);
         m_malloc_fail(self->max_echo_buffer_len);
     }
-    memset(self->echo_buffer, 0, self->max_echo_buffer_len);
 
     // calculate the length of a single sample in milliseconds
     self->sample_ms = MICROPY_FLOAT_CONST(1000.0) / self->base.sample_rate;
@@ -106,6 +106,7 @@ void common_hal_audiodelays_echo_construct(audiodelays_echo_obj_t *self, uint32_
 
 void common_hal_audiodelays_echo_deinit(audiodelays_echo_obj_t *self) {
     audiosample_mark_deinit(&self->base);
+    audiodelays_delay_line_free(self->echo_buffer);
     self->echo_buffer = NULL;
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
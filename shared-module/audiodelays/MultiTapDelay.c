@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 #include "shared-bindings/audiodelays/MultiTapDelay.h"
+#include "shared-module/audiodelays/__init__.h"
 #include "shared-bindings/audiocore/__init__.h"
 
 #include <stdint.h>
@@ -70,12 +71,11 @@ void common_hal_audiodelays_multi_tap_delay_construct(audiodelays_multi_tap_dela
     // Allocate the delay buffer for the max possible delay, delay is always 16-bit
     self->max_delay_ms = max_delay_ms;
     self->max_delay_buffer_len = (uint32_t)(self->base.sample_rate / MICROPY_FLOAT_CONST(1000.0) * max_delay_ms) * (self->base.channel_count * sizeof(uint16_t)); // bytes
-    self->delay_buffer = m_malloc_maybe(self->max_delay_buffer_len);
+    self->delay_buffer = audiodelays_delay_line_alloc(self->max_delay_buffer_len);
     if (self->delay_buffer == NULL) {
         common_hal_audiodelays_multi_tap_delay_deinit(self);
         m_malloc_fail(self->max_delay_buffer_len);
     }
-    memset(self->delay_buffer, 0, self->max_delay_buffer_len);
 
     // calculate the length of a single sample in milliseconds
     self->sample_ms = MICROPY_FLOAT_CONST(1000.0) / self->base.sample_rate;
@@ -95,6 +95,7 @@ void common_hal_audiodelays_multi_tap_delay_construct(audiodelays_multi_tap_dela
 
 void common_hal_audiodelays_multi_tap_delay_deinit(audiodelays_multi_tap_delay_obj_t *self) {
     audiosample_mark_deinit(&self->base);
+    audiodelays_delay_line_free(self->delay_buffer);
     self->delay_buffer = NULL;
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
@@ -3,3 +3,32 @@
 // SPDX-FileCopyrightText: Copyright (c) 2024 Mark Komus
 //
 // SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "shared-module/audiodelays/__init__.h"
+
+#if defined(UNIX)
+#include <stdlib.h>
+#define port_free free
+#define port_malloc(sz, hint) (malloc(sz))
+#else
+#include "supervisor/port_heap.h"
+#endif
+
+void *audiodelays_delay_line_alloc(size_t length) {
+    // The delay line is only ever read and written sequentially by the CPU so it doesn't need to
+    // be DMA capable, which lets the port place it in PSRAM. The PSRAM cache keeps the read and
+    // write heads in SRAM.
+    void *delay_line = port_malloc(length, false);
+    if (delay_line != NULL) {
+        memset(delay_line, 0, length);
+    }
+    return delay_line;
+}
+
+void audiodelays_delay_line_free(void *delay_line) {
+    if (delay_line != NULL) {
+        port_free(delay_line);
+    }
+}
@@ -5,3 +5,11 @@
 // SPDX-License-Identifier: MIT
 
 #pragma once
+
+#include <stddef.h>
+
+// Delay lines are allocated outside the VM heap, in PSRAM when the port has it, so that long
+// delays neither fragment the VM heap nor need one large contiguous block of it. The memory is
+// zeroed. Returns NULL when there isn't enough room.
+void *audiodelays_delay_line_alloc(size_t length);
+void audiodelays_delay_line_free(void *delay_line);
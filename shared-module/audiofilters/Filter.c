@@ -104,11 +104,12 @@ void common_hal_audiofilters_filter_set_filter(audiofilters_filter_obj_t *self,
 
     self->filter = filter_in;
     self->filter_objs = filter_objs;
+    self->filter_objs_len = n_items;
     self->filter_states = m_renew(biquad_filter_state,
         self->filter_states,
         self->filter_states_len,
-        n_items);
-    self->filter_states_len = n_items;
+        n_items * self->base.channel_count);
+    self->filter_states_len = n_items * self->base.channel_count;
 }
 
 mp_obj_t common_hal_audiofilters_filter_get_filter(audiofilters_filter_obj_t *self) {
@@ -207,7 +208,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
             (void)synthio_block_slot_get(&self->mix);
 
             // Tick biquad filters
-            for (uint8_t j = 0; j < self->filter_states_len; j++) {
+            for (uint8_t j = 0; j < self->filter_objs_len; j++) {
                 common_hal_synthio_biquad_tick(self->filter_objs[j]);
             }
             if (self->base.samples_signed) {
@@ -264,12 +265,12 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                         }
                     }
 
-                    // Process biquad filters
-                    for (uint8_t j = 0; j < self->filter_states_len; j++) {
-                        mp_obj_t filter_obj = self->filter_objs[j];
-                        common_hal_synthio_biquad_tick(filter_obj);
-                        synthio_biquad_filter_samples(filter_obj, &self->filter_states[j], self->filter_buffer, n_samples);
+                    // Process biquad filters in one pass, keeping each channel's filter state separate
+                    for (uint8_t j = 0; j < self->filter_objs_len; j++) {
+                        common_hal_synthio_biquad_tick(self->filter_objs[j]);
                     }
+                    synthio_biquad_filter_cascade(self->filter_objs, self->filter_states, self->filter_objs_len,
+                        self->filter_buffer, n_samples, self->base.channel_count);
 
                     // Mix processed signal with original sample and transfer to output buffer
                     for (uint32_t j = 0; j < n_samples; j++) {
@@ -16,7 +16,7 @@
 
 void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *self, mp_obj_t roomsize, mp_obj_t damp, mp_obj_t mix,
     uint32_t buffer_size, uint8_t bits_per_sample,
-    bool samples_signed, uint8_t channel_count, uint32_t sample_rate) {
+    bool samples_signed, uint8_t channel_count, uint32_t sample_rate, bool compact) {
 
     // Basic settings every effect and audio sample has
     // These are the effects values, not the source sample(s)
@@ -78,21 +78,18 @@ void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *s
 
     // Set up the comb filters
     // These values come from FreeVerb and are selected for the best reverb sound
-    self->combbuffersizes[0] = self->combbuffersizes[8] = 1116;
-    self->combbuffersizes[1] = self->combbuffersizes[9] = 1188;
-    self->combbuffersizes[2] = self->combbuffersizes[10] = 1277;
-    self->combbuffersizes[3] = self->combbuffersizes[11] = 1356;
-    self->combbuffersizes[4] = self->combbuffersizes[12] = 1422;
-    self->combbuffersizes[5] = self->combbuffersizes[13] = 1491;
-    self->combbuffersizes[6] = self->combbuffersizes[14] = 1557;
-    self->combbuffersizes[7] = self->combbuffersizes[15] = 1617;
+    // In compact mode every line is half as long which halves the memory used
+    self->compact = compact;
+    static const int16_t comb_sizes[8] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
     for (uint32_t i = 0; i < 8 * channel_count; i++) {
-        self->combbuffers[i] = m_malloc_maybe(self->combbuffersizes[i] * sizeof(uint16_t));
+        self->combbuffersizes[i] = comb_sizes[i % 8] >> (compact ? 1 : 0);
+        size_t size = self->combbuffersizes[i] * sizeof(int16_t);
+        self->combbuffers[i] = m_malloc_maybe(size);
         if (self->combbuffers[i] == NULL) {
             common_hal_audiofreeverb_freeverb_deinit(self);
-            m_malloc_fail(self->combbuffersizes[i]);
+            m_malloc_fail(size);
         }
-        memset(self->combbuffers[i], 0, self->combbuffersizes[i]);
+        memset(self->combbuffers[i], 0, size);
 
         self->combbufferindex[i] = 0;
         self->combfitlers[i] = 0;
@@ -100,17 +97,16 @@ void common_hal_audiofreeverb_freeverb_construct(audiofreeverb_freeverb_obj_t *s
 
     // Set up the allpass filters
     // These values come from FreeVerb and are selected for the best reverb sound
-    self->allpassbuffersizes[0] = self->allpassbuffersizes[4] = 556;
-    self->allpassbuffersizes[1] = self->allpassbuffersizes[5] = 441;
-    self->allpassbuffersizes[2] = self->allpassbuffersizes[6] = 341;
-    self->allpassbuffersizes[3] = self->allpassbuffersizes[7] = 225;
+    static const int16_t allpass_sizes[4] = { 556, 441, 341, 225 };
     for (uint32_t i = 0; i < 4 * channel_count; i++) {
-        self->allpassbuffers[i] = m_malloc_maybe(self->allpassbuffersizes[i] * sizeof(uint16_t));
+        self->allpassbuffersizes[i] = allpass_sizes[i % 4] >> (compact ? 1 : 0);
+        size_t size = self->allpassbuffersizes[i] * sizeof(int16_t);
+        self->allpassbuffers[i] = m_malloc_maybe(size);
         if (self->allpassbuffers[i] == NULL) {
             common_hal_audiofreeverb_freeverb_deinit(self);
-            m_malloc_fail(self->allpassbuffersizes[i]);
+            m_malloc_fail(size);
         }
-        memset(self->allpassbuffers[i], 0, self->allpassbuffersizes[i]);
+        memset(self->allpassbuffers[i], 0, size);
 
         self->allpassbufferindex[i] = 0;
     }
@@ -129,6 +125,12 @@ void common_hal_audiofreeverb_freeverb_deinit(audiofreeverb_freeverb_obj_t *self
     }
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
+    for (uint32_t i = 0; i < 16; i++) {
+        self->combbuffers[i] = NULL;
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+        self->allpassbuffers[i] = NULL;
+    }
 }
 
 mp_obj_t common_hal_audiofreeverb_freeverb_get_roomsize(audiofreeverb_freeverb_obj_t *self) {
@@ -168,6 +170,10 @@ void audiofreeverb_freeverb_get_damp_fixedpoint(mp_float_t n, int16_t *damp1, in
     *damp2 = (int16_t)(32768 - *damp1); // inverse of x1 damp2 = 1.0 - damp1
 }
 
+bool common_hal_audiofreeverb_freeverb_get_compact(audiofreeverb_freeverb_obj_t *self) {
+    return self->compact;
+}
+
 mp_obj_t common_hal_audiofreeverb_freeverb_get_mix(audiofreeverb_freeverb_obj_t *self) {
     return self->mix.obj;
 }
@@ -218,6 +224,56 @@ void common_hal_audiofreeverb_freeverb_stop(audiofreeverb_freeverb_obj_t *self)
     return;
 }
 
+// Runs comb filter j over a block, adding its output to sum. The block is split where the delay
+// line wraps so the inner loop is a plain walk through memory.
+static void freeverb_comb_block(audiofreeverb_freeverb_obj_t *self, uint32_t j, const int16_t *input, int32_t *sum,
+    uint32_t n, int16_t feedback, int16_t damp1, int16_t damp2) {
+    int16_t *line = self->combbuffers[j];
+    int32_t filter = self->combfitlers[j];
+    uint32_t index = self->combbufferindex[j];
+    uint32_t i = 0;
+    while (i < n) {
+        uint32_t run = MIN(n - i, (uint32_t)self->combbuffersizes[j] - index);
+        int16_t *p = line + index;
+        for (uint32_t k = 0; k < run; k++) {
+            int16_t bufout = p[k];
+            sum[i + k] += bufout;
+            filter = synthio_sat16(bufout * damp2 + filter * damp1, 15);
+            p[k] = synthio_sat16(input[i + k] + synthio_sat16(filter * feedback, 15), 0);
+        }
+        i += run;
+        index += run;
+        if (index >= (uint32_t)self->combbuffersizes[j]) {
+            index = 0;
+        }
+    }
+    self->combfitlers[j] = filter;
+    self->combbufferindex[j] = index;
+}
+
+// Runs allpass filter j over a block in place.
+static void freeverb_allpass_block(audiofreeverb_freeverb_obj_t *self, uint32_t j, int16_t *block, uint32_t n) {
+    int16_t *line = self->allpassbuffers[j];
+    uint32_t index = self->allpassbufferindex[j];
+    uint32_t i = 0;
+    while (i < n) {
+        uint32_t run = MIN(n - i, (uint32_t)self->allpassbuffersizes[j] - index);
+        int16_t *p = line + index;
+        for (uint32_t k = 0; k < run; k++) {
+            int16_t bufout = p[k];
+            int16_t output = block[i + k];
+            p[k] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
+            block[i + k] = synthio_sat16(bufout - output, 1);
+        }
+        i += run;
+        index += run;
+        if (index >= (uint32_t)self->allpassbuffersizes[j]) {
+            index = 0;
+        }
+    }
+    self->allpassbufferindex[j] = index;
+}
+
 audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_freeverb_obj_t *self, bool single_channel_output, uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
 
@@ -270,55 +326,39 @@ audioio_get_buffer_result_t audiofreeverb_freeverb_get_buffer(audiofreeverb_free
         int16_t feedback = audiofreeverb_freeverb_get_roomsize_fixedpoint(roomsize);
 
         int16_t *sample_src = (int16_t *)self->sample_remaining_buffer;
-
-        for (uint32_t i = 0; i < n; i++) {
-            int32_t sample_word = 0;
-            if (self->sample != NULL) {
-                sample_word = sample_src[i];
+        uint8_t channel_count = self->base.channel_count;
+        uint32_t frames = n / channel_count;
+
+        // Each filter runs over the whole block before the next one so its delay line stays in
+        // cache and the loops are tight. Every channel has its own set of filters.
+        for (uint8_t c = 0; c < channel_count; c++) {
+            int16_t block[SYNTHIO_MAX_DUR];
+            int32_t sum[SYNTHIO_MAX_DUR];
+
+            for (uint32_t i = 0; i < frames; i++) {
+                int32_t sample_word = self->sample != NULL ? sample_src[i * channel_count + c] : 0;
+                block[i] = synthio_sat16(sample_word * 8738, 17); // Initial input scaled down so we can add reverb
+                sum[i] = 0;
             }
 
-            int32_t word, sum;
-            int16_t input, bufout, output;
-            uint32_t channel_comb_offset = 0, channel_allpass_offset = 0;
-
-            input = synthio_sat16(sample_word * 8738, 17); // Initial input scaled down so we can add reverb
-            sum = 0;
-
-            // Calculate each of the 8 comb buffers
-            for (uint32_t j = 0 + channel_comb_offset; j < 8 + channel_comb_offset; j++) {
-                bufout = self->combbuffers[j][self->combbufferindex[j]];
-                sum += bufout;
-                self->combfitlers[j] = synthio_sat16(bufout * damp2 + self->combfitlers[j] * damp1, 15);
-                self->combbuffers[j][self->combbufferindex[j]] = synthio_sat16(input + synthio_sat16(self->combfitlers[j] * feedback, 15), 0);
-                if (++self->combbufferindex[j] >= self->combbuffersizes[j]) {
-                    self->combbufferindex[j] = 0;
-                }
+            for (uint32_t j = c * 8u; j < c * 8u + 8; j++) {
+                freeverb_comb_block(self, j, block, sum, frames, feedback, damp1, damp2);
             }
 
-            output = synthio_sat16(sum * 31457, 17); // 31457 = 0.24f with shift of 17
-
-            // Calculate each of the 4 all pass buffers
-            for (uint32_t j = 0 + channel_allpass_offset; j < 4 + channel_allpass_offset; j++) {
-                bufout = self->allpassbuffers[j][self->allpassbufferindex[j]];
-                self->allpassbuffers[j][self->allpassbufferindex[j]] = output + (bufout >> 1); // bufout >> 1 same as bufout*0.5f
-                output = synthio_sat16(bufout - output, 1);
-                if (++self->allpassbufferindex[j] >= self->allpassbuffersizes[j]) {
-                    self->allpassbufferindex[j] = 0;
-                }
+            for (uint32_t i = 0; i < frames; i++) {
+                block[i] = synthio_sat16(sum[i] * 31457, 17); // 31457 = 0.24f with shift of 17
             }
 
-            word = output * 30; // Add some volume back don't have to saturate as next step will
-
-            word = synthio_sat16(sample_word * mix_sample, 15) + synthio_sat16(word * mix_effect, 15);
-            word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
-            word_buffer[i] = (int16_t)word;
+            for (uint32_t j = c * 4u; j < c * 4u + 4; j++) {
+                freeverb_allpass_block(self, j, block, frames);
+            }
 
-            if ((self->base.channel_count == 2) && (channel_comb_offset == 0)) {
-                channel_comb_offset = 8;
-                channel_allpass_offset = 4;
-            } else {
-                channel_comb_offset = 0;
-                channel_allpass_offset = 0;
+            for (uint32_t i = 0; i < frames; i++) {
+                int32_t sample_word = self->sample != NULL ? sample_src[i * channel_count + c] : 0;
+                int32_t word = block[i] * 30; // Add some volume back don't have to saturate as next step will
+                word = synthio_sat16(sample_word * mix_sample, 15) + synthio_sat16(word * mix_effect, 15);
+                word = synthio_mix_down_sample(word, SYNTHIO_MIX_DOWN_SCALE(2));
+                word_buffer[i * channel_count + c] = (int16_t)word;
             }
         }
 
@@ -28,6 +28,7 @@ typedef struct {
 
     bool loop;
     bool more_data;
+    bool compact; // Delay lines are half the FreeVerb lengths to save memory
 
     int16_t combbuffersizes[16];
     int16_t *combbuffers[16];
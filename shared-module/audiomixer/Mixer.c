@@ -17,6 +17,13 @@
 #include "cmsis_compiler.h"
 #endif
 
+// Cortex-M4, M7 and M33 all have the DSP extension's SIMD instructions.
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+#define AUDIOMIXER_USE_DSP (1)
+#else
+#define AUDIOMIXER_USE_DSP (0)
+#endif
+
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -72,7 +79,7 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
 
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if AUDIOMIXER_USE_DSP
     return __QADD16(a, b);
     #else
     uint32_t result = 0;
@@ -93,16 +100,16 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if AUDIOMIXER_USE_DSP
     mul <<= 16;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
     enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
-    asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
-    asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
+    asm ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul), "r" (val));
+    asm ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul), "r" (val));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
+    asm ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
+    asm ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
     uint32_t result = 0;
@@ -123,7 +130,7 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if AUDIOMIXER_USE_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -131,7 +138,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if AUDIOMIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -139,7 +146,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if AUDIOMIXER_USE_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -154,6 +161,88 @@ static inline uint32_t pack8(uint32_t val) {
     return ((val & 0xff000000) >> 16) | ((val & 0xff00) >> 8);
 }
 
+// Level 1.0 is stored as 1 << 15, which mult16signed can't represent, so it skips the multiply.
+#define UNITY_LEVEL (1 << 15)
+
+// The format arguments are constants at each call site so every combination compiles to its own
+// loop without per-sample branches. The first active voice is copied into word_buffer and the rest
+// are accumulated into it.
+__attribute__((always_inline))
+static inline void mix_words16(uint32_t *word_buffer, const uint32_t *src, uint32_t n, uint16_t level,
+    bool samples_signed, bool accumulate) {
+    if (level == UNITY_LEVEL) {
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t word = src[i];
+            if (!samples_signed) {
+                word = tosigned16(word);
+            }
+            word_buffer[i] = accumulate ? add16signed(word, word_buffer[i]) : word;
+        }
+    } else {
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t word = src[i];
+            if (!samples_signed) {
+                word = tosigned16(word);
+            }
+            word = mult16signed(word, level);
+            word_buffer[i] = accumulate ? add16signed(word, word_buffer[i]) : word;
+        }
+    }
+}
+
+__attribute__((always_inline))
+static inline void mix_words8(uint32_t *word_buffer, const uint32_t *src, uint32_t n, uint16_t level,
+    bool samples_signed, bool accumulate) {
+    uint16_t *hword_buffer = (uint16_t *)word_buffer;
+    const uint16_t *hsrc = (const uint16_t *)src;
+    for (uint32_t i = 0; i < n * 2; i++) {
+        uint32_t word = unpack8(hsrc[i]);
+        if (!samples_signed) {
+            word = tosigned16(word);
+        }
+        if (level != UNITY_LEVEL) {
+            word = mult16signed(word, level);
+        }
+        if (accumulate) {
+            word = add16signed(word, unpack8(hword_buffer[i]));
+        }
+        hword_buffer[i] = pack8(word);
+    }
+}
+
+static void mix_words(audiomixer_mixer_obj_t *self, bool voices_active,
+    uint32_t *word_buffer, const uint32_t *src, uint32_t n, uint16_t level) {
+    if (MP_LIKELY(self->base.bits_per_sample == 16)) {
+        if (MP_LIKELY(self->base.samples_signed)) {
+            if (voices_active) {
+                mix_words16(word_buffer, src, n, level, true, true);
+            } else {
+                mix_words16(word_buffer, src, n, level, true, false);
+            }
+        } else {
+            if (voices_active) {
+                mix_words16(word_buffer, src, n, level, false, true);
+            } else {
+                mix_words16(word_buffer, src, n, level, false, false);
+            }
+        }
+    } else {
+        if (self->base.samples_signed) {
+            if (voices_active) {
+                mix_words8(word_buffer, src, n, level, true, true);
+            } else {
+                mix_words8(word_buffer, src, n, level, true, false);
+            }
+        } else {
+            if (voices_active) {
+                mix_words8(word_buffer, src, n, level, false, true);
+            } else {
+                mix_words8(word_buffer, src, n, level, false, false);
+            }
+        }
+    }
+}
+
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
@@ -189,61 +278,8 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         uint16_t level = voice->level;
         #endif
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->base.samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                } else {
-                    for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->base.samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    word = add16signed(word, unpack8(hword_buffer[i]));
-                    hword_buffer[i] = pack8(word);
-                }
-            }
-        }
+        mix_words(self, voices_active, word_buffer, src, n, level);
+
         length -= n;
         word_buffer += n;
         voice->remaining_buffer += n;
@@ -33,6 +33,14 @@
 #define background_callback_add(buf, fn, arg) ((fn)((arg)))
 #endif
 
+#if defined(UNIX)
+#include <stdlib.h>
+#define port_free free
+#define port_malloc(sz, hint) (malloc(sz))
+#else
+#include "supervisor/port_heap.h"
+#endif
+
 static bool stream_readable(void *stream) {
     int errcode = 0;
     mp_obj_base_t *o = MP_OBJ_TO_PTR(stream);
@@ -96,6 +104,12 @@ static off_t stream_lseek(void *stream, off_t offset, int whence) {
 #define INPUT_BUFFER_READ_PTR(i) ((i).buf + (i).read_off)
 #define INPUT_BUFFER_CONSUME(i, n) ((i).read_off += (n))
 #define INPUT_BUFFER_CLEAR(i) ((i).read_off = (i).write_off = 0)
+// Moving the unconsumed data to the start of a large buffer for every read would copy most of it
+// for a few hundred new bytes. Only do it once half of the buffer has been consumed or when a
+// whole frame no longer fits after the read position.
+#define INPUT_BUFFER_SHOULD_COMPACT(i) ((i).read_off && ((i).read_off >= (i).size / 2 || (i).size - (i).read_off < MAINBUF_SIZE))
+// How much a read could add right now.
+#define INPUT_BUFFER_FILLABLE(i) (INPUT_BUFFER_SHOULD_COMPACT(i) ? INPUT_BUFFER_SPACE(i) : (i).size - (i).write_off)
 
 static void stream_set_blocking(audiomp3_mp3file_obj_t *self, bool block_ok) {
     if (!self->settimeout_args[0]) {
@@ -120,7 +134,7 @@ static void stream_set_blocking(audiomp3_mp3file_obj_t *self, bool block_ok) {
  * Sets self->eof if any read of the file returns 0 bytes
  */
 static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block_ok) {
-    if (self->eof || INPUT_BUFFER_SPACE(self->inbuf) == 0) {
+    if (self->eof || INPUT_BUFFER_FILLABLE(self->inbuf) == 0) {
         return INPUT_BUFFER_AVAILABLE(self->inbuf) > 0;
     }
 
@@ -129,13 +143,13 @@ static bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self, bool block
     // We didn't previously reach EOF and we have input buffer space available
 
     // Move the unconsumed portion of the buffer to the start
-    if (self->inbuf.read_off) {
+    if (INPUT_BUFFER_SHOULD_COMPACT(self->inbuf)) {
         memmove(self->inbuf.buf, INPUT_BUFFER_READ_PTR(self->inbuf), INPUT_BUFFER_AVAILABLE(self->inbuf));
         self->inbuf.write_off -= self->inbuf.read_off;
         self->inbuf.read_off = 0;
     }
 
-    for (size_t to_read; !self->eof && (to_read = INPUT_BUFFER_SPACE(self->inbuf)) > 0;) {
+    for (size_t to_read; !self->eof && (to_read = self->inbuf.size - self->inbuf.write_off) > 0;) {
         uint8_t *write_ptr = self->inbuf.buf + self->inbuf.write_off;
         ssize_t n_read = stream_read(self->stream, write_ptr, to_read);
 
@@ -177,7 +191,7 @@ static void mp3file_update_inbuf_cb(void *self_in) {
     }
 
     #if !defined(MICROPY_UNIX_COVERAGE)
-    if (!self->eof && INPUT_BUFFER_SPACE(self->inbuf) > 512) {
+    if (!self->eof && INPUT_BUFFER_FILLABLE(self->inbuf) > 512) {
         background_callback_add(
             &self->inbuf_fill_cb,
             mp3file_update_inbuf_cb,
@@ -187,12 +201,16 @@ static void mp3file_update_inbuf_cb(void *self_in) {
 }
 
 /** Fill the input buffer if it is less than half full.
+ *
+ * A buffer larger than two frames is only filled here once it holds less
+ * than a frame. Until then it is topped up by mp3file_update_inbuf_cb so
+ * that decoding a frame doesn't wait on a slow stream.
  *
  * Returns the same as mp3file_update_inbuf_always.
  */
 static bool mp3file_update_inbuf_half(audiomp3_mp3file_obj_t *self, bool block_ok) {
-    // If buffer is over half full, do nothing
-    if (INPUT_BUFFER_SPACE(self->inbuf) < self->inbuf.size / 2) {
+    // If buffer is over the low water mark, do nothing
+    if (INPUT_BUFFER_AVAILABLE(self->inbuf) > MIN(self->inbuf.size / 2, MAINBUF_SIZE)) {
         return true;
     }
 
@@ -283,7 +301,8 @@ static bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     mp_obj_t stream,
     uint8_t *buffer,
-    size_t buffer_size) {
+    size_t buffer_size,
+    size_t input_buffer_size) {
     // Note: Adafruit_MP3 uses a 2kB input buffer and two 4kB output pcm_buffer.
     // for a whopping total of 10kB pcm_buffer (+mp3 decoder state and frame buffer)
     // At 44kHz, that's 23ms of output audio data.
@@ -298,7 +317,37 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
         buffer += 1;
         buffer_size -= 1;
     }
-    if (buffer && buffer_size > MIN_USER_BUFFER_SIZE) {
+    self->inbuf_port_heap = false;
+    if (input_buffer_size > 0) {
+        // The compressed data is only touched by the CPU, so it can live outside the VM heap
+        // (in PSRAM when the port has it) and be as large as a slow stream needs.
+        self->pcm_buffer[0] = NULL;
+        self->pcm_buffer[1] = NULL;
+        self->inbuf.size = input_buffer_size;
+        self->inbuf.buf = port_malloc(input_buffer_size, false);
+        if (self->inbuf.buf == NULL) {
+            common_hal_audiomp3_mp3file_deinit(self);
+            m_malloc_fail(input_buffer_size);
+        }
+        self->inbuf_port_heap = true;
+
+        if (buffer_size >= 2 * MAX_BUFFER_LEN) {
+            self->pcm_buffer[0] = (int16_t *)(void *)buffer;
+            self->pcm_buffer[1] = (int16_t *)(void *)(buffer + MAX_BUFFER_LEN);
+        } else {
+            self->pcm_buffer[0] = m_malloc_without_collect(MAX_BUFFER_LEN);
+            if (self->pcm_buffer[0] == NULL) {
+                common_hal_audiomp3_mp3file_deinit(self);
+                m_malloc_fail(MAX_BUFFER_LEN);
+            }
+
+            self->pcm_buffer[1] = m_malloc_without_collect(MAX_BUFFER_LEN);
+            if (self->pcm_buffer[1] == NULL) {
+                common_hal_audiomp3_mp3file_deinit(self);
+                m_malloc_fail(MAX_BUFFER_LEN);
+            }
+        }
+    } else if (buffer && buffer_size > MIN_USER_BUFFER_SIZE) {
         self->pcm_buffer[0] = (int16_t *)(void *)buffer;
         self->pcm_buffer[1] = (int16_t *)(void *)(buffer + MAX_BUFFER_LEN);
         self->inbuf.buf = buffer + 2 * MAX_BUFFER_LEN;
@@ -389,6 +438,7 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t
     self->base.max_buffer_length = fi.outputSamps * sizeof(int16_t);
     self->len = 2 * self->base.max_buffer_length;
     self->samples_decoded = 0;
+    self->underruns = 0;
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
@@ -397,6 +447,10 @@ void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
         MP3FreeDecoder(self->decoder);
     }
     self->decoder = NULL;
+    if (self->inbuf_port_heap && self->inbuf.buf) {
+        port_free(self->inbuf.buf);
+    }
+    self->inbuf_port_heap = false;
     self->inbuf.buf = NULL;
     self->pcm_buffer[0] = NULL;
     self->pcm_buffer[1] = NULL;
@@ -465,6 +519,9 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     if (!mp3file_find_sync_word(self, false)) {
         memset(buffer, 0, self->base.max_buffer_length);
         *buffer_length = 0;
+        if (!self->eof) {
+            self->underruns++;
+        }
         return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
     }
     int bytes_left = BYTES_LEFT(self);
@@ -484,6 +541,7 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
             self->eof = true;
             return GET_BUFFER_ERROR;
         }
+        self->underruns++;
     }
 
     self->samples_decoded += frame_buffer_size_bytes / sizeof(int16_t);
@@ -494,7 +552,7 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     if (DO_DEBUG) {
         mp_printf(&mp_plat_print, "%s:%d result=%d\n", __FILE__, __LINE__, result);
     }
-    if (INPUT_BUFFER_SPACE(self->inbuf) > 512) {
+    if (INPUT_BUFFER_FILLABLE(self->inbuf) > 512) {
         background_callback_add(
             &self->inbuf_fill_cb,
             mp3file_update_inbuf_cb,
@@ -520,3 +578,15 @@ float common_hal_audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self) {
 uint32_t common_hal_audiomp3_mp3file_get_samples_decoded(audiomp3_mp3file_obj_t *self) {
     return self->samples_decoded;
 }
+
+uint32_t common_hal_audiomp3_mp3file_get_underruns(audiomp3_mp3file_obj_t *self) {
+    return self->underruns;
+}
+
+uint32_t common_hal_audiomp3_mp3file_get_input_buffer_size(audiomp3_mp3file_obj_t *self) {
+    return self->inbuf.size;
+}
+
+uint32_t common_hal_audiomp3_mp3file_get_input_buffered(audiomp3_mp3file_obj_t *self) {
+    return INPUT_BUFFER_AVAILABLE(self->inbuf);
+}
@@ -25,6 +25,7 @@ typedef struct {
     struct _MP3DecInfo *decoder;
     background_callback_t inbuf_fill_cb;
     mp3_input_buffer_t inbuf;
+    bool inbuf_port_heap; // inbuf was allocated with port_malloc and must be freed
     int16_t *pcm_buffer[2];
     uint32_t len;
 
@@ -39,6 +40,7 @@ typedef struct {
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+    uint32_t underruns; // Frames played as silence because the input buffer ran dry
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
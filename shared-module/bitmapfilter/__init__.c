@@ -22,7 +22,9 @@
 #define port_free free
 #define port_malloc(sz, hint) (malloc(sz))
 #define port_realloc(ptr, size, dma_capable) realloc(ptr, size)
+#define port_run_split(fun, data, count) (fun(data, 0, count))
 #else
+#include "supervisor/port.h"
 #include "supervisor/port_heap.h"
 #endif
 
@@ -88,6 +90,59 @@ uint16_t imlib_yuv_to_rgb(uint8_t y, int8_t u, int8_t v) {
     return COLOR_R8_G8_B8_TO_RGB565(r, g, b);
 }
 
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+
+// Packs horizontally adjacent weights into halfword pairs for __smlad. The last weight of
+// each row has no partner and stays with the scalar code. Returns false if a weight doesn't
+// fit in a halfword.
+static bool morph_pack_weights(const int ksize, const int *krn, int32_t *pairs) {
+    int n = 2 * ksize + 1;
+    for (int j = 0; j < n; j++) {
+        for (int k = 0; k < n; k++) {
+            if (krn[j * n + k] < INT16_MIN || krn[j * n + k] > INT16_MAX) {
+                return false;
+            }
+        }
+        for (int k = 0; k < ksize; k++) {
+            uint32_t lo = krn[j * n + 2 * k] & 0xffff;
+            uint32_t hi = krn[j * n + 2 * k + 1] & 0xffff;
+            *pairs++ = (int32_t)(hi << 16 | lo);
+        }
+    }
+    return true;
+}
+
+// Accumulates the kernel around an interior pixel two taps at a time. Once byte swapped and
+// masked, each halfword lane of two adjacent RGB565 pixels holds one channel of one pixel.
+static void morph_accumulate_simd32(displayio_bitmap_t *bitmap, int x, int y,
+    const int ksize, const int *krn, const int32_t *pairs,
+    int32_t *r_out, int32_t *g_out, int32_t *b_out) {
+    int n = 2 * ksize + 1;
+    int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+    for (int j = 0; j < n; j++) {
+        uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y + j - ksize) + x - ksize;
+        for (int k = 0; k < ksize; k++) {
+            uint32_t two_pixels;
+            memcpy(&two_pixels, k_row_ptr + 2 * k, sizeof(two_pixels));
+            two_pixels = __rev16(two_pixels);
+            int32_t weights = *pairs++;
+            r_acc = __smlad((two_pixels >> 11) & 0x001f001f, weights, r_acc);
+            g_acc = __smlad((two_pixels >> 5) & 0x003f003f, weights, g_acc);
+            b_acc = __smlad(two_pixels & 0x001f001f, weights, b_acc);
+        }
+        int pixel = IMAGE_GET_RGB565_PIXEL_FAST(k_row_ptr, n - 1);
+        int weight = krn[j * n + n - 1];
+        r_acc += weight * COLOR_RGB565_TO_R5(pixel);
+        g_acc += weight * COLOR_RGB565_TO_G6(pixel);
+        b_acc += weight * COLOR_RGB565_TO_B5(pixel);
+    }
+    *r_out = r_acc;
+    *g_out = g_acc;
+    *b_out = b_acc;
+}
+#endif
+
 void shared_module_bitmapfilter_morph(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
@@ -111,6 +166,11 @@ void shared_module_bitmapfilter_morph(
             displayio_bitmap_t buf;
             scratch_bitmap16(&buf, brows, bitmap->width);
 
+            #if defined(__ARM_FEATURE_SIMD32)
+            int32_t weight_pairs[MAX(1, (2 * ksize + 1) * ksize)];
+            bool use_simd32 = morph_pack_weights(ksize, krn, weight_pairs);
+            #endif
+
             for (int y = 0, yy = bitmap->height; y < yy; y++) {
                 uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
                 uint16_t *buf_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(&buf, (y % brows));
@@ -124,6 +184,11 @@ void shared_module_bitmapfilter_morph(
                     int32_t r_acc = 0, g_acc = 0, b_acc = 0, ptr = 0;
 
                     if (x >= ksize && x < bitmap->width - ksize && y >= ksize && y < bitmap->height - ksize) {
+                        #if defined(__ARM_FEATURE_SIMD32)
+                        if (use_simd32) {
+                            morph_accumulate_simd32(bitmap, x, y, ksize, krn, weight_pairs, &r_acc, &g_acc, &b_acc);
+                        } else
+                        #endif
                         for (int j = -ksize; j <= ksize; j++) {
                             uint16_t *k_row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y + j);
                             for (int k = -ksize; k <= ksize; k++) {
@@ -197,12 +262,65 @@ void shared_module_bitmapfilter_morph(
     }
 }
 
+typedef struct {
+    displayio_bitmap_t *bitmap;
+    displayio_bitmap_t *mask;
+    int wt[12];
+} mix_rows_t;
+
+// Rows are independent so port_run_split() may run some of them on another core.
+static void mix_rows(void *data, size_t start, size_t end) {
+    mix_rows_t *args = data;
+    displayio_bitmap_t *bitmap = args->bitmap;
+    displayio_bitmap_t *mask = args->mask;
+    const int *wt = args->wt;
+    for (int y = start, yy = end; y < yy; y++) {
+        uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
+        for (int x = 0, xx = bitmap->width; x < xx; x++) {
+            if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
+                continue; // Short circuit.
+            }
+            int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
+            int32_t r_acc = 0, g_acc = 0, b_acc = 0;
+            int r = COLOR_RGB565_TO_R5(pixel);
+            int g = COLOR_RGB565_TO_G6(pixel);
+            int b = COLOR_RGB565_TO_B5(pixel);
+            r_acc = r * wt[0] + g * wt[1] + b * wt[2] + wt[3];
+            r_acc >>= 16;
+            if (r_acc < 0) {
+                r_acc = 0;
+            } else if (r_acc > COLOR_R5_MAX) {
+                r_acc = COLOR_R5_MAX;
+            }
+
+            g_acc = r * wt[4] + g * wt[5] + b * wt[6] + wt[7];
+            g_acc >>= 16;
+            if (g_acc < 0) {
+                g_acc = 0;
+            } else if (g_acc > COLOR_G6_MAX) {
+                g_acc = COLOR_G6_MAX;
+            }
+
+            b_acc = r * wt[8] + g * wt[9] + b * wt[10] + wt[11];
+            b_acc >>= 16;
+            if (b_acc < 0) {
+                b_acc = 0;
+            } else if (b_acc > COLOR_B5_MAX) {
+                b_acc = COLOR_B5_MAX;
+            }
+
+            pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
+            IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
+        }
+    }
+}
+
 void shared_module_bitmapfilter_mix(
     displayio_bitmap_t *bitmap,
     displayio_bitmap_t *mask,
     const mp_float_t weights[12]) {
 
-    int wt[12];
+    mix_rows_t args = { .bitmap = bitmap, .mask = mask };
     for (int i = 0; i < 12; i++) {
         // The different scale factors correct for G having 6 bits while R, G have 5
         // by doubling the scale for R/B->G and halving the scale for G->R/B.
@@ -214,52 +332,14 @@ void shared_module_bitmapfilter_mix(
             (i == 3 || i == 11) ? 65535 * COLOR_B5_MAX : // Offset for R/B
             (i == 7) ? 65535 * COLOR_G6_MAX : // Offset for G
             65536;
-        wt[i] = (int32_t)MICROPY_FLOAT_C_FUN(round)(scale * weights[i]);
+        args.wt[i] = (int32_t)MICROPY_FLOAT_C_FUN(round)(scale * weights[i]);
     }
 
     switch (bitmap->bits_per_value) {
         default:
             mp_raise_ValueError(MP_ERROR_TEXT("unsupported bitmap depth"));
         case 16: {
-            for (int y = 0, yy = bitmap->height; y < yy; y++) {
-                uint16_t *row_ptr = IMAGE_COMPUTE_RGB565_PIXEL_ROW_PTR(bitmap, y);
-                for (int x = 0, xx = bitmap->width; x < xx; x++) {
-                    if (mask && common_hal_displayio_bitmap_get_pixel(mask, x, y)) {
-                        continue; // Short circuit.
-                    }
-                    int pixel = IMAGE_GET_RGB565_PIXEL_FAST(row_ptr, x);
-                    int32_t r_acc = 0, g_acc = 0, b_acc = 0;
-                    int r = COLOR_RGB565_TO_R5(pixel);
-                    int g = COLOR_RGB565_TO_G6(pixel);
-                    int b = COLOR_RGB565_TO_B5(pixel);
-                    r_acc = r * wt[0] + g * wt[1] + b * wt[2] + wt[3];
-                    r_acc >>= 16;
-                    if (r_acc < 0) {
-                        r_acc = 0;
-                    } else if (r_acc > COLOR_R5_MAX) {
-                        r_acc = COLOR_R5_MAX;
-                    }
-
-                    g_acc = r * wt[4] + g * wt[5] + b * wt[6] + wt[7];
-                    g_acc >>= 16;
-                    if (g_acc < 0) {
-                        g_acc = 0;
-                    } else if (g_acc > COLOR_G6_MAX) {
-                        g_acc = COLOR_G6_MAX;
-                    }
-
-                    b_acc = r * wt[8] + g * wt[9] + b * wt[10] + wt[11];
-                    b_acc >>= 16;
-                    if (b_acc < 0) {
-                        b_acc = 0;
-                    } else if (b_acc > COLOR_B5_MAX) {
-                        b_acc = COLOR_B5_MAX;
-                    }
-
-                    pixel = COLOR_R5_G6_B5_TO_RGB565(r_acc, g_acc, b_acc);
-                    IMAGE_PUT_RGB565_PIXEL_FAST(row_ptr, x, pixel);
-                }
-            }
+            port_run_split(mix_rows, &args, bitmap->height);
             break;
         }
     }
@@ -204,6 +204,42 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     }
 }
 
+MP_WEAK bool common_hal_bitmaptools_port_fill_region(displayio_bitmap_t *destination, const displayio_area_t *area, uint32_t value) {
+    return false;
+}
+
+MP_WEAK bool common_hal_bitmaptools_port_blit(displayio_bitmap_t *destination, int16_t x, int16_t y,
+    displayio_bitmap_t *source, const displayio_area_t *source_area) {
+    return false;
+}
+
+// Fills whole rows at a time for bitmaps with at least one byte per value.
+static void _fill_rows(displayio_bitmap_t *destination, const displayio_area_t *area, uint32_t value) {
+    uint16_t width = displayio_area_width(area);
+    for (int16_t y = area->y1; y < area->y2; y++) {
+        uint32_t *row = destination->data + y * destination->stride;
+        switch (destination->bits_per_value) {
+            case 8:
+                memset(((uint8_t *)row) + area->x1, value, width);
+                break;
+            case 16: {
+                uint16_t *ptr = ((uint16_t *)row) + area->x1;
+                for (uint16_t i = 0; i < width; i++) {
+                    ptr[i] = value;
+                }
+                break;
+            }
+            case 32: {
+                uint32_t *ptr = row + area->x1;
+                for (uint16_t i = 0; i < width; i++) {
+                    ptr[i] = value;
+                }
+                break;
+            }
+        }
+    }
+}
+
 void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     int16_t x1, int16_t y1,
     int16_t x2, int16_t y2,
@@ -216,14 +252,23 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     displayio_area_canon(&area);
 
     displayio_area_t bitmap_area = { 0, 0, destination->width, destination->height, NULL };
-    displayio_area_compute_overlap(&area, &bitmap_area, &area);
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
 
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
+    if (destination->bits_per_value >= 8) {
+        if (!common_hal_bitmaptools_port_fill_region(destination, &area, value)) {
+            _fill_rows(destination, &area, value);
+        }
+        return;
+    }
+
     int16_t x, y;
-    for (x = area.x1; x < area.x2; x++) {
-        for (y = area.y1; y < area.y2; y++) {
+    for (y = area.y1; y < area.y2; y++) {
+        for (x = area.x1; x < area.x2; x++) {
             displayio_bitmap_write_pixel(destination, x, y, value);
         }
     }
@@ -1034,6 +1079,40 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Copies rows of same-depth bitmaps with memmove so a bitmap can be blit onto itself.
+static void _blit_rows(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
+    int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool y_reverse) {
+    // Clip the destination and move the source area with it.
+    displayio_area_t source_area = { x1, y1, x2, y2, NULL };
+    if (x < 0) {
+        source_area.x1 -= x;
+        x = 0;
+    }
+    if (y < 0) {
+        source_area.y1 -= y;
+        y = 0;
+    }
+    source_area.x2 = MIN(source_area.x2, source_area.x1 + destination->width - x);
+    source_area.y2 = MIN(source_area.y2, source_area.y1 + destination->height - y);
+    if (source_area.x1 >= source_area.x2 || source_area.y1 >= source_area.y2) {
+        return;
+    }
+
+    if (common_hal_bitmaptools_port_blit(destination, x, y, source, &source_area)) {
+        return;
+    }
+
+    uint8_t bytes_per_value = source->bits_per_value / 8;
+    size_t row_bytes = displayio_area_width(&source_area) * bytes_per_value;
+    int16_t height = displayio_area_height(&source_area);
+    for (int16_t j = 0; j < height; j++) {
+        int16_t row = y_reverse ? height - j - 1 : j;
+        uint8_t *src = (uint8_t *)(source->data + (source_area.y1 + row) * source->stride) + source_area.x1 * bytes_per_value;
+        uint8_t *dest = (uint8_t *)(destination->data + (y + row) * destination->stride) + x * bytes_per_value;
+        memmove(dest, src, row_bytes);
+    }
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1070,6 +1149,14 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
         y_reverse = true;
     }
 
+    // Copy whole rows when there's nothing to skip and values are whole bytes.
+    if (skip_source_index_none && skip_dest_index_none &&
+        source->bits_per_value == destination->bits_per_value &&
+        source->bits_per_value >= 8) {
+        _blit_rows(destination, source, x, y, x1, y1, x2, y2, y_reverse);
+        return;
+    }
+
     // simplest version - use internal functions for get/set pixels
     for (int16_t i = 0; i < (x2 - x1); i++) {
 
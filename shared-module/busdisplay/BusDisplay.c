@@ -20,6 +20,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -32,6 +33,10 @@
 
 #define DELAY 0x80
 
+// Rough cost, in pixels, of the commands and setup needed to refresh an area. Areas closer
+// together than this are refreshed as one.
+#define AREA_OVERHEAD_PIXELS (64)
+
 void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *self,
     mp_obj_t bus, uint16_t width, uint16_t height, int16_t colstart, int16_t rowstart,
     uint16_t rotation, uint16_t color_depth, bool grayscale, bool pixels_in_byte_share_row,
@@ -44,6 +49,11 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
 
     // Turn off auto-refresh as we init.
     self->auto_refresh = false;
+    self->background_area = NULL;
+    self->shadow_buffer = NULL;
+    self->pixel_buffers = NULL;
+    self->pipelined_refresh = false;
+    self->pixel_buffers_failed = false;
     uint16_t ram_width = 0x100;
     uint16_t ram_height = 0x100;
     if (single_byte_bounds) {
@@ -201,7 +211,10 @@ static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *s
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t *areas = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        if (displayio_area_coalesce(areas, self->refresh_areas, BUSDISPLAY_REFRESH_AREA_COUNT, AREA_OVERHEAD_PIXELS) > 0) {
+            return &self->refresh_areas[0];
+        }
     }
     return NULL;
 }
@@ -213,17 +226,133 @@ static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
     self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
 }
 
-static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+// Like _send_pixels but returns true while the pixels are still being sent in the
+// background. Call bus.finish_send before touching the buffer again.
+static bool _start_send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uint32_t length) {
+    if (!self->bus.data_as_commands) {
+        self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &self->write_ram_command, 1);
+    }
+    if (self->bus.start_send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length)) {
+        return true;
+    }
+    self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
+    return false;
+}
+
+// Refresh buffers larger than the stack buffer, and the second buffer used to render
+// while the first is sent, come from the port heap so they stay put and are DMA
+// capable. The mask lives after the pixel buffers. Returns the size of each pixel
+// buffer in uint32_ts, or 0 when the stack buffer should be used.
+static uint32_t _allocate_pixel_buffers(busdisplay_busdisplay_obj_t *self) {
+    if (self->pixel_buffers != NULL) {
+        return DISPLAYIO_REFRESH_BUFFER_SIZE;
+    }
+    if (self->pixel_buffers_failed) {
+        return 0;
+    }
+    uint8_t count = 1;
+    if (self->pipelined_refresh && self->bus.start_send != NULL && !self->bus.SH1107_addressing) {
+        count = 2;
+    }
+    // Without room for a second buffer, refresh from one without pipelining.
+    for (; count > 0; count--) {
+        if (count == 1 && DISPLAYIO_REFRESH_BUFFER_SIZE <= DISPLAYIO_STACK_BUFFER_SIZE) {
+            return 0;
+        }
+        // A full buffer of one bit pixels needs one mask word per pixel buffer word.
+        size_t words = (count + 1) * DISPLAYIO_REFRESH_BUFFER_SIZE + 1;
+        self->pixel_buffers = port_malloc(words * sizeof(uint32_t), true);
+        if (self->pixel_buffers != NULL) {
+            self->pixel_buffer_count = count;
+            return DISPLAYIO_REFRESH_BUFFER_SIZE;
+        }
+    }
+    self->pixel_buffers_failed = true;
+    return 0;
+}
+
+static void _get_subrectangle(const displayio_area_t *clipped, uint16_t rows_per_buffer, uint16_t index,
+    displayio_area_t *subrectangle) {
+    subrectangle->x1 = clipped->x1;
+    subrectangle->y1 = clipped->y1 + rows_per_buffer * index;
+    subrectangle->x2 = clipped->x2;
+    subrectangle->y2 = MIN(subrectangle->y1 + rows_per_buffer, clipped->y2);
+    subrectangle->next = NULL;
+}
+
+static void _fill_subrectangle(busdisplay_busdisplay_obj_t *self, displayio_area_t *subrectangle,
+    uint32_t *mask, uint32_t mask_length, uint32_t *buffer, uint32_t buffer_size) {
+    memset(mask, 0, mask_length * sizeof(mask[0]));
+    memset(buffer, 0, buffer_size * sizeof(buffer[0]));
+
+    displayio_display_core_fill_area(&self->core, subrectangle, mask, buffer);
+}
+
+static bool _shadow_supported(busdisplay_busdisplay_obj_t *self) {
+    return self->core.colorspace.depth == 1 && !self->core.colorspace.pixels_in_byte_share_row &&
+           self->core.colorspace.bytes_per_cell == 1;
+}
+
+// Compares a rendered subrectangle with the shadow copy of panel memory, which is one byte
+// per column for each page of eight rows. Narrows subrectangle to the pages and columns that
+// changed, packs their bytes at the start of buffer and records them in the shadow. Returns
+// false when nothing changed.
+static bool _diff_with_shadow(busdisplay_busdisplay_obj_t *self, displayio_area_t *subrectangle, uint8_t *buffer) {
+    uint16_t width = displayio_area_width(subrectangle);
+    uint16_t pages = displayio_area_height(subrectangle) / 8;
+    uint16_t shadow_width = self->core.area.x2;
+    uint8_t *shadow = self->shadow_buffer + (subrectangle->y1 / 8) * shadow_width + subrectangle->x1;
+    uint16_t first_page = pages;
+    uint16_t last_page = 0;
+    uint16_t first_column = width;
+    uint16_t last_column = 0;
+    for (uint16_t page = 0; page < pages; page++) {
+        uint8_t *rendered = buffer + page * width;
+        uint8_t *shadow_page = shadow + page * shadow_width;
+        for (uint16_t column = 0; column < width; column++) {
+            if (self->shadow_valid && rendered[column] == shadow_page[column]) {
+                continue;
+            }
+            shadow_page[column] = rendered[column];
+            first_page = MIN(first_page, page);
+            last_page = page;
+            first_column = MIN(first_column, column);
+            last_column = MAX(last_column, column);
+        }
+    }
+    if (first_page == pages) {
+        return false;
+    }
+    uint16_t changed_width = last_column - first_column + 1;
+    for (uint16_t page = first_page; page <= last_page; page++) {
+        memmove(buffer + (page - first_page) * changed_width, buffer + page * width + first_column, changed_width);
+    }
+    subrectangle->x1 += first_column;
+    subrectangle->x2 = subrectangle->x1 + changed_width;
+    subrectangle->y1 += first_page * 8;
+    subrectangle->y2 = subrectangle->y1 + (last_page - first_page + 1) * 8;
+    return true;
+}
 
+// Refreshes up to max_subrectangles of area, starting at *next_subrectangle, and leaves
+// *next_subrectangle at the first one not sent. Returns true once the whole area is sent.
+static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area,
+    uint16_t *next_subrectangle, uint16_t max_subrectangles) {
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
     if (!displayio_display_core_clip_area(&self->core, area, &clipped)) {
         return true;
     }
+
+    uint32_t heap_buffer_size = _allocate_pixel_buffers(self);
+    uint32_t buffer_size = DISPLAYIO_STACK_BUFFER_SIZE; // In uint32_ts
+    if (heap_buffer_size > 0) {
+        buffer_size = heap_buffer_size;
+    }
+
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
 
     uint16_t subrectangles = 1;
     // for SH1107 and other boundary constrained controllers
@@ -254,46 +383,84 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         }
     }
 
+    uint16_t first_subrectangle = *next_subrectangle;
+    uint16_t end_subrectangle = subrectangles;
+    if (subrectangles - first_subrectangle > max_subrectangles) {
+        end_subrectangle = first_subrectangle + max_subrectangles;
+    }
+
+    uint32_t mask_length = (pixels_per_buffer / 32) + 1;
+    // A single row wider than the heap buffer still goes through the stack.
+    bool use_heap = heap_buffer_size >= buffer_size && heap_buffer_size + 1 >= mask_length;
+    // Pipelining only pays off when there is a next subrectangle to render.
+    bool pipelined = use_heap && self->pixel_buffer_count == 2 && end_subrectangle - first_subrectangle > 1;
+    bool shadow = self->shadow_buffer != NULL;
+    if (shadow) {
+        pipelined = false;
+    }
+
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
-    uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
-    uint16_t remaining_rows = displayio_area_height(&clipped);
-
-    for (uint16_t j = 0; j < subrectangles; j++) {
-        displayio_area_t subrectangle = {
-            .x1 = clipped.x1,
-            .y1 = clipped.y1 + rows_per_buffer * j,
-            .x2 = clipped.x2,
-            .y2 = clipped.y1 + rows_per_buffer * (j + 1)
-        };
-        if (remaining_rows < rows_per_buffer) {
-            subrectangle.y2 = subrectangle.y1 + remaining_rows;
+    uint32_t stack_buffer[use_heap ? 1 : buffer_size];
+    uint32_t stack_mask[use_heap ? 1 : mask_length];
+    uint32_t *buffers[2] = {stack_buffer, stack_buffer};
+    uint32_t *mask = stack_mask;
+    if (use_heap) {
+        buffers[0] = self->pixel_buffers;
+        buffers[1] = pipelined ? self->pixel_buffers + heap_buffer_size : buffers[0];
+        mask = self->pixel_buffers + self->pixel_buffer_count * heap_buffer_size;
+    }
+    uint8_t current_buffer = 0;
+    bool filled = false;
+
+    for (uint16_t j = first_subrectangle; j < end_subrectangle; j++) {
+        displayio_area_t subrectangle;
+        _get_subrectangle(&clipped, rows_per_buffer, j, &subrectangle);
+
+        uint32_t *buffer = buffers[current_buffer];
+        if (!filled) {
+            _fill_subrectangle(self, &subrectangle, mask, mask_length, buffer, buffer_size);
         }
-        remaining_rows -= rows_per_buffer;
+        filled = false;
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+        // Can't acquire display bus; skip the rest of the data.
+        if (!displayio_display_bus_is_free(&self->bus)) {
+            *next_subrectangle = j;
+            return false;
+        }
 
-        uint16_t subrectangle_size_bytes;
+        bool changed = true;
+        if (shadow) {
+            changed = _diff_with_shadow(self, &subrectangle, (uint8_t *)buffer);
+        }
+
+        uint32_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) * (self->core.colorspace.depth / 8);
         } else {
             subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
         }
 
-        memset(mask, 0, mask_length * sizeof(mask[0]));
-        memset(buffer, 0, buffer_size * sizeof(buffer[0]));
-
-        displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
-
-        // Can't acquire display bus; skip the rest of the data.
-        if (!displayio_display_bus_is_free(&self->bus)) {
-            return false;
+        if (changed) {
+            displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
         }
 
         displayio_display_bus_begin_transaction(&self->bus);
-        _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+        if (!changed) {
+            // The panel already shows these pixels.
+        } else if (!pipelined) {
+            _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+        } else if (_start_send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes)) {
+            // Render the next subrectangle into the other buffer while this one goes out.
+            current_buffer ^= 1;
+            if (j + 1 < end_subrectangle) {
+                displayio_area_t next_subrectangle;
+                _get_subrectangle(&clipped, rows_per_buffer, j + 1, &next_subrectangle);
+                _fill_subrectangle(self, &next_subrectangle, mask, mask_length, buffers[current_buffer], buffer_size);
+                filled = true;
+            }
+            self->bus.finish_send(self->bus.bus);
+        }
         displayio_display_bus_end_transaction(&self->bus);
 
         // Run background tasks so they can run during an explicit refresh.
@@ -305,9 +472,54 @@ static bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         usb_background();
         #endif
     }
+    *next_subrectangle = end_subrectangle;
+    if (end_subrectangle < subrectangles) {
+        return false;
+    }
+    // Once the whole panel has been sent in order, the shadow matches it.
+    if (shadow && first_subrectangle == 0 && displayio_area_equal(&clipped, &self->core.area)) {
+        self->shadow_valid = true;
+    }
+    return true;
+}
+
+bool busdisplay_busdisplay_write_area(busdisplay_busdisplay_obj_t *self, displayio_area_t *area, uint8_t *pixels) {
+    if (!displayio_display_bus_is_free(&self->bus)) {
+        return false;
+    }
+    uint32_t length = displayio_area_size(area) * (self->core.colorspace.depth / 8);
+    displayio_display_bus_set_region_to_update(&self->bus, &self->core, area);
+    displayio_display_bus_begin_transaction(&self->bus);
+    _send_pixels(self, pixels, length);
+    displayio_display_bus_end_transaction(&self->bus);
     return true;
 }
 
+// Sends one subrectangle of a refresh started with blocking=False.
+static void _continue_background_refresh(busdisplay_busdisplay_obj_t *self) {
+    if (!_refresh_area(self, self->background_area, &self->background_subrectangle, 1)) {
+        return;
+    }
+    self->background_area = self->background_area->next;
+    self->background_subrectangle = 0;
+    if (self->background_area == NULL) {
+        supervisor_disable_tick();
+    }
+}
+
+static void _finish_background_refresh(busdisplay_busdisplay_obj_t *self) {
+    while (self->background_area != NULL) {
+        if (!displayio_display_bus_is_free(&self->bus)) {
+            // The bus is held by the caller so the rest of the frame would never go out.
+            self->background_area = NULL;
+            supervisor_disable_tick();
+            return;
+        }
+        _continue_background_refresh(self);
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
 static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
     if (!displayio_display_bus_is_free(&self->bus)) {
         // A refresh on this bus is already in progress.  Try next display.
@@ -316,12 +528,35 @@ static void _refresh_display(busdisplay_busdisplay_obj_t *self) {
     displayio_display_core_start_refresh(&self->core);
     const displayio_area_t *current_area = _get_refresh_areas(self);
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        uint16_t subrectangle = 0;
+        _refresh_area(self, current_area, &subrectangle, UINT16_MAX);
         current_area = current_area->next;
     }
     displayio_display_core_finish_refresh(&self->core);
 }
 
+// Takes the areas to refresh now and sends them from the background, a subrectangle at a
+// time. Each subrectangle is drawn from the group tree just before it is sent, so changes
+// made meanwhile may show up partially. They are also tracked for the next refresh.
+static void _start_background_refresh(busdisplay_busdisplay_obj_t *self) {
+    if (!displayio_display_core_start_refresh(&self->core)) {
+        return;
+    }
+    const displayio_area_t *areas = _get_refresh_areas(self);
+    if (areas == &self->core.area) {
+        displayio_area_copy(&self->core.area, &self->refresh_areas[0]);
+        self->refresh_areas[0].next = NULL;
+        areas = &self->refresh_areas[0];
+    }
+    displayio_display_core_finish_refresh(&self->core);
+    if (areas == NULL) {
+        return;
+    }
+    self->background_area = areas;
+    self->background_subrectangle = 0;
+    supervisor_enable_tick();
+}
+
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation) {
     bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
     bool will_transposed = (rotation == 90 || rotation == 270);
@@ -345,7 +580,9 @@ uint16_t common_hal_busdisplay_busdisplay_get_rotation(busdisplay_busdisplay_obj
 }
 
 
-bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame) {
+bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame, bool blocking) {
+    // Only one frame is sent at a time.
+    _finish_background_refresh(self);
     if (!self->auto_refresh && !self->first_manual_refresh && (target_ms_per_frame != NO_FPS_LIMIT)) {
         uint64_t current_time = supervisor_ticks_ms64();
         uint32_t current_ms_since_real_refresh = current_time - self->core.last_refresh;
@@ -366,10 +603,18 @@ bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self,
         }
     }
     self->first_manual_refresh = false;
-    _refresh_display(self);
+    if (blocking) {
+        _refresh_display(self);
+    } else {
+        _start_background_refresh(self);
+    }
     return true;
 }
 
+bool common_hal_busdisplay_busdisplay_get_refresh_in_progress(busdisplay_busdisplay_obj_t *self) {
+    return self->background_area != NULL;
+}
+
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self) {
     return self->auto_refresh;
 }
@@ -396,13 +641,70 @@ mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_o
 }
 
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
-    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
+    if (self->background_area != NULL) {
+        _continue_background_refresh(self);
+    } else if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
         _refresh_display(self);
     }
 }
 
+bool common_hal_busdisplay_busdisplay_get_pipelined_refresh(busdisplay_busdisplay_obj_t *self) {
+    return self->pipelined_refresh;
+}
+
+void common_hal_busdisplay_busdisplay_set_pipelined_refresh(busdisplay_busdisplay_obj_t *self,
+    bool pipelined_refresh) {
+    if (pipelined_refresh == self->pipelined_refresh) {
+        return;
+    }
+    self->pipelined_refresh = pipelined_refresh;
+    // The next refresh allocates the buffers the new setting needs.
+    self->pixel_buffers_failed = false;
+    if (self->pixel_buffers != NULL) {
+        port_free(self->pixel_buffers);
+        self->pixel_buffers = NULL;
+    }
+}
+
+bool common_hal_busdisplay_busdisplay_get_shadow_refresh(busdisplay_busdisplay_obj_t *self) {
+    return self->shadow_buffer != NULL;
+}
+
+void common_hal_busdisplay_busdisplay_set_shadow_refresh(busdisplay_busdisplay_obj_t *self,
+    bool shadow_refresh) {
+    if (shadow_refresh == (self->shadow_buffer != NULL)) {
+        return;
+    }
+    if (!shadow_refresh) {
+        port_free(self->shadow_buffer);
+        self->shadow_buffer = NULL;
+        return;
+    }
+    if (!_shadow_supported(self)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+    size_t size = self->core.area.x2 * (self->core.area.y2 / 8);
+    self->shadow_buffer = port_malloc(size, false);
+    if (self->shadow_buffer == NULL) {
+        m_malloc_fail(size);
+    }
+    // Panel memory is unknown until everything has been sent once.
+    self->shadow_valid = false;
+    self->core.full_refresh = true;
+}
+
 void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
+    if (self->background_area != NULL) {
+        self->background_area = NULL;
+        supervisor_disable_tick();
+    }
     common_hal_busdisplay_busdisplay_set_auto_refresh(self, false);
+    common_hal_busdisplay_busdisplay_set_pipelined_refresh(self, false);
+    common_hal_busdisplay_busdisplay_set_shadow_refresh(self, false);
+    if (self->pixel_buffers != NULL) {
+        port_free(self->pixel_buffers);
+        self->pixel_buffers = NULL;
+    }
     release_display_core(&self->core);
     #if (CIRCUITPY_PWMIO)
     if (self->backlight_pwm.base.type == &pwmio_pwmout_type) {
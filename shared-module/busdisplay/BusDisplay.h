@@ -16,6 +16,9 @@
 #include "shared-module/displayio/bus_core.h"
 #include "shared-module/displayio/display_core.h"
 
+// Maximum number of areas refreshed separately. More dirty areas than this are merged.
+#define BUSDISPLAY_REFRESH_AREA_COUNT (8)
+
 typedef struct {
     mp_obj_base_t base;
     displayio_display_core_t core;
@@ -26,6 +29,16 @@ typedef struct {
         pwmio_pwmout_obj_t backlight_pwm;
         #endif
     };
+    // Refresh buffers from the port heap. NULL until the first refresh that needs them.
+    uint32_t *pixel_buffers;
+    // Dirty areas after merging the ones that are cheaper to refresh together.
+    displayio_area_t refresh_areas[BUSDISPLAY_REFRESH_AREA_COUNT];
+    // Next area and subrectangle of a refresh started with blocking=False. NULL when idle.
+    const displayio_area_t *background_area;
+    uint16_t background_subrectangle;
+    // Copy of panel memory for page addressed monochrome panels, so that refreshes only send
+    // the bytes that changed. NULL when not enabled.
+    uint8_t *shadow_buffer;
     uint64_t last_refresh_call;
     mp_float_t current_brightness;
     uint16_t brightness_command;
@@ -35,9 +48,19 @@ typedef struct {
     bool auto_refresh;
     bool first_manual_refresh;
     bool backlight_on_high;
+    uint8_t pixel_buffer_count;
+    bool pipelined_refresh;
+    // Set when no refresh buffer fit, so that refreshes use the stack buffer without trying
+    // again. Cleared when pipelined_refresh changes.
+    bool pixel_buffers_failed;
+    bool shadow_valid;
 } busdisplay_busdisplay_obj_t;
 
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self);
 void release_busdisplay(busdisplay_busdisplay_obj_t *self);
 void reset_busdisplay(busdisplay_busdisplay_obj_t *self);
 void busdisplay_busdisplay_collect_ptrs(busdisplay_busdisplay_obj_t *self);
+// Sends pixels, already in the display's format, straight to an area in native display
+// coordinates, bypassing the root group. Only for colorspaces with whole bytes per pixel.
+// Returns false if the bus is in use.
+bool busdisplay_busdisplay_write_area(busdisplay_busdisplay_obj_t *self, displayio_area_t *area, uint8_t *pixels);
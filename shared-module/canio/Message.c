@@ -6,6 +6,7 @@
 
 #include "shared-module/canio/Message.h"
 #include "shared-bindings/canio/Message.h"
+#include "shared-bindings/canio/RemoteTransmissionRequest.h"
 
 #include <string.h>
 
@@ -48,3 +49,12 @@ bool common_hal_canio_message_get_extended(const canio_message_obj_t *self) {
 void common_hal_canio_message_set_extended(canio_message_obj_t *self, bool extended) {
     self->extended = extended;
 }
+
+mp_obj_t canio_message_new_from_record(const canio_message_record_t *record) {
+    bool rtr = record->flags & CANIO_MESSAGE_RECORD_RTR;
+    canio_message_obj_t *message =
+        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
+    common_hal_canio_message_construct(message, record->id, rtr ? NULL : (void *)record->data, record->size,
+        record->flags & CANIO_MESSAGE_RECORD_EXTENDED);
+    return message;
+}
@@ -15,3 +15,18 @@ typedef struct {
     size_t size : 4;
     bool extended : 1;
 } canio_message_obj_t;
+
+#define CANIO_MESSAGE_RECORD_EXTENDED (1 << 0)
+#define CANIO_MESSAGE_RECORD_RTR (1 << 1)
+
+// Layout of each message copied out by common_hal_canio_listener_receive_into().
+typedef struct {
+    uint32_t id;
+    uint8_t size;
+    uint8_t flags;
+    uint16_t reserved;
+    uint8_t data[8];
+    uint32_t timestamp;
+} canio_message_record_t;
+
+mp_obj_t canio_message_new_from_record(const canio_message_record_t *record);
@@ -0,0 +1,84 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "py/mpconfig.h"
+#include "shared-bindings/crc/CRC.h"
+
+static uint32_t reflect(uint32_t value, uint8_t width) {
+    uint32_t result = 0;
+    for (uint8_t i = 0; i < width; i++) {
+        result = (result << 1) | (value & 1);
+        value >>= 1;
+    }
+    return result;
+}
+
+void common_hal_crc_crc_construct(crc_crc_obj_t *self, uint8_t width, uint32_t poly, uint32_t init,
+    bool reflect_in, bool reflect_out, uint32_t xor_out) {
+    self->width = width;
+    self->poly = poly;
+    self->init = init;
+    self->reflect_in = reflect_in;
+    self->reflect_out = reflect_out;
+    self->xor_out = xor_out;
+
+    if (reflect_in) {
+        uint32_t reflected_poly = reflect(poly, width);
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; bit++) {
+                c = (c & 1) ? (c >> 1) ^ reflected_poly : c >> 1;
+            }
+            self->table[i] = c;
+        }
+    } else {
+        uint32_t top_poly = poly << (32 - width);
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i << 24;
+            for (int bit = 0; bit < 8; bit++) {
+                c = (c & 0x80000000) ? (c << 1) ^ top_poly : c << 1;
+            }
+            self->table[i] = c;
+        }
+    }
+    common_hal_crc_crc_reset(self);
+}
+
+void common_hal_crc_crc_reset(crc_crc_obj_t *self) {
+    self->reg = self->reflect_in ? reflect(self->init, self->width) : self->init << (32 - self->width);
+}
+
+MP_WEAK size_t common_hal_crc_crc_port_update(crc_crc_obj_t *self, const uint8_t *data, size_t len) {
+    return 0;
+}
+
+void common_hal_crc_crc_update(crc_crc_obj_t *self, const uint8_t *data, size_t len) {
+    size_t done = common_hal_crc_crc_port_update(self, data, len);
+    data += done;
+    len -= done;
+
+    uint32_t reg = self->reg;
+    const uint32_t *table = self->table;
+    if (self->reflect_in) {
+        while (len--) {
+            reg = (reg >> 8) ^ table[(reg ^ *data++) & 0xff];
+        }
+    } else {
+        while (len--) {
+            reg = (reg << 8) ^ table[(reg >> 24) ^ *data++];
+        }
+    }
+    self->reg = reg;
+}
+
+uint32_t common_hal_crc_crc_get_value(crc_crc_obj_t *self) {
+    // The register as the bits came in, most significant first.
+    uint32_t reg = self->reflect_in ? reflect(self->reg, self->width) : self->reg >> (32 - self->width);
+    if (self->reflect_out) {
+        reg = reflect(reg, self->width);
+    }
+    return reg ^ self->xor_out;
+}
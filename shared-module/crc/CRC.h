@@ -0,0 +1,27 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    uint32_t poly;
+    uint32_t init;
+    uint32_t xor_out;
+    // The running register. When reflect_in it is kept reflected, otherwise it is shifted up to
+    // the top of the 32 bits so that every width shares one table lookup.
+    uint32_t reg;
+    uint8_t width;
+    bool reflect_in;
+    bool reflect_out;
+    // The register change for each byte, in the same form as reg.
+    uint32_t table[256];
+} crc_crc_obj_t;
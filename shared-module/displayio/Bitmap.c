@@ -10,6 +10,36 @@
 
 #include "py/runtime.h"
 #include "py/gc.h"
+#include "supervisor/port_heap.h"
+
+#if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+// While a display refreshes, blocks of one large bitmap in external RAM are copied into internal
+// RAM as they are drawn. Rotated displays read bitmaps a few columns at a time, so each row of a
+// block is otherwise fetched again for every area of the refresh. The blocks are forgotten once
+// the refresh is done, so nothing written between refreshes is missed.
+#define BITMAP_CACHE_BLOCK_SHIFT (4)
+#define BITMAP_CACHE_BLOCK_SIZE (1 << BITMAP_CACHE_BLOCK_SHIFT)
+
+static struct {
+    // Points to the tag of each slot, followed by the slots themselves.
+    uint32_t *storage;
+    displayio_bitmap_t *bitmap;
+    uint32_t *blocks;
+    uint32_t slot_count;
+    uint16_t blocks_per_row;
+    // Rows of a block are stored like bitmap rows, padded to whole words.
+    uint8_t block_stride;
+} bitmap_cache;
+
+static void bitmap_cache_forget(displayio_bitmap_t *self) {
+    if (bitmap_cache.bitmap == self) {
+        bitmap_cache.bitmap = NULL;
+    }
+}
+#else
+static inline void bitmap_cache_forget(displayio_bitmap_t *self) {
+}
+#endif
 
 enum { ALIGN_BITS = 8 * sizeof(uint32_t) };
 
@@ -35,6 +65,12 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
         self->data_alloc = true;
     }
     self->data = data;
+    #if MICROPY_GC_MOVABLE
+    if (self->data_alloc) {
+        // Everything reaches the pixels through self->data, so gc.compact() may move them.
+        gc_movable_add((void **)&self->data);
+    }
+    #endif
     self->read_only = read_only;
     self->bits_per_value = bits_per_value;
 
@@ -63,7 +99,11 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
+    bitmap_cache_forget(self);
     if (self->data_alloc) {
+        #if MICROPY_GC_MOVABLE
+        gc_movable_remove((void **)&self->data);
+        #endif
         gc_free(self->data);
     }
     self->data = NULL;
@@ -85,12 +125,8 @@ uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self
     return self->bits_per_value;
 }
 
-uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
-    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
-        return 0;
-    }
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
+// Reads pixel x of a row laid out like the bitmap's own rows.
+static inline uint32_t read_pixel(displayio_bitmap_t *self, const uint32_t *row, int16_t x) {
     uint8_t bytes_per_value = self->bits_per_value / 8;
     uint8_t values_per_byte = 8 / self->bits_per_value;
     if (bytes_per_value < 1) {
@@ -109,11 +145,103 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     return 0;
 }
 
+uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t x, int16_t y) {
+    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
+        return 0;
+    }
+    return read_pixel(self, self->data + y * self->stride, x);
+}
+
+#if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+static uint32_t gcd(uint32_t a, uint32_t b) {
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+bool displayio_bitmap_cache_wanted(displayio_bitmap_t *self) {
+    if (bitmap_cache.bitmap == self) {
+        return true;
+    }
+    // Small bitmaps stay in the CPU's own cache, and bitmaps in internal RAM are fast already.
+    if (self->stride * self->height * sizeof(uint32_t) <= CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE ||
+        !port_ptr_in_external_ram(self->data)) {
+        return false;
+    }
+    if (bitmap_cache.storage == NULL) {
+        // Ask for internal RAM.
+        bitmap_cache.storage = port_malloc(CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE, true);
+        if (bitmap_cache.storage == NULL) {
+            return false;
+        }
+    }
+    uint32_t block_stride = (BITMAP_CACHE_BLOCK_SIZE * self->bits_per_value + 31) / 32;
+    uint32_t slot_words = 1 + BITMAP_CACHE_BLOCK_SIZE * block_stride;
+    uint32_t blocks_per_row = (self->width + BITMAP_CACHE_BLOCK_SIZE - 1) / BITMAP_CACHE_BLOCK_SIZE;
+    uint32_t slot_count = CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE / sizeof(uint32_t) / slot_words;
+    // Blocks map to slot (block_y * blocks_per_row + block_x) % slot_count. Keeping the two
+    // coprime lets a column of blocks use as many different slots as a row of them.
+    while (slot_count > 1 && gcd(slot_count, blocks_per_row) != 1) {
+        slot_count--;
+    }
+    bitmap_cache.bitmap = self;
+    bitmap_cache.blocks = bitmap_cache.storage + slot_count;
+    bitmap_cache.slot_count = slot_count;
+    bitmap_cache.blocks_per_row = blocks_per_row;
+    bitmap_cache.block_stride = block_stride;
+    // Tags are block numbers plus one, so zero is an empty slot.
+    memset(bitmap_cache.storage, 0, slot_count * sizeof(uint32_t));
+    return true;
+}
+
+uint32_t displayio_bitmap_get_pixel_cached(displayio_bitmap_t *self, int16_t x, int16_t y) {
+    if (bitmap_cache.bitmap != self) {
+        return common_hal_displayio_bitmap_get_pixel(self, x, y);
+    }
+    if (x >= self->width || x < 0 || y >= self->height || y < 0) {
+        return 0;
+    }
+    uint32_t block_x = x >> BITMAP_CACHE_BLOCK_SHIFT;
+    uint32_t block_y = y >> BITMAP_CACHE_BLOCK_SHIFT;
+    uint32_t block = block_y * bitmap_cache.blocks_per_row + block_x;
+    uint32_t slot = block % bitmap_cache.slot_count;
+    uint32_t *rows = bitmap_cache.blocks + slot * BITMAP_CACHE_BLOCK_SIZE * bitmap_cache.block_stride;
+    if (bitmap_cache.storage[slot] != block + 1) {
+        // The slot's rows are padded to words but a 1 bit block is only two bytes wide.
+        size_t row_bytes = BITMAP_CACHE_BLOCK_SIZE * self->bits_per_value / 8;
+        size_t first_byte = block_x * row_bytes;
+        // Don't read past the end of the bitmap's last row.
+        size_t copy_bytes = MIN(row_bytes, self->stride * sizeof(uint32_t) - first_byte);
+        uint32_t first_row = block_y * BITMAP_CACHE_BLOCK_SIZE;
+        uint32_t row_count = MIN(BITMAP_CACHE_BLOCK_SIZE, self->height - first_row);
+        for (uint32_t i = 0; i < row_count; i++) {
+            memcpy(rows + i * bitmap_cache.block_stride,
+                (uint8_t *)(self->data + (first_row + i) * self->stride) + first_byte, copy_bytes);
+        }
+        bitmap_cache.storage[slot] = block + 1;
+    }
+    uint32_t *row = rows + (y & (BITMAP_CACHE_BLOCK_SIZE - 1)) * bitmap_cache.block_stride;
+    return read_pixel(self, row, x & (BITMAP_CACHE_BLOCK_SIZE - 1));
+}
+
+void displayio_bitmap_cache_reset(void) {
+    if (bitmap_cache.storage != NULL) {
+        port_free(bitmap_cache.storage);
+        bitmap_cache.storage = NULL;
+    }
+    bitmap_cache.bitmap = NULL;
+}
+#endif
+
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *dirty_area) {
     if (self->read_only) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
     }
 
+    bitmap_cache_forget(self);
     displayio_area_t area = *dirty_area;
     displayio_area_canon(&area);
     displayio_area_union(&area, &self->dirty_area, &area);
@@ -177,6 +305,7 @@ displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, d
 }
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
+    bitmap_cache_forget(self);
     if (self->read_only) {
         return;
     }
@@ -206,6 +335,10 @@ int common_hal_displayio_bitmap_get_buffer(displayio_bitmap_t *self, mp_buffer_i
     if ((flags & MP_BUFFER_WRITE) && self->read_only) {
         return 1;
     }
+    #if MICROPY_GC_MOVABLE
+    // Whoever asked may keep the pointer, such as in a memoryview.
+    gc_movable_remove((void **)&self->data);
+    #endif
     bufinfo->len = self->stride * self->height * sizeof(uint32_t);
     bufinfo->buf = self->data;
     switch (self->bits_per_value) {
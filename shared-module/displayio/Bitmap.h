@@ -31,3 +31,11 @@ void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
+
+#if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+// Starts caching self's blocks until its refresh finishes, if it is worth it and self can be
+// cached. Returns whether displayio_bitmap_get_pixel_cached() should be used for self.
+bool displayio_bitmap_cache_wanted(displayio_bitmap_t *self);
+uint32_t displayio_bitmap_get_pixel_cached(displayio_bitmap_t *self, int16_t x, int16_t y);
+void displayio_bitmap_cache_reset(void);
+#endif
@@ -9,8 +9,6 @@
 #include "py/misc.h"
 #include "py/runtime.h"
 
-#define NO_TRANSPARENT_COLOR (0x1000000)
-
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n) {
     n = (n >> 13) ^ n;
     int nn = (n * (n * n * 60493 + 19990303) + 1376312589) & 0x7fffffff;
@@ -26,6 +24,7 @@ void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t *s
     self->transparent_color = NO_TRANSPARENT_COLOR;
     self->input_colorspace = input_colorspace;
     self->output_colorspace.depth = 16;
+    self->convert_fun_colorspace = NULL;
 }
 
 uint16_t displayio_colorconverter_compute_rgb565(uint32_t color_rgb888) {
@@ -193,6 +192,7 @@ void common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *sel
 
 void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t *self, bool dither) {
     self->dither = dither;
+    self->convert_fun_colorspace = NULL;
 }
 
 bool common_hal_displayio_colorconverter_get_dither(displayio_colorconverter_t *self) {
@@ -357,14 +357,28 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
-void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
-    uint32_t pixel = input_pixel->pixel;
+// 16-bit input that already matches the 16-bit output, other than byte order.
+static void _convert_rgb565_copy(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    output_color->pixel = input_pixel->pixel & 0xffff;
+    output_color->opaque = true;
+}
 
-    if (self->transparent_color == pixel) {
-        output_color->opaque = false;
-        return;
-    }
+static void _convert_rgb565_swap(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    output_color->pixel = __builtin_bswap16(input_pixel->pixel);
+    output_color->opaque = true;
+}
+
+static void _convert_rgb888_to_rgb565(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    output_color->pixel = displayio_colorconverter_compute_rgb565(input_pixel->pixel);
+    output_color->opaque = true;
+}
+
+static void _convert_rgb888_to_rgb565_swapped(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    output_color->pixel = __builtin_bswap16(displayio_colorconverter_compute_rgb565(input_pixel->pixel));
+    output_color->opaque = true;
+}
 
+static void _convert_any(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     if (!self->dither && self->cached_colorspace == colorspace && self->cached_input_pixel == input_pixel->pixel) {
         output_color->pixel = self->cached_output_color;
         return;
@@ -381,6 +395,38 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
     }
 }
 
+static displayio_colorconverter_convert_fun _select_convert_fun(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    if (self->dither || colorspace->depth != 16) {
+        return _convert_any;
+    }
+    bool swap_output = colorspace->reverse_bytes_in_word;
+    switch (self->input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+            return swap_output ? _convert_rgb565_swap : _convert_rgb565_copy;
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            return swap_output ? _convert_rgb565_copy : _convert_rgb565_swap;
+        case DISPLAYIO_COLORSPACE_RGB888:
+            return swap_output ? _convert_rgb888_to_rgb565_swapped : _convert_rgb888_to_rgb565;
+        default:
+            return _convert_any;
+    }
+}
+
+void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
+    uint32_t pixel = input_pixel->pixel;
+
+    if (self->transparent_color == pixel) {
+        output_color->opaque = false;
+        return;
+    }
+
+    if (self->convert_fun_colorspace != colorspace) {
+        self->convert_fun = _select_convert_fun(self, colorspace);
+        self->convert_fun_colorspace = colorspace;
+    }
+    self->convert_fun(self, colorspace, input_pixel, output_color);
+}
+
 
 
 // Currently no refresh logic is needed for a ColorConverter.
@@ -12,6 +12,12 @@
 #include "py/obj.h"
 #include "shared-module/displayio/Palette.h"
 
+#define NO_TRANSPARENT_COLOR (0x1000000)
+
+struct displayio_colorconverter;
+
+typedef void (*displayio_colorconverter_convert_fun)(struct displayio_colorconverter *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+
 typedef struct displayio_colorconverter {
     mp_obj_base_t base;
     bool dither;
@@ -23,6 +29,10 @@ typedef struct displayio_colorconverter {
     const _displayio_colorspace_t *cached_colorspace;
     uint32_t cached_input_pixel;
     uint32_t cached_output_color;
+
+    // Conversion specialized for the input colorspace, dither setting and this output colorspace.
+    const _displayio_colorspace_t *convert_fun_colorspace;
+    displayio_colorconverter_convert_fun convert_fun;
 } displayio_colorconverter_t;
 
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
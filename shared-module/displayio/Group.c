@@ -35,6 +35,7 @@ void common_hal_displayio_group_set_hidden(displayio_group_t *self, bool hidden)
     }
     check_readonly(self);
     self->hidden = hidden;
+    self->bounds_valid = false;
     if (self->hidden_by_parent) {
         return;
     }
@@ -189,6 +190,7 @@ void displayio_group_update_transform(displayio_group_t *self,
 
         self->absolute_transform.scale = parent_transform->scale * self->scale;
     }
+    self->bounds_valid = false;
     _update_child_transforms(self);
 }
 
@@ -202,6 +204,7 @@ void common_hal_displayio_group_set_scale(displayio_group_t *self, uint32_t scal
     self->absolute_transform.dy = self->absolute_transform.dy / self->scale * scale;
     self->absolute_transform.scale = parent_scale * scale;
     self->scale = scale;
+    self->bounds_valid = false;
     _update_child_transforms(self);
 }
 
@@ -223,6 +226,7 @@ void common_hal_displayio_group_set_x(displayio_group_t *self, mp_int_t x) {
     }
 
     self->x = x;
+    self->bounds_valid = false;
     _update_child_transforms(self);
 }
 
@@ -243,11 +247,13 @@ void common_hal_displayio_group_set_y(displayio_group_t *self, mp_int_t y) {
         self->absolute_transform.y += dy * (y - self->y);
     }
     self->y = y;
+    self->bounds_valid = false;
     _update_child_transforms(self);
 }
 
 static void _add_layer(displayio_group_t *self, mp_obj_t layer) {
     check_readonly(self);
+    self->bounds_valid = false;
     #if CIRCUITPY_VECTORIO
     const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, layer);
     if (draw_protocol != NULL) {
@@ -290,6 +296,7 @@ static void _add_layer(displayio_group_t *self, mp_obj_t layer) {
 
 static void _remove_layer(displayio_group_t *self, size_t index) {
     check_readonly(self);
+    self->bounds_valid = false;
     mp_obj_t layer;
     displayio_area_t layer_area;
     bool rendered_last_frame = false;
@@ -369,12 +376,113 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->scale = scale;
     self->in_group = false;
     self->readonly = false;
+    self->bounds_valid = false;
+}
+
+// The group tree doubles as a bounding volume hierarchy. Each group caches the union of its
+// members' areas so fill_area can skip whole subtrees that don't touch the area being refreshed.
+// Children don't tell their parent when they move so the cache only lives for one refresh.
+static void _update_bounds(displayio_group_t *self) {
+    self->unbounded = false;
+    self->bounds.x1 = 0;
+    self->bounds.y1 = 0;
+    self->bounds.x2 = 0;
+    self->bounds.y2 = 0;
+    for (size_t i = 0; i < self->members->len; i++) {
+        mp_obj_t layer;
+        #if CIRCUITPY_VECTORIO
+        if (mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]) != NULL) {
+            self->unbounded = true;
+            continue;
+        }
+        #endif
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_t *tilegrid = layer;
+            displayio_area_union(&self->bounds, &tilegrid->current_area, &self->bounds);
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_group_t *group = layer;
+            if (!group->bounds_valid) {
+                _update_bounds(group);
+            }
+            self->unbounded = self->unbounded || group->unbounded;
+            displayio_area_union(&self->bounds, &group->bounds, &self->bounds);
+            continue;
+        }
+    }
+    self->bounds_valid = true;
+}
+
+static bool _may_overlap(displayio_group_t *self, const displayio_area_t *area) {
+    if (!self->bounds_valid) {
+        _update_bounds(self);
+    }
+    if (self->unbounded) {
+        return true;
+    }
+    displayio_area_t overlap;
+    return displayio_area_compute_overlap(&self->bounds, area, &overlap);
+}
+
+// Returns the topmost visible member that covers point, which is in display coordinates.
+static mp_obj_t _hit_test(displayio_group_t *self, const displayio_area_t *point) {
+    displayio_area_t overlap;
+    for (int32_t i = self->members->len - 1; i >= 0; i--) {
+        mp_obj_t layer;
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_tilegrid_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_tilegrid_t *tilegrid = layer;
+            if (!tilegrid->hidden && displayio_area_compute_overlap(&tilegrid->current_area, point, &overlap)) {
+                return self->members->items[i];
+            }
+            continue;
+        }
+        layer = mp_obj_cast_to_native_base(
+            self->members->items[i], &displayio_group_type);
+        if (layer != MP_OBJ_NULL) {
+            displayio_group_t *group = layer;
+            if (!group->hidden && _hit_test(group, point) != MP_OBJ_NULL) {
+                return self->members->items[i];
+            }
+            continue;
+        }
+    }
+    return MP_OBJ_NULL;
+}
+
+mp_obj_t common_hal_displayio_group_hit_test(displayio_group_t *self, mp_int_t x, mp_int_t y) {
+    if (!self->in_group || self->hidden || self->hidden_by_parent) {
+        return mp_const_none;
+    }
+    // Map the pixel into display coordinates the same way TileGrid computes current_area.
+    const displayio_buffer_transform_t *t = &self->absolute_transform;
+    displayio_area_t point;
+    if (t->transpose_xy) {
+        point.x1 = t->x + t->dx * y;
+        point.x2 = t->x + t->dx * (y + 1);
+        point.y1 = t->y + t->dy * x;
+        point.y2 = t->y + t->dy * (x + 1);
+    } else {
+        point.x1 = t->x + t->dx * x;
+        point.x2 = t->x + t->dx * (x + 1);
+        point.y1 = t->y + t->dy * y;
+        point.y2 = t->y + t->dy * (y + 1);
+    }
+    displayio_area_canon(&point);
+    mp_obj_t hit = _hit_test(self, &point);
+    return hit == MP_OBJ_NULL ? mp_const_none : hit;
 }
 
 bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
-    if (self->hidden == false) {
+    if (self->hidden == false && _may_overlap(self, area)) {
         for (int32_t i = self->members->len - 1; i >= 0; i--) {
             mp_obj_t layer;
             #if CIRCUITPY_VECTORIO
@@ -410,6 +518,7 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
 
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
+    self->bounds_valid = false;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
         mp_obj_t layer;
         #if CIRCUITPY_VECTORIO
@@ -436,6 +545,7 @@ void displayio_group_finish_refresh(displayio_group_t *self) {
 }
 
 displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_t *tail) {
+    self->bounds_valid = false;
     if (self->item_removed) {
         self->dirty_area.next = tail;
         tail = &self->dirty_area;
@@ -19,6 +19,7 @@ typedef struct {
     mp_obj_list_t *members;
     displayio_buffer_transform_t absolute_transform;
     displayio_area_t dirty_area; // Catch all for changed area
+    displayio_area_t bounds; // Union of all member areas. Only valid when bounds_valid is set.
     int16_t x;
     int16_t y;
     uint16_t scale;
@@ -27,7 +28,10 @@ typedef struct {
     bool hidden : 1;
     bool hidden_by_parent : 1;
     bool readonly : 1;
-    uint8_t padding : 3;
+    bool bounds_valid : 1;
+    // Set when a member's area isn't known (vectorio shapes) so bounds can't be used for culling.
+    bool unbounded : 1;
+    uint8_t padding : 1;
 } displayio_group_t;
 
 void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members, uint32_t scale, mp_int_t x, mp_int_t y);
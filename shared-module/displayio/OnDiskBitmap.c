@@ -25,7 +25,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cache_rows) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -158,6 +158,36 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->row_cache = NULL;
+    self->cache_rows = MIN(cache_rows, self->height);
+    self->cache_valid_rows = 0;
+    self->cache_first_row = 0;
+    if (self->cache_rows > 0) {
+        self->row_cache = m_malloc_without_collect(self->cache_rows * self->stride);
+    }
+}
+
+// Fill the row cache so that it contains display row y, reading ahead in the
+// direction rows are being requested. BMP rows are stored bottom up so the
+// cached rows are one contiguous read.
+static bool ondiskbitmap_load_rows(displayio_ondiskbitmap_t *self, int16_t y) {
+    int32_t first_row = y;
+    if (self->cache_valid_rows > 0 && y < self->cache_first_row) {
+        first_row = MAX(0, y - self->cache_rows + 1);
+    }
+    uint16_t row_count = MIN(self->cache_rows, self->height - first_row);
+    uint32_t location = self->data_offset + (self->height - first_row - row_count) * self->stride;
+    uint32_t length = row_count * self->stride;
+
+    self->cache_valid_rows = 0;
+    f_lseek(&self->file->fp, location);
+    UINT bytes_read;
+    if (f_read(&self->file->fp, self->row_cache, length, &bytes_read) != FR_OK || bytes_read != length) {
+        return false;
+    }
+    self->cache_first_row = first_row;
+    self->cache_valid_rows = row_count;
+    return true;
 }
 
 
@@ -171,15 +201,28 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
     if (pixels_per_byte == 0) {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        location = x * bytes_per_pixel;
     } else {
-        location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
+        location = x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
-    f_lseek(&self->file->fp, location);
-    UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    uint32_t result = FR_OK;
+    bool cached = self->cache_valid_rows > 0 &&
+        y >= self->cache_first_row && y < self->cache_first_row + self->cache_valid_rows;
+    if (!cached && self->cache_rows > 0) {
+        cached = ondiskbitmap_load_rows(self, y);
+    }
+    if (cached) {
+        // Cached rows are in file order so the last one is display row cache_first_row.
+        uint16_t cache_index = self->cache_valid_rows - 1 - (y - self->cache_first_row);
+        memcpy(&pixel_data, self->row_cache + cache_index * self->stride + location, bytes_per_pixel);
+    } else {
+        // Without a row cache we rely on the underlying FS caching sectors.
+        location += self->data_offset + (self->height - y - 1) * self->stride;
+        f_lseek(&self->file->fp, location);
+        UINT bytes_read;
+        result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
+    }
     if (result == FR_OK) {
         uint32_t tmp = 0;
         uint8_t red;
@@ -23,6 +23,11 @@ typedef struct {
     uint32_t g_bitmask;
     uint32_t b_bitmask;
     pyb_file_obj_t *file;
+    // Raw file rows for display rows cache_first_row .. cache_first_row + cache_valid_rows - 1.
+    uint8_t *row_cache;
+    uint16_t cache_rows;
+    uint16_t cache_valid_rows;
+    int32_t cache_first_row;
     union {
         mp_obj_base_t *pixel_shader_base;
         struct displayio_palette *palette;
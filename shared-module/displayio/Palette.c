@@ -12,6 +12,12 @@ void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc_without_collect(color_count * sizeof(_displayio_color_t));
     self->dither = dither;
+    for (uint16_t i = 0; i < color_count; i++) {
+        self->colors[i].cached_epoch = 0;
+    }
+    self->cached_colorspace = NULL;
+    self->cache_epoch = 1;
+    self->generation = 0;
 }
 
 void common_hal_displayio_palette_set_dither(displayio_palette_t *self, bool dither) {
@@ -24,11 +30,13 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = false;
+    self->generation++;
     self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
+    self->generation++;
     self->needs_refresh = true;
 }
 
@@ -45,7 +53,8 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
         return;
     }
     self->colors[palette_index].rgb888 = color;
-    self->colors[palette_index].cached_colorspace = NULL;
+    self->colors[palette_index].cached_epoch = 0;
+    self->generation++;
     self->needs_refresh = true;
 }
 
@@ -53,34 +62,53 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
     return self->colors[palette_index].rgb888;
 }
 
+// Invalidate every cached color at once by starting a new epoch for the given colorspace.
+static void _set_cached_colorspace(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    self->cache_epoch++;
+    if (self->cache_epoch == 0) {
+        // Colors from 65536 epochs ago would match again.
+        for (uint32_t i = 0; i < self->color_count; i++) {
+            self->colors[i].cached_epoch = 0;
+        }
+        self->cache_epoch = 1;
+    }
+    self->cached_colorspace = colorspace;
+    self->cached_colorspace_grayscale = colorspace->grayscale;
+    self->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+}
+
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
+    if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
         output_color->opaque = false;
         return;
     }
 
-    // Cache results when not dithering.
-    _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
-        color->cached_colorspace == colorspace &&
-        color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
-        color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+    // Dithering depends on the pixel location so it can't be cached.
+    if (self->dither) {
+        displayio_input_pixel_t rgb888_pixel = *input_pixel;
+        rgb888_pixel.pixel = self->colors[palette_index].rgb888;
+        displayio_convert_color(colorspace, true, &rgb888_pixel, output_color);
         return;
     }
 
-    displayio_input_pixel_t rgb888_pixel = *input_pixel;
-    rgb888_pixel.pixel = self->colors[palette_index].rgb888;
-    displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
-        color->cached_colorspace = colorspace;
-        color->cached_color = output_color->pixel;
-        color->cached_colorspace_grayscale = colorspace->grayscale;
-        color->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+    if (self->cached_colorspace != colorspace ||
+        self->cached_colorspace_grayscale_bit != colorspace->grayscale_bit ||
+        self->cached_colorspace_grayscale != colorspace->grayscale) {
+        _set_cached_colorspace(self, colorspace);
+    }
+    _displayio_color_t *color = &self->colors[palette_index];
+    if (color->cached_epoch != self->cache_epoch) {
+        displayio_input_pixel_t rgb888_pixel = {0};
+        displayio_output_pixel_t converted = {.pixel = 0, .opaque = true};
+        rgb888_pixel.pixel = color->rgb888;
+        displayio_convert_color(colorspace, false, &rgb888_pixel, &converted);
+        color->cached_color = converted.pixel;
+        color->cached_opaque = converted.opaque;
+        color->cached_epoch = self->cache_epoch;
     }
+    output_color->pixel = color->cached_color;
+    output_color->opaque = color->cached_opaque;
 }
 
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
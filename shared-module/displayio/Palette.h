@@ -29,10 +29,9 @@ typedef struct {
 
 typedef struct {
     uint32_t rgb888;
-    const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_color;
-    uint8_t cached_colorspace_grayscale_bit;
-    bool cached_colorspace_grayscale;
+    uint32_t cached_color; // rgb888 converted to the palette's cached colorspace.
+    uint16_t cached_epoch; // Matches the palette's cache_epoch when cached_color is current.
+    bool cached_opaque;
     bool transparent; // This may have additional bits added later for blending.
 } _displayio_color_t;
 
@@ -54,6 +53,17 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    // The colorspace that colors are cached in. The grayscale settings are kept too because
+    // EPaperDisplay changes them on the same object. Changing it only bumps cache_epoch, and
+    // each color is converted again when it is next used, so palettes shown on displays with
+    // different colorspaces don't convert the whole table on each switch.
+    const _displayio_colorspace_t *cached_colorspace;
+    uint8_t cached_colorspace_grayscale_bit;
+    bool cached_colorspace_grayscale;
+    uint16_t cache_epoch;
+    // Bumped whenever a color or its transparency changes so users can tell when to recompute
+    // colors they derived from the palette.
+    uint16_t generation;
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
@@ -285,31 +285,71 @@ uint16_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint
     }
 }
 
-void displayio_tilegrid_mark_tile_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
-    displayio_area_t temp_area;
-    displayio_area_t *tile_area;
+// Adds a pixel area, relative to the grid, to the dirty areas. It grows the dirty area that
+// gains the fewest pixels unless it is apart from all of them and a free slot remains. That
+// way changes in opposite corners don't repaint everything between them.
+static void _mark_area_dirty(displayio_tilegrid_t *self, const displayio_area_t *area) {
     if (!self->partial_change) {
-        tile_area = &self->dirty_area;
-    } else {
-        tile_area = &temp_area;
+        displayio_area_copy_coords(area, &self->dirty_areas[0]);
+        self->dirty_area_count = 1;
+        self->partial_change = true;
+        return;
+    }
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+        displayio_area_t merged;
+        displayio_area_union(&self->dirty_areas[i], area, &merged);
+        uint32_t growth = displayio_area_size(&merged) - displayio_area_size(&self->dirty_areas[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    if (best_growth == 0) {
+        return;
     }
+    if (best_growth > displayio_area_size(area) && self->dirty_area_count < TILEGRID_DIRTY_AREA_COUNT) {
+        displayio_area_copy_coords(area, &self->dirty_areas[self->dirty_area_count]);
+        self->dirty_area_count++;
+        return;
+    }
+    displayio_area_union(&self->dirty_areas[best], area, &self->dirty_areas[best]);
+}
+
+// Marks count tiles of a row dirty. tx and ty are relative to the top left tile and the run
+// must not wrap.
+static void _mark_tiles_dirty(displayio_tilegrid_t *self, int16_t tx, int16_t ty, uint16_t count) {
+    displayio_area_t tile_area;
+    tile_area.x1 = tx * self->tile_width;
+    tile_area.x2 = tile_area.x1 + count * self->tile_width;
+    tile_area.y1 = ty * self->tile_height;
+    tile_area.y2 = tile_area.y1 + self->tile_height;
+    _mark_area_dirty(self, &tile_area);
+}
+
+static int16_t _relative_tile_x(displayio_tilegrid_t *self, uint16_t x) {
     int16_t tx = (x - self->top_left_x) % self->width_in_tiles;
     if (tx < 0) {
         tx += self->width_in_tiles;
     }
-    tile_area->x1 = tx * self->tile_width;
-    tile_area->x2 = tile_area->x1 + self->tile_width;
+    return tx;
+}
+
+static int16_t _relative_tile_y(displayio_tilegrid_t *self, uint16_t y) {
     int16_t ty = (y - self->top_left_y) % self->height_in_tiles;
     if (ty < 0) {
         ty += self->height_in_tiles;
     }
-    tile_area->y1 = ty * self->tile_height;
-    tile_area->y2 = tile_area->y1 + self->tile_height;
+    return ty;
+}
 
-    if (self->partial_change) {
-        displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
+void displayio_tilegrid_mark_tile_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    if (self->full_change) {
+        // The whole grid is already going to be redrawn.
+        return;
     }
-    self->partial_change = true;
+    _mark_tiles_dirty(self, _relative_tile_x(self, x), _relative_tile_y(self, y), 1);
 }
 
 void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint16_t tile_index) {
@@ -334,6 +374,44 @@ void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t
     displayio_tilegrid_mark_tile_dirty(self, x, y);
 }
 
+void displayio_tilegrid_set_tiles_in_row(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count) {
+    void *tiles = self->tiles;
+    if (self->inline_tiles) {
+        tiles = &self->tiles;
+    }
+    if (tiles == NULL || count == 0) {
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        if (tile_indices[i] >= self->tiles_in_bitmap) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
+        }
+    }
+
+    uint32_t index = y * self->width_in_tiles + x;
+    if (self->tiles_in_bitmap > 255) {
+        uint16_t *tiles16 = (uint16_t *)tiles + index;
+        for (uint16_t i = 0; i < count; i++) {
+            tiles16[i] = tile_indices[i];
+        }
+    } else {
+        memcpy((uint8_t *)tiles + index, tile_indices, count);
+    }
+
+    if (self->full_change) {
+        return;
+    }
+    // The tiles are contiguous on screen unless the row wraps around top_left_x.
+    int16_t tx = _relative_tile_x(self, x);
+    if (tx + count <= self->width_in_tiles) {
+        _mark_tiles_dirty(self, tx, _relative_tile_y(self, y), count);
+    } else {
+        for (uint16_t i = 0; i < count; i++) {
+            displayio_tilegrid_mark_tile_dirty(self, x + i, y);
+        }
+    }
+}
+
 void common_hal_displayio_tilegrid_set_all_tiles(displayio_tilegrid_t *self, uint16_t tile_index) {
     if (tile_index >= self->tiles_in_bitmap) {
         mp_raise_ValueError(MP_ERROR_TEXT("Tile index out of bounds"));
@@ -425,6 +503,105 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// Returns true when the bitmap's 16-bit values can be copied straight into a 16-bit buffer
+// without going through the pixel shader. swap is set when each value needs its bytes swapped.
+static bool _can_copy_rgb565(displayio_tilegrid_t *self, const _displayio_colorspace_t *colorspace, bool *swap) {
+    if (colorspace->depth != 16 ||
+        self->absolute_transform->scale != 1 ||
+        !mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        return false;
+    }
+    displayio_bitmap_t *bitmap = self->bitmap;
+    if (bitmap->bits_per_value != 16 ||
+        bitmap->width < self->bitmap_width_in_tiles * self->tile_width ||
+        bitmap->height < (self->tiles_in_bitmap / self->bitmap_width_in_tiles) * self->tile_height) {
+        return false;
+    }
+    if (self->pixel_shader == mp_const_none) {
+        *swap = false;
+        return true;
+    }
+    if (!mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        return false;
+    }
+    displayio_colorconverter_t *converter = self->pixel_shader;
+    if (converter->dither || converter->transparent_color != NO_TRANSPARENT_COLOR) {
+        return false;
+    }
+    // RGB565 round trips through RGB888 unchanged so only the byte order matters.
+    if (converter->input_colorspace == DISPLAYIO_COLORSPACE_RGB565) {
+        *swap = colorspace->reverse_bytes_in_word;
+    } else if (converter->input_colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) {
+        *swap = !colorspace->reverse_bytes_in_word;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Copies count pixels from src into the buffer starting at offset, skipping pixels already set
+// in the mask. Runs that are clear in the mask are copied a mask word at a time.
+static void _copy_rgb565_span(const uint16_t *src, uint16_t *buffer, uint32_t *mask,
+    uint32_t offset, uint32_t count, bool swap) {
+    while (count > 0) {
+        uint32_t shift = offset % 32;
+        uint32_t n = MIN(32 - shift, count);
+        uint32_t bits = (n == 32 ? 0xffffffff : ((1u << n) - 1)) << shift;
+        uint32_t *mask_word = &mask[offset / 32];
+        uint16_t *dest = buffer + offset;
+        if ((*mask_word & bits) == 0) {
+            if (swap) {
+                for (uint32_t i = 0; i < n; i++) {
+                    dest[i] = __builtin_bswap16(src[i]);
+                }
+            } else {
+                memcpy(dest, src, n * sizeof(uint16_t));
+            }
+        } else {
+            for (uint32_t i = 0; i < n; i++) {
+                if ((*mask_word & (1u << (shift + i))) == 0) {
+                    dest[i] = swap ? __builtin_bswap16(src[i]) : src[i];
+                }
+            }
+        }
+        *mask_word |= bits;
+        src += n;
+        offset += n;
+        count -= n;
+    }
+}
+
+// Fast path for untransformed 16-bit bitmaps. Copies each row a tile span at a time.
+static void _fill_rgb565_rows(displayio_tilegrid_t *self, void *tiles, bool swap,
+    int16_t start_x, int16_t end_x, int16_t start_y, int16_t end_y,
+    uint32_t first_offset, uint32_t row_stride, uint32_t *mask, uint32_t *buffer) {
+    displayio_bitmap_t *bitmap = self->bitmap;
+    for (int16_t y = start_y; y < end_y; y++) {
+        uint32_t offset = first_offset + (y - start_y) * row_stride;
+        uint16_t y_tile_index = (y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+        uint16_t y_in_tile = y % self->tile_height;
+        int16_t x = start_x;
+        while (x < end_x) {
+            uint16_t x_tile_index = (x / self->tile_width + self->top_left_x) % self->width_in_tiles;
+            uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
+            uint16_t tile;
+            if (self->tiles_in_bitmap > 255) {
+                tile = ((uint16_t *)tiles)[tile_location];
+            } else {
+                tile = ((uint8_t *)tiles)[tile_location];
+            }
+            uint16_t x_in_tile = x % self->tile_width;
+            uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+            uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+            uint32_t count = MIN(self->tile_width - x_in_tile, end_x - x);
+            const uint16_t *src = ((const uint16_t *)(bitmap->data + tile_y * bitmap->stride)) + tile_x;
+            _copy_rgb565_span(src, (uint16_t *)buffer, mask, offset, count, swap);
+            x += count;
+            offset += count;
+        }
+    }
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -473,6 +650,11 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
+    // Layers above us may have already drawn everything we'd draw.
+    if (displayio_area_fully_masked(area, &overlap, mask)) {
+        return full_coverage;
+    }
+
     // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
     // set and our palette is all opaque.
 
@@ -512,6 +694,26 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    bool swap;
+    if (x_stride == 1 && y_stride > 0 &&
+        self->transpose_xy == self->absolute_transform->transpose_xy &&
+        _can_copy_rgb565(self, colorspace, &swap)) {
+        _fill_rgb565_rows(self, tiles, swap, start_x, end_x, start_y, end_y,
+            start + y_shift * y_stride + x_shift, y_stride, mask, buffer);
+        return full_coverage;
+    }
+
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
+        tilepalettemapper_tilepalettemapper_start_fill(self->pixel_shader, colorspace);
+    }
+    #endif
+
+    #if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+    bool cache_bitmap = mp_obj_is_type(self->bitmap, &displayio_bitmap_type) &&
+        displayio_bitmap_cache_wanted(self->bitmap);
+    #endif
+
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
@@ -549,6 +751,11 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
 
             // We always want to read bitmap pixels by row first and then transpose into the destination
             // buffer because most bitmaps are row associated.
+            #if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+            if (cache_bitmap) {
+                input_pixel.pixel = displayio_bitmap_get_pixel_cached(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+            } else
+            #endif
             if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
                 input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
             } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
@@ -636,6 +843,50 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts a dirty area relative to the grid into absolute screen coordinates.
+static void _transform_dirty_area(displayio_tilegrid_t *self, displayio_area_t *dirty_area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = dirty_area->x1;
+    int16_t x2 = dirty_area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = dirty_area->y1;
+    int16_t y2 = dirty_area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    dirty_area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    dirty_area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    dirty_area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    dirty_area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (dirty_area->y2 < dirty_area->y1) {
+        int16_t temp = dirty_area->y2;
+        dirty_area->y2 = dirty_area->y1;
+        dirty_area->y1 = temp;
+    }
+    if (dirty_area->x2 < dirty_area->x1) {
+        int16_t temp = dirty_area->x2;
+        dirty_area->x2 = dirty_area->x1;
+        dirty_area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -649,10 +900,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             return tail;
         }
     } else if (self->moved && !first_draw) {
-        displayio_area_union(&self->previous_area, &self->current_area, &self->dirty_area);
-        if (displayio_area_size(&self->dirty_area) <= 2U * self->pixel_width * self->pixel_height) {
-            self->dirty_area.next = tail;
-            return &self->dirty_area;
+        displayio_area_t *moved_area = &self->dirty_areas[0];
+        displayio_area_union(&self->previous_area, &self->current_area, moved_area);
+        if (displayio_area_size(moved_area) <= 2U * self->pixel_width * self->pixel_height) {
+            moved_area->next = tail;
+            return moved_area;
         }
         self->previous_area.next = tail;
         self->current_area.next = &self->previous_area;
@@ -666,8 +918,7 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             // Special case a TileGrid that shows a full bitmap and use its
             // dirty area. Copy it to ours so we can transform it.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
-                self->partial_change = true;
+                _mark_area_dirty(self, refresh_area);
             } else {
                 self->full_change = true;
             }
@@ -686,49 +937,11 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
+        for (uint8_t i = 0; i < self->dirty_area_count; i++) {
+            _transform_dirty_area(self, &self->dirty_areas[i]);
+            self->dirty_areas[i].next = tail;
+            tail = &self->dirty_areas[i];
         }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
-
-        self->dirty_area.next = tail;
-        return &self->dirty_area;
     }
     return tail;
 }
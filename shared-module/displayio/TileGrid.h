@@ -13,6 +13,9 @@
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
 
+// Maximum number of separate dirty areas tracked per TileGrid. More changes grow the closest one.
+#define TILEGRID_DIRTY_AREA_COUNT (4)
+
 typedef struct {
     mp_obj_base_t base;
     mp_obj_t bitmap;
@@ -32,7 +35,8 @@ typedef struct {
     uint16_t top_left_y;
     void *tiles;  // Can be either uint8_t* or uint16_t* depending on tiles_in_bitmap
     const displayio_buffer_transform_t *absolute_transform;
-    displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
+    // Stored as relative areas until the refresh areas are fetched.
+    displayio_area_t dirty_areas[TILEGRID_DIRTY_AREA_COUNT];
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
     bool partial_change : 1;
@@ -47,6 +51,7 @@ typedef struct {
     bool hidden_by_parent : 1;
     bool rendered_hidden : 1;
     uint8_t padding : 6;
+    uint8_t dirty_area_count;
 } displayio_tilegrid_t;
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
@@ -70,3 +75,5 @@ bool displayio_tilegrid_get_rendered_hidden(displayio_tilegrid_t *self);
 void displayio_tilegrid_validate_pixel_shader(mp_obj_t pixel_shader);
 
 void displayio_tilegrid_mark_tile_dirty(displayio_tilegrid_t *self, uint16_t x, uint16_t y);
+// Sets count tiles of row y starting at column x. The row must not wrap.
+void displayio_tilegrid_set_tiles_in_row(displayio_tilegrid_t *self, uint16_t x, uint16_t y, const uint8_t *tile_indices, uint16_t count);
@@ -194,6 +194,11 @@ void reset_displays(void) {
     // In CircuitPython 10, release secondary displays before doing anything else:
     // common_hal_displayio_release_displays_impl(true);
 
+    #if CIRCUITPY_DISPLAYIO_BITMAP_CACHE_SIZE
+    // Give the cache's internal RAM back.
+    displayio_bitmap_cache_reset();
+    #endif
+
     // The SPI buses used by FourWires may be allocated on the heap so we need to move them inline.
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         mp_const_obj_t display_bus_type = display_buses[i].bus_base.type;
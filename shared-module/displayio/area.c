@@ -111,6 +111,81 @@ bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b)
            a->y2 == b->y2;
 }
 
+bool displayio_area_fully_masked(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask) {
+    uint16_t width = displayio_area_width(area);
+    uint16_t sub_width = displayio_area_width(sub);
+    for (int16_t y = sub->y1; y < sub->y2; y++) {
+        uint32_t offset = (y - area->y1) * width + (sub->x1 - area->x1);
+        uint32_t remaining = sub_width;
+        while (remaining > 0) {
+            uint32_t shift = offset % 32;
+            uint32_t n = MIN(32 - shift, remaining);
+            uint32_t bits = (n == 32 ? 0xffffffff : ((1u << n) - 1)) << shift;
+            if ((mask[offset / 32] & bits) != bits) {
+                return false;
+            }
+            offset += n;
+            remaining -= n;
+        }
+    }
+    return true;
+}
+
+// Cost of refreshing the union of a and b instead of each on its own. Negative when
+// merging is cheaper.
+static int32_t _merge_cost(const displayio_area_t *a, const displayio_area_t *b, uint32_t overhead) {
+    displayio_area_t u;
+    displayio_area_union(a, b, &u);
+    return (int32_t)displayio_area_size(&u) - (int32_t)(displayio_area_size(a) + displayio_area_size(b) + overhead);
+}
+
+uint8_t displayio_area_coalesce(const displayio_area_t *list, displayio_area_t *areas, uint8_t max_areas, uint32_t overhead) {
+    uint8_t count = 0;
+    for (const displayio_area_t *area = list; area != NULL; area = area->next) {
+        if (displayio_area_empty(area)) {
+            continue;
+        }
+        if (count < max_areas) {
+            displayio_area_copy(area, &areas[count++]);
+            continue;
+        }
+        // Out of room so grow whichever area is cheapest to merge with.
+        uint8_t best = 0;
+        int32_t best_cost = INT32_MAX;
+        for (uint8_t i = 0; i < count; i++) {
+            int32_t cost = _merge_cost(&areas[i], area, overhead);
+            if (cost < best_cost) {
+                best = i;
+                best_cost = cost;
+            }
+        }
+        displayio_area_union(&areas[best], area, &areas[best]);
+    }
+
+    // Merge pairs until no merge saves anything. A merge can make others worthwhile so
+    // start over after each one.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < count && !merged; i++) {
+            for (uint8_t j = i + 1; j < count; j++) {
+                if (_merge_cost(&areas[i], &areas[j], overhead) <= 0) {
+                    displayio_area_union(&areas[i], &areas[j], &areas[i]);
+                    count--;
+                    displayio_area_copy(&areas[count], &areas[j]);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        areas[i].next = i + 1 < count ? &areas[i + 1] : NULL;
+    }
+    return count;
+}
+
 // Original and whole must be in the same coordinate space.
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
@@ -51,6 +51,13 @@ uint16_t displayio_area_width(const displayio_area_t *area);
 uint16_t displayio_area_height(const displayio_area_t *area);
 uint32_t displayio_area_size(const displayio_area_t *area);
 bool displayio_area_equal(const displayio_area_t *a, const displayio_area_t *b);
+// Returns true when every pixel of sub, which must be within area, is set in the mask for
+// area. Layers use this to skip regions that layers above them already covered.
+bool displayio_area_fully_masked(const displayio_area_t *area, const displayio_area_t *sub, const uint32_t *mask);
+// Copies the linked list of areas into areas, merging any that are cheaper to refresh
+// together. overhead is the cost, in pixels, of refreshing an area on its own. Returns the
+// number of areas, which are linked together through next.
+uint8_t displayio_area_coalesce(const displayio_area_t *list, displayio_area_t *areas, uint8_t max_areas, uint32_t overhead);
 void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpose_xy,
     const displayio_area_t *original,
     const displayio_area_t *whole,
@@ -48,6 +48,8 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
     self->always_toggle_chip_select = always_toggle_chip_select;
     self->SH1107_addressing = SH1107_addressing;
     self->address_little_endian = address_little_endian;
+    self->start_send = NULL;
+    self->finish_send = NULL;
 
     #if CIRCUITPY_PARALLELDISPLAYBUS
     if (mp_obj_is_type(bus, &paralleldisplaybus_parallelbus_type)) {
@@ -56,6 +58,8 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->begin_transaction = common_hal_paralleldisplaybus_parallelbus_begin_transaction;
         self->send = common_hal_paralleldisplaybus_parallelbus_send;
         self->end_transaction = common_hal_paralleldisplaybus_parallelbus_end_transaction;
+        self->start_send = common_hal_paralleldisplaybus_parallelbus_start_send;
+        self->finish_send = common_hal_paralleldisplaybus_parallelbus_finish_send;
         self->collect_ptrs = common_hal_paralleldisplaybus_parallelbus_collect_ptrs;
     } else
     #endif
@@ -66,6 +70,8 @@ void displayio_display_bus_construct(displayio_display_bus_t *self,
         self->begin_transaction = common_hal_fourwire_fourwire_begin_transaction;
         self->send = common_hal_fourwire_fourwire_send;
         self->end_transaction = common_hal_fourwire_fourwire_end_transaction;
+        self->start_send = common_hal_fourwire_fourwire_start_send;
+        self->finish_send = common_hal_fourwire_fourwire_finish_send;
         self->collect_ptrs = common_hal_fourwire_fourwire_collect_ptrs;
     } else
     #endif
@@ -21,6 +21,8 @@ typedef struct {
     display_bus_begin_transaction begin_transaction;
     display_bus_send send;
     display_bus_end_transaction end_transaction;
+    display_bus_start_send start_send; // NULL when the bus can only send synchronously.
+    display_bus_finish_send finish_send;
     display_bus_collect_ptrs collect_ptrs;
     uint16_t ram_width;
     uint16_t ram_height;
@@ -13,6 +13,10 @@
 
 #define NO_COMMAND 0x100
 
+// Refresh buffer sizes in uint32_ts for the bus displays.
+#define DISPLAYIO_STACK_BUFFER_SIZE (128)
+#define DISPLAYIO_REFRESH_BUFFER_SIZE (CIRCUITPY_DISPLAY_REFRESH_BUFFER_SIZE / sizeof(uint32_t))
+
 typedef struct {
     displayio_group_t *current_group;
     uint64_t last_refresh;
@@ -13,6 +13,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -80,6 +81,10 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->stop_sequence_len = stop_sequence_len;
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
+    self->partial_start_sequence = NULL;
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_count = 0;
+    self->partial_refresh = false;
 
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
@@ -184,6 +189,19 @@ void epaperdisplay_epaperdisplay_change_refresh_mode_parameters(epaperdisplay_ep
     self->milliseconds_per_frame = seconds_per_frame * 1000;
 }
 
+void epaperdisplay_epaperdisplay_set_partial_refresh_parameters(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_start_sequence, uint16_t partial_start_sequence_len,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    mp_float_t partial_refresh_time, uint16_t partial_refreshes_per_full) {
+    self->partial_start_sequence = partial_start_sequence;
+    self->partial_start_sequence_len = partial_start_sequence_len;
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->partial_refresh_time = partial_refresh_time * 1000;
+    self->partial_refreshes_per_full = partial_refreshes_per_full;
+    self->partial_refresh_count = 0;
+}
+
 static void epaperdisplay_epaperdisplay_start_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
     if (!displayio_display_bus_is_free(&self->bus)) {
         // Can't acquire display bus; skip updating this display. Try next display.
@@ -195,7 +213,11 @@ static void epaperdisplay_epaperdisplay_start_refresh(epaperdisplay_epaperdispla
 
     common_hal_time_delay_ms(self->start_up_time_ms);
 
-    send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+    if (self->partial_refresh && self->partial_start_sequence != NULL) {
+        send_command_sequence(self, true, self->partial_start_sequence, self->partial_start_sequence_len);
+    } else {
+        send_command_sequence(self, true, self->start_sequence, self->start_sequence_len);
+    }
     if (mp_hal_is_interrupted()) {
         return;
     }
@@ -216,7 +238,11 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
 
 static void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (self->partial_refresh) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    }
 
     supervisor_enable_tick();
     self->refreshing = true;
@@ -257,18 +283,40 @@ mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_root_group(epaperdisplay_epa
     return self->core.current_group;
 }
 
-static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+// Refresh buffers larger than the stack buffer come from the port heap with the mask
+// after the pixels. Returns the pixel buffer size in uint32_ts, or 0 to use the stack.
+static uint32_t _allocate_refresh_buffer(epaperdisplay_epaperdisplay_obj_t *self) {
+    if (DISPLAYIO_REFRESH_BUFFER_SIZE <= DISPLAYIO_STACK_BUFFER_SIZE) {
+        return 0;
+    }
+    if (self->refresh_buffer == NULL) {
+        // A full buffer of one bit pixels needs one mask word per pixel buffer word.
+        size_t words = 2 * DISPLAYIO_REFRESH_BUFFER_SIZE + 1;
+        self->refresh_buffer = port_malloc(words * sizeof(uint32_t), false);
+    }
+    if (self->refresh_buffer == NULL) {
+        return 0;
+    }
+    return DISPLAYIO_REFRESH_BUFFER_SIZE;
+}
 
+static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay_obj_t *self, const displayio_area_t *area) {
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
     if (!displayio_display_core_clip_area(&self->core, area, &clipped)) {
         return true;
     }
+
+    uint32_t heap_buffer_size = _allocate_refresh_buffer(self);
+    uint32_t buffer_size = DISPLAYIO_STACK_BUFFER_SIZE; // In uint32_ts
+    if (heap_buffer_size > 0) {
+        buffer_size = heap_buffer_size;
+    }
+
     uint16_t subrectangles = 1;
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
-    uint16_t pixels_per_buffer = displayio_area_size(&clipped);
+    uint32_t pixels_per_buffer = displayio_area_size(&clipped);
     if (displayio_area_size(&clipped) > buffer_size * pixels_per_word) {
         rows_per_buffer = buffer_size * pixels_per_word / displayio_area_width(&clipped);
         if (rows_per_buffer == 0) {
@@ -285,11 +333,20 @@ static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
         }
     }
 
+    volatile uint32_t mask_length = (pixels_per_buffer / 32) + 1;
+    // A single row wider than the heap buffer still goes through the stack.
+    bool use_heap = heap_buffer_size >= buffer_size && heap_buffer_size + 1 >= mask_length;
+
     // Allocated and shared as a uint32_t array so the compiler knows the
     // alignment everywhere.
-    uint32_t buffer[buffer_size];
-    volatile uint32_t mask_length = (pixels_per_buffer / 32) + 1;
-    uint32_t mask[mask_length];
+    uint32_t stack_buffer[use_heap ? 1 : buffer_size];
+    uint32_t stack_mask[use_heap ? 1 : mask_length];
+    uint32_t *buffer = stack_buffer;
+    uint32_t *mask = stack_mask;
+    if (use_heap) {
+        buffer = self->refresh_buffer;
+        mask = self->refresh_buffer + heap_buffer_size;
+    }
 
     uint8_t passes = 1;
     if (self->write_color_ram_command != NO_COMMAND) {
@@ -323,7 +380,7 @@ static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
             remaining_rows -= rows_per_buffer;
 
 
-            uint16_t subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
+            uint32_t subrectangle_size_bytes = displayio_area_size(&subrectangle) / (8 / self->core.colorspace.depth);
 
             memset(mask, 0, mask_length * sizeof(mask[0]));
             memset(buffer, 0, buffer_size * sizeof(buffer[0]));
@@ -349,7 +406,7 @@ static bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
             // Invert it all.
             if ((pass == 1 && self->color_bits_inverted) ||
                 (pass == 0 && self->black_bits_inverted)) {
-                for (uint16_t k = 0; k < buffer_size; k++) {
+                for (uint32_t k = 0; k < buffer_size; k++) {
                     buffer[k] = ~buffer[k];
                 }
             }
@@ -432,6 +489,19 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
     if (current_area == NULL) {
         return true;
     }
+    self->partial_refresh = self->partial_refresh_sequence != NULL && !self->core.full_refresh && !self->acep;
+    if (self->partial_refresh && self->partial_refreshes_per_full > 0 &&
+        self->partial_refresh_count >= self->partial_refreshes_per_full) {
+        // Partial refreshes leave ghosting behind so clear it with a full refresh now and then.
+        self->partial_refresh = false;
+        self->core.full_refresh = true;
+        current_area = epaperdisplay_epaperdisplay_get_refresh_areas(self);
+    }
+    if (self->partial_refresh) {
+        self->partial_refresh_count++;
+    } else {
+        self->partial_refresh_count = 0;
+    }
     if (self->acep) {
         epaperdisplay_epaperdisplay_start_refresh(self);
         _clean_area(self);
@@ -460,7 +530,8 @@ void epaperdisplay_epaperdisplay_background(epaperdisplay_epaperdisplay_obj_t *s
             bool busy = common_hal_digitalio_digitalinout_get_value(&self->busy);
             refresh_done = busy != self->busy_state;
         } else {
-            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > self->refresh_time;
+            uint16_t refresh_time = self->partial_refresh ? self->partial_refresh_time : self->refresh_time;
+            refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > refresh_time;
         }
         if (refresh_done) {
             supervisor_disable_tick();
@@ -486,6 +557,10 @@ void release_epaperdisplay(epaperdisplay_epaperdisplay_obj_t *self) {
     }
 
     release_display_core(&self->core);
+    if (self->refresh_buffer != NULL) {
+        port_free(self->refresh_buffer);
+        self->refresh_buffer = NULL;
+    }
     if (self->busy.base.type == &digitalio_digitalinout_type) {
         common_hal_digitalio_digitalinout_deinit(&self->busy);
     }
@@ -502,6 +577,8 @@ void epaperdisplay_epaperdisplay_collect_ptrs(epaperdisplay_epaperdisplay_obj_t
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
     gc_collect_ptr((void *)self->refresh_sequence);
+    gc_collect_ptr((void *)self->partial_start_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
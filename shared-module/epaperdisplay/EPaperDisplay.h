@@ -18,6 +18,8 @@ typedef struct {
     displayio_display_core_t core;
     displayio_display_bus_t bus;
     digitalio_digitalinout_obj_t busy;
+    // Refresh buffer from the port heap. NULL until the first refresh that needs it.
+    uint32_t *refresh_buffer;
     uint32_t milliseconds_per_frame;
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
@@ -29,6 +31,15 @@ typedef struct {
     uint16_t refresh_time;
     uint16_t write_black_ram_command;
     uint16_t write_color_ram_command;
+    // Used instead of the start and refresh sequences when only part of the screen changed.
+    // partial_refresh_sequence is NULL when the display doesn't support it.
+    const uint8_t *partial_start_sequence;
+    const uint8_t *partial_refresh_sequence;
+    uint16_t partial_start_sequence_len;
+    uint16_t partial_refresh_sequence_len;
+    uint16_t partial_refresh_time;
+    uint16_t partial_refreshes_per_full;
+    uint16_t partial_refresh_count; // Partial refreshes since the last full one.
     uint8_t hue;
     bool busy_state;
     bool black_bits_inverted;
@@ -37,11 +48,18 @@ typedef struct {
     bool grayscale;
     bool acep;
     bool two_byte_sequence_length;
+    bool partial_refresh; // The refresh in progress uses the partial sequences.
     display_chip_select_behavior_t chip_select;
 } epaperdisplay_epaperdisplay_obj_t;
 
 void epaperdisplay_epaperdisplay_change_refresh_mode_parameters(epaperdisplay_epaperdisplay_obj_t *self,
     mp_buffer_info_t *start_sequence, float seconds_per_frame);
+// partial_start_sequence may be NULL to use the regular start sequence. A
+// partial_refreshes_per_full of 0 never forces a full refresh.
+void epaperdisplay_epaperdisplay_set_partial_refresh_parameters(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_start_sequence, uint16_t partial_start_sequence_len,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len,
+    mp_float_t partial_refresh_time, uint16_t partial_refreshes_per_full);
 void epaperdisplay_epaperdisplay_background(epaperdisplay_epaperdisplay_obj_t *self);
 void epaperdisplay_epaperdisplay_reset(epaperdisplay_epaperdisplay_obj_t *self);
 void release_epaperdisplay(epaperdisplay_epaperdisplay_obj_t *self);
@@ -9,6 +9,7 @@
 
 #include "shared-bindings/time/__init__.h"
 #include "shared-bindings/floppyio/__init__.h"
+#include "shared-module/floppyio/__init__.h"
 #if CIRCUITPY_DIGITALIO
 #include "common-hal/floppyio/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
@@ -79,8 +80,150 @@ int common_hal_floppyio_flux_readinto(void *buf, size_t len, digitalio_digitalin
 
     return pulses_ptr - pulses;
 }
+
+// Decoding a track while it is captured needs flux timing that doesn't depend on how long the
+// decoder takes, so only ports that capture in hardware provide this.
+MP_WEAK int common_hal_floppyio_mfm_track_readinto(const mp_buffer_info_t *buf, uint8_t *validity, digitalio_digitalinout_obj_t *data, digitalio_digitalinout_obj_t *index, mp_int_t index_wait_ms, size_t t2_max, size_t t3_max) {
+    mp_raise_NotImplementedError(NULL);
+}
 #endif
 
+enum {
+    MFM_HUNT,
+    MFM_MARK,
+    MFM_ID,
+    MFM_DATA,
+};
+
+// 0xa1 with a missing clock bit, which can't appear in normal data.
+#define MFM_SYNC (0x4489)
+#define MFM_SYNC_BYTE (0xa1)
+#define MFM_ID_MARK (0xfe)
+#define MFM_DATA_MARK (0xfb)
+#define MFM_SECTOR_SIZE (512)
+// Size code for 512-byte sectors in the ID field.
+#define MFM_SECTOR_SIZE_CODE (2)
+
+// CRC-CCITT of each nibble, small enough to stay in cache.
+static const uint16_t crc_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+static inline uint16_t crc_byte(uint16_t crc, uint8_t b) {
+    crc = (crc << 4) ^ crc_nibble[(crc >> 12) ^ (b >> 4)];
+    crc = (crc << 4) ^ crc_nibble[(crc >> 12) ^ (b & 0xf)];
+    return crc;
+}
+
+// The data bits are every other cell, after each clock cell.
+static inline uint8_t mfm_data_bits(uint32_t raw) {
+    raw &= 0x5555;
+    raw = (raw | (raw >> 1)) & 0x3333;
+    raw = (raw | (raw >> 2)) & 0x0f0f;
+    raw = (raw | (raw >> 4)) & 0x00ff;
+    return raw;
+}
+
+void floppyio_mfm_decoder_init(floppyio_mfm_decoder_t *self, uint8_t *sectors, uint8_t *validity, size_t n_sectors, size_t t2_max, size_t t3_max) {
+    for (size_t pulse = 0; pulse < MP_ARRAY_SIZE(self->cells); pulse++) {
+        self->cells[pulse] = pulse <= t2_max ? 2 : pulse <= t3_max ? 3 : 4;
+    }
+    self->sectors = sectors;
+    self->validity = validity;
+    self->n_sectors = n_sectors;
+    self->n_valid = 0;
+    for (size_t i = 0; i < n_sectors; i++) {
+        if (validity[i]) {
+            self->n_valid++;
+        }
+    }
+    floppyio_mfm_decoder_resync(self);
+}
+
+void floppyio_mfm_decoder_resync(floppyio_mfm_decoder_t *self) {
+    self->shift = 0;
+    self->state = MFM_HUNT;
+    self->pending_sector = -1;
+}
+
+static void decode_byte(floppyio_mfm_decoder_t *self, uint32_t raw) {
+    if (self->state == MFM_MARK) {
+        if (raw == MFM_SYNC) {
+            self->n_syncs++;
+            self->crc = crc_byte(self->crc, MFM_SYNC_BYTE);
+            return;
+        }
+        uint8_t mark = mfm_data_bits(raw);
+        self->crc = crc_byte(self->crc, mark);
+        if (self->n_syncs >= 3 && mark == MFM_ID_MARK) {
+            self->state = MFM_ID;
+            self->remaining = sizeof(self->id) + 2;
+        } else if (self->n_syncs >= 3 && mark == MFM_DATA_MARK && self->pending_sector >= 0) {
+            self->state = MFM_DATA;
+            self->dest = self->sectors + self->pending_sector * MFM_SECTOR_SIZE;
+            self->remaining = MFM_SECTOR_SIZE + 2;
+        } else {
+            self->state = MFM_HUNT;
+            self->pending_sector = -1;
+        }
+        return;
+    }
+
+    uint8_t b = mfm_data_bits(raw);
+    self->crc = crc_byte(self->crc, b);
+    self->remaining--;
+    if (self->state == MFM_ID) {
+        if (self->remaining >= 2) {
+            self->id[sizeof(self->id) + 1 - self->remaining] = b;
+        }
+        if (self->remaining == 0) {
+            // id holds cylinder, head, sector and size code.
+            uint8_t sector = self->id[2];
+            self->state = MFM_HUNT;
+            self->pending_sector = -1;
+            if (self->crc == 0 && self->id[3] == MFM_SECTOR_SIZE_CODE &&
+                sector >= 1 && sector <= self->n_sectors && !self->validity[sector - 1]) {
+                self->pending_sector = sector - 1;
+            }
+        }
+    } else {
+        if (self->remaining >= 2) {
+            *self->dest++ = b;
+        }
+        if (self->remaining == 0) {
+            if (self->crc == 0) {
+                self->validity[self->pending_sector] = 1;
+                self->n_valid++;
+            }
+            self->state = MFM_HUNT;
+            self->pending_sector = -1;
+        }
+    }
+}
+
+__attribute__((optimize("O3")))
+void floppyio_mfm_decoder_feed(floppyio_mfm_decoder_t *self, uint8_t pulse) {
+    // A pulse is a transition after some cells without one. Newer cells go in the low bits.
+    uint8_t cells = self->cells[pulse];
+    self->shift = (self->shift << cells) | 1;
+    if (self->state == MFM_HUNT) {
+        // A sync mark ends with a transition, so it always lines up with a pulse.
+        if ((self->shift & 0xffff) == MFM_SYNC) {
+            self->state = MFM_MARK;
+            self->n_syncs = 1;
+            self->n_cells = 0;
+            self->crc = crc_byte(0xffff, MFM_SYNC_BYTE);
+        }
+        return;
+    }
+    self->n_cells += cells;
+    if (self->n_cells >= 16) {
+        self->n_cells -= 16;
+        decode_byte(self, (self->shift >> self->n_cells) & 0xffff);
+    }
+}
+
 int common_hal_floppyio_mfm_readinto(const mp_buffer_info_t *buf, const mp_buffer_info_t *flux_buf, uint8_t *validity, size_t t2_max, size_t t3_max) {
     mfm_io_t io = {
         .T2_max = t2_max,
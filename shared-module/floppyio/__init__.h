@@ -0,0 +1,41 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Decodes MFM one flux pulse at a time, so that sectors can be decoded while a track is still
+// being captured. It understands the usual IBM layout of 512-byte sectors numbered from 1.
+typedef struct {
+    // Number of MFM cells for each possible pulse length, so classifying a pulse is one lookup.
+    uint8_t cells[256];
+    uint8_t *sectors;
+    uint8_t *validity;
+    size_t n_sectors;
+    size_t n_valid;
+    // Where the data of the sector being read goes.
+    uint8_t *dest;
+    // The most recent MFM cells, newest in bit 0.
+    uint32_t shift;
+    // Cells in shift that are not part of a byte yet.
+    uint8_t n_cells;
+    uint8_t state;
+    uint8_t n_syncs;
+    // Sector whose ID was just read, or -1 if its data isn't wanted.
+    int16_t pending_sector;
+    uint16_t crc;
+    // Bytes left in the field being read.
+    uint16_t remaining;
+    uint8_t id[4];
+} floppyio_mfm_decoder_t;
+
+void floppyio_mfm_decoder_init(floppyio_mfm_decoder_t *self, uint8_t *sectors, uint8_t *validity, size_t n_sectors, size_t t2_max, size_t t3_max);
+void floppyio_mfm_decoder_feed(floppyio_mfm_decoder_t *self, uint8_t pulse);
+// Forget any partly read field, such as after pulses were lost.
+void floppyio_mfm_decoder_resync(floppyio_mfm_decoder_t *self);
@@ -101,6 +101,8 @@ bool common_hal_fourwire_fourwire_begin_transaction(mp_obj_t obj) {
 void common_hal_fourwire_fourwire_send(mp_obj_t obj, display_byte_type_t data_type,
     display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
     fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    // The command pin must not change while a background send is still going.
+    common_hal_busio_spi_finish_write(self->bus);
     if (self->command.base.type == &mp_type_NoneType) {
         // When the data/command pin is not specified, we simulate a 9-bit SPI mode, by
         // adding a data/command bit to every byte, and then splitting the resulting data back
@@ -159,8 +161,26 @@ void common_hal_fourwire_fourwire_send(mp_obj_t obj, display_byte_type_t data_ty
     }
 }
 
+bool common_hal_fourwire_fourwire_start_send(mp_obj_t obj, display_byte_type_t data_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    // 9-bit mode and per-byte chip select need the CPU for every byte.
+    if (self->command.base.type == &mp_type_NoneType || chip_select == CHIP_SELECT_TOGGLE_EVERY_BYTE) {
+        return false;
+    }
+    common_hal_busio_spi_finish_write(self->bus);
+    common_hal_digitalio_digitalinout_set_value(&self->command, data_type == DISPLAY_DATA);
+    return common_hal_busio_spi_start_write(self->bus, data, data_length);
+}
+
+void common_hal_fourwire_fourwire_finish_send(mp_obj_t obj) {
+    fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_busio_spi_finish_write(self->bus);
+}
+
 void common_hal_fourwire_fourwire_end_transaction(mp_obj_t obj) {
     fourwire_fourwire_obj_t *self = MP_OBJ_TO_PTR(obj);
+    common_hal_busio_spi_finish_write(self->bus);
     if (self->chip_select.base.type != &mp_type_NoneType) {
         common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
     }
@@ -115,8 +115,25 @@ static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
     return NULL;
 }
 
+// Number of dirty rectangles passed to swapbuffers_areas. Once it is full,
+// further rectangles are merged into the last one.
+#define DIRTY_AREA_COUNT (8)
+
+static void _mark_area_dirty(displayio_area_t *dirty_areas, uint8_t *dirty_area_count, const displayio_area_t *area) {
+    if (*dirty_area_count < DIRTY_AREA_COUNT) {
+        displayio_area_copy_coords(area, &dirty_areas[*dirty_area_count]);
+        dirty_areas[*dirty_area_count].next = NULL;
+        (*dirty_area_count)++;
+    } else {
+        displayio_area_t *last = &dirty_areas[DIRTY_AREA_COUNT - 1];
+        displayio_area_union(last, area, last);
+        last->next = NULL;
+    }
+}
+
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
-static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
+static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask,
+    displayio_area_t *dirty_areas, uint8_t *dirty_area_count) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
     displayio_area_t clipped;
@@ -132,6 +149,7 @@ static bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         clipped.x1 = (clipped.x1 / div) * div;
         clipped.x2 = ((clipped.x2 + div - 1) / div) * div;
     }
+    _mark_area_dirty(dirty_areas, dirty_area_count, &clipped);
 
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
@@ -224,12 +242,18 @@ static void _refresh_display(framebufferio_framebufferdisplay_obj_t *self) {
         int row_count = transposed ? self->core.width : self->core.height;
         uint8_t dirty_row_bitmask[(row_count + 7) / 8];
         memset(dirty_row_bitmask, 0, sizeof(dirty_row_bitmask));
+        displayio_area_t dirty_areas[DIRTY_AREA_COUNT];
+        uint8_t dirty_area_count = 0;
         self->framebuffer_protocol->get_bufinfo(self->framebuffer, &self->bufinfo);
         while (current_area != NULL) {
-            _refresh_area(self, current_area, dirty_row_bitmask);
+            _refresh_area(self, current_area, dirty_row_bitmask, dirty_areas, &dirty_area_count);
             current_area = current_area->next;
         }
-        self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        if (self->framebuffer_protocol->swapbuffers_areas) {
+            self->framebuffer_protocol->swapbuffers_areas(self->framebuffer, dirty_areas, dirty_area_count);
+        } else {
+            self->framebuffer_protocol->swapbuffers(self->framebuffer, dirty_row_bitmask);
+        }
     }
     displayio_display_core_finish_refresh(&self->core);
 }
@@ -54,6 +54,7 @@ typedef mp_float_t (*framebuffer_get_brightness_fun)(mp_obj_t);
 typedef void (*framebuffer_deinit_fun)(mp_obj_t);
 typedef void (*framebuffer_get_bufinfo_fun)(mp_obj_t, mp_buffer_info_t *bufinfo);
 typedef void (*framebuffer_swapbuffers_fun)(mp_obj_t, uint8_t *dirty_row_bitmask);
+typedef void (*framebuffer_swapbuffers_areas_fun)(mp_obj_t, const displayio_area_t *dirty_areas, size_t dirty_area_count);
 
 typedef struct _framebuffer_p_t {
     MP_PROTOCOL_HEAD // MP_QSTR_protocol_framebuffer
@@ -76,6 +77,10 @@ typedef struct _framebuffer_p_t {
     framebuffer_get_reverse_pixels_in_word_fun get_reverse_pixels_in_word; // default: false
     framebuffer_get_row_stride_fun get_row_stride; // default: 0 (no extra row padding)
 
+    // Optional -- called instead of swapbuffers with the rectangles of the
+    // framebuffer that changed, in framebuffer coordinates.
+    framebuffer_swapbuffers_areas_fun swapbuffers_areas;
+
     // Optional -- default is no brightness control
     framebuffer_get_brightness_fun get_brightness;
     framebuffer_set_brightness_fun set_brightness;
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/mperrno.h"
 #include "py/runtime.h"
 
 #include "shared-module/gifio/GifWriter.h"
@@ -16,7 +17,18 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+// Output is written to the file whenever this much has been collected, so a frame never has to
+// fit in RAM and sockets get a steady stream of small writes.
+#define OUTPUT_BUFFER_SIZE (512)
+
+// Palette index that marks a pixel as unchanged in diff mode. Colors only use the 128 indices
+// below it.
+#define TRANSPARENT_INDEX (128)
+
+// LZW codes are at most 12 bits. Like giflib, the table is cleared before the last code is used.
+#define LZW_MAX_CODE (4095)
+// A prime somewhat larger than the number of codes keeps the probe sequences short.
+#define LZW_TABLE_SIZE (5003)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -24,39 +36,59 @@ static void handle_error(gifio_gifwriter_t *self) {
     }
 }
 
+// Keeps writing until everything is out, retrying streams such as non-blocking sockets that only
+// take part of it at a time. Once an error happens the rest of the output is dropped and the error
+// is raised by handle_error().
 static void flush_data(gifio_gifwriter_t *self) {
-    if (self->cur == 0) {
-        return;
-    }
-    int error = 0;
-    self->file_proto->write(self->file, self->data, self->cur, &error);
+    const uint8_t *data = self->data;
+    size_t remaining = self->cur;
     self->cur = 0;
-    if (error != 0) {
-        self->error = error;
+    while (remaining > 0 && self->error == 0) {
+        int error = 0;
+        mp_uint_t written = self->file_proto->write(self->file, data, remaining, &error);
+        if (written == MP_STREAM_ERROR) {
+            if (!mp_is_nonblocking_error(error)) {
+                self->error = error;
+            }
+        } else if (written == 0) {
+            self->error = MP_EIO;
+        } else {
+            data += written;
+            remaining -= written;
+        }
+        if (remaining > 0) {
+            RUN_BACKGROUND_TASKS;
+            mp_handle_pending(true);
+        }
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
-    assert(self->cur + size <= self->size);
-    memcpy(self->data + self->cur, data, size);
-    self->cur += size;
+    const uint8_t *bytes = data;
+    while (size > 0) {
+        if (self->cur == self->size) {
+            flush_data(self);
+        }
+        size_t n = MIN(size, self->size - self->cur);
+        memcpy(self->data + self->cur, bytes, n);
+        self->cur += n;
+        bytes += n;
+        size -= n;
+    }
 }
 
 static void write_byte(gifio_gifwriter_t *self, uint8_t value) {
-    write_data(self, &value, sizeof(value));
-}
-
-static void write_long(gifio_gifwriter_t *self, uint32_t value) {
-    write_data(self, &value, sizeof(value));
+    if (self->cur == self->size) {
+        flush_data(self);
+    }
+    self->data[self->cur++] = value;
 }
 
 static void write_word(gifio_gifwriter_t *self, uint16_t value) {
     write_data(self, &value, sizeof(value));
 }
 
-void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool own_file) {
+void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *file, int width, int height, displayio_colorspace_t colorspace, bool loop, bool dither, bool diff, bool own_file) {
     self->file = file;
     self->file_proto = mp_get_stream_raise(file, MP_STREAM_OP_WRITE | MP_STREAM_OP_IOCTL);
     if (self->file_proto->is_text) {
@@ -66,19 +98,9 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->height = height;
     self->colorspace = colorspace;
     self->dither = dither;
+    self->diff = diff;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
-    self->data = m_malloc_without_collect(self->size);
-    self->cur = 0;
-    self->error = 0;
-
-    write_data(self, "GIF89a", 6);
-    write_word(self, width);
-    write_word(self, height);
-    write_data(self, (uint8_t []) {0xF6, 0x00, 0x00}, 3);
-
     switch (colorspace) {
         case DISPLAYIO_COLORSPACE_RGB565:
         case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
@@ -91,6 +113,25 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
             mp_raise_TypeError(MP_ERROR_TEXT("unsupported colorspace for GifWriter"));
     }
 
+    self->size = OUTPUT_BUFFER_SIZE;
+    self->data = m_malloc_without_collect(self->size);
+    self->cur = 0;
+    self->error = 0;
+    self->lzw_table = m_malloc_without_collect(LZW_TABLE_SIZE * sizeof(uint32_t));
+    self->row = m_malloc_without_collect(width);
+    self->prev = NULL;
+    if (diff) {
+        // Nothing matches 0xff, so the first frame is written in full.
+        self->prev = m_malloc_without_collect(width * height);
+        memset(self->prev, 0xff, width * height);
+    }
+
+    write_data(self, "GIF89a", 6);
+    write_word(self, width);
+    write_word(self, height);
+    // Diff mode needs a 256 entry palette to have room for the transparent index.
+    write_data(self, (uint8_t []) {diff ? 0xF7 : 0xF6, 0x00, 0x00}, 3);
+
     bool color = (colorspace != DISPLAYIO_COLORSPACE_L8);
 
     bool bgr = (colorspace == DISPLAYIO_COLORSPACE_BGR565 || colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED);
@@ -113,6 +154,11 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
             write_data(self, (uint8_t []) {gray, gray, gray}, 3);
         }
     }
+    if (diff) {
+        for (int i = 128; i < 256; i++) {
+            write_data(self, (uint8_t []) {0, 0, 0}, 3);
+        }
+    }
 
     if (loop) {
         write_data(self, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
@@ -154,96 +200,245 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
-void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
-    if (delay) {
-        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
-        write_word(self, delay);
-        write_word(self, 0); // end
+// Converts row y of the frame to 7-bit palette indices in self->row.
+static void quantize_row(gifio_gifwriter_t *self, const void *buf, int y) {
+    uint8_t *out = self->row;
+    int width = self->width;
+
+    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
+        const uint8_t *pixels = (const uint8_t *)buf + y * width;
+        for (int x = 0; x < width; x++) {
+            out[x] = pixels[x] >> 1;
+        }
+    } else if (!self->dither) {
+        const uint16_t *pixels = (const uint16_t *)buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> (11 + (5 - 2))) & 0x3;
+            int green = (pixel >> (5 + (6 - 3))) & 0x7;
+            int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+            out[x] = (red << 5) | (green << 2) | blue;
+        }
+    } else {
+        const uint16_t *pixels = (const uint16_t *)buf + y * width;
+        for (int x = 0; x < width; x++) {
+            int pixel = pixels[x];
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
+            }
+            int red = (pixel >> 8) & 0xf8;
+            int green = (pixel >> 3) & 0xfc;
+            int blue = (pixel << 3) & 0xf8;
+
+            red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+            green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+            blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
+
+            out[x] = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+        }
     }
+}
 
+// Variable length LZW as used by GIF. The string table maps (prefix code, next index) to the
+// code for that string. Each slot holds key << 12 | code with key = prefix << 8 | index, and
+// because codes below clear + 2 are never stored a slot of zero is empty.
+typedef struct {
+    gifio_gifwriter_t *writer;
+    uint32_t *table;
+    uint32_t bits;
+    int bit_count;
+    int min_code_size;
+    int code_size;
+    int next_code;
+    int prefix;
+    int block_len;
+    uint8_t block[255];
+} lzw_encoder_t;
+
+static void lzw_write_code(lzw_encoder_t *lzw, int code) {
+    lzw->bits |= (uint32_t)code << lzw->bit_count;
+    lzw->bit_count += lzw->code_size;
+    while (lzw->bit_count >= 8) {
+        lzw->block[lzw->block_len++] = lzw->bits & 0xff;
+        lzw->bits >>= 8;
+        lzw->bit_count -= 8;
+        if (lzw->block_len == sizeof(lzw->block)) {
+            write_byte(lzw->writer, lzw->block_len);
+            write_data(lzw->writer, lzw->block, lzw->block_len);
+            lzw->block_len = 0;
+        }
+    }
+}
+
+static void lzw_clear(lzw_encoder_t *lzw) {
+    lzw_write_code(lzw, 1 << lzw->min_code_size);
+    memset(lzw->table, 0, LZW_TABLE_SIZE * sizeof(uint32_t));
+    lzw->code_size = lzw->min_code_size + 1;
+    lzw->next_code = (1 << lzw->min_code_size) + 2;
+}
+
+static void lzw_start(lzw_encoder_t *lzw, gifio_gifwriter_t *writer, int min_code_size) {
+    lzw->writer = writer;
+    lzw->table = writer->lzw_table;
+    lzw->bits = 0;
+    lzw->bit_count = 0;
+    lzw->block_len = 0;
+    lzw->min_code_size = min_code_size;
+    lzw->code_size = min_code_size + 1;
+    lzw->prefix = -1;
+    write_byte(writer, min_code_size);
+    lzw_clear(lzw);
+}
+
+static inline uint32_t lzw_hash(uint32_t key) {
+    return ((uint64_t)(key * 2654435761u) * LZW_TABLE_SIZE) >> 32;
+}
+
+static void lzw_add(lzw_encoder_t *lzw, uint8_t index) {
+    if (lzw->prefix < 0) {
+        lzw->prefix = index;
+        return;
+    }
+    uint32_t key = ((uint32_t)lzw->prefix << 8) | index;
+    uint32_t *table = lzw->table;
+    uint32_t slot = lzw_hash(key);
+    while (table[slot] != 0) {
+        if ((table[slot] >> 12) == key) {
+            lzw->prefix = table[slot] & 0xfff;
+            return;
+        }
+        if (++slot == LZW_TABLE_SIZE) {
+            slot = 0;
+        }
+    }
+
+    lzw_write_code(lzw, lzw->prefix);
+    // The decoder adds a code for every code it reads, so widen the codes as soon as the next one
+    // no longer fits.
+    if (lzw->next_code >= (1 << lzw->code_size)) {
+        lzw->code_size++;
+    }
+    if (lzw->next_code >= LZW_MAX_CODE) {
+        lzw_clear(lzw);
+    } else {
+        table[slot] = (key << 12) | lzw->next_code++;
+    }
+    lzw->prefix = index;
+}
+
+static void lzw_finish(lzw_encoder_t *lzw) {
+    if (lzw->prefix >= 0) {
+        lzw_write_code(lzw, lzw->prefix);
+        if (lzw->next_code >= (1 << lzw->code_size)) {
+            lzw->code_size++;
+        }
+    }
+    lzw_write_code(lzw, (1 << lzw->min_code_size) + 1);
+    if (lzw->bit_count > 0) {
+        lzw->block[lzw->block_len++] = lzw->bits & 0xff;
+    }
+    if (lzw->block_len > 0) {
+        write_byte(lzw->writer, lzw->block_len);
+        write_data(lzw->writer, lzw->block, lzw->block_len);
+    }
+    write_byte(lzw->writer, 0); // end of image data
+}
+
+static void write_image_descriptor(gifio_gifwriter_t *self, int x, int y, int width, int height) {
     write_byte(self, 0x2C);
-    write_long(self, 0);
-    write_word(self, self->width);
-    write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
+    write_word(self, x);
+    write_word(self, y);
+    write_word(self, width);
+    write_word(self, height);
+    write_byte(self, 0x00);
+}
 
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+static void add_full_frame(gifio_gifwriter_t *self, const void *buf) {
+    write_image_descriptor(self, 0, 0, self->width, self->height);
 
-    uint8_t *data = self->data + self->cur;
+    lzw_encoder_t lzw;
+    lzw_start(&lzw, self, 7);
+    for (int y = 0; y < self->height; y++) {
+        quantize_row(self, buf, y);
+        for (int x = 0; x < self->width; x++) {
+            lzw_add(&lzw, self->row[x]);
+        }
+    }
+    lzw_finish(&lzw);
+}
 
-    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
-        uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
+// Only the rectangle around the pixels that changed since the last frame is written, and the
+// pixels in it that did not change are left transparent.
+static void add_diff_frame(gifio_gifwriter_t *self, const void *buf) {
+    int width = self->width;
+    int x0 = width, x1 = -1, y0 = self->height, y1 = -1;
+
+    // Changed pixels are stored in prev with the top bit set until they are written.
+    for (int y = 0; y < self->height; y++) {
+        quantize_row(self, buf, y);
+        uint8_t *prev = self->prev + y * width;
+        for (int x = 0; x < width; x++) {
+            if (prev[x] != self->row[x]) {
+                prev[x] = self->row[x] | 0x80;
+                x0 = MIN(x0, x);
+                x1 = MAX(x1, x);
+                y0 = MIN(y0, y);
+                y1 = y;
             }
         }
-    } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
+    }
+
+    lzw_encoder_t lzw;
+    if (x1 < 0) {
+        // Still write a frame so that the delay is kept.
+        write_image_descriptor(self, 0, 0, 1, 1);
+        lzw_start(&lzw, self, 8);
+        lzw_add(&lzw, TRANSPARENT_INDEX);
+        lzw_finish(&lzw);
+        return;
+    }
+
+    write_image_descriptor(self, x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+    lzw_start(&lzw, self, 8);
+    for (int y = y0; y <= y1; y++) {
+        uint8_t *prev = self->prev + y * width;
+        for (int x = x0; x <= x1; x++) {
+            uint8_t index = prev[x];
+            if (index & 0x80) {
+                index &= 0x7f;
+                prev[x] = index;
+                lzw_add(&lzw, index);
+            } else {
+                lzw_add(&lzw, TRANSPARENT_INDEX);
             }
         }
+    }
+    lzw_finish(&lzw);
+}
+
+void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int pixel_count = self->width * self->height;
+    int bytes_per_pixel = self->colorspace == DISPLAYIO_COLORSPACE_L8 ? 1 : 2;
+    mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(bytes_per_pixel * pixel_count - 1), false);
+
+    if (self->diff) {
+        // Leave the previous frame in place and show it through the transparent pixels.
+        write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x05}, 4);
+        write_word(self, delay);
+        write_data(self, (uint8_t []) {TRANSPARENT_INDEX, 0x00}, 2); // end
+        add_diff_frame(self, bufinfo->buf);
     } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
-        uint16_t *pixels = bufinfo->buf;
-        int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
-
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
-            }
+        if (delay) {
+            write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
+            write_word(self, delay);
+            write_word(self, 0); // end
         }
+        add_full_frame(self, bufinfo->buf);
     }
 
-    self->cur = data - self->data;
-
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
     flush_data(self);
     handle_error(self);
 }
@@ -256,6 +451,17 @@ void shared_module_gifio_gifwriter_close(gifio_gifwriter_t *self) {
     self->file_proto->ioctl(self->file, self->own_file ? MP_STREAM_CLOSE : MP_STREAM_FLUSH, 0, &error);
     self->file = NULL;
 
+    m_del(uint8_t, self->data, self->size);
+    m_del(uint32_t, self->lzw_table, LZW_TABLE_SIZE);
+    m_del(uint8_t, self->row, self->width);
+    if (self->prev) {
+        m_del(uint8_t, self->prev, self->width * self->height);
+    }
+    self->data = NULL;
+    self->lzw_table = NULL;
+    self->row = NULL;
+    self->prev = NULL;
+
     if (error != 0) {
         self->error = error;
     }
@@ -17,9 +17,17 @@ typedef struct gifio_gifwriter {
     displayio_colorspace_t colorspace;
     int width, height;
     int error;
+    // Output is collected here and written out whenever it fills up.
     uint8_t *data;
     size_t cur, size;
+    // LZW string table, see GifWriter.c.
+    uint32_t *lzw_table;
+    // One row of palette indices.
+    uint8_t *row;
+    // Palette indices of the last frame written, only used with diff.
+    uint8_t *prev;
     bool own_file;
     bool byteswap;
     bool dither;
+    bool diff;
 } gifio_gifwriter_t;
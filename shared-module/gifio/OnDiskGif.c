@@ -5,6 +5,9 @@
 // SPDX-License-Identifier: MIT
 
 #include "shared-bindings/gifio/OnDiskGif.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 
@@ -42,6 +45,81 @@ static int32_t GIFSeekFile(GIFFILE *pFile, int32_t iPosition) {
     return pFile->iPos;
 } /* GIFSeekFile() */
 
+#if CIRCUITPY_BUSDISPLAY
+// Map a logical display coordinate along one axis to the native pixel it lands on.
+static int16_t native_coordinate(int16_t origin, int8_t direction, int16_t logical) {
+    if (direction > 0) {
+        return origin + logical;
+    }
+    return origin - logical - 1;
+}
+
+// Sends count pixels of one logical display row, starting at x, y.
+static bool write_display_row(busdisplay_busdisplay_obj_t *display, int16_t x, int16_t y, int16_t count, uint16_t *pixels) {
+    const displayio_buffer_transform_t *transform = &display->core.transform;
+    bool transpose = transform->transpose_xy;
+    int16_t nx1 = native_coordinate(transform->x, transform->dx, transpose ? y : x);
+    int16_t nx2 = native_coordinate(transform->x, transform->dx, transpose ? y : x + count - 1);
+    int16_t ny1 = native_coordinate(transform->y, transform->dy, transpose ? x : y);
+    int16_t ny2 = native_coordinate(transform->y, transform->dy, transpose ? x + count - 1 : y);
+    displayio_area_t native = {
+        .x1 = MIN(nx1, nx2),
+        .y1 = MIN(ny1, ny2),
+        .x2 = MAX(nx1, nx2) + 1,
+        .y2 = MAX(ny1, ny2) + 1,
+    };
+    // The row runs backwards in native order when its axis is mirrored.
+    if ((transpose ? transform->dy : transform->dx) < 0) {
+        for (int16_t i = 0; i < count / 2; i++) {
+            uint16_t temp = pixels[i];
+            pixels[i] = pixels[count - 1 - i];
+            pixels[count - 1 - i] = temp;
+        }
+    }
+    return busdisplay_busdisplay_write_area(display, &native, (uint8_t *)pixels);
+}
+
+static void GIFDrawToDisplay(gifio_ondiskgif_t *ondiskgif, GIFDRAW *pDraw) {
+    busdisplay_busdisplay_obj_t *display = ondiskgif->dest_display;
+    if (ondiskgif->display_busy) {
+        return;
+    }
+
+    int16_t y = ondiskgif->display_y + pDraw->iY + pDraw->y;
+    int16_t x = ondiskgif->display_x + pDraw->iX;
+    int16_t width = MIN(pDraw->iWidth, common_hal_busdisplay_busdisplay_get_width(display) - x);
+    if (y >= common_hal_busdisplay_busdisplay_get_height(display) || width < 1) {
+        return;
+    }
+
+    // RGB565_BE is what reverse_bytes_in_word displays want.
+    bool swap = !display->core.colorspace.reverse_bytes_in_word;
+    const uint8_t *s = pDraw->pPixels;
+    const uint16_t *pPal = pDraw->pPalette;
+    bool has_transparency = pDraw->ucHasTransparency == 1;
+    uint8_t ucTransparent = pDraw->ucTransparent;
+    uint16_t pixels[MAX_WIDTH];
+    int16_t i = 0;
+    while (i < width) {
+        // Transparent pixels keep what is on the screen so each opaque run is sent on its own.
+        if (has_transparency && s[i] == ucTransparent) {
+            i++;
+            continue;
+        }
+        int16_t run_start = i;
+        while (i < width && !(has_transparency && s[i] == ucTransparent)) {
+            uint16_t pixel = pPal[s[i]];
+            pixels[i - run_start] = swap ? __builtin_bswap16(pixel) : pixel;
+            i++;
+        }
+        if (!write_display_row(display, x + run_start, y, i - run_start, pixels)) {
+            ondiskgif->display_busy = true;
+            return;
+        }
+    }
+}
+#endif
+
 static void GIFDraw(GIFDRAW *pDraw) {
     // Called for every scan line of the image as it decodes
     // The pixels delivered are the 8-bit native GIF output
@@ -49,6 +127,12 @@ static void GIFDraw(GIFDRAW *pDraw) {
     // depending on the pixel type selected with gif.begin()
 
     gifio_ondiskgif_t *ondiskgif = (gifio_ondiskgif_t *)pDraw->pUser;
+    #if CIRCUITPY_BUSDISPLAY
+    if (ondiskgif->dest_display != NULL) {
+        GIFDrawToDisplay(ondiskgif, pDraw);
+        return;
+    }
+    #endif
     displayio_bitmap_t *bitmap = ondiskgif->bitmap;
     displayio_palette_t *palette = ondiskgif->palette;
 
@@ -127,8 +211,11 @@ static void GIFDraw(GIFDRAW *pDraw) {
     }
 }
 
-void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette) {
+void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette, bool use_bitmap) {
     self->file = file;
+    #if CIRCUITPY_BUSDISPLAY
+    self->dest_display = NULL;
+    #endif
 
     if (use_palette == true) {
         GIF_begin(&self->gif, GIF_PALETTE_RGB888);
@@ -169,9 +256,12 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
         self->palette = NULL;
     }
 
-    displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
-    common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
-    self->bitmap = bitmap;
+    self->bitmap = NULL;
+    if (use_bitmap) {
+        displayio_bitmap_t *bitmap = mp_obj_malloc(displayio_bitmap_t, &displayio_bitmap_type);
+        common_hal_displayio_bitmap_construct(bitmap, self->gif.iCanvasWidth, self->gif.iCanvasHeight, bpp);
+        self->bitmap = bitmap;
+    }
 
     GIFINFO info;
     GIF_getInfo(&self->gif, &info);
@@ -183,13 +273,15 @@ void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_
 
 void common_hal_gifio_ondiskgif_deinit(gifio_ondiskgif_t *self) {
     self->file = NULL;
-    common_hal_displayio_bitmap_deinit(self->bitmap);
+    if (self->bitmap != NULL) {
+        common_hal_displayio_bitmap_deinit(self->bitmap);
+    }
     self->bitmap = NULL;
     self->palette = NULL;
 }
 
 bool common_hal_gifio_ondiskgif_deinited(gifio_ondiskgif_t *self) {
-    return self->bitmap == NULL;
+    return self->file == NULL;
 }
 
 uint16_t common_hal_gifio_ondiskgif_get_height(gifio_ondiskgif_t *self) {
@@ -201,6 +293,9 @@ uint16_t common_hal_gifio_ondiskgif_get_width(gifio_ondiskgif_t *self) {
 }
 
 mp_obj_t common_hal_gifio_ondiskgif_get_bitmap(gifio_ondiskgif_t *self) {
+    if (self->bitmap == NULL) {
+        return mp_const_none;
+    }
     return MP_OBJ_FROM_PTR(self->bitmap);
 }
 
@@ -228,6 +323,9 @@ int32_t common_hal_gifio_ondiskgif_get_max_delay(gifio_ondiskgif_t *self) {
 }
 
 uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool setDirty) {
+    if (self->bitmap == NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q=%q"), MP_QSTR_display, MP_QSTR_None);
+    }
     int nextDelay = 0;
     int result = 0;
     result = GIF_playFrame(&self->gif, &nextDelay, self);
@@ -245,3 +343,27 @@ uint32_t common_hal_gifio_ondiskgif_next_frame(gifio_ondiskgif_t *self, bool set
 
     return nextDelay;
 }
+
+#if CIRCUITPY_BUSDISPLAY
+uint32_t common_hal_gifio_ondiskgif_next_frame_into_display(gifio_ondiskgif_t *self,
+    busdisplay_busdisplay_obj_t *display, int16_t x, int16_t y) {
+    if (self->palette != NULL) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q=%q"), MP_QSTR_use_palette, MP_QSTR_True);
+    }
+    if (display->core.colorspace.depth != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+
+    int nextDelay = 0;
+    self->dest_display = display;
+    self->display_x = x;
+    self->display_y = y;
+    self->display_busy = false;
+    GIF_playFrame(&self->gif, &nextDelay, self);
+    self->dest_display = NULL;
+    if (self->display_busy) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_display_bus);
+    }
+    return nextDelay;
+}
+#endif
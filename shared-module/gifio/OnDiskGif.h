@@ -17,6 +17,10 @@
 
 #include "extmod/vfs_fat.h"
 
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     GIFIMAGE gif;
@@ -27,4 +31,11 @@ typedef struct {
     int32_t frame_count;
     int32_t min_delay;
     int32_t max_delay;
+    #if CIRCUITPY_BUSDISPLAY
+    // Set while a frame is decoded straight to a display instead of the bitmap.
+    busdisplay_busdisplay_obj_t *dest_display;
+    int16_t display_x;
+    int16_t display_y;
+    bool display_busy;
+    #endif
 } gifio_ondiskgif_t;
@@ -8,6 +8,9 @@
 
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
 #include "shared-module/jpegio/JpegDecoder.h"
 
 typedef size_t (*input_func)(JDEC *jd, uint8_t *dest, size_t len);
@@ -210,3 +213,103 @@ void common_hal_jpegio_jpegdecoder_decode_into(
         check_jresult(result);
     }
 }
+
+#if CIRCUITPY_BUSDISPLAY
+// tjpgd outputs at most one 16x16 MCU at a time.
+#define MAX_BLOCK_PIXELS (16 * 16)
+
+// Map a logical display coordinate along one axis to the native pixel it lands on.
+static int16_t native_coordinate(int16_t origin, int8_t direction, int16_t logical) {
+    if (direction > 0) {
+        return origin + logical;
+    }
+    return origin - logical - 1;
+}
+
+static int display_output(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    busdisplay_busdisplay_obj_t *display = self->dest_display;
+
+    if (rect->top >= self->lim.y2) {
+        // No more rows to copy.
+        return DECODER_INTERRUPT;
+    }
+
+    // Crop to the source limits and then to the display, in logical display coordinates.
+    int16_t dx = self->x - self->lim.x1;
+    int16_t dy = self->y - self->lim.y1;
+    displayio_area_t logical = {
+        .x1 = MAX(rect->left, self->lim.x1) + dx,
+        .y1 = MAX(rect->top, self->lim.y1) + dy,
+        .x2 = MIN(rect->right + 1, self->lim.x2) + dx,
+        .y2 = MIN(rect->bottom + 1, self->lim.y2) + dy,
+    };
+    logical.x2 = MIN(logical.x2, common_hal_busdisplay_busdisplay_get_width(display));
+    logical.y2 = MIN(logical.y2, common_hal_busdisplay_busdisplay_get_height(display));
+    if (logical.x1 >= logical.x2 || logical.y1 >= logical.y2) {
+        return DECODER_CONTINUE;
+    }
+
+    const displayio_buffer_transform_t *transform = &display->core.transform;
+    bool transpose = transform->transpose_xy;
+    int16_t nx1 = native_coordinate(transform->x, transform->dx, transpose ? logical.y1 : logical.x1);
+    int16_t nx2 = native_coordinate(transform->x, transform->dx, transpose ? logical.y2 - 1 : logical.x2 - 1);
+    int16_t ny1 = native_coordinate(transform->y, transform->dy, transpose ? logical.x1 : logical.y1);
+    int16_t ny2 = native_coordinate(transform->y, transform->dy, transpose ? logical.x2 - 1 : logical.y2 - 1);
+    displayio_area_t native = {
+        .x1 = MIN(nx1, nx2),
+        .y1 = MIN(ny1, ny2),
+        .x2 = MAX(nx1, nx2) + 1,
+        .y2 = MAX(ny1, ny2) + 1,
+    };
+
+    // tjpgd produces byte swapped RGB565, which is what reverse_bytes_in_word displays want.
+    bool swap = !display->core.colorspace.reverse_bytes_in_word;
+    const uint16_t *src = data;
+    int src_width = rect->right - rect->left + 1;
+    uint16_t native_width = displayio_area_width(&native);
+    uint16_t pixels[MAX_BLOCK_PIXELS];
+    for (int16_t ly = logical.y1; ly < logical.y2; ly++) {
+        const uint16_t *src_row = src + (ly - dy - rect->top) * src_width;
+        for (int16_t lx = logical.x1; lx < logical.x2; lx++) {
+            int16_t nx = native_coordinate(transform->x, transform->dx, transpose ? ly : lx);
+            int16_t ny = native_coordinate(transform->y, transform->dy, transpose ? lx : ly);
+            uint16_t pixel = src_row[lx - dx - rect->left];
+            pixels[(ny - native.y1) * native_width + (nx - native.x1)] = swap ? __builtin_bswap16(pixel) : pixel;
+        }
+    }
+
+    if (!busdisplay_busdisplay_write_area(display, &native, (uint8_t *)pixels)) {
+        self->display_busy = true;
+        return DECODER_INTERRUPT;
+    }
+    return DECODER_CONTINUE;
+}
+
+void common_hal_jpegio_jpegdecoder_decode_into_display(
+    jpegio_jpegdecoder_obj_t *self,
+    busdisplay_busdisplay_obj_t *display, int scale, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim) {
+    if (self->data_obj == MP_OBJ_NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
+    }
+    if (display->core.colorspace.depth != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Unsupported colorspace"));
+    }
+
+    self->x = x;
+    self->y = y;
+    self->lim = *lim;
+    self->dest_display = display;
+    self->display_busy = false;
+    JRESULT result = jd_decomp(&self->decoder, display_output, scale);
+    self->dest_display = NULL;
+    common_hal_jpegio_jpegdecoder_close(self);
+    if (self->display_busy) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_display_bus);
+    }
+    if (result != JDR_INTR) {
+        check_jresult(result);
+    }
+}
+#endif
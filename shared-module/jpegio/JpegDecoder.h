@@ -9,6 +9,9 @@
 #include "py/obj.h"
 #include "lib/tjpgd/src/tjpgd.h"
 #include "shared-module/displayio/Bitmap.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
 
 #define TJPGD_WORKSPACE_SIZE 3500
 
@@ -19,6 +22,10 @@ typedef struct jpegio_jpegdecoder_obj {
     mp_obj_t data_obj;
     mp_buffer_info_t bufinfo;
     displayio_bitmap_t *dest;
+    #if CIRCUITPY_BUSDISPLAY
+    busdisplay_busdisplay_obj_t *dest_display;
+    bool display_busy;
+    #endif
     uint16_t x, y;
     bitmaptools_rect_t lim;
     uint32_t skip_source_index, skip_dest_index;
@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/keypad/Event.h"
 #include "shared-bindings/keypad/EventQueue.h"
 #include "shared-bindings/supervisor/__init__.h"
@@ -13,7 +15,21 @@
 #define EVENT_PRESSED (1 << 15)
 #define EVENT_KEY_NUM_MASK ((1 << 15) - 1)
 
-#define EVENT_SIZE_BYTES (sizeof(uint16_t) + sizeof(mp_obj_t))
+// Timestamps are stored as plain ticks; supervisor.ticks_ms() always fits in a small int.
+#define EVENT_SIZE_BYTES (sizeof(uint16_t) + sizeof(uint32_t))
+
+// Events go in and out of the ringbuf whole so the scanner can record them while they are being
+// read without any locking.
+static bool get_encoded_event(keypad_eventqueue_obj_t *self, uint16_t *encoded_event, uint32_t *ticks) {
+    uint8_t bytes[EVENT_SIZE_BYTES];
+    if (ringbuf_num_filled(&self->encoded_events) < EVENT_SIZE_BYTES) {
+        return false;
+    }
+    ringbuf_get_n(&self->encoded_events, bytes, EVENT_SIZE_BYTES);
+    memcpy(encoded_event, bytes, sizeof(*encoded_event));
+    memcpy(ticks, bytes + sizeof(*encoded_event), sizeof(*ticks));
+    return true;
+}
 
 void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_t max_events) {
     // Event queue is 16-bit values.
@@ -23,18 +39,36 @@ void common_hal_keypad_eventqueue_construct(keypad_eventqueue_obj_t *self, size_
 }
 
 bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event) {
-    int encoded_event = ringbuf_get16(&self->encoded_events);
-    if (encoded_event == -1) {
+    uint16_t encoded_event;
+    uint32_t ticks;
+    if (!get_encoded_event(self, &encoded_event, &ticks)) {
         return false;
     }
-
-    mp_obj_t ticks;
-    ringbuf_get_n(&self->encoded_events, (uint8_t *)&ticks, sizeof(ticks));
     // "Construct" using the existing event.
-    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, ticks);
+    common_hal_keypad_event_construct(event, encoded_event & EVENT_KEY_NUM_MASK, encoded_event & EVENT_PRESSED, MP_OBJ_NEW_SMALL_INT(ticks));
     return true;
 }
 
+size_t common_hal_keypad_eventqueue_get_many_into(keypad_eventqueue_obj_t *self, uint8_t *buf, size_t max_events) {
+    size_t count = 0;
+    while (count < max_events) {
+        uint16_t encoded_event;
+        uint32_t ticks;
+        if (!get_encoded_event(self, &encoded_event, &ticks)) {
+            break;
+        }
+        keypad_eventqueue_record_t record = {
+            .key_number = encoded_event & EVENT_KEY_NUM_MASK,
+            .pressed = (encoded_event & EVENT_PRESSED) != 0,
+            .timestamp = ticks,
+        };
+        // buf may not be aligned.
+        memcpy(buf + count * sizeof(record), &record, sizeof(record));
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
     keypad_event_obj_t *event = mp_obj_malloc(keypad_event_obj_t, &keypad_event_type);
     bool result = common_hal_keypad_eventqueue_get_into(self, event);
@@ -73,7 +107,7 @@ void common_hal_keypad_eventqueue_set_event_handler(keypad_eventqueue_obj_t *sel
 }
 
 bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp) {
-    if (ringbuf_num_empty(&self->encoded_events) == 0) {
+    if (ringbuf_num_empty(&self->encoded_events) < EVENT_SIZE_BYTES) {
         // Queue is full. Set the overflow flag. The caller will decide what else to do.
         common_hal_keypad_eventqueue_set_overflowed(self, true);
         return false;
@@ -83,8 +117,11 @@ bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_numbe
     if (pressed) {
         encoded_event |= EVENT_PRESSED;
     }
-    ringbuf_put16(&self->encoded_events, encoded_event);
-    ringbuf_put_n(&self->encoded_events, (uint8_t *)&timestamp, sizeof(mp_obj_t));
+    uint32_t ticks = mp_obj_get_int_truncated(timestamp);
+    uint8_t bytes[EVENT_SIZE_BYTES];
+    memcpy(bytes, &encoded_event, sizeof(encoded_event));
+    memcpy(bytes + sizeof(encoded_event), &ticks, sizeof(ticks));
+    ringbuf_put_n(&self->encoded_events, bytes, EVENT_SIZE_BYTES);
 
     if (self->event_handler) {
         self->event_handler(self);
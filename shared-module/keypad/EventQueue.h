@@ -18,4 +18,11 @@ struct _keypad_eventqueue_obj_t {
     void (*event_handler)(keypad_eventqueue_obj_t *);
 };
 
+// Layout of each event copied out by common_hal_keypad_eventqueue_get_many_into().
+typedef struct {
+    uint16_t key_number;
+    uint16_t pressed;
+    uint32_t timestamp;
+} keypad_eventqueue_record_t;
+
 bool keypad_eventqueue_record(keypad_eventqueue_obj_t *self, mp_uint_t key_number, bool pressed, mp_obj_t timestamp);
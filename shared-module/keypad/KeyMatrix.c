@@ -31,6 +31,18 @@ static mp_uint_t row_column_to_key_number(keypad_keymatrix_obj_t *self, mp_uint_
 }
 
 void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, const mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, const mcu_pin_obj_t *column_pins[], bool columns_to_anodes, mp_float_t interval, size_t max_events, uint8_t debounce_threshold) {
+    self->columns_to_anodes = columns_to_anodes;
+    self->funcs = &keymatrix_funcs;
+
+    #if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+    self->pio = NULL;
+    if (keypad_keymatrix_pio_construct(self, num_row_pins, row_pins, num_column_pins, column_pins)) {
+        self->row_digitalinouts = mp_obj_new_tuple(num_row_pins, (const mp_obj_t *)row_pins);
+        self->column_digitalinouts = mp_obj_new_tuple(num_column_pins, (const mp_obj_t *)column_pins);
+        keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events, debounce_threshold);
+        return;
+    }
+    #endif
 
     mp_obj_t row_dios[num_row_pins];
     for (size_t row = 0; row < num_row_pins; row++) {
@@ -53,9 +65,6 @@ void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint
     }
     self->column_digitalinouts = mp_obj_new_tuple(num_column_pins, column_dios);
 
-    self->columns_to_anodes = columns_to_anodes;
-    self->funcs = &keymatrix_funcs;
-
     keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events, debounce_threshold);
 }
 
@@ -67,6 +76,16 @@ void common_hal_keypad_keymatrix_deinit(keypad_keymatrix_obj_t *self) {
     // Remove self from the list of active keypad scanners first.
     keypad_deregister_scanner((keypad_scanner_obj_t *)self);
 
+    #if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+    if (self->pio != NULL) {
+        keypad_keymatrix_pio_deinit(self);
+        self->row_digitalinouts = MP_ROM_NONE;
+        self->column_digitalinouts = MP_ROM_NONE;
+        common_hal_keypad_deinit_core(self);
+        return;
+    }
+    #endif
+
     for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
         common_hal_digitalio_digitalinout_deinit(self->row_digitalinouts->items[row]);
     }
@@ -102,9 +121,38 @@ static size_t keymatrix_get_key_count(void *self_in) {
     return common_hal_keypad_keymatrix_get_column_count(self) * common_hal_keypad_keymatrix_get_row_count(self);
 }
 
+#if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+// The port has already scanned the matrix, so only debounce the latest samples.
+static void keymatrix_scan_samples(keypad_keymatrix_obj_t *self, mp_obj_t timestamp) {
+    const volatile uint32_t *samples = keypad_keymatrix_pio_get_samples(self);
+    const size_t num_columns = common_hal_keypad_keymatrix_get_column_count(self);
+    for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
+        // A pressed key pulls its column to the row's driven level.
+        uint32_t pressed = samples[row];
+        if (self->columns_to_anodes) {
+            pressed = ~pressed;
+        }
+        for (size_t column = 0; column < num_columns; column++) {
+            mp_uint_t key_number = row_column_to_key_number(self, row, column);
+            const bool current = (pressed >> column) & 1;
+            if (keypad_debounce((keypad_scanner_obj_t *)self, key_number, current)) {
+                keypad_eventqueue_record(self->events, key_number, current, timestamp);
+            }
+        }
+    }
+}
+#endif
+
 static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
     keypad_keymatrix_obj_t *self = self_in;
 
+    #if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+    if (self->pio != NULL) {
+        keymatrix_scan_samples(self, timestamp);
+        return;
+    }
+    #endif
+
     // On entry, all pins are set to inputs with a pull-up or pull-down,
     // depending on the diode orientation.
     for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
@@ -15,9 +15,22 @@
 
 typedef struct {
     KEYPAD_SCANNER_COMMON_FIELDS;
+    // When pio is set, these hold the pins themselves because the port owns them.
     mp_obj_tuple_t *row_digitalinouts;
     mp_obj_tuple_t *column_digitalinouts;
+    #if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+    struct _keypad_keymatrix_pio_t *pio;
+    #endif
     bool columns_to_anodes;
 } keypad_keymatrix_obj_t;
 
 void keypad_keymatrix_scan(keypad_keymatrix_obj_t *self);
+
+#if CIRCUITPY_KEYPAD_KEYMATRIX_PIO
+// Implemented by the port. Start scanning the matrix in hardware and set self->pio, or return false
+// if these pins can't be scanned that way so the matrix is scanned in software instead.
+bool keypad_keymatrix_pio_construct(keypad_keymatrix_obj_t *self, mp_uint_t num_row_pins, const mcu_pin_obj_t *row_pins[], mp_uint_t num_column_pins, const mcu_pin_obj_t *column_pins[]);
+void keypad_keymatrix_pio_deinit(keypad_keymatrix_obj_t *self);
+// The latest column pin levels sampled for each row, with the first column pin in bit 0.
+const volatile uint32_t *keypad_keymatrix_pio_get_samples(keypad_keymatrix_obj_t *self);
+#endif
@@ -37,6 +37,21 @@ void keypad_tick(void) {
     }
 }
 
+uint64_t keypad_next_scan_ticks(void) {
+    uint64_t next = UINT64_MAX;
+    // Report a scan due now if the list is busy so the caller doesn't sleep past it.
+    if (!supervisor_try_lock(&keypad_scanners_linked_list_lock)) {
+        return 0;
+    }
+    keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_linked_list);
+    while (scanner) {
+        next = MIN(next, scanner->next_scan_ticks);
+        scanner = scanner->next;
+    }
+    supervisor_release_lock(&keypad_scanners_linked_list_lock);
+    return next;
+}
+
 void keypad_reset(void) {
     keypad_scanner_obj_t *scanner = MP_STATE_VM(keypad_scanners_linked_list);
     keypad_scanner_obj_t *next = MP_STATE_VM(keypad_scanners_linked_list);
@@ -56,14 +71,14 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner) {
     MP_STATE_VM(keypad_scanners_linked_list) = scanner;
     supervisor_release_lock(&keypad_scanners_linked_list_lock);
 
-    // One more request for ticks.
-    supervisor_enable_tick();
+    // One more request for ticks. Delays may skip ticks until keypad_next_scan_ticks().
+    supervisor_enable_deadline_tick();
 }
 
 // Remove scanner from the list of active scanners.
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner) {
     // One less request for ticks.
-    supervisor_disable_tick();
+    supervisor_disable_deadline_tick();
 
     supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
     if (MP_STATE_VM(keypad_scanners_linked_list) == scanner) {
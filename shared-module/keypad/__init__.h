@@ -35,6 +35,8 @@ typedef struct _keypad_scanner_obj_t {
 extern supervisor_lock_t keypad_scanners_linked_list_lock;
 
 void keypad_tick(void);
+// Raw tick of the next scan that is due, or UINT64_MAX when there are no scanners.
+uint64_t keypad_next_scan_ticks(void);
 void keypad_reset(void);
 
 void keypad_register_scanner(keypad_scanner_obj_t *scanner);
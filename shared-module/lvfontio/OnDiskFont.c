@@ -46,11 +46,34 @@ static inline void free_memory(lvfontio_ondiskfont_t *self, void *ptr) {
     }
 }
 
+// Glyph data is bit packed. f_read() has a fixed cost per call, so it is read through a small
+// buffer instead of a byte at a time.
+typedef struct {
+    FIL *file;
+    uint16_t pos;
+    uint16_t len;
+    uint8_t byte_val;
+    uint8_t remaining_bits;
+    uint8_t buffer[64];
+} bit_reader_t;
+
+static void bit_reader_init(bit_reader_t *reader, FIL *file) {
+    reader->file = file;
+    reader->pos = 0;
+    reader->len = 0;
+    reader->remaining_bits = 0;
+}
+
+// Each glyph starts on a byte boundary.
+static void bit_reader_align(bit_reader_t *reader) {
+    reader->remaining_bits = 0;
+}
+
 // Forward declarations for helper functions
 static int16_t find_codepoint_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint);
-static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint);
-static FRESULT read_bits(FIL *file, size_t num_bits, uint8_t *byte_val, uint8_t *remaining_bits, uint32_t *result);
-static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self, uint32_t *advance_width, int32_t *bbox_x, int32_t *bbox_y, uint32_t *bbox_w, uint32_t *bbox_h, uint8_t *byte_val, uint8_t *remaining_bits);
+static uint16_t find_free_slots(lvfontio_ondiskfont_t *self, uint32_t codepoint, uint16_t slots_needed);
+static FRESULT read_bits(bit_reader_t *reader, size_t num_bits, uint32_t *result);
+static FRESULT read_glyph_dimensions(bit_reader_t *reader, lvfontio_ondiskfont_t *self, uint32_t *advance_width, int32_t *bbox_x, int32_t *bbox_y, uint32_t *bbox_w, uint32_t *bbox_h);
 
 // Load font header data from file
 static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max_slots) {
@@ -139,7 +162,7 @@ static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max
                 (cmap_header[2] << 16) | (cmap_header[3] << 24);
 
             // Allocate memory for cmap ranges
-            self->cmap_range_count = subtable_count;
+            self->cmap_range_count = 0;
             self->cmap_ranges = allocate_memory(self, sizeof(lvfontio_cmap_range_t) * subtable_count);
             if (self->cmap_ranges == NULL) {
                 return false;
@@ -171,13 +194,23 @@ static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max
                     continue;
                 }
 
-                // Store the range information
-                self->cmap_ranges[i].range_start = range_start;
-                self->cmap_ranges[i].range_end = range_start + range_length;
-                self->cmap_ranges[i].glyph_offset = glyph_offset;
-                self->cmap_ranges[i].format_type = format_type;
-                self->cmap_ranges[i].data_offset = current_position + data_offset;
-                self->cmap_ranges[i].entries_count = entries_count;
+                // Store the range information, keeping the ranges sorted so get_char_id() can
+                // binary search them.
+                lvfontio_cmap_range_t range = {
+                    .range_start = range_start,
+                    .range_end = range_start + range_length,
+                    .glyph_offset = glyph_offset,
+                    .format_type = format_type,
+                    .entries_count = entries_count,
+                    .data_offset = current_position + data_offset,
+                };
+                uint16_t j = self->cmap_range_count;
+                while (j > 0 && self->cmap_ranges[j - 1].range_start > range_start) {
+                    self->cmap_ranges[j] = self->cmap_ranges[j - 1];
+                    j--;
+                }
+                self->cmap_ranges[j] = range;
+                self->cmap_range_count++;
             }
 
             found_cmap = true;
@@ -209,6 +242,8 @@ static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max
 
             // Set the default advance width based on the first character in the
             // file.
+            bit_reader_t reader;
+            bit_reader_init(&reader, file);
             size_t cid = 0;
             while (cid < self->max_cid - 1) {
                 // Read glyph header fields
@@ -216,14 +251,13 @@ static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max
                 int32_t bbox_x, bbox_y;
                 uint32_t bbox_w, bbox_h;
 
-                uint8_t byte_val = 0;
-                uint8_t remaining_bits = 0;
+                bit_reader_align(&reader);
 
                 // Use the helper function to read glyph dimensions
-                read_glyph_dimensions(file, self, &glyph_advance, &bbox_x, &bbox_y, &bbox_w, &bbox_h, &byte_val, &remaining_bits);
+                read_glyph_dimensions(&reader, self, &glyph_advance, &bbox_x, &bbox_y, &bbox_w, &bbox_h);
 
                 // Throw away the bitmap bits.
-                read_bits(file, self->header.bits_per_pixel * bbox_w * bbox_h, &byte_val, &remaining_bits, NULL);
+                read_bits(&reader, self->header.bits_per_pixel * bbox_w * bbox_h, NULL);
                 if (advances[0] == glyph_advance) {
                     advance_count[0]++;
                 } else if (advances[1] == glyph_advance) {
@@ -281,105 +315,131 @@ static bool load_font_header(lvfontio_ondiskfont_t *self, FIL *file, size_t *max
     return true;
 }
 
+static bool read_u16_at(lvfontio_ondiskfont_t *self, uint32_t offset, uint16_t *value) {
+    uint8_t buf[2];
+    UINT bytes_read;
+    if (f_lseek(&self->file, offset) != FR_OK ||
+        f_read(&self->file, buf, 2, &bytes_read) != FR_OK || bytes_read < 2) {
+        return false;
+    }
+    *value = buf[0] | (buf[1] << 8);
+    return true;
+}
+
 // Get character ID (glyph index) for a codepoint
 static int32_t get_char_id(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
-    // Find codepoint in cmap ranges
-    for (uint16_t i = 0; i < self->cmap_range_count; i++) {
-        // Check if codepoint is in range for this subtable
-        if (codepoint >= self->cmap_ranges[i].range_start &&
-            codepoint < self->cmap_ranges[i].range_end) {
-
-            // Handle according to format type
-            switch (self->cmap_ranges[i].format_type) {
-                case 0: { // Sparse mapping - need to look up in a sparse table
-                    if (!self->file_is_open) {
-                        return -1;
-                    }
+    // Find the last range starting at or before the codepoint
+    uint16_t lo = 0;
+    uint16_t hi = self->cmap_range_count;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (self->cmap_ranges[mid].range_start <= codepoint) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0 || codepoint >= self->cmap_ranges[lo - 1].range_end) {
+        return -1; // Not found
+    }
+    const lvfontio_cmap_range_t *range = &self->cmap_ranges[lo - 1];
 
-                    // Calculate the relative position within the range
-                    uint32_t idx = codepoint - self->cmap_ranges[i].range_start;
+    // Handle according to format type
+    switch (range->format_type) {
+        case 0: { // Sparse mapping - need to look up in a sparse table
+            if (!self->file_is_open) {
+                return -1;
+            }
 
-                    if (idx >= self->cmap_ranges[i].entries_count) {
-                        return -1;
-                    }
+            // Calculate the relative position within the range
+            uint32_t idx = codepoint - range->range_start;
 
-                    // Calculate the absolute data position in the file
-                    uint32_t data_pos = self->cmap_ranges[i].data_offset + idx; // 1 byte per entry
-                    FRESULT res = f_lseek(&self->file, data_pos);
-                    if (res != FR_OK) {
-                        return -1;
-                    }
+            if (idx >= range->entries_count) {
+                return -1;
+            }
 
-                    // Read the glyph ID (1 byte)
-                    uint8_t glyph_id;
-                    UINT bytes_read;
-                    res = f_read(&self->file, &glyph_id, 1, &bytes_read);
+            // Calculate the absolute data position in the file
+            uint32_t data_pos = range->data_offset + idx; // 1 byte per entry
+            FRESULT res = f_lseek(&self->file, data_pos);
+            if (res != FR_OK) {
+                return -1;
+            }
 
-                    if (res != FR_OK || bytes_read < 1) {
-                        return -1;
-                    }
+            // Read the glyph ID (1 byte)
+            uint8_t glyph_id;
+            UINT bytes_read;
+            res = f_read(&self->file, &glyph_id, 1, &bytes_read);
 
+            if (res != FR_OK || bytes_read < 1) {
+                return -1;
+            }
 
-                    return self->cmap_ranges[i].glyph_offset + glyph_id;
-                }
+            return range->glyph_offset + glyph_id;
+        }
 
-                case 2: // Range to range - calculate based on offset within range
-                    uint16_t idx = codepoint - self->cmap_ranges[i].range_start;
-                    uint16_t glyph_id = self->cmap_ranges[i].glyph_offset + idx;
-                    return glyph_id;
+        case 2: { // Range to range - calculate based on offset within range
+            uint16_t idx = codepoint - range->range_start;
+            uint16_t glyph_id = range->glyph_offset + idx;
+            return glyph_id;
+        }
 
-                case 3: { // Direct mapping - need to look up in the table
-                    if (!self->file_is_open) {
-                        return -1;
-                    }
+        case 3: { // Direct mapping - need to look up in the table
+            if (!self->file_is_open) {
+                return -1;
+            }
 
-                    FRESULT res;
-                    res = f_lseek(&self->file, self->cmap_ranges[i].data_offset);
-                    if (res != FR_OK) {
-                        return -1;
-                    }
-                    uint16_t codepoint_delta = codepoint - self->cmap_ranges[i].range_start;
-
-                    for (size_t j = 0; j < self->cmap_ranges[i].entries_count; j++) {
-                        // Read code point at the index
-                        uint16_t candidate_codepoint_delta;
-                        res = f_read(&self->file, &candidate_codepoint_delta, 2, NULL);
-                        if (res != FR_OK) {
-                            return -1;
-                        }
-
-                        if (candidate_codepoint_delta == codepoint_delta) {
-                            return self->cmap_ranges[i].glyph_offset + j;
-                        }
-                    }
+            // The table holds ascending codepoint deltas, so binary search it. Each probe is a
+            // seek within the same few sectors, which the file's sector buffer keeps cheap.
+            uint16_t codepoint_delta = codepoint - range->range_start;
+            size_t first = 0;
+            size_t last = range->entries_count;
+            while (first < last) {
+                size_t mid = first + (last - first) / 2;
+                uint16_t candidate_codepoint_delta;
+                if (!read_u16_at(self, range->data_offset + mid * 2, &candidate_codepoint_delta)) {
                     return -1;
                 }
-
-                default:
-                    return -1;
+                if (candidate_codepoint_delta == codepoint_delta) {
+                    return range->glyph_offset + mid;
+                }
+                if (candidate_codepoint_delta < codepoint_delta) {
+                    first = mid + 1;
+                } else {
+                    last = mid;
+                }
             }
+            return -1;
         }
-    }
 
-    return -1; // Not found
+        default:
+            return -1;
+    }
 }
 
 // Load glyph bitmap data into a slot
-// This function assumes the file is already open and positioned after reading the glyph dimensions
-static bool load_glyph_bitmap(FIL *file, lvfontio_ondiskfont_t *self, uint32_t codepoint, uint16_t slot,
-    uint32_t glyph_advance, int32_t bbox_x, int32_t bbox_y, uint32_t bbox_w, uint32_t bbox_h,
-    uint8_t *byte_val, uint8_t *remaining_bits) {
-    // Store codepoint at slot
-    self->codepoints[slot] = codepoint;
-    self->reference_counts[slot] = 1;
-
-    // Read bitmap data pixel by pixel
+// This function assumes the reader is positioned after the glyph dimensions
+static bool load_glyph_bitmap(bit_reader_t *reader, lvfontio_ondiskfont_t *self, uint16_t slot, uint16_t slots_needed,
+    int32_t bbox_x, int32_t bbox_y, uint32_t bbox_w, uint32_t bbox_h) {
     uint16_t x_offset = slot * self->header.default_advance_width;
     uint16_t y_offset = self->header.ascent - bbox_y - bbox_h;
+    displayio_area_t slot_area = {
+        x_offset, 0,
+        x_offset + slots_needed * self->header.default_advance_width, self->header.font_size,
+        NULL
+    };
+
+    // Clear whatever glyph was evicted from the slots
+    for (int16_t y = slot_area.y1; y < slot_area.y2; y++) {
+        for (int16_t x = slot_area.x1; x < slot_area.x2; x++) {
+            displayio_bitmap_write_pixel(self->bitmap, x, y, 0);
+        }
+    }
+
+    // Read bitmap data pixel by pixel
     for (uint16_t y = 0; y < bbox_h; y++) {
         for (uint16_t x = 0; x < bbox_w; x++) {
             uint32_t pixel_value;
-            FRESULT res = read_bits(file, self->header.bits_per_pixel, byte_val, remaining_bits, &pixel_value);
+            FRESULT res = read_bits(reader, self->header.bits_per_pixel, &pixel_value);
             if (res != FR_OK) {
                 return false;
             }
@@ -393,15 +453,11 @@ static bool load_glyph_bitmap(FIL *file, lvfontio_ondiskfont_t *self, uint32_t c
                 bitmap_x < self->header.default_advance_width * self->max_glyphs &&
                 bitmap_y >= 0 &&
                 bitmap_y < self->header.font_size) {
-                common_hal_displayio_bitmap_set_pixel(
-                    self->bitmap,
-                    bitmap_x,
-                    bitmap_y,
-                    pixel_value
-                    );
+                displayio_bitmap_write_pixel(self->bitmap, bitmap_x, bitmap_y, pixel_value);
             }
         }
     }
+    displayio_bitmap_set_dirty_area(self->bitmap, &slot_area);
 
     return true;
 }
@@ -418,6 +474,10 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     self->file_path = file_path; // Store the provided path string directly
     self->max_glyphs = max_glyphs;
     self->cmap_ranges = NULL;
+    self->codepoints = NULL;
+    self->reference_counts = NULL;
+    self->last_used = NULL;
+    self->bitmap = NULL;
     self->file_is_open = false;
 
     // Determine which filesystem to use based on the path
@@ -444,7 +504,7 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     self->file_is_open = true;
 
     // Load font headers
-    size_t max_slots;
+    size_t max_slots = max_glyphs;
     if (!load_font_header(self, &self->file, &max_slots)) {
         f_close(&self->file);
         self->file_is_open = false;
@@ -455,7 +515,10 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     }
     // Cap the number of slots to the number of slots needed by the font. That way
     // small font files don't need a bunch of extra cache space.
-    max_glyphs = MIN(max_glyphs, max_slots);
+    if (max_slots > 0) {
+        max_glyphs = MIN(max_glyphs, max_slots);
+    }
+    self->max_glyphs = max_glyphs;
 
     // Allocate codepoints array. allocate_memory will raise an exception if
     // allocation fails and the VM is active.
@@ -478,14 +541,22 @@ void common_hal_lvfontio_ondiskfont_construct(lvfontio_ondiskfont_t *self,
     // Initialize reference counts to 0
     memset(self->reference_counts, 0, sizeof(uint16_t) * max_glyphs);
 
+    // Allocate use stamps for least recently used eviction
+    self->last_used = allocate_memory(self, sizeof(uint32_t) * max_glyphs);
+    if (self->last_used == NULL) {
+        return;
+    }
+    memset(self->last_used, 0, sizeof(uint32_t) * max_glyphs);
+    self->use_count = 0;
+
     self->half_width_px = self->header.default_advance_width;
 
     // Create bitmap for glyph cache
     displayio_bitmap_t *bitmap = allocate_memory(self, sizeof(displayio_bitmap_t));
-    bitmap->base.type = &displayio_bitmap_type;
     if (bitmap == NULL) {
         return;
     }
+    bitmap->base.type = &displayio_bitmap_type;
 
     // Calculate bitmap stride
     uint32_t bits_per_pixel = 1 << self->header.bits_per_pixel;
@@ -533,6 +604,11 @@ void common_hal_lvfontio_ondiskfont_deinit(lvfontio_ondiskfont_t *self) {
         self->reference_counts = NULL;
     }
 
+    if (self->last_used != NULL) {
+        free_memory(self, self->last_used);
+        self->last_used = NULL;
+    }
+
 
 
     if (self->cmap_ranges != NULL) {
@@ -569,22 +645,45 @@ void common_hal_lvfontio_ondiskfont_get_dimensions(const lvfontio_ondiskfont_t *
     }
 }
 
+static void touch_slots(lvfontio_ondiskfont_t *self, uint16_t slot, uint16_t count) {
+    self->use_count++;
+    for (uint16_t i = slot; i < slot + count; i++) {
+        self->last_used[i] = self->use_count;
+    }
+}
+
+// Forget the glyph held in a slot, including the other half of a full-width glyph.
+static void evict_slot(lvfontio_ondiskfont_t *self, uint16_t slot) {
+    uint32_t codepoint = self->codepoints[slot];
+    if (codepoint == LVFONTIO_INVALID_CODEPOINT) {
+        return;
+    }
+    if (slot > 0 && self->codepoints[slot - 1] == codepoint) {
+        self->codepoints[slot - 1] = LVFONTIO_INVALID_CODEPOINT;
+    }
+    if (slot + 1 < self->max_glyphs && self->codepoints[slot + 1] == codepoint) {
+        self->codepoints[slot + 1] = LVFONTIO_INVALID_CODEPOINT;
+    }
+    self->codepoints[slot] = LVFONTIO_INVALID_CODEPOINT;
+}
+
 int16_t common_hal_lvfontio_ondiskfont_cache_glyph(lvfontio_ondiskfont_t *self, uint32_t codepoint, bool *is_full_width) {
     // Check if already cached
     int16_t existing_slot = find_codepoint_slot(self, codepoint);
     if (existing_slot >= 0) {
-        // Glyph is already cached, increment reference count
-        self->reference_counts[existing_slot]++;
+        // A full-width glyph fills this slot and the one after it
+        bool existing_full_width = existing_slot + 1 < self->max_glyphs &&
+            self->codepoints[existing_slot + 1] == codepoint;
+        uint16_t slot_count = existing_full_width ? 2 : 1;
+
+        // Glyph is already cached, increment reference count of each tile it covers
+        for (uint16_t i = existing_slot; i < existing_slot + slot_count; i++) {
+            self->reference_counts[i]++;
+        }
+        touch_slots(self, existing_slot, slot_count);
 
-        // Check if this is a full-width character by looking for a second slot
-        // with the same codepoint right after this one
         if (is_full_width != NULL) {
-            if (existing_slot + 1 < self->max_glyphs &&
-                self->codepoints[existing_slot + 1] == codepoint) {
-                *is_full_width = true;
-            } else {
-                *is_full_width = false;
-            }
+            *is_full_width = existing_full_width;
         }
 
         return existing_slot;
@@ -647,11 +746,11 @@ int16_t common_hal_lvfontio_ondiskfont_cache_glyph(lvfontio_ondiskfont_t *self,
     uint32_t bbox_w, bbox_h;
 
     // Initialize bit reading state
-    uint8_t byte_val = 0;
-    uint8_t remaining_bits = 0;
+    bit_reader_t reader;
+    bit_reader_init(&reader, &self->file);
 
     // Use the helper function to read glyph dimensions
-    res = read_glyph_dimensions(&self->file, self, &glyph_advance, &bbox_x, &bbox_y, &bbox_w, &bbox_h, &byte_val, &remaining_bits);
+    res = read_glyph_dimensions(&reader, self, &glyph_advance, &bbox_x, &bbox_y, &bbox_w, &bbox_h);
     if (res != FR_OK) {
         return -1;
     }
@@ -664,40 +763,28 @@ int16_t common_hal_lvfontio_ondiskfont_cache_glyph(lvfontio_ondiskfont_t *self,
     uint16_t slots_needed = is_full_width_glyph ? 2 : 1;
 
     // Find an appropriate slot (or consecutive slots for full-width)
-    uint16_t slot = UINT16_MAX;
-
-    if (slots_needed == 1) {
-        // For regular width, find a free slot starting at codepoint's position
-        slot = find_free_slot(self, codepoint);
-    } else {
-        // For full-width, find two consecutive free slots
-        for (uint16_t i = 0; i < self->max_glyphs - 1; i++) {
-            if (self->codepoints[i] == LVFONTIO_INVALID_CODEPOINT &&
-                self->reference_counts[i] == 0 &&
-                self->codepoints[i + 1] == LVFONTIO_INVALID_CODEPOINT &&
-                self->reference_counts[i + 1] == 0) {
-                slot = i;
-                break;
-            }
-        }
-    }
+    uint16_t slot = find_free_slots(self, codepoint, slots_needed);
 
     // Check if we found appropriate slot(s)
     if (slot == UINT16_MAX) {
         return -1; // No slots available
     }
 
+    for (uint16_t i = slot; i < slot + slots_needed; i++) {
+        evict_slot(self, i);
+    }
+
     // Load glyph into the slot
-    if (!load_glyph_bitmap(&self->file, self, codepoint, slot, glyph_advance,
-        bbox_x, bbox_y, bbox_w, bbox_h, &byte_val, &remaining_bits)) {
+    if (!load_glyph_bitmap(&reader, self, slot, slots_needed, bbox_x, bbox_y, bbox_w, bbox_h)) {
         return -1; // Failed to load glyph
     }
 
     // For full-width characters, mark both slots with the same codepoint
-    if (is_full_width_glyph && slot + 1 < self->max_glyphs) {
-        self->codepoints[slot + 1] = codepoint;
-        self->reference_counts[slot + 1] = 1;
+    for (uint16_t i = slot; i < slot + slots_needed; i++) {
+        self->codepoints[i] = codepoint;
+        self->reference_counts[i] = 1;
     }
+    touch_slots(self, slot, slots_needed);
 
     if (is_full_width != NULL) {
         *is_full_width = is_full_width_glyph;
@@ -716,56 +803,82 @@ void common_hal_lvfontio_ondiskfont_release_glyph(lvfontio_ondiskfont_t *self, u
     }
 }
 
+// Returns the first slot holding the codepoint's glyph.
 static int16_t find_codepoint_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
+    if (self->max_glyphs == 0) {
+        return -1;
+    }
     size_t offset = codepoint % self->max_glyphs;
     for (uint16_t i = 0; i < self->max_glyphs; i++) {
         int16_t slot = (i + offset) % self->max_glyphs;
         if (self->codepoints[slot] == codepoint) {
+            // The search may land on the second half of a full-width glyph.
+            if (slot > 0 && self->codepoints[slot - 1] == codepoint) {
+                slot--;
+            }
             return slot;
         }
     }
     return -1;
 }
 
-static uint16_t find_free_slot(lvfontio_ondiskfont_t *self, uint32_t codepoint) {
-    size_t offset = codepoint % self->max_glyphs;
-
-    // First look for completely unused slots, starting at the offset
-    for (uint16_t i = 0; i < self->max_glyphs; i++) {
-        int16_t slot = (i + offset) % self->max_glyphs;
-        if (self->codepoints[slot] == LVFONTIO_INVALID_CODEPOINT && self->reference_counts[slot] == 0) {
-            return slot;
+// Find slots_needed consecutive slots that no tile is showing. Slots that have never held a
+// glyph are used first, starting at the codepoint's position. Otherwise the least recently used
+// glyphs are evicted.
+static uint16_t find_free_slots(lvfontio_ondiskfont_t *self, uint32_t codepoint, uint16_t slots_needed) {
+    if (slots_needed > self->max_glyphs) {
+        return UINT16_MAX;
+    }
+    uint16_t candidates = self->max_glyphs - slots_needed + 1;
+    size_t offset = codepoint % candidates;
+
+    uint16_t lru_slot = UINT16_MAX;
+    uint32_t lru_stamp = UINT32_MAX;
+    for (uint16_t i = 0; i < candidates; i++) {
+        uint16_t slot = (i + offset) % candidates;
+        bool in_use = false;
+        bool empty = true;
+        uint32_t stamp = 0;
+        for (uint16_t j = slot; j < slot + slots_needed; j++) {
+            if (self->reference_counts[j] != 0) {
+                in_use = true;
+                break;
+            }
+            if (self->codepoints[j] != LVFONTIO_INVALID_CODEPOINT) {
+                empty = false;
+                stamp = MAX(stamp, self->last_used[j]);
+            }
         }
-    }
-
-    // If none found, look for slots with zero reference count, starting at the offset
-    for (uint16_t i = 0; i < self->max_glyphs; i++) {
-        int16_t slot = (i + offset) % self->max_glyphs;
-        if (self->reference_counts[slot] == 0) {
+        if (in_use) {
+            continue;
+        }
+        if (empty) {
             return slot;
         }
+        if (stamp < lru_stamp) {
+            lru_slot = slot;
+            lru_stamp = stamp;
+        }
     }
 
-    // No slots available
-    return UINT16_MAX;
+    return lru_slot;
 }
 
-static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self,
+static FRESULT read_glyph_dimensions(bit_reader_t *reader, lvfontio_ondiskfont_t *self,
     uint32_t *advance_width, int32_t *bbox_x, int32_t *bbox_y,
-    uint32_t *bbox_w, uint32_t *bbox_h,
-    uint8_t *byte_val, uint8_t *remaining_bits) {
+    uint32_t *bbox_w, uint32_t *bbox_h) {
     FRESULT res;
     uint32_t temp_value;
 
     // Read glyph_advance
-    res = read_bits(file, self->header.glyph_advance_bits, byte_val, remaining_bits, &temp_value);
+    res = read_bits(reader, self->header.glyph_advance_bits, &temp_value);
     if (res != FR_OK) {
         return res;
     }
     *advance_width = temp_value;
 
     // Read bbox_x (signed)
-    res = read_bits(file, self->header.glyph_bbox_xy_bits, byte_val, remaining_bits, &temp_value);
+    res = read_bits(reader, self->header.glyph_bbox_xy_bits, &temp_value);
     if (res != FR_OK) {
         return res;
     }
@@ -777,7 +890,7 @@ static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self,
     }
 
     // Read bbox_y (signed)
-    res = read_bits(file, self->header.glyph_bbox_xy_bits, byte_val, remaining_bits, &temp_value);
+    res = read_bits(reader, self->header.glyph_bbox_xy_bits, &temp_value);
     if (res != FR_OK) {
         return res;
     }
@@ -789,14 +902,14 @@ static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self,
     }
 
     // Read bbox_w
-    res = read_bits(file, self->header.glyph_bbox_wh_bits, byte_val, remaining_bits, &temp_value);
+    res = read_bits(reader, self->header.glyph_bbox_wh_bits, &temp_value);
     if (res != FR_OK) {
         return res;
     }
     *bbox_w = temp_value;
 
     // Read bbox_h
-    res = read_bits(file, self->header.glyph_bbox_wh_bits, byte_val, remaining_bits, &temp_value);
+    res = read_bits(reader, self->header.glyph_bbox_wh_bits, &temp_value);
     if (res != FR_OK) {
         return res;
     }
@@ -805,35 +918,44 @@ static FRESULT read_glyph_dimensions(FIL *file, lvfontio_ondiskfont_t *self,
     return FR_OK;
 }
 
-static FRESULT read_bits(FIL *file, size_t num_bits, uint8_t *byte_val, uint8_t *remaining_bits, uint32_t *result) {
-    FRESULT res = FR_OK;
-    UINT bytes_read;
-
+static FRESULT read_bits(bit_reader_t *reader, size_t num_bits, uint32_t *result) {
     uint32_t value = 0;
     // Bits will be lost when num_bits > 32. However, this is good for skipping bits.
     size_t bits_needed = num_bits;
 
     while (bits_needed > 0) {
-        // If no bits remaining, read a new byte
-        if (*remaining_bits == 0) {
-            res = f_read(file, byte_val, 1, &bytes_read);
-            if (res != FR_OK || bytes_read < 1) {
-                return FR_DISK_ERR;
+        // If no bits remaining, take the next byte
+        if (reader->remaining_bits == 0) {
+            if (reader->pos == reader->len) {
+                UINT bytes_read;
+                FRESULT res = f_read(reader->file, reader->buffer, sizeof(reader->buffer), &bytes_read);
+                if (res != FR_OK || bytes_read < 1) {
+                    return FR_DISK_ERR;
+                }
+                reader->pos = 0;
+                reader->len = bytes_read;
+            }
+            // Whole bytes that are being skipped don't need to be unpacked.
+            if (result == NULL && bits_needed >= 8) {
+                size_t skip = MIN(bits_needed / 8, (size_t)(reader->len - reader->pos));
+                reader->pos += skip;
+                bits_needed -= skip * 8;
+                continue;
             }
-            *remaining_bits = 8;
+            reader->byte_val = reader->buffer[reader->pos++];
+            reader->remaining_bits = 8;
         }
 
         // Calculate how many bits to take from current byte
-        uint8_t bits_to_take = (*remaining_bits < bits_needed) ? *remaining_bits : bits_needed;
-        value = (value << bits_to_take) | (*byte_val >> (8 - bits_to_take));
+        uint8_t bits_to_take = (reader->remaining_bits < bits_needed) ? reader->remaining_bits : bits_needed;
+        value = (value << bits_to_take) | (reader->byte_val >> (8 - bits_to_take));
 
         // Update state
-        *remaining_bits -= bits_to_take;
+        reader->remaining_bits -= bits_to_take;
         bits_needed -= bits_to_take;
 
         // Shift byte for next read
-        *byte_val <<= bits_to_take;
-        *byte_val &= 0xFF;
+        reader->byte_val <<= bits_to_take;
     }
 
     if (result != NULL) {
@@ -52,6 +52,10 @@ typedef struct {
     uint32_t *codepoints;
     // Array of reference counts for each glyph slot
     uint16_t *reference_counts; // Use uint16_t to handle higher reference counts
+    // Array of use stamps for each glyph slot, used to evict the least recently used glyph
+    uint32_t *last_used;
+    // Stamp given to the most recently used slot
+    uint32_t use_count;
     // Maximum number of glyphs to cache at once
     uint16_t max_glyphs;
     // Flag indicating whether to use m_malloc (true) or port_malloc (false)
@@ -64,7 +68,7 @@ typedef struct {
     // Font metrics information loaded from file
     lvfontio_header_t header;
 
-    // CMAP information
+    // CMAP information, sorted by range_start
     lvfontio_cmap_range_t *cmap_ranges;
     uint16_t cmap_range_count;
 
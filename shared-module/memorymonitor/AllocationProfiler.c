@@ -0,0 +1,132 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/memorymonitor/AllocationProfiler.h"
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+
+void common_hal_memorymonitor_allocationprofiler_construct(memorymonitor_allocationprofiler_obj_t *self,
+    size_t interval, size_t slots) {
+    self->entries = m_new(memorymonitor_allocationprofiler_entry_t, slots);
+    self->slots = slots;
+    self->interval = interval;
+    self->next = NULL;
+    self->previous = NULL;
+    common_hal_memorymonitor_allocationprofiler_clear(self);
+}
+
+void common_hal_memorymonitor_allocationprofiler_pause(memorymonitor_allocationprofiler_obj_t *self) {
+    if (self->previous == NULL) {
+        return;
+    }
+    *self->previous = self->next;
+    if (self->next != NULL) {
+        self->next->previous = self->previous;
+    }
+    self->next = NULL;
+    self->previous = NULL;
+}
+
+void common_hal_memorymonitor_allocationprofiler_resume(memorymonitor_allocationprofiler_obj_t *self) {
+    if (self->previous != NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    self->next = MP_OBJ_TO_PTR(MP_STATE_VM(active_allocationprofilers));
+    self->previous = (memorymonitor_allocationprofiler_obj_t **)&MP_STATE_VM(active_allocationprofilers);
+    if (self->next != NULL) {
+        self->next->previous = &self->next;
+    }
+    MP_STATE_VM(active_allocationprofilers) = MP_OBJ_FROM_PTR(self);
+}
+
+void common_hal_memorymonitor_allocationprofiler_clear(memorymonitor_allocationprofiler_obj_t *self) {
+    memset(self->entries, 0, self->slots * sizeof(memorymonitor_allocationprofiler_entry_t));
+    self->countdown = self->interval;
+    self->dropped = 0;
+}
+
+size_t common_hal_memorymonitor_allocationprofiler_get_dropped(memorymonitor_allocationprofiler_obj_t *self) {
+    return self->dropped;
+}
+
+size_t common_hal_memorymonitor_allocationprofiler_get_entries(memorymonitor_allocationprofiler_obj_t *self,
+    memorymonitor_allocationprofiler_entry_t *entries) {
+    size_t len = 0;
+    for (size_t i = 0; i < self->slots; i++) {
+        if (self->entries[i].samples > 0) {
+            entries[len++] = self->entries[i];
+        }
+    }
+    return len;
+}
+
+// Finds the source line the innermost running bytecode function is on.
+static qstr current_source_line(uint32_t *line) {
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        *line = 0;
+        return MP_QSTRnull;
+    }
+    size_t source_line;
+    qstr source_file = mp_code_state_get_source_line(code_state, &source_line);
+    *line = source_line;
+    return source_file;
+}
+
+static void record(memorymonitor_allocationprofiler_obj_t *self, qstr source_file, uint32_t line,
+    size_t samples, size_t bytes) {
+    size_t i = (source_file * 31 + line) % self->slots;
+    for (size_t probe = 0; probe < self->slots; probe++) {
+        memorymonitor_allocationprofiler_entry_t *entry = &self->entries[i];
+        if (entry->samples == 0) {
+            entry->source_file = source_file;
+            entry->line = line;
+        }
+        if (entry->source_file == source_file && entry->line == line) {
+            entry->samples += samples;
+            entry->bytes += bytes;
+            return;
+        }
+        i = (i + 1) % self->slots;
+    }
+    self->dropped += samples;
+}
+
+void memorymonitor_allocationprofilers_track_allocation(size_t block_count) {
+    memorymonitor_allocationprofiler_obj_t *profiler = MP_OBJ_TO_PTR(MP_STATE_VM(active_allocationprofilers));
+    if (profiler == NULL) {
+        return;
+    }
+    size_t bytes = block_count * MICROPY_BYTES_PER_GC_BLOCK;
+    qstr source_file = MP_QSTRnull;
+    uint32_t line = 0;
+    bool located = false;
+    while (profiler != NULL) {
+        if (bytes >= profiler->countdown) {
+            // Each sample stands for interval bytes, so a large allocation can be several.
+            size_t past = bytes - profiler->countdown;
+            profiler->countdown = profiler->interval - past % profiler->interval;
+            if (!located) {
+                source_file = current_source_line(&line);
+                located = true;
+            }
+            record(profiler, source_file, line, 1 + past / profiler->interval, bytes);
+        } else {
+            profiler->countdown -= bytes;
+        }
+        profiler = profiler->next;
+    }
+}
+
+void memorymonitor_allocationprofilers_reset(void) {
+    MP_STATE_VM(active_allocationprofilers) = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t active_allocationprofilers);
@@ -0,0 +1,38 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#include "py/obj.h"
+
+typedef struct _memorymonitor_allocationprofiler_obj_t memorymonitor_allocationprofiler_obj_t;
+
+typedef struct {
+    // MP_QSTRnull for allocations made outside of Python code.
+    qstr source_file;
+    uint32_t line;
+    // 0 when the entry is unused.
+    uint32_t samples;
+    uint32_t bytes;
+} memorymonitor_allocationprofiler_entry_t;
+
+typedef struct _memorymonitor_allocationprofiler_obj_t {
+    mp_obj_base_t base;
+    memorymonitor_allocationprofiler_entry_t *entries;
+    size_t slots;
+    size_t interval;
+    // Bytes left to allocate until the next sample.
+    size_t countdown;
+    size_t dropped;
+    // Store the location that points to us so we can remove ourselves.
+    memorymonitor_allocationprofiler_obj_t **previous;
+    memorymonitor_allocationprofiler_obj_t *next;
+} memorymonitor_allocationprofiler_obj_t;
+
+void memorymonitor_allocationprofilers_track_allocation(size_t block_count);
+void memorymonitor_allocationprofilers_reset(void);
@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -28,21 +29,63 @@ typedef struct _msgpack_stream_t {
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // When unpacking from a buffer in RAM, the data is read straight from it
+    // instead of through stream calls.
+    const byte *buf;
+    size_t pos;
+    size_t len;
+    // Start of the heap block holding buf and the offset of buf in it, so
+    // that bin fields can be memoryviews that keep the input alive.
+    void *view_items;
+    size_t view_offset;
 } msgpack_stream_t;
 
 static msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0, NULL, 0, 0, NULL, 0};
+    return s;
+}
+
+static msgpack_stream_t get_buffer_stream(mp_obj_t buffer_obj) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
+    msgpack_stream_t s = {buffer_obj, NULL, NULL, 0, bufinfo.buf, 0, bufinfo.len, bufinfo.buf, 0};
+    if (mp_obj_get_type(buffer_obj) == &mp_type_memoryview) {
+        // Point at the start of the buffer so the GC can trace it.
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(buffer_obj);
+        s.view_items = view->items;
+        s.view_offset = (const byte *)bufinfo.buf - (const byte *)view->items;
+    }
     return s;
 }
 
 ////////////////////////////////////////////////////////////////
 // readers
 
+// Returns the next size bytes of a buffer source, in place.
+static const byte *read_in_place(msgpack_stream_t *s, size_t size) {
+    if (size == 0) {
+        return s->buf + s->pos;
+    }
+    if (s->pos == s->len) {
+        mp_raise_msg(&mp_type_EOFError, NULL);
+    }
+    if (size > s->len - s->pos) {
+        mp_raise_ValueError(MP_ERROR_TEXT("short read"));
+    }
+    const byte *p = s->buf + s->pos;
+    s->pos += size;
+    return p;
+}
+
 static void read(msgpack_stream_t *s, void *buf, mp_uint_t size) {
     if (size == 0) {
         return;
     }
+    if (s->buf != NULL) {
+        memcpy(buf, read_in_place(s, size), size);
+        return;
+    }
     mp_uint_t ret = s->read(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -342,7 +385,20 @@ static mp_obj_t unpack_array_elements(msgpack_stream_t *s, size_t size, mp_obj_t
     }
 }
 
+static mp_obj_t unpack_map_elements(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook, bool use_list) {
+    mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(size));
+    for (size_t i = 0; i < size; i++) {
+        // The key comes first in the data, and C doesn't fix the order arguments are evaluated in.
+        mp_obj_t key = unpack(s, ext_hook, use_list);
+        mp_obj_dict_store(d, key, unpack(s, ext_hook, use_list));
+    }
+    return MP_OBJ_FROM_PTR(d);
+}
+
 static mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
+    if (s->buf != NULL) {
+        return mp_obj_new_bytes(read_in_place(s, size), size);
+    }
     vstr_t vstr;
     vstr_init_len(&vstr, size);
     byte *p = (byte *)vstr.buf;
@@ -358,6 +414,31 @@ static mp_obj_t unpack_bytes(msgpack_stream_t *s, size_t size) {
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
 
+// bin fields from a buffer source are views of it rather than copies.
+static mp_obj_t unpack_bin(msgpack_stream_t *s, size_t size) {
+    if (s->buf == NULL) {
+        return unpack_bytes(s, size);
+    }
+    size_t offset = s->view_offset + s->pos;
+    const byte *p = read_in_place(s, size);
+    if (offset >> MP_OBJ_ARRAY_FREE_SIZE_BITS) {
+        return mp_obj_new_bytes(p, size);
+    }
+    mp_obj_array_t *view = mp_obj_malloc(mp_obj_array_t, &mp_type_memoryview);
+    mp_obj_memoryview_init(view, BYTEARRAY_TYPECODE, offset, size, s->view_items);
+    return MP_OBJ_FROM_PTR(view);
+}
+
+static mp_obj_t unpack_str(msgpack_stream_t *s, size_t size) {
+    if (s->buf != NULL) {
+        return mp_obj_new_str((const char *)read_in_place(s, size), size);
+    }
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    read(s, vstr.buf, size);
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
 static mp_obj_t unpack_ext(msgpack_stream_t *s, size_t size, mp_obj_t ext_hook) {
     int8_t code = read1(s);
     mp_obj_t data = unpack_bytes(s, size);
@@ -380,6 +461,9 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
     if ((code & 0b11100000) == 0b10100000) {
         // str
         size_t len = code & 0b11111;
+        if (s->buf != NULL) {
+            return unpack_str(s, len);
+        }
         // allocate on stack; len < 32
         char str[len];
         read(s, &str, len);
@@ -391,12 +475,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
     }
     if ((code & 0b11110000) == 0b10000000) {
         // map (dict)
-        size_t len = code & 0b1111;
-        mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
-        for (size_t i = 0; i < len; i++) {
-            mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
-        }
-        return MP_OBJ_FROM_PTR(d);
+        return unpack_map_elements(s, code & 0b1111, ext_hook, use_list);
     }
     switch (code) {
         case 0xc0:
@@ -409,7 +488,7 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xc5:
         case 0xc6: {
             // bin 8, 16, 32
-            return unpack_bytes(s, read_size(s, code - 0xc4));
+            return unpack_bin(s, read_size(s, code - 0xc4));
         }
         case 0xcc: // uint8
             return MP_OBJ_NEW_SMALL_INT((uint8_t)read1(s));
@@ -449,22 +528,12 @@ static mp_obj_t unpack(msgpack_stream_t *s, mp_obj_t ext_hook, bool use_list) {
         case 0xda:
         case 0xdb: {
             // str 8, 16, 32
-            size_t size = read_size(s, code - 0xd9);
-            vstr_t vstr;
-            vstr_init_len(&vstr, size);
-            byte *p = (byte *)vstr.buf;
-            read(s, p, size);
-            return mp_obj_new_str_from_vstr(&vstr);
+            return unpack_str(s, read_size(s, code - 0xd9));
         }
         case 0xde:
         case 0xdf: {
             // map 16 & 32
-            size_t len = read_size(s, code - 0xde + 1);
-            mp_obj_dict_t *d = MP_OBJ_TO_PTR(mp_obj_new_dict(len));
-            for (size_t i = 0; i < len; i++) {
-                mp_obj_dict_store(d, unpack(s, ext_hook, use_list), unpack(s, ext_hook, use_list));
-            }
-            return MP_OBJ_FROM_PTR(d);
+            return unpack_map_elements(s, read_size(s, code - 0xde + 1), ext_hook, use_list);
         }
         case 0xdc:
         case 0xdd: {
@@ -502,3 +571,12 @@ mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
     return unpack(&stream, ext_hook, use_list);
 }
+
+mp_obj_t common_hal_msgpack_unpackb(mp_obj_t buffer_obj, mp_obj_t ext_hook, bool use_list) {
+    msgpack_stream_t stream = get_buffer_stream(buffer_obj);
+    mp_obj_t obj = unpack(&stream, ext_hook, use_list);
+    if (stream.pos != stream.len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("extra data"));
+    }
+    return obj;
+}
@@ -135,6 +135,10 @@ const char *common_hal_os_path_abspath(const char *path) {
 }
 
 void common_hal_os_chdir(const char *path) {
+    #if MICROPY_VFS_IMPORT_STAT_CACHE
+    // Relative paths change meaning.
+    mp_vfs_import_stat_cache_invalidate();
+    #endif
     MP_STATE_VM(cwd_path) = common_hal_os_path_abspath(path);
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(MP_STATE_VM(cwd_path), &path_out);
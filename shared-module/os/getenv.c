@@ -267,6 +267,116 @@ static mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+#if !defined(UNIX)
+// Where each key of /settings.toml starts, so that a lookup can seek to its line instead of
+// reading the file from the top. It is rebuilt when the size or modification time changes.
+#define GETENV_INDEX_MAX (32)
+
+typedef struct {
+    FSIZE_t size;
+    WORD date;
+    WORD time;
+    bool valid;
+    // False if the file has more keys than fit, so a key that isn't indexed may still be there.
+    bool complete;
+    uint8_t count;
+    uint16_t hash[GETENV_INDEX_MAX];
+    uint32_t offset[GETENV_INDEX_MAX];
+} getenv_index_t;
+
+static getenv_index_t getenv_index;
+
+static uint16_t key_hash_add(uint16_t hash, uint8_t character) {
+    return hash * 33 + character;
+}
+
+static uint16_t key_hash(const char *key) {
+    uint16_t hash = 5381;
+    while (*key) {
+        hash = key_hash_add(hash, *key++);
+    }
+    return hash;
+}
+
+// Records the key at the start of the current line, if there is one, and moves to the next line.
+// Returns false at a table header or the end of the file.
+static bool index_line(file_arg *active_file) {
+    uint32_t offset = f_tell(active_file);
+    uint8_t character = consume_whitespace(active_file);
+    if (character == '[' || character == 0) {
+        return false;
+    }
+    uint16_t hash = 5381;
+    bool has_key = false;
+    while (character != '\n' && character != 0 && character != '=' && !unichar_isspace(character) && character != '#') {
+        hash = key_hash_add(hash, character);
+        has_key = true;
+        character = get_next_byte(active_file);
+    }
+    if (has_key) {
+        if (getenv_index.count < GETENV_INDEX_MAX) {
+            getenv_index.hash[getenv_index.count] = hash;
+            getenv_index.offset[getenv_index.count] = offset;
+            getenv_index.count++;
+        } else {
+            getenv_index.complete = false;
+        }
+    }
+    if (character != '\n') {
+        next_line(active_file);
+    }
+    return true;
+}
+
+// Returns false if the index can't be used.
+static bool update_index(file_arg *active_file) {
+    fs_user_mount_t *fs_mount = filesystem_circuitpy();
+    FILINFO file_info;
+    if (fs_mount == NULL || f_stat(&fs_mount->fatfs, GETENV_PATH, &file_info) != FR_OK) {
+        getenv_index.valid = false;
+        return false;
+    }
+    if (getenv_index.valid && getenv_index.size == file_info.fsize &&
+        getenv_index.date == file_info.fdate && getenv_index.time == file_info.ftime) {
+        return true;
+    }
+    getenv_index.size = file_info.fsize;
+    getenv_index.date = file_info.fdate;
+    getenv_index.time = file_info.ftime;
+    getenv_index.count = 0;
+    getenv_index.complete = true;
+    while (!is_eof(active_file) && index_line(active_file)) {
+    }
+    getenv_index.valid = !f_error(active_file);
+    return getenv_index.valid;
+}
+
+static os_getenv_err_t indexed_getenv_vstr(file_arg *active_file, const char *key, vstr_t *buf, bool *quoted) {
+    uint16_t hash = key_hash(key);
+    for (size_t i = 0; i < getenv_index.count; i++) {
+        if (getenv_index.hash[i] != hash) {
+            continue;
+        }
+        f_lseek(active_file, getenv_index.offset[i]);
+        if (key_matches(active_file, key)) {
+            return read_value(active_file, buf, quoted);
+        }
+    }
+    if (getenv_index.complete) {
+        return GETENV_ERR_NOT_FOUND;
+    }
+    f_lseek(active_file, 0);
+    os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
+    while (!is_eof(active_file)) {
+        if (key_matches(active_file, key)) {
+            result = read_value(active_file, buf, quoted);
+            break;
+        }
+    }
+    return result;
+}
+#endif
+
 static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
     if (!open_file(path, &active_file)) {
@@ -274,6 +384,14 @@ static os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t
     }
 
     os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
+    #if !defined(UNIX)
+    if (strcmp(path, GETENV_PATH) == 0 && update_index(&active_file)) {
+        result = indexed_getenv_vstr(&active_file, key, buf, quoted);
+        close_file(&active_file);
+        return result;
+    }
+    f_lseek(&active_file, 0);
+    #endif
     while (!is_eof(&active_file)) {
         if (key_matches(&active_file, key)) {
             result = read_value(&active_file, buf, quoted);
@@ -18,3 +18,13 @@ MP_WEAK void common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(p
 MP_WEAK void common_hal_paralleldisplaybus_parallelbus_collect_ptrs(mp_obj_t self) {
 
 }
+
+// Ports that can't send in the background return false and the display falls back to
+// common_hal_paralleldisplaybus_parallelbus_send.
+MP_WEAK bool common_hal_paralleldisplaybus_parallelbus_start_send(mp_obj_t self, display_byte_type_t byte_type,
+    display_chip_select_behavior_t chip_select, const uint8_t *data, uint32_t data_length) {
+    return false;
+}
+
+MP_WEAK void common_hal_paralleldisplaybus_parallelbus_finish_send(mp_obj_t self) {
+}
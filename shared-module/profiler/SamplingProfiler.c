@@ -0,0 +1,150 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/profiler/SamplingProfiler.h"
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "supervisor/shared/tick.h"
+
+void common_hal_profiler_samplingprofiler_construct(profiler_samplingprofiler_obj_t *self,
+    size_t interval, size_t slots) {
+    self->entries = m_new(profiler_samplingprofiler_entry_t, slots);
+    self->slots = slots;
+    self->interval = interval;
+    self->ring_read = 0;
+    self->ring_write = 0;
+    common_hal_profiler_samplingprofiler_clear(self);
+}
+
+bool common_hal_profiler_samplingprofiler_get_running(profiler_samplingprofiler_obj_t *self) {
+    return MP_STATE_VM(running_samplingprofiler) == MP_OBJ_FROM_PTR(self);
+}
+
+void common_hal_profiler_samplingprofiler_start(profiler_samplingprofiler_obj_t *self) {
+    if (common_hal_profiler_samplingprofiler_get_running(self)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Already running"));
+    }
+    // The tick only looks at one profiler.
+    if (MP_STATE_VM(running_samplingprofiler) != NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_SamplingProfiler);
+    }
+    self->countdown = self->interval;
+    MP_STATE_VM(running_samplingprofiler) = MP_OBJ_FROM_PTR(self);
+    supervisor_enable_tick();
+}
+
+void common_hal_profiler_samplingprofiler_stop(profiler_samplingprofiler_obj_t *self) {
+    if (!common_hal_profiler_samplingprofiler_get_running(self)) {
+        return;
+    }
+    MP_STATE_VM(running_samplingprofiler) = NULL;
+    supervisor_disable_tick();
+}
+
+void common_hal_profiler_samplingprofiler_clear(profiler_samplingprofiler_obj_t *self) {
+    // Samples still in the ring are dropped too.
+    self->ring_read = self->ring_write;
+    memset(self->entries, 0, self->slots * sizeof(profiler_samplingprofiler_entry_t));
+    self->dropped = 0;
+    self->overruns = 0;
+}
+
+static void record(profiler_samplingprofiler_obj_t *self, const profiler_samplingprofiler_sample_t *sample) {
+    size_t i = (sample->source_file * 31 + sample->line) % self->slots;
+    for (size_t probe = 0; probe < self->slots; probe++) {
+        profiler_samplingprofiler_entry_t *entry = &self->entries[i];
+        if (entry->samples == 0) {
+            entry->source_file = sample->source_file;
+            entry->line = sample->line;
+        }
+        if (entry->source_file == sample->source_file && entry->line == sample->line) {
+            entry->samples++;
+            return;
+        }
+        i = (i + 1) % self->slots;
+    }
+    self->dropped++;
+}
+
+void profiler_samplingprofiler_count_samples(profiler_samplingprofiler_obj_t *self) {
+    uint8_t read = self->ring_read;
+    while (read != self->ring_write) {
+        record(self, &self->ring[read]);
+        read = (read + 1) % PROFILER_SAMPLINGPROFILER_RING_SIZE;
+        self->ring_read = read;
+    }
+}
+
+static void count_samples_callback(void *self_in) {
+    profiler_samplingprofiler_count_samples(self_in);
+}
+
+size_t common_hal_profiler_samplingprofiler_get_dropped(profiler_samplingprofiler_obj_t *self) {
+    profiler_samplingprofiler_count_samples(self);
+    return self->dropped + self->overruns;
+}
+
+size_t common_hal_profiler_samplingprofiler_get_entries(profiler_samplingprofiler_obj_t *self,
+    profiler_samplingprofiler_entry_t *entries) {
+    profiler_samplingprofiler_count_samples(self);
+    size_t len = 0;
+    for (size_t i = 0; i < self->slots; i++) {
+        if (self->entries[i].samples > 0) {
+            entries[len++] = self->entries[i];
+        }
+    }
+    return len;
+}
+
+// Called from the tick interrupt, so it only notes where the VM is. Looking the line up doesn't
+// allocate, and the running code state stays valid until the VM moves current_code_state off it.
+void profiler_samplingprofiler_tick(void) {
+    profiler_samplingprofiler_obj_t *self = MP_OBJ_TO_PTR(MP_STATE_VM(running_samplingprofiler));
+    if (self == NULL) {
+        return;
+    }
+    if (--self->countdown > 0) {
+        return;
+    }
+    self->countdown = self->interval;
+
+    uint8_t write = self->ring_write;
+    uint8_t next = (write + 1) % PROFILER_SAMPLINGPROFILER_RING_SIZE;
+    if (next == self->ring_read) {
+        // The background task hasn't kept up.
+        self->overruns++;
+        return;
+    }
+    profiler_samplingprofiler_sample_t *sample = &self->ring[write];
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        sample->source_file = MP_QSTRnull;
+        sample->line = 0;
+    } else {
+        size_t line;
+        sample->source_file = mp_code_state_get_source_line(code_state, &line);
+        sample->line = line;
+    }
+    self->ring_write = next;
+    background_callback_add(&self->callback, count_samples_callback, self);
+}
+
+void profiler_samplingprofiler_reset(void) {
+    profiler_samplingprofiler_obj_t *self = profiler_samplingprofiler_get_running();
+    if (self != NULL) {
+        common_hal_profiler_samplingprofiler_stop(self);
+    }
+}
+
+profiler_samplingprofiler_obj_t *profiler_samplingprofiler_get_running(void) {
+    return MP_OBJ_TO_PTR(MP_STATE_VM(running_samplingprofiler));
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t running_samplingprofiler);
@@ -0,0 +1,53 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "supervisor/background_callback.h"
+
+// Samples taken in the tick interrupt wait here until a background task counts them.
+#define PROFILER_SAMPLINGPROFILER_RING_SIZE (16)
+
+typedef struct {
+    // MP_QSTRnull for samples taken outside of Python code.
+    qstr source_file;
+    uint32_t line;
+    // 0 when the entry is unused.
+    uint32_t samples;
+} profiler_samplingprofiler_entry_t;
+
+typedef struct {
+    qstr source_file;
+    uint32_t line;
+} profiler_samplingprofiler_sample_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    profiler_samplingprofiler_entry_t *entries;
+    size_t slots;
+    // Ticks between samples.
+    uint16_t interval;
+    volatile uint16_t countdown;
+    // Samples that found every slot taken.
+    size_t dropped;
+    // Samples that found the ring full. Kept apart from dropped because the tick counts them.
+    volatile uint32_t overruns;
+    background_callback_t callback;
+    profiler_samplingprofiler_sample_t ring[PROFILER_SAMPLINGPROFILER_RING_SIZE];
+    // Only the tick writes ring_write and only the background task writes ring_read.
+    volatile uint8_t ring_read;
+    volatile uint8_t ring_write;
+} profiler_samplingprofiler_obj_t;
+
+void profiler_samplingprofiler_tick(void);
+void profiler_samplingprofiler_reset(void);
+// Counts the samples the tick has left in the ring. Only call it from the VM or a background task.
+void profiler_samplingprofiler_count_samples(profiler_samplingprofiler_obj_t *self);
+// The running profiler, or NULL.
+profiler_samplingprofiler_obj_t *profiler_samplingprofiler_get_running(void);
@@ -0,0 +1,16 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/profiler/__init__.h"
+#include "shared-module/profiler/SamplingProfiler.h"
+
+void profiler_tick(void) {
+    profiler_samplingprofiler_tick();
+}
+
+void profiler_reset(void) {
+    profiler_samplingprofiler_reset();
+}
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <limits.h>
 #include <string.h>
 
 #include "py/gc.h"
@@ -12,36 +13,55 @@
 #include "shared-bindings/qrio/QRInfo.h"
 #include "shared-module/qrio/QRDecoder.h"
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
-    self->quirc = quirc_new();
+static void resize(qrdecoder_qrdecoder_obj_t *self) {
+    int width = self->width / self->downscale;
+    int height = self->height / self->downscale;
     quirc_resize(self->quirc, width, height);
+    if (self->roi_quirc) {
+        quirc_resize(self->roi_quirc, width / 2, height / 2);
+    }
+    self->roi_valid = false;
+}
+
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height, int downscale, bool track) {
+    self->quirc = quirc_new();
+    self->roi_quirc = track ? quirc_new() : NULL;
+    self->width = width;
+    self->height = height;
+    self->downscale = downscale;
+    resize(self);
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
+
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
+    if (height != self->height) {
+        self->height = height;
+        resize(self);
     }
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
+    if (width != self->width) {
+        self->width = width;
+        resize(self);
     }
 }
 
+int shared_module_qrio_qrdecoder_get_downscale(qrdecoder_qrdecoder_obj_t *self) {
+    return self->downscale;
+}
+
+bool shared_module_qrio_qrdecoder_get_track(qrdecoder_qrdecoder_obj_t *self) {
+    return self->roi_quirc != NULL;
+}
+
 static mp_obj_t data_type(int type) {
     switch (type) {
         case QUIRC_ECI_ISO_8859_1:
@@ -78,28 +98,27 @@ static mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
+// Converts count pixels starting at pixel index start to grayscale.
+static void convert_pixels(uint8_t *dest, const void *buf, size_t start, size_t count, qrio_pixel_policy_t policy) {
+    const uint8_t *src = buf;
 
     switch (policy) {
         case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
+            const uint16_t *src16 = (const uint16_t *)buf + start;
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = (src16[i] >> 3) & 0xfc;
             }
             break;
         }
         case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+            const uint16_t *src16 = (const uint16_t *)buf + start;
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
             }
             break;
         }
         case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
+            memcpy(dest, src + start, count);
             break;
 
         case QRIO_ODD_BYTES:
@@ -107,25 +126,81 @@ static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_p
             MP_FALLTHROUGH;
 
         case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
+            src += 2 * start;
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = src[2 * i];
             }
             break;
     }
-    quirc_end(self->quirc);
 }
 
+// Fills the decoder's image from the part of the frame that starts at (x, y), both in decoder
+// pixels.
+static void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, struct quirc *quirc, int x, int y, void *buf, qrio_pixel_policy_t policy) {
+    int width, height;
+    uint8_t *framebuffer = quirc_begin(quirc, &width, &height);
+    const int downscale = self->downscale;
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
-    int count = quirc_count(self->quirc);
-    mp_obj_t result = mp_obj_new_list(0, NULL);
+    if (downscale == 1) {
+        for (int row = 0; row < height; row++) {
+            convert_pixels(framebuffer + row * width, buf, (y + row) * self->width + x, width, policy);
+        }
+    } else {
+        // Average each 2x2 block, which keeps thin modules visible better than skipping pixels.
+        uint8_t top[2 * width];
+        uint8_t bottom[2 * width];
+        for (int row = 0; row < height; row++) {
+            size_t start = (2 * (y + row)) * self->width + 2 * x;
+            convert_pixels(top, buf, start, 2 * width, policy);
+            convert_pixels(bottom, buf, start + self->width, 2 * width, policy);
+            uint8_t *dest = framebuffer + row * width;
+            for (int col = 0; col < width; col++) {
+                dest[col] = (top[2 * col] + top[2 * col + 1] + bottom[2 * col] + bottom[2 * col + 1] + 2) / 4;
+            }
+        }
+    }
+    quirc_end(quirc);
+}
+
+// Centers the tracking window on the code just found, if the code fits well inside it.
+static void track_code(qrdecoder_qrdecoder_obj_t *self, const struct quirc_code *code, int x, int y) {
+    if (self->roi_quirc == NULL) {
+        return;
+    }
+    int roi_width, roi_height, width, height;
+    quirc_begin(self->roi_quirc, &roi_width, &roi_height);
+    quirc_begin(self->quirc, &width, &height);
+    int min_x = INT_MAX, max_x = INT_MIN, min_y = INT_MAX, max_y = INT_MIN;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(code->corners); i++) {
+        min_x = MIN(min_x, code->corners[i].x + x);
+        max_x = MAX(max_x, code->corners[i].x + x);
+        min_y = MIN(min_y, code->corners[i].y + y);
+        max_y = MAX(max_y, code->corners[i].y + y);
+    }
+    // Leave a margin of a quarter of the window for the code to move between frames.
+    if ((max_x - min_x) * 4 > roi_width * 3 || (max_y - min_y) * 4 > roi_height * 3) {
+        self->roi_valid = false;
+        return;
+    }
+    self->roi_x = MIN(MAX((min_x + max_x - roi_width) / 2, 0), width - roi_width);
+    self->roi_y = MIN(MAX((min_y + max_y - roi_height) / 2, 0), height - roi_height);
+    self->roi_valid = true;
+}
+
+// Decodes every code quirc found, appending them to result. Returns how many were decoded.
+static size_t decode_codes(qrdecoder_qrdecoder_obj_t *self, struct quirc *quirc, int x, int y, mp_obj_t result) {
+    int count = quirc_count(quirc);
+    size_t decoded = 0;
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
+        quirc_extract(quirc, i, &self->code);
         mp_obj_t code_obj;
         if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
             continue;
         }
+        if (decoded == 0) {
+            track_code(self, &self->code, x, y);
+        }
+        decoded++;
         mp_obj_t elems[2] = {
             mp_obj_new_bytes(self->data.payload, self->data.payload_len),
             data_type(self->data.data_type),
@@ -133,26 +208,44 @@ mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, co
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
         mp_obj_list_append(result, code_obj);
     }
+    return decoded;
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
+    mp_obj_t result = mp_obj_new_list(0, NULL);
+    if (self->roi_valid) {
+        // Look where the code was last time first, which only takes a quarter of the work.
+        int x = self->roi_x, y = self->roi_y;
+        quirc_fill_buffer(self, self->roi_quirc, x, y, bufinfo->buf, policy);
+        if (decode_codes(self, self->roi_quirc, x, y, result) > 0) {
+            return result;
+        }
+    }
+    quirc_fill_buffer(self, self->quirc, 0, 0, bufinfo->buf, policy);
+    if (decode_codes(self, self->quirc, 0, 0, result) == 0) {
+        self->roi_valid = false;
+    }
     return result;
 }
 
 
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+    quirc_fill_buffer(self, self->quirc, 0, 0, bufinfo->buf, policy);
     int count = quirc_count(self->quirc);
+    const int downscale = self->downscale;
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
         mp_obj_t code_obj;
         mp_obj_t elems[9] = {
-            mp_obj_new_int(self->code.corners[0].x),
-            mp_obj_new_int(self->code.corners[0].y),
-            mp_obj_new_int(self->code.corners[1].x),
-            mp_obj_new_int(self->code.corners[1].y),
-            mp_obj_new_int(self->code.corners[2].x),
-            mp_obj_new_int(self->code.corners[2].y),
-            mp_obj_new_int(self->code.corners[3].x),
-            mp_obj_new_int(self->code.corners[3].y),
+            mp_obj_new_int(self->code.corners[0].x * downscale),
+            mp_obj_new_int(self->code.corners[0].y * downscale),
+            mp_obj_new_int(self->code.corners[1].x * downscale),
+            mp_obj_new_int(self->code.corners[1].y * downscale),
+            mp_obj_new_int(self->code.corners[2].x * downscale),
+            mp_obj_new_int(self->code.corners[2].y * downscale),
+            mp_obj_new_int(self->code.corners[3].x * downscale),
+            mp_obj_new_int(self->code.corners[3].y * downscale),
             mp_obj_new_int(self->code.size),
         };
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
@@ -13,14 +13,26 @@
 typedef struct qrio_qrdecoder_obj {
     mp_obj_base_t base;
     struct quirc *quirc;
+    // Searches a quarter of the frame around the last code found, when tracking.
+    struct quirc *roi_quirc;
     struct quirc_code code;
     struct quirc_data data;
+    // Size of the images passed in. The decoders see them divided by downscale.
+    int width;
+    int height;
+    // Top left of the tracking window, in decoder pixels.
+    int roi_x;
+    int roi_y;
+    uint8_t downscale;
+    bool roi_valid;
 } qrdecoder_qrdecoder_obj_t;
 
-void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height);
+void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *, int width, int height, int downscale, bool track);
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *);
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *);
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *, int height);
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *, int width);
 mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
+int shared_module_qrio_qrdecoder_get_downscale(qrdecoder_qrdecoder_obj_t *);
+bool shared_module_qrio_qrdecoder_get_track(qrdecoder_qrdecoder_obj_t *);
 mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy);
@@ -216,6 +216,18 @@ void common_hal_rgbmatrix_rgbmatrix_refresh(rgbmatrix_rgbmatrix_obj_t *self) {
     }
 }
 
+// Protomatter converts the whole framebuffer into bit planes, so only do it when displayio has
+// actually changed a row. The bitmap always covers the rows of the unrotated framebuffer.
+void rgbmatrix_rgbmatrix_refresh_dirty_rows(rgbmatrix_rgbmatrix_obj_t *self, const uint8_t *dirty_row_bitmap) {
+    int height = common_hal_rgbmatrix_rgbmatrix_get_height(self);
+    for (int i = 0; i < (height + 7) / 8; i++) {
+        if (dirty_row_bitmap[i] != 0) {
+            common_hal_rgbmatrix_rgbmatrix_refresh(self);
+            return;
+        }
+    }
+}
+
 int common_hal_rgbmatrix_rgbmatrix_get_width(rgbmatrix_rgbmatrix_obj_t *self) {
     return self->width;
 }
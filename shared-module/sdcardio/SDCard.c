@@ -32,6 +32,10 @@
 #define TOKEN_STOP_TRAN (0xFD)
 #define TOKEN_DATA (0xFE)
 
+// Bytes read at a time while waiting on the card, so each poll isn't a
+// separate SPI transaction.
+#define POLL_SIZE (8)
+
 static void common_hal_sdcardio_check_for_deinit(sdcardio_sdcard_obj_t *self) {
     if (!self->bus) {
         raise_deinited_error();
@@ -84,6 +88,42 @@ static uint8_t CRC7(const uint8_t *data, uint8_t n) {
 }
 
 #define READY_TIMEOUT_NS (300 * 1000 * 1000) // 300ms
+
+// Reads the data token that starts a block, then the block into buf. The card
+// sends 0xff until the token, so several bytes are read at a time and any after
+// the token are the start of the block. The first skip bytes are the CRC of the
+// block before, when reading several. size must be at least POLL_SIZE.
+static int read_data_block(sdcardio_sdcard_obj_t *self, uint8_t *buf, size_t size, size_t skip) {
+    uint8_t poll[2 + POLL_SIZE];
+    size_t len = skip + POLL_SIZE;
+    size_t i;
+    uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
+    while (true) {
+        common_hal_busio_spi_read(self->bus, poll, len, 0xff);
+        for (i = skip; i < len && poll[i] == 0xff; i++) {
+        }
+        if (i < len) {
+            break;
+        }
+        if (common_hal_time_monotonic_ns() >= deadline) {
+            return -ETIMEDOUT;
+        }
+        skip = 0;
+        len = POLL_SIZE;
+    }
+    if (poll[i] != TOKEN_DATA) {
+        // An error token instead of the data.
+        return -EIO;
+    }
+    i++;
+    size_t early = len - i;
+    memcpy(buf, poll + i, early);
+    if (early < size) {
+        common_hal_busio_spi_read(self->bus, buf + early, size - early, 0xff);
+    }
+    return 0;
+}
+
 static int wait_for_ready(sdcardio_sdcard_obj_t *self) {
     uint64_t deadline = common_hal_time_monotonic_ns() + READY_TIMEOUT_NS;
     while (common_hal_time_monotonic_ns() < deadline) {
@@ -166,18 +206,14 @@ static int cmd(sdcardio_sdcard_obj_t *self, int cmd, int arg, void *response_buf
     if (response_buf) {
 
         if (data_block) {
-            cmdbuf[1] = 0xff;
-            do {
-                // Wait for the start block byte
-                common_hal_busio_spi_read(self->bus, cmdbuf + 1, 1, 0xff);
-            } while (cmdbuf[1] != 0xfe);
-        }
-
-        common_hal_busio_spi_read(self->bus, response_buf, response_len, 0xff);
-
-        if (data_block) {
+            r = read_data_block(self, response_buf, response_len, 0);
+            if (r < 0) {
+                return r;
+            }
             // Read and discard the CRC-CCITT checksum
             common_hal_busio_spi_read(self->bus, cmdbuf + 1, 2, 0xff);
+        } else {
+            common_hal_busio_spi_read(self->bus, response_buf, response_len, 0xff);
         }
 
     }
@@ -338,19 +374,6 @@ int common_hal_sdcardio_sdcard_get_blockcount(sdcardio_sdcard_obj_t *self) {
     return self->sectors;
 }
 
-static int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
-    uint8_t aux[2] = {0, 0};
-    while (aux[0] != 0xfe) {
-        common_hal_busio_spi_read(self->bus, aux, 1, 0xff);
-    }
-
-    common_hal_busio_spi_read(self->bus, buf, size, 0xff);
-
-    // Read checksum and throw it away
-    common_hal_busio_spi_read(self->bus, aux, sizeof(aux), 0xff);
-    return 0;
-}
-
 mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t start_block, uint32_t nblocks) {
     // deinit check is in lock_and_configure_bus()
     sdcardio_sdcard_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -366,13 +389,21 @@ mp_uint_t sdcardio_sdcard_readblocks(mp_obj_t self_in, uint8_t *buf, uint32_t st
         //  Use CMD18 to read multiple blocks
         r = block_cmd(self, 18, start_block, NULL, 0, true, true);
         uint8_t *ptr = buf;
+        // Each block's checksum is read and thrown away along with the start
+        // of the wait for the next block.
+        size_t crc_len = 0;
         while (nblocks-- && r >= 0) {
-            r = readinto(self, ptr, 512);
+            r = read_data_block(self, ptr, 512, crc_len);
             if (r != 0) {
                 break;
             }
+            crc_len = 2;
             ptr += 512;
         }
+        if (r == 0) {
+            uint8_t crc[2];
+            common_hal_busio_spi_read(self->bus, crc, sizeof(crc), 0xff);
+        }
 
         // End the multi-block read
         r = cmd(self, 12, 0, NULL, 0, true, false);
@@ -408,8 +439,10 @@ static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
     common_hal_busio_spi_write(self->bus, cmd, 1);
     common_hal_busio_spi_write(self->bus, buf, size);
 
-    cmd[0] = cmd[1] = 0xff;
-    common_hal_busio_spi_write(self->bus, cmd, 2);
+    // Clock out a dummy CRC, which the card doesn't check, along with the
+    // bytes where the response usually comes. Reading sends 0xff.
+    uint8_t poll[2 + POLL_SIZE];
+    common_hal_busio_spi_read(self->bus, poll, sizeof(poll), 0xff);
 
     // Check the response
     // This differs from the traditional adafruit_sdcard handling,
@@ -424,7 +457,11 @@ static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
     // combinations indicating failure.
     // In practice, I was seeing cmd[0] as 0xe5, indicating success
     for (int i = 0; i < CMD_TIMEOUT; i++) {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
+        if (i < POLL_SIZE) {
+            cmd[0] = poll[2 + i];
+        } else {
+            common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
+        }
         DEBUG_PRINT("i=%02d cmd[0] = 0x%02x\n", i, cmd[0]);
         if ((cmd[0] & 0b00010001) == 0b00000001) {
             if ((cmd[0] & 0x1f) != 0x5) {
@@ -435,10 +472,10 @@ static int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
+    // Wait for the write to finish. The card holds the line low while busy.
     do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
+        common_hal_busio_spi_read(self->bus, poll, POLL_SIZE, 0xff);
+    } while (poll[POLL_SIZE - 1] == 0);
 
     // Success
     return 0;
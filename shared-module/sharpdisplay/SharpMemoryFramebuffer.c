@@ -155,13 +155,21 @@ static void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebu
 
     common_hal_busio_spi_write(self->bus, data++, 1);
 
-    // output each changed row
+    // output each run of changed rows. Every row in the buffer already carries its address
+    // and trailing byte, so a run of adjacent rows goes out as one multi-line write.
     size_t row_stride = common_hal_sharpdisplay_framebuffer_get_row_stride(self);
-    for (int y = 0; y < self->height; y++) {
-        if (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
-            common_hal_busio_spi_write(self->bus, data, row_stride);
+    int y = 0;
+    while (y < self->height) {
+        if (!self->full_refresh && !(dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            // Skip eight clean rows at a time when a whole byte of the bitmask is clear.
+            y = ((y & 7) == 0 && dirty_row_bitmask[y / 8] == 0) ? y + 8 : y + 1;
+            continue;
         }
-        data += row_stride;
+        int run_start = y;
+        while (y < self->height && (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7))))) {
+            y++;
+        }
+        common_hal_busio_spi_write(self->bus, data + run_start * row_stride, (y - run_start) * row_stride);
     }
 
     // output a trailing zero
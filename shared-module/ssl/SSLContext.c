@@ -4,6 +4,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/ssl/SSLContext.h"
 #include "shared-bindings/ssl/SSLSocket.h"
 
@@ -13,11 +15,71 @@
 #include "lib/mbedtls_config/crt_bundle.h"
 
 void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        mbedtls_ssl_session_init(&self->session_cache[i].session);
+        self->session_cache[i].hostname[0] = '\0';
+    }
+    self->session_cache_next = 0;
     common_hal_ssl_sslcontext_set_default_verify_paths(self);
 }
 
+void common_hal_ssl_sslcontext_deinit(ssl_sslcontext_obj_t *self) {
+    ssl_sslcontext_clear_sessions(self);
+}
+
+static ssl_session_cache_entry_t *find_session(ssl_sslcontext_obj_t *self, const char *hostname) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        if (strcmp(self->session_cache[i].hostname, hostname) == 0) {
+            return &self->session_cache[i];
+        }
+    }
+    return NULL;
+}
+
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname) {
+    if (hostname[0] == '\0') {
+        return;
+    }
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    // A failure here only means a full handshake.
+    if (entry != NULL) {
+        mbedtls_ssl_set_session(ssl, &entry->session);
+    }
+}
+
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname) {
+    if (hostname[0] == '\0' || strlen(hostname) > SSL_SESSION_HOSTNAME_MAX_LEN) {
+        return;
+    }
+    ssl_session_cache_entry_t *entry = find_session(self, hostname);
+    if (entry == NULL) {
+        entry = find_session(self, "");
+    }
+    if (entry == NULL) {
+        entry = &self->session_cache[self->session_cache_next];
+        self->session_cache_next = (self->session_cache_next + 1) % CIRCUITPY_SSL_SESSION_CACHE_SIZE;
+    }
+    mbedtls_ssl_session_free(&entry->session);
+    mbedtls_ssl_session_init(&entry->session);
+    if (mbedtls_ssl_get_session(ssl, &entry->session) != 0) {
+        mbedtls_ssl_session_free(&entry->session);
+        entry->hostname[0] = '\0';
+        return;
+    }
+    strcpy(entry->hostname, hostname);
+}
+
+void ssl_sslcontext_clear_sessions(ssl_sslcontext_obj_t *self) {
+    for (size_t i = 0; i < CIRCUITPY_SSL_SESSION_CACHE_SIZE; i++) {
+        mbedtls_ssl_session_free(&self->session_cache[i].session);
+        mbedtls_ssl_session_init(&self->session_cache[i].session);
+        self->session_cache[i].hostname[0] = '\0';
+    }
+}
+
 void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
     const char *cadata) {
+    ssl_sslcontext_clear_sessions(self);
     self->crt_bundle_attach = NULL;
     self->use_global_ca_store = false;
     self->cacert_buf = (const unsigned char *)cadata;
@@ -25,6 +87,7 @@ void common_hal_ssl_sslcontext_load_verify_locations(ssl_sslcontext_obj_t *self,
 }
 
 void common_hal_ssl_sslcontext_set_default_verify_paths(ssl_sslcontext_obj_t *self) {
+    ssl_sslcontext_clear_sessions(self);
     self->crt_bundle_attach = crt_bundle_attach;
     self->use_global_ca_store = true;
     self->cacert_buf = NULL;
@@ -40,6 +103,7 @@ void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bo
 }
 
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf) {
+    ssl_sslcontext_clear_sessions(self);
     self->cert_buf = *cert_buf;
     self->key_buf = *key_buf;
 }
@@ -10,6 +10,20 @@
 #include "py/obj.h"
 #include "mbedtls/ssl.h"
 
+// Client sessions are kept for this many servers so reconnecting can skip the full handshake.
+#ifndef CIRCUITPY_SSL_SESSION_CACHE_SIZE
+#define CIRCUITPY_SSL_SESSION_CACHE_SIZE (2)
+#endif
+
+// Sessions for longer hostnames aren't cached.
+#define SSL_SESSION_HOSTNAME_MAX_LEN (63)
+
+typedef struct {
+    mbedtls_ssl_session session;
+    // Empty when the entry is unused.
+    char hostname[SSL_SESSION_HOSTNAME_MAX_LEN + 1];
+} ssl_session_cache_entry_t;
+
 typedef struct {
     mp_obj_base_t base;
     bool check_name, use_global_ca_store;
@@ -17,4 +31,14 @@ typedef struct {
     size_t cacert_bytes;
     int (*crt_bundle_attach)(mbedtls_ssl_config *conf);
     mp_buffer_info_t cert_buf, key_buf;
+    ssl_session_cache_entry_t session_cache[CIRCUITPY_SSL_SESSION_CACHE_SIZE];
+    // The entry replaced next when there's no unused one.
+    uint8_t session_cache_next;
 } ssl_sslcontext_obj_t;
+
+// Offers the session cached for hostname, if any, before the handshake of ssl.
+void ssl_sslcontext_resume_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname);
+// Caches the session of ssl after a successful handshake with hostname.
+void ssl_sslcontext_save_session(ssl_sslcontext_obj_t *self, mbedtls_ssl_context *ssl, const char *hostname);
+// Forgets all sessions, such as when the certificates used to verify them change.
+void ssl_sslcontext_clear_sessions(ssl_sslcontext_obj_t *self);
@@ -6,6 +6,8 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
 #include "shared-bindings/ssl/SSLSocket.h"
 #include "shared-bindings/ssl/SSLContext.h"
 
@@ -222,6 +224,7 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
     o->ssl_context = self;
     o->sock_obj = socket;
     o->poll_mask = 0;
+    o->server_hostname[0] = '\0';
 
     mp_load_method(socket, MP_QSTR_accept, o->accept_args);
     mp_load_method(socket, MP_QSTR_bind, o->bind_args);
@@ -288,6 +291,10 @@ ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t
         if (ret != 0) {
             goto cleanup;
         }
+        if (strlen(server_hostname) <= SSL_SESSION_HOSTNAME_MAX_LEN) {
+            strcpy(o->server_hostname, server_hostname);
+            ssl_sslcontext_resume_session(self, &o->ssl, o->server_hostname);
+        }
     }
 
     mbedtls_ssl_set_bio(&o->ssl, o, _mbedtls_ssl_send, _mbedtls_ssl_recv, NULL);
@@ -399,6 +406,7 @@ static void do_handshake(ssl_sslsocket_obj_t *self) {
         mp_hal_delay_ms(1);
     }
 
+    ssl_sslcontext_save_session(self->ssl_context, &self->ssl, self->server_hostname);
     return;
 
 cleanup:
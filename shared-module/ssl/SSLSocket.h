@@ -30,6 +30,8 @@ typedef struct ssl_sslsocket_obj {
     mbedtls_x509_crt cert;
     mbedtls_pk_context pkey;
     uintptr_t poll_mask;
+    // Where the session is cached after the handshake. Empty when it won't be.
+    char server_hostname[SSL_SESSION_HOSTNAME_MAX_LEN + 1];
     bool closed;
     mp_obj_t accept_args[2];
     mp_obj_t bind_args[3];
@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/obj.h"
@@ -126,6 +127,11 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool rea
     // call the underlying object to do any mounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_mount, 2, (mp_obj_t *)&args);
 
+    #if MICROPY_VFS_IMPORT_STAT_CACHE
+    // The object may reuse the memory of one unmounted before.
+    mp_vfs_import_stat_cache_invalidate();
+    #endif
+
     // Insert the vfs into the mount table by pushing it onto the front of the
     // mount table.
     mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
@@ -198,6 +204,50 @@ void common_hal_storage_remount(const char *mount_path, bool readonly, bool disa
     #endif
 }
 
+mp_obj_t common_hal_storage_mmap(const char *path) {
+    const char *path_under_mount;
+    const char *abs_path = common_hal_os_path_abspath(path);
+    fs_user_mount_t *vfs = filesystem_for_path(abs_path, &path_under_mount);
+    if (vfs == NULL || !filesystem_native_fatfs(vfs)) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+
+    FIL fp;
+    FRESULT res = f_open(&vfs->fatfs, &fp, path_under_mount, FA_READ);
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+    FSIZE_t size = f_size(&fp);
+    // A fast seek map with room for one fragment tells us whether the clusters are contiguous.
+    DWORD link_map[4] = {MP_ARRAY_SIZE(link_map)};
+    if (size > 0) {
+        fp.cltbl = link_map;
+        res = f_lseek(&fp, CREATE_LINKMAP);
+        fp.cltbl = NULL;
+    }
+    f_close(&fp);
+    if (size == 0) {
+        return mp_obj_new_memoryview('B', 0, NULL);
+    }
+    if (res == FR_NOT_ENOUGH_CORE) {
+        mp_raise_ValueError(MP_ERROR_TEXT("File is not contiguous"));
+    }
+    if (res != FR_OK) {
+        mp_raise_OSError(fresult_to_errno_table[res]);
+    }
+
+    // link_map[2] is the first cluster of the only fragment.
+    FATFS *fatfs = &vfs->fatfs;
+    DWORD sector = fatfs->database + (DWORD)fatfs->csize * (link_map[2] - 2);
+    // Write out anything cached so the mapped flash is up to date.
+    supervisor_flash_flush();
+    const uint8_t *data = supervisor_flash_get_mapped_sector(vfs, sector);
+    if (data == NULL) {
+        mp_raise_OSError(MP_EOPNOTSUPP);
+    }
+    return mp_obj_new_memoryview('B', size, (void *)data);
+}
+
 void common_hal_storage_erase_filesystem(bool extended) {
     #if CIRCUITPY_USB_DEVICE
     usb_disconnect();
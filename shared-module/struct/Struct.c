@@ -0,0 +1,156 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/binary.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+
+// The format is parsed once here into the offset of each field, so packing and unpacking
+// records doesn't parse it again.
+void common_hal_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    self->format = format;
+    self->fmt_type = get_fmt_type(&fmt);
+    #if MP_ENDIANNESS_LITTLE
+    self->big_endian = self->fmt_type == '>';
+    #else
+    self->big_endian = self->fmt_type == '>' || self->fmt_type == '@';
+    #endif
+
+    size_t num_fields = 0;
+    for (const char *f = fmt; *f; f++) {
+        struct_validate_format(*f);
+        mp_uint_t cnt = 1;
+        if (unichar_isdigit(*f)) {
+            cnt = get_fmt_num(&f);
+        }
+        num_fields += (*f == 's' || *f == 'x') ? 1 : cnt;
+    }
+
+    struct_struct_field_t *fields = m_new(struct_struct_field_t, num_fields);
+    size_t num_items = 0;
+    mp_uint_t size = 0;
+    struct_struct_field_t *field = fields;
+    for (; *fmt; fmt++) {
+        mp_uint_t cnt = 1;
+        if (unichar_isdigit(*fmt)) {
+            cnt = get_fmt_num(&fmt);
+        }
+        if (*fmt == 's' || *fmt == 'x') {
+            field->code = *fmt;
+            field->len = cnt;
+            field->offset = size;
+            size += cnt;
+            num_items += *fmt == 's';
+            field++;
+            continue;
+        }
+        size_t align;
+        size_t sz = mp_binary_get_size(self->fmt_type, *fmt, &align);
+        while (cnt--) {
+            size = (size + align - 1) & ~(align - 1);
+            field->code = *fmt;
+            field->len = sz;
+            field->offset = size;
+            size += sz;
+            num_items++;
+            field++;
+        }
+    }
+    self->fields = fields;
+    self->num_fields = num_fields;
+    self->num_items = num_items;
+    self->size = size;
+}
+
+void common_hal_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    (void)mp_arg_validate_length(n_args, self->num_items, MP_QSTR_values);
+    for (size_t i = 0; i < self->num_fields; i++) {
+        const struct_struct_field_t *field = &self->fields[i];
+        byte *ptr = p + field->offset;
+        if (field->code == 'x') {
+            memset(ptr, 0, field->len);
+        } else if (field->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(*args++, &bufinfo, MP_BUFFER_READ);
+            mp_uint_t to_copy = MIN(bufinfo.len, field->len);
+            memcpy(ptr, bufinfo.buf, to_copy);
+            memset(ptr + to_copy, 0, field->len - to_copy);
+        } else {
+            mp_binary_set_val(self->fmt_type, field->code, *args++, p, &ptr);
+        }
+    }
+}
+
+void common_hal_struct_struct_unpack_into(struct_struct_obj_t *self, const byte *p, mp_obj_t *items) {
+    for (size_t i = 0; i < self->num_fields; i++) {
+        const struct_struct_field_t *field = &self->fields[i];
+        byte *ptr = (byte *)p + field->offset;
+        if (field->code == 'x') {
+            continue;
+        }
+        if (field->code == 's') {
+            *items++ = mp_obj_new_bytes(ptr, field->len);
+        } else {
+            *items++ = mp_binary_get_val(self->fmt_type, field->code, (byte *)p, &ptr);
+        }
+    }
+}
+
+typedef struct {
+    const struct_struct_field_t *field;
+    mp_buffer_info_t bufinfo;
+} struct_column_t;
+
+size_t common_hal_struct_struct_unpack_into_arrays(struct_struct_obj_t *self, const byte *p, size_t len,
+    const mp_obj_t *columns) {
+    size_t records = self->size == 0 ? 0 : len / self->size;
+    struct_column_t *cols = m_new(struct_column_t, self->num_items);
+    struct_column_t *col = cols;
+    for (size_t i = 0; i < self->num_fields; i++) {
+        const struct_struct_field_t *field = &self->fields[i];
+        if (field->code == 'x') {
+            continue;
+        }
+        col->field = NULL;
+        if (*columns != mp_const_none) {
+            if (field->code == 's') {
+                mp_arg_error_invalid(MP_QSTR_columns);
+            }
+            mp_get_buffer_raise(*columns, &col->bufinfo, MP_BUFFER_WRITE);
+            size_t align;
+            size_t itemsize = mp_binary_get_size('@', col->bufinfo.typecode, &align);
+            records = MIN(records, col->bufinfo.len / itemsize);
+            col->field = field;
+        }
+        columns++;
+        col++;
+    }
+
+    for (size_t r = 0; r < records; r++) {
+        const byte *record = p + r * self->size;
+        for (col = cols; col < cols + self->num_items; col++) {
+            const struct_struct_field_t *field = col->field;
+            if (field == NULL) {
+                continue;
+            }
+            byte *ptr = (byte *)record + field->offset;
+            // Integers that fit in a small int don't need an object in between.
+            if (field->len < sizeof(mp_int_t) && strchr("bBhHiIlLqQ", field->code) != NULL) {
+                mp_int_t val = mp_binary_get_int(field->len, unichar_islower(field->code), self->big_endian, ptr);
+                mp_binary_set_val_array_from_int(col->bufinfo.typecode, col->bufinfo.buf, r, val);
+            } else {
+                mp_obj_t val = mp_binary_get_val(self->fmt_type, field->code, (byte *)record, &ptr);
+                mp_binary_set_val_array(col->bufinfo.typecode, col->bufinfo.buf, r, val);
+            }
+        }
+    }
+    m_del(struct_column_t, cols, self->num_items);
+    return records;
+}
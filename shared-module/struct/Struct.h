@@ -0,0 +1,30 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct {
+    // The format character. Counts other than for 's' and 'x' are expanded into one field each.
+    char code;
+    // Bytes in the field, which for 's' and 'x' is the count.
+    mp_uint_t len;
+    // From the start of the record, with any alignment applied.
+    mp_uint_t offset;
+} struct_struct_field_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t format;
+    struct_struct_field_t *fields;
+    size_t num_fields;
+    // Fields that aren't padding.
+    size_t num_items;
+    mp_uint_t size;
+    char fmt_type;
+    bool big_endian;
+} struct_struct_obj_t;
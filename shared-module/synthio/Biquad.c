@@ -194,35 +194,58 @@ void common_hal_synthio_biquad_tick(mp_obj_t self_in) {
 }
 
 void synthio_biquad_filter_reset(biquad_filter_state *st) {
-    memset(&st->x, 0, 4 * sizeof(int16_t));
+    memset(st, 0, sizeof(*st));
 }
 
-void synthio_biquad_filter_samples(mp_obj_t self_in, biquad_filter_state *st, int32_t *buffer, size_t n_samples) {
-    synthio_biquad_t *self = MP_OBJ_TO_PTR(self_in);
+// The number of filters whose coefficients and state are held in locals during one pass over the
+// buffer. Longer cascades take more than one pass.
+#define BIQUAD_CASCADE_STAGES (4)
+
+typedef struct {
+    int32_t a1, a2, b0, b1, b2;
+    int32_t x0, x1, y0, y1;
+} biquad_stage_t;
+
+void synthio_biquad_filter_cascade(const mp_obj_t *filters, biquad_filter_state *states, size_t n_filters, int32_t *buffer, size_t n_samples, size_t channel_count) {
+    int32_t *end = buffer + n_samples;
+    for (size_t first = 0; first < n_filters; first += BIQUAD_CASCADE_STAGES) {
+        size_t n_stages = MIN(BIQUAD_CASCADE_STAGES, n_filters - first);
+        for (size_t c = 0; c < channel_count; c++) {
+            biquad_stage_t stages[BIQUAD_CASCADE_STAGES];
+            for (size_t s = 0; s < n_stages; s++) {
+                synthio_biquad_t *self = MP_OBJ_TO_PTR(filters[first + s]);
+                biquad_filter_state *st = &states[(first + s) * channel_count + c];
+                stages[s] = (biquad_stage_t) {
+                    .a1 = self->a1, .a2 = self->a2, .b0 = self->b0, .b1 = self->b1, .b2 = self->b2,
+                    .x0 = st->x[0], .x1 = st->x[1], .y0 = st->y[0], .y1 = st->y[1],
+                };
+            }
+
+            for (int32_t *ptr = buffer + c; ptr < end; ptr += channel_count) {
+                int32_t sample = *ptr;
+                for (biquad_stage_t *stage = stages; stage < stages + n_stages; stage++) {
+                    int32_t output = synthio_sat16((stage->b0 * sample + stage->b1 * stage->x0 + stage->b2 * stage->x1
+                        - stage->a1 * stage->y0 - stage->a2 * stage->y1 + (1 << (BIQUAD_SHIFT - 1))), BIQUAD_SHIFT);
+                    stage->x1 = stage->x0;
+                    stage->x0 = sample;
+                    stage->y1 = stage->y0;
+                    stage->y0 = output;
+                    sample = output;
+                }
+                *ptr = sample;
+            }
 
-    int32_t a1 = self->a1;
-    int32_t a2 = self->a2;
-    int32_t b0 = self->b0;
-    int32_t b1 = self->b1;
-    int32_t b2 = self->b2;
-
-    int32_t x0 = st->x[0];
-    int32_t x1 = st->x[1];
-    int32_t y0 = st->y[0];
-    int32_t y1 = st->y[1];
-
-    for (size_t n = n_samples; n; --n, ++buffer) {
-        int32_t input = *buffer;
-        int32_t output = synthio_sat16((b0 * input + b1 * x0 + b2 * x1 - a1 * y0 - a2 * y1 + (1 << (BIQUAD_SHIFT - 1))), BIQUAD_SHIFT);
-
-        x1 = x0;
-        x0 = input;
-        y1 = y0;
-        y0 = output;
-        *buffer = output;
+            for (size_t s = 0; s < n_stages; s++) {
+                biquad_filter_state *st = &states[(first + s) * channel_count + c];
+                st->x[0] = stages[s].x0;
+                st->x[1] = stages[s].x1;
+                st->y[0] = stages[s].y0;
+                st->y[1] = stages[s].y1;
+            }
+        }
     }
-    st->x[0] = x0;
-    st->x[1] = x1;
-    st->y[0] = y0;
-    st->y[1] = y1;
+}
+
+void synthio_biquad_filter_samples(mp_obj_t self_in, biquad_filter_state *st, int32_t *buffer, size_t n_samples) {
+    synthio_biquad_filter_cascade(&self_in, st, 1, buffer, n_samples, 1);
 }
@@ -27,3 +27,6 @@ typedef struct {
 void common_hal_synthio_biquad_tick(mp_obj_t self_in);
 void synthio_biquad_filter_reset(biquad_filter_state *st);
 void synthio_biquad_filter_samples(mp_obj_t self_in, biquad_filter_state *st, int32_t *buffer, size_t n_samples);
+// Run n_filters biquads in series over interleaved samples. states holds one entry per channel for
+// each filter, channel varying fastest.
+void synthio_biquad_filter_cascade(const mp_obj_t *filters, biquad_filter_state *states, size_t n_filters, int32_t *buffer, size_t n_samples, size_t channel_count);
@@ -4,6 +4,9 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
+#include "py/mperrno.h"
 #include "py/runtime.h"
 #include "shared-bindings/synthio/MidiTrack.h"
 #include "shared-bindings/audiocore/__init__.h"
@@ -95,6 +98,329 @@ static void start_parse(synthio_miditrack_obj_t *self) {
     }
 }
 
+// Standard MIDI Files are played straight from the filesystem. Each track chunk is read through
+// its own small buffer, and the tracks of a format 1 file are merged by always playing the
+// track whose next event is earliest.
+
+static uint32_t read_be32(const uint8_t *buf) {
+    return (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
+}
+
+static bool queue_before(synthio_miditrack_obj_t *self, uint16_t a, uint16_t b) {
+    uint32_t tick_a = self->streams[a].next_tick;
+    uint32_t tick_b = self->streams[b].next_tick;
+    // Within a tick, earlier tracks go first so that tempo changes in the first track apply.
+    return tick_a < tick_b || (tick_a == tick_b && a < b);
+}
+
+static void queue_sift_down(synthio_miditrack_obj_t *self, uint16_t i) {
+    uint16_t *queue = self->queue;
+    while (true) {
+        uint16_t smallest = i;
+        uint16_t left = 2 * i + 1;
+        uint16_t right = left + 1;
+        if (left < self->queue_len && queue_before(self, queue[left], queue[smallest])) {
+            smallest = left;
+        }
+        if (right < self->queue_len && queue_before(self, queue[right], queue[smallest])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            return;
+        }
+        uint16_t tmp = queue[i];
+        queue[i] = queue[smallest];
+        queue[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static void queue_push(synthio_miditrack_obj_t *self, uint16_t stream_index) {
+    uint16_t *queue = self->queue;
+    uint16_t i = self->queue_len++;
+    queue[i] = stream_index;
+    while (i > 0 && queue_before(self, queue[i], queue[(i - 1) / 2])) {
+        uint16_t parent = (i - 1) / 2;
+        queue[i] = queue[parent];
+        queue[parent] = stream_index;
+        i = parent;
+    }
+}
+
+static void queue_pop(synthio_miditrack_obj_t *self) {
+    self->queue[0] = self->queue[--self->queue_len];
+    queue_sift_down(self, 0);
+}
+
+// errors cannot be raised from the background task, so simply end the song.
+static void record_file_error(synthio_miditrack_obj_t *self, synthio_miditrack_stream_t *stream) {
+    self->error_location = stream->next_read - (stream->len - stream->pos);
+    self->queue_len = 0;
+}
+
+// Returns the next byte of the track, or -1 at its end.
+static int stream_next_byte(synthio_miditrack_obj_t *self, synthio_miditrack_stream_t *stream) {
+    if (stream->pos == stream->len) {
+        uint32_t count = MIN(stream->end - stream->next_read, sizeof(stream->buffer));
+        if (count == 0) {
+            return -1;
+        }
+        FIL *fp = &self->file->fp;
+        UINT bytes_read;
+        if ((f_tell(fp) != stream->next_read && f_lseek(fp, stream->next_read) != FR_OK) ||
+            f_read(fp, stream->buffer, count, &bytes_read) != FR_OK || bytes_read != count) {
+            return -1;
+        }
+        stream->next_read += count;
+        stream->pos = 0;
+        stream->len = count;
+    }
+    return stream->buffer[stream->pos++];
+}
+
+static void stream_skip(synthio_miditrack_stream_t *stream, uint32_t count) {
+    uint32_t buffered = stream->len - stream->pos;
+    if (count <= buffered) {
+        stream->pos += count;
+        return;
+    }
+    // Skip the rest without reading it.
+    stream->pos = stream->len;
+    stream->next_read += MIN(count - buffered, stream->end - stream->next_read);
+}
+
+static bool stream_read_varlen(synthio_miditrack_obj_t *self, synthio_miditrack_stream_t *stream, uint32_t *value) {
+    uint32_t result = 0;
+    for (int i = 0; i < 4; i++) {
+        int c = stream_next_byte(self, stream);
+        if (c < 0) {
+            return false;
+        }
+        result = (result << 7) | (c & 0x7f);
+        if (!(c & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int stream_read_data(synthio_miditrack_obj_t *self, synthio_miditrack_stream_t *stream) {
+    int c = stream_next_byte(self, stream);
+    return c > 127 ? -1 : c;
+}
+
+// Plays the event at the front of the stream and reads the time of the one after it. Returns
+// false when the track has ended.
+static bool stream_play_event(synthio_miditrack_obj_t *self, synthio_miditrack_stream_t *stream) {
+    int c = stream_next_byte(self, stream);
+    if (c < 0) {
+        return false;
+    }
+    uint8_t status;
+    int data1 = -1;
+    if (c & 0x80) {
+        status = c;
+        // System messages cancel running status.
+        stream->running_status = status < 0xf0 ? status : 0;
+    } else if (stream->running_status) {
+        status = stream->running_status;
+        data1 = c;
+    } else {
+        record_file_error(self, stream);
+        return false;
+    }
+
+    if (status < 0xf0) {
+        if (data1 < 0) {
+            data1 = stream_read_data(self, stream);
+        }
+        int data2 = 0;
+        if ((status >> 4) != 12 && (status >> 4) != 13) {
+            data2 = stream_read_data(self, stream);
+        }
+        if (data1 < 0 || data2 < 0) {
+            record_file_error(self, stream);
+            return false;
+        }
+        mp_obj_t note = MP_OBJ_NEW_SMALL_INT(data1);
+        // A Note On with zero velocity is a Note Off.
+        if ((status >> 4) == 8 || ((status >> 4) == 9 && data2 == 0)) {
+            synthio_span_change_note(&self->synth, note, SYNTHIO_SILENCE);
+        } else if ((status >> 4) == 9) {
+            synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, note);
+        }
+    } else if (status == 0xff) { // Meta event
+        int type = stream_read_data(self, stream);
+        uint32_t len;
+        if (type < 0 || !stream_read_varlen(self, stream, &len)) {
+            record_file_error(self, stream);
+            return false;
+        }
+        if (type == 0x2f) { // End of Track
+            return false;
+        }
+        if (type == 0x51 && len == 3) { // Set Tempo, in microseconds per quarter note
+            uint32_t us_per_quarter = 0;
+            for (int i = 0; i < 3; i++) {
+                int b = stream_next_byte(self, stream);
+                if (b < 0) {
+                    record_file_error(self, stream);
+                    return false;
+                }
+                us_per_quarter = (us_per_quarter << 8) | b;
+            }
+            if (us_per_quarter) {
+                self->us_per_quarter = us_per_quarter;
+            }
+        } else {
+            stream_skip(stream, len);
+        }
+    } else if (status == 0xf0 || status == 0xf7) { // System exclusive
+        uint32_t len;
+        if (!stream_read_varlen(self, stream, &len)) {
+            record_file_error(self, stream);
+            return false;
+        }
+        stream_skip(stream, len);
+    } else {
+        record_file_error(self, stream);
+        return false;
+    }
+
+    uint32_t delta;
+    if (!stream_read_varlen(self, stream, &delta)) {
+        // A track that ends without an End of Track event is still played to its end.
+        return false;
+    }
+    stream->next_tick += delta;
+    return true;
+}
+
+static uint32_t ticks_to_samples(synthio_miditrack_obj_t *self, uint32_t ticks) {
+    uint64_t num;
+    uint64_t den;
+    if (self->division & 0x8000) {
+        // SMPTE time: frames per second times ticks per frame. Tempo events don't apply.
+        num = (uint64_t)ticks * self->synth.base.sample_rate;
+        den = (uint64_t)(-(int8_t)(self->division >> 8)) * (self->division & 0xff);
+    } else {
+        num = (uint64_t)ticks * self->us_per_quarter * self->synth.base.sample_rate;
+        den = (uint64_t)self->division * 1000000;
+    }
+    // Carry the fraction forward so rounding doesn't add up over a long song.
+    num += self->sample_remainder;
+    self->sample_remainder = num % den;
+    return MIN(num / den, UINT32_MAX);
+}
+
+static void set_pause(synthio_miditrack_obj_t *self, uint32_t samples) {
+    self->synth.span.dur = MIN(samples, UINT16_MAX);
+    self->pause_remaining = samples - self->synth.span.dur;
+}
+
+static void decode_file_until_pause(synthio_miditrack_obj_t *self) {
+    while (self->queue_len > 0) {
+        uint16_t stream_index = self->queue[0];
+        synthio_miditrack_stream_t *stream = &self->streams[stream_index];
+        if (stream->next_tick != self->tick) {
+            uint32_t samples = ticks_to_samples(self, stream->next_tick - self->tick);
+            self->tick = stream->next_tick;
+            if (samples > 0) {
+                set_pause(self, samples);
+                return;
+            }
+        }
+        if (stream_play_event(self, stream)) {
+            queue_sift_down(self, 0);
+        } else if (self->queue_len > 0) {
+            queue_pop(self);
+        }
+    }
+    set_pause(self, 0);
+}
+
+static void start_file_parse(synthio_miditrack_obj_t *self) {
+    self->error_location = -1;
+    self->us_per_quarter = 500000; // 120 beats per minute until the file says otherwise
+    self->tick = 0;
+    self->sample_remainder = 0;
+    self->queue_len = 0;
+    for (uint16_t i = 0; i < self->stream_count; i++) {
+        synthio_miditrack_stream_t *stream = &self->streams[i];
+        stream->next_read = stream->start;
+        stream->pos = stream->len = 0;
+        stream->running_status = 0;
+        uint32_t delta;
+        if (stream_read_varlen(self, stream, &delta)) {
+            stream->next_tick = delta;
+            queue_push(self, i);
+        }
+    }
+    decode_file_until_pause(self);
+}
+
+void common_hal_synthio_miditrack_construct_from_file(synthio_miditrack_obj_t *self,
+    pyb_file_obj_t *file, uint32_t sample_rate,
+    mp_obj_t waveform_obj, mp_obj_t filter_obj, mp_obj_t envelope_obj) {
+
+    FIL *fp = &file->fp;
+    uint8_t header[14];
+    UINT bytes_read;
+    f_rewind(fp);
+    if (f_read(fp, header, sizeof(header), &bytes_read) != FR_OK) {
+        mp_raise_OSError(MP_EIO);
+    }
+    uint32_t header_length = read_be32(header + 4);
+    uint16_t format = (header[8] << 8) | header[9];
+    uint16_t track_count = (header[10] << 8) | header[11];
+    uint16_t division = (header[12] << 8) | header[13];
+    // Format 2 files hold independent songs, which can't be merged into one.
+    if (bytes_read != sizeof(header) || memcmp(header, "MThd", 4) || header_length < 6 ||
+        format > 1 || track_count == 0 || (format == 0 && track_count != 1) ||
+        division == 0 || ((division & 0x8000) && (division & 0xff) == 0)) {
+        mp_arg_error_invalid(MP_QSTR_file);
+    }
+
+    synthio_miditrack_stream_t *streams = m_malloc(sizeof(synthio_miditrack_stream_t) * track_count);
+    uint16_t *queue = m_malloc(sizeof(uint16_t) * track_count);
+
+    // Find the track chunks, skipping any chunk types we don't know.
+    uint32_t offset = 8 + header_length;
+    uint16_t found = 0;
+    while (found < track_count) {
+        uint8_t chunk_header[8];
+        if (f_lseek(fp, offset) != FR_OK || f_read(fp, chunk_header, sizeof(chunk_header), &bytes_read) != FR_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+        if (bytes_read != sizeof(chunk_header)) {
+            mp_arg_error_invalid(MP_QSTR_file);
+        }
+        uint32_t chunk_length = read_be32(chunk_header + 4);
+        offset += sizeof(chunk_header);
+        if (memcmp(chunk_header, "MTrk", 4) == 0) {
+            streams[found].start = offset;
+            streams[found].end = offset + chunk_length;
+            found++;
+        }
+        offset += chunk_length;
+    }
+
+    self->tempo = 0;
+    self->track.buf = NULL;
+    self->track.len = 0;
+    self->pos = 0;
+    self->file = file;
+    self->streams = streams;
+    self->queue = queue;
+    self->stream_count = track_count;
+    self->division = division;
+
+    synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj);
+
+    start_file_parse(self);
+}
+
 void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
     const uint8_t *buffer, uint32_t len, uint32_t tempo, uint32_t sample_rate,
     mp_obj_t waveform_obj, mp_obj_t filter_obj, mp_obj_t envelope_obj) {
@@ -102,6 +428,7 @@ void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
     self->tempo = tempo;
     self->track.buf = (void *)buffer;
     self->track.len = len;
+    self->file = NULL;
 
     synthio_synth_init(&self->synth, sample_rate, 1, waveform_obj, envelope_obj);
 
@@ -110,6 +437,10 @@ void common_hal_synthio_miditrack_construct(synthio_miditrack_obj_t *self,
 
 void common_hal_synthio_miditrack_deinit(synthio_miditrack_obj_t *self) {
     synthio_synth_deinit(&self->synth);
+    self->file = NULL;
+    self->streams = NULL;
+    self->queue = NULL;
+    self->queue_len = 0;
 }
 
 mp_int_t common_hal_synthio_miditrack_get_error_location(synthio_miditrack_obj_t *self) {
@@ -119,7 +450,11 @@ mp_int_t common_hal_synthio_miditrack_get_error_location(synthio_miditrack_obj_t
 void synthio_miditrack_reset_buffer(synthio_miditrack_obj_t *self,
     bool single_channel_output, uint8_t channel) {
     synthio_synth_reset_buffer(&self->synth, single_channel_output, channel);
-    start_parse(self);
+    if (self->file) {
+        start_file_parse(self);
+    } else {
+        start_parse(self);
+    }
 }
 
 audioio_get_buffer_result_t synthio_miditrack_get_buffer(synthio_miditrack_obj_t *self,
@@ -130,6 +465,18 @@ audioio_get_buffer_result_t synthio_miditrack_get_buffer(synthio_miditrack_obj_t
     }
 
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? 0 : channel);
+    if (self->file) {
+        if (self->synth.span.dur == 0) {
+            if (self->pause_remaining > 0) {
+                set_pause(self, self->pause_remaining);
+            } else if (self->queue_len == 0) {
+                return GET_BUFFER_DONE;
+            } else {
+                decode_file_until_pause(self);
+            }
+        }
+        return GET_BUFFER_MORE_DATA;
+    }
     if (self->synth.span.dur == 0) {
         if (self->pos == self->track.len) {
             return GET_BUFFER_DONE;
@@ -6,10 +6,26 @@
 
 #pragma once
 
+#include "extmod/vfs_fat.h"
 #include "py/obj.h"
 
 #include "shared-module/synthio/__init__.h"
 
+// Bytes of each track of a MIDI file that are read ahead.
+#define SYNTHIO_MIDITRACK_READ_AHEAD (32)
+
+// One track chunk of a MIDI file that is played straight from the filesystem.
+typedef struct {
+    uint32_t start; // File offset of the first delta time
+    uint32_t end; // File offset just past the end of the chunk
+    uint32_t next_read; // File offset of the first byte not yet in buffer
+    uint32_t next_tick; // Time of the next event, in ticks from the start of the song
+    uint8_t running_status;
+    uint8_t pos;
+    uint8_t len;
+    uint8_t buffer[SYNTHIO_MIDITRACK_READ_AHEAD];
+} synthio_miditrack_stream_t;
+
 typedef struct {
     synthio_synth_t synth;
     mp_buffer_info_t track;
@@ -17,6 +33,19 @@ typedef struct {
     size_t pos;
     mp_int_t error_location;
     uint32_t tempo;
+
+    // Only used when playing a MIDI file with synthio.from_file().
+    pyb_file_obj_t *file;
+    synthio_miditrack_stream_t *streams;
+    // Min-heap of indices into streams, ordered by the time of their next event.
+    uint16_t *queue;
+    uint16_t stream_count;
+    uint16_t queue_len;
+    uint16_t division;
+    uint32_t us_per_quarter;
+    uint32_t tick; // Time of the events last played
+    uint32_t pause_remaining; // Samples of the current pause that didn't fit in span.dur
+    uint64_t sample_remainder;
 } synthio_miditrack_obj_t;
 
 
@@ -8,16 +8,69 @@
 #include "py/runtime.h"
 #include "shared-module/synthio/Note.h"
 #include "shared-bindings/synthio/Note.h"
+#include "shared-bindings/synthio/Sample.h"
 #include "shared-bindings/synthio/__init__.h"
 
 mp_float_t common_hal_synthio_note_get_frequency(synthio_note_obj_t *self) {
     return self->frequency;
 }
 
+// Picks the first sample whose zone holds the note's pitch and velocity.
+static void synthio_note_select_sample(synthio_note_obj_t *self) {
+    self->sample = NULL;
+    if (self->sample_obj == MP_OBJ_NULL || self->sample_obj == mp_const_none) {
+        return;
+    }
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(self->sample_obj, &len, &items);
+    mp_int_t note = 0;
+    if (self->frequency > 0) {
+        note = (mp_int_t)MICROPY_FLOAT_C_FUN(round)(69 + 12 * MICROPY_FLOAT_C_FUN(log2)(self->frequency / 440));
+    }
+    for (size_t i = 0; i < len; i++) {
+        const synthio_sample_obj_t *sample = MP_OBJ_TO_PTR(items[i]);
+        if (synthio_sample_matches(sample, note, self->velocity)) {
+            self->sample = sample;
+            return;
+        }
+    }
+}
+
 void common_hal_synthio_note_set_frequency(synthio_note_obj_t *self, mp_float_t value_in) {
     mp_float_t val = mp_arg_validate_float_range(value_in, 0, 32767, MP_QSTR_frequency);
     self->frequency = val;
     self->frequency_scaled = synthio_frequency_convert_float_to_scaled(val);
+    synthio_note_select_sample(self);
+}
+
+mp_obj_t common_hal_synthio_note_get_sample_obj(synthio_note_obj_t *self) {
+    return self->sample_obj;
+}
+
+void common_hal_synthio_note_set_sample(synthio_note_obj_t *self, mp_obj_t sample_in) {
+    if (mp_obj_is_type(sample_in, &synthio_sample_type)) {
+        sample_in = mp_obj_new_tuple(1, &sample_in);
+    } else if (sample_in != mp_const_none) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(sample_in, &len, &items);
+        for (size_t i = 0; i < len; i++) {
+            mp_arg_validate_type(items[i], &synthio_sample_type, MP_QSTR_sample);
+        }
+        sample_in = mp_obj_new_tuple(len, items);
+    }
+    self->sample_obj = sample_in;
+    synthio_note_select_sample(self);
+}
+
+mp_int_t common_hal_synthio_note_get_velocity(synthio_note_obj_t *self) {
+    return self->velocity;
+}
+
+void common_hal_synthio_note_set_velocity(synthio_note_obj_t *self, mp_int_t value_in) {
+    self->velocity = mp_arg_validate_int_range(value_in, 0, 127, MP_QSTR_velocity);
+    synthio_note_select_sample(self);
 }
 
 mp_obj_t common_hal_synthio_note_get_filter_obj(synthio_note_obj_t *self) {
@@ -89,6 +142,57 @@ void common_hal_synthio_note_set_envelope(synthio_note_obj_t *self, mp_obj_t env
     self->envelope_obj = envelope_in;
 }
 
+// The shortest band-limited copy that is worth making.
+#define MIPMAP_MIN_LENGTH (8)
+
+// Builds octave-decimated copies of the waveform for high notes to play instead of skipping
+// samples in the full one, which aliases.
+static void synthio_note_update_mipmap(synthio_note_obj_t *self) {
+    self->waveform_mipmap = NULL;
+    self->waveform_mipmap_levels = 0;
+    if (!self->band_limited || self->waveform_buf.buf == NULL) {
+        return;
+    }
+
+    size_t total = 0;
+    uint8_t levels = 0;
+    for (size_t n = self->waveform_buf.len; n % 2 == 0 && n / 2 >= MIPMAP_MIN_LENGTH; n /= 2) {
+        total += n / 2;
+        levels++;
+    }
+    if (levels == 0) {
+        return;
+    }
+
+    int16_t *mipmap = m_malloc(total * sizeof(int16_t));
+    const int16_t *src = self->waveform_buf.buf;
+    int16_t *dst = mipmap;
+    for (size_t n = self->waveform_buf.len; dst < mipmap + total; n /= 2) {
+        for (size_t i = 0; i < n / 2; i++) {
+            // Halfband lowpass (-1, 0, 9, 16, 9, 0, -1) / 32 centered on each kept sample. The
+            // waveform loops so the taps wrap around.
+            size_t j = 2 * i;
+            int32_t acc = 16 * src[j] +
+                9 * (src[(j + n - 1) % n] + src[(j + 1) % n]) -
+                (src[(j + n - 3) % n] + src[(j + 3) % n]);
+            dst[i] = synthio_sat16(acc, 5);
+        }
+        src = dst;
+        dst += n / 2;
+    }
+    self->waveform_mipmap = mipmap;
+    self->waveform_mipmap_levels = levels;
+}
+
+bool common_hal_synthio_note_get_band_limited(synthio_note_obj_t *self) {
+    return self->band_limited;
+}
+
+void common_hal_synthio_note_set_band_limited(synthio_note_obj_t *self, bool value_in) {
+    self->band_limited = value_in;
+    synthio_note_update_mipmap(self);
+}
+
 mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self) {
     return self->waveform_obj;
 }
@@ -102,6 +206,7 @@ void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t wav
         self->waveform_buf = bufinfo_waveform;
     }
     self->waveform_obj = waveform_in;
+    synthio_note_update_mipmap(self);
 }
 
 mp_obj_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self) {
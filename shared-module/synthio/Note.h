@@ -9,6 +9,7 @@
 #include "shared-module/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/LFO.h"
+#include "shared-module/synthio/Sample.h"
 #include "shared-bindings/synthio/__init__.h"
 
 typedef struct synthio_note_obj {
@@ -29,9 +30,18 @@ typedef struct synthio_note_obj {
 
     mp_buffer_info_t waveform_buf;
     synthio_block_slot_t waveform_loop_start, waveform_loop_end;
+    // Band-limited copies of waveform_buf, each half as long as the one before it.
+    int16_t *waveform_mipmap;
+    uint8_t waveform_mipmap_levels;
+    bool band_limited;
     mp_buffer_info_t ring_waveform_buf;
     synthio_block_slot_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
+    // A Sample or a tuple of them. The one that matches the frequency and velocity is played
+    // instead of the waveform.
+    mp_obj_t sample_obj;
+    const synthio_sample_obj_t *sample; // NULL if no zone matches.
+    uint8_t velocity;
 } synthio_note_obj_t;
 
 void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate);
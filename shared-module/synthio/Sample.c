@@ -0,0 +1,59 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Sample.h"
+#include "shared-module/synthio/Sample.h"
+
+void common_hal_synthio_sample_construct(synthio_sample_obj_t *self, mp_obj_t data_obj,
+    const mp_buffer_info_t *data, uint32_t sample_rate, mp_float_t root_frequency,
+    uint32_t loop_start, uint32_t loop_end, const uint8_t note_range[2], const uint8_t velocity_range[2]) {
+    self->data_obj = data_obj;
+    self->data = data->buf;
+    self->length = data->len / sizeof(int16_t);
+    self->sample_rate = sample_rate;
+    self->root_frequency = root_frequency;
+    self->rate_scale = sample_rate / root_frequency;
+    self->loop_start = loop_start;
+    self->loop_end = loop_end;
+    memcpy(self->note_range, note_range, sizeof(self->note_range));
+    memcpy(self->velocity_range, velocity_range, sizeof(self->velocity_range));
+}
+
+mp_obj_t common_hal_synthio_sample_get_data(synthio_sample_obj_t *self) {
+    return self->data_obj;
+}
+
+uint32_t common_hal_synthio_sample_get_sample_rate(synthio_sample_obj_t *self) {
+    return self->sample_rate;
+}
+
+mp_float_t common_hal_synthio_sample_get_root_frequency(synthio_sample_obj_t *self) {
+    return self->root_frequency;
+}
+
+uint32_t common_hal_synthio_sample_get_loop_start(synthio_sample_obj_t *self) {
+    return self->loop_start;
+}
+
+uint32_t common_hal_synthio_sample_get_loop_end(synthio_sample_obj_t *self) {
+    return self->loop_end;
+}
+
+const uint8_t *common_hal_synthio_sample_get_note_range(synthio_sample_obj_t *self) {
+    return self->note_range;
+}
+
+const uint8_t *common_hal_synthio_sample_get_velocity_range(synthio_sample_obj_t *self) {
+    return self->velocity_range;
+}
+
+bool synthio_sample_matches(const synthio_sample_obj_t *self, mp_int_t note, mp_int_t velocity) {
+    return self->note_range[0] <= note && note <= self->note_range[1] &&
+           self->velocity_range[0] <= velocity && velocity <= self->velocity_range[1];
+}
@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef struct synthio_sample_obj {
+    mp_obj_base_t base;
+    mp_obj_t data_obj;
+    // Played in place so it may be in flash.
+    const int16_t *data;
+    uint32_t length; // In samples.
+    uint32_t loop_start;
+    uint32_t loop_end; // 0 when the sample plays once.
+    uint32_t sample_rate;
+    mp_float_t root_frequency;
+    // sample_rate / root_frequency, so that multiplying by a note's frequency gives the number of
+    // samples to step each second.
+    mp_float_t rate_scale;
+    uint8_t note_range[2];
+    uint8_t velocity_range[2];
+} synthio_sample_obj_t;
+
+bool synthio_sample_matches(const synthio_sample_obj_t *self, mp_int_t note, mp_int_t velocity);
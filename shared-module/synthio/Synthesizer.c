@@ -46,10 +46,11 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
     mp_obj_t iterable = mp_getiter(self->blocks, &iter_buf);
     mp_obj_t item;
     while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        synthio_block_slot_t slot;
         if (!synthio_obj_is_block(item)) {
             continue;
         }
-        synthio_block_slot_t slot = { item };
+        synthio_block_assign_slot(item, &slot, MP_QSTR_blocks);
         (void)synthio_block_slot_get(&slot);
     }
     return GET_BUFFER_MORE_DATA;
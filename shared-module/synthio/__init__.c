@@ -171,7 +171,48 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
-static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
+// Everything the per-sample loop needs to play one note for one block.
+typedef struct {
+    const int16_t *waveform;
+    uint32_t dds_rate;
+    uint32_t offset;
+    uint32_t lim;
+    // NULL when the note isn't ring modulated.
+    const int16_t *ring_waveform;
+    uint32_t ring_dds_rate;
+    uint32_t ring_offset;
+    uint32_t ring_lim;
+    // Played instead of waveform when not NULL. dds_rate is then the 16.16 step through its data.
+    const synthio_sample_obj_t *sample;
+} synth_note_dds_t;
+
+// Pitch shifting further than this would need more than one loop wrap per output sample.
+#define SAMPLE_MAX_RATE (16 << SYNTHIO_FREQUENCY_SHIFT)
+
+// Sets up a note that plays a Sample. Returns false once a sample that doesn't loop has ended.
+static bool synth_sample_setup(synthio_synth_t *synth, int chan, const synthio_sample_obj_t *sample,
+    uint32_t frequency_scaled, synth_note_dds_t *dds) {
+    uint32_t end = sample->loop_end ? sample->loop_end : sample->length;
+    if (synth->sample_index[chan] >= end) {
+        if (!sample->loop_end) {
+            // Let the note be freed as if its release had finished.
+            synth->envelope_state[chan].state = SYNTHIO_ENVELOPE_STATE_RELEASE;
+            synth->envelope_state[chan].level = 0;
+            return false;
+        }
+        // A different zone was chosen mid-note.
+        synth->sample_index[chan] = sample->loop_start;
+    }
+    mp_float_t rate = frequency_scaled * sample->rate_scale / synth->base.sample_rate;
+    dds->dds_rate = rate < SAMPLE_MAX_RATE ? (uint32_t)rate : SAMPLE_MAX_RATE;
+    dds->sample = sample;
+    dds->ring_waveform = NULL;
+    return true;
+}
+
+// Works out the note's waveforms and rates for the next dur samples. Returns false if the note
+// can't be played at all.
+static bool synth_note_setup(synthio_synth_t *synth, int chan, int16_t dur, int16_t loudness[2], synth_note_dds_t *dds) {
     mp_obj_t note_obj = synth->span.note_obj[chan];
 
     int32_t sample_rate = synth->base.sample_rate;
@@ -200,6 +241,9 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
         int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
+        if (note->sample_obj != MP_OBJ_NULL && note->sample_obj != mp_const_none) {
+            return note->sample && synth_sample_setup(synth, chan, note->sample, frequency_scaled, dds);
+        }
         if (note->waveform_buf.buf) {
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
@@ -207,6 +251,26 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
         }
         dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
+        uint8_t level = 0;
+        if (note->waveform_mipmap && waveform_start == 0 && waveform_length == note->waveform_buf.len) {
+            // Step down to a shorter band-limited copy until each output sample advances by at most
+            // one waveform sample.
+            const int16_t *mipmap = note->waveform_mipmap;
+            while (dds_rate > (1 << SYNTHIO_FREQUENCY_SHIFT) && level < note->waveform_mipmap_levels) {
+                waveform = mipmap;
+                mipmap += waveform_length / 2;
+                waveform_length /= 2;
+                dds_rate /= 2;
+                level++;
+            }
+        }
+        // Keep the phase when the note moves to a waveform of a different length.
+        if (level > synth->mipmap_level[chan]) {
+            synth->accum[chan] >>= level - synth->mipmap_level[chan];
+        } else {
+            synth->accum[chan] <<= synth->mipmap_level[chan] - level;
+        }
+        synth->mipmap_level[chan] = level;
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
@@ -222,7 +286,6 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
 
     uint32_t offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t accum = synth->accum[chan];
 
     if (dds_rate > lim / 2) {
         // beyond nyquist, can't play note
@@ -230,52 +293,163 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     }
 
     // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
+    if (synth->accum[chan] > lim) {
+        synth->accum[chan] = synth->accum[chan] % lim + offset;
+    }
+
+    dds->waveform = waveform;
+    dds->dds_rate = dds_rate;
+    dds->offset = offset;
+    dds->lim = lim;
+    dds->ring_waveform = NULL;
+    dds->sample = NULL;
+
+    // beyond nyquist, can't play ring, but the main sound still plays
+    if (ring_dds_rate && ring_dds_rate <= lim / 2) {
+        dds->ring_waveform = ring_waveform;
+        dds->ring_dds_rate = ring_dds_rate;
+        dds->ring_offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+        dds->ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+
+        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
+        if (synth->ring_accum[chan] > dds->ring_lim) {
+            synth->ring_accum[chan] = synth->ring_accum[chan] % dds->ring_lim + dds->ring_offset;
+        }
     }
+    return true;
+}
+
+// Renders dur samples of a note. With synth_chan 0, the raw samples are stored in out_buffer32 so
+// they can be filtered first. Otherwise they are scaled by loudness and summed straight into the
+// mono or stereo out_buffer32. ring and synth_chan are constants at each call site so every
+// combination gets its own loop.
+__attribute__((always_inline))
+static inline void synth_note_render_inline(synthio_synth_t *synth, int chan, const synth_note_dds_t *dds,
+    int32_t *out_buffer32, int16_t dur, const int16_t loudness[2], bool ring, int synth_chan) {
+    const int16_t *waveform = dds->waveform;
+    uint32_t dds_rate = dds->dds_rate;
+    uint32_t offset = dds->offset;
+    uint32_t lim = dds->lim;
+    uint32_t accum = synth->accum[chan];
+
+    const int16_t *ring_waveform = dds->ring_waveform;
+    uint32_t ring_dds_rate = dds->ring_dds_rate;
+    uint32_t ring_offset = dds->ring_offset;
+    uint32_t ring_lim = dds->ring_lim;
+    uint32_t ring_accum = synth->ring_accum[chan];
 
-    // first, fill with waveform
     for (uint16_t i = 0; i < dur; i++) {
         accum += dds_rate;
         // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
         if (accum > lim) {
             accum = accum - lim + offset;
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        int32_t sample = waveform[accum >> SYNTHIO_FREQUENCY_SHIFT];
+
+        if (ring) {
+            ring_accum += ring_dds_rate;
+            if (ring_accum > ring_lim) {
+                ring_accum = ring_accum - ring_lim + ring_offset;
+            }
+            int16_t wi = (ring_waveform[ring_accum >> SYNTHIO_FREQUENCY_SHIFT] * sample) / 32768; // consider for synthio_sat16 but had a weird artificat
+            sample = wi;
+        }
+
+        if (synth_chan == 0) {
+            out_buffer32[i] = sample;
+        } else if (synth_chan == 1) {
+            out_buffer32[i] += synthio_sat16(sample * loudness[0], 16);
+        } else {
+            out_buffer32[2 * i] += synthio_sat16(sample * loudness[0], 16);
+            out_buffer32[2 * i + 1] += synthio_sat16(sample * loudness[1], 16);
+        }
     }
+
     synth->accum[chan] = accum;
+    if (ring) {
+        synth->ring_accum[chan] = ring_accum;
+    }
+}
 
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
+// Renders dur samples of a note playing a Sample, like synth_note_render_inline. The data is
+// resampled by linear interpolation. A sample that doesn't loop is followed by silence.
+__attribute__((always_inline))
+static inline void synth_sample_render_inline(synthio_synth_t *synth, int chan, const synth_note_dds_t *dds,
+    int32_t *out_buffer32, int16_t dur, const int16_t loudness[2], int synth_chan) {
+    const synthio_sample_obj_t *sample = dds->sample;
+    const int16_t *data = sample->data;
+    bool loop = sample->loop_end != 0;
+    uint32_t end = loop ? sample->loop_end : sample->length;
+    uint32_t loop_length = end - sample->loop_start;
+    uint32_t dds_rate = dds->dds_rate;
+    uint32_t index = synth->sample_index[chan];
+    uint32_t fraction = synth->accum[chan];
+
+    for (uint16_t i = 0; i < dur; i++) {
+        int32_t value = 0;
+        if (index < end) {
+            int32_t a = data[index];
+            int32_t b = a;
+            if (index + 1 < end) {
+                b = data[index + 1];
+            } else if (loop) {
+                b = data[sample->loop_start];
+            }
+            value = a + (((b - a) * (int32_t)(fraction >> 1)) >> 15);
         }
 
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        fraction += dds_rate;
+        index += fraction >> SYNTHIO_FREQUENCY_SHIFT;
+        fraction &= (1 << SYNTHIO_FREQUENCY_SHIFT) - 1;
+        if (loop) {
+            while (index >= end) {
+                index -= loop_length;
+            }
+        } else if (index > end) {
+            index = end;
+        }
 
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum = accum % lim + offset;
+        if (synth_chan == 0) {
+            out_buffer32[i] = value;
+        } else if (synth_chan == 1) {
+            out_buffer32[i] += synthio_sat16(value * loudness[0], 16);
+        } else {
+            out_buffer32[2 * i] += synthio_sat16(value * loudness[0], 16);
+            out_buffer32[2 * i + 1] += synthio_sat16(value * loudness[1], 16);
         }
+    }
 
-        for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
-            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-            if (accum > lim) {
-                accum = accum - lim + offset;
-            }
-            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
-            out_buffer32[i] = wi;
+    synth->sample_index[chan] = index;
+    synth->accum[chan] = fraction;
+}
+
+static void synth_note_render(synthio_synth_t *synth, int chan, const synth_note_dds_t *dds,
+    int32_t *out_buffer32, int16_t dur, const int16_t loudness[2], int synth_chan) {
+    if (dds->sample) {
+        if (synth_chan == 0) {
+            synth_sample_render_inline(synth, chan, dds, out_buffer32, dur, loudness, 0);
+        } else if (synth_chan == 1) {
+            synth_sample_render_inline(synth, chan, dds, out_buffer32, dur, loudness, 1);
+        } else {
+            synth_sample_render_inline(synth, chan, dds, out_buffer32, dur, loudness, 2);
+        }
+    } else if (dds->ring_waveform) {
+        if (synth_chan == 0) {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, true, 0);
+        } else if (synth_chan == 1) {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, true, 1);
+        } else {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, true, 2);
+        }
+    } else {
+        if (synth_chan == 0) {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, false, 0);
+        } else if (synth_chan == 1) {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, false, 1);
+        } else {
+            synth_note_render_inline(synth, chan, dds, out_buffer32, dur, loudness, false, 2);
         }
-        synth->ring_accum[chan] = accum;
     }
-    return true;
 }
 
 static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
@@ -337,7 +511,8 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
+        synth_note_dds_t dds;
+        if (!synth_note_setup(synth, chan, dur, loudness, &dds)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
             continue;
@@ -345,13 +520,18 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         mp_obj_t filter_obj = synthio_synth_get_note_filter(note_obj);
         if (filter_obj != mp_const_none) {
+            synth_note_render(synth, chan, &dds, tmp_buffer32, dur, loudness, 0);
+
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
             common_hal_synthio_biquad_tick(filter_obj);
             synthio_biquad_filter_samples(filter_obj, &note->filter_state, tmp_buffer32, dur);
-        }
 
-        // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
+            // adjust loudness by envelope
+            sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
+        } else {
+            // Without a filter, the envelope and mixing happen in the same pass as synthesis.
+            synth_note_render(synth, chan, &dds, out_buffer32, dur, loudness, synth->base.channel_count);
+        }
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -462,6 +642,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
     if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
         // note already playing, re-enter attack phase
         synth->envelope_state[channel].state = SYNTHIO_ENVELOPE_STATE_ATTACK;
+        synth->sample_index[channel] = 0;
         return true;
     }
     channel = find_channel_with_note(synth, old_note);
@@ -472,6 +653,8 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
             synth->span.note_obj[channel] = new_note;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
+            synth->mipmap_level[channel] = 0;
+            synth->sample_index[channel] = 0;
         }
         return true;
     }
@@ -499,19 +682,18 @@ void shared_bindings_synthio_lfo_tick(uint32_t sample_rate, uint16_t num_samples
 
 mp_float_t synthio_block_slot_get(synthio_block_slot_t *slot) {
     // all numbers (and None!) previously converted to float in synthio_block_assign_slot
-    if (mp_obj_is_float(slot->obj)) {
-        return mp_obj_get_float(slot->obj);
+    synthio_block_base_t *block = slot->block;
+    if (block == NULL) {
+        return slot->value;
     }
 
-    synthio_block_base_t *block = MP_OBJ_TO_PTR(slot->obj);
+    // Each block is evaluated at most once per tick, no matter how many slots refer to it
     if (block->last_tick == synthio_global_tick) {
         return block->value;
     }
 
     block->last_tick = synthio_global_tick;
-    // previously verified by call to mp_proto_get in synthio_block_assign_slot
-    const synthio_block_proto_t *p = MP_OBJ_TYPE_GET_SLOT(mp_obj_get_type(slot->obj), protocol);
-    mp_float_t value = p->tick(slot->obj);
+    mp_float_t value = block->tick(MP_OBJ_FROM_PTR(block));
     block->value = value;
     return value;
 }
@@ -533,8 +715,12 @@ int32_t synthio_block_slot_get_scaled(synthio_block_slot_t *lfo_slot, mp_float_t
 }
 
 bool synthio_block_assign_slot_maybe(mp_obj_t obj, synthio_block_slot_t *slot) {
-    if (synthio_obj_is_block(obj)) {
+    const synthio_block_proto_t *p = mp_proto_get(MP_QSTR_synthio_block, obj);
+    if (p) {
+        synthio_block_base_t *block = MP_OBJ_TO_PTR(obj);
+        block->tick = p->tick;
         slot->obj = obj;
+        slot->block = block;
         return true;
     }
 
@@ -544,6 +730,8 @@ bool synthio_block_assign_slot_maybe(mp_obj_t obj, synthio_block_slot_t *slot) {
     }
 
     slot->obj = mp_obj_new_float(value);
+    slot->block = NULL;
+    slot->value = value;
     return true;
 }
 
@@ -54,6 +54,9 @@ typedef struct synthio_synth {
     synthio_midi_span_t span;
     uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // For notes playing a Sample, the whole part of the position. accum holds the fraction.
+    uint32_t sample_index[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    uint8_t mipmap_level[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
 } synthio_synth_t;
 
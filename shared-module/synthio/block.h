@@ -12,14 +12,22 @@
 #include "shared-module/synthio/__init__.h"
 #include "shared-bindings/synthio/__init__.h"
 
+typedef mp_float_t (*synthio_block_tick_fun)(mp_obj_t obj);
+
 typedef struct synthio_block_base {
     mp_obj_base_t base;
     uint8_t last_tick;
     mp_float_t value;
+    // Copied from the type's protocol when the block is first assigned to a slot
+    synthio_block_tick_fun tick;
 } synthio_block_base_t;
 
 typedef struct synthio_block_slot {
     mp_obj_t obj;
+    // Resolved from obj when it is assigned, so that getting the value doesn't have to look at
+    // obj's type: the block to tick, or NULL if obj is a number whose value is stored here.
+    synthio_block_base_t *block;
+    mp_float_t value;
 } synthio_block_slot_t;
 
 typedef struct {
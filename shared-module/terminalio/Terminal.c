@@ -145,6 +145,26 @@ static void terminalio_terminal_set_all_tiles(terminalio_terminal_obj_t *self, b
     }
 }
 
+#if CIRCUITPY_FONTIO
+// Writes the run of printable ASCII starting at text that fits on the rest of
+// the cursor's row with a single tile grid update. Returns the number of
+// characters written.
+static size_t terminalio_terminal_write_ascii_run(terminalio_terminal_obj_t *self, const byte *text, const byte *end) {
+    uint16_t width = self->scroll_area->width_in_tiles;
+    size_t count = 0;
+    size_t max_count = MIN((size_t)(end - text), (size_t)(width - self->cursor_x));
+    uint8_t tile_indices[max_count];
+    while (count < max_count && text[count] >= 0x20 && text[count] <= 0x7e) {
+        tile_indices[count] = text[count] - 0x20;
+        count++;
+    }
+    displayio_tilegrid_set_tiles_in_row(self->scroll_area, self->cursor_x, self->cursor_y, tile_indices, count);
+    self->cursor_x += count;
+    wrap_cursor(width, self->scroll_area->height_in_tiles, &self->cursor_x, &self->cursor_y);
+    return count;
+}
+#endif
+
 void terminalio_terminal_clear_status_bar(terminalio_terminal_obj_t *self) {
     if (self->status_bar) {
         terminalio_terminal_set_all_tiles(self, true, ' ', true);
@@ -410,6 +430,12 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                     i += j + 1;
                 }
             }
+        #if CIRCUITPY_FONTIO
+        } else if (c <= 0x7e && self->cursor_x < self->scroll_area->width_in_tiles &&
+                   mp_obj_is_type(self->font, &fontio_builtinfont_type)) {
+            // Printable ASCII maps straight to builtin font tiles so place it a row at a time.
+            i += terminalio_terminal_write_ascii_run(self, i - 1, data + len) - 1;
+        #endif
         } else {
             terminalio_terminal_set_tile(self, false, c, true);
         }
@@ -4,6 +4,7 @@
 //
 // SPDX-License-Identifier: MIT
 #include <stdlib.h>
+#include <string.h>
 #include "py/runtime.h"
 #include "shared-bindings/tilepalettemapper/TilePaletteMapper.h"
 #include "shared-bindings/displayio/Palette.h"
@@ -15,6 +16,10 @@ void common_hal_tilepalettemapper_tilepalettemapper_construct(tilepalettemapper_
     self->pixel_shader = pixel_shader;
     self->input_color_count = input_color_count;
     self->tilegrid = mp_const_none;
+    self->tile_colors = NULL;
+    self->tile_colors_valid = NULL;
+    self->cached_colorspace = NULL;
+    self->use_tile_colors = false;
 }
 
 uint16_t common_hal_tilepalettemapper_tilepalettemapper_get_width(tilepalettemapper_tilepalettemapper_t *self) {
@@ -55,9 +60,51 @@ void common_hal_tilepalettemapper_tilepalettemapper_set_mapping(tilepalettemappe
         mp_arg_validate_int_range(mapping_val, 0, palette_max, MP_QSTR_mapping_value);
         self->tile_mappings[y * self->width_in_tiles + x][i] = mapping_val;
     }
+    if (self->tile_colors_valid != NULL) {
+        uint32_t tile_index = y * self->width_in_tiles + x;
+        self->tile_colors_valid[tile_index / 32] &= ~(1u << (tile_index % 32));
+    }
     displayio_tilegrid_mark_tile_dirty(self->tilegrid, x, y);
 }
 
+void tilepalettemapper_tilepalettemapper_start_fill(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace) {
+    self->use_tile_colors = false;
+    if (self->tile_colors == NULL) {
+        return;
+    }
+    displayio_palette_t *palette = self->pixel_shader;
+    // Dithering depends on the pixel location so it can't be cached.
+    if (palette->dither) {
+        return;
+    }
+    if (self->cached_colorspace != colorspace ||
+        self->cached_colorspace_grayscale_bit != colorspace->grayscale_bit ||
+        self->cached_colorspace_grayscale != colorspace->grayscale ||
+        self->cached_palette_generation != palette->generation) {
+        size_t tile_count = self->width_in_tiles * self->height_in_tiles;
+        memset(self->tile_colors_valid, 0, (tile_count + 31) / 32 * sizeof(uint32_t));
+        self->cached_colorspace = colorspace;
+        self->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+        self->cached_colorspace_grayscale = colorspace->grayscale;
+        self->cached_palette_generation = palette->generation;
+    }
+    self->use_tile_colors = true;
+}
+
+static void _update_tile_colors(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, uint16_t tile_index) {
+    uint32_t *colors = self->tile_colors + tile_index * self->input_color_count;
+    displayio_input_pixel_t tmp_pixel = {0};
+    displayio_output_pixel_t output_color;
+    for (uint16_t i = 0; i < self->input_color_count; i++) {
+        tmp_pixel.pixel = self->tile_mappings[tile_index][i];
+        output_color.pixel = 0;
+        output_color.opaque = true;
+        displayio_palette_get_color(self->pixel_shader, colorspace, &tmp_pixel, &output_color);
+        colors[i] = output_color.opaque ? output_color.pixel : TILEPALETTEMAPPER_TRANSPARENT;
+    }
+    self->tile_colors_valid[tile_index / 32] |= 1u << (tile_index % 32);
+}
+
 void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color, uint16_t x_tile_index, uint16_t y_tile_index) {
     if (x_tile_index >= self->width_in_tiles || y_tile_index >= self->height_in_tiles) {
         if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
@@ -68,6 +115,19 @@ void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalette
         return;
     }
     uint16_t tile_index = y_tile_index * self->width_in_tiles + x_tile_index;
+    if (input_pixel->pixel >= self->input_color_count) {
+        output_color->opaque = false;
+        return;
+    }
+    if (self->use_tile_colors) {
+        if ((self->tile_colors_valid[tile_index / 32] & (1u << (tile_index % 32))) == 0) {
+            _update_tile_colors(self, colorspace, tile_index);
+        }
+        uint32_t color = self->tile_colors[tile_index * self->input_color_count + input_pixel->pixel];
+        output_color->pixel = color;
+        output_color->opaque = (color & TILEPALETTEMAPPER_TRANSPARENT) == 0;
+        return;
+    }
     uint32_t mapped_index = self->tile_mappings[tile_index][input_pixel->pixel];
     displayio_input_pixel_t tmp_pixel;
     tmp_pixel.pixel = mapped_index;
@@ -101,4 +161,10 @@ void tilepalettemapper_tilepalettemapper_bind(tilepalettemapper_tilepalettemappe
             }
         }
     }
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        self->tile_colors = (uint32_t *)m_malloc_without_collect(mappings_len * self->input_color_count * sizeof(uint32_t));
+        size_t valid_len = (mappings_len + 31) / 32 * sizeof(uint32_t);
+        self->tile_colors_valid = (uint32_t *)m_malloc_without_collect(valid_len);
+        memset(self->tile_colors_valid, 0, valid_len);
+    }
 }
@@ -22,7 +22,21 @@ typedef struct {
     uint16_t height_in_tiles;
     uint16_t input_color_count;
     uint32_t **tile_mappings;
+    // Palette shaders only. Each tile's mapping converted to the display's colorspace so a pixel is
+    // a single lookup. Transparent entries have TILEPALETTEMAPPER_TRANSPARENT set.
+    uint32_t *tile_colors;
+    uint32_t *tile_colors_valid; // One bit per tile.
+    const _displayio_colorspace_t *cached_colorspace;
+    uint16_t cached_palette_generation;
+    uint8_t cached_colorspace_grayscale_bit;
+    bool cached_colorspace_grayscale;
+    bool use_tile_colors; // Set by start_fill when the cache can be used for this fill.
 } tilepalettemapper_tilepalettemapper_t;
 
+// Converted colors are at most 24 bits so the top bit is free.
+#define TILEPALETTEMAPPER_TRANSPARENT (1u << 31)
+
+void tilepalettemapper_tilepalettemapper_start_fill(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace);
+
 void tilepalettemapper_tilepalettemapper_get_color(tilepalettemapper_tilepalettemapper_t *self, const _displayio_colorspace_t *colorspace, displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color, uint16_t x_tile_index, uint16_t y_tile_index);
 void tilepalettemapper_tilepalettemapper_bind(tilepalettemapper_tilepalettemapper_t *self, displayio_tilegrid_t *tilegrid);
@@ -13,6 +13,7 @@
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb/core/__init__.h"
+#include "shared-bindings/usb/core/Transfer.h"
 #include "shared-bindings/usb/util/__init__.h"
 #include "shared-module/usb/utf16le.h"
 #include "supervisor/shared/tick.h"
@@ -57,6 +58,7 @@ void common_hal_usb_core_device_deinit(usb_core_device_obj_t *self) {
     if (common_hal_usb_core_device_deinited(self)) {
         return;
     }
+    usb_core_transfer_cancel_all(self->device_address);
     size_t open_size = sizeof(self->open_endpoints);
     for (size_t i = 0; i < open_size; i++) {
         if (self->open_endpoints[i] != 0) {
@@ -334,6 +336,14 @@ mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t e
     return _xfer(&xfer, timeout);
 }
 
+void common_hal_usb_core_device_submit(usb_core_device_obj_t *self, usb_core_transfer_obj_t *transfer,
+    mp_int_t endpoint, mp_obj_t buffer, uint8_t *data, mp_int_t len) {
+    if (!_open_endpoint(self, endpoint)) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    usb_core_transfer_submit(transfer, self->device_address, endpoint, buffer, data, len);
+}
+
 mp_int_t common_hal_usb_core_device_ctrl_transfer(usb_core_device_obj_t *self,
     mp_int_t bmRequestType, mp_int_t bRequest,
     mp_int_t wValue, mp_int_t wIndex,
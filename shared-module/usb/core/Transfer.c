@@ -0,0 +1,154 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb/core/Transfer.h"
+
+#include "tusb_config.h"
+
+#include "lib/tinyusb/src/host/usbh.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared/runtime/interrupt_char.h"
+#include "shared-bindings/usb/core/__init__.h"
+#include "supervisor/shared/tick.h"
+
+// Transfers that haven't finished, oldest first. TinyUSB only runs one transfer per endpoint, so
+// later ones for the same endpoint wait in this list until the earlier one completes. Being a root
+// pointer also keeps the transfers and their buffers from being collected while in flight.
+MP_REGISTER_ROOT_POINTER(struct _usb_core_transfer_obj_t *usb_core_pending_transfers);
+
+static void _remove(usb_core_transfer_obj_t *self) {
+    usb_core_transfer_obj_t **link = &MP_STATE_VM(usb_core_pending_transfers);
+    while (*link != NULL) {
+        if (*link == self) {
+            *link = self->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+    self->next = NULL;
+}
+
+static void _start_next(uint8_t device_address, uint8_t endpoint);
+
+static void _transfer_done_cb(tuh_xfer_t *xfer) {
+    usb_core_transfer_obj_t *self = (usb_core_transfer_obj_t *)xfer->user_data;
+    if (self->state != USB_CORE_TRANSFER_ACTIVE) {
+        return;
+    }
+    self->result = xfer->result;
+    self->actual_len = xfer->actual_len;
+    self->state = USB_CORE_TRANSFER_DONE;
+    _remove(self);
+    // This runs from the TinyUSB background task so the next transfer can start right away.
+    _start_next(self->device_address, self->endpoint);
+}
+
+static void _start_next(uint8_t device_address, uint8_t endpoint) {
+    usb_core_transfer_obj_t *next = MP_STATE_VM(usb_core_pending_transfers);
+    while (next != NULL) {
+        usb_core_transfer_obj_t *transfer = next;
+        next = transfer->next;
+        if (transfer->device_address != device_address || transfer->endpoint != endpoint) {
+            continue;
+        }
+        if (transfer->state == USB_CORE_TRANSFER_ACTIVE) {
+            return;
+        }
+        tuh_xfer_t xfer = {
+            .daddr = device_address,
+            .ep_addr = endpoint,
+            .buflen = transfer->len,
+            .buffer = transfer->data,
+            .complete_cb = _transfer_done_cb,
+            .user_data = (uintptr_t)transfer,
+        };
+        transfer->state = USB_CORE_TRANSFER_ACTIVE;
+        if (tuh_edpt_xfer(&xfer)) {
+            return;
+        }
+        transfer->result = XFER_RESULT_FAILED;
+        transfer->state = USB_CORE_TRANSFER_DONE;
+        _remove(transfer);
+    }
+}
+
+void usb_core_transfer_submit(usb_core_transfer_obj_t *self, uint8_t device_address, uint8_t endpoint,
+    mp_obj_t buffer, uint8_t *data, size_t len) {
+    self->next = NULL;
+    self->buffer = buffer;
+    self->data = data;
+    self->len = len;
+    self->actual_len = 0;
+    self->device_address = device_address;
+    self->endpoint = endpoint;
+    self->state = USB_CORE_TRANSFER_QUEUED;
+
+    usb_core_transfer_obj_t **link = &MP_STATE_VM(usb_core_pending_transfers);
+    while (*link != NULL) {
+        link = &(*link)->next;
+    }
+    *link = self;
+    _start_next(device_address, endpoint);
+}
+
+void common_hal_usb_core_transfer_cancel(usb_core_transfer_obj_t *self) {
+    if (self->state == USB_CORE_TRANSFER_DONE || self->state == USB_CORE_TRANSFER_CANCELLED) {
+        return;
+    }
+    bool active = self->state == USB_CORE_TRANSFER_ACTIVE;
+    self->state = USB_CORE_TRANSFER_CANCELLED;
+    _remove(self);
+    if (active) {
+        tuh_edpt_abort_xfer(self->device_address, self->endpoint);
+        _start_next(self->device_address, self->endpoint);
+    }
+}
+
+void usb_core_transfer_cancel_all(uint8_t device_address) {
+    usb_core_transfer_obj_t **link = &MP_STATE_VM(usb_core_pending_transfers);
+    while (*link != NULL) {
+        usb_core_transfer_obj_t *transfer = *link;
+        if (device_address != 0 && transfer->device_address != device_address) {
+            link = &transfer->next;
+            continue;
+        }
+        *link = transfer->next;
+        transfer->next = NULL;
+        if (transfer->state == USB_CORE_TRANSFER_ACTIVE) {
+            tuh_edpt_abort_xfer(transfer->device_address, transfer->endpoint);
+        }
+        transfer->state = USB_CORE_TRANSFER_CANCELLED;
+    }
+}
+
+bool common_hal_usb_core_transfer_get_done(usb_core_transfer_obj_t *self) {
+    return self->state == USB_CORE_TRANSFER_DONE || self->state == USB_CORE_TRANSFER_CANCELLED;
+}
+
+mp_int_t common_hal_usb_core_transfer_wait(usb_core_transfer_obj_t *self, mp_int_t timeout) {
+    uint32_t start_time = supervisor_ticks_ms32();
+    while ((timeout == 0 || supervisor_ticks_ms32() - start_time < (uint32_t)timeout) &&
+           !mp_hal_is_interrupted() &&
+           !common_hal_usb_core_transfer_get_done(self)) {
+        // The background tasks include TinyUSB which completes the transfer.
+        RUN_BACKGROUND_TASKS;
+    }
+    if (mp_hal_is_interrupted() || self->state == USB_CORE_TRANSFER_CANCELLED) {
+        return 0;
+    }
+    if (self->state != USB_CORE_TRANSFER_DONE) {
+        // Leave the transfer queued so it can be waited on again.
+        mp_raise_usb_core_USBTimeoutError();
+    }
+    if (self->result == XFER_RESULT_STALLED) {
+        mp_raise_usb_core_USBError(MP_ERROR_TEXT("Pipe error"));
+    }
+    if (self->result != XFER_RESULT_SUCCESS) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    return self->actual_len;
+}
@@ -0,0 +1,39 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+typedef enum {
+    USB_CORE_TRANSFER_QUEUED,
+    USB_CORE_TRANSFER_ACTIVE,
+    USB_CORE_TRANSFER_DONE,
+    USB_CORE_TRANSFER_CANCELLED,
+} usb_core_transfer_state_t;
+
+typedef struct _usb_core_transfer_obj_t {
+    mp_obj_base_t base;
+    // Next transfer in the pending list.
+    struct _usb_core_transfer_obj_t *next;
+    // Keeps the buffer alive while TinyUSB may still access it.
+    mp_obj_t buffer;
+    uint8_t *data;
+    size_t len;
+    size_t actual_len;
+    uint8_t device_address;
+    uint8_t endpoint;
+    // usb_core_transfer_state_t
+    volatile uint8_t state;
+    // xfer_result_t
+    uint8_t result;
+} usb_core_transfer_obj_t;
+
+// Queue the transfer behind any others on the same endpoint. The endpoint must already be open.
+void usb_core_transfer_submit(usb_core_transfer_obj_t *self, uint8_t device_address, uint8_t endpoint,
+    mp_obj_t buffer, uint8_t *data, size_t len);
+// Cancel every pending transfer for the device, or all of them when device_address is 0.
+void usb_core_transfer_cancel_all(uint8_t device_address);
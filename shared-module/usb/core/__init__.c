@@ -4,4 +4,10 @@
 //
 // SPDX-License-Identifier: MIT
 
-// Nothing implementation specific.
+#include "shared-module/usb/core/__init__.h"
+#include "shared-module/usb/core/Transfer.h"
+
+void usb_core_user_reset(void) {
+    // Transfers point into the VM heap, so stop them before it goes away.
+    usb_core_transfer_cancel_all(0);
+}
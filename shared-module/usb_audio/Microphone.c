@@ -0,0 +1,103 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb_audio/Microphone.h"
+#include "shared-bindings/usb_audio/__init__.h"
+
+#include "py/runtime.h"
+#include "tusb.h"
+
+usb_audio_microphone_obj_t usb_audio_microphone_obj = {
+    .base = {
+        .type = &usb_audio_microphone_type,
+    },
+    .sample = MP_OBJ_NULL,
+};
+
+void usb_audio_microphone_init(usb_audio_microphone_obj_t *self, uint32_t sample_rate) {
+    self->format.sample_rate = sample_rate;
+    self->format.bits_per_sample = 16;
+    self->format.samples_signed = true;
+    self->format.channel_count = 1;
+    self->sample = MP_OBJ_NULL;
+}
+
+static bool streaming(void) {
+    return usb_audio_microphone_streaming && tud_mounted();
+}
+
+void common_hal_usb_audio_microphone_play(usb_audio_microphone_obj_t *self, mp_obj_t sample, bool loop) {
+    audiosample_must_match(&self->format, sample);
+    common_hal_usb_audio_microphone_stop(self);
+    audiosample_reset_buffer(sample, false, 0);
+    self->loop = loop;
+    self->more_data = true;
+    self->pending_length = 0;
+    self->sample = sample;
+}
+
+void common_hal_usb_audio_microphone_stop(usb_audio_microphone_obj_t *self) {
+    self->sample = MP_OBJ_NULL;
+    self->pending = NULL;
+    self->pending_length = 0;
+}
+
+bool common_hal_usb_audio_microphone_get_playing(usb_audio_microphone_obj_t *self) {
+    return self->sample != MP_OBJ_NULL;
+}
+
+bool common_hal_usb_audio_microphone_get_streaming(usb_audio_microphone_obj_t *self) {
+    return streaming();
+}
+
+size_t common_hal_usb_audio_microphone_write(usb_audio_microphone_obj_t *self, const int16_t *samples, size_t count) {
+    if (!streaming()) {
+        return 0;
+    }
+    uint16_t length = MIN(count, UINT16_MAX / sizeof(int16_t)) * sizeof(int16_t);
+    return tud_audio_write(samples, length) / sizeof(int16_t);
+}
+
+// Moves as much of the playing sample into the endpoint's FIFO as fits. The host drains it at the
+// sample rate, which paces the sample.
+void usb_audio_microphone_task(usb_audio_microphone_obj_t *self) {
+    if (self->sample == MP_OBJ_NULL || !streaming()) {
+        return;
+    }
+    while (true) {
+        if (self->pending_length == 0) {
+            if (!self->more_data) {
+                if (!self->loop) {
+                    common_hal_usb_audio_microphone_stop(self);
+                    return;
+                }
+                audiosample_reset_buffer(self->sample, false, 0);
+                self->more_data = true;
+            }
+            uint8_t *buffer;
+            uint32_t buffer_length;
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &buffer, &buffer_length);
+            if (result == GET_BUFFER_ERROR) {
+                common_hal_usb_audio_microphone_stop(self);
+                return;
+            }
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+            self->pending = buffer;
+            self->pending_length = buffer_length;
+            if (buffer_length == 0) {
+                // Try again on the next task rather than spinning on an empty sample.
+                return;
+            }
+        }
+        uint16_t written = tud_audio_write(self->pending, MIN(self->pending_length, UINT16_MAX));
+        self->pending += written;
+        self->pending_length -= written;
+        if (self->pending_length > 0) {
+            // The FIFO is full.
+            return;
+        }
+    }
+}
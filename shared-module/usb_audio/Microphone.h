@@ -0,0 +1,28 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct {
+    mp_obj_base_t base;
+    // The only format the host is offered. Samples played must match it.
+    audiosample_base_t format;
+    mp_obj_t sample;
+    bool loop;
+    bool more_data;
+    // Part of the sample's last buffer not yet accepted by the endpoint.
+    const uint8_t *pending;
+    uint32_t pending_length;
+} usb_audio_microphone_obj_t;
+
+extern usb_audio_microphone_obj_t usb_audio_microphone_obj;
+
+void usb_audio_microphone_init(usb_audio_microphone_obj_t *self, uint32_t sample_rate);
+void usb_audio_microphone_task(usb_audio_microphone_obj_t *self);
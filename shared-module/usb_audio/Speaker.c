@@ -0,0 +1,143 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb_audio/Speaker.h"
+#include "shared-bindings/usb_audio/__init__.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "tusb.h"
+
+#define FRAME_BYTES (2 * sizeof(int16_t))
+
+usb_audio_speaker_obj_t usb_audio_speaker_obj = {
+    .base = {
+        .self = {
+            .type = &usb_audio_speaker_type,
+        },
+    },
+};
+
+void usb_audio_speaker_init(usb_audio_speaker_obj_t *self, uint32_t sample_rate) {
+    self->base.sample_rate = sample_rate;
+    self->base.bits_per_sample = 16;
+    self->base.samples_signed = true;
+    self->base.channel_count = 2;
+    self->base.single_buffer = false;
+    self->base.max_buffer_length = sample_rate / 1000 * USB_AUDIO_SPEAKER_BUFFER_MS * FRAME_BYTES;
+    self->mute = false;
+    usb_audio_speaker_set_volume(self, 0);
+    self->underruns = 0;
+    self->priming = true;
+}
+
+void usb_audio_speaker_set_volume(usb_audio_speaker_obj_t *self, int16_t volume) {
+    self->volume = volume;
+    if (volume >= 0) {
+        self->gain = 1 << 15;
+    } else {
+        mp_float_t db = (mp_float_t)volume / 256;
+        self->gain = (uint16_t)(MICROPY_FLOAT_C_FUN(pow)(10, db / 20) * (1 << 15));
+    }
+}
+
+static bool streaming(void) {
+    return usb_audio_speaker_streaming && tud_mounted();
+}
+
+static uint32_t queued_frames(void) {
+    return streaming() ? tud_audio_available() / FRAME_BYTES : 0;
+}
+
+bool common_hal_usb_audio_speaker_get_streaming(usb_audio_speaker_obj_t *self) {
+    return streaming();
+}
+
+bool common_hal_usb_audio_speaker_get_mute(usb_audio_speaker_obj_t *self) {
+    return self->mute;
+}
+
+mp_float_t common_hal_usb_audio_speaker_get_volume(usb_audio_speaker_obj_t *self) {
+    return (mp_float_t)self->volume / 256;
+}
+
+uint32_t common_hal_usb_audio_speaker_get_queued(usb_audio_speaker_obj_t *self) {
+    return queued_frames();
+}
+
+uint32_t common_hal_usb_audio_speaker_get_underruns(usb_audio_speaker_obj_t *self) {
+    return self->underruns;
+}
+
+void usb_audio_speaker_reset_buffer(usb_audio_speaker_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    // Start from the newest data so latency doesn't build up while nothing was playing.
+    tud_audio_clear_ep_out_ff();
+    self->priming = true;
+}
+
+audioio_get_buffer_result_t usb_audio_speaker_get_buffer(usb_audio_speaker_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (single_channel_output && channel == 1) {
+        // The right channel reads the buffer just filled for the left one.
+        *buffer = (uint8_t *)(self->buffer[self->buffer_index] + 1);
+        *buffer_length = self->base.max_buffer_length;
+        return GET_BUFFER_MORE_DATA;
+    }
+
+    self->buffer_index = !self->buffer_index;
+    int16_t *out = self->buffer[self->buffer_index];
+    uint32_t frames = self->base.max_buffer_length / FRAME_BYTES;
+    uint32_t frames_per_ms = self->base.sample_rate / 1000;
+    uint32_t target = frames + frames_per_ms * USB_AUDIO_SPEAKER_LATENCY_MS;
+    uint32_t available = queued_frames();
+
+    if (!self->priming && available < frames) {
+        if (streaming()) {
+            self->underruns++;
+        }
+        self->priming = true;
+    }
+    if (self->priming && available >= target) {
+        self->priming = false;
+    }
+
+    if (self->priming || self->mute) {
+        memset(out, 0, self->base.max_buffer_length);
+    } else {
+        // The host's clock is not ours. Keep the queue near its target by dropping or repeating
+        // one frame per buffer once it has drifted by more than a millisecond.
+        uint32_t read_frames = frames;
+        if (available > target + frames_per_ms) {
+            read_frames = frames + 1;
+        } else if (available + frames_per_ms < target) {
+            read_frames = frames - 1;
+        }
+        tud_audio_read(out, read_frames * FRAME_BYTES);
+        if (read_frames < frames) {
+            out[2 * frames - 2] = out[2 * frames - 4];
+            out[2 * frames - 1] = out[2 * frames - 3];
+        }
+        if (self->gain < (1 << 15)) {
+            for (size_t i = 0; i < 2 * frames; i++) {
+                out[i] = (out[i] * self->gain) >> 15;
+            }
+        }
+    }
+
+    *buffer = (uint8_t *)out;
+    *buffer_length = self->base.max_buffer_length;
+    return GET_BUFFER_MORE_DATA;
+}
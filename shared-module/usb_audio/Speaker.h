@@ -0,0 +1,44 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+#include "tusb.h"
+
+// Each buffer handed to the audio output holds this much of the stream.
+#define USB_AUDIO_SPEAKER_BUFFER_MS (2)
+// Data kept queued beyond one buffer to absorb USB scheduling jitter.
+#define USB_AUDIO_SPEAKER_LATENCY_MS (4)
+
+typedef struct {
+    audiosample_base_t base;
+    // One spare frame so a frame can be dropped when the host runs fast.
+    int16_t buffer[2][(USB_AUDIO_MAX_SAMPLE_RATE / 1000 * USB_AUDIO_SPEAKER_BUFFER_MS + 1) * 2];
+    uint8_t buffer_index;
+    bool priming; // Output silence until the queue reaches its target.
+    bool mute;
+    int16_t volume; // Set by the host in 1/256 dB.
+    uint16_t gain; // volume in Q15, saturated at unity.
+    uint32_t underruns;
+} usb_audio_speaker_obj_t;
+
+extern usb_audio_speaker_obj_t usb_audio_speaker_obj;
+
+void usb_audio_speaker_init(usb_audio_speaker_obj_t *self, uint32_t sample_rate);
+void usb_audio_speaker_set_volume(usb_audio_speaker_obj_t *self, int16_t volume);
+
+// These are not available from Python because it may be called in an interrupt.
+void usb_audio_speaker_reset_buffer(usb_audio_speaker_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t usb_audio_speaker_get_buffer(usb_audio_speaker_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
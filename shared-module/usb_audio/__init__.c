@@ -0,0 +1,215 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-bindings/usb_audio/__init__.h"
+
+#include "py/gc.h"
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "shared-bindings/usb_audio/Microphone.h"
+#include "shared-bindings/usb_audio/Speaker.h"
+#include "shared-module/usb_audio/uac2_usb_descriptors.h"
+#include "supervisor/usb.h"
+#include "tusb.h"
+
+static bool usb_audio_is_enabled;
+uint32_t usb_audio_sample_rate;
+volatile bool usb_audio_speaker_streaming;
+volatile bool usb_audio_microphone_streaming;
+
+// Interface numbers of the two streaming interfaces, used to tell them apart in SET_INTERFACE.
+static uint8_t speaker_interface;
+static uint8_t microphone_interface;
+
+void usb_audio_set_defaults(void) {
+    usb_audio_is_enabled = false;
+}
+
+bool usb_audio_enabled(void) {
+    return usb_audio_is_enabled;
+}
+
+size_t usb_audio_descriptor_length(void) {
+    return CFG_TUD_AUDIO_FUNC_1_DESC_LEN;
+}
+
+size_t usb_audio_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
+    usb_add_interface_string(*current_interface_string, USB_INTERFACE_NAME " Audio");
+
+    uint8_t ep_in = 0x80 | descriptor_counts->current_endpoint;
+    descriptor_counts->num_in_endpoints++;
+
+    // Some TinyUSB devices have issues with bi-directional endpoints
+    #ifdef TUD_ENDPOINT_ONE_DIRECTION_ONLY
+    descriptor_counts->current_endpoint++;
+    #endif
+
+    uint8_t ep_out = descriptor_counts->current_endpoint;
+    descriptor_counts->num_out_endpoints++;
+    descriptor_counts->current_endpoint++;
+
+    uint8_t control_interface = descriptor_counts->current_interface;
+    speaker_interface = control_interface + 1;
+    microphone_interface = control_interface + 2;
+    descriptor_counts->current_interface += 3;
+
+    const uint8_t usb_audio_descriptor[] = {
+        TUD_AUDIO_HEADSET_DESCRIPTOR(control_interface, *current_interface_string, ep_out, ep_in)
+    };
+    (*current_interface_string)++;
+
+    memcpy(descriptor_buf, usb_audio_descriptor, sizeof(usb_audio_descriptor));
+    return sizeof(usb_audio_descriptor);
+}
+
+void usb_audio_setup(void) {
+    mp_obj_t speaker = mp_const_none;
+    mp_obj_t microphone = mp_const_none;
+    if (usb_audio_is_enabled) {
+        speaker = MP_OBJ_FROM_PTR(&usb_audio_speaker_obj);
+        microphone = MP_OBJ_FROM_PTR(&usb_audio_microphone_obj);
+    }
+    mp_map_lookup(&usb_audio_module_globals.map, MP_ROM_QSTR(MP_QSTR_speaker), MP_MAP_LOOKUP)->value = speaker;
+    mp_map_lookup(&usb_audio_module_globals.map, MP_ROM_QSTR(MP_QSTR_microphone), MP_MAP_LOOKUP)->value = microphone;
+}
+
+bool common_hal_usb_audio_enable(uint32_t sample_rate) {
+    // We can't change the descriptors once we're connected.
+    if (tud_connected()) {
+        return false;
+    }
+    usb_audio_sample_rate = sample_rate;
+    usb_audio_speaker_init(&usb_audio_speaker_obj, sample_rate);
+    usb_audio_microphone_init(&usb_audio_microphone_obj, sample_rate);
+    usb_audio_is_enabled = true;
+    return true;
+}
+
+bool common_hal_usb_audio_disable(void) {
+    if (tud_connected()) {
+        return false;
+    }
+    usb_audio_is_enabled = false;
+    return true;
+}
+
+void usb_audio_task(void) {
+    if (usb_audio_is_enabled) {
+        usb_audio_microphone_task(&usb_audio_microphone_obj);
+    }
+}
+
+void usb_audio_user_reset(void) {
+    // The microphone's sample is on the heap, which is about to go away.
+    common_hal_usb_audio_microphone_stop(&usb_audio_microphone_obj);
+}
+
+void usb_audio_gc_collect(void) {
+    gc_collect_ptr(usb_audio_microphone_obj.sample);
+}
+
+bool tud_audio_set_itf_cb(uint8_t rhport, tusb_control_request_t const *p_request) {
+    (void)rhport;
+    uint8_t itf = tu_u16_low(tu_le16toh(p_request->wIndex));
+    uint8_t alt = tu_u16_low(tu_le16toh(p_request->wValue));
+    if (itf == speaker_interface) {
+        usb_audio_speaker_streaming = alt != 0;
+    } else if (itf == microphone_interface) {
+        usb_audio_microphone_streaming = alt != 0;
+    }
+    return true;
+}
+
+bool tud_audio_set_itf_close_EP_cb(uint8_t rhport, tusb_control_request_t const *p_request) {
+    (void)rhport;
+    uint8_t itf = tu_u16_low(tu_le16toh(p_request->wIndex));
+    if (itf == speaker_interface) {
+        usb_audio_speaker_streaming = false;
+    } else if (itf == microphone_interface) {
+        usb_audio_microphone_streaming = false;
+    }
+    return true;
+}
+
+static bool clock_get_request(uint8_t rhport, audio_control_request_t const *request) {
+    if (request->bControlSelector == AUDIO_CS_CTRL_SAM_FREQ) {
+        if (request->bRequest == AUDIO_CS_REQ_CUR) {
+            audio_control_cur_4_t current = { .bCur = (int32_t)tu_htole32(usb_audio_sample_rate) };
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &current, sizeof(current));
+        }
+        if (request->bRequest == AUDIO_CS_REQ_RANGE) {
+            // The clock is fixed at the rate chosen in boot.py.
+            audio_control_range_4_n_t(1) range = {
+                .wNumSubRanges = tu_htole16(1),
+                .subrange[0] = {
+                    .bMin = (int32_t)tu_htole32(usb_audio_sample_rate),
+                    .bMax = (int32_t)tu_htole32(usb_audio_sample_rate),
+                    .bRes = 0,
+                },
+            };
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &range, sizeof(range));
+        }
+    } else if (request->bControlSelector == AUDIO_CS_CTRL_CLK_VALID && request->bRequest == AUDIO_CS_REQ_CUR) {
+        audio_control_cur_1_t valid = { .bCur = 1 };
+        return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &valid, sizeof(valid));
+    }
+    return false;
+}
+
+static bool feature_unit_get_request(uint8_t rhport, audio_control_request_t const *request) {
+    usb_audio_speaker_obj_t *speaker = &usb_audio_speaker_obj;
+    if (request->bControlSelector == AUDIO_FU_CTRL_MUTE && request->bRequest == AUDIO_CS_REQ_CUR) {
+        audio_control_cur_1_t mute = { .bCur = speaker->mute };
+        return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &mute, sizeof(mute));
+    }
+    if (request->bControlSelector == AUDIO_FU_CTRL_VOLUME) {
+        if (request->bRequest == AUDIO_CS_REQ_CUR) {
+            audio_control_cur_2_t volume = { .bCur = tu_htole16(speaker->volume) };
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &volume, sizeof(volume));
+        }
+        if (request->bRequest == AUDIO_CS_REQ_RANGE) {
+            // -60 dB to 0 dB in 1 dB steps.
+            audio_control_range_2_n_t(1) range = {
+                .wNumSubRanges = tu_htole16(1),
+                .subrange[0] = {
+                    .bMin = tu_htole16(-60 * 256),
+                    .bMax = tu_htole16(0),
+                    .bRes = tu_htole16(256),
+                },
+            };
+            return tud_audio_buffer_and_schedule_control_xfer(rhport, (tusb_control_request_t const *)request, &range, sizeof(range));
+        }
+    }
+    return false;
+}
+
+bool tud_audio_get_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request) {
+    audio_control_request_t const *request = (audio_control_request_t const *)p_request;
+    if (request->bEntityID == UAC2_ENTITY_CLOCK) {
+        return clock_get_request(rhport, request);
+    }
+    if (request->bEntityID == UAC2_ENTITY_SPK_FEATURE_UNIT) {
+        return feature_unit_get_request(rhport, request);
+    }
+    return false;
+}
+
+bool tud_audio_set_req_entity_cb(uint8_t rhport, tusb_control_request_t const *p_request, uint8_t *buf) {
+    (void)rhport;
+    audio_control_request_t const *request = (audio_control_request_t const *)p_request;
+    if (request->bEntityID != UAC2_ENTITY_SPK_FEATURE_UNIT || request->bRequest != AUDIO_CS_REQ_CUR) {
+        return false;
+    }
+    if (request->bControlSelector == AUDIO_FU_CTRL_MUTE) {
+        usb_audio_speaker_obj.mute = ((audio_control_cur_1_t const *)buf)->bCur != 0;
+        return true;
+    }
+    if (request->bControlSelector == AUDIO_FU_CTRL_VOLUME) {
+        usb_audio_speaker_set_volume(&usb_audio_speaker_obj, tu_le16toh(((audio_control_cur_2_t const *)buf)->bCur));
+        return true;
+    }
+    return false;
+}
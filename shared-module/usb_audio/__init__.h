@@ -0,0 +1,27 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "supervisor/usb.h"
+
+bool usb_audio_enabled(void);
+void usb_audio_set_defaults(void);
+void usb_audio_setup(void);
+size_t usb_audio_descriptor_length(void);
+size_t usb_audio_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string);
+void usb_audio_task(void);
+void usb_audio_user_reset(void);
+void usb_audio_gc_collect(void);
+
+extern uint32_t usb_audio_sample_rate;
+// Set while the host has selected the streaming alternate of each interface.
+extern volatile bool usb_audio_speaker_streaming;
+extern volatile bool usb_audio_microphone_streaming;
@@ -54,6 +54,18 @@ size_t common_hal_usb_cdc_serial_read(usb_cdc_serial_obj_t *self, uint8_t *data,
     return total_num_read;
 }
 
+static void _flush(void *self_in) {
+    usb_cdc_serial_obj_t *self = self_in;
+    tud_cdc_n_write_flush(self->idx);
+}
+
+// Flushing sends whatever is in the FIFO as a short packet right away. Deferring it to the next
+// background run lets consecutive writes fill whole packets first. Full packets are sent by
+// tud_cdc_n_write() itself.
+static void _schedule_flush(usb_cdc_serial_obj_t *self) {
+    background_callback_add(&self->flush_callback, _flush, self);
+}
+
 size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
     const bool wait_forever = self->write_timeout < 0.0f;
     const bool wait_for_timeout = self->write_timeout > 0.0f;
@@ -61,7 +73,7 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
     // Write as many bytes as possible immediately.
     // The number of bytes written at once will not be larger than what can fit in the TinyUSB FIFO.
     uint32_t total_num_written = tud_cdc_n_write(self->idx, data, len);
-    tud_cdc_n_write_flush(self->idx);
+    _schedule_flush(self);
 
     if (wait_forever || wait_for_timeout) {
         // Continue writing the rest of the buffer.
@@ -89,7 +101,7 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
 
             // Try to write another batch of bytes.
             num_written = tud_cdc_n_write(self->idx, data, len);
-            tud_cdc_n_write_flush(self->idx);
+            _schedule_flush(self);
             total_num_written += num_written;
         }
     }
@@ -7,10 +7,12 @@
 #pragma once
 
 #include "py/obj.h"
+#include "supervisor/background_callback.h"
 
 typedef struct {
     mp_obj_base_t base;
     mp_float_t timeout;       // if negative, wait forever.
     mp_float_t write_timeout; // if negative, wait forever.
     uint8_t idx;              // which CDC device?
+    background_callback_t flush_callback;
 } usb_cdc_serial_obj_t;
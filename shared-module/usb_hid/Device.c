@@ -8,13 +8,22 @@
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared-bindings/usb_hid/Device.h"
 #include "shared-module/usb_hid/__init__.h"
 #include "shared-module/usb_hid/Device.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/tick.h"
 #include "tusb.h"
 
+// Bytes of reports that queue_report() can hold. Each report also takes two bytes for its id and length.
+#define REPORT_QUEUE_SIZE (256)
+
+// Shared by all devices because they all use the same IN endpoint.
+// The storage is outside the VM heap because reports go out between VMs too.
+static ringbuf_t report_queue;
+
 static const uint8_t keyboard_report_descriptor[] = {
     0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
     0x09, 0x06,        // Usage (Keyboard)
@@ -224,6 +233,46 @@ void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *
     }
 }
 
+static void send_next_queued_report(void) {
+    if (ringbuf_num_filled(&report_queue) == 0 || !tud_hid_ready()) {
+        return;
+    }
+    uint8_t report_id = ringbuf_get(&report_queue);
+    uint8_t len = ringbuf_get(&report_queue);
+    uint8_t report[len];
+    ringbuf_get_n(&report_queue, report, len);
+    tud_hid_report(report_id, report, len);
+}
+
+bool common_hal_usb_hid_device_queue_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+    // report_id has already been validated for this device.
+    size_t id_idx = get_report_id_idx(self, report_id);
+
+    mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
+
+    if (tud_suspended()) {
+        // Discard the report, as send_report() does.
+        tud_remote_wakeup();
+        return false;
+    }
+
+    if (report_queue.buf == NULL) {
+        uint8_t *buf = port_malloc(REPORT_QUEUE_SIZE, false);
+        if (buf == NULL) {
+            m_malloc_fail(REPORT_QUEUE_SIZE);
+        }
+        ringbuf_init(&report_queue, buf, REPORT_QUEUE_SIZE);
+    }
+    if (ringbuf_num_empty(&report_queue) < len + 2u) {
+        return false;
+    }
+    ringbuf_put(&report_queue, report_id);
+    ringbuf_put(&report_queue, len);
+    ringbuf_put_n(&report_queue, report, len);
+    send_next_queued_report();
+    return true;
+}
+
 mp_obj_t common_hal_usb_hid_device_get_last_received_report(usb_hid_device_obj_t *self, uint8_t report_id) {
     // report_id has already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
@@ -251,6 +300,14 @@ void usb_hid_device_create_report_buffers(usb_hid_device_obj_t *self) {
     memset(self->out_report_buffers_updated, 0, sizeof(self->out_report_buffers_updated));
 }
 
+// Callback invoked when an IN report has been sent. Keep the queue moving.
+void tud_hid_report_complete_cb(uint8_t instance, uint8_t const *report, uint16_t len) {
+    (void)instance;
+    (void)report;
+    (void)len;
+    send_next_queued_report();
+}
+
 
 // Callback invoked when we receive Get_Report request through control endpoint
 uint16_t tud_hid_get_report_cb(uint8_t itf, uint8_t report_id, hid_report_type_t report_type, uint8_t *buffer, uint16_t reqlen) {
@@ -46,6 +46,7 @@ static const uint8_t usb_hid_descriptor_template[] = {
     0x03,        // 21 bmAttributes (Interrupt)
     0x40, 0x00,  // 22,23  wMaxPacketSize 64
     0x08,        // 24 bInterval 8 (unit depends on device speed)
+#define HID_IN_INTERVAL_INDEX (24)
 
     0x07,        // 25 bLength
     0x05,        // 26 bDescriptorType (Endpoint)
@@ -54,8 +55,11 @@ static const uint8_t usb_hid_descriptor_template[] = {
     0x03,        // 28 bmAttributes (Interrupt)
     0x40, 0x00,  // 29,30 wMaxPacketSize 64
     0x08,        // 31 bInterval 8 (unit depends on device speed)
+#define HID_OUT_INTERVAL_INDEX (31)
 };
 
+#define HID_DEFAULT_INTERVAL (8)
+
 #define MAX_HID_DEVICES 8
 
 static uint8_t *hid_report_descriptor = NULL;
@@ -68,6 +72,9 @@ static mp_int_t num_hid_devices;
 // The value is remembered here from boot.py to code.py.
 static uint8_t hid_boot_device;
 
+// Requested polling interval, or 0 for HID_DEFAULT_INTERVAL. Also remembered from boot.py to code.py.
+static uint32_t hid_poll_interval_us;
+
 // Whether a boot device was requested by a SET_PROTOCOL request from the host.
 static bool hid_boot_device_requested;
 
@@ -135,7 +142,24 @@ void usb_hid_set_defaults(void) {
     hid_boot_device = 0;
     hid_boot_device_requested = false;
     common_hal_usb_hid_enable(
-        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0);
+        CIRCUITPY_USB_HID_ENABLED_DEFAULT ? &default_hid_devices_tuple : mp_const_empty_tuple, 0, 0);
+}
+
+// bInterval counts 1 ms frames at full speed. At high speed the interval is 2^(bInterval-1)
+// 125 us microframes.
+static uint8_t hid_interval(void) {
+    if (hid_poll_interval_us == 0) {
+        return HID_DEFAULT_INTERVAL;
+    }
+    #if TUD_OPT_HIGH_SPEED
+    uint8_t interval = 1;
+    while (interval < 16 && (125u << interval) <= hid_poll_interval_us) {
+        interval++;
+    }
+    return interval;
+    #else
+    return MAX(1, MIN(255, hid_poll_interval_us / 1000));
+    #endif
 }
 
 // This is the interface descriptor, not the report descriptor.
@@ -169,6 +193,9 @@ size_t usb_hid_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *desc
     descriptor_buf[HID_DESCRIPTOR_LENGTH_INDEX] = report_descriptor_length & 0xFF;
     descriptor_buf[HID_DESCRIPTOR_LENGTH_INDEX + 1] = (report_descriptor_length >> 8);
 
+    descriptor_buf[HID_IN_INTERVAL_INDEX] = hid_interval();
+    descriptor_buf[HID_OUT_INTERVAL_INDEX] = hid_interval();
+
     descriptor_buf[HID_IN_ENDPOINT_INDEX] =
         0x80 | (USB_HID_EP_NUM_IN ? USB_HID_EP_NUM_IN : descriptor_counts->current_endpoint);
     descriptor_counts->num_in_endpoints++;
@@ -200,10 +227,10 @@ static void usb_hid_set_devices_from_hid_devices(void) {
 }
 
 bool common_hal_usb_hid_disable(void) {
-    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0);
+    return common_hal_usb_hid_enable(mp_const_empty_tuple, 0, 0);
 }
 
-bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
+bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device, uint32_t poll_interval_us) {
     // We can't change the devices once we're connected.
     if (tud_connected()) {
         return false;
@@ -215,6 +242,7 @@ bool common_hal_usb_hid_enable(const mp_obj_t devices, uint8_t boot_device) {
     num_hid_devices = num_devices;
 
     hid_boot_device = boot_device;
+    hid_poll_interval_us = poll_interval_us;
 
     // Remember the devices in static storage so they live across VMs.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
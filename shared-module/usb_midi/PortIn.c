@@ -4,11 +4,29 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include <string.h>
+
+#include "py/mpstate.h"
+#include "shared-bindings/supervisor/__init__.h"
 #include "shared-bindings/usb_midi/PortIn.h"
 #include "shared-module/usb_midi/PortIn.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
+#if CIRCUITPY_SYNTHIO
+#include "shared-bindings/audiocore/__init__.h"
+#include "shared-bindings/synthio/Synthesizer.h"
+#include "shared-module/synthio/__init__.h"
+#endif
+
+// Code Index Numbers of the USB-MIDI event packets that carry channel messages.
+#define CIN_NOTE_OFF (0x8)
+#define CIN_NOTE_ON (0x9)
+#define CIN_CONTROL_CHANGE (0xB)
+#define CIN_SINGLE_BYTE (0xF)
+
+#define CC_ALL_NOTES_OFF (123)
+
 size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self, uint8_t *data, size_t len, int *errcode) {
     return tud_midi_stream_read(data, len);
 }
@@ -16,3 +34,68 @@ size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self, uint8_t *dat
 uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self) {
     return tud_midi_available();
 }
+
+size_t common_hal_usb_midi_portin_read_events_into(usb_midi_portin_obj_t *self, uint8_t *buf, size_t max_events) {
+    uint32_t timestamp = MP_OBJ_SMALL_INT_VALUE(supervisor_ticks_ms());
+    size_t count = 0;
+    uint8_t packet[4];
+    while (count < max_events && tud_midi_packet_read(packet)) {
+        uint8_t cin = packet[0] & 0xf;
+        // Skip SysEx and the system common messages; read() still sees those.
+        if (cin < CIN_NOTE_OFF && cin != CIN_SINGLE_BYTE) {
+            continue;
+        }
+        usb_midi_event_record_t record = {
+            .channel = packet[1] < 0xf0 ? packet[1] & 0xf : 0,
+            .status = packet[1] < 0xf0 ? packet[1] & 0xf0 : packet[1],
+            .data1 = packet[2],
+            .data2 = packet[3],
+            .timestamp = timestamp,
+        };
+        // buf may not be aligned.
+        memcpy(buf + count * sizeof(record), &record, sizeof(record));
+        count++;
+    }
+    return count;
+}
+
+#if CIRCUITPY_SYNTHIO
+void common_hal_usb_midi_portin_route_to(usb_midi_portin_obj_t *self, mp_obj_t synthesizer) {
+    MP_STATE_VM(usb_midi_synthesizer) = synthesizer;
+    // Take anything already waiting.
+    tud_midi_rx_cb(0);
+}
+
+// Invoked by TinyUSB when packets arrive. Without a route they stay queued for read().
+void tud_midi_rx_cb(uint8_t itf) {
+    (void)itf;
+    mp_obj_t synthesizer = MP_STATE_VM(usb_midi_synthesizer);
+    if (synthesizer == MP_OBJ_NULL || synthesizer == mp_const_none) {
+        return;
+    }
+    synthio_synthesizer_obj_t *synth = MP_OBJ_TO_PTR(synthesizer);
+    if (audiosample_deinited(&synth->synth.base)) {
+        return;
+    }
+    uint8_t packet[4];
+    while (tud_midi_packet_read(packet)) {
+        uint8_t cin = packet[0] & 0xf;
+        mp_obj_t note = MP_OBJ_NEW_SMALL_INT(packet[2] & 0x7f);
+        if (cin == CIN_NOTE_ON && packet[3] != 0) {
+            synthio_span_change_note(&synth->synth, SYNTHIO_SILENCE, note);
+        } else if (cin == CIN_NOTE_OFF || cin == CIN_NOTE_ON) {
+            synthio_span_change_note(&synth->synth, note, SYNTHIO_SILENCE);
+        } else if (cin == CIN_CONTROL_CHANGE && packet[2] == CC_ALL_NOTES_OFF) {
+            common_hal_synthio_synthesizer_release_all(synth);
+        }
+    }
+}
+
+MP_REGISTER_ROOT_POINTER(mp_obj_t usb_midi_synthesizer);
+#endif
+
+void usb_midi_user_reset(void) {
+    #if CIRCUITPY_SYNTHIO
+    MP_STATE_VM(usb_midi_synthesizer) = MP_OBJ_NULL;
+    #endif
+}
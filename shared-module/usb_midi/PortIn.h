@@ -14,3 +14,13 @@
 typedef struct  {
     mp_obj_base_t base;
 } usb_midi_portin_obj_t;
+
+// Layout of each event copied out by common_hal_usb_midi_portin_read_events_into().
+typedef struct {
+    uint8_t channel;
+    // Without the channel for channel messages.
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+    uint32_t timestamp;
+} usb_midi_event_record_t;
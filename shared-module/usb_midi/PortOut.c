@@ -4,13 +4,88 @@
 //
 // SPDX-License-Identifier: MIT
 
+#include "py/mphal.h"
+#include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb_midi/PortOut.h"
 #include "shared-module/usb_midi/PortOut.h"
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
+// Each USB-MIDI packet needs its own status byte, so running status is expanded here. The port
+// objects are const, so the parser state lives here; there is only one MIDI interface.
+static uint8_t running_status;
+static uint8_t data_bytes_left;
+static bool in_sysex;
+
+static uint8_t data_bytes_for_status(uint8_t status) {
+    if (status < 0xf0) {
+        // Program change and channel pressure have a single data byte.
+        return (status & 0xe0) == 0xc0 ? 1 : 2;
+    }
+    switch (status) {
+        case 0xf1:
+        case 0xf3:
+            return 1;
+        case 0xf2:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+// Wait until TinyUSB has taken all of data so long SysEx messages go out in one call.
+static bool write_all(const uint8_t *data, size_t len) {
+    while (len > 0) {
+        uint32_t num_written = tud_midi_stream_write(0, data, len);
+        data += num_written;
+        len -= num_written;
+        if (len == 0) {
+            break;
+        }
+        RUN_BACKGROUND_TASKS;
+        if (!tud_midi_mounted() || mp_hal_is_interrupted()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
-    return tud_midi_stream_write(0, data, len);
+    // Start of the bytes that can be passed along unchanged.
+    size_t start = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        if (b >= 0xf8) {
+            // Real-time messages may appear anywhere and don't change any state.
+            continue;
+        }
+        if (b >= 0x80) {
+            in_sysex = b == 0xf0;
+            // System common messages cancel running status.
+            running_status = b < 0xf0 ? b : 0;
+            data_bytes_left = data_bytes_for_status(b);
+            continue;
+        }
+        if (in_sysex) {
+            continue;
+        }
+        if (data_bytes_left > 0) {
+            data_bytes_left--;
+            continue;
+        }
+        if (running_status != 0) {
+            if (!write_all(data + start, i - start) || !write_all(&running_status, 1)) {
+                return 0;
+            }
+            start = i;
+            data_bytes_left = data_bytes_for_status(running_status) - 1;
+        }
+    }
+    if (!write_all(data + start, len - start)) {
+        return 0;
+    }
+    return len;
 }
 
 bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self) {
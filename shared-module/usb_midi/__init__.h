@@ -11,6 +11,7 @@
 bool usb_midi_enabled(void);
 void usb_midi_set_defaults(void);
 void usb_midi_setup_ports(void);
+void usb_midi_user_reset(void);
 
 size_t usb_midi_descriptor_length(void);
 size_t usb_midi_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string);
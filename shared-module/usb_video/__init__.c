@@ -16,10 +16,15 @@
 #include "supervisor/shared/tick.h"
 #include "device/usbd.h"
 
-static bool do_convert = true;
+// Rows of usb_video_framebuffer_rgb565 that changed since the last conversion.
+static uint16_t convert_first_row = 0;
+static uint16_t convert_end_row = UINT16_MAX;
 static unsigned frame_num = 0;
 static unsigned tx_busy = 0;
 static unsigned interval_ms = 1000 / DEFAULT_FRAME_RATE;
+// While nothing changes a frame is still sent this often so hosts don't treat the stream as stalled.
+#define IDLE_FRAME_INTERVAL_MS (1000)
+static unsigned last_frame_ms = 0;
 
 // TODO must dynamically allocate this, otherwise everyone pays for it
 static uint8_t *frame_buffer_yuyv;
@@ -87,16 +92,26 @@ size_t usb_video_descriptor_length(void) {
     #endif
 }
 
+static bool framebuffer_changed(void) {
+    return convert_first_row < MIN(convert_end_row, usb_video_frame_height);
+}
+
 static void convert_framebuffer_maybe(void) {
-    if (!do_convert) {
+    uint16_t end_row = MIN(convert_end_row, usb_video_frame_height);
+    if (convert_first_row >= end_row) {
         return; // new data not ready yet
     }
-    do_convert = false; // assumes this happens via background, not interrupt
+    // assumes this happens via background, not interrupt
+    size_t first_pixel = convert_first_row * usb_video_frame_width;
+    size_t pixel_count = (end_row - convert_first_row) * usb_video_frame_width;
+    convert_first_row = UINT16_MAX;
+    convert_end_row = 0;
 
-    uint8_t *dest = frame_buffer_yuyv;
-    uint16_t *src = usb_video_framebuffer_rgb565;
+    // frame_width is even so pixel pairs never straddle rows.
+    uint8_t *dest = frame_buffer_yuyv + first_pixel * 2;
+    uint16_t *src = usb_video_framebuffer_rgb565 + first_pixel;
 
-    for (int i = 0; i < usb_video_frame_width * usb_video_frame_height / 2; i++) {
+    for (size_t i = 0; i < pixel_count / 2; i++) {
         uint16_t p1 = IMAGE_GET_RGB565_PIXEL_FAST(src, 0);
         uint16_t p2 = IMAGE_GET_RGB565_PIXEL_FAST(src, 1);
         src += 2;
@@ -117,7 +132,12 @@ static void convert_framebuffer_maybe(void) {
 }
 
 void shared_module_usb_video_swapbuffers(void) {
-    do_convert = true;
+    shared_module_usb_video_swapbuffers_rows(0, usb_video_frame_height);
+}
+
+void shared_module_usb_video_swapbuffers_rows(uint16_t first_row, uint16_t end_row) {
+    convert_first_row = MIN(convert_first_row, first_row);
+    convert_end_row = MAX(convert_end_row, end_row);
 }
 
 size_t usb_video_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
@@ -157,6 +177,7 @@ static void usb_video_cb_fun(void *unused) {
     if (!already_sent) {
         already_sent = 1;
         start_ms = supervisor_ticks_ms32();
+        last_frame_ms = start_ms;
         convert_framebuffer_maybe();
         bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
         (void)result;
@@ -173,6 +194,13 @@ static void usb_video_cb_fun(void *unused) {
     }
     start_ms += interval_ms;
 
+    if (!framebuffer_changed() && cur - last_frame_ms < IDLE_FRAME_INTERVAL_MS) {
+        // Skip frames identical to the last one so they don't use USB bandwidth.
+        background_callback_add(&usb_video_cb, usb_video_cb_fun, NULL); // re-queue
+        return;
+    }
+    last_frame_ms = cur;
+
     convert_framebuffer_maybe();
     bool result = tud_video_n_frame_xfer(0, 0, (void *)frame_buffer_yuyv, usb_video_frame_width * usb_video_frame_height * 16 / 8);
     (void)result;
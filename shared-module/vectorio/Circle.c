@@ -44,6 +44,32 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+bool common_hal_vectorio_circle_get_row_spans(void *obj, int16_t y, vectorio_span_t *spans, uint8_t *span_count, uint32_t *pixel) {
+    vectorio_circle_t *self = obj;
+    int16_t radius = self->radius;
+    y = abs(y);
+    *pixel = self->color_index;
+    *span_count = 0;
+    if (y > radius) {
+        return true;
+    }
+    // Same coverage as get_pixel: the widest x with x * x + y * y <= radius * radius.
+    uint32_t remaining = (int32_t)radius * radius - (int32_t)y * y;
+    uint32_t half_width = 0;
+    for (uint32_t bit = 1u << 30; bit != 0; bit >>= 2) {
+        if (remaining >= half_width + bit) {
+            remaining -= half_width + bit;
+            half_width = (half_width >> 1) + bit;
+        } else {
+            half_width >>= 1;
+        }
+    }
+    spans[0].x1 = -(int16_t)half_width;
+    spans[0].x2 = (int16_t)half_width + 1;
+    *span_count = 1;
+    return true;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
@@ -185,6 +185,85 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Rounds up, for positive denominators.
+static int32_t ceil_div(int64_t numerator, int32_t denominator) {
+    if (numerator >= 0) {
+        return (numerator + denominator - 1) / denominator;
+    }
+    return -((-numerator) / denominator);
+}
+
+bool common_hal_vectorio_polygon_get_row_spans(void *obj, int16_t y, vectorio_span_t *spans, uint8_t *span_count, uint32_t *pixel) {
+    vectorio_polygon_t *self = obj;
+    *pixel = self->color_index;
+    *span_count = 0;
+
+    // An edge that get_pixel counts for row y adds its winding to every x left
+    // of where it crosses the row. Record the first x it no longer applies to.
+    int32_t crossing_x[2 * VECTORIO_MAX_ROW_SPANS];
+    int8_t crossing_wind[2 * VECTORIO_MAX_ROW_SPANS];
+    uint8_t crossings = 0;
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int32_t x1 = self->points_list[i];
+        int32_t y1 = self->points_list[i + 1];
+        int32_t x2 = self->points_list[(i + 2) % self->len];
+        int32_t y2 = self->points_list[(i + 3) % self->len];
+        int8_t wind;
+        if (y1 <= y && y2 > y) {
+            wind = 1;
+        } else if (y1 > y && y2 <= y) {
+            wind = -1;
+        } else {
+            continue;
+        }
+        if (crossings == MP_ARRAY_SIZE(crossing_x)) {
+            return false;
+        }
+        int64_t numerator = (int64_t)(y - y1) * (x2 - x1);
+        int32_t denominator = y2 - y1;
+        if (denominator < 0) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        int32_t x = x1 + ceil_div(numerator, denominator);
+
+        // Insertion sort by x.
+        uint8_t k = crossings++;
+        while (k > 0 && crossing_x[k - 1] > x) {
+            crossing_x[k] = crossing_x[k - 1];
+            crossing_wind[k] = crossing_wind[k - 1];
+            k--;
+        }
+        crossing_x[k] = x;
+        crossing_wind[k] = wind;
+    }
+
+    // Every edge applies left of all crossings and their windings sum to zero.
+    // Walk right, dropping each edge's winding as its crossing is passed.
+    int16_t winding_number = 0;
+    for (uint8_t k = 0; k < crossings; k++) {
+        bool was_inside = winding_number != 0;
+        winding_number -= crossing_wind[k];
+        bool inside = winding_number != 0;
+        int16_t x = MAX(SHRT_MIN, MIN(SHRT_MAX, crossing_x[k]));
+        if (inside && !was_inside) {
+            if (*span_count > 0 && spans[*span_count - 1].x2 == x) {
+                // Continue the previous span.
+                (*span_count)--;
+            } else {
+                if (*span_count == VECTORIO_MAX_ROW_SPANS) {
+                    return false;
+                }
+                spans[*span_count].x1 = x;
+            }
+        } else if (was_inside && !inside) {
+            spans[*span_count].x2 = x;
+            (*span_count)++;
+        }
+    }
+    return true;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
@@ -33,6 +33,18 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+bool common_hal_vectorio_rectangle_get_row_spans(void *obj, int16_t y, vectorio_span_t *spans, uint8_t *span_count, uint32_t *pixel) {
+    vectorio_rectangle_t *self = obj;
+    *pixel = self->color_index;
+    *span_count = 0;
+    if (y >= 0 && y < self->height && self->width > 0) {
+        spans[0].x1 = 0;
+        spans[0].x2 = self->width;
+        *span_count = 1;
+    }
+    return true;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
@@ -354,6 +354,12 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
+    // Layers above us may have already drawn everything we'd draw.
+    if (displayio_area_fully_masked(area, &overlap, mask)) {
+        VECTORIO_SHAPE_DEBUG(" masked\n");
+        return full_coverage;
+    }
+
     uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
@@ -373,9 +379,26 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_area_t shape_area;
     self->ishape.get_area(self->ishape.shape, &shape_area);
 
+    // Without transposition a screen row is a shape row, so coverage can come from
+    // the shape's row spans. Shape x runs backwards across the screen row when mirrored.
+    bool use_spans = !self->absolute_transform->transpose_xy && self->ishape.get_row_spans != NULL;
+    bool spans_reversed = self->absolute_transform->dx < 1;
+    vectorio_span_t spans[VECTORIO_MAX_ROW_SPANS];
+
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        bool row_has_spans = false;
+        uint8_t span_count = 0;
+        int16_t span_index = 0;
+        uint32_t span_pixel = 0;
+        if (use_spans) {
+            int16_t shape_x;
+            int16_t shape_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &shape_x, &shape_y);
+            row_has_spans = self->ishape.get_row_spans(self->ishape.shape, shape_y, spans, &span_count, &span_pixel);
+            span_index = spans_reversed ? span_count - 1 : 0;
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -397,7 +420,24 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             #ifdef VECTORIO_PERF
             uint64_t pre_pixel = common_hal_time_monotonic_ns();
             #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            if (row_has_spans) {
+                // Pixels are visited in order along the row so the current span only moves one way.
+                bool covered;
+                if (spans_reversed) {
+                    while (span_index >= 0 && spans[span_index].x1 > pixel_to_get_x) {
+                        span_index--;
+                    }
+                    covered = span_index >= 0 && pixel_to_get_x < spans[span_index].x2;
+                } else {
+                    while (span_index < span_count && spans[span_index].x2 <= pixel_to_get_x) {
+                        span_index++;
+                    }
+                    covered = span_index < span_count && spans[span_index].x1 <= pixel_to_get_x;
+                }
+                input_pixel.pixel = covered ? span_pixel : 0;
+            } else {
+                input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            }
             #ifdef VECTORIO_PERF
             uint64_t post_pixel = common_hal_time_monotonic_ns();
             pixel_time += post_pixel - pre_pixel;
@@ -16,6 +16,10 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Fills spans with the sorted, non-overlapping runs of row y the shape covers
+// and sets pixel to their value. Returns false if the row needs more than
+// VECTORIO_MAX_ROW_SPANS spans, in which case get_pixel must be used instead.
+typedef bool get_row_spans_function(mp_obj_t shape, int16_t y, vectorio_span_t *spans, uint8_t *span_count, uint32_t *pixel);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +31,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_row_spans_function *get_row_spans;
 } vectorio_ishape_t;
 
 typedef struct {
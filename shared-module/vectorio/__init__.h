@@ -10,6 +10,15 @@
 
 typedef void event_function(mp_obj_t obj);
 
+// A run of covered pixels [x1, x2) on one row of a shape.
+typedef struct {
+    int16_t x1;
+    int16_t x2;
+} vectorio_span_t;
+
+// Maximum number of spans a shape may return for a single row.
+#define VECTORIO_MAX_ROW_SPANS (16)
+
 typedef struct {
     mp_obj_t obj;
     event_function *event;
@@ -0,0 +1,362 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+
+#include "shared-bindings/zlib/CompressIO.h"
+
+#include "lib/uzlib/uzlib.h"
+
+// A deflate compressor using the fixed Huffman codes, so no block has to be held back to build
+// its own. Matches are found through hash chains over a window that slides along the input.
+
+#define MATCH_LEN_MIN (3)
+#define MATCH_LEN_MAX (258)
+// Input is compressed once it is this far from the end of what has been written, so most
+// matches can run to their longest.
+#define LOOKAHEAD (256)
+
+static const uint16_t length_base[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t distance_base[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577,
+};
+
+size_t common_hal_zlib_compressio_scratch_size(mp_int_t window_bits) {
+    size_t window_size = 1 << window_bits;
+    // head has window_size / 2 entries, prev has window_size and the window is twice that.
+    return window_size / 2 * sizeof(uint16_t) + window_size * sizeof(uint16_t) + 2 * window_size;
+}
+
+static void flush_out(zlib_compressio_obj_t *self) {
+    if (self->out_len == 0) {
+        return;
+    }
+    if (self->sink != NULL) {
+        self->sink(self->sink_data, self->out, self->out_len);
+        self->out_len = 0;
+        return;
+    }
+    int errcode;
+    mp_stream_write_exactly(self->stream, self->out, self->out_len, &errcode);
+    self->out_len = 0;
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+}
+
+static void put_byte(zlib_compressio_obj_t *self, uint8_t b) {
+    self->out[self->out_len++] = b;
+    if (self->out_len == sizeof(self->out)) {
+        flush_out(self);
+    }
+}
+
+static void put_bits(zlib_compressio_obj_t *self, uint32_t value, uint8_t count) {
+    self->bits |= value << self->bit_count;
+    self->bit_count += count;
+    while (self->bit_count >= 8) {
+        put_byte(self, self->bits & 0xff);
+        self->bits >>= 8;
+        self->bit_count -= 8;
+    }
+}
+
+static void align_to_byte(zlib_compressio_obj_t *self) {
+    if (self->bit_count > 0) {
+        put_bits(self, 0, 8 - self->bit_count);
+    }
+}
+
+// Huffman codes are packed starting from their most significant bit.
+static void put_code(zlib_compressio_obj_t *self, uint32_t code, uint8_t count) {
+    uint32_t reversed = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    put_bits(self, reversed, count);
+}
+
+static void put_symbol(zlib_compressio_obj_t *self, uint16_t symbol) {
+    if (symbol < 144) {
+        put_code(self, 0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        put_code(self, 0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        put_code(self, symbol - 256, 7);
+    } else {
+        put_code(self, 0xc0 + symbol - 280, 8);
+    }
+}
+
+static void put_match(zlib_compressio_obj_t *self, size_t length, size_t distance) {
+    uint8_t code = MP_ARRAY_SIZE(length_base) - 1;
+    while (length_base[code] > length) {
+        code--;
+    }
+    put_symbol(self, 257 + code);
+    put_bits(self, length - length_base[code], length_extra[code]);
+
+    code = MP_ARRAY_SIZE(distance_base) - 1;
+    while (distance_base[code] > distance) {
+        code--;
+    }
+    put_code(self, code, 5);
+    // Distance codes from 4 on have 1, 1, 2, 2, 3, 3, ... extra bits.
+    put_bits(self, distance - distance_base[code], code < 4 ? 0 : code / 2 - 1);
+}
+
+static void start_block(zlib_compressio_obj_t *self, bool final) {
+    // BFINAL, then BTYPE 1 for the fixed codes.
+    put_bits(self, (final ? 1 : 0) | 1 << 1, 3);
+}
+
+static void end_block(zlib_compressio_obj_t *self) {
+    put_symbol(self, 256);
+}
+
+static inline size_t hash(zlib_compressio_obj_t *self, size_t pos) {
+    const uint8_t *p = &self->window[pos];
+    uint32_t v = (uint32_t)p[0] << 16 | p[1] << 8 | p[2];
+    return (v * 2654435761u) >> (32 - self->hash_bits);
+}
+
+static void insert(zlib_compressio_obj_t *self, size_t pos) {
+    if (pos + MATCH_LEN_MIN > self->fill) {
+        return;
+    }
+    size_t h = hash(self, pos);
+    self->prev[pos & (self->window_size - 1)] = self->head[h];
+    self->head[h] = pos;
+}
+
+// Returns the length of the longest match for pos, at most chain positions back.
+static size_t longest_match(zlib_compressio_obj_t *self, size_t pos, size_t *distance) {
+    size_t max_len = MIN(self->fill - pos, MATCH_LEN_MAX);
+    if (max_len < MATCH_LEN_MIN) {
+        return 0;
+    }
+    // prev only holds the last window_size positions, so the oldest is one less than that back.
+    size_t limit = pos >= self->window_size ? pos - self->window_size + 1 : 1;
+    const uint8_t *s = &self->window[pos];
+    size_t best_len = MATCH_LEN_MIN - 1;
+    size_t candidate = self->head[hash(self, pos)];
+    for (uint16_t chain = self->chain; chain > 0 && candidate >= limit && candidate < pos; chain--) {
+        const uint8_t *c = &self->window[candidate];
+        // A longer match has to differ from the best so far at its last byte.
+        if (c[best_len] == s[best_len] && c[0] == s[0]) {
+            size_t len = 1;
+            while (len < max_len && c[len] == s[len]) {
+                len++;
+            }
+            if (len > best_len) {
+                best_len = len;
+                *distance = pos - candidate;
+                if (len == max_len) {
+                    break;
+                }
+            }
+        }
+        candidate = self->prev[candidate & (self->window_size - 1)];
+    }
+    return best_len >= MATCH_LEN_MIN ? best_len : 0;
+}
+
+static void compress(zlib_compressio_obj_t *self, bool all) {
+    while (self->pos < self->fill && (all || self->fill - self->pos > LOOKAHEAD)) {
+        size_t distance = 0;
+        size_t len = longest_match(self, self->pos, &distance);
+        insert(self, self->pos);
+        if (len == 0) {
+            put_symbol(self, self->window[self->pos]);
+            self->pos++;
+            continue;
+        }
+        put_match(self, len, distance);
+        size_t end = self->pos + len;
+        for (self->pos++; self->pos < end; self->pos++) {
+            insert(self, self->pos);
+        }
+    }
+}
+
+// Moves the window along by window_size once it is full. prev is indexed by position modulo
+// window_size, so only the positions stored in it change.
+static void slide(zlib_compressio_obj_t *self) {
+    size_t shift = self->window_size;
+    memmove(self->window, self->window + shift, self->fill - shift);
+    self->fill -= shift;
+    self->pos -= shift;
+    size_t head_len = 1 << self->hash_bits;
+    for (size_t i = 0; i < head_len; i++) {
+        self->head[i] = self->head[i] > shift ? self->head[i] - shift : 0;
+    }
+    for (size_t i = 0; i < self->window_size; i++) {
+        self->prev[i] = self->prev[i] > shift ? self->prev[i] - shift : 0;
+    }
+}
+
+static void init(zlib_compressio_obj_t *self, zlib_compressio_format_t format,
+    mp_int_t window_bits, mp_int_t chain, uint8_t *mem) {
+    self->window_size = 1 << window_bits;
+    self->hash_bits = window_bits - 1;
+    self->head = (uint16_t *)mem;
+    self->prev = self->head + self->window_size / 2;
+    self->window = (uint8_t *)(self->prev + self->window_size);
+    memset(self->head, 0, (self->window_size / 2 + self->window_size) * sizeof(uint16_t));
+    self->fill = 0;
+    self->pos = 0;
+    self->chain = chain;
+    self->format = format;
+    self->input_len = 0;
+    self->bits = 0;
+    self->bit_count = 0;
+    self->out_len = 0;
+
+    if (format == ZLIB_COMPRESSIO_FORMAT_ZLIB) {
+        // CMF is the method (8, deflate) and window size, FLG makes CMF * 256 + FLG a multiple
+        // of 31.
+        uint8_t cmf = (window_bits - 8) << 4 | 8;
+        put_byte(self, cmf);
+        put_byte(self, 31 - (cmf * 256) % 31);
+        self->checksum = 1;
+    } else if (format == ZLIB_COMPRESSIO_FORMAT_GZIP) {
+        // No flags or modification time, and the "unix" OS.
+        static const uint8_t header[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03 };
+        for (size_t i = 0; i < sizeof(header); i++) {
+            put_byte(self, header[i]);
+        }
+        self->checksum = 0xffffffff;
+    }
+    start_block(self, false);
+}
+
+void common_hal_zlib_compressio_construct(zlib_compressio_obj_t *self, mp_obj_t stream,
+    zlib_compressio_format_t format, mp_int_t window_bits, mp_int_t chain, mp_obj_t scratch) {
+    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
+
+    size_t scratch_size = common_hal_zlib_compressio_scratch_size(window_bits);
+    uint8_t *mem;
+    if (scratch == mp_const_none) {
+        mem = m_malloc(scratch_size);
+        self->scratch_obj = mp_const_none;
+    } else {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(scratch, &bufinfo, MP_BUFFER_WRITE);
+        mem = bufinfo.buf;
+        size_t len = bufinfo.len;
+        // head and prev need 2-byte alignment.
+        if ((uintptr_t)mem & 1) {
+            mem++;
+            len = len > 0 ? len - 1 : 0;
+        }
+        mp_arg_validate_length_min(len, scratch_size, MP_QSTR_scratch);
+        self->scratch_obj = scratch;
+    }
+    self->stream = stream;
+    self->sink = NULL;
+    self->sink_data = NULL;
+    init(self, format, window_bits, chain, mem);
+}
+
+void zlib_compressio_init_with_sink(zlib_compressio_obj_t *self, zlib_compressio_sink_t sink,
+    void *sink_data, zlib_compressio_format_t format, mp_int_t window_bits, mp_int_t chain,
+    uint8_t *scratch) {
+    // There's no stream but it mustn't be MP_OBJ_NULL, which means closed.
+    self->stream = mp_const_none;
+    self->scratch_obj = mp_const_none;
+    self->sink = sink;
+    self->sink_data = sink_data;
+    init(self, format, window_bits, chain, scratch);
+}
+
+bool common_hal_zlib_compressio_closed(zlib_compressio_obj_t *self) {
+    return self->stream == MP_OBJ_NULL;
+}
+
+void common_hal_zlib_compressio_write(zlib_compressio_obj_t *self, const uint8_t *data, size_t len) {
+    self->input_len += len;
+    if (self->format == ZLIB_COMPRESSIO_FORMAT_ZLIB) {
+        self->checksum = uzlib_adler32(data, len, self->checksum);
+    } else if (self->format == ZLIB_COMPRESSIO_FORMAT_GZIP) {
+        self->checksum = uzlib_crc32(data, len, self->checksum);
+    }
+    size_t buffer_size = 2 * self->window_size;
+    while (len > 0) {
+        // compress() leaves at most LOOKAHEAD bytes, so there is a whole window behind pos.
+        if (self->fill == buffer_size) {
+            slide(self);
+        }
+        size_t n = MIN(len, buffer_size - self->fill);
+        memcpy(self->window + self->fill, data, n);
+        self->fill += n;
+        data += n;
+        len -= n;
+        compress(self, false);
+    }
+}
+
+void common_hal_zlib_compressio_flush(zlib_compressio_obj_t *self) {
+    compress(self, true);
+    // End the block with an empty stored block, which leaves the output on a byte boundary so
+    // everything written so far can be decompressed.
+    end_block(self);
+    put_bits(self, 0, 3);
+    align_to_byte(self);
+    put_byte(self, 0x00);
+    put_byte(self, 0x00);
+    put_byte(self, 0xff);
+    put_byte(self, 0xff);
+    start_block(self, false);
+    flush_out(self);
+}
+
+static void put_be32(zlib_compressio_obj_t *self, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        put_byte(self, value >> shift);
+    }
+}
+
+static void put_le32(zlib_compressio_obj_t *self, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) {
+        put_byte(self, value >> shift);
+    }
+}
+
+void common_hal_zlib_compressio_close(zlib_compressio_obj_t *self) {
+    if (common_hal_zlib_compressio_closed(self)) {
+        return;
+    }
+    compress(self, true);
+    end_block(self);
+    // The blocks so far weren't marked as the last, so finish with an empty one that is.
+    start_block(self, true);
+    end_block(self);
+    align_to_byte(self);
+    if (self->format == ZLIB_COMPRESSIO_FORMAT_ZLIB) {
+        put_be32(self, self->checksum);
+    } else if (self->format == ZLIB_COMPRESSIO_FORMAT_GZIP) {
+        put_le32(self, ~self->checksum);
+        put_le32(self, self->input_len);
+    }
+    flush_out(self);
+    self->stream = MP_OBJ_NULL;
+    self->window = NULL;
+    self->head = NULL;
+    self->prev = NULL;
+    self->scratch_obj = mp_const_none;
+}
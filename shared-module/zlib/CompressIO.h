@@ -0,0 +1,61 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// Compressed output is collected into this many bytes before each write to the stream.
+#ifndef CIRCUITPY_ZLIB_COMPRESS_CHUNK_SIZE
+#define CIRCUITPY_ZLIB_COMPRESS_CHUNK_SIZE (128)
+#endif
+
+typedef enum {
+    ZLIB_COMPRESSIO_FORMAT_RAW,
+    ZLIB_COMPRESSIO_FORMAT_ZLIB,
+    ZLIB_COMPRESSIO_FORMAT_GZIP,
+} zlib_compressio_format_t;
+
+// Takes compressed output instead of a stream when compressing from C outside the VM.
+typedef void (*zlib_compressio_sink_t)(void *sink_data, const uint8_t *buf, size_t len);
+
+typedef struct {
+    mp_obj_base_t base;
+    // MP_OBJ_NULL once closed.
+    mp_obj_t stream;
+    zlib_compressio_sink_t sink;
+    void *sink_data;
+    // The buffer given for scratch, if any, so it stays allocated.
+    mp_obj_t scratch_obj;
+    // 2 * window_size bytes: the history followed by the input not compressed yet.
+    uint8_t *window;
+    // The most recent position with each hash, and the previous position with the same hash
+    // as each position in the window. 0 means none.
+    uint16_t *head;
+    uint16_t *prev;
+    size_t window_size;
+    size_t fill;
+    size_t pos;
+    uint32_t input_len;
+    uint32_t checksum;
+    // Bits not yet making up a whole byte, least significant first.
+    uint32_t bits;
+    uint16_t chain;
+    uint8_t bit_count;
+    uint8_t hash_bits;
+    uint8_t format;
+    uint8_t out_len;
+    uint8_t out[CIRCUITPY_ZLIB_COMPRESS_CHUNK_SIZE];
+} zlib_compressio_obj_t;
+
+// Compresses into sink rather than a stream. scratch must be 2-byte aligned and hold
+// common_hal_zlib_compressio_scratch_size(window_bits) bytes. Nothing raises as long as sink
+// doesn't, so this can be used by the supervisor.
+void zlib_compressio_init_with_sink(zlib_compressio_obj_t *self, zlib_compressio_sink_t sink,
+    void *sink_data, zlib_compressio_format_t format, mp_int_t window_bits, mp_int_t chain,
+    uint8_t *scratch);
@@ -28,57 +28,106 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
-mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
-
-    TINF_DATA *decomp = m_new_obj(TINF_DATA);
+static int decompress_start(TINF_DATA *decomp, const mp_buffer_info_t *bufinfo, mp_int_t wbits) {
     memset(decomp, 0, sizeof(*decomp));
     DEBUG_printf("sizeof(TINF_DATA)=" UINT_FMT "\n", sizeof(*decomp));
     uzlib_uncompress_init(decomp, NULL, 0);
-    mp_uint_t dest_buf_size = (bufinfo.len + 15) & ~15;
-    byte *dest_buf = m_malloc_without_collect(dest_buf_size);
-
-    decomp->dest = dest_buf;
-    decomp->dest_limit = dest_buf + dest_buf_size;
-    DEBUG_printf("zlib: Initial out buffer: " UINT_FMT " bytes\n", decomp->destSize);
-    decomp->source = bufinfo.buf;
-    decomp->source_limit = (unsigned char *)bufinfo.buf + bufinfo.len;
-    int st;
+    decomp->source = bufinfo->buf;
+    decomp->source_limit = (unsigned char *)bufinfo->buf + bufinfo->len;
 
     if (wbits >= 16) {
-        st = uzlib_gzip_parse_header(decomp);
-        if (st < 0) {
-            goto error;
-        }
+        return uzlib_gzip_parse_header(decomp);
     } else if (wbits >= 0) {
-        st = uzlib_zlib_parse_header(decomp);
-        if (st < 0) {
-            goto error;
-        }
+        return uzlib_zlib_parse_header(decomp);
+    }
+    return TINF_OK;
+}
+
+// Points uzlib at size bytes of dest_buf, of which the first offset are already written.
+static void decompress_set_dest(TINF_DATA *decomp, byte *dest_buf, size_t offset, size_t size) {
+    decomp->dest_start = dest_buf;
+    decomp->dest = dest_buf + offset;
+    decomp->dest_limit = dest_buf + size;
+}
+
+mp_obj_t common_hal_zlib_decompress(mp_obj_t data, mp_int_t wbits, mp_int_t bufsize) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+
+    TINF_DATA decomp;
+    int st = decompress_start(&decomp, &bufinfo, wbits);
+    if (st < 0) {
+        goto error;
     }
 
+    // Leave room past a size hint so that uzlib sees the end of the stream without growing.
+    mp_uint_t dest_buf_size = bufsize > 0 ? ((mp_uint_t)bufsize + 16) & ~15 : (bufinfo.len + 15) & ~15;
+    byte *dest_buf = m_malloc_without_collect(dest_buf_size);
+    decompress_set_dest(&decomp, dest_buf, 0, dest_buf_size);
+    DEBUG_printf("zlib: Initial out buffer: " UINT_FMT " bytes\n", dest_buf_size);
+
     while (1) {
-        st = uzlib_uncompress_chksum(decomp);
+        st = uzlib_uncompress_chksum(&decomp);
         if (st < 0) {
             goto error;
         }
         if (st == TINF_DONE) {
             break;
         }
-        size_t offset = decomp->dest - dest_buf;
-        dest_buf = m_renew(byte, dest_buf, dest_buf_size, dest_buf_size + 256);
-        dest_buf_size += 256;
-        decomp->dest = dest_buf + offset;
-        decomp->dest_limit = dest_buf + offset + 256;
+        // Grow by half each time, so large outputs are copied only a few times.
+        size_t offset = decomp.dest - dest_buf;
+        mp_uint_t new_size = dest_buf_size + MAX(dest_buf_size / 2, 256);
+        dest_buf = m_renew(byte, dest_buf, dest_buf_size, new_size);
+        dest_buf_size = new_size;
+        decompress_set_dest(&decomp, dest_buf, offset, dest_buf_size);
     }
 
-    mp_uint_t final_sz = decomp->dest - dest_buf;
+    mp_uint_t final_sz = decomp.dest - dest_buf;
     DEBUG_printf("zlib: Resizing from " UINT_FMT " to final size: " UINT_FMT " bytes\n", dest_buf_size, final_sz);
     dest_buf = (byte *)m_renew(byte, dest_buf, dest_buf_size, final_sz);
-    mp_obj_t res = mp_obj_new_bytearray_by_ref(final_sz, dest_buf);
-    m_del_obj(TINF_DATA, decomp);
-    return res;
+    return mp_obj_new_bytearray_by_ref(final_sz, dest_buf);
+
+error:
+    mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+}
+
+size_t common_hal_zlib_decompress_into(mp_obj_t data, mp_obj_t buffer, mp_int_t wbits) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t dest_bufinfo;
+    mp_get_buffer_raise(buffer, &dest_bufinfo, MP_BUFFER_WRITE);
+
+    TINF_DATA decomp;
+    int st = decompress_start(&decomp, &bufinfo, wbits);
+    if (st < 0) {
+        goto error;
+    }
+    decompress_set_dest(&decomp, dest_bufinfo.buf, 0, dest_bufinfo.len);
+    st = uzlib_uncompress_chksum(&decomp);
+    if (st < 0) {
+        goto error;
+    }
+    size_t len = decomp.dest - (byte *)dest_bufinfo.buf;
+    if (st != TINF_DONE) {
+        // The buffer is full, so it is too small if a copy is still going.
+        bool more = decomp.curlen > (decomp.btype == 0 ? 1 : 0);
+        if (!more) {
+            // Otherwise the stream must end without more output. uzlib writes a byte as soon
+            // as it has one, so give it a spare byte that nothing can be copied from.
+            byte spare;
+            decompress_set_dest(&decomp, &spare, 0, 1);
+            st = uzlib_uncompress_chksum(&decomp);
+            // Either a literal, or a copy refused for reaching before the spare byte.
+            more = st == TINF_OK || (decomp.btype != 0 && decomp.curlen > 0);
+        }
+        if (more) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Buffer too small"));
+        }
+        if (st < 0) {
+            goto error;
+        }
+    }
+    return len;
 
 error:
     mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
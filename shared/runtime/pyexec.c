@@ -127,8 +127,15 @@ static int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                 }
                 #endif
 
-                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-                module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                #if MICROPY_COMP_STREAMING
+                if (input_kind == MP_PARSE_FILE_INPUT && !(exec_flags & EXEC_FLAG_IS_REPL)) {
+                    module_fun = mp_compile_file_in_batches(lex);
+                } else
+                #endif
+                {
+                    mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                    module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                }
                 #else
                 mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("script compilation not supported"));
                 #endif
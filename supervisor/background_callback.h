@@ -32,13 +32,26 @@
  * supervisor_enable_tick() and disabled with supervisor_disable_tick(). When
  * enabled, a timer will schedule a callback to supervisor_background_tick(),
  * which includes port_background_tick(), every millisecond.
+ *
+ * Work that underruns when delayed, such as refilling audio DMA buffers, can
+ * be queued with background_callback_add_with_priority() and
+ * BACKGROUND_CALLBACK_PRIORITY_HIGH. High priority callbacks run before, and
+ * in between, each of the normal ones.
  */
 typedef void (*background_callback_fun)(void *data);
+
+typedef enum {
+    BACKGROUND_CALLBACK_PRIORITY_NORMAL,
+    BACKGROUND_CALLBACK_PRIORITY_HIGH,
+    BACKGROUND_CALLBACK_PRIORITY_COUNT,
+} background_callback_priority_t;
+
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
     struct background_callback *prev;
+    background_callback_priority_t priority;
 } background_callback_t;
 
 /* Add a background callback for which 'fun' and 'data' were previously set */
@@ -53,6 +66,9 @@ void background_callback_add_core(background_callback_t *cb);
  */
 void background_callback_add(background_callback_t *cb, background_callback_fun fun, void *data);
 
+/* Like background_callback_add but queued ahead of normal priority callbacks. */
+void background_callback_add_with_priority(background_callback_t *cb, background_callback_fun fun, void *data, background_callback_priority_t priority);
+
 /* Run all background callbacks.  Normally, this is done by the supervisor
  * whenever the list is non-empty */
 void background_callback_run_all(void);
@@ -75,3 +91,22 @@ void background_callback_allow(void);
  * Background callbacks may stop objects from being collected
  */
 void background_callback_gc_collect(void);
+
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+#include <stdint.h>
+
+// Time spent in each callback function, kept for the first
+// BACKGROUND_CALLBACK_STATS_MAX functions that run.
+#define BACKGROUND_CALLBACK_STATS_MAX (16)
+
+typedef struct {
+    background_callback_fun fun;
+    uint32_t calls;
+    uint32_t total_us;
+    uint32_t max_us;
+} background_callback_stats_t;
+
+extern background_callback_stats_t background_callback_stats[BACKGROUND_CALLBACK_STATS_MAX];
+
+void background_callback_reset_stats(void);
+#endif
@@ -15,7 +15,15 @@ extern volatile bool filesystem_flush_requested;
 void filesystem_background(void);
 void filesystem_tick(void);
 bool filesystem_init(bool create_allowed, bool force_create);
+#if CIRCUITPY_SAVES_LITTLEFS
+// Mount the littlefs SAVES partition at /saves. It is allocated on the VM heap so it must be
+// called again for each VM.
+void filesystem_mount_saves(void);
+#endif
 void filesystem_flush(void);
+// Push the next periodic flush back a full interval. Writes that keep arriving, like a file
+// copy over USB, are then flushed once they stop instead of part way through.
+void filesystem_defer_flush(void);
 bool filesystem_present(void);
 void filesystem_set_internal_writable_by_usb(bool usb_writable);
 void filesystem_set_internal_concurrent_write_protection(bool concurrent_write_protection);
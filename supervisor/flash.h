@@ -9,6 +9,7 @@
 #include <stdbool.h>
 
 #include "py/mpconfig.h"
+#include "py/obj.h"
 
 #if INTERNAL_FLASH_FILESYSTEM
 #include "supervisor/shared/internal_flash.h"
@@ -26,9 +27,20 @@ mp_uint_t supervisor_flash_write_blocks(const uint8_t *src, uint32_t block_num,
 
 struct _fs_user_mount_t;
 void supervisor_flash_init_vfs(struct _fs_user_mount_t *vfs);
+// Where a sector of a filesystem on this flash can be read in place, or NULL when the flash
+// isn't memory mapped. Flush first so the flash holds the latest data.
+const uint8_t *supervisor_flash_get_mapped_sector(struct _fs_user_mount_t *vfs, uint32_t sector);
+// Implemented by ports with memory mapped flash. Addresses of the following blocks must follow on.
+const uint8_t *supervisor_flash_get_mapped_block(uint32_t block_num);
 void supervisor_flash_flush(void);
 void supervisor_flash_release_cache(void);
 
 void supervisor_flash_set_extended(bool extended);
 bool supervisor_flash_get_extended(void);
 void supervisor_flash_update_extended(void);
+
+#if CIRCUITPY_SAVES_LITTLEFS
+// Raw block device for the SAVES partition when it holds littlefs instead of FAT.
+extern const mp_obj_base_t supervisor_saves_flash_obj;
+void supervisor_flash_saves_invalidate(void);
+#endif
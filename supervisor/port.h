@@ -66,6 +66,12 @@ void port_interrupt_after_ticks(uint32_t ticks);
 // may not be a system level sleep.
 void port_idle_until_interrupt(void);
 
+// Calls fun over [0, count), split into two ranges when a second core is free to run one of them,
+// and returns once both are done. fun may run on the other core so it must not allocate, raise or
+// otherwise touch the VM. Ports without a second core call fun(data, 0, count).
+typedef void (*port_split_fun_t)(void *data, size_t start, size_t end);
+void port_run_split(port_split_fun_t fun, void *data, size_t count);
+
 // Execute port specific actions during background tick. Only if ticks are enabled.
 void port_background_tick(void);
 
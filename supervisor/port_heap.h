@@ -27,3 +27,19 @@ void port_free(void *ptr);
 void *port_realloc(void *ptr, size_t size, bool dma_capable);
 
 size_t port_heap_get_largest_free_size(void);
+
+// True when ptr is in RAM outside the chip, such as PSRAM, which is slower to read.
+bool port_ptr_in_external_ram(const void *ptr);
+
+typedef struct {
+    size_t total;
+    size_t used;
+    size_t free;
+    size_t free_blocks;
+} port_heap_stats_t;
+
+// Totals across all of the port's pools. Block overhead counts as used.
+void port_heap_get_stats(port_heap_stats_t *stats);
+
+// Adds one TLSF pool to the stats. For ports that manage their own pools.
+void port_heap_add_tlsf_pool_stats(void *pool, port_heap_stats_t *stats);
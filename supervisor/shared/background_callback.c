@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/misc.h"
 #include "py/mpconfig.h"
 #include "supervisor/background_callback.h"
 #include "supervisor/linker.h"
@@ -14,7 +15,8 @@
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-static volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+static volatile background_callback_t *volatile callback_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+static volatile background_callback_t *volatile callback_tail[BACKGROUND_CALLBACK_PRIORITY_COUNT];
 
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
@@ -27,37 +29,103 @@ MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
 void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+    background_callback_priority_t priority = cb->priority;
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
+    if (cb->prev || callback_head[priority] == cb) {
         CALLBACK_CRITICAL_END;
         return;
     }
     cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
+    cb->prev = (background_callback_t *)callback_tail[priority];
+    if (callback_tail[priority]) {
+        callback_tail[priority]->next = cb;
     }
-    if (!callback_head) {
-        callback_head = cb;
+    if (!callback_head[priority]) {
+        callback_head[priority] = cb;
     }
-    callback_tail = cb;
+    callback_tail[priority] = cb;
     CALLBACK_CRITICAL_END;
 
     port_wake_main_task();
 }
 
 void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, background_callback_fun fun, void *data) {
+    background_callback_add_with_priority(cb, fun, data, BACKGROUND_CALLBACK_PRIORITY_NORMAL);
+}
+
+void PLACE_IN_ITCM(background_callback_add_with_priority)(background_callback_t * cb, background_callback_fun fun, void *data, background_callback_priority_t priority) {
     cb->fun = fun;
     cb->data = data;
+    cb->priority = priority;
     background_callback_add_core(cb);
 }
 
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    return callback_head[BACKGROUND_CALLBACK_PRIORITY_NORMAL] != NULL ||
+           callback_head[BACKGROUND_CALLBACK_PRIORITY_HIGH] != NULL;
 }
 
 static int background_prevention_count;
 
+// Called and returns in the critical section.
+static background_callback_t *PLACE_IN_ITCM(take_list)(background_callback_priority_t priority) {
+    background_callback_t *cb = (background_callback_t *)callback_head[priority];
+    callback_head[priority] = NULL;
+    callback_tail[priority] = NULL;
+    return cb;
+}
+
+#if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+background_callback_stats_t background_callback_stats[BACKGROUND_CALLBACK_STATS_MAX];
+
+static uint32_t stats_now_us(void) {
+    // 1024 ticks per second and 32 subticks per tick.
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks) * 32 + subticks;
+    return ticks * 1000000 / 32768;
+}
+
+static void PLACE_IN_ITCM(stats_record)(background_callback_fun fun, uint32_t elapsed) {
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_STATS_MAX; i++) {
+        background_callback_stats_t *stats = &background_callback_stats[i];
+        if (stats->fun != fun && stats->fun != NULL) {
+            continue;
+        }
+        stats->fun = fun;
+        stats->calls++;
+        stats->total_us += elapsed;
+        stats->max_us = MAX(stats->max_us, elapsed);
+        return;
+    }
+}
+
+void background_callback_reset_stats(void) {
+    memset(background_callback_stats, 0, sizeof(background_callback_stats));
+}
+#endif
+
+// Called and returns in the critical section. Runs the next callback in the list and returns the
+// one after it.
+static background_callback_t *PLACE_IN_ITCM(run_one)(background_callback_t * cb) {
+    background_callback_t *next = cb->next;
+    cb->next = cb->prev = NULL;
+    background_callback_fun fun = cb->fun;
+    void *data = cb->data;
+    CALLBACK_CRITICAL_END;
+    // Leave the critical section in order to run the callback function
+    if (fun) {
+        #if CIRCUITPY_BACKGROUND_CALLBACK_STATS
+        uint32_t start = stats_now_us();
+        fun(data);
+        stats_record(fun, stats_now_us() - start);
+        #else
+        fun(data);
+        #endif
+    }
+    CALLBACK_CRITICAL_BEGIN;
+    return next;
+}
+
 void PLACE_IN_ITCM(background_callback_run_all)(void) {
     port_background_task();
     if (!background_callback_pending()) {
@@ -69,21 +137,17 @@ void PLACE_IN_ITCM(background_callback_run_all)(void) {
         return;
     }
     ++background_prevention_count;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = cb->prev = NULL;
-        background_callback_fun fun = cb->fun;
-        void *data = cb->data;
-        CALLBACK_CRITICAL_END;
-        // Leave the critical section in order to run the callback function
-        if (fun) {
-            fun(data);
+    background_callback_t *cb = take_list(BACKGROUND_CALLBACK_PRIORITY_NORMAL);
+    while (true) {
+        // Anything high priority that was queued by now goes ahead of the next normal callback.
+        background_callback_t *high = take_list(BACKGROUND_CALLBACK_PRIORITY_HIGH);
+        while (high) {
+            high = run_one(high);
         }
-        CALLBACK_CRITICAL_BEGIN;
-        cb = next;
+        if (!cb) {
+            break;
+        }
+        cb = run_one(cb);
     }
     --background_prevention_count;
     CALLBACK_CRITICAL_END;
@@ -104,33 +168,35 @@ void background_callback_allow(void) {
 
 // Filter out queued callbacks if they are allocated on the heap.
 void background_callback_reset(void) {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
     CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = NULL;
-        // Unlink any callbacks that are allocated on the python heap or if they
-        // reference data on the python heap. The python heap will be disappear
-        // soon after this.
-        if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
-            cb->prev = NULL; // Used to indicate a callback isn't queued.
-        } else {
-            // Set .next of the previous callback.
-            *previous_next = cb;
-            // Set our .next for the next callback.
-            previous_next = &cb->next;
-            // Set our prev to the last callback.
-            cb->prev = new_tail;
-            // Now we're the tail of the list.
-            new_tail = cb;
+    for (size_t priority = 0; priority < BACKGROUND_CALLBACK_PRIORITY_COUNT; priority++) {
+        background_callback_t *new_head = NULL;
+        background_callback_t **previous_next = &new_head;
+        background_callback_t *new_tail = NULL;
+        background_callback_t *cb = (background_callback_t *)callback_head[priority];
+        while (cb) {
+            background_callback_t *next = cb->next;
+            cb->next = NULL;
+            // Unlink any callbacks that are allocated on the python heap or if they
+            // reference data on the python heap. The python heap will be disappear
+            // soon after this.
+            if (gc_ptr_on_heap((void *)cb) || gc_ptr_on_heap(cb->data)) {
+                cb->prev = NULL; // Used to indicate a callback isn't queued.
+            } else {
+                // Set .next of the previous callback.
+                *previous_next = cb;
+                // Set our .next for the next callback.
+                previous_next = &cb->next;
+                // Set our prev to the last callback.
+                cb->prev = new_tail;
+                // Now we're the tail of the list.
+                new_tail = cb;
+            }
+            cb = next;
         }
-        cb = next;
+        callback_head[priority] = new_head;
+        callback_tail[priority] = new_tail;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
     background_prevention_count = 0;
     CALLBACK_CRITICAL_END;
 }
@@ -150,9 +216,11 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    for (size_t priority = 0; priority < BACKGROUND_CALLBACK_PRIORITY_COUNT; priority++) {
+        background_callback_t *cb = (background_callback_t *)callback_head[priority];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
@@ -0,0 +1,17 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "supervisor/shared/boot_trace.h"
+#include "supervisor/shared/tick.h"
+
+uint32_t boot_trace_ms[BOOT_TRACE_STAGE_COUNT];
+
+void boot_trace_record(boot_trace_stage_t stage) {
+    // Only the first pass counts. code.py also starts again after each reload.
+    if (boot_trace_ms[stage] == 0) {
+        boot_trace_ms[stage] = supervisor_ticks_ms32();
+    }
+}
@@ -0,0 +1,31 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stdint.h>
+
+// Stages of startup in main(), in the order they finish.
+typedef enum {
+    BOOT_TRACE_PORT_INIT,
+    BOOT_TRACE_SAFE_MODE_WAIT,
+    BOOT_TRACE_FILESYSTEM_INIT,
+    BOOT_TRACE_BOARD_INIT,
+    BOOT_TRACE_BOOT_PY,
+    BOOT_TRACE_WORKFLOW_START,
+    BOOT_TRACE_CODE_PY_START,
+    BOOT_TRACE_STAGE_COUNT,
+} boot_trace_stage_t;
+
+#if CIRCUITPY_BOOT_TRACE
+// Milliseconds since reset when each stage finished. 0 if it hasn't yet.
+extern uint32_t boot_trace_ms[BOOT_TRACE_STAGE_COUNT];
+
+void boot_trace_record(boot_trace_stage_t stage);
+#else
+static inline void boot_trace_record(boot_trace_stage_t stage) {
+}
+#endif
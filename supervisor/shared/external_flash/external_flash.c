@@ -22,24 +22,34 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
-
 static const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
-// Table of pointers to each cached block. Should be zero'd after allocation.
+// A sector held in the cache, ram or flash based. Only the first is used when
+// caching in the scratch sector of the flash.
+typedef struct {
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the cache.
+    uint32_t dirty_mask;
+    // The write count when the sector was last written, to flush the least
+    // recently written sector first.
+    uint32_t last_write;
+} cached_sector_t;
+
+static cached_sector_t cached_sectors[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+static uint32_t write_count;
+
+// Table of pointers to each cached page, for each cached sector. Should be
+// zero'd after allocation.
 #define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
 #define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
 #define FLASH_CACHE_TABLE_NUM_ENTRIES (BLOCKS_PER_SECTOR * PAGES_PER_BLOCK)
-#define FLASH_CACHE_TABLE_SIZE (FLASH_CACHE_TABLE_NUM_ENTRIES * sizeof (uint8_t *))
+#define FLASH_CACHE_TABLE_SIZE (CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS * FLASH_CACHE_TABLE_NUM_ENTRIES * sizeof (uint8_t *))
 static uint8_t **flash_cache_table = NULL;
+// How many of cached_sectors have pages allocated in flash_cache_table.
+static size_t ram_cache_sectors;
 
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
@@ -135,7 +145,7 @@ static bool page_erased(uint32_t sector_address) {
     uint8_t full_buffer[FILESYSTEM_BLOCK_SIZE];
     if (read_flash(sector_address, full_buffer, FILESYSTEM_BLOCK_SIZE)) {
         for (uint16_t i = 0; i < FILESYSTEM_BLOCK_SIZE; i++) {
-            if (short_buffer[i] != 0xff) {
+            if (full_buffer[i] != 0xff) {
                 return false;
             }
         }
@@ -281,9 +291,12 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        cached_sectors[i].sector = NO_SECTOR_LOADED;
+        cached_sectors[i].dirty_mask = 0;
+    }
     flash_cache_table = NULL;
+    ram_cache_sectors = 0;
 }
 
 // The size of each individual block.
@@ -303,8 +316,8 @@ uint32_t supervisor_flash_get_block_count(void) {
 
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
-static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
+static bool flush_scratch_flash(cached_sector_t *cached) {
+    if (cached->sector == NO_SECTOR_LOADED) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector we've
@@ -312,9 +325,9 @@ static bool flush_scratch_flash(void) {
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((cached->dirty_mask & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(cached->sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -324,22 +337,26 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cached->sector);
     // Finally, copy the new version into it.
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-            current_sector + i * FILESYSTEM_BLOCK_SIZE);
+            cached->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
 
+static uint8_t **sector_pages(const cached_sector_t *cached) {
+    return flash_cache_table + (cached - cached_sectors) * FLASH_CACHE_TABLE_NUM_ENTRIES;
+}
+
 // Free all entries in the partially or completely filled flash_cache_table, and then free the table itself.
 static void release_ram_cache(void) {
     if (flash_cache_table == NULL) {
         return;
     }
 
-    for (size_t i = 0; i < FLASH_CACHE_TABLE_NUM_ENTRIES; i++) {
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS * FLASH_CACHE_TABLE_NUM_ENTRIES; i++) {
         // Table may not be completely full. Stop at first NULL entry.
         if (flash_cache_table[i] == NULL) {
             break;
@@ -348,64 +365,62 @@ static void release_ram_cache(void) {
     }
     port_free(flash_cache_table);
     flash_cache_table = NULL;
+    ram_cache_sectors = 0;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
-static bool allocate_ram_cache(void) {
-    flash_cache_table = port_malloc(FLASH_CACHE_TABLE_SIZE, false);
-    if (flash_cache_table == NULL) {
-        // Not enough space even for the cache table.
+// Attempts to allocate page buffers for caching one more full sector in ram,
+// and the table for them if there isn't one yet. Each page is allocated
+// separately so that the heap doesn't need to provide one huge block.
+static bool allocate_ram_cache_sector(void) {
+    if (ram_cache_sectors == CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS) {
         return false;
     }
-
-    // Clear all the entries so it's easy to find the last entry.
-    memset(flash_cache_table, 0, FLASH_CACHE_TABLE_SIZE);
-
-    bool success = true;
-    for (size_t i = 0; i < BLOCKS_PER_SECTOR && success; i++) {
-        for (size_t j = 0; j < PAGES_PER_BLOCK && success; j++) {
-            uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
-                break;
-            }
-            flash_cache_table[i * PAGES_PER_BLOCK + j] = page_cache;
+    if (flash_cache_table == NULL) {
+        flash_cache_table = port_malloc(FLASH_CACHE_TABLE_SIZE, false);
+        if (flash_cache_table == NULL) {
+            // Not enough space even for the cache table.
+            return false;
         }
+        // Clear all the entries so it's easy to find the last entry.
+        memset(flash_cache_table, 0, FLASH_CACHE_TABLE_SIZE);
     }
 
-    // We couldn't allocate enough so give back what we got.
-    if (!success) {
-        release_ram_cache();
+    uint8_t **pages = flash_cache_table + ram_cache_sectors * FLASH_CACHE_TABLE_NUM_ENTRIES;
+    for (size_t i = 0; i < FLASH_CACHE_TABLE_NUM_ENTRIES; i++) {
+        pages[i] = port_malloc(SPI_FLASH_PAGE_SIZE, false);
+        if (pages[i] == NULL) {
+            // We couldn't allocate enough so give back what we got. Without a
+            // first sector the table is no use either.
+            while (i-- > 0) {
+                port_free(pages[i]);
+                pages[i] = NULL;
+            }
+            if (ram_cache_sectors == 0) {
+                release_ram_cache();
+            }
+            return false;
+        }
     }
-    return success;
+    ram_cache_sectors++;
+    return true;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (flash_cache_table == NULL) {
-        // Nothing to flush because there is no cache.
-        return true;
-    }
-
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
+// Flush a sector cached in ram onto the flash.
+static bool flush_ram_cache(cached_sector_t *cached) {
+    if (cached->sector == NO_SECTOR_LOADED) {
         return true;
     }
+    uint8_t **pages = sector_pages(cached);
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
     bool copy_to_ram_ok = true;
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+        if ((cached->dirty_mask & (1 << i)) == 0) {
             for (size_t j = 0; j < PAGES_PER_BLOCK; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * PAGES_PER_BLOCK + j],
+                    cached->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                    pages[i * PAGES_PER_BLOCK + j],
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -421,40 +436,50 @@ static bool flush_ram_cache(bool keep_cache) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(cached->sector);
     // Lastly, write all the data in ram that we've cached.
     for (size_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         for (size_t j = 0; j < PAGES_PER_BLOCK; j++) {
-            write_flash(current_sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * PAGES_PER_BLOCK + j],
+            write_flash(cached->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                pages[i * PAGES_PER_BLOCK + j],
                 SPI_FLASH_PAGE_SIZE);
         }
     }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
-    }
     return true;
 }
 
-// Delegates to the correct flash flush method depending on the existing cache.
-// TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
-static void spi_flash_flush_keep_cache(bool keep_cache) {
+// Writes one cached sector back to the flash, ram or flash based, and frees
+// its place in the cache.
+static void flush_cached_sector(cached_sector_t *cached) {
+    if (cached->sector == NO_SECTOR_LOADED) {
+        return;
+    }
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
     // If we've cached to the flash itself flush from there.
     if (flash_cache_table == NULL) {
-        flush_scratch_flash();
+        flush_scratch_flash(cached);
     } else {
-        flush_ram_cache(keep_cache);
+        flush_ram_cache(cached);
     }
-    current_sector = NO_SECTOR_LOADED;
+    cached->sector = NO_SECTOR_LOADED;
+    cached->dirty_mask = 0;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
 }
 
+// Flushes every cached sector. We'll free the cache unless keep_cache is true.
+static void spi_flash_flush_keep_cache(bool keep_cache) {
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        flush_cached_sector(&cached_sectors[i]);
+    }
+    if (!keep_cache) {
+        release_ram_cache();
+    }
+}
+
 void supervisor_external_flash_flush(void) {
     spi_flash_flush_keep_cache(true);
 }
@@ -472,6 +497,59 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+static cached_sector_t *find_cached_sector(uint32_t sector) {
+    for (size_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        if (cached_sectors[i].sector == sector) {
+            return &cached_sectors[i];
+        }
+    }
+    return NULL;
+}
+
+// Returns the cached sector holding a newer copy of the block at address, if
+// there is one.
+static cached_sector_t *find_cached_block(uint32_t address) {
+    // Mask out the lower bits that designate the address within the sector.
+    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
+    size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+    uint32_t mask = 1 << (block_index);
+    cached_sector_t *cached = find_cached_sector(this_sector);
+    if (cached != NULL && (mask & cached->dirty_mask) > 0) {
+        return cached;
+    }
+    return NULL;
+}
+
+// Finds a place in the cache for a new sector, flushing the least recently
+// written sector if every place is taken.
+static cached_sector_t *make_room_in_cache(void) {
+    if (flash_cache_table == NULL) {
+        // Caching in the scratch sector, or nothing cached yet. Try for ram
+        // again now that the scratch sector is free.
+        flush_cached_sector(&cached_sectors[0]);
+        if (!allocate_ram_cache_sector()) {
+            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            wait_for_flash_ready();
+        }
+        return &cached_sectors[0];
+    }
+    cached_sector_t *oldest = NULL;
+    for (size_t i = 0; i < ram_cache_sectors; i++) {
+        cached_sector_t *cached = &cached_sectors[i];
+        if (cached->sector == NO_SECTOR_LOADED) {
+            return cached;
+        }
+        if (oldest == NULL || write_count - cached->last_write > write_count - oldest->last_write) {
+            oldest = cached;
+        }
+    }
+    if (allocate_ram_cache_sector()) {
+        return &cached_sectors[ram_cache_sectors - 1];
+    }
+    flush_cached_sector(oldest);
+    return oldest;
+}
+
 static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     int32_t address = convert_block_to_flash_addr(block);
     if (address == -1) {
@@ -479,16 +557,15 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
         return false;
     }
 
-    // Mask out the lower bits that designate the address within the sector.
-    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
-    uint32_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
+    cached_sector_t *cached = find_cached_block(address);
+    // We're reading from a cached sector.
+    if (cached != NULL) {
+        size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
         if (flash_cache_table != NULL) {
+            uint8_t **pages = sector_pages(cached);
             for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * PAGES_PER_BLOCK + i],
+                    pages[block_index * PAGES_PER_BLOCK + i],
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -513,29 +590,30 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
     size_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
     uint32_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    cached_sector_t *cached = find_cached_sector(this_sector);
+    // The scratch sector can't be written twice without an erase, so writing
+    // the same block again flushes it first. Ram can just be written again.
+    if (cached != NULL && flash_cache_table == NULL && (mask & cached->dirty_mask) > 0) {
+        flush_cached_sector(cached);
+        cached = NULL;
+    }
+    if (cached == NULL) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
         if (page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        cached = make_room_in_cache();
+        cached->sector = this_sector;
+        cached->dirty_mask = 0;
     }
-    dirty_mask |= mask;
+    cached->dirty_mask |= mask;
+    cached->last_write = ++write_count;
     // Copy the block to the appropriate cache.
     if (flash_cache_table != NULL) {
+        uint8_t **pages = sector_pages(cached);
         for (int i = 0; i < PAGES_PER_BLOCK; i++) {
-            memcpy(flash_cache_table[block_index * PAGES_PER_BLOCK + i],
+            memcpy(pages[block_index * PAGES_PER_BLOCK + i],
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -546,11 +624,32 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+// The most blocks read with one command. Some SPI DMA can't do more than
+// 65535 bytes at once.
+#define MAX_READ_BLOCKS (32 * 1024 / FILESYSTEM_BLOCK_SIZE)
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    size_t i = 0;
+    while (i < num_blocks) {
+        int32_t address = convert_block_to_flash_addr(block_num + i);
+        if (address == -1 || find_cached_block(address) != NULL) {
+            if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+                return 1; // error
+            }
+            i++;
+            continue;
+        }
+        // Read the run of blocks that aren't cached with a single command.
+        size_t run = 1;
+        while (i + run < num_blocks && run < MAX_READ_BLOCKS &&
+               convert_block_to_flash_addr(block_num + i + run) != -1 &&
+               find_cached_block(address + run * FILESYSTEM_BLOCK_SIZE) == NULL) {
+            run++;
+        }
+        if (!read_flash(address, dest + i * FILESYSTEM_BLOCK_SIZE, run * FILESYSTEM_BLOCK_SIZE)) {
             return 1; // error
         }
+        i += run;
     }
     return 0; // success
 }
@@ -24,6 +24,13 @@
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #endif
 
+// How many erase sectors can be cached before one is written back to the
+// flash. Each takes SPI_FLASH_ERASE_SIZE bytes of the port heap while
+// cached. If the heap can't provide them all, fewer are used.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (1)
+#endif
+
 void supervisor_external_flash_flush(void);
 
 // Configure anything that needs to get set up before the external flash
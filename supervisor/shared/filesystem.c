@@ -11,6 +11,11 @@
 #include "lib/oofatfs/diskio.h"
 
 #include "py/mpstate.h"
+#include "py/runtime.h"
+
+#if CIRCUITPY_SAVES_LITTLEFS
+#include "extmod/vfs_lfs.h"
+#endif
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
@@ -22,7 +27,7 @@
 static mp_vfs_mount_t _circuitpy_vfs;
 static fs_user_mount_t _circuitpy_usermount;
 
-#if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+#if CIRCUITPY_SAVES_PARTITION_SIZE > 0 && !CIRCUITPY_SAVES_LITTLEFS
 static mp_vfs_mount_t _saves_vfs;
 static fs_user_mount_t _saves_usermount;
 #endif
@@ -52,6 +57,14 @@ inline void filesystem_tick(void) {
     }
 }
 
+void filesystem_defer_flush(void) {
+    if (filesystem_flush_interval_ms == 0) {
+        return;
+    }
+    filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
+    filesystem_flush_requested = false;
+}
+
 
 __attribute__((unused)) // this function MAY be unused
 static void make_empty_file(FATFS *fatfs, const char *path) {
@@ -90,7 +103,9 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     // SAVES is placed before CIRCUITPY so that CIRCUITPY takes up the remaining space.
     circuitpy->blockdev.offset = CIRCUITPY_SAVES_PARTITION_SIZE;
     circuitpy->blockdev.size = -1;
+    #endif
 
+    #if CIRCUITPY_SAVES_PARTITION_SIZE > 0 && !CIRCUITPY_SAVES_LITTLEFS
     fs_user_mount_t *saves = &_saves_usermount;
     saves->blockdev.flags = 0;
     saves->blockdev.offset = 0;
@@ -153,7 +168,18 @@ bool filesystem_init(bool create_allowed, bool force_create) {
         #endif
         #endif
 
-        #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+        #if CIRCUITPY_SAVES_LITTLEFS
+        // littlefs needs the VM heap so the partition is formatted when it is next mounted.
+        supervisor_flash_saves_invalidate();
+        res = f_mkdir(&circuitpy->fatfs, "/saves");
+        #if CIRCUITPY_FULL_BUILD
+        if (res == FR_OK) {
+            MAKE_FILE_WITH_OPTIONAL_CONTENTS(&circuitpy->fatfs, "/saves/placeholder.txt",
+                "A separate littlefs filesystem mounted at /saves will hide this file from Python."
+                " Saves are not visible via USB.\n");
+        }
+        #endif
+        #elif CIRCUITPY_SAVES_PARTITION_SIZE > 0
         res = f_mkfs(&saves->fatfs, formats, 0, working_buf, sizeof(working_buf));
         if (res == FR_OK) {
             // Flush the new file system to make sure it's repaired immediately.
@@ -198,7 +224,7 @@ bool filesystem_init(bool create_allowed, bool force_create) {
 
     MP_STATE_VM(vfs_mount_table) = circuitpy_vfs;
 
-    #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+    #if CIRCUITPY_SAVES_PARTITION_SIZE > 0 && !CIRCUITPY_SAVES_LITTLEFS
     res = f_mount(&saves->fatfs);
     if (res == FR_OK) {
         mp_vfs_mount_t *saves_vfs = &_saves_vfs;
@@ -225,6 +251,45 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     return true;
 }
 
+#if CIRCUITPY_SAVES_LITTLEFS
+void filesystem_mount_saves(void) {
+    if (!filesystem_present()) {
+        return;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // Read and program whole flash blocks so the flash layer never has to merge partial ones.
+        mp_obj_t args[] = {
+            MP_OBJ_FROM_PTR(&supervisor_saves_flash_obj),
+            MP_OBJ_NEW_QSTR(MP_QSTR_readsize), MP_OBJ_NEW_SMALL_INT(FILESYSTEM_BLOCK_SIZE),
+            MP_OBJ_NEW_QSTR(MP_QSTR_progsize), MP_OBJ_NEW_SMALL_INT(FILESYSTEM_BLOCK_SIZE),
+        };
+        mp_obj_t vfs_obj = MP_OBJ_NULL;
+        nlr_buf_t mount_nlr;
+        if (nlr_push(&mount_nlr) == 0) {
+            vfs_obj = MP_OBJ_TYPE_GET_SLOT(&mp_type_vfs_lfs2, make_new)(&mp_type_vfs_lfs2, 1, 2, args);
+            nlr_pop();
+        } else {
+            // No filesystem yet (or it was wiped by a reformat) so make a fresh one.
+            mp_obj_t mkfs = mp_load_attr(MP_OBJ_FROM_PTR(&mp_type_vfs_lfs2), MP_QSTR_mkfs);
+            mp_call_function_n_kw(mkfs, 1, 2, args);
+            vfs_obj = MP_OBJ_TYPE_GET_SLOT(&mp_type_vfs_lfs2, make_new)(&mp_type_vfs_lfs2, 1, 2, args);
+        }
+
+        // The mount lives on the heap so stop_mp() drops it along with the VM.
+        mp_vfs_mount_t *saves_vfs = m_new_obj(mp_vfs_mount_t);
+        saves_vfs->str = "/saves";
+        saves_vfs->len = 6;
+        saves_vfs->obj = vfs_obj;
+        saves_vfs->next = MP_STATE_VM(vfs_mount_table);
+        MP_STATE_VM(vfs_mount_table) = saves_vfs;
+        nlr_pop();
+    } else {
+        // Leave /saves as the placeholder directory on CIRCUITPY.
+    }
+}
+#endif
+
 void PLACE_IN_ITCM(filesystem_flush)(void) {
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: MIT
 #include "supervisor/flash.h"
 
+#include <string.h>
+
 #include "extmod/vfs_fat.h"
 #include "py/runtime.h"
 #include "lib/oofatfs/diskio.h"
@@ -151,6 +153,14 @@ static mp_uint_t flash_read_blocks(mp_obj_t self_in, uint8_t *dest, uint32_t blo
 
 static volatile bool filesystem_dirty = false;
 
+static void mark_filesystem_dirty(void) {
+    if (!filesystem_dirty) {
+        // Turn on ticks so that we can flush after a period of time elapses.
+        supervisor_enable_tick();
+        filesystem_dirty = true;
+    }
+}
+
 static mp_uint_t flash_write_blocks(mp_obj_t self_in, const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
     if (block_num == 0) {
         if (num_blocks > 1) {
@@ -159,11 +169,7 @@ static mp_uint_t flash_write_blocks(mp_obj_t self_in, const uint8_t *src, uint32
         // can't write MBR, but pretend we did
         return 0;
     } else {
-        if (!filesystem_dirty) {
-            // Turn on ticks so that we can flush after a period of time elapses.
-            supervisor_enable_tick();
-            filesystem_dirty = true;
-        }
+        mark_filesystem_dirty();
         block_num -= PART1_START_BLOCK;
         #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
         mp_vfs_blockdev_t *self = (mp_vfs_blockdev_t *)self_in;
@@ -218,6 +224,24 @@ MP_DEFINE_CONST_OBJ_TYPE(
     locals_dict, &supervisor_flash_obj_locals_dict
     );
 
+MP_WEAK const uint8_t *supervisor_flash_get_mapped_block(uint32_t block_num) {
+    return NULL;
+}
+
+const uint8_t *supervisor_flash_get_mapped_sector(fs_user_mount_t *vfs, uint32_t sector) {
+    // Only filesystems on this flash can be mapped.
+    if ((vfs->blockdev.flags & MP_BLOCKDEV_FLAG_NATIVE) == 0 ||
+        vfs->blockdev.readblocks[2] != (mp_obj_t)flash_read_blocks ||
+        sector < PART1_START_BLOCK) {
+        return NULL;
+    }
+    uint32_t block_num = sector - PART1_START_BLOCK;
+    #if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+    block_num += vfs->blockdev.offset / vfs->blockdev.block_size;
+    #endif
+    return supervisor_flash_get_mapped_block(block_num);
+}
+
 void supervisor_flash_init_vfs(fs_user_mount_t *vfs) {
     vfs->base.type = &mp_fat_vfs_type;
     vfs->blockdev.flags |= MP_BLOCKDEV_FLAG_NATIVE | MP_BLOCKDEV_FLAG_HAVE_IOCTL;
@@ -234,3 +258,121 @@ void supervisor_flash_init_vfs(fs_user_mount_t *vfs) {
     vfs->blockdev.u.ioctl[1] = (mp_obj_t)&vfs->blockdev;
     vfs->blockdev.u.ioctl[2] = (mp_obj_t)flash_ioctl; // native version
 }
+
+#if CIRCUITPY_SAVES_LITTLEFS
+// The littlefs SAVES partition is a raw block device: no fake MBR and the extended
+// readblocks(block, buf, offset) protocol that littlefs uses. Its blocks are
+// CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE long so that one littlefs block never shares an erase
+// sector with another. Erasing is left to the flash layer, which erases before it writes.
+const mp_obj_type_t supervisor_saves_flash_type;
+const mp_obj_base_t supervisor_saves_flash_obj = {&supervisor_saves_flash_type};
+
+static mp_int_t saves_flash_transfer(uint32_t address, uint8_t *buf, size_t len, bool write) {
+    if (address + len > CIRCUITPY_SAVES_PARTITION_SIZE) {
+        return -MP_EIO;
+    }
+    if (write) {
+        mark_filesystem_dirty();
+    }
+    while (len > 0) {
+        uint32_t block_num = address / FILESYSTEM_BLOCK_SIZE;
+        size_t block_offset = address % FILESYSTEM_BLOCK_SIZE;
+        size_t chunk;
+        mp_uint_t result;
+        if (block_offset == 0 && len >= FILESYSTEM_BLOCK_SIZE) {
+            uint32_t num_blocks = len / FILESYSTEM_BLOCK_SIZE;
+            chunk = num_blocks * FILESYSTEM_BLOCK_SIZE;
+            if (write) {
+                result = supervisor_flash_write_blocks(buf, block_num, num_blocks);
+            } else {
+                result = supervisor_flash_read_blocks(buf, block_num, num_blocks);
+            }
+        } else {
+            // Partial block so go through a whole block copy.
+            uint8_t block[FILESYSTEM_BLOCK_SIZE];
+            chunk = MIN(len, FILESYSTEM_BLOCK_SIZE - block_offset);
+            result = supervisor_flash_read_blocks(block, block_num, 1);
+            if (result == 0 && write) {
+                memcpy(block + block_offset, buf, chunk);
+                result = supervisor_flash_write_blocks(block, block_num, 1);
+            } else if (result == 0) {
+                memcpy(buf, block + block_offset, chunk);
+            }
+        }
+        if (result != 0) {
+            return -MP_EIO;
+        }
+        address += chunk;
+        buf += chunk;
+        len -= chunk;
+    }
+    return 0;
+}
+
+static mp_obj_t saves_flash_transfer_obj(size_t n_args, const mp_obj_t *args, bool write) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[2], &bufinfo, write ? MP_BUFFER_READ : MP_BUFFER_WRITE);
+    uint32_t address = mp_obj_get_int(args[1]) * CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE;
+    if (n_args == 4) {
+        address += mp_obj_get_int(args[3]);
+    }
+    return MP_OBJ_NEW_SMALL_INT(saves_flash_transfer(address, bufinfo.buf, bufinfo.len, write));
+}
+
+static mp_obj_t supervisor_saves_flash_obj_readblocks(size_t n_args, const mp_obj_t *args) {
+    return saves_flash_transfer_obj(n_args, args, false);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_saves_flash_obj_readblocks_obj, 3, 4, supervisor_saves_flash_obj_readblocks);
+
+static mp_obj_t supervisor_saves_flash_obj_writeblocks(size_t n_args, const mp_obj_t *args) {
+    return saves_flash_transfer_obj(n_args, args, true);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(supervisor_saves_flash_obj_writeblocks_obj, 3, 4, supervisor_saves_flash_obj_writeblocks);
+
+static mp_obj_t supervisor_saves_flash_obj_ioctl(mp_obj_t self, mp_obj_t cmd_in, mp_obj_t arg_in) {
+    switch (mp_obj_get_int(cmd_in)) {
+        case MP_BLOCKDEV_IOCTL_INIT:
+            supervisor_flash_init();
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case MP_BLOCKDEV_IOCTL_DEINIT:
+        case MP_BLOCKDEV_IOCTL_SYNC:
+            supervisor_flash_flush();
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case MP_BLOCKDEV_IOCTL_BLOCK_COUNT:
+            return MP_OBJ_NEW_SMALL_INT(CIRCUITPY_SAVES_PARTITION_SIZE / CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE);
+        case MP_BLOCKDEV_IOCTL_BLOCK_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE);
+        case MP_BLOCKDEV_IOCTL_BLOCK_ERASE:
+            return MP_OBJ_NEW_SMALL_INT(0);
+        default:
+            return mp_const_none;
+    }
+}
+static MP_DEFINE_CONST_FUN_OBJ_3(supervisor_saves_flash_obj_ioctl_obj, supervisor_saves_flash_obj_ioctl);
+
+static const mp_rom_map_elem_t supervisor_saves_flash_obj_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&supervisor_saves_flash_obj_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&supervisor_saves_flash_obj_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&supervisor_saves_flash_obj_ioctl_obj) },
+};
+
+static MP_DEFINE_CONST_DICT(supervisor_saves_flash_obj_locals_dict, supervisor_saves_flash_obj_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    supervisor_saves_flash_type,
+    MP_QSTR_SavesFlash,
+    MP_TYPE_FLAG_NONE,
+    locals_dict, &supervisor_saves_flash_obj_locals_dict
+    );
+
+// littlefs looks for its superblock at the start of the first two blocks. Wiping both makes
+// the next mount format the partition.
+void supervisor_flash_saves_invalidate(void) {
+    uint8_t block[FILESYSTEM_BLOCK_SIZE];
+    memset(block, 0xff, sizeof(block));
+    for (uint32_t lfs_block = 0; lfs_block < 2; lfs_block++) {
+        saves_flash_transfer(lfs_block * CIRCUITPY_SAVES_LITTLEFS_BLOCK_SIZE, block, sizeof(block), true);
+    }
+    supervisor_flash_flush();
+}
+#endif
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 
 #include <string.h>
 
@@ -31,6 +32,10 @@ MP_WEAK void port_yield(void) {
 MP_WEAK void port_boot_info(void) {
 }
 
+MP_WEAK void port_run_split(port_split_fun_t fun, void *data, size_t count) {
+    fun(data, 0, count);
+}
+
 MP_WEAK void port_heap_init(void) {
     uint32_t *heap_bottom = port_heap_get_bottom();
     uint32_t *heap_top = port_heap_get_top();
@@ -66,6 +71,36 @@ MP_WEAK size_t port_heap_get_largest_free_size(void) {
     return tlsf_fit_size(heap, max_size);
 }
 
+static bool stats_walker(void *ptr, size_t size, int used, void *user) {
+    port_heap_stats_t *stats = (port_heap_stats_t *)user;
+    if (used) {
+        stats->used += size;
+    } else {
+        stats->free += size;
+        stats->free_blocks++;
+    }
+    return true;
+}
+
+void port_heap_add_tlsf_pool_stats(void *pool, port_heap_stats_t *stats) {
+    port_heap_stats_t pool_stats = { 0 };
+    tlsf_walk_pool(pool, stats_walker, &pool_stats);
+    stats->used += pool_stats.used;
+    stats->free += pool_stats.free;
+    stats->free_blocks += pool_stats.free_blocks;
+    // The walk doesn't see per-block headers or the pool's own overhead.
+    stats->total += pool_stats.used + pool_stats.free + tlsf_pool_overhead();
+}
+
+MP_WEAK void port_heap_get_stats(port_heap_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    port_heap_add_tlsf_pool_stats(tlsf_get_pool(heap), stats);
+}
+
+MP_WEAK bool port_ptr_in_external_ram(const void *ptr) {
+    return false;
+}
+
 MP_WEAK bool port_boot_button_pressed(void) {
     #if defined(CIRCUITPY_BOOT_BUTTON)
     // Init/deinit the boot button every time in case it is used for LEDs.
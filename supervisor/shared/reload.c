@@ -17,6 +17,9 @@
 // True if user has disabled autoreload.
 static bool autoreload_enabled = false;
 
+// Also sticky. Keeps WiFi started by user code connected between runs.
+static bool reload_keeps_wifi = false;
+
 // Non-zero if autoreload is temporarily off, due to an AUTORELOAD_SUSPEND_... reason.
 static uint32_t autoreload_suspended = 0;
 
@@ -60,6 +63,14 @@ inline bool autoreload_is_enabled(void) {
     return autoreload_enabled;
 }
 
+void reload_set_keep_wifi(bool keep) {
+    reload_keeps_wifi = keep;
+}
+
+bool reload_keep_wifi(void) {
+    return reload_keeps_wifi;
+}
+
 void autoreload_trigger(void) {
     if (!autoreload_enabled || autoreload_suspended != 0) {
         return;
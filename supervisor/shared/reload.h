@@ -33,6 +33,10 @@ void autoreload_enable(void);
 void autoreload_disable(void);
 bool autoreload_is_enabled(void);
 
+// Like autoreload enabled, this is only cleared by a hard reset.
+void reload_set_keep_wifi(bool keep);
+bool reload_keep_wifi(void);
+
 // Start the autoreload process.
 void autoreload_trigger(void);
 // True when the autoreload should occur. (A trigger happened and the delay has
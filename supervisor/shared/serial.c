@@ -7,10 +7,12 @@
 #include <stdarg.h>
 #include <string.h>
 
+#include "py/misc.h"
 #include "py/mpconfig.h"
 #include "py/mphal.h"
 #include "py/mpprint.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "shared-bindings/terminalio/Terminal.h"
@@ -66,6 +68,19 @@ static bool _serial_display_write_disabled;
 // Indicates that serial console has been early initialized.
 static bool _serial_console_early_inited = false;
 
+// Where output goes while it is being captured instead of written.
+static char *_capture_buf = NULL;
+static size_t _capture_len;
+static size_t _capture_used;
+
+#if CIRCUITPY_SERIAL_TX_BUFFER_SIZE > 0
+// Output waiting to be sent to every serial output at once.
+static char _tx_buf[CIRCUITPY_SERIAL_TX_BUFFER_SIZE];
+static size_t _tx_used;
+static bool _tx_flushing;
+static background_callback_t _tx_flush_callback;
+#endif
+
 #if CIRCUITPY_CONSOLE_UART
 
 // All output to the console uart comes through this inner write function. It ensures that all
@@ -273,6 +288,9 @@ bool serial_connected(void) {
 }
 
 char serial_read(void) {
+    // Make sure any prompt is visible before waiting on input.
+    serial_flush();
+
     #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VENDOR
     if (tud_vendor_connected() && tud_vendor_available() > 0) {
         char tiny_buffer;
@@ -335,6 +353,8 @@ char serial_read(void) {
 }
 
 uint32_t serial_bytes_available(void) {
+    serial_flush();
+
     // There may be multiple serial input channels, so sum the count from all.
     uint32_t count = 0;
 
@@ -377,14 +397,8 @@ uint32_t serial_bytes_available(void) {
     return count;
 }
 
-uint32_t serial_write_substring(const char *text, uint32_t length) {
-    if (length == 0) {
-        return 0;
-    }
-
-    // See https://github.com/micropython/micropython/pull/11850 for the motivation for returning
-    // the number of chars written.
-
+// Sends text to every enabled output.
+static uint32_t serial_write_through(const char *text, uint32_t length) {
     // Assume that unless otherwise reported, we sent all that we got.
     uint32_t length_sent = length;
 
@@ -451,22 +465,97 @@ uint32_t serial_write_substring(const char *text, uint32_t length) {
     return length_sent;
 }
 
+void serial_flush(void) {
+    #if CIRCUITPY_SERIAL_TX_BUFFER_SIZE > 0
+    if (_tx_used == 0 || _tx_flushing) {
+        return;
+    }
+    _tx_flushing = true;
+    serial_write_through(_tx_buf, _tx_used);
+    _tx_used = 0;
+    _tx_flushing = false;
+    #endif
+}
+
+#if CIRCUITPY_SERIAL_TX_BUFFER_SIZE > 0
+static void serial_flush_cb(void *data) {
+    (void)data;
+    serial_flush();
+}
+#endif
+
+uint32_t serial_write_substring(const char *text, uint32_t length) {
+    if (length == 0) {
+        return 0;
+    }
+
+    // See https://github.com/micropython/micropython/pull/11850 for the motivation for returning
+    // the number of chars written.
+
+    if (_capture_buf != NULL) {
+        size_t count = MIN(length, _capture_len - _capture_used);
+        memcpy(_capture_buf + _capture_used, text, count);
+        _capture_used += count;
+        return length;
+    }
+
+    #if CIRCUITPY_SERIAL_TX_BUFFER_SIZE > 0
+    // Interrupt handlers can't wait for the main loop to flush, and anything written while a
+    // flush is in progress must not land in the buffer that is being sent.
+    if (cpu_interrupt_active() || _tx_flushing) {
+        return serial_write_through(text, length);
+    }
+    if (length > sizeof(_tx_buf) - _tx_used) {
+        serial_flush();
+        if (length > sizeof(_tx_buf)) {
+            return serial_write_through(text, length);
+        }
+    }
+    memcpy(_tx_buf + _tx_used, text, length);
+    _tx_used += length;
+    // Lines go out whole. Partial lines go out the next time background tasks run.
+    if (memchr(text, '\n', length) != NULL) {
+        serial_flush();
+    } else {
+        background_callback_add(&_tx_flush_callback, serial_flush_cb, NULL);
+    }
+    return length;
+    #else
+    return serial_write_through(text, length);
+    #endif
+}
+
 void serial_write(const char *text) {
     serial_write_substring(text, strlen(text));
 }
 
 bool serial_console_write_disable(bool disabled) {
+    // Buffered output goes where it was headed when it was written.
+    serial_flush();
     bool now = _serial_console_write_disabled;
     _serial_console_write_disabled = disabled;
     return now;
 }
 
 bool serial_display_write_disable(bool disabled) {
+    serial_flush();
     bool now = _serial_display_write_disabled;
     _serial_display_write_disabled = disabled;
     return now;
 }
 
+void serial_capture_start(char *buf, size_t len) {
+    serial_flush();
+    _capture_buf = buf;
+    _capture_len = len;
+    _capture_used = 0;
+}
+
+size_t serial_capture_end(void) {
+    _capture_buf = NULL;
+    return _capture_used;
+}
+
 // A general purpose hex/ascii dump function for arbitrary area of memory.
 void print_hexdump(const mp_print_t *printer, const char *prefix, const uint8_t *buf, size_t len) {
     size_t i;
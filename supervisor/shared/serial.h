@@ -25,6 +25,9 @@ void serial_init(void);
 void serial_write(const char *text);
 // Only writes up to given length. Does not check for null termination at all.
 uint32_t serial_write_substring(const char *text, uint32_t length);
+// Send any buffered output now. Output is otherwise sent at each newline, when the buffer fills
+// and when background tasks run.
+void serial_flush(void);
 char serial_read(void);
 uint32_t serial_bytes_available(void);
 bool serial_connected(void);
@@ -33,6 +36,11 @@ bool serial_connected(void);
 bool serial_console_write_disable(bool disabled);
 bool serial_display_write_disable(bool disabled);
 
+// Collect all serial output into buf instead of writing it out. Output past len is dropped.
+void serial_capture_start(char *buf, size_t len);
+// Stop collecting and return the number of bytes collected.
+size_t serial_capture_end(void);
+
 // These have no-op versions that are weak and the port can override. They work
 // in tandem with the cross-port mechanics like USB and BLE.
 void port_serial_early_init(void);
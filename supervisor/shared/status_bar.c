@@ -5,13 +5,17 @@
 // SPDX-License-Identifier: MIT
 
 #include <stdbool.h>
+#include <string.h>
+
 #include "genhdr/mpversion.h"
 #include "py/mpconfig.h"
 #include "shared-bindings/supervisor/__init__.h"
 #include "shared-bindings/supervisor/StatusBar.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/port.h"
 #include "supervisor/shared/serial.h"
 #include "supervisor/shared/status_bar.h"
+#include "supervisor/shared/tick.h"
 
 #if CIRCUITPY_TERMINALIO
 #include "shared-module/terminalio/Terminal.h"
@@ -31,46 +35,40 @@
 
 static background_callback_t status_bar_background_cb;
 
+// Background updates closer together than this are held back and merged into one.
+#ifndef CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS
+#define CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS (250)
+#endif
+
+#define MIN_INTERVAL_TICKS (CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS * 1024 / 1000)
+
+// The OSC title can be up to 255 characters.
+#define STATUS_BAR_MAX_LEN (256)
+
 static bool _forced_dirty = false;
 static bool _suspended = false;
 
+// The last status written, so unchanged ones aren't sent again.
+static char _last_status[STATUS_BAR_MAX_LEN];
+static size_t _last_status_len = 0;
+static uint64_t _last_update_ticks = 0;
+// True while a held back update keeps the tick running.
+static volatile bool _update_deferred = false;
+
 // Clear if possible, but give up if we can't do it now.
 void supervisor_status_bar_clear(void) {
     if (!_suspended) {
         serial_write("\x1b" "]0;" "\x1b" "\\");
+        // Make sure the next update is sent.
+        _last_status_len = 0;
     }
 }
 
-void supervisor_status_bar_update(void) {
-    if (_suspended) {
-        supervisor_status_bar_request_update(true);
-        return;
-    }
-    _forced_dirty = false;
-
-    shared_module_supervisor_status_bar_updated(&shared_module_supervisor_status_bar_obj);
-
-    // Disable status bar console writes if supervisor.status_bar.console is False.
-    // Also disable if there is no serial connection now. This avoids sending part
-    // of the status bar update if the serial connection comes up during the update.
-    bool disable_console_writes =
-        !shared_module_supervisor_status_bar_get_console(&shared_module_supervisor_status_bar_obj) ||
-        !serial_connected();
-
-    // Disable status bar display writes if supervisor.status_bar.display is False.
-    bool disable_display_writes =
-        !shared_module_supervisor_status_bar_get_display(&shared_module_supervisor_status_bar_obj);
-
-    // Suppress writes to console and/or display if status bar is not enabled for either or both.
-    bool prev_console_disable = false;
-    bool prev_display_disable = false;
-
-    if (disable_console_writes) {
-        prev_console_disable = serial_console_write_disable(true);
-    }
-    if (disable_display_writes) {
-        prev_display_disable = serial_display_write_disable(true);
-    }
+// Render the whole status, including the OSC command, into buf and return its length.
+static size_t status_bar_render(char *buf, size_t len) {
+    const char terminator[] = "\x1b" "\\";
+    // Leave room for the string terminator even if the status gets cut off.
+    serial_capture_start(buf, len - (sizeof(terminator) - 1));
 
     // Neighboring "..." "..." are concatenated by the compiler. Without this separation, the hex code
     // doesn't get terminated after two following characters and the value is invalid.
@@ -96,8 +94,50 @@ void supervisor_status_bar_update(void) {
     supervisor_execution_status();
     serial_write(" | ");
     serial_write(MICROPY_GIT_TAG);
+
+    size_t used = serial_capture_end();
     // Send string terminator
-    serial_write("\x1b" "\\");
+    memcpy(buf + used, terminator, sizeof(terminator) - 1);
+    return used + sizeof(terminator) - 1;
+}
+
+// Write out the status if it changed or force is set.
+static void status_bar_write(bool force) {
+    shared_module_supervisor_status_bar_updated(&shared_module_supervisor_status_bar_obj);
+
+    char status[STATUS_BAR_MAX_LEN];
+    size_t len = status_bar_render(status, sizeof(status));
+    if (!force && len == _last_status_len && memcmp(status, _last_status, len) == 0) {
+        return;
+    }
+    memcpy(_last_status, status, len);
+    _last_status_len = len;
+    _last_update_ticks = port_get_raw_ticks(NULL);
+
+    // Disable status bar console writes if supervisor.status_bar.console is False.
+    // Also disable if there is no serial connection now. This avoids sending part
+    // of the status bar update if the serial connection comes up during the update.
+    bool disable_console_writes =
+        !shared_module_supervisor_status_bar_get_console(&shared_module_supervisor_status_bar_obj) ||
+        !serial_connected();
+
+    // Disable status bar display writes if supervisor.status_bar.display is False.
+    bool disable_display_writes =
+        !shared_module_supervisor_status_bar_get_display(&shared_module_supervisor_status_bar_obj);
+
+    // Suppress writes to console and/or display if status bar is not enabled for either or both.
+    bool prev_console_disable = false;
+    bool prev_display_disable = false;
+
+    if (disable_console_writes) {
+        prev_console_disable = serial_console_write_disable(true);
+    }
+    if (disable_display_writes) {
+        prev_display_disable = serial_display_write_disable(true);
+    }
+
+    // One write for the whole status keeps the console and display transfers together.
+    serial_write_substring(status, len);
 
     // Restore writes to console and/or display.
     if (disable_console_writes) {
@@ -106,7 +146,30 @@ void supervisor_status_bar_update(void) {
     if (disable_display_writes) {
         serial_display_write_disable(prev_display_disable);
     }
+}
 
+static void set_update_deferred(bool deferred) {
+    if (deferred == _update_deferred) {
+        return;
+    }
+    _update_deferred = deferred;
+    if (deferred) {
+        supervisor_enable_deadline_tick();
+    } else {
+        supervisor_disable_deadline_tick();
+    }
+}
+
+void supervisor_status_bar_update(void) {
+    if (_suspended) {
+        supervisor_status_bar_request_update(true);
+        return;
+    }
+    _forced_dirty = false;
+    set_update_deferred(false);
+
+    // Always write because this is also used when the console or display has just been enabled.
+    status_bar_write(true);
 }
 
 static void status_bar_background(void *data) {
@@ -123,8 +186,34 @@ static void status_bar_background(void *data) {
     dirty = dirty || supervisor_bluetooth_status_dirty();
     #endif
 
-    if (dirty) {
-        supervisor_status_bar_update();
+    if (!dirty) {
+        set_update_deferred(false);
+        return;
+    }
+
+    // Hold back updates that come too quickly. supervisor_status_bar_tick() brings us back.
+    if (port_get_raw_ticks(NULL) - _last_update_ticks < MIN_INTERVAL_TICKS) {
+        set_update_deferred(true);
+        return;
+    }
+    set_update_deferred(false);
+
+    // A forced update is for a new listener, so send it even if nothing changed.
+    bool force = _forced_dirty;
+    _forced_dirty = false;
+    status_bar_write(force);
+}
+
+uint64_t supervisor_status_bar_next_update_ticks(void) {
+    if (!_update_deferred) {
+        return UINT64_MAX;
+    }
+    return _last_update_ticks + MIN_INTERVAL_TICKS;
+}
+
+void supervisor_status_bar_tick(void) {
+    if (_update_deferred && port_get_raw_ticks(NULL) >= supervisor_status_bar_next_update_ticks()) {
+        background_callback_add_core(&status_bar_background_cb);
     }
 }
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 void supervisor_status_bar_init(void);
 
@@ -21,8 +22,14 @@ void supervisor_status_bar_clear(void);
 void supervisor_status_bar_update(void);
 
 // Use this if requesting from the background, as code is executing or if the status may not have
-// changed.
+// changed. The status is only sent when it differs from the last one unless force_dirty is set, and
+// requests that come too quickly are merged into one.
 void supervisor_status_bar_request_update(bool force_dirty);
 
+// Called from supervisor_tick() to send an update that was held back by the rate limit.
+void supervisor_status_bar_tick(void);
+// Raw tick when a held back update is due or UINT64_MAX if there isn't one.
+uint64_t supervisor_status_bar_next_update_ticks(void);
+
 // Provided by main.c
 void supervisor_execution_status(void);
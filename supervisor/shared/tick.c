@@ -27,8 +27,20 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/__init__.h"
+#endif
+
+#if CIRCUITPY_STATUS_BAR
+#include "supervisor/shared/status_bar.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
+#if CIRCUITPY_WEB_WORKFLOW
+#include "supervisor/shared/web_workflow/websocket.h"
+#endif
+
 #if CIRCUITPY_WATCHDOG
 #include "shared-bindings/watchdog/__init__.h"
 #define WATCHDOG_EXCEPTION_CHECK() (MP_STATE_VM(mp_pending_exception) == &mp_watchdog_timeout_exception)
@@ -44,6 +56,9 @@ static volatile uint64_t last_finished_tick = 0;
 
 static volatile size_t tick_enable_count = 0;
 
+// How many of tick_enable_count can tell us when they next need a tick.
+static volatile size_t deadline_tick_enable_count = 0;
+
 static void supervisor_background_tick(void *unused) {
     port_start_background_tick();
 
@@ -59,6 +74,10 @@ static void supervisor_background_tick(void *unused) {
 
     filesystem_background();
 
+    #if CIRCUITPY_WEB_WORKFLOW
+    websocket_background_tick();
+    #endif
+
     port_background_tick();
 
     assert_heap_ok();
@@ -82,6 +101,14 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    #if CIRCUITPY_PROFILER
+    profiler_tick();
+    #endif
+
+    #if CIRCUITPY_STATUS_BAR
+    supervisor_status_bar_tick();
+    #endif
+
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -103,6 +130,43 @@ uint32_t supervisor_ticks_ms32(void) {
     return supervisor_ticks_ms64();
 }
 
+// Raw tick of the next deadline of the deadline tick users.
+static uint64_t next_tick_deadline(void) {
+    uint64_t deadline = UINT64_MAX;
+    #if CIRCUITPY_KEYPAD
+    deadline = MIN(deadline, keypad_next_scan_ticks());
+    #endif
+    #if CIRCUITPY_STATUS_BAR
+    deadline = MIN(deadline, supervisor_status_bar_next_update_ticks());
+    #endif
+    return deadline;
+}
+
+// Stops the tick when every tick user has a deadline. Returns true if the tick was stopped and
+// *deadline was set to the earliest one.
+static bool suspend_tick(uint64_t *deadline) {
+    common_hal_mcu_disable_interrupts();
+    bool suspend = tick_enable_count > 0 && tick_enable_count == deadline_tick_enable_count;
+    if (suspend) {
+        port_disable_tick();
+    }
+    common_hal_mcu_enable_interrupts();
+    if (suspend) {
+        *deadline = next_tick_deadline();
+    }
+    return suspend;
+}
+
+static void resume_tick(void) {
+    common_hal_mcu_disable_interrupts();
+    if (tick_enable_count > 0) {
+        port_enable_tick();
+    }
+    common_hal_mcu_enable_interrupts();
+    // Catch up on whatever the skipped ticks would have done.
+    supervisor_tick();
+}
+
 void mp_hal_delay_ms(mp_uint_t delay_ms) {
     uint64_t start_subtick = _get_raw_subticks();
     // Convert delay from ms to subticks
@@ -123,9 +187,20 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         // If remaining delay is less than 1 tick, idle loop until end of delay
         int64_t remaining_ticks = remaining / 32;
         if (remaining_ticks > 0) {
-            port_interrupt_after_ticks(remaining_ticks);
-            // Idle until an interrupt happens.
-            port_idle_until_interrupt();
+            uint64_t deadline;
+            bool suspended = suspend_tick(&deadline);
+            if (suspended) {
+                uint64_t now = port_get_raw_ticks(NULL);
+                remaining_ticks = deadline <= now ? 0 : MIN((uint64_t)remaining_ticks, deadline - now);
+            }
+            if (remaining_ticks > 0) {
+                port_interrupt_after_ticks(remaining_ticks);
+                // Idle until an interrupt happens.
+                port_idle_until_interrupt();
+            }
+            if (suspended) {
+                resume_tick();
+            }
         }
         remaining = end_subtick - _get_raw_subticks();
     }
@@ -150,3 +225,19 @@ void supervisor_disable_tick(void) {
     }
     common_hal_mcu_enable_interrupts();
 }
+
+void supervisor_enable_deadline_tick(void) {
+    common_hal_mcu_disable_interrupts();
+    deadline_tick_enable_count++;
+    common_hal_mcu_enable_interrupts();
+    supervisor_enable_tick();
+}
+
+void supervisor_disable_deadline_tick(void) {
+    common_hal_mcu_disable_interrupts();
+    if (deadline_tick_enable_count > 0) {
+        deadline_tick_enable_count--;
+    }
+    common_hal_mcu_enable_interrupts();
+    supervisor_disable_tick();
+}
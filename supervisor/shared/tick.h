@@ -36,6 +36,15 @@ extern uint64_t supervisor_ticks_ms64(void);
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+/** @brief Request ticks only until the next deadline reported to the supervisor
+ *
+ * Users that can say when they next need a tick, such as keypad scanners, use these
+ * instead of supervisor_enable_tick(). When every tick user is one of these,
+ * mp_hal_delay_ms() stops the tick and sleeps until the earliest deadline.
+ */
+extern void supervisor_enable_deadline_tick(void);
+extern void supervisor_disable_deadline_tick(void);
+
 /**
  * @brief Return true if tick-based background tasks ran within the last 1s
  *
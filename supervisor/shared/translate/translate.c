@@ -66,53 +66,82 @@ uint16_t decompress_length(mp_rom_error_text_t compressed) {
     #endif
 }
 
+// Decode up to 8 bits of Huffman code at a time with huffman_lookup.
+#ifndef CIRCUITPY_TRANSLATE_LOOKUP
+#define CIRCUITPY_TRANSLATE_LOOKUP (0)
+#endif
+
 typedef struct {
     const uint8_t *ptr;
-    uint8_t bit;
+    // The low nbits bits haven't been used yet.
+    uint32_t bits;
+    uint8_t nbits;
 } bitstream_state_t;
 
-static bool next_bit(bitstream_state_t *st) {
-    bool r = *st->ptr & st->bit;
-    st->bit >>= 1;
-    if (!st->bit) {
-        st->bit = 0x80;
-        st->ptr++;
+// Bytes are only read once some of their bits are needed so nothing past the end of the string is
+// touched.
+static void need_bits(bitstream_state_t *st, uint8_t n) {
+    while (st->nbits < n) {
+        st->bits = (st->bits << 8) | *st->ptr++;
+        st->nbits += 8;
     }
-    return r;
 }
 
-static int get_nbits(bitstream_state_t *st, int n) {
-    int r = 0;
-    while (n--) {
-        r = (r << 1) | next_bit(st);
+static int get_nbits(bitstream_state_t *st, uint8_t n) {
+    need_bits(st, n);
+    st->nbits -= n;
+    return (st->bits >> st->nbits) & ((1 << n) - 1);
+}
+
+static int get_value(bitstream_state_t *st) {
+    #if CIRCUITPY_TRANSLATE_LOOKUP
+    while (true) {
+        // Missing bits are filled with zeros. A code that fits in the bits we do have is the same
+        // whatever the rest turn out to be.
+        uint32_t window = st->nbits >= 8 ? st->bits >> (st->nbits - 8) : st->bits << (8 - st->nbits);
+        uint16_t entry = huffman_lookup[window & 0xff];
+        uint8_t length = entry & 0xf;
+        if (length != 0 && length <= st->nbits) {
+            st->nbits -= length;
+            return values[entry >> 4];
+        }
+        if (st->nbits >= 8) {
+            // The code is longer than the table.
+            break;
+        }
+        need_bits(st, st->nbits + 1);
     }
-    return r;
+    #endif
+    uint32_t bits = 0;
+    uint8_t bit_length = 0;
+    uint32_t max_code = lengths[0];
+    uint32_t searched_length = lengths[0];
+    while (true) {
+        bits = (bits << 1) | get_nbits(st, 1);
+        bit_length += 1;
+        if (max_code > 0 && bits < max_code) {
+            break;
+        }
+        max_code = (max_code << 1) + lengths[bit_length];
+        searched_length += lengths[bit_length];
+    }
+    return values[searched_length + bits - max_code];
 }
 
 // note: the vstr must be a fixed-buffer vstr that matches the decompressed length of the string
 static void decompress_vstr(mp_rom_error_text_t compressed, vstr_t *decompressed) {
     bitstream_state_t b = {
         .ptr = &(compressed->data) + (compress_max_length_bits >> 3),
-        .bit = 1 << (7 - ((compress_max_length_bits) & 0x7)),
     };
+    // Skip the rest of the length.
+    if (compress_max_length_bits & 0x7) {
+        get_nbits(&b, compress_max_length_bits & 0x7);
+    }
 
     size_t alloc = decompressed->alloc - 1;
     // Stop one early because the last byte is always NULL.
     for (; decompressed->len < alloc;) {
-        uint32_t bits = 0;
-        uint8_t bit_length = 0;
-        uint32_t max_code = lengths[0];
-        uint32_t searched_length = lengths[0];
-        while (true) {
-            bits = (bits << 1) | next_bit(&b);
-            bit_length += 1;
-            if (max_code > 0 && bits < max_code) {
-                break;
-            }
-            max_code = (max_code << 1) + lengths[bit_length];
-            searched_length += lengths[bit_length];
-        }
-        int v = values[searched_length + bits - max_code];
+        int v = get_value(&b);
         if (v == 1) {
             qstr q = get_nbits(&b, translation_qstr_bits) + 1; // honestly no idea why "+1"...
             vstr_add_str(decompressed, qstr_str(q));
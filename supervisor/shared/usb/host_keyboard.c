@@ -157,7 +157,7 @@ static void send_bufn_core(const char *buf, size_t n) {
     for (; n--; buf++) {
         int code = *buf;
         if (code == mp_interrupt_char) {
-            ringbuf_clear(&_incoming_ringbuf);
+            ringbuf_request_clear(&_incoming_ringbuf);
             mp_sched_keyboard_interrupt();
             continue;
         }
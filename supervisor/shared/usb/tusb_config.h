@@ -113,12 +113,39 @@ extern "C" {
 #define CFG_TUD_CDC                 1
 #endif
 
+#if CIRCUITPY_USB_CDC_RX_BUFSIZE
+#define CFG_TUD_CDC_RX_BUFSIZE      CIRCUITPY_USB_CDC_RX_BUFSIZE
+#endif
+#if CIRCUITPY_USB_CDC_TX_BUFSIZE
+#define CFG_TUD_CDC_TX_BUFSIZE      CIRCUITPY_USB_CDC_TX_BUFSIZE
+#endif
+
 #define CFG_TUD_MSC                 CIRCUITPY_USB_MSC
 #define CFG_TUD_HID                 CIRCUITPY_USB_HID
 #define CFG_TUD_MIDI                CIRCUITPY_USB_MIDI
 #define CFG_TUD_VENDOR              CIRCUITPY_USB_VENDOR
 #define CFG_TUD_CUSTOM_CLASS        0
 
+#if CIRCUITPY_USB_AUDIO
+// One UAC2 headset function: 16 bit stereo out to the device and 16 bit mono in to the host.
+#define USB_AUDIO_MAX_SAMPLE_RATE   48000
+#define CFG_TUD_AUDIO               1
+#define CFG_TUD_AUDIO_FUNC_1_DESC_LEN (TUD_AUDIO_DESC_IAD_LEN + TUD_AUDIO_DESC_STD_AC_LEN + TUD_AUDIO_DESC_CS_AC_LEN + \
+    TUD_AUDIO_DESC_CLK_SRC_LEN + TUD_AUDIO_DESC_INPUT_TERM_LEN + TUD_AUDIO_DESC_FEATURE_UNIT_TWO_CHANNEL_LEN + \
+    TUD_AUDIO_DESC_OUTPUT_TERM_LEN + TUD_AUDIO_DESC_INPUT_TERM_LEN + TUD_AUDIO_DESC_OUTPUT_TERM_LEN + \
+    2 * (2 * TUD_AUDIO_DESC_STD_AS_INT_LEN + TUD_AUDIO_DESC_CS_AS_INT_LEN + TUD_AUDIO_DESC_TYPE_I_FORMAT_LEN + \
+    TUD_AUDIO_DESC_STD_AS_ISO_EP_LEN + TUD_AUDIO_DESC_CS_AS_ISO_EP_LEN))
+#define CFG_TUD_AUDIO_FUNC_1_N_AS_INT 2
+#define CFG_TUD_AUDIO_FUNC_1_CTRL_BUF_SZ 64
+#define CFG_TUD_AUDIO_ENABLE_EP_OUT 1
+// One frame more than a millisecond at the maximum rate, for hosts whose clock runs fast.
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX ((USB_AUDIO_MAX_SAMPLE_RATE / 1000 + 1) * 2 * 2)
+#define CFG_TUD_AUDIO_FUNC_1_EP_OUT_SW_BUF_SZ (16 * CFG_TUD_AUDIO_FUNC_1_EP_OUT_SZ_MAX)
+#define CFG_TUD_AUDIO_ENABLE_EP_IN  1
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX ((USB_AUDIO_MAX_SAMPLE_RATE / 1000 + 1) * 2)
+#define CFG_TUD_AUDIO_FUNC_1_EP_IN_SW_BUF_SZ (8 * CFG_TUD_AUDIO_FUNC_1_EP_IN_SZ_MAX)
+#endif
+
 /*------------------------------------------------------------------*/
 /* CLASS DRIVER
  *------------------------------------------------------------------*/
@@ -38,6 +38,10 @@
 #include "shared-module/usb_video/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_AUDIO
+#include "shared-module/usb_audio/__init__.h"
+#endif
+
 #endif
 
 #include "tusb.h"
@@ -162,6 +166,10 @@ void usb_set_defaults(void) {
     #if CIRCUITPY_USB_MIDI
     usb_midi_set_defaults();
     #endif
+
+    #if CIRCUITPY_USB_AUDIO
+    usb_audio_set_defaults();
+    #endif
     #endif
 };
 
@@ -175,6 +183,10 @@ void usb_setup_with_vm(void) {
     #if CIRCUITPY_USB_MIDI
     usb_midi_setup_ports();
     #endif
+
+    #if CIRCUITPY_USB_AUDIO
+    usb_audio_setup();
+    #endif
     #endif
 }
 
@@ -200,6 +212,9 @@ void usb_background(void) {
         #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_VIDEO
         usb_video_task();
         #endif
+        #if CIRCUITPY_USB_DEVICE && CIRCUITPY_USB_AUDIO
+        usb_audio_task();
+        #endif
     }
 }
 
@@ -21,7 +21,11 @@
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
-#if CIRCUITPY_SAVES_PARTITION_SIZE > 0
+// Not handled by TinyUSB itself so it comes to tud_msc_scsi_cb().
+#define MSC_SCSI_CMD_SYNCHRONIZE_CACHE_10 (0x35)
+
+// A littlefs SAVES partition isn't FAT so it isn't shared over USB.
+#if CIRCUITPY_SAVES_PARTITION_SIZE > 0 && !CIRCUITPY_SAVES_LITTLEFS
 #define SAVES_COUNT 1
 #define SAVES_LUN (1)
 #else
@@ -203,6 +207,20 @@ int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void *buffer, u
             resplen = 0;
             break;
 
+        case MSC_SCSI_CMD_SYNCHRONIZE_CACHE_10: {
+            // Writes are held in the block device's cache until the host goes quiet. Write them
+            // back now because the host asked.
+            fs_user_mount_t *vfs = get_vfs(lun);
+            if (vfs == NULL || disk_ioctl(vfs, CTRL_SYNC, NULL) != RES_OK) {
+                // Set Sense = Medium Error, Write Fault
+                tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x03, 0x00);
+                resplen = -1;
+            } else {
+                resplen = 0;
+            }
+            break;
+        }
+
         default:
             // Set Sense = Invalid Command Operation
             tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
@@ -277,6 +295,9 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     (void)lun;
     (void)offset;
     autoreload_suspend(AUTORELOAD_SUSPEND_USB);
+    // Don't flush in the middle of a copy. The flush would write back and erase sectors that the
+    // next writes are likely to change again.
+    filesystem_defer_flush();
 
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
@@ -13,6 +13,7 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
 #include "genhdr/mpversion.h"
+#include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 
@@ -21,7 +22,9 @@
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #include "supervisor/shared/web_workflow/websocket.h"
 #include "supervisor/shared/workflow.h"
@@ -50,6 +53,14 @@
 #include "shared-module/os/__init__.h"
 #endif
 
+#if CIRCUITPY_PROFILER
+#include "shared-module/profiler/SamplingProfiler.h"
+#endif
+
+#if CIRCUITPY_ZLIB
+#include "shared-bindings/zlib/CompressIO.h"
+#endif
+
 enum request_state {
     STATE_METHOD,
     STATE_PATH,
@@ -77,8 +88,17 @@ typedef struct {
     bool authenticated;
     bool expect;
     bool json;
+    // The client accepts gzip Content-Encoding.
+    bool gzip;
     bool websocket;
     bool new_socket;
+    // The client asked for the connection to be closed after this request.
+    bool close;
+    // The whole body has been read so the next request starts right after it.
+    bool body_consumed;
+    // Waiting on a persistent connection for the client's next request since idle_start_ms.
+    bool keep_alive;
+    uint64_t idle_start_ms;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
@@ -736,37 +756,130 @@ static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *req
     _send_chunk(socket, "");
 }
 
-static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+// A multiple of the FAT sector size that covers a few TCP segments.
+#ifndef FILE_BUFFER_SIZE
+#define FILE_BUFFER_SIZE (2048)
+#endif
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
-    mp_print_t _socket_print = {socket, _print_raw};
-    mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+// Returns the text type of the file or NULL when it should be sent as plain bytes.
+static const char *_text_content_type(const char *filename) {
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
-        _send_strs(socket, "Content-Type:", "text/plain", ";charset=UTF-8\r\n", NULL);
+        return "text/plain";
     } else if (_endswith(filename, ".js")) {
-        _send_strs(socket, "Content-Type:", "text/javascript", ";charset=UTF-8\r\n", NULL);
+        return "text/javascript";
     } else if (_endswith(filename, ".html")) {
-        _send_strs(socket, "Content-Type:", "text/html", ";charset=UTF-8\r\n", NULL);
+        return "text/html";
     } else if (_endswith(filename, ".json")) {
-        _send_strs(socket, "Content-Type:", "application/json", ";charset=UTF-8\r\n", NULL);
+        return "application/json";
+    }
+    return NULL;
+}
+
+#if CIRCUITPY_ZLIB
+// A small window keeps the compressor to a few kilobytes while still finding the repeats within
+// source files.
+#define FILE_COMPRESS_WINDOW_BITS (9)
+#define FILE_COMPRESS_READ_SIZE (512)
+
+static void _send_compressed_chunk(void *socket, const uint8_t *buf, size_t len) {
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "%X\r\n", len);
+    web_workflow_send_raw(socket, false, buf, len);
+    web_workflow_send_raw(socket, false, (const uint8_t *)"\r\n", 2);
+}
+
+// Returns false without sending anything when there isn't memory for the compressor.
+static bool _reply_with_compressed_file(socketpool_socket_obj_t *socket, _request *request, const char *content_type, FIL *active_file) {
+    size_t scratch_size = common_hal_zlib_compressio_scratch_size(FILE_COMPRESS_WINDOW_BITS);
+    zlib_compressio_obj_t *compressor = port_malloc(sizeof(zlib_compressio_obj_t) + scratch_size + FILE_COMPRESS_READ_SIZE, false);
+    if (compressor == NULL) {
+        return false;
+    }
+    uint8_t *scratch = (uint8_t *)(compressor + 1);
+    uint8_t *data_buffer = scratch + scratch_size;
+
+    _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    // The compressed length isn't known until the end so it is sent in chunks.
+    _send_str(socket, "Content-Encoding: gzip\r\n");
+    _send_str(socket, "Transfer-Encoding: chunked\r\n");
+    _send_strs(socket, "Content-Type:", content_type, ";charset=UTF-8\r\n", NULL);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+
+    zlib_compressio_init_with_sink(compressor, _send_compressed_chunk, socket,
+        ZLIB_COMPRESSIO_FORMAT_GZIP, FILE_COMPRESS_WINDOW_BITS, 16, scratch);
+    uint32_t total_length = f_size(active_file);
+    uint32_t total_read = 0;
+    while (total_read < total_length && common_hal_socketpool_socket_get_connected(socket)) {
+        UINT quantity_read;
+        FRESULT res = f_read(active_file, data_buffer, FILE_COMPRESS_READ_SIZE, &quantity_read);
+        if (res != FR_OK || quantity_read == 0) {
+            break;
+        }
+        total_read += quantity_read;
+        common_hal_zlib_compressio_write(compressor, data_buffer, quantity_read);
+    }
+    bool complete = total_read == total_length;
+    if (complete) {
+        common_hal_zlib_compressio_close(compressor);
+        _send_chunk(socket, "");
+    }
+    port_free(compressor);
+    // Without the last chunk the client can tell the response was cut short.
+    if (!complete) {
+        socketpool_socket_close(socket);
+    }
+    return true;
+}
+#endif
+
+static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
+    const char *content_type = _text_content_type(filename);
+    #if CIRCUITPY_ZLIB
+    // Only text shrinks enough to be worth compressing on the fly.
+    if (request->gzip && content_type != NULL &&
+        _reply_with_compressed_file(socket, request, content_type, active_file)) {
+        return;
+    }
+    #endif
+
+    uint32_t total_length = f_size(active_file);
+
+    _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
+    if (content_type != NULL) {
+        _send_strs(socket, "Content-Type:", content_type, ";charset=UTF-8\r\n", NULL);
     } else {
         _send_strs(socket, "Content-Type:", "application/octet-stream\r\n", NULL);
     }
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
+    // Reads of whole sectors go straight from FatFs into the buffer and each send fills
+    // several TCP segments. Fall back to a small stack buffer when the port heap is full.
+    uint8_t small_buffer[64];
+    size_t buffer_size = FILE_BUFFER_SIZE;
+    uint8_t *data_buffer = port_malloc(buffer_size, false);
+    if (data_buffer == NULL) {
+        data_buffer = small_buffer;
+        buffer_size = sizeof(small_buffer);
+    }
+
     uint32_t total_read = 0;
     int nodelay_ok = -1;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
+    bool send_failed = false;
+    while (total_read < total_length && !send_failed) {
+        UINT quantity_read;
+        FRESULT res = f_read(active_file, data_buffer, buffer_size, &quantity_read);
+        if (res != FR_OK || quantity_read == 0) {
+            break;
+        }
         total_read += quantity_read;
-        // When getting near the end of the file, disable Nagle's combining algorithm so that
+        // Before sending the end of the file, disable Nagle's combining algorithm so that
         // data is sent immediately.
-        if (total_length - total_read < 64) {
+        if (total_read == total_length) {
             int nodelay = 1;
             // Returns 0 when it works.
             nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
@@ -778,13 +891,17 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
                 if (sent == -MP_EAGAIN) {
                     sent = 0;
                 } else {
+                    send_failed = true;
                     break;
                 }
             }
             send_offset += sent;
         }
     }
-    if (total_read < total_length) {
+    if (data_buffer != small_buffer) {
+        port_free(data_buffer);
+    }
+    if (total_read < total_length || send_failed) {
         socketpool_socket_close(socket);
     }
 
@@ -850,7 +967,7 @@ static void _reply_with_version_json(socketpool_socket_obj_t *socket, _request *
     _update_encoded_ip();
     // Note: this leverages the fact that C concats consecutive string literals together.
     mp_printf(&_socket_print,
-        "{\"web_api_version\": 4, "
+        "{\"web_api_version\": 6, "
         "\"version\": \"" MICROPY_GIT_TAG "\", "
         "\"build_date\": \"" MICROPY_BUILD_DATE "\", "
         "\"board_name\": \"%s\", "
@@ -925,6 +1042,77 @@ static void _reply_with_diskinfo_json(socketpool_socket_obj_t *socket, _request
     _send_chunk(socket, "");
 }
 
+#if MICROPY_GC_STATS
+// mp_printf can't print 64 bit numbers everywhere.
+static void _print_uint64(const mp_print_t *print, uint64_t value) {
+    if (value >= 1000000000) {
+        mp_printf(print, "%u%09u", (mp_uint_t)(value / 1000000000), (mp_uint_t)(value % 1000000000));
+    } else {
+        mp_printf(print, "%u", (mp_uint_t)value);
+    }
+}
+
+static void _reply_with_gc_json(socketpool_socket_obj_t *socket, _request *request) {
+    _send_str(socket, OK_JSON);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    gc_stats_t stats;
+    gc_stats(&stats);
+    mp_printf(&_socket_print, "{\"collections\": %u, \"pause_total_us\": ", stats.collections);
+    _print_uint64(&_socket_print, stats.pause_total_us);
+    mp_printf(&_socket_print, ", \"pause_max_us\": %u, \"bytes_allocated\": ", stats.pause_max_us);
+    _print_uint64(&_socket_print, stats.bytes_allocated);
+    _send_chunk(socket, ", \"allocs\": [");
+    for (size_t i = 0; i < MICROPY_GC_STATS_SIZE_CLASSES; i++) {
+        mp_printf(&_socket_print, i > 0 ? ", %u" : "%u", stats.allocs[i]);
+    }
+    mp_printf(&_socket_print,
+        "], "
+        "\"largest_free\": %u, "
+        "\"largest_free_min\": %u}", stats.largest_free, stats.largest_free_min);
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
+#if CIRCUITPY_PROFILER
+static void _reply_with_profile_json(socketpool_socket_obj_t *socket, _request *request) {
+    _send_str(socket, OK_JSON);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    profiler_samplingprofiler_obj_t *profiler = profiler_samplingprofiler_get_running();
+    if (profiler == NULL) {
+        _send_chunk(socket, "{\"running\": false, \"rate\": 0, \"dropped\": 0, \"lines\": []}");
+        _send_chunk(socket, "");
+        return;
+    }
+    profiler_samplingprofiler_count_samples(profiler);
+    mp_printf(&_socket_print, "{\"running\": true, \"rate\": %u, \"dropped\": %u, \"lines\": [",
+        1024 / profiler->interval, profiler->dropped + profiler->overruns);
+    bool first = true;
+    for (size_t i = 0; i < profiler->slots; i++) {
+        const profiler_samplingprofiler_entry_t *entry = &profiler->entries[i];
+        if (entry->samples == 0) {
+            continue;
+        }
+        if (entry->source_file == MP_QSTRnull) {
+            _send_chunk(socket, first ? "{\"file\": null, " : ", {\"file\": null, ");
+        } else {
+            _send_chunks(socket, first ? "{" : ", {", "\"file\": \"", qstr_str(entry->source_file), "\", ", NULL);
+        }
+        mp_printf(&_socket_print, "\"line\": %u, \"samples\": %u}", entry->line, entry->samples);
+        first = false;
+    }
+    _send_chunk(socket, "]}");
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
 
 // FATFS has a two second timestamp resolution but the BLE API allows for nanosecond resolution.
 // This function truncates the time the time to a resolution storable by FATFS and fills in the
@@ -940,7 +1128,7 @@ static uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
     return truncated_time;
 }
 
-static void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
+static void _discard_incoming(socketpool_socket_obj_t *socket, _request *request, size_t amount) {
     size_t discarded = 0;
     while (discarded < amount) {
         uint8_t bytes[64];
@@ -954,13 +1142,14 @@ static void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
         }
         discarded += len;
     }
+    request->body_consumed = discarded == amount;
 }
 
 static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *request, fs_user_mount_t *fs_mount, const TCHAR *path) {
     FIL active_file;
 
     if (!filesystem_lock(fs_mount)) {
-        _discard_incoming(socket, request->content_length);
+        _discard_incoming(socket, request, request->content_length);
         _reply_conflict(socket, request);
         return;
     }
@@ -984,14 +1173,14 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     if (result == FR_NO_PATH) {
         override_fattime(0);
         filesystem_unlock(fs_mount);
-        _discard_incoming(socket, request->content_length);
+        _discard_incoming(socket, request, request->content_length);
         _reply_missing(socket, request);
         return;
     }
     if (result != FR_OK) {
         override_fattime(0);
         filesystem_unlock(fs_mount);
-        _discard_incoming(socket, request->content_length);
+        _discard_incoming(socket, request, request->content_length);
         _reply_server_error(socket, request);
         return;
     }
@@ -1015,7 +1204,7 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
         if (request->expect) {
             _reply_expectation_failed(socket, request);
         } else {
-            _discard_incoming(socket, request->content_length);
+            _discard_incoming(socket, request, request->content_length);
             _reply_payload_too_large(socket, request);
         }
         return;
@@ -1049,10 +1238,11 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
 
     f_close(&active_file);
     filesystem_unlock(fs_mount);
+    request->body_consumed = !error;
 
     override_fattime(0);
     if (error) {
-        _discard_incoming(socket, request->content_length - total_read);
+        _discard_incoming(socket, request, request->content_length - total_read);
         _reply_server_error(socket, request);
     } else if (new_file) {
         _reply_created(socket, request);
@@ -1341,6 +1531,14 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             _reply_with_version_json(socket, request);
         } else if (strcmp(path, "/diskinfo.json") == 0) {
             _reply_with_diskinfo_json(socket, request);
+        #if MICROPY_GC_STATS
+        } else if (strcmp(path, "/gc.json") == 0) {
+            _reply_with_gc_json(socket, request);
+        #endif
+        #if CIRCUITPY_PROFILER
+        } else if (strcmp(path, "/profile.json") == 0) {
+            _reply_with_profile_json(socket, request);
+        #endif
         } else if (strcmp(path, "/serial/") == 0) {
             if (!request->authenticated) {
                 if (_api_password[0] != '\0') {
@@ -1398,7 +1596,11 @@ static void _reset_request(_request *request) {
     request->authenticated = false;
     request->expect = false;
     request->json = false;
+    request->gzip = false;
     request->websocket = false;
+    request->close = false;
+    request->body_consumed = false;
+    request->keep_alive = false;
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
@@ -1422,6 +1624,7 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
             autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
             request->in_progress = true;
             request->new_socket = false;
+            request->keep_alive = false;
         }
         switch (request->state) {
             case STATE_METHOD: {
@@ -1504,6 +1707,8 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         request->expect = strcmp(request->header_value, "100-continue") == 0;
                     } else if (strcasecmp(request->header_key, "Accept") == 0) {
                         request->json = strcasecmp(request->header_value, "application/json") == 0;
+                    } else if (strcasecmp(request->header_key, "Accept-Encoding") == 0) {
+                        request->gzip = strstr(request->header_value, "gzip") != NULL;
                     } else if (strcasecmp(request->header_key, "Origin") == 0) {
                         strncpy(request->origin, request->header_value, sizeof(request->origin) - 1);
                         request->origin[sizeof(request->origin) - 1] = '\0';
@@ -1518,6 +1723,8 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                         strcpy(request->websocket_key, request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->close = strcasecmp(request->header_value, "close") == 0;
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1545,14 +1752,28 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         return;
     }
     bool reload = _reply(socket, request);
+    // HTTP/1.1 connections persist unless the request said otherwise. Only keep ones where
+    // the whole body was read, so that any pipelined request after it parses cleanly.
+    // Redirects say "Connection: close" and websockets have already been handed off.
+    bool keep_alive = !error && !request->close && !request->redirect && !request->websocket &&
+        (request->content_length == 0 || request->body_consumed) &&
+        common_hal_socketpool_socket_get_connected(socket);
     _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
+    if (keep_alive) {
+        request->keep_alive = true;
+        request->idle_start_ms = supervisor_ticks_ms64();
+    } else {
+        common_hal_socketpool_socket_close(socket);
+    }
     autoreload_resume(AUTORELOAD_SUSPEND_WEB);
     if (reload) {
         autoreload_trigger();
     }
 }
 
+// How long an idle persistent connection is kept while others may be waiting to connect.
+#define KEEP_ALIVE_TIMEOUT_MS (2000)
+
 static bool supervisor_filesystem_access_could_block(void) {
     #if CIRCUITPY_FOURWIRE
     mp_vfs_mount_t *vfs = MP_STATE_VM(vfs_mount_table);
@@ -1586,6 +1807,13 @@ void supervisor_web_workflow_background(void *data) {
             if (active_request.in_progress) {
                 break;
             }
+            // Give a persistent connection a little while to send its next request before
+            // making way for other clients.
+            if (active_request.keep_alive &&
+                common_hal_socketpool_socket_get_connected(&active) &&
+                supervisor_ticks_ms64() - active_request.idle_start_ms < KEEP_ALIVE_TIMEOUT_MS) {
+                break;
+            }
         } else {
             // Close the active socket if necessary
             if (!common_hal_socketpool_socket_get_closed(&active)) {
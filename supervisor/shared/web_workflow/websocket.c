@@ -6,10 +6,13 @@
 
 #include "supervisor/shared/web_workflow/websocket.h"
 
+#include <string.h>
+
 #include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/socketpool/SocketPool.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 
 #if CIRCUITPY_STATUS_BAR
@@ -34,6 +37,18 @@ static uint8_t _buf[16];
 // make sure background is not called recursively
 static bool in_web_background = false;
 
+// Console output is collected into frames of up to this many bytes because the console writes
+// a line or even a character at a time.
+#ifndef WEBSOCKET_OUTGOING_BUFFER_SIZE
+#define WEBSOCKET_OUTGOING_BUFFER_SIZE (1024)
+#endif
+// Output waits at most this long for more to share its frame.
+#define WEBSOCKET_FLUSH_MS (10)
+
+static uint8_t _outgoing[WEBSOCKET_OUTGOING_BUFFER_SIZE];
+static size_t _outgoing_len = 0;
+static uint64_t _outgoing_start_ms;
+
 static _websocket cp_serial;
 
 void websocket_init(void) {
@@ -47,6 +62,12 @@ void websocket_handoff(socketpool_socket_obj_t *socket) {
         common_hal_socketpool_socket_close(&cp_serial.socket);
     }
 
+    // Output for the old client is dropped.
+    if (_outgoing_len > 0) {
+        _outgoing_len = 0;
+        supervisor_disable_tick();
+    }
+
     socketpool_socket_move(socket, &cp_serial.socket);
     cp_serial.opcode = 0;
     cp_serial.frame_index = 0;
@@ -141,23 +162,28 @@ static void _read_next_frame_header(void) {
     }
 }
 
-static bool _read_next_payload_byte(uint8_t *c) {
+// Reads up to len bytes of text payload, unmasked. Returns how many were read.
+static size_t _read_next_payload(uint8_t *buf, size_t len) {
     _read_next_frame_header();
-    if (cp_serial.opcode == 0x1 &&
-        cp_serial.frame_index >= cp_serial.frame_len &&
-        cp_serial.payload_remaining > 0) {
-        if (_read_byte(c)) {
-            uint8_t mask_offset = (cp_serial.frame_index - cp_serial.frame_len) % 4;
-            *c ^= cp_serial.mask[mask_offset];
-            cp_serial.frame_index++;
-            cp_serial.payload_remaining--;
-            if (cp_serial.payload_remaining == 0) {
-                cp_serial.frame_index = 0;
-            }
-            return true;
-        }
+    if (cp_serial.opcode != 0x1 ||
+        cp_serial.frame_index < cp_serial.frame_len ||
+        cp_serial.payload_remaining == 0) {
+        return 0;
+    }
+    int read = socketpool_socket_recv_into(&cp_serial.socket, buf, MIN(len, cp_serial.payload_remaining));
+    if (read < 1) {
+        return 0;
+    }
+    for (int i = 0; i < read; i++) {
+        uint8_t mask_offset = (cp_serial.frame_index - cp_serial.frame_len) % 4;
+        buf[i] ^= cp_serial.mask[mask_offset];
+        cp_serial.frame_index++;
     }
-    return false;
+    cp_serial.payload_remaining -= read;
+    if (cp_serial.payload_remaining == 0) {
+        cp_serial.frame_index = 0;
+    }
+    return read;
 }
 
 uint32_t websocket_available(void) {
@@ -208,11 +234,45 @@ static void _websocket_send(_websocket *ws, const char *text, size_t len) {
         extended_len[3] = len & 0xff;
         web_workflow_send_raw(&ws->socket, false, extended_len, 4);
     }
-    web_workflow_send_raw(&ws->socket, false, (const uint8_t *)text, len);
+    // Frames are already as large as they get so send them right away.
+    web_workflow_send_raw(&ws->socket, true, (const uint8_t *)text, len);
+}
+
+static void _flush_outgoing(void) {
+    if (_outgoing_len == 0) {
+        return;
+    }
+    _websocket_send(&cp_serial, (const char *)_outgoing, _outgoing_len);
+    _outgoing_len = 0;
+    supervisor_disable_tick();
 }
 
 void websocket_write(const char *text, size_t len) {
-    _websocket_send(&cp_serial, text, len);
+    if (!websocket_connected()) {
+        return;
+    }
+    while (len > 0) {
+        if (_outgoing_len == 0) {
+            _outgoing_start_ms = supervisor_ticks_ms64();
+            // Keep the background tick running so the frame is sent even if nothing else is.
+            supervisor_enable_tick();
+        }
+        size_t n = MIN(len, sizeof(_outgoing) - _outgoing_len);
+        memcpy(_outgoing + _outgoing_len, text, n);
+        _outgoing_len += n;
+        text += n;
+        len -= n;
+        if (_outgoing_len == sizeof(_outgoing)) {
+            _flush_outgoing();
+        }
+    }
+}
+
+void websocket_background_tick(void) {
+    if (_outgoing_len > 0 &&
+        supervisor_ticks_ms64() - _outgoing_start_ms >= WEBSOCKET_FLUSH_MS) {
+        _flush_outgoing();
+    }
 }
 
 void websocket_background(void) {
@@ -223,15 +283,19 @@ void websocket_background(void) {
         return;
     }
     in_web_background = true;
-    uint8_t c;
+    websocket_background_tick();
+    uint8_t incoming[sizeof(_buf)];
+    size_t read;
     while (ringbuf_num_empty(&_incoming_ringbuf) > 0 &&
-           _read_next_payload_byte(&c)) {
-        if (c == mp_interrupt_char) {
-            ringbuf_clear(&_incoming_ringbuf);
-            mp_sched_keyboard_interrupt();
-            continue;
+           (read = _read_next_payload(incoming, ringbuf_num_empty(&_incoming_ringbuf))) > 0) {
+        for (size_t i = 0; i < read; i++) {
+            if (incoming[i] == mp_interrupt_char) {
+                ringbuf_request_clear(&_incoming_ringbuf);
+                mp_sched_keyboard_interrupt();
+                continue;
+            }
+            ringbuf_put(&_incoming_ringbuf, incoming[i]);
         }
-        ringbuf_put(&_incoming_ringbuf, c);
     }
     in_web_background = false;
 }
@@ -17,4 +17,7 @@ bool websocket_connected(void);
 uint32_t websocket_available(void);
 char websocket_read_char(void);
 void websocket_background(void);
+// Output is buffered and sent once it fills a frame or has waited a little while.
 void websocket_write(const char *text, size_t len);
+// Sends buffered output that has waited long enough.
+void websocket_background_tick(void);
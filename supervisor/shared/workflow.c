@@ -34,6 +34,14 @@
 static background_callback_t workflow_background_cb = {NULL, NULL};
 #endif
 
+#if CIRCUITPY_FAST_WAKE && CIRCUITPY_ALARM
+#include "shared-bindings/alarm/__init__.h"
+// Set while a deep sleep wake holds off the web workflow.
+static bool web_workflow_deferred = false;
+#else
+#define web_workflow_deferred (false)
+#endif
+
 
 // Called during a VM reset. Doesn't actually reset things.
 void supervisor_workflow_reset(void) {
@@ -42,6 +50,9 @@ void supervisor_workflow_reset(void) {
     #endif
 
     #if CIRCUITPY_WEB_WORKFLOW
+    if (web_workflow_deferred) {
+        return;
+    }
     bool result = supervisor_start_web_workflow();
     if (workflow_background_cb.fun) {
         if (result) {
@@ -51,6 +62,20 @@ void supervisor_workflow_reset(void) {
     #endif
 }
 
+void supervisor_workflow_start_deferred(void) {
+    #if CIRCUITPY_WEB_WORKFLOW && CIRCUITPY_FAST_WAKE && CIRCUITPY_ALARM
+    if (!web_workflow_deferred) {
+        return;
+    }
+    web_workflow_deferred = false;
+    if (supervisor_start_web_workflow()) {
+        memset(&workflow_background_cb, 0, sizeof(workflow_background_cb));
+        workflow_background_cb.fun = supervisor_web_workflow_background;
+        supervisor_workflow_request_background();
+    }
+    #endif
+}
+
 void supervisor_workflow_request_background(void) {
     #if CIRCUITPY_WEB_WORKFLOW
     if (workflow_background_cb.fun) {
@@ -104,6 +129,13 @@ void supervisor_workflow_start(void) {
     #endif
 
     #if CIRCUITPY_WEB_WORKFLOW
+    #if CIRCUITPY_FAST_WAKE && CIRCUITPY_ALARM
+    // A sensor that wakes, samples and sleeps again never needs the web workflow, so don't pay for
+    // bringing up the network until code.py stays awake.
+    if (common_hal_alarm_woken_from_sleep()) {
+        web_workflow_deferred = true;
+    } else
+    #endif
     if (supervisor_start_web_workflow()) {
         // Enable background callbacks if web_workflow startup successful
         memset(&workflow_background_cb, 0, sizeof(workflow_background_cb));
@@ -102,6 +102,12 @@ ifneq ($(wildcard supervisor/serial.c),)
   SRC_SUPERVISOR += supervisor/serial.c
 endif
 
+ifeq ($(CIRCUITPY_BOOT_TRACE),1)
+  SRC_SUPERVISOR += \
+    supervisor/shared/boot_trace.c \
+
+endif
+
 ifeq ($(CIRCUITPY_STATUS_BAR),1)
   SRC_SUPERVISOR += \
     supervisor/shared/status_bar.c \
@@ -125,6 +131,18 @@ ifeq ($(CIRCUITPY_TINYUSB),1)
 
   endif
 
+  ifeq ($(CIRCUITPY_USB_AUDIO), 1)
+    SRC_SUPERVISOR += \
+      lib/tinyusb/src/class/audio/audio_device.c \
+      shared-bindings/usb_audio/__init__.c \
+      shared-bindings/usb_audio/Microphone.c \
+      shared-bindings/usb_audio/Speaker.c \
+      shared-module/usb_audio/__init__.c \
+      shared-module/usb_audio/Microphone.c \
+      shared-module/usb_audio/Speaker.c \
+
+  endif
+
   ifeq ($(CIRCUITPY_USB_CDC), 1)
     SRC_SUPERVISOR += \
       shared-bindings/usb_cdc/__init__.c \
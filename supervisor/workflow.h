@@ -14,3 +14,6 @@ bool supervisor_workflow_active(void);
 void supervisor_workflow_request_background(void);
 
 void supervisor_workflow_start(void);
+
+// Starts whatever supervisor_workflow_start() held off for a fast wake from deep sleep.
+void supervisor_workflow_start_deferred(void);
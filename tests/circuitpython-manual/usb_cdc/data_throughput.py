@@ -0,0 +1,30 @@
+# Measures how fast usb_cdc.data can send to the host.
+#
+# Enable the data channel in boot.py with:
+#     import usb_cdc
+#     usb_cdc.enable(console=True, data=True)
+#
+# Then run this as code.py and read everything from the second serial port on the host, e.g.
+#     cat /dev/ttyACM1 > /dev/null
+# The rate is printed to the console every few seconds.
+import time
+import usb_cdc
+
+CHUNK_SIZE = 4096
+REPORT_SECONDS = 5
+
+serial = usb_cdc.data
+chunk = memoryview(bytearray(range(256)) * (CHUNK_SIZE // 256))
+
+while not serial.connected:
+    time.sleep(0.1)
+
+sent = 0
+start = time.monotonic_ns()
+while True:
+    sent += serial.write(chunk)
+    elapsed = time.monotonic_ns() - start
+    if elapsed >= REPORT_SECONDS * 1_000_000_000:
+        print(f"{sent * 1_000_000_000 // elapsed // 1024} KiB/s")
+        sent = 0
+        start = time.monotonic_ns()
@@ -0,0 +1,35 @@
+# Audio buffers are filled in the background, so producing one must not allocate. get_buffer()
+# allocates its own copy of the buffer, so each sample is compared with a RawSample.
+import array
+import gc
+
+try:
+    gc.alloc_count
+    from audiocore import RawSample, get_buffer
+except (AttributeError, ImportError):
+    print("SKIP")
+    raise SystemExit
+
+import audiomixer
+import synthio
+
+
+def get_buffer_allocs(sample):
+    # The first call settles any caches.
+    get_buffer(sample)
+    before = gc.alloc_count()
+    get_buffer(sample)
+    return gc.alloc_count() - before
+
+
+raw = RawSample(array.array("h", [0] * 1000), sample_rate=8000)
+baseline = get_buffer_allocs(raw)
+
+synth = synthio.Synthesizer(sample_rate=8000)
+synth.press((60, 64, 67))
+print("synthio", get_buffer_allocs(synth) - baseline)
+
+mixer = audiomixer.Mixer(voice_count=2, channel_count=1, sample_rate=8000)
+mixer.voice[0].play(raw, loop=True)
+mixer.voice[1].play(raw, loop=True)
+print("mixer", get_buffer_allocs(mixer) - baseline)
@@ -0,0 +1,50 @@
+# Drawing into a bitmap that already exists must not allocate.
+import gc
+
+try:
+    gc.alloc_count
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+import bitmaptools
+import displayio
+
+
+def allocs(f):
+    # The first call settles any caches.
+    f()
+    before = gc.alloc_count()
+    f()
+    return gc.alloc_count() - before
+
+
+source = displayio.Bitmap(32, 32, 256)
+dest = displayio.Bitmap(32, 32, 256)
+
+
+# Keyword arguments would make the calling frame too big for the C stack, and then calling blit()
+# itself would allocate.
+def blit():
+    bitmaptools.blit(dest, source, 0, 0, 4, 4, 20, 20)
+
+
+def fill_region():
+    bitmaptools.fill_region(dest, 2, 2, 30, 30, 7)
+
+
+def draw_line():
+    bitmaptools.draw_line(dest, 0, 0, 31, 20, 3)
+
+
+def bitmap_fill():
+    dest.fill(1)
+
+
+for name, f in (
+    ("blit", blit),
+    ("fill_region", fill_region),
+    ("draw_line", draw_line),
+    ("fill", bitmap_fill),
+):
+    print(name, allocs(f))
@@ -0,0 +1,47 @@
+# Test the arrayops module on each element type.
+
+import array
+import arrayops
+
+a = array.array("h", [1, -2, 3, -4, 5])
+print(arrayops.sum(a))
+print(arrayops.minmax(a))
+print(arrayops.dot(a, a))
+print(arrayops.crossings(a, 0))
+
+# Integer math saturates and float gains round to the nearest value.
+b = array.array("h", [100, -100, 20000])
+arrayops.scale(b, 2, 1)
+print(list(b))
+c = array.array("B", [10, 20, 200])
+arrayops.scale(c, 1.5)
+print(list(c))
+
+# Smoothing in place.
+d = array.array("i", [1, 2, 3, 4, 5, 6])
+n = arrayops.moving_average(d, d, 3)
+print(n, list(d[:n]))
+
+f = array.array("f", [0.5, -1.5, 2.0])
+print(arrayops.sum(f))
+print(arrayops.minmax(f))
+print(arrayops.dot(f, f))
+print(arrayops.crossings(f, 0.0))
+
+print(arrayops.sum(b"\x01\x02\xff"))
+print(arrayops.minmax(bytearray(b"\x05\x01\x09")))
+print(arrayops.crossings(array.array("H", [1, 2, 3, 2, 1]), 2.5))
+print(arrayops.sum(array.array("I", [0xFFFFFFFF, 0xFFFFFFFF])))
+
+try:
+    arrayops.minmax(array.array("h"))
+except ValueError as e:
+    print("ValueError", e)
+try:
+    arrayops.dot(a, array.array("i", [1, 2, 3, 4, 5]))
+except ValueError as e:
+    print("ValueError", e)
+try:
+    arrayops.sum(array.array("d", [1.0]))
+except ValueError as e:
+    print("ValueError", e)
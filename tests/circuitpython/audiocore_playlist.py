@@ -0,0 +1,68 @@
+import array
+from audiocore import Playlist, RawSample, get_buffer, reset_buffer
+
+
+def raw(values, typecode="h", **kwargs):
+    return RawSample(array.array(typecode, values), sample_rate=8000, **kwargs)
+
+
+def drain(playlist):
+    while True:
+        result, buf = get_buffer(playlist)
+        print(result, list(buf))
+        if result != 1:
+            break
+
+
+a = raw([1, 2, 3])
+b = raw([0x80, 0x81], "B")
+
+# Samples follow each other within one buffer, converted to signed 16 bit.
+playlist = Playlist((a, b), sample_rate=8000, buffer_size=16)
+print(playlist.queued, playlist.current is a)
+drain(playlist)
+print(playlist.queued, playlist.current)
+
+# Buffers are filled across sample boundaries.
+playlist = Playlist((a, a, a), sample_rate=8000, buffer_size=8)
+drain(playlist)
+
+# A crossfade delays the output and mixes the tail of one sample into the next.
+playlist = Playlist(
+    (raw([8000] * 4), raw([-8000] * 6)), sample_rate=8000, crossfade=0.0005, buffer_size=32
+)
+drain(playlist)
+
+# Continuous playlists play silence when empty and pick up appended samples.
+playlist = Playlist(sample_rate=8000, continuous=True, buffer_size=8)
+print(*(list(x) if isinstance(x, memoryview) else x for x in get_buffer(playlist)))
+playlist.append(a)
+print(*(list(x) if isinstance(x, memoryview) else x for x in get_buffer(playlist)))
+print(*(list(x) if isinstance(x, memoryview) else x for x in get_buffer(playlist)))
+
+# skip and clear.
+playlist = Playlist((a, raw([7, 8])), sample_rate=8000, buffer_size=16)
+playlist.skip()
+print(playlist.queued)
+drain(playlist)
+playlist.append(a)
+playlist.clear()
+print(playlist.queued, playlist.current)
+drain(playlist)
+
+# Restarting plays the current sample from the beginning.
+playlist = Playlist((a,), sample_rate=8000, buffer_size=4)
+print(*(list(x) if isinstance(x, memoryview) else x for x in get_buffer(playlist)))
+reset_buffer(playlist)
+print(*(list(x) if isinstance(x, memoryview) else x for x in get_buffer(playlist)))
+
+for kwargs in ({"sample_rate": 16000}, {"sample_rate": 8000, "channel_count": 2}):
+    try:
+        Playlist((a,), **kwargs)
+    except ValueError as e:
+        print(e)
+
+try:
+    Playlist(sample_rate=8000, crossfade=2)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,35 @@
+import array
+from audiocore import RawSample, Resampler, get_buffer, reset_buffer
+
+ramp = RawSample(array.array("h", [i * 1000 for i in range(8)]), sample_rate=8000)
+
+
+def show(sample):
+    reset_buffer(sample)
+    print(sample.sample_rate, sample.channel_count, sample.bits_per_sample)
+    result, buf = get_buffer(sample)
+    print(result, list(buf))
+
+
+# Linear interpolation doubles every frame.
+show(Resampler(ramp, sample_rate=16000, buffer_size=64))
+
+# Downsampling skips every other frame.
+show(Resampler(ramp, sample_rate=4000, buffer_size=64))
+
+# Mono is copied to both channels.
+show(Resampler(ramp, sample_rate=8000, channel_count=2, buffer_size=64))
+
+# Unsigned 8 bit stereo is averaged down to signed 16 bit mono.
+stereo8 = RawSample(array.array("B", [0x80, 0x90, 0xA0, 0xC0]), channel_count=2, sample_rate=8000)
+show(Resampler(stereo8, sample_rate=8000, channel_count=1, buffer_size=64))
+
+# A windowed sinc keeps DC unchanged.
+dc = RawSample(array.array("h", [10000] * 32), sample_rate=8000)
+result, buf = get_buffer(Resampler(dc, sample_rate=11025, filter_taps=8, buffer_size=64))
+print(result, list(buf)[4:12])
+
+try:
+    Resampler(ramp, sample_rate=8000, filter_taps=3)
+except ValueError as e:
+    print(e)
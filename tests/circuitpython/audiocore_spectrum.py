@@ -0,0 +1,33 @@
+import array
+import math
+from audiocore import RawSample, Spectrum, get_buffer, reset_buffer
+
+# A full scale sine centered on bin 8 of a 64 point FFT.
+sine = array.array("h", [int(32767 * math.sin(2 * math.pi * 8 * i / 64)) for i in range(128)])
+sample = RawSample(sine, sample_rate=8000)
+spectrum = Spectrum(sample, fft_size=64)
+print(spectrum.sample_rate, spectrum.channel_count, spectrum.bits_per_sample, spectrum.fft_size)
+
+bins = memoryview(spectrum)
+print(len(bins), spectrum.updates, max(bins))
+
+# Buffers pass through unchanged.
+reset_buffer(spectrum)
+result, buf = get_buffer(spectrum)
+print(result, list(buf) == list(sine))
+print(spectrum.updates)
+peak = max(range(len(bins)), key=lambda i: bins[i])
+print(peak, bins[peak] // 100, bins[peak - 1] // 100, bins[peak + 1] // 100, max(bins[12:]) < 10)
+
+# Silence in stereo unsigned 8 bit.
+quiet = RawSample(array.array("B", [0x80] * 64), channel_count=2, sample_rate=8000)
+spectrum = Spectrum(quiet, fft_size=16)
+reset_buffer(spectrum)
+get_buffer(spectrum)
+print(spectrum.updates, list(memoryview(spectrum)))
+
+for size in (8, 100, 2048):
+    try:
+        Spectrum(sample, fft_size=size)
+    except ValueError as e:
+        print(e)
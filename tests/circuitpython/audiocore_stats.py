@@ -0,0 +1,18 @@
+import array
+import audiocore
+
+sample = audiocore.RawSample(array.array("h", [0] * 100), sample_rate=8000)
+audiocore.reset_stats(sample)
+print(audiocore.sample_stats(sample)["calls"])
+
+audiocore.get_buffer(sample)
+audiocore.get_buffer(sample)
+stats = audiocore.sample_stats(sample)
+print(stats["calls"], stats["max_length"])
+print(stats["max_us"] <= stats["total_us"])
+
+# Nothing is playing so no output has reported anything.
+print(sorted(audiocore.stats().items()))
+
+audiocore.reset_stats(sample)
+print(sorted(audiocore.sample_stats(sample).items()))
@@ -0,0 +1,65 @@
+import array
+import os
+import struct
+from audiocore import WaveFile, get_buffer, reset_buffer
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * 512)
+
+    def readblocks(self, block, buf):
+        start = block * 512
+        buf[:] = self.data[start : start + len(buf)]
+
+    def writeblocks(self, block, buf):
+        start = block * 512
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:
+            return len(self.data) // 512
+        if op == 5:
+            return 512
+
+
+bdev = RAMBlockDevice(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ram")
+
+n = 3000
+data = array.array("h", range(n))
+with open("/ram/ramp.wav", "wb") as f:
+    f.write(b"RIFF" + struct.pack("<I", 36 + 2 * n) + b"WAVEfmt ")
+    f.write(struct.pack("<IHHIIHH", 16, 1, 1, 8000, 16000, 2, 16))
+    f.write(b"data" + struct.pack("<I", 2 * n))
+    f.write(data)
+
+
+def play(wave):
+    reset_buffer(wave)
+    samples = []
+    lengths = []
+    while True:
+        result, buf = get_buffer(wave)
+        samples.extend(buf)
+        lengths.append(len(buf))
+        if result != 1:
+            return samples == list(data), lengths
+
+
+for buffer_count in (2, 4, 8):
+    for buffer in (None, bytearray(1024 * buffer_count)):
+        wave = WaveFile("/ram/ramp.wav", buffer, buffer_count=buffer_count)
+        first = play(wave)
+        # Restarting partway through must drop anything that was read ahead.
+        for i in range(3):
+            get_buffer(wave)
+        print(buffer_count, buffer is not None, first, play(wave) == first)
+
+try:
+    WaveFile("/ram/ramp.wav", buffer_count=9)
+except ValueError as e:
+    print(e)
+
+os.umount("/ram")
@@ -0,0 +1,32 @@
+import array
+import audiocore
+import audiofreeverb
+
+
+def render(channel_count, compact):
+    s = array.array(
+        "h",
+        [
+            (i // channel_count * 977) % 20000 - 10000 if i < 300 * channel_count else 0
+            for i in range(256 * channel_count)
+        ],
+    )
+    wave = audiocore.RawSample(s, channel_count=channel_count, sample_rate=8000)
+    fv = audiofreeverb.Freeverb(
+        channel_count=channel_count, sample_rate=8000, buffer_size=512, compact=compact
+    )
+    print(fv.compact)
+    fv.play(wave, loop=True)
+    result = []
+    for _ in range(12):
+        _, buffer = audiocore.get_buffer(fv)
+        result.extend(buffer)
+    return result
+
+
+for compact in (False, True):
+    mono = render(1, compact)
+    stereo = render(2, compact)
+    # Each stereo channel has its own filters so with the same input it matches mono
+    print(stereo[0::2] == mono[: len(stereo) // 2], stereo[1::2] == mono[: len(stereo) // 2])
+    print(max(mono), min(mono))
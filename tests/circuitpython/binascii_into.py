@@ -0,0 +1,61 @@
+# Test the binascii functions that write into a given buffer.
+
+import binascii
+
+data = bytes(range(200, 256)) + b"hello"
+encoded = binascii.b2a_base64(data)
+
+buf = bytearray(100)
+n = binascii.b2a_base64_into(data, buf)
+print(n, buf[:n] == encoded)
+n = binascii.b2a_base64_into(b"ab", buf, newline=False)
+print(n, buf[:n])
+print(binascii.b2a_base64_into(b"", buf, newline=False))
+
+n = binascii.a2b_base64_into(encoded, buf)
+print(n, buf[:n] == data)
+
+# In place, from a memoryview slice of the received data.
+buf = bytearray(b"--" + encoded)
+n = binascii.a2b_base64_into(memoryview(buf)[2:], buf)
+print(n, buf[:n] == data)
+buf = bytearray(b"aGVsbG8=")
+print(binascii.a2b_base64_into(buf, buf), buf)
+
+buf = bytearray(16)
+n = binascii.hexlify_into(b"\x01\xab\xff", buf)
+print(n, buf[:n])
+# The data in the buffer, hexlified in place.
+buf = bytearray(b"\x12\x34\x56\x00\x00\x00")
+print(binascii.hexlify_into(memoryview(buf)[:3], buf), buf)
+n = binascii.unhexlify_into(b"01 ab ff", buf)
+print(n, buf[:n])
+buf = bytearray(b"48656c6c6f")
+n = binascii.unhexlify_into(buf, buf)
+print(n, buf[:n])
+
+for f, d, size in (
+    (binascii.b2a_base64_into, b"abc", 4),
+    (binascii.a2b_base64_into, b"aGVsbG8=", 4),
+    (binascii.hexlify_into, b"abc", 5),
+    (binascii.unhexlify_into, b"616263", 2),
+):
+    try:
+        f(d, bytearray(size))
+    except ValueError as e:
+        print("ValueError", e)
+
+buf = bytearray(b"abc" + b"\0" * 8)
+try:
+    binascii.b2a_base64_into(memoryview(buf)[:3], buf)
+except ValueError as e:
+    print("ValueError", e)
+for f in (binascii.a2b_base64_into, binascii.unhexlify_into):
+    try:
+        f(b"00", b"xx")
+    except TypeError:
+        print("TypeError")
+try:
+    binascii.a2b_base64_into(b"aGVsbG8", bytearray(8))
+except ValueError as e:
+    print("ValueError", e)
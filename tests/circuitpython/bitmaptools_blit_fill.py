@@ -0,0 +1,30 @@
+import displayio
+import bitmaptools
+
+
+def dump(bmp):
+    for y in range(bmp.height):
+        print(" ".join("%x" % bmp[x, y] for x in range(bmp.width)))
+    print()
+
+
+for value_count in (4, 256, 65536):
+    print("value_count", value_count)
+    dest = displayio.Bitmap(6, 4, value_count)
+    bitmaptools.fill_region(dest, 1, 1, 5, 3, value_count - 1)
+    dump(dest)
+
+    src = displayio.Bitmap(3, 3, value_count)
+    for i in range(9):
+        src[i] = i % value_count
+    # Clipped on the right and bottom.
+    bitmaptools.blit(dest, src, 4, 2)
+    dump(dest)
+
+    # Overlapping copy within the same bitmap, down and to the right.
+    bitmaptools.blit(dest, dest, 1, 1, x1=0, y1=0, x2=4, y2=3)
+    dump(dest)
+
+    # Skipping a source index uses the per-pixel path.
+    bitmaptools.blit(dest, src, 3, 0, skip_source_index=0)
+    dump(dest)
@@ -0,0 +1,152 @@
+# Test instances of classes with __slots__, which keep their attributes in a fixed array.
+
+
+class Reading:
+    __slots__ = ("sensor", "value")
+
+    def __init__(self, sensor, value):
+        self.sensor = sensor
+        self.value = value
+
+    def scaled(self, factor):
+        return self.value * factor
+
+
+r = Reading("temp", 21)
+print(r.sensor, r.value, r.scaled(2))
+r.value += 1
+print(r.value)
+
+try:
+    r.other = 1
+except AttributeError:
+    print("AttributeError store")
+
+try:
+    r.__dict__
+except AttributeError:
+    print("AttributeError __dict__")
+
+# Deleted and never set slots aren't there.
+del r.value
+print(hasattr(r, "value"), getattr(r, "value", "unset"))
+try:
+    r.value
+except AttributeError:
+    print("AttributeError load")
+try:
+    del r.value
+except AttributeError:
+    print("AttributeError delete")
+r.value = 5
+print(r.value)
+
+
+# A single name.
+class One:
+    __slots__ = "x"
+
+
+o = One()
+print(hasattr(o, "x"))
+o.x = [1]
+print(o.x)
+
+
+# Subclasses add to the slots of their base.
+class Reading3(Reading):
+    __slots__ = ["unit"]
+
+    def __init__(self, sensor, value, unit):
+        super().__init__(sensor, value)
+        self.unit = unit
+
+
+r3 = Reading3("temp", 20, "C")
+print(r3.sensor, r3.value, r3.unit, r3.scaled(3))
+try:
+    r3.other = 1
+except AttributeError:
+    print("AttributeError subclass")
+
+
+# A subclass without __slots__ gets a dict.
+class Loose(Reading):
+    pass
+
+
+loose = Loose("light", 3)
+loose.other = 4
+print(loose.sensor, loose.value, loose.other)
+
+
+# So does naming __dict__.
+class WithDict:
+    __slots__ = ("a", "__dict__")
+
+
+w = WithDict()
+w.a = 1
+w.b = 2
+print(w.a, w.b)
+
+
+# Class attributes, methods and properties still work.
+class Point:
+    __slots__ = ("x", "y")
+    origin = "origin"
+
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    @property
+    def total(self):
+        return self.x + self.y
+
+    @total.setter
+    def total(self, value):
+        self.x = value - self.y
+
+
+p = Point(2, 3)
+print(p.origin, p.total)
+p.total = 10
+print(p.x, p.y)
+
+setattr(p, "y", 7)
+print(getattr(p, "y"))
+delattr(p, "y")
+print(hasattr(p, "y"))
+object.__setattr__(p, "y", 8)
+print(p.y)
+try:
+    object.__setattr__(p, "z", 1)
+except AttributeError:
+    print("AttributeError object.__setattr__")
+
+
+# Many instances, accessed in a loop.
+points = [Point(i, -i) for i in range(100)]
+total = 0
+for point in points:
+    total += point.x * point.x + point.y
+print(total)
+
+
+class Empty:
+    __slots__ = ()
+
+
+try:
+    Empty().a = 1
+except AttributeError:
+    print("AttributeError empty")
+
+try:
+
+    class Bad:
+        __slots__ = (1,)
+
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,26 @@
+# Test compiling files a batch of top-level statements at a time.
+
+# Enough statements for many batches, with names used across them.
+src = "from micropython import const\n_K = const(7)\nran = []\n"
+for i in range(200):
+    src += "def f{0}(x):\n    return x + {0} + _K + later\nran.append({0})\n".format(i)
+src += "later = 1000\n"
+
+g = {}
+exec(src, g)
+print(len(g["ran"]), g["ran"][:3], g["ran"][-1])
+print(g["f0"](1), g["f199"](1))
+print("_K" in g)
+
+# A syntax error at the end of the file stops the start from running.
+g = {}
+try:
+    exec(src + "x = = 1\n", g)
+except SyntaxError:
+    print("SyntaxError")
+print("ran" in g)
+
+# Files with no statements.
+for src in ("", "\n", "# comment\n\n"):
+    exec(src, {})
+print("empty")
@@ -0,0 +1,54 @@
+# Dicts of constants given to const() are built by the compiler and can't be changed.
+from micropython import const
+
+_SIZES = const({"small": 8, "large": 16, 3: (1, 2), 4: b"k", 1.5: {"nested": True}})
+PUBLIC = const({1: "one", 2: "two"})
+EMPTY = const({})
+
+
+def sizes():
+    return _SIZES
+
+
+print(_SIZES["small"], _SIZES[3], _SIZES[4], _SIZES[1.5]["nested"])
+print(len(_SIZES), "large" in _SIZES, "medium" in _SIZES)
+print(sorted(PUBLIC.items()), EMPTY, len(EMPTY))
+# Every use is the same object.
+print(sizes() is sizes())
+
+for name, op in (
+    ("setitem", lambda: PUBLIC.__setitem__(3, "three")),
+    ("delitem", lambda: PUBLIC.__delitem__(1)),
+    ("pop", lambda: PUBLIC.pop(1)),
+    ("popitem", PUBLIC.popitem),
+    ("clear", PUBLIC.clear),
+    ("update", lambda: PUBLIC.update({3: "three"})),
+    ("setdefault", lambda: PUBLIC.setdefault(3, "three")),
+    ("nested", lambda: _SIZES[1.5].__setitem__("nested", False)),
+):
+    try:
+        op()
+        print(name, "changed")
+    except TypeError:
+        print(name, "TypeError")
+print(sorted(PUBLIC.items()))
+
+# Copies can be changed.
+copy = dict(PUBLIC)
+copy[3] = "three"
+print(sorted(copy.items()))
+copy = PUBLIC.copy()
+copy[4] = "four"
+print(sorted(copy.items()))
+
+for source in (
+    "x = 1\n_X = const({1: x})",
+    "_X = const({1: [2]})",
+    "_X = const({i: i for i in range(3)})",
+    "_X = const({1, 2})",
+):
+    try:
+        exec("from micropython import const\n" + source)
+        print("compiled")
+    except SyntaxError:
+        print("SyntaxError")
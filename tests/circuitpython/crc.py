@@ -0,0 +1,58 @@
+# Test the crc module against the usual check values and incremental updates.
+
+import crc
+
+check = b"123456789"
+for f in (crc.crc8, crc.crc16_ccitt, crc.crc16_modbus, crc.crc32):
+    print(hex(f(check).value))
+
+# Byte by byte, and across a reset.
+c = crc.crc32()
+for i in range(len(check)):
+    c.update(check[i : i + 1])
+print(hex(c.value))
+c.reset()
+print(hex(c.value))
+c.update(memoryview(check)[:4])
+c.update(bytearray(check[4:]))
+print(hex(c.value))
+
+# Longer data, which a port may hand to hardware.
+data = bytes(range(256)) * 3
+c = crc.crc32(data[:100])
+c.update(data[100:])
+print(hex(c.value))
+print(hex(crc.crc32(data[1:]).value))
+
+# Other parameters: CRC-16/XMODEM, CRC-24/OpenPGP, CRC-16/X-25 and CRC-32C.
+c = crc.CRC(16, 0x1021)
+c.update(check)
+print(hex(c.value))
+c = crc.CRC(24, 0x864CFB, init=0xB704CE)
+c.update(check)
+print(hex(c.value))
+c = crc.CRC(16, 0x1021, init=0xFFFF, reflect_in=True, reflect_out=True, xor_out=0xFFFF)
+c.update(check)
+print(hex(c.value))
+c = crc.CRC(32, 0x1EDC6F41, init=0xFFFFFFFF, reflect_in=True, reflect_out=True, xor_out=0xFFFFFFFF)
+c.update(check)
+print(hex(c.value))
+# Reflected only one way.
+c = crc.CRC(16, 0x8005, reflect_in=True)
+c.update(check)
+print(hex(c.value))
+c = crc.CRC(16, 0x8005, reflect_out=True)
+c.update(check)
+print(hex(c.value))
+
+for args, kwargs in (
+    ((7, 1), {}),
+    ((33, 1), {}),
+    ((8, 0x100), {}),
+    ((8, 1), {"init": 0x100}),
+    ((8, 1), {"xor_out": -1}),
+):
+    try:
+        crc.CRC(*args, **kwargs)
+    except (ValueError, OverflowError) as e:
+        print(type(e).__name__)
@@ -0,0 +1,23 @@
+# Test exception messages that are only decompressed when they are used.
+
+count = 0
+for i in range(100):
+    try:
+        "a b".split("")
+    except ValueError:
+        count += 1
+print(count)
+
+try:
+    [1].index(2)
+except ValueError as e:
+    print(str(e))
+    print(e.args)
+    print(repr(e))
+    print(e.args[0] == "object not in sequence", hash(e.args[0]) == hash("object not in sequence"))
+
+# "%%" in a message without arguments is still printed as "%".
+try:
+    "%c" % "ab"
+except TypeError as e:
+    print(e)
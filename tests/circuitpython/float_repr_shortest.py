@@ -0,0 +1,37 @@
+# Test that repr() of a float gives the shortest digits that read back as the same float.
+
+for x in (
+    0.1,
+    0.1 + 0.2,
+    1 / 3,
+    2 / 3,
+    -1.5,
+    100.0,
+    123456789.123,
+    1e15,
+    1e16,
+    1.5e300,
+    1e-4,
+    1e-5,
+    0.000123,
+    2.0**-1074,
+    2.0**-1022,
+    (2 - 2.0**-52) * 2.0**1023,
+    2.0**53,
+    2.0**53 + 2,
+    0.0,
+    -0.0,
+    float("inf"),
+    -float("inf"),
+):
+    print(repr(x), str(x))
+
+print(repr(float("nan")))
+print([0.1, 2.5, -3.0])
+print(1.25 + 0.1j, 0.1j, complex(1e16, -1e-5))
+
+for i in range(-60, 61, 7):
+    print(repr(0.5**i * 3), repr(7.0**i))
+
+for s in ("0.3", "2.675", "9007199254740993", "1.1e-10", "6.02214076e23", "299792458.0"):
+    print(s, repr(float(s)))
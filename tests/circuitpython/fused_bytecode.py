@@ -0,0 +1,142 @@
+# Test code compiled to fused opcodes, such as a local followed by an attribute,
+# behaves like the opcodes it replaces.
+
+
+class Point:
+    def __init__(self, x, y):
+        self.x = x
+        self.y = y
+
+    def scaled(self, k):
+        return Point(self.x * k, self.y * k)
+
+
+# Attributes and methods of locals.
+def attrs(p):
+    q = p.scaled(3)
+    return p.x, q.y, q.scaled(2).x
+
+
+print(attrs(Point(1, 2)))
+
+
+def missing(p):
+    try:
+        p.z
+    except AttributeError:
+        print("AttributeError")
+    try:
+        p.z()
+    except AttributeError:
+        print("AttributeError")
+
+
+missing(Point(1, 2))
+
+
+# A local used before it is assigned.
+def unbound_attr():
+    print(v.x)
+    v = 1
+
+
+def unbound_method():
+    v.f()
+    v = 1
+
+
+def unbound_op():
+    print(v + 1)
+    v = 1
+
+
+for f in (unbound_attr, unbound_method, unbound_op):
+    try:
+        f()
+    except NameError:
+        print("NameError")
+
+
+# Binary ops of a local and a small int, over the whole range of small ints
+# that load in one opcode.
+def ops(x):
+    return x + 1, x - 16, x * 47, x // -3, x % 5, x << 2, x >> 1, x & 15, x | 32, x ^ -1
+
+
+print(ops(7))
+print(ops(-100))
+print(ops(2**40))
+print(ops(True))
+
+
+def other_types(x):
+    return x * 3, x + 1
+
+
+print(other_types(1.5))
+print(other_types(1.5j))
+try:
+    other_types("a")
+except TypeError:
+    print("TypeError")
+
+
+# Comparisons and tests that jump.
+def count(n):
+    i = 0
+    evens = 0
+    while i < n:
+        if i % 2 == 0:
+            evens += 1
+        i = i + 1
+    return i, evens
+
+
+print(count(10))
+print(count(0))
+
+
+def jumps(a, b):
+    r = []
+    if a < b:
+        r.append("lt")
+    if not a == b:
+        r.append("ne")
+    if a != 2:
+        r.append("not 2")
+    return r
+
+
+print(jumps(1, 2))
+print(jumps(2, 2))
+print(jumps(2.5, 1.5))
+
+
+def membership(a, b):
+    r = []
+    if a in b:
+        r.append("in")
+    if a is not None:
+        r.append("is not")
+    return r
+
+
+print(membership(3, [3]))
+print(membership(None, (1,)))
+
+
+class Compare:
+    def __lt__(self, other):
+        print("__lt__", other)
+        return 0
+
+
+def custom(c):
+    while c < 5:
+        print("loop")
+        break
+    else:
+        print("false")
+
+
+custom(Compare())
@@ -0,0 +1,33 @@
+# Test that gc.compact() moves Bitmap pixels without losing them.
+try:
+    import gc
+    import displayio
+
+    gc.compact
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+gc.collect()
+# Leave holes between the bitmaps for them to move into.
+padding = []
+bitmaps = []
+for i in range(8):
+    padding.append(bytearray(2000))
+    bitmap = displayio.Bitmap(40, 40, 256)
+    bitmap[i, i] = i + 1
+    bitmaps.append(bitmap)
+padding = None
+print(gc.compact() > 0)
+print([bitmap[i, i] for i, bitmap in enumerate(bitmaps)])
+print([bitmap[0, 39] for bitmap in bitmaps])
+
+# Nothing is left to move.
+print(gc.compact())
+
+# A bitmap whose buffer has been handed out stays put.
+view = memoryview(bitmaps[0])
+bitmaps = bitmaps[:1]
+gc.compact()
+bitmaps[0][5, 5] = 9
+print(view[5 * 40 + 5])
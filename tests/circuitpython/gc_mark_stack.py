@@ -0,0 +1,18 @@
+# Test that collections keep everything in structures too wide for the fixed GC stack.
+import gc
+
+rows = [{"id": i, "tags": [str(i), (i, i + 1)]} for i in range(2000)]
+nested = None
+for i in range(200):
+    nested = [nested, [i] * 3, {i: str(i)}]
+
+gc.collect()
+gc.collect()
+
+print(all(row["id"] == i and row["tags"] == [str(i), (i, i + 1)] for i, row in enumerate(rows)))
+depth = 0
+while nested is not None:
+    depth += 1
+    nested, values, d = nested
+    assert values == [200 - depth] * 3 and d == {200 - depth: str(200 - depth)}
+print(depth)
@@ -0,0 +1,35 @@
+import gc
+
+try:
+    gc.stats
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+print(sorted(gc.stats()))
+
+before = gc.stats()
+gc.collect()
+gc.collect()
+after = gc.stats()
+print(after["collections"] - before["collections"])
+print(after["pause_total_us"] >= before["pause_total_us"])
+print(after["pause_max_us"] >= before["pause_max_us"])
+
+# Allocations are counted by their size in blocks.
+before = gc.stats()
+keep = [bytearray(5000) for i in range(10)]
+after = gc.stats()
+print(after["bytes_allocated"] - before["bytes_allocated"] >= 50000)
+print(after["allocs"][-1] - before["allocs"][-1] >= 10)
+print(len(after["allocs"]))
+
+stats = gc.stats()
+print(0 < stats["largest_free_min"] <= stats["largest_free"])
+
+# alloc_count() itself doesn't allocate.
+before = gc.alloc_count()
+after = gc.alloc_count()
+print(after - before)
+keep = [bytearray(100), bytearray(100)]
+print(gc.alloc_count() - after >= 3)
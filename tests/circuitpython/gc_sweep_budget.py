@@ -0,0 +1,42 @@
+import gc
+
+try:
+    gc.sweep_budget
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+print(gc.sweep_budget())
+gc.sweep_budget(1)
+print(gc.sweep_budget())
+
+# Live data must survive sweeps that are spread across the allocations made after each collection.
+keep = []
+for round in range(20):
+    garbage = [[i] * 8 for i in range(50)]
+    garbage = [bytearray(i % 64) for i in range(500)]
+    keep.append([round] * 30)
+    garbage = None
+    gc.collect()
+    keep.append(bytearray(range(round, round + 100)))
+    keep.append("%d" % round * 20)
+
+ok = True
+for round in range(20):
+    ok = ok and keep[3 * round] == [round] * 30
+    ok = ok and keep[3 * round + 1] == bytearray(range(round, round + 100))
+    ok = ok and keep[3 * round + 2] == "%d" % round * 20
+print(ok)
+
+
+# Asking how much memory is free finishes the pending sweep first.
+def free_after_collect():
+    gc.collect()
+    first = gc.mem_free()
+    return first == gc.mem_free()
+
+
+print(free_after_collect())
+
+gc.sweep_budget(-5)
+print(gc.sweep_budget())
@@ -0,0 +1,92 @@
+# Test that a finished generator or coroutine gives its frame back to the heap
+# and still behaves like a finished one.
+
+import gc
+import micropython
+
+
+def gen():
+    yield 1
+    return 2
+
+
+def gen_raise():
+    yield 1
+    raise ValueError("gen_raise")
+
+
+@micropython.native
+def gen_native():
+    yield 1
+    return 3
+
+
+async def coro():
+    return 4
+
+
+async def outer():
+    return await coro() + 1
+
+
+def finish(g):
+    while True:
+        try:
+            print("yield", next(g))
+        except StopIteration as e:
+            print("return", e.value)
+            return
+        except Exception as e:
+            print(type(e).__name__, e)
+            return
+
+
+def poke(g):
+    # Each of these finds the generator already finished.
+    for f in (
+        lambda: next(g),
+        lambda: g.send(1),
+        lambda: g.throw(KeyError("thrown")),
+        lambda: g.close(),
+        lambda: g.pend_throw(None),
+    ):
+        try:
+            print(f())
+        except Exception as e:
+            print(type(e).__name__, repr(e.args))
+    print(repr(g).split()[1])
+
+
+for g in (gen(), gen_raise(), gen_native()):
+    finish(g)
+    poke(g)
+
+for c in (coro(), outer()):
+    try:
+        c.send(None)
+    except StopIteration as e:
+        print("return", e.value)
+    poke(c)
+
+
+# A generator with a large frame, so that its state is several blocks.
+def big():
+    a0 = a1 = a2 = a3 = a4 = a5 = a6 = a7 = a8 = a9 = 0
+    b0 = b1 = b2 = b3 = b4 = b5 = b6 = b7 = b8 = b9 = 0
+    c0 = c1 = c2 = c3 = c4 = c5 = c6 = c7 = c8 = c9 = 0
+    yield a0 + b0 + c0
+
+
+n = 20
+gens = [big() for i in range(n)]
+for g in gens:
+    next(g)
+gc.collect()
+before = gc.mem_free()
+for g in gens:
+    for x in g:
+        pass
+after = gc.mem_free()
+# Each frame holds at least its 30 locals.
+print(after - before >= n * 30 * 4)
+finish(gens[0])
@@ -0,0 +1,69 @@
+# Test saving and loading compiled code in a .mpycache directory.
+
+import os, sys
+
+DIR = "import_compile_cache_dir"
+CACHE = DIR + "/.mpycache"
+
+
+def write(path, data):
+    with open(path, "w") as f:
+        f.write(data)
+
+
+def read(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def load():
+    sys.modules.pop("ccmod", None)
+    import ccmod
+
+
+os.mkdir(DIR)
+sys.path.insert(0, DIR)
+write(DIR + "/ccmod.py", "print('one')\n")
+
+# Without a cache directory nothing is saved.
+load()
+
+# With one the code is saved...
+os.mkdir(CACHE)
+load()
+print(os.listdir(CACHE))
+
+# ...and loaded on later imports.
+cached = read(CACHE + "/ccmod.mpy")
+with open(CACHE + "/ccmod.mpy", "wb") as f:
+    f.write(cached.replace(b"one", b"two"))
+load()
+
+# Changing the source compiles it again.
+write(DIR + "/ccmod.py", "print('three')\n")
+load()
+load()
+
+# A cache file that isn't compatible is replaced.
+with open(CACHE + "/ccmod.mpy", "wb") as f:
+    f.write(cached[:8] + b"garbage")
+write(DIR + "/ccmod.py", "print('one')\n")
+load()
+print(read(CACHE + "/ccmod.mpy") == cached)
+
+# Once a cache file can't be written, nothing more is saved.
+os.remove(CACHE + "/ccmod.mpy")
+os.mkdir(CACHE + "/ccmod.mpy")
+load()
+write(DIR + "/ccmod2.py", "print('four')\n")
+sys.modules.pop("ccmod2", None)
+import ccmod2
+
+print(os.listdir(CACHE))
+
+sys.path.pop(0)
+os.rmdir(CACHE + "/ccmod.mpy")
+os.rmdir(CACHE)
+os.remove(DIR + "/ccmod.py")
+os.remove(DIR + "/ccmod2.py")
+os.rmdir(DIR)
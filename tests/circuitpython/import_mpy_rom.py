@@ -0,0 +1,58 @@
+# Test importing a .mpy file from a filesystem whose files have the buffer protocol.
+
+import gc, os, sys
+
+try:
+    os.mount
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class ROMFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (32768, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError
+
+    def open(self, path, mode):
+        # Files are memoryviews, which have the buffer protocol.
+        return memoryview(self.files[path])
+
+
+# romod.py:
+#   s = "a string constant longer than a qstr would be"
+#   b = b"some bytes"
+#   def f(x):
+#       return x + 1
+#   print("in romod", f(1), s, b)
+mpy = bytearray(
+    b'C\x06\x00\x1f\x08\x02\x1a/tmp/romod.py\x00\x0f\x10in romod\x00\x02f\x00\x02s\x00\x02b\x00\x81w\x02x\x00\x05-a string constant longer than a qstr would be\x00\x06\nsome bytes\x00\x82, \n\x01$dd #\x00\x16\x04#\x01\x16\x052\x00\x16\x03\x11\x06\x10\x02\x11\x03\x814\x01\x11\x04\x11\x054\x04YQc\x01P\x11\x08\x03\x07`@\xb0\x81\xf2c'
+)
+
+os.mount(ROMFS({"/romod.mpy": mpy}), "/rom")
+sys.path.insert(0, "/rom")
+
+import romod
+
+print(romod.f(2))
+
+# Only read-only data outside the heap is used in place. This file is in a heap
+# bytearray, so the module keeps working after the file is changed and dropped.
+i = mpy.find(b"some bytes")
+mpy[i : i + 4] = b"SOME"
+mpy = None
+os.umount("/rom")
+gc.collect()
+print(romod.f(3), romod.s, romod.b)
+
+sys.path.pop(0)
@@ -0,0 +1,54 @@
+# Test running a .mpy file in place from a filesystem whose files are outside the heap.
+
+import gc, os, sys
+
+try:
+    os.mount
+    rom_buffer
+except (AttributeError, NameError):
+    print("SKIP")
+    raise SystemExit
+
+
+class ROMFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (32768, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError
+
+    def open(self, path, mode):
+        return self.files[path]
+
+
+# romod.py:
+#   s = "a string constant longer than a qstr would be"
+#   b = b"some bytes"
+#   def f(x):
+#       return x + 1
+#   print("in romod", f(1), s, b)
+mpy = b'C\x06\x00\x1f\x08\x02\x1a/tmp/romod.py\x00\x0f\x10in romod\x00\x02f\x00\x02s\x00\x02b\x00\x81w\x02x\x00\x05-a string constant longer than a qstr would be\x00\x06\nsome bytes\x00\x82, \n\x01$dd #\x00\x16\x04#\x01\x16\x052\x00\x16\x03\x11\x06\x10\x02\x11\x03\x814\x01\x11\x04\x11\x054\x04YQc\x01P\x11\x08\x03\x07`@\xb0\x81\xf2c'
+
+# rom_buffer() copies the file to memory outside the heap, like flash.
+rom = rom_buffer(mpy)
+os.mount(ROMFS({"/romod.mpy": rom}), "/rom")
+sys.path.insert(0, "/rom")
+
+import romod
+
+os.umount("/rom")
+sys.path.pop(0)
+gc.collect()
+print(romod.f(2))
+
+# The constants were not copied, so changes to the file show through them.
+rom_buffer(mpy.replace(b"some", b"SOME").replace(b"a string", b"A STRING"))
+print(romod.s, romod.b)
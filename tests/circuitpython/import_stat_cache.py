@@ -0,0 +1,79 @@
+# Test that remembered import lookups on FAT see changes to the filesystem.
+
+import os, sys
+
+try:
+    os.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+def write(path, data):
+    with open(path, "w") as f:
+        f.write(data)
+
+
+def try_import():
+    sys.modules.pop("scmod", None)
+    try:
+        import scmod
+    except ImportError:
+        print("ImportError")
+
+
+bdev = RAMFS(50)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ramdisk")
+sys.path.insert(0, "/ramdisk")
+
+# Misses are remembered until a file is written.
+try_import()
+try_import()
+write("/ramdisk/scmod.py", "print('found')")
+try_import()
+
+# Removing a file is a write too.
+os.remove("/ramdisk/scmod.py")
+try_import()
+
+# Packages.
+os.mkdir("/ramdisk/scmod")
+write("/ramdisk/scmod/__init__.py", "print('package')")
+try_import()
+
+# Mounting another filesystem in its place.
+snapshot = bytearray(bdev.data)
+os.remove("/ramdisk/scmod/__init__.py")
+os.rmdir("/ramdisk/scmod")
+write("/ramdisk/scmod.py", "print('module')")
+try_import()
+os.umount("/ramdisk")
+bdev2 = RAMFS(50)
+bdev2.data = snapshot
+os.mount(os.VfsFat(bdev2), "/ramdisk")
+try_import()
+
+sys.path.pop(0)
+os.umount("/ramdisk")
@@ -0,0 +1,36 @@
+# Test that json.dump writes to the stream in chunks rather than a token at a time.
+
+import io
+import json
+
+
+class Recorder(io.IOBase):
+    def __init__(self):
+        self.data = bytearray()
+        self.writes = []
+
+    def write(self, buf):
+        self.data.extend(buf)
+        self.writes.append(len(buf))
+        return len(buf)
+
+
+for obj in (
+    [],
+    {"a": 1},
+    [{"id": i, "name": "sensor", "ok": i % 2 == 0} for i in range(40)],
+    ["x" * 300, 1, "y"],
+):
+    r = Recorder()
+    json.dump(obj, r)
+    print(r.data == json.dumps(obj).encode(), len(r.writes), max(r.writes))
+
+r = Recorder()
+json.dump({"k": [1, 2]}, r, separators=(",", ":"))
+print(r.data, r.writes)
+
+r = Recorder()
+try:
+    json.dump([1, 2, object()], r)
+except TypeError:
+    print("TypeError")
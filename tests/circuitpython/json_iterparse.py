@@ -0,0 +1,68 @@
+# Test json.iterparse, which streams a document and builds only the values asked for.
+
+import io
+import json
+
+doc = """{
+    "status": "ok",
+    "items": [
+        {"name": "a", "value": 1.5, "tags": ["x", "y"]},
+        {"name": "b \\"quoted\\" ]}", "value": -2, "tags": []},
+        {"name": "c", "value": null, "extra": {"deep": [true, false]}}
+    ],
+    "count": 3
+}"""
+
+
+# Dicts are printed with sorted items so the output doesn't depend on dict order.
+def sort_dicts(value):
+    if isinstance(value, dict):
+        return sorted((k, sort_dicts(v)) for k, v in value.items())
+    if isinstance(value, list):
+        return [sort_dicts(v) for v in value]
+    return value
+
+
+def show(stream, paths=None):
+    for path, value in json.iterparse(stream, paths=paths):
+        print(path, sort_dicts(value))
+    print("-")
+
+
+show(io.StringIO(doc), [("status",), ("count",)])
+show(io.StringIO(doc), [("items", None, "name")])
+show(io.StringIO(doc), [("items", 1)])
+show(io.StringIO(doc), [("items", 2, "extra", "deep", 0), ("missing", "x")])
+show(io.StringIO(doc), [()])
+show(io.StringIO(doc), [])
+show(io.StringIO('{"a": [1, {"b": "c"}], "d": "\\u0041"}'))
+show(io.BytesIO(b"[[1, 2], [3, 4]]"), [(None, 1)])
+show(io.StringIO("42"))
+show(io.StringIO("[]"))
+
+# Values are produced before the rest of the document is read.
+it = json.iterparse(io.StringIO('[{"id": 1}, {"id": 2}, oops'), paths=[(None, "id")])
+print(next(it))
+print(next(it))
+try:
+    next(it)
+except ValueError:
+    print("ValueError")
+
+
+# Streams without the stream protocol are read through readinto.
+class Reader:
+    def __init__(self, data):
+        self.data = io.BytesIO(data)
+
+    def readinto(self, buf):
+        return self.data.readinto(buf)
+
+
+show(Reader(b'{"x": "' + b"-" * 200 + b'", "y": [5]}'), [("y", 0)])
+
+for bad in ('{"a": [1', '{"a": "b', "]", "", '{1: 2}'):
+    try:
+        show(io.StringIO(bad), [("a", 0)])
+    except ValueError:
+        print("ValueError", repr(bad))
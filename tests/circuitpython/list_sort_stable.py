@@ -0,0 +1,59 @@
+# Test that list.sort() and sorted() are stable and call key functions once.
+
+# Equal keys keep their order, with and without reverse.
+pairs = [(i % 7, i) for i in range(100)]
+print(sorted(pairs, key=lambda p: p[0]) == sorted(pairs))
+print(sorted(pairs, key=lambda p: p[0], reverse=True)[:8])
+
+# Runs already in order, descending runs and short lists.
+for l in (
+    list(range(50)),
+    list(range(50, 0, -1)),
+    list(range(20)) + list(range(10)),
+    [3, 1, 2],
+    [1, 1, 1, 0, 0, 0],
+):
+    l2 = l[:]
+    l2.sort()
+    print(l2 == sorted(l), l2[:6])
+
+# Nearly sorted input.
+l = list(range(500))
+l[100], l[400] = l[400], l[100]
+print(sorted(l) == list(range(500)))
+
+# The key function is called once per item.
+calls = 0
+
+
+def key(x):
+    global calls
+    calls += 1
+    return -x
+
+
+l = [(i * 37) % 101 for i in range(101)]
+l.sort(key=key)
+print(calls, l[:5])
+
+
+# A comparison that raises leaves all the items in the list.
+class Bomb:
+    count = 0
+
+    def __init__(self, v):
+        self.v = v
+
+    def __lt__(self, other):
+        Bomb.count += 1
+        if Bomb.count == 150:
+            raise ValueError("boom")
+        return self.v < other.v
+
+
+l = [Bomb((i * 13) % 64) for i in range(64)]
+try:
+    l.sort()
+except ValueError as e:
+    print("ValueError", e)
+print(len(l), sorted(b.v for b in l) == list(range(64)))
@@ -0,0 +1,52 @@
+try:
+    import memorymonitor
+
+    memorymonitor.AllocationProfiler
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def small():
+    return [1, 2, 3, 4]
+
+
+def large():
+    return bytearray(1000)
+
+
+# Every sample is attributed to the line in the innermost function making the allocation.
+# Storing a new global may grow the globals dict, so the loop variable is made first.
+i = 0
+profiler = memorymonitor.AllocationProfiler(interval=1)
+with profiler:
+    for i in range(10):
+        small()
+    for i in range(5):
+        large()
+results = profiler.results()
+print([(line, samples == sampled_bytes) for source_file, line, samples, sampled_bytes in results])
+print(results[0][0].endswith("memorymonitor_profiler.py"))
+print(results[0][2] > results[1][2])
+print(profiler.dropped)
+
+# Each sample stands for interval bytes.
+profiler = memorymonitor.AllocationProfiler(interval=100)
+with profiler:
+    for i in range(10):
+        large()
+source_file, line, samples, sampled_bytes = profiler.results()[0]
+print(line, 90 <= samples <= 120, sampled_bytes >= 10000)
+
+# Lines that don't fit are counted as dropped.
+profiler = memorymonitor.AllocationProfiler(interval=1, slots=1)
+with profiler:
+    small()
+    large()
+print(len(profiler.results()), profiler.dropped > 0)
+
+# Samples are cleared when profiling starts again, and only taken while it is running.
+with profiler:
+    pass
+large()
+print(profiler.results(), profiler.dropped)
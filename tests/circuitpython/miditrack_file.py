@@ -0,0 +1,91 @@
+import os
+import struct
+
+try:
+    from synthio import MidiTrack, from_file
+    from audiocore import get_buffer, reset_buffer
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * 512)
+
+    def readblocks(self, block, buf):
+        start = block * 512
+        buf[:] = self.data[start : start + len(buf)]
+
+    def writeblocks(self, block, buf):
+        start = block * 512
+        self.data[start : start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:
+            return len(self.data) // 512
+        if op == 5:
+            return 512
+
+
+bdev = RAMBlockDevice(64)
+os.VfsFat.mkfs(bdev)
+os.mount(os.VfsFat(bdev), "/ram")
+
+
+def write_midi(path, format, division, tracks):
+    with open(path, "wb") as f:
+        f.write(b"MThd" + struct.pack(">IHHH", 6, format, len(tracks), division))
+        for track in tracks:
+            f.write(b"MTrk" + struct.pack(">I", len(track)) + track)
+
+
+def play(sample):
+    reset_buffer(sample)
+    samples = []
+    while True:
+        result, buf = get_buffer(sample)
+        samples.extend(buf)
+        if result != 1:
+            return samples
+
+
+# One second per quarter note, then twice as fast from tick 20, so at 100 ticks per quarter the
+# last 10 ticks are as long as 5 at the starting tempo.
+TEMPO = b"\0\xff\x51\x03\x0f\x42\x40\x14\xff\x51\x03\x07\xa1\x20\0\xff\x2f\0"
+# The second note uses running status and ends with a zero velocity Note On.
+NOTES = b"\0\x90@\x7f\x0ab\x7f\x14\x80@\0\0\x90b\0\0\xff\x2f\0"
+EQUIVALENT = b"\0\x90@\x7f\x0a\x90b\x7f\x0f\x80@\0\0\x80b\0"
+
+equivalent = MidiTrack(EQUIVALENT, sample_rate=8000, tempo=100)
+expected = play(equivalent)
+# The synthesizer keeps its oscillator state from one playback to the next, so compare a replay
+# with a replay.
+expected_again = play(equivalent)
+
+write_midi("/ram/format1.mid", 1, 100, [TEMPO, NOTES])
+with open("/ram/format1.mid", "rb") as f:
+    m = from_file(f, sample_rate=8000)
+    print(play(m) == expected)
+    # Playing again starts over from the beginning.
+    print(play(m) == expected_again)
+    print(m.error_location)
+
+# The same song with the tempo events merged into the note track.
+write_midi(
+    "/ram/format0.mid",
+    0,
+    100,
+    [b"\0\xff\x51\x03\x0f\x42\x40\0\x90@\x7f\x0a\x90b\x7f\x0a\xff\x51\x03\x07\xa1\x20\x0a\x80@\0\0\x80b\0\0\xff\x2f\0"],
+)
+with open("/ram/format0.mid", "rb") as f:
+    print(play(from_file(f, sample_rate=8000)) == expected)
+
+write_midi("/ram/format2.mid", 2, 100, [TEMPO, NOTES])
+with open("/ram/format2.mid", "rb") as f:
+    try:
+        from_file(f)
+    except ValueError as e:
+        print("ValueError", e)
+
+os.umount("/ram")
@@ -0,0 +1,41 @@
+# Test big integer multiplication, division and pow(a, b, m) across the sizes where
+# the algorithms change.
+
+P = 1000000007
+
+
+def check(*values):
+    print(" ".join(str(v % P) for v in values))
+
+
+# Numbers with long runs of zero and all-ones digits exercise the carries.
+for bits in (100, 700, 800, 1500, 3000, 10000):
+    a = 3**bits + 1
+    b = (1 << bits) - 1
+    c = 1 << (bits // 2) | 1
+    check(a * b, a * a, b * b, a * c, b * c, -a * b, a * -c)
+    print((a * b) // b == a, (a * b) % a, (b * b) // b == b)
+
+# Very different lengths.
+a = 7**5000
+for bits in (10, 200, 800, 2000):
+    b = 5**bits
+    check(a * b, b * a)
+
+# Single digit divisors.
+a = 11**300
+for d in (1, 2, 3, 7, 10, 255, 65535, 65537, 2**31 - 1, -3, -65535):
+    q, r = divmod(a, d)
+    print(q % P, r, q * d + r == a)
+    q, r = divmod(-a, d)
+    print(q % P, r, q * d + r == -a)
+
+# Modular powers with exponents of many lengths.
+p = 2**256 - 2**224 + 2**192 + 2**96 - 1
+g = 0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+print(pow(g, p - 2, p) * g % p)
+for e in (1, 2, 3, 5, 16, 17, 255, 256, 2**24 + 1, 2**80 - 1, 2**240 + 3, p - 1):
+    print(pow(g, e, p) % P, pow(3, e, 1000003), pow(-g, e, p) % P, pow(g, e, -p) % P)
+m = 3**1300 | 1
+print(pow(12345678901234567890, m - 3, m) % P)
+print(pow(2, 2**100, 97), pow(5, 0, 7), pow(0, 5, 7), pow(5, 5, 1))
@@ -0,0 +1,112 @@
+# Test that functions called often enough are compiled to native code without changing behaviour.
+
+import micropython
+
+N = 1100
+
+
+def add(a, b=10, *, c=100):
+    return a + b + c
+
+
+def run(f, *args, **kwargs):
+    r = None
+    for i in range(N):
+        r = f(i, *args, **kwargs)
+    return r
+
+
+print(run(add))
+print(run(add, 1))
+print(run(add, 1, c=2))
+print(add(1), add(1, 2), add(1, c=3))
+
+
+def make_counter():
+    n = 0
+
+    def inc(i):
+        nonlocal n
+        n += i
+        return n
+
+    return inc
+
+
+print(run(make_counter()))
+
+
+class Point:
+    def __init__(self, x):
+        self.x = x
+
+    def scaled(self, i):
+        return self.x * i
+
+
+p = Point(3)
+print(run(p.scaled))
+
+
+def check(i):
+    if i > 1050:
+        raise ValueError(i)
+    return i
+
+
+try:
+    run(check)
+except ValueError as e:
+    print("ValueError", e)
+try:
+    check(2000)
+except ValueError as e:
+    print("ValueError", e)
+
+scale = 2
+
+
+def uses_global(i):
+    return i * scale
+
+
+print(run(uses_global))
+scale = 5
+print(uses_global(3))
+
+exec("def from_exec(i):\n    return i + 1\n")
+print(run(from_exec))
+
+
+def gen(i):
+    yield i
+    yield i + 1
+
+
+print(run(lambda i: sum(gen(i))))
+
+
+def fact(n):
+    return 1 if n < 2 else n * fact(n - 1)
+
+
+print(run(lambda i: fact(i % 10)))
+
+
+@micropython.bytecode
+def kept(i):
+    return -i
+
+
+print(run(kept))
+
+
+def loop(n):
+    total = 0
+    for i in range(n):
+        total += i
+    return total
+
+
+print(loop(5000))
+print(loop(10))
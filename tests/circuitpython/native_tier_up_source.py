@@ -0,0 +1,92 @@
+# Test that hot functions are only compiled again from a source file that hasn't changed.
+
+import io, os, sys
+
+try:
+    io.IOBase
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+N = 1100
+
+
+class UserFile(io.IOBase):
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, req, arg):
+        if req == 4:  # MP_STREAM_CLOSE
+            return 0
+        return -1
+
+
+class UserFS:
+    def __init__(self):
+        # path: [data, mtime]
+        self.files = {}
+        self.opens = 0
+        self.interrupt = False
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            data, mtime = self.files[path]
+            return (32768, 0, 0, 0, 0, 0, len(data), mtime, mtime, mtime)
+        raise OSError
+
+    def open(self, path, mode):
+        self.opens += 1
+        if self.interrupt:
+            raise KeyboardInterrupt
+        return UserFile(self.files[path][0])
+
+
+def run(f):
+    r = None
+    for i in range(N):
+        r = f(i)
+    return r
+
+
+fs = UserFS()
+os.mount(fs, "/userfs")
+sys.path.insert(0, "/userfs")
+
+fs.files["/tu1.py"] = [b"def f(i):\n    return 1\n", 1]
+fs.files["/tu2.py"] = [b"def f(i):\n    return 1\n", 1]
+fs.files["/tu3.py"] = [b"def f(i):\n    return 1\n", 1]
+import tu1, tu2, tu3
+
+# A file written to since the import, with the same size or the same time, is
+# not read again, and the code that was imported keeps running.
+fs.files["/tu1.py"] = [b"def f(i):\n    return 2\n", 2]
+fs.files["/tu2.py"] = [b"def f(i):\n    return 22\n", 1]
+fs.opens = 0
+print(run(tu1.f), run(tu2.f), fs.opens)
+
+# An exception other than the file being unreadable is not swallowed.
+fs.interrupt = True
+fs.opens = 0
+try:
+    r = run(tu3.f)
+    interrupted = False
+except KeyboardInterrupt:
+    interrupted = True
+fs.interrupt = False
+print(fs.opens == interrupted, tu3.f(0))
+
+sys.path.pop(0)
+os.umount("/userfs")
@@ -0,0 +1,25 @@
+# Test interning many strings at runtime, which grows the qstr pools several times.
+
+
+class A:
+    pass
+
+
+a = A()
+N = 3000
+for i in range(N):
+    setattr(a, "attr_%d" % i, i)
+
+# Every name is found again, and names that were never interned still aren't.
+print(all(getattr(a, "attr_%d" % i) == i for i in range(N)))
+print(hasattr(a, "attr_%d" % N), hasattr(a, "attr_x"))
+
+# Names interned by the compiler are found through the same table.
+exec("attr_%d = 1\nprint(attr_%d + attr_%d)" % (N, N, N))
+print(hasattr(a, "__class__"), getattr(a, "attr_0"), getattr(a, "attr_%d" % (N - 1)))
+
+# Strings that differ only in their end, or are prefixes of each other.
+names = ["q" * n for n in range(1, 200)]
+for name in names:
+    setattr(a, name, len(name))
+print(all(getattr(a, name) == len(name) for name in names))
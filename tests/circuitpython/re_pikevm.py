@@ -0,0 +1,38 @@
+# Test regexes that take exponential time when matched by backtracking.
+
+import re
+
+n = 28
+print(re.match("(a|aa)*b", "a" * n))
+print(re.match("(x+x+)+y", "x" * n))
+print(re.search("(a*)*b", "a" * n))
+print(re.match("(a|aa)*c", "a" * n + "c").group(0) == "a" * n + "c")
+
+# An empty repeat doesn't recurse until the stack runs out.
+print(re.match("(a*)*", "aaa").group(0))
+
+# Long subjects don't nest the matcher any deeper.
+s = "ab" * 2000 + "c"
+print(re.match("(ab)*c", s).group(1))
+print(re.match("(?:a|b)*c", s).end())
+
+# Searching skips to where a leading literal is.
+line = "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47"
+m = re.search(r"\$GP(\w+),(\d+)", "noise " + line)
+print(m.group(1), m.group(2))
+print(re.search("x", "a" * 100))
+print(re.search("bc", "abababc").span())
+print(re.search("b$", "ab\nab").span())
+print(re.search("^b", "ab"))
+print(re.compile("^b").search("ab", 1))
+print(re.search("(a)?b", "cab").groups())
+
+# Leftmost match, with the first alternative or repeat count that matches.
+print(re.search("a|ab", "xab").group(0))
+print(re.search("ab|a", "xab").group(0))
+print(re.match("a*?", "aaa").group(0))
+print(re.match("(a*?)b", "aab").group(1))
+print(re.match("(a+)(a*)", "aaaa").groups())
+print(re.match("(a+?)(a*)", "aaaa").groups())
+print(re.sub("a+", "-", "baaac aa d"))
+print(re.compile(",+").split("1,,2,3"))
@@ -0,0 +1,19 @@
+# Searches long enough to use the skip table when MICROPY_OPT_FIND_SUBBYTES_HORSPOOL is enabled.
+
+haystack = ("GET /index.html HTTP/1.1\r\nHost: example.com\r\n" * 20) + "Content-Length: 42\r\n\r\nbody"
+print(haystack.find("Content-Length"))
+print(haystack.find("\r\n\r\n"))
+print(haystack.find("Content-Type"))
+print(haystack.rfind("Host: example.com"))
+print("Content-Length: 42" in haystack)
+print(len(haystack.split("example.com")))
+print(haystack.replace("example.com", "circuitpython.org").count("circuitpython.org"))
+
+# Needles that repeat their last byte, and one longer than 255 bytes.
+data = bytes(range(256)) * 4 + b"aaaaaaaab" + bytes(300) + b"\xff" + bytes(299)
+print(data.find(b"aaaaaaaab"))
+print(data.find(b"aaaaaaaaa"))
+print(data.find(bytes(299) + b"\xff"))
+print(data.find(b"\xff" + bytes(299)))
+print(data.find(bytes(range(200, 256)) + bytes(range(0, 10))))
+print(bytearray(data).find(b"\xfe\xff\x00\x01\x02\x03\x04\x05"))
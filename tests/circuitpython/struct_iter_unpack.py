@@ -0,0 +1,72 @@
+# Test struct.Struct, struct.iter_unpack and Struct.unpack_into_arrays.
+
+import array
+import struct
+
+s = struct.Struct("<Ihh")
+print(s.format, s.size)
+data = b"".join(s.pack(i * 1000, i - 5, -i * 3) for i in range(10))
+print(len(data))
+print(s.unpack(data[:8]), s.unpack_from(data, 16), s.unpack_from(data, -8))
+print(list(s.iter_unpack(data))[:3])
+print(list(struct.iter_unpack("<Ihh", data)) == [s.unpack_from(data, i) for i in range(0, len(data), 8)])
+
+buf = bytearray(12)
+s.pack_into(buf, 2, 1, 2, 3)
+print(buf)
+s.pack_into(buf, -8, 4, 5, 6)
+print(buf)
+
+# The layout matches the module functions, alignment and padding included.
+for fmt in ("@bi", "@bhq", ">2x3s2H", "<Bfd", "b3xH", "!10sI", "@i2b"):
+    t = struct.Struct(fmt)
+    print(fmt, t.size == struct.calcsize(fmt))
+t = struct.Struct("@bi")
+print(t.pack(1, 2) == struct.pack("@bi", 1, 2))
+t = struct.Struct(">2x3s2H")
+packed = t.pack(b"ab", 0x1234, 0xFFFF)
+print(packed, t.unpack(packed), struct.unpack(">2x3s2H", packed))
+
+# Columns.
+times = array.array("I", [0] * 10)
+a = array.array("h", [0] * 10)
+b = array.array("f", [0] * 10)
+print(s.unpack_into_arrays(data, (times, a, b)))
+print(list(times), list(a), list(b))
+short = array.array("i", [0] * 4)
+print(s.unpack_into_arrays(data, (None, short, None)), list(short))
+print(s.unpack_into_arrays(data[:20], [None, None, bytearray(10)]))
+
+f = struct.Struct(">fHQ")
+fdata = f.pack(1.5, 7, 2**40) + f.pack(-2.25, 65535, 2**63)
+fs = array.array("d", [0, 0])
+hs = array.array("b", [0, 0])
+qs = array.array("Q", [0, 0])
+print(f.unpack_into_arrays(fdata, (fs, hs, qs)), list(fs), list(hs), list(qs))
+
+for bad in ((None, None), ("x", None, None), (None, None, None, None)):
+    try:
+        s.unpack_into_arrays(data, bad)
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__)
+try:
+    struct.Struct("3sB").unpack_into_arrays(b"abcd", (bytearray(1), None))
+except ValueError:
+    print("ValueError s")
+
+try:
+    s.iter_unpack(data[:-1])
+except RuntimeError as e:
+    print(e)
+try:
+    s.unpack(data)
+except RuntimeError as e:
+    print(e)
+try:
+    s.unpack_from(data, 76)
+except RuntimeError as e:
+    print(e)
+try:
+    s.pack(1, 2)
+except ValueError:
+    print("ValueError pack")
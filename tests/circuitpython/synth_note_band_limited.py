@@ -0,0 +1,39 @@
+from array import array
+from audiocore import get_buffer
+import synthio
+
+SAMPLE_SIZE = 256
+saw = array("h", [-32000 + 250 * i for i in range(SAMPLE_SIZE)])
+
+
+def render(note):
+    synth = synthio.Synthesizer(sample_rate=48000)
+    synth.press(note)
+    return list(get_buffer(synth)[1])
+
+
+def max_step(samples):
+    return max(abs(b - a) for a, b in zip(samples, samples[1:]))
+
+
+n = synthio.Note(1000, waveform=saw)
+print(n.band_limited)
+n.band_limited = True
+print(n.band_limited)
+
+# A low note steps through every sample of the full waveform, so nothing changes
+print(render(synthio.Note(100, waveform=saw)) == render(synthio.Note(100, waveform=saw, band_limited=True)))
+
+# A high note plays a smoothed copy of the waveform
+high = render(synthio.Note(4000, waveform=saw))
+high_bl = render(synthio.Note(4000, waveform=saw, band_limited=True))
+print(high == high_bl)
+print(max_step(high_bl) < max_step(high))
+
+# Odd length waveforms and partial loops are played as-is
+odd = saw[:255]
+print(render(synthio.Note(4000, waveform=odd)) == render(synthio.Note(4000, waveform=odd, band_limited=True)))
+print(
+    render(synthio.Note(4000, waveform=saw, waveform_loop_end=128))
+    == render(synthio.Note(4000, waveform=saw, waveform_loop_end=128, band_limited=True))
+)
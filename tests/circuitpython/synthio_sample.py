@@ -0,0 +1,65 @@
+from array import array
+from audiocore import get_buffer
+import synthio
+
+ramp = array("h", [100 * i for i in range(300)])
+
+
+def render(note, blocks=1):
+    synth = synthio.Synthesizer(sample_rate=8000)
+    synth.press(note)
+    result = []
+    for _ in range(blocks):
+        result.extend(get_buffer(synth)[1])
+    return synth, result
+
+
+low = synthio.Sample(ramp, sample_rate=8000, root_frequency=440, note_range=(0, 69))
+print(low.sample_rate, low.root_frequency, low.loop_start, low.loop_end, low.note_range, low.velocity_range)
+
+# At the root frequency the data plays at its own speed
+synth, out = render(synthio.Note(440, sample=low))
+print(out[:6])
+
+# An octave up steps through it twice as fast, and a fifth up interpolates
+anywhere = synthio.Sample(ramp, sample_rate=8000, root_frequency=440)
+print(render(synthio.Note(880, sample=anywhere))[1][:6])
+print(render(synthio.Note(440 * 1.5, sample=anywhere))[1][:6])
+# so does playing a sample recorded at a different rate
+print(render(synthio.Note(440, sample=synthio.Sample(ramp, sample_rate=16000, root_frequency=440)))[1][:6])
+
+# A sample that doesn't loop ends the note
+synth, out = render(synthio.Note(440, sample=low), 3)
+print(out[295:302])
+print(synth.pressed)
+
+# A looping one repeats loop_start to loop_end
+looped = synthio.Sample(ramp, sample_rate=8000, root_frequency=440, loop_start=10, loop_end=20)
+print(looped.loop_end)
+print(render(synthio.Note(440, sample=looped))[1][18:32])
+
+# Zones are chosen by note and velocity
+high = synthio.Sample(array("h", [-8000] * 10), sample_rate=8000, root_frequency=880, loop_end=10, note_range=(70, 127))
+soft = synthio.Sample(array("h", [4000] * 10), sample_rate=8000, root_frequency=880, loop_end=10, velocity_range=(0, 63))
+zones = [soft, low, high]
+n = synthio.Note(440, sample=zones)
+print(type(n.sample), len(n.sample))
+print(render(n)[1][1:3])
+n.frequency = 880
+print(render(n)[1][1:3])
+n.velocity = 10
+print(n.velocity, render(n)[1][1:3])
+n.frequency = 440
+print(render(n)[1][1:3])
+
+# Nothing matches a low, soft note without the soft zone, so it is silent
+print(render(synthio.Note(220, sample=[high], velocity=10))[1][:3])
+
+try:
+    synthio.Sample(array("H", [0, 0]), sample_rate=8000, root_frequency=440)
+except ValueError as e:
+    print("ValueError", e)
+try:
+    synthio.Note(440, sample=[ramp])
+except TypeError as e:
+    print("TypeError", e)
@@ -0,0 +1,88 @@
+# Test that cached class attribute lookups see changes to classes.
+
+
+class A:
+    def f(self):
+        return "A.f"
+
+    @property
+    def p(self):
+        return "A.p"
+
+
+class B(A):
+    pass
+
+
+b = B()
+for i in range(3):
+    print(b.f(), b.p)
+
+# Adding to the class in between shadows the base.
+B.f = lambda self: "B.f"
+print(b.f())
+
+# Changing and deleting in the base.
+del B.f
+A.f = lambda self: "new A.f"
+print(b.f())
+del A.f
+try:
+    b.f()
+except AttributeError:
+    print("AttributeError")
+
+# Instance members come before the class.
+b.p2 = 1
+A.p2 = 2
+print(b.p2, B().p2)
+
+# A dict passed to type() is copied.
+d = {"g": lambda self: "C.g"}
+C = type("C", (), d)
+c = C()
+print(c.g())
+d["g"] = lambda self: "changed"
+print(c.g())
+
+
+# So is the dict locals() returns in the class body.
+class F:
+    h = 1
+    ns = locals()
+
+
+f = F()
+print(f.h)
+F.ns["h"] = 2
+print(f.h, F.h)
+
+
+# Class and static methods.
+class D:
+    @classmethod
+    def cm(cls):
+        return cls.__name__
+
+    @staticmethod
+    def sm():
+        return "sm"
+
+
+class E(D):
+    pass
+
+
+for i in range(2):
+    print(E().cm(), D().cm(), E().sm())
+
+
+# Natively implemented attributes of a native base aren't cached.
+class L(list):
+    pass
+
+
+l = L()
+l.append(1)
+l.append(2)
+print(l)
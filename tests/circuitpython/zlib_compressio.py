@@ -0,0 +1,84 @@
+# Test zlib.CompressIO by decompressing what it writes.
+
+import io
+import zlib
+
+data = b"".join(b"%d: temp=%d hum=%d\n" % (i, 20 + i % 7, 40 + i % 13) for i in range(2000))
+
+
+class Recorder(io.IOBase):
+    def __init__(self):
+        self.chunks = []
+
+    def write(self, buf):
+        self.chunks.append(bytes(buf))
+        return len(buf)
+
+
+# Uneven writes, across every format and the smallest and largest windows.
+for wbits in (8, 15, -8, -15, 24, 31):
+    for chain in (1, 64):
+        out = io.BytesIO()
+        c = zlib.CompressIO(out, wbits, chain=chain)
+        i = 0
+        n = 1
+        while i < len(data):
+            c.write(data[i : i + n])
+            i += n
+            n = (n * 3 + 1) % 700 + 1
+        c.close()
+        compressed = out.getvalue()
+        print(wbits, chain, len(compressed) < len(data) // 2, zlib.decompress(compressed, wbits) == data)
+
+# Output goes to the stream in chunks, not a byte at a time.
+r = Recorder()
+with zlib.CompressIO(r, 12) as c:
+    c.write(data)
+print(len(r.chunks) < 100, max(len(chunk) for chunk in r.chunks) > 1)
+print(zlib.decompress(b"".join(r.chunks)) == data)
+
+# Flushing gets everything so far out to the stream.
+out = io.BytesIO()
+c = zlib.CompressIO(out, 9)
+c.write(b"hello hello hello")
+c.flush()
+flushed = len(out.getvalue())
+c.write(b" world")
+c.flush()
+c.close()
+print(flushed > 0, zlib.decompress(out.getvalue()))
+
+# Nothing written.
+out = io.BytesIO()
+with zlib.CompressIO(out, -8):
+    pass
+print(out.getvalue(), zlib.decompress(out.getvalue(), -8))
+
+# A scratch buffer instead of allocating.
+scratch = bytearray(5 * 1024)
+out = io.BytesIO()
+with zlib.CompressIO(out, 10, scratch=scratch) as c:
+    c.write(data)
+print(zlib.decompress(out.getvalue()) == data)
+try:
+    zlib.CompressIO(io.BytesIO(), 11, scratch=scratch)
+except ValueError:
+    print("ValueError scratch")
+
+for wbits in (7, 16, -16, 23, 32):
+    try:
+        zlib.CompressIO(io.BytesIO(), wbits)
+    except ValueError:
+        print("ValueError wbits", wbits)
+try:
+    zlib.CompressIO(io.BytesIO(), chain=0)
+except ValueError:
+    print("ValueError chain")
+
+c = zlib.CompressIO(io.BytesIO())
+c.close()
+c.close()
+try:
+    c.write(b"x")
+except OSError:
+    print("OSError write")
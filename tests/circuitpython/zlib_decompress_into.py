@@ -0,0 +1,40 @@
+# Test zlib.decompress's size hint and zlib.decompress_into.
+
+import zlib
+
+data = b"0123456789" * 1000
+compressed = b"x\xda\xed\xc6I\r\x00 \x0c\x000K\xe3\x18\x03\xff\xc6\xd0\xb1\xa4}5\xc6\\;O\xdd\x17fffffffffffffffffffm\xf7\x01d\x0e\x03A"
+gzipped = b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\xed\xc6I\r\x00 \x0c\x000K\xe3\x18\x03\xff\xc6\xd0\xb1\xa4}5\xc6\\;O\xdd\x17fffffffffffffffffffm\xf7\x01W\x8b\xce\xbd\x10'\x00\x00"
+raw = b"\xcbH\xcd\xc9\xc9W(\xcf/\xcaI\x01\x00"
+stored = b"x\x01\x01\x05\x00\xfa\xffhello\x06,\x02\x15"
+
+# The output grows past any hint.
+print(zlib.decompress(compressed) == data)
+for bufsize in (0, 1, 100, 10000, 20000):
+    print(bufsize, zlib.decompress(compressed, 15, bufsize) == data)
+print(zlib.decompress(stored, 15, 5))
+try:
+    zlib.decompress(compressed, 15, -1)
+except ValueError:
+    print("ValueError bufsize")
+
+buf = bytearray(len(data))
+print(zlib.decompress_into(compressed, buf), buf == data)
+buf = bytearray(len(data))
+print(zlib.decompress_into(gzipped, buf, 31), buf == data)
+
+buf = bytearray(16)
+n = zlib.decompress_into(raw, buf, -15)
+print(n, buf[:n])
+n = zlib.decompress_into(stored, buf)
+print(n, buf[:n])
+
+buf = bytearray(b"-" * 12)
+n = zlib.decompress_into(stored, memoryview(buf)[2:7])
+print(n, buf)
+
+for d, size in ((stored, 4), (compressed, len(data) - 1), (compressed, 5)):
+    try:
+        zlib.decompress_into(d, bytearray(size))
+    except ValueError as e:
+        print("ValueError", e)
@@ -0,0 +1,66 @@
+# Test VfsFat files opened with a write buffer
+
+try:
+    import os, vfs
+
+    vfs.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks, sec_size=512):
+        self.sec_size = sec_size
+        self.data = bytearray(blocks * self.sec_size)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.sec_size + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.sec_size + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.sec_size
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.sec_size
+
+
+try:
+    bdev = RAMBlockDevice(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs.VfsFat.mkfs(bdev)
+vfs.mount(vfs.VfsFat(bdev), "/ramdisk")
+
+# Small writes collect in the buffer and tell() counts them.
+with open("/ramdisk/log.bin", "wb", buffering=1024) as f:
+    for i in range(300):
+        f.write(bytes([i & 0xFF] * 7))
+    print(f.tell())
+with open("/ramdisk/log.bin", "rb") as f:
+    data = f.read()
+print(len(data), data == bytes(b for i in range(300) for b in [i & 0xFF] * 7))
+
+# Appending starts part way through a sector.
+with open("/ramdisk/log.bin", "ab", buffering=512) as f:
+    f.write(b"x" * 1000)
+print(os.stat("/ramdisk/log.bin")[6])
+
+# Reading, seeking and flushing see buffered writes.
+with open("/ramdisk/log.txt", "w+", buffering=4096) as f:
+    f.write("hello\n")
+    f.seek(0)
+    print(f.read())
+    f.write("world\n")
+    f.flush()
+    print(os.stat("/ramdisk/log.txt")[6])
+with open("/ramdisk/log.txt") as f:
+    print(f.read())
+
+vfs.umount("/ramdisk")
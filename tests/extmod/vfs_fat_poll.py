@@ -0,0 +1,58 @@
+# Test polling a VfsFat file
+
+try:
+    import os, select, vfs
+
+    vfs.VfsFat
+    select.poll
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks, sec_size=512):
+        self.sec_size = sec_size
+        self.data = bytearray(blocks * self.sec_size)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.sec_size + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.sec_size + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.sec_size
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.sec_size
+
+
+try:
+    bdev = RAMBlockDevice(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs.VfsFat.mkfs(bdev)
+vfs.mount(vfs.VfsFat(bdev), "/ramdisk")
+
+with open("/ramdisk/test.txt", "w") as f:
+    f.write("hello")
+
+# A file is always ready for reading and writing.
+f = open("/ramdisk/test.txt", "r+")
+poller = select.poll()
+poller.register(f, select.POLLIN | select.POLLOUT)
+print([event & (select.POLLIN | select.POLLOUT) for _, event in poller.poll(0)])
+poller.modify(f, select.POLLIN)
+print([event for _, event in poller.poll(0)] == [select.POLLIN])
+print(f.read())
+
+# A closed file reports itself as invalid (POLLNVAL).
+f.close()
+print([(event & 0x20) != 0 for _, event in poller.poll(0)])
+
+vfs.umount("/ramdisk")
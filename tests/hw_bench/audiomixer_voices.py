@@ -0,0 +1,30 @@
+# The most audiomixer voices that can be mixed without falling behind.
+
+
+def hb_run():
+    import array
+    import math
+
+    import audiocore
+    import audiomixer
+
+    sample_rate = hb_config("sample_rate", 22050)
+    length = 100
+    sine = array.array(
+        "h", [int(math.sin(math.pi * 2 * i / length) * 8192) for i in range(length)]
+    )
+    wave = audiocore.RawSample(sine, sample_rate=sample_rate)
+
+    voices = 0
+    for count in range(1, hb_config("max_voices", 16) + 1):
+        mixer = audiomixer.Mixer(voice_count=count, channel_count=1, sample_rate=sample_rate)
+        for voice in mixer.voice:
+            voice.play(wave, loop=True)
+        ok = hb_audio_keeps_up(mixer)
+        mixer.deinit()
+        if not ok:
+            break
+        voices = count
+
+    hb_report("mixer_sample_rate", sample_rate, "Hz")
+    hb_report("mixer_voices", voices, "voices")
@@ -0,0 +1,20 @@
+# bitmaptools.blit() throughput between 16 bit bitmaps.
+
+
+def hb_run():
+    import bitmaptools
+    import displayio
+
+    width = hb_config("blit_width", 160)
+    height = hb_config("blit_height", 120)
+    source = displayio.Bitmap(width, height, 65536)
+    dest = displayio.Bitmap(width, height, 65536)
+    source.fill(0x1234)
+
+    count = hb_config("blit_count", 50)
+    t0 = hb_now_us()
+    for _ in range(count):
+        bitmaptools.blit(dest, source, 0, 0)
+    elapsed = hb_now_us() - t0
+
+    hb_report("blit_mb_per_s", count * width * height * 2 / elapsed, "MB/s")
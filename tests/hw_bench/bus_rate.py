@@ -0,0 +1,64 @@
+# SPI and I2C transaction rates on the default board buses.
+
+
+def spi_rate():
+    import board
+
+    spi = board.SPI()
+    while not spi.try_lock():
+        pass
+    try:
+        spi.configure(baudrate=hb_config("spi_baudrate", 8_000_000))
+        small = bytearray(4)
+        count = hb_config("bus_transactions", 1000)
+        t0 = hb_now_us()
+        for _ in range(count):
+            spi.write(small)
+        t1 = hb_now_us()
+        big = bytearray(4096)
+        for _ in range(16):
+            spi.write(big)
+        t2 = hb_now_us()
+    finally:
+        spi.unlock()
+
+    hb_report("spi_transactions_per_s", count * 1_000_000 / (t1 - t0), "1/s")
+    hb_report("spi_write_mb_per_s", 16 * len(big) / (t2 - t1), "MB/s")
+
+
+def i2c_rate():
+    import board
+
+    i2c = board.I2C()
+    while not i2c.try_lock():
+        pass
+    try:
+        address = hb_config("i2c_address")
+        if address is None:
+            found = i2c.scan()
+            if not found:
+                hb_report("i2c_error", "no devices")
+                return
+            address = found[0]
+        buf = bytearray(1)
+        count = hb_config("bus_transactions", 1000)
+        t0 = hb_now_us()
+        for _ in range(count):
+            i2c.readfrom_into(address, buf)
+        elapsed = hb_now_us() - t0
+    finally:
+        i2c.unlock()
+
+    hb_report("i2c_address", address)
+    hb_report("i2c_transactions_per_s", count * 1_000_000 / elapsed, "1/s")
+
+
+def hb_run():
+    import board
+
+    if not hasattr(board, "SPI") and not hasattr(board, "I2C"):
+        hb_skip("no board.SPI or board.I2C")
+    if hasattr(board, "SPI"):
+        spi_rate()
+    if hasattr(board, "I2C"):
+        i2c_rate()
@@ -0,0 +1,43 @@
+# Full screen refresh rate of board.DISPLAY.
+
+
+def hb_run():
+    import board
+    import displayio
+
+    display = getattr(board, "DISPLAY", None)
+    if display is None:
+        hb_skip("no board.DISPLAY")
+    if hasattr(display, "time_to_refresh"):
+        hb_skip("e-paper display")
+
+    bitmap = displayio.Bitmap(display.width, display.height, 2)
+    palette = displayio.Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    group = displayio.Group()
+    group.append(displayio.TileGrid(bitmap, pixel_shader=palette))
+
+    if hasattr(display, "bus"):
+        bus = type(display.bus).__name__
+    else:
+        bus = type(display.framebuffer).__name__
+
+    frames = hb_config("display_frames", 20)
+    display.auto_refresh = False
+    display.root_group = group
+    try:
+        display.refresh()
+        t0 = hb_now_us()
+        for i in range(frames):
+            # Changing every pixel makes each frame a full screen update.
+            bitmap.fill(1 - (i & 1))
+            display.refresh()
+        elapsed = hb_now_us() - t0
+    finally:
+        display.root_group = displayio.CIRCUITPYTHON_TERMINAL
+        display.auto_refresh = True
+
+    hb_report("display_bus", bus)
+    hb_report("display_pixels", display.width * display.height, "px")
+    hb_report("display_fps", frames * 1_000_000 / elapsed, "fps")
@@ -0,0 +1,98 @@
+# Helpers shared by the hw_bench scripts. run-hwbench.py defines HB_CONFIG before the benchmark,
+# appends this file after it and then calls hb_main().
+
+import time
+
+
+class HBSkip(Exception):
+    pass
+
+
+def hb_skip(reason):
+    raise HBSkip(reason)
+
+
+def hb_now_us():
+    return time.monotonic_ns() // 1000
+
+
+def hb_config(key, default=None):
+    return HB_CONFIG.get(key, default)
+
+
+def hb_pin(name):
+    import board
+
+    if name is None or not hasattr(board, name):
+        hb_skip("no board.%s" % name)
+    return getattr(board, name)
+
+
+def hb_report(name, value, unit="-"):
+    if isinstance(value, float):
+        value = "%.3f" % value
+    print("HB", name, unit, value)
+
+
+def hb_audio_out():
+    # The audio output to measure underruns with, from HB_CONFIG["audio_out"], for example
+    # {"type": "i2s", "pins": ["I2S_BCLK", "I2S_LRCLK", "I2S_DATA"]}.
+    config = hb_config("audio_out")
+    if config is None:
+        return None
+    pins = [hb_pin(name) for name in config["pins"]]
+    kind = config["type"]
+    if kind == "i2s":
+        import audiobusio
+
+        return audiobusio.I2SOut(*pins)
+    if kind == "pwm":
+        import audiopwmio
+
+        return audiopwmio.PWMAudioOut(*pins)
+    if kind == "dac":
+        import audioio
+
+        return audioio.AudioOut(*pins)
+    hb_skip("unknown audio_out type %s" % kind)
+
+
+def hb_audio_keeps_up(sample, seconds=0.5):
+    # True if sample can be produced faster than it plays. Renders offline when audiocore has the
+    # debug get_buffer() and otherwise plays it and checks for underruns.
+    import audiocore
+
+    if hasattr(audiocore, "get_buffer"):
+        audiocore.reset_buffer(sample)
+        frames = 0
+        needed = seconds * sample.sample_rate
+        t0 = hb_now_us()
+        while frames < needed:
+            _, buf = audiocore.get_buffer(sample)
+            frames += len(buf) // sample.channel_count
+        elapsed = (hb_now_us() - t0) / 1_000_000
+        # Leave some room for the rest of the system.
+        return elapsed < 0.8 * frames / sample.sample_rate
+
+    if not hasattr(audiocore, "stats"):
+        hb_skip("needs CIRCUITPY_AUDIOCORE_DEBUG or CIRCUITPY_AUDIOCORE_STATS")
+    out = hb_audio_out()
+    if out is None:
+        hb_skip("no audio_out in config")
+    try:
+        audiocore.reset_stats()
+        out.play(sample, loop=True)
+        time.sleep(seconds)
+        out.stop()
+        return audiocore.stats()["underruns"] == 0
+    finally:
+        out.deinit()
+
+
+def hb_main():
+    try:
+        hb_run()
+    except HBSkip as er:
+        print("SKIP", er.args[0])
+    except ImportError as er:
+        print("SKIP", er)
@@ -0,0 +1,51 @@
+# File read and write speed on CIRCUITPY and on an SD card.
+
+
+def measure(path, prefix):
+    import os
+
+    size = hb_config("storage_bytes", 64 * 1024)
+    chunk = bytearray(4096)
+    filename = path + "/hw_bench.bin"
+    t0 = hb_now_us()
+    try:
+        with open(filename, "wb") as f:
+            for _ in range(size // len(chunk)):
+                f.write(chunk)
+    except OSError as er:
+        hb_report(prefix + "_error", er.errno)
+        return
+    t1 = hb_now_us()
+    with open(filename, "rb") as f:
+        while f.readinto(chunk):
+            pass
+    t2 = hb_now_us()
+    os.remove(filename)
+
+    hb_report(prefix + "_write_mb_per_s", size / (t1 - t0), "MB/s")
+    hb_report(prefix + "_read_mb_per_s", size / (t2 - t1), "MB/s")
+
+
+def mount_sd():
+    import os
+
+    if "sd" in os.listdir("/"):
+        return "/sd"
+    cs = hb_config("sd_cs")
+    if cs is None:
+        return None
+    import board
+    import sdcardio
+    import storage
+
+    sd = sdcardio.SDCard(board.SPI(), hb_pin(cs), hb_config("sd_baudrate", 8_000_000))
+    storage.mount(storage.VfsFat(sd), "/sd")
+    return "/sd"
+
+
+def hb_run():
+    # CIRCUITPY is usually read-only to code while USB has it, which shows up as flash_error.
+    measure("", "flash")
+    sd = mount_sd()
+    if sd is not None:
+        measure(sd, "sd")
@@ -0,0 +1,22 @@
+# The most synthio notes that can be played at once without falling behind.
+
+
+def hb_run():
+    import synthio
+
+    sample_rate = hb_config("sample_rate", 22050)
+    synth = synthio.Synthesizer(sample_rate=sample_rate)
+    max_polyphony = synthio.Synthesizer.max_polyphony
+
+    polyphony = 0
+    for notes in range(1, max_polyphony + 1):
+        synth.release_all()
+        synth.press(range(48, 48 + 2 * notes, 2))
+        if not hb_audio_keeps_up(synth):
+            break
+        polyphony = notes
+    synth.deinit()
+
+    hb_report("synthio_sample_rate", sample_rate, "Hz")
+    hb_report("synthio_max_polyphony", max_polyphony, "notes")
+    hb_report("synthio_polyphony", polyphony, "notes")
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+#
+# SPDX-License-Identifier: MIT
+
+# Runs the hw_bench hardware benchmarks on a board and prints the results as JSON.
+
+import argparse
+import base64
+import json
+import os
+import sys
+import time
+import urllib.error
+import urllib.request
+
+sys.path.append("../tools")
+import pyboard
+
+BENCH_SCRIPT_DIR = "hw_bench/"
+
+BOARD_INFO_SCRIPT = b"""
+import board, os
+print(board.board_id)
+print(os.uname().version)
+"""
+
+
+def run_script(target, script):
+    try:
+        target.enter_raw_repl()
+        return str(target.exec_(script).strip(), "utf-8"), None
+    except pyboard.PyboardError as er:
+        return None, er
+
+
+def parse_value(value):
+    try:
+        return int(value)
+    except ValueError:
+        pass
+    try:
+        return float(value)
+    except ValueError:
+        return value
+
+
+def run_benchmark(target, config, test_file):
+    script = b"HB_CONFIG = %s\n\n" % bytes(repr(config), "utf-8")
+    with open(test_file, "rb") as f:
+        script += f.read()
+    with open(BENCH_SCRIPT_DIR + "hwbench.py", "rb") as f:
+        script += f.read()
+    script += b"hb_main()\n"
+
+    output, err = run_script(target, script)
+    if err is not None:
+        return {"error": "CRASH: %r" % err}
+    results = {}
+    for line in output.splitlines():
+        if line.startswith("SKIP"):
+            return {"skip": line[4:].strip()}
+        if line.startswith("HB "):
+            _, name, unit, value = line.split(None, 3)
+            results[name] = {"value": parse_value(value), "unit": unit}
+    return results
+
+
+def web_request(url, password, method="GET", data=None):
+    request = urllib.request.Request(url, data=data, method=method)
+    auth = base64.b64encode(bytes(":" + password, "utf-8")).decode("ascii")
+    request.add_header("Authorization", "Basic " + auth)
+    with urllib.request.urlopen(request) as response:
+        return response.read()
+
+
+def run_web_benchmark(host, password, size):
+    # Upload a file through the web workflow, download it back and then remove it.
+    url = "http://%s/fs/hw_bench.bin" % host
+    results = {}
+    try:
+        t0 = time.monotonic()
+        web_request(url, password, "PUT", bytes(size))
+        t1 = time.monotonic()
+        results["web_upload_mb_per_s"] = {"value": size / (t1 - t0) / 1e6, "unit": "MB/s"}
+        data = web_request(url, password)
+        t2 = time.monotonic()
+        results["web_download_mb_per_s"] = {"value": len(data) / (t2 - t1) / 1e6, "unit": "MB/s"}
+        web_request(url, password, "DELETE")
+    except (urllib.error.URLError, OSError) as er:
+        results["error"] = str(er)
+    return results
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(
+        description="Run hardware benchmarks for CircuitPython boards"
+    )
+    cmd_parser.add_argument(
+        "-d", "--device", default="/dev/ttyACM0", help="the device for pyboard.py"
+    )
+    cmd_parser.add_argument(
+        "-c", "--config", help="JSON file with board specific settings for the benchmarks"
+    )
+    cmd_parser.add_argument("-o", "--output", help="write the JSON results to this file")
+    cmd_parser.add_argument("--web", help="host name or address for the web workflow benchmark")
+    cmd_parser.add_argument(
+        "--web-password", default="", help="CIRCUITPY_WEB_API_PASSWORD of the board"
+    )
+    cmd_parser.add_argument(
+        "--web-bytes", type=int, default=256 * 1024, help="file size for the web benchmark"
+    )
+    cmd_parser.add_argument("files", nargs="*", help="benchmark files to run")
+    args = cmd_parser.parse_args()
+
+    config = {}
+    if args.config:
+        with open(args.config) as f:
+            config = json.load(f)
+
+    if args.files:
+        tests = sorted(args.files)
+    else:
+        tests = sorted(
+            BENCH_SCRIPT_DIR + test_file
+            for test_file in os.listdir(BENCH_SCRIPT_DIR)
+            if test_file.endswith(".py") and test_file != "hwbench.py"
+        )
+
+    target = pyboard.Pyboard(args.device)
+    output, err = run_script(target, BOARD_INFO_SCRIPT)
+    if err is not None:
+        print("Could not read board info: %r" % err, file=sys.stderr)
+        sys.exit(1)
+    board_id, version = output.splitlines()
+
+    report = {"board": board_id, "version": version, "config": config, "results": {}}
+    for test_file in tests:
+        print(test_file, file=sys.stderr)
+        name = os.path.splitext(os.path.basename(test_file))[0]
+        # Each benchmark starts from a soft reset when run_script() enters the raw REPL.
+        report["results"][name] = run_benchmark(target, config, test_file)
+
+    target.exit_raw_repl()
+    target.close()
+
+    if args.web:
+        print("web workflow", file=sys.stderr)
+        report["results"]["web_workflow"] = run_web_benchmark(
+            args.web, args.web_password, args.web_bytes
+        )
+
+    text = json.dumps(report, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+#
+# SPDX-License-Identifier: MIT
+
+# Runs perf_bench and internal_bench under valgrind on the unix port and reports instruction and
+# allocation counts. Unlike times these don't change from run to run, so they can be compared
+# between commits directly.
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+MICROPYTHON = os.getenv("MICROPY_MICROPYTHON", "../ports/unix/build-perfcount/micropython")
+VALGRIND = os.getenv("MICROPY_VALGRIND", "valgrind")
+
+PERF_BENCH_DIR = "perf_bench/"
+INTERNAL_BENCH_DIR = "internal_bench/"
+
+# Appended to perf_bench tests in place of benchrun.py. Setup is counted on its own so it can be
+# subtracted from the full run.
+PERF_COUNT_RUN = """
+def bm_count(N, M, do_run):
+    import gc
+
+    cur_nm = (0, 0)
+    param = None
+    for nm, p in bm_params.items():
+        if 10 * nm[0] <= 12 * N and nm[1] <= M and nm > cur_nm:
+            cur_nm = nm
+            param = p
+    if param is None:
+        print("SKIP")
+        return
+
+    run, result = bm_setup(param)
+    before = gc.stats()
+    if do_run:
+        run()
+    after = gc.stats()
+    print(sum(after["allocs"]) - sum(before["allocs"]), after["bytes_allocated"] - before["bytes_allocated"])
+"""
+
+# Stands in for internal_bench/bench.py.
+INTERNAL_COUNT_BENCH = """
+import gc
+
+ITERS = %d
+
+
+def run(f):
+    before = gc.stats()
+    f(ITERS)
+    after = gc.stats()
+    print(sum(after["allocs"]) - sum(before["allocs"]), after["bytes_allocated"] - before["bytes_allocated"])
+"""
+
+
+def count(script_dir, script):
+    # Returns (instructions, allocations, bytes allocated) or an error string.
+    path = os.path.join(script_dir, "perfcount_test.py")
+    with open(path, "w") as f:
+        f.write(script)
+    p = subprocess.run(
+        [
+            VALGRIND,
+            "--tool=cachegrind",
+            "--cache-sim=no",
+            "--cachegrind-out-file=/dev/null",
+            MICROPYTHON,
+            "-X",
+            "emit=bytecode",
+            path,
+        ],
+        stdout=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+        cwd=script_dir,
+    )
+    output = str(p.stdout, "utf-8").strip()
+    if p.returncode != 0:
+        return "CRASH: %s" % output.splitlines()[-1:]
+    if output.endswith("SKIP"):
+        return "SKIP"
+    match = re.search(r"I\s+refs:\s+([\d,]+)", str(p.stderr, "utf-8"))
+    if match is None:
+        return "no instruction count from valgrind"
+    allocs, nbytes = output.splitlines()[-1].split()
+    return int(match.group(1).replace(",", "")), int(allocs), int(nbytes)
+
+
+def count_delta(script_dir, full, baseline):
+    # Count the work in full minus the work in baseline to leave out startup and setup.
+    a = count(script_dir, full)
+    if isinstance(a, str):
+        return {"error": a}
+    b = count(script_dir, baseline)
+    if isinstance(b, str):
+        return {"error": b}
+    return {"instructions": a[0] - b[0], "allocs": a[1] - b[1], "bytes_allocated": a[2] - b[2]}
+
+
+def perf_bench(script_dir, test_file, n, m):
+    with open(test_file) as f:
+        script = f.read() + PERF_COUNT_RUN
+    return count_delta(
+        script_dir,
+        script + "bm_count(%d, %d, True)\n" % (n, m),
+        script + "bm_count(%d, %d, False)\n" % (n, m),
+    )
+
+
+def internal_bench(script_dir, test_file, iters):
+    with open(test_file) as f:
+        script = f.read()
+
+    def with_iters(iters):
+        with open(os.path.join(script_dir, "bench.py"), "w") as f:
+            f.write(INTERNAL_COUNT_BENCH % iters)
+        return count(script_dir, script)
+
+    a = with_iters(iters)
+    if isinstance(a, str):
+        return {"error": a}
+    b = with_iters(0)
+    if isinstance(b, str):
+        return {"error": b}
+    return {"instructions": a[0] - b[0], "allocs": a[1] - b[1], "bytes_allocated": a[2] - b[2]}
+
+
+def compute_diff(file1, file2):
+    with open(file1) as f:
+        d1 = json.load(f)["results"]
+    with open(file2) as f:
+        d2 = json.load(f)["results"]
+    print("{:40} {:>14} {:>9} {:>10}".format("", "instructions", "diff%", "allocs"))
+    for name in sorted(set(d1) & set(d2)):
+        r1, r2 = d1[name], d2[name]
+        if "instructions" not in r1 or "instructions" not in r2:
+            continue
+        diff = 100 * (r2["instructions"] - r1["instructions"]) / max(r1["instructions"], 1)
+        print(
+            "{:40} {:>14} {:>+8.3f}% {:>+10}".format(
+                name, r2["instructions"], diff, r2["allocs"] - r1["allocs"]
+            )
+        )
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(
+        description="Count instructions and allocations of the benchmarks on the unix port"
+    )
+    cmd_parser.add_argument(
+        "-t", "--diff", nargs=2, metavar="FILE", help="compare two previous JSON outputs"
+    )
+    cmd_parser.add_argument("-N", type=int, default=100, help="perf_bench N parameter")
+    cmd_parser.add_argument("-M", type=int, default=100, help="perf_bench M parameter")
+    cmd_parser.add_argument(
+        "--iters", type=int, default=100000, help="iterations for internal_bench tests"
+    )
+    cmd_parser.add_argument("-o", "--output", help="write the JSON results to this file")
+    cmd_parser.add_argument("files", nargs="*", help="benchmark files to run")
+    args = cmd_parser.parse_args()
+
+    if args.diff:
+        compute_diff(*args.diff)
+        sys.exit(0)
+
+    if shutil.which(VALGRIND) is None:
+        print("%s not found" % VALGRIND, file=sys.stderr)
+        sys.exit(1)
+
+    if args.files:
+        tests = sorted(args.files)
+    else:
+        tests = sorted(
+            PERF_BENCH_DIR + f
+            for f in os.listdir(PERF_BENCH_DIR)
+            if f.endswith(".py") and f != "benchrun.py"
+        )
+        tests += sorted(
+            INTERNAL_BENCH_DIR + f
+            for f in os.listdir(INTERNAL_BENCH_DIR)
+            if f.endswith(".py") and f != "bench.py"
+        )
+
+    report = {"N": args.N, "M": args.M, "iters": args.iters, "results": {}}
+    had_error = False
+    # Tests run from a scratch directory so internal_bench imports our bench.py.
+    with tempfile.TemporaryDirectory() as script_dir:
+        for test_file in tests:
+            print(test_file + ": ", end="", file=sys.stderr)
+            if os.path.normpath(test_file).startswith(os.path.normpath(INTERNAL_BENCH_DIR)):
+                result = internal_bench(script_dir, test_file, args.iters)
+            else:
+                result = perf_bench(script_dir, test_file, args.N, args.M)
+            print(result.get("error", result.get("instructions")), file=sys.stderr)
+            if "error" in result and result["error"] != "SKIP":
+                had_error = True
+            report["results"][test_file] = result
+
+    text = json.dumps(report, indent=2)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+
+    if had_error:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,11 @@ from math import sin, pi, ceil
 from audiocore import get_buffer
 from synthio import Note, LFO, MathOperation, Synthesizer
 
+# The expected outputs print floats with the fewest digits that read back.
+if str(7 * (1 / 8000)) != "0.000875":
+    print("SKIP")
+    raise SystemExit
+
 bend_out = array.array("h", [0, 32767])
 bend_in = array.array("h", [32767, 0])
 sweep = array.array("h", [-32767, 32767])
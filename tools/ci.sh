@@ -499,6 +499,18 @@ function ci_unix_standard_v2_run_tests {
     ci_unix_run_tests_full_helper standard
 }
 
+function ci_unix_perfcount_setup {
+    sudo apt-get install valgrind
+}
+
+function ci_unix_perfcount_build {
+    ci_unix_build_helper VARIANT=perfcount
+}
+
+function ci_unix_perfcount_run {
+    (cd tests && MICROPY_MICROPYTHON=../ports/unix/build-perfcount/micropython ./run-perfcount.py -o "$@")
+}
+
 function ci_unix_coverage_setup {
     sudo pip3 install setuptools
     sudo pip3 install pyelftools
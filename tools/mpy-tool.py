@@ -126,6 +126,8 @@ MP_PERSISTENT_OBJ_INT = 7
 MP_PERSISTENT_OBJ_FLOAT = 8
 MP_PERSISTENT_OBJ_COMPLEX = 9
 MP_PERSISTENT_OBJ_TUPLE = 10
+# CIRCUITPY-CHANGE
+MP_PERSISTENT_OBJ_DICT = 11
 
 
 MP_SCOPE_FLAG_GENERATOR = 0x01
@@ -556,6 +558,17 @@ class MPFunTable:
         return "mp_fun_table"
 
 
+# CIRCUITPY-CHANGE
+# A read-only dict from const(). The items are kept as pairs, in order, because keys such as 1
+# and True are different to MicroPython but not to a Python dict.
+class MPConstDict:
+    def __init__(self, items):
+        self.items = items
+
+    def __repr__(self):
+        return "{%s}" % ", ".join("%r: %r" % item for item in self.items)
+
+
 class CompiledModule:
     def __init__(
         self,
@@ -802,6 +815,39 @@ class CompiledModule:
                     print("    %s," % ref)
                 print("}};")
                 return "MP_ROM_PTR(&%s)" % obj_name
+        # CIRCUITPY-CHANGE
+        elif isinstance(obj, MPConstDict):
+            # Stored like the dicts of built-in modules: a fixed table searched in order.
+            elem_refs = []
+            for i, (key, value) in enumerate(obj.items):
+                elem_refs.append(
+                    (
+                        self.freeze_constant_obj("%s_k%u" % (obj_name, i), key),
+                        self.freeze_constant_obj("%s_v%u" % (obj_name, i), value),
+                    )
+                )
+            all_keys_are_qstrs = all(ref.startswith("MP_ROM_QSTR(") for ref, _ in elem_refs)
+            if elem_refs:
+                print("static const mp_rom_map_elem_t %s_table[%u] = {" % (obj_name, len(elem_refs)))
+                for key_ref, value_ref in elem_refs:
+                    print("    { %s, %s }," % (key_ref, value_ref))
+                print("};")
+                table = "(mp_map_elem_t *)(mp_rom_map_elem_t *)%s_table" % obj_name
+            else:
+                table = "NULL"
+            print("static const mp_obj_dict_t %s = {" % obj_name)
+            print("    .base = {&mp_type_dict},")
+            print("    .map = {")
+            print("        .all_keys_are_qstrs = %u," % all_keys_are_qstrs)
+            print("        .is_fixed = 1,")
+            print("        .is_ordered = 1,")
+            print("        .used = %u," % len(elem_refs))
+            print("        .alloc = %u," % len(elem_refs))
+            print("        .table = %s," % table)
+            print("    },")
+            print("};")
+            const_obj_content += 4 * 4 + 8 * len(elem_refs)
+            return "MP_ROM_PTR(&%s)" % obj_name
         else:
             raise FreezeError(self, "freezing of object %r is not implemented" % (obj,))
 
@@ -1244,6 +1290,12 @@ def read_obj(reader, segments):
     elif obj_type == MP_PERSISTENT_OBJ_TUPLE:
         ln = reader.read_uint()
         return tuple(read_obj(reader, segments) for _ in range(ln))
+    # CIRCUITPY-CHANGE
+    elif obj_type == MP_PERSISTENT_OBJ_DICT:
+        ln = reader.read_uint()
+        return MPConstDict(
+            [(read_obj(reader, segments), read_obj(reader, segments)) for _ in range(ln)]
+        )
     else:
         ln = reader.read_uint()
         start_pos = reader.tell()
@@ -1712,7 +1764,13 @@ def merge_mpy(compiled_modules, output_file):
         ## CIRCUITPY-CHANGE: "C" is used for CircuitPython
         header[0] = ord("C")
         header[1] = config.MPY_VERSION
-        header[2] = config.native_arch << 2 | config.MPY_SUB_VERSION if config.native_arch else 0
+        if config.native_arch:
+            header[2] = config.native_arch << 2 | config.MPY_SUB_VERSION
+        else:
+            # CIRCUITPY-CHANGE: keep the feature bits of bytecode-only files.
+            header[2] = 0
+            for cm in compiled_modules:
+                header[2] |= cm.header[2] & 3
         header[3] = config.mp_small_int_bits
         merged_mpy.extend(header)
 